@@ -230,6 +230,8 @@ public:
   void setChild(const bool isChild) override;
   void enableHistoryRecordingForChild(const bool on) override;
   bool isRecordingHistoryForChild() { return m_recordHistoryForChild; }
+  void enableFastChildExecution(const bool on);
+  bool isFastChildExecution() const { return m_fastChildExecution; }
   void setAlwaysStoreInADS(const bool doStore) override;
   bool getAlwaysStoreInADS() const override;
   void setRethrows(const bool rethrow) override;
@@ -422,6 +424,8 @@ private:
 
   bool executeInternal();
 
+  bool executeFastChild();
+
   bool executeAsyncImpl(const Poco::Void &i);
 
   bool doCallProcessGroups(Mantid::Types::Core::DateAndTime &start_time);
@@ -460,8 +464,9 @@ private:
   bool m_isChildAlgorithm;      ///< Algorithm is a child algorithm
   bool m_recordHistoryForChild; ///< Flag to indicate whether history should be
                                 /// recorded. Applicable to child algs only
-  bool m_alwaysStoreInADS; ///< Always store in the ADS, even for child algos
-  bool m_runningAsync;     ///< Algorithm is running asynchronously
+  bool m_alwaysStoreInADS;   ///< Always store in the ADS, even for child algos
+  bool m_fastChildExecution; ///< Execute as a child with the least overhead
+  bool m_runningAsync;       ///< Algorithm is running asynchronously
   std::atomic<bool> m_running; ///< Algorithm is running
   bool m_rethrow; ///< Algorithm should rethrow exceptions while executing
   bool m_isAlgStartupLoggingEnabled; /// Whether to log alg startup and
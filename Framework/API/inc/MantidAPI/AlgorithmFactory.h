@@ -12,6 +12,7 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/DllConfig.h"
 #include "MantidKernel/DynamicFactory.h"
+#include "MantidKernel/LibraryManager.h"
 #include "MantidKernel/SingletonHolder.h"
 #include <sstream>
 #include <unordered_set>
@@ -73,6 +74,7 @@ public:
   std::pair<std::string, int>
   subscribe(std::unique_ptr<Kernel::AbstractInstantiator<T>> instantiator,
             const SubscribeAction replaceExisting = ErrorIfExists) {
+    const auto lock = Kernel::LibraryManager::Instance().lockFactories();
     boost::shared_ptr<IAlgorithm> tempAlg = instantiator->createInstance();
     const int version = extractAlgVersion(tempAlg);
     const std::string className = extractAlgName(tempAlg);
@@ -137,6 +139,8 @@ private:
   /// Create an algorithm object with the specified name
   boost::shared_ptr<Algorithm> createAlgorithm(const std::string &name,
                                                const int version) const;
+  /// Open the deferred plugin libraries providing an algorithm
+  void openLibraryProviding(const std::string &name, const int version) const;
 
   /// Private Constructor for singleton class
   AlgorithmFactoryImpl();
@@ -0,0 +1,127 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_ALGORITHMRESULTCACHE_H_
+#define MANTID_API_ALGORITHMRESULTCACHE_H_
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidAPI/Workspace_fwd.h"
+#include "MantidKernel/SingletonHolder.h"
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class Algorithm;
+
+/** AlgorithmResultCache : remembers the outputs of algorithms so that running
+  an algorithm again with the same inputs restores them instead of executing
+  it.
+
+  Caching is opt-in: only the algorithms named in the
+  "algorithms.cache.names" configuration key, separated by semicolons, or
+  given to setAlgorithms() are cached. A result is keyed by the name and
+  version of the algorithm, the values of its input properties, a hash of
+  the content of its input workspaces and the size and modification time of
+  the files it loads. The hash of a matrix workspace covers its data, logs,
+  goniometer, sample shape and material, and the positions, rotations and
+  parameters of the components of its instrument. Algorithms with InOut
+  workspace properties, or with an input workspace of a type that cannot be
+  hashed, are never cached.
+
+  Results are kept in memory, as copies of the output workspaces, up to
+  "algorithms.cache.memorylimit" MB, after which the least recently used are
+  dropped. If "algorithms.cache.directory" is set the results are also saved
+  there, with SaveNexusProcessed, up to "algorithms.cache.disklimit" MB, so
+  that they survive the session.
+*/
+class MANTID_API_DLL AlgorithmResultCacheImpl {
+public:
+  AlgorithmResultCacheImpl(const AlgorithmResultCacheImpl &) = delete;
+  AlgorithmResultCacheImpl &
+  operator=(const AlgorithmResultCacheImpl &) = delete;
+
+  void setAlgorithms(const std::vector<std::string> &names);
+  void setMemoryLimit(size_t bytes);
+  void setDirectory(const std::string &directory, size_t diskLimit);
+  /// @return true if the results of the named algorithm are cached
+  bool isEnabledFor(const std::string &algorithmName) const;
+  void setUsesOnlyInstrument(const std::string &algorithmName,
+                             const std::string &propertyName);
+
+  std::string key(const Algorithm &alg) const;
+  bool restore(const std::string &key, Algorithm &alg);
+  void store(const std::string &key, const Algorithm &alg);
+
+  size_t size() const;
+  size_t memorySize() const;
+  void clear();
+
+  static bool contentHash(const Workspace &ws, std::string &hash);
+
+private:
+  friend struct Mantid::Kernel::CreateUsingNew<AlgorithmResultCacheImpl>;
+
+  AlgorithmResultCacheImpl();
+  ~AlgorithmResultCacheImpl() = default;
+
+  /// The outputs of an execution of an algorithm
+  struct Result {
+    /// Copies of the output workspaces, by property name
+    std::vector<std::pair<std::string, Workspace_sptr>> workspaces;
+    /// The values of the other output properties, by property name
+    std::vector<std::pair<std::string, std::string>> values;
+    /// The memory used by the workspaces
+    size_t memorySize = 0;
+  };
+  using Entries = std::list<std::pair<std::string, Result>>;
+
+  bool usesOnlyInstrument(const std::string &algorithmName,
+                          const std::string &propertyName) const;
+  void insert(const std::string &key, Result result);
+  bool restore(const Result &result, Algorithm &alg) const;
+  bool loadFromDisk(const std::string &key, Result &result) const;
+  void saveToDisk(const std::string &key, const Result &result) const;
+  void trimDisk() const;
+
+  /// Quick check that any algorithm is cached
+  std::atomic<bool> m_enabled{false};
+  std::unordered_set<std::string> m_algorithms;
+  /// Input workspaces, by algorithm and property name, that are only used
+  /// for their instrument
+  std::set<std::pair<std::string, std::string>> m_instrumentOnlyInputs;
+  size_t m_memoryLimit;
+  std::string m_directory;
+  size_t m_diskLimit;
+  /// The results, the most recently used first
+  Entries m_entries;
+  std::unordered_map<std::string, Entries::iterator> m_index;
+  size_t m_memorySize{0};
+  mutable std::mutex m_mutex;
+};
+
+using AlgorithmResultCache =
+    Mantid::Kernel::SingletonHolder<AlgorithmResultCacheImpl>;
+
+} // namespace API
+} // namespace Mantid
+
+namespace Mantid {
+namespace Kernel {
+EXTERN_MANTID_API template class MANTID_API_DLL
+    Mantid::Kernel::SingletonHolder<Mantid::API::AlgorithmResultCacheImpl>;
+}
+} // namespace Mantid
+
+#endif /* MANTID_API_ALGORITHMRESULTCACHE_H_ */
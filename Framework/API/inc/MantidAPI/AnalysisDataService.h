@@ -17,6 +17,9 @@
 
 #include <Poco/AutoPtr.h>
 
+#include <cstdint>
+#include <unordered_map>
+
 namespace Mantid {
 
 namespace API {
@@ -40,6 +43,13 @@ class WorkspaceGroup;
     @author L C Chapon, ISIS, Rutherford Appleton Laboratory
 
     Modified to inherit from DataService
+
+    The memory used by the workspaces can be limited with the
+    "AnalysisDataService.MemoryLimit" configuration key, in MB. Beyond it the
+    least recently used Workspace2Ds that are only held by the service are
+    spilled to a file in "AnalysisDataService.SpillDirectory", keeping their
+    metadata in memory, and are reloaded when they are next retrieved or
+    listed by getObjects().
 */
 class DLLExport AnalysisDataServiceImpl final
     : public Kernel::DataService<API::Workspace> {
@@ -117,7 +127,7 @@ public:
    * @return a shared pointer of WSTYPE
    */
   template <typename WSTYPE>
-  boost::shared_ptr<WSTYPE> retrieveWS(const std::string &name) const {
+  boost::shared_ptr<WSTYPE> retrieveWS(const std::string &name) {
     // Get as a bare workspace
     try {
       // Cast to the desired type and return that.
@@ -131,7 +141,7 @@ public:
 
   std::vector<Workspace_sptr>
   retrieveWorkspaces(const std::vector<std::string> &names,
-                     bool unrollGroups = false) const;
+                     bool unrollGroups = false);
 
   /** @name Methods to work with workspace groups */
   //@{
@@ -145,10 +155,26 @@ public:
   std::map<std::string, Workspace_sptr> topLevelItems() const;
   void shutdown() override;
 
+  /** @name Methods to limit the memory used by the workspaces */
+  //@{
+  void setMemoryLimit(size_t bytes);
+  /// @return the memory the workspaces may use in bytes, 0 if unlimited
+  size_t memoryLimit() const { return m_memoryLimit; }
+  void setSpillDirectory(const std::string &directory);
+  size_t memoryUsage() const;
+  bool isSpilled(const std::string &name) const;
+  //@}
+
 private:
   /// Checks the name is valid, throwing if not
   void verifyName(const std::string &name,
                   const boost::shared_ptr<API::WorkspaceGroup> &workspace);
+  Workspace_sptr beforeRetrieve(const std::string &name,
+                               const Workspace_sptr &workspace) override;
+  /// Look up a workspace without reloading it if it was spilled
+  Workspace_sptr retrieveStored(const std::string &name) const;
+  void markUsed(const Workspace &workspace);
+  void spillWorkspaces();
 
   friend struct Mantid::Kernel::CreateUsingNew<AnalysisDataServiceImpl>;
   /// Constructor
@@ -162,6 +188,14 @@ private:
 
   /// The string of illegal characters
   std::string m_illegalChars;
+  /// The memory the workspaces may use before some are spilled to disk
+  size_t m_memoryLimit;
+  /// The directory workspaces are spilled to
+  std::string m_spillDirectory;
+  /// Counts the uses of workspaces, to find the least recently used
+  uint64_t m_useCount{0};
+  /// The use count at which each workspace, by name, was last used
+  std::unordered_map<std::string, uint64_t> m_lastUsed;
 };
 
 using AnalysisDataService =
@@ -179,6 +179,8 @@ protected:
   virtual void insert(size_t index) = 0;
   /// Removes an item.
   virtual void remove(size_t index) = 0;
+  /// Removes several items.
+  virtual void removeRows(const std::vector<size_t> &indices);
   /// Pointer to a data element
   virtual void *void_pointer(size_t index) = 0;
   /// Pointer to a data element
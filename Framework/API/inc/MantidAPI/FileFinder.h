@@ -11,6 +11,7 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAPI/DllConfig.h"
+#include "MantidAPI/FileSearchCache.h"
 #include "MantidAPI/IArchiveSearch.h"
 #include "MantidKernel/SingletonHolder.h"
 
@@ -61,6 +62,7 @@ public:
                            const std::vector<std::string> &exts) const;
   void getUniqueExtensions(const std::vector<std::string> &extensionsToAdd,
                            std::vector<std::string> &uniqueExts) const;
+  void clearCache();
 
 private:
   friend struct Mantid::Kernel::CreateUsingNew<FileFinderImpl>;
@@ -82,6 +84,8 @@ private:
   std::string toUpper(const std::string &src) const;
   /// glob option - set to case sensitive or insensitive
   int m_globOption;
+  /// The listings of the search directories and the paths found in archives
+  mutable FileSearchCache m_cache;
 };
 
 using FileFinder = Mantid::Kernel::SingletonHolder<FileFinderImpl>;
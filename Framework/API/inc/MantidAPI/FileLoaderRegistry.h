@@ -16,6 +16,7 @@
 #endif
 
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -59,6 +60,7 @@ public:
    */
   template <typename Type> void subscribe(LoaderFormat format) {
     SubscriptionValidator<Type>::check(format);
+    const auto lock = Kernel::LibraryManager::Instance().lockFactories();
     const auto nameVersion = AlgorithmFactory::Instance().subscribe<Type>();
     // If the factory didn't throw then the name is valid
     m_names[format].insert(nameVersion);
@@ -76,6 +78,8 @@ public:
   /// Checks whether the given algorithm can load the file
   bool canLoad(const std::string &algorithmName,
                const std::string &filename) const;
+  /// Returns the names of the registered loaders
+  std::set<std::string> loaderNames() const;
 
 private:
   /// Friend so that CreateUsingNew
@@ -0,0 +1,78 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_FILESEARCHCACHE_H_
+#define MANTID_API_FILESEARCHCACHE_H_
+
+#include "MantidAPI/DllConfig.h"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Mantid {
+namespace API {
+
+/** FileSearchCache : remembers what FileFinder has found so that the data
+  search directories and archives are not probed file by file again.
+
+  <ul>
+  <li>The names of the files in each data search directory are listed once
+  and kept for "datasearch.directorycache.ttl" seconds, so that looking for a
+  file is a lookup instead of a stat call per directory, name and
+  extension.</li>
+  <li>The paths found in the archives are kept for
+  "datasearch.archivecache.ttl" seconds, keyed by the names of the run that
+  was looked for. They are also saved to a file, by default
+  archive_paths.cache in the user properties directory, so that they
+  survive the session. A path is checked to still exist before it is
+  returned, and dropped otherwise.</li>
+  </ul>
+
+  A TTL of 0 switches the corresponding cache off.
+*/
+class MANTID_API_DLL FileSearchCache {
+public:
+  FileSearchCache();
+  explicit FileSearchCache(const std::string &archiveCacheFile);
+
+  bool directoryContains(const std::string &directory,
+                         const std::string &filename);
+  std::string archivePath(const std::string &key);
+  void addArchivePath(const std::string &key, const std::string &path);
+  void clear();
+
+private:
+  using Clock = std::chrono::system_clock;
+
+  /// The names of the files in a directory, when they were listed
+  struct Listing {
+    std::unordered_set<std::string> names;
+    Clock::time_point listed;
+  };
+  /// A path found in the archives, when it was found
+  struct ArchiveEntry {
+    std::string path;
+    Clock::time_point found;
+  };
+
+  void loadArchiveCache();
+
+  /// The file the archive paths are saved to
+  std::string m_archiveCacheFile;
+  /// Whether the archive paths have been read from the file
+  bool m_archiveCacheLoaded{false};
+  std::unordered_map<std::string, Listing> m_listings;
+  std::unordered_map<std::string, ArchiveEntry> m_archivePaths;
+  std::mutex m_mutex;
+};
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_FILESEARCHCACHE_H_ */
@@ -8,6 +8,7 @@
 #define MANTID_API_FRAMEWORKMANAGER_H_
 
 #include <string>
+#include <vector>
 
 #ifdef MPI_BUILD
 #include <boost/mpi/environment.hpp>
@@ -94,6 +95,10 @@ private:
   /// Load a set of plugins using a key from the ConfigService
   void loadPluginsUsingKey(const std::string &locationKey,
                            const std::string &excludeKey);
+  /// Load a set of plugins, opening those listed in a manifest when needed
+  void loadPluginsUsingManifest(const std::string &pluginDir,
+                                const std::vector<std::string> &excludes,
+                                const std::string &manifestPath);
   /// Set up the global locale
   void setGlobalNumericLocaleToC();
   /// Silence NeXus output
@@ -12,6 +12,8 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/DllConfig.h"
 #include "MantidKernel/DynamicFactory.h"
+#include "MantidKernel/LibraryManager.h"
+#include "MantidKernel/LRUCache.h"
 #include "MantidKernel/SingletonHolder.h"
 #include <vector>
 
@@ -68,6 +70,9 @@ public:
 
   void unsubscribe(const std::string &className);
 
+  /// Returns the function names, including those of deferred plugins
+  const std::vector<std::string> getKeys() const override;
+
 private:
   friend struct Mantid::Kernel::CreateUsingNew<FunctionFactoryImpl>;
 
@@ -88,6 +93,8 @@ private:
   createComposite(const Expression &expr,
                   std::map<std::string, std::string> &parentAttributes) const;
 
+  /// Open the deferred plugin libraries providing functions
+  void openDeferredLibraries() const;
   /// Throw an exception
   void inputError(const std::string &str = "") const;
   /// Add constraints to the created function
@@ -107,6 +114,8 @@ private:
 
   mutable std::map<std::string, std::vector<std::string>> m_cachedFunctionNames;
   mutable std::mutex m_mutex;
+  /// The expressions parsed from the most recently used function strings
+  mutable Kernel::LRUCache<std::string, Expression> m_parsedExpressions;
 };
 
 /**
@@ -116,6 +125,10 @@ private:
  */
 template <typename FunctionType>
 std::vector<std::string> FunctionFactoryImpl::getFunctionNames() const {
+  // Subscribing functions clears the cache, so open the libraries first. The
+  // factories are locked before the cache, as when creating the functions.
+  const auto factoryLock = Kernel::LibraryManager::Instance().lockFactories();
+  openDeferredLibraries();
   std::lock_guard<std::mutex> _lock(m_mutex);
 
   const std::string soughtType(typeid(FunctionType).name());
@@ -144,6 +144,13 @@ class FunctionHandler;
    number and names of the parameters
     can depend on the attributes.
 
+    A function may cache intermediate results when it is evaluated, so one
+    function object must not be evaluated by several threads at once. Code
+    that evaluates a function in parallel gives each thread its own copy made
+    with clone(), as ParDomain does. Making a copy goes through the function's
+    string representation and is not cheap, so copies should be kept and
+    have their parameters updated rather than be remade for every evaluation.
+
     @author Roman Tolchenov, Tessella Support Services plc
     @date 16/10/2009
     @date 22/12/2010
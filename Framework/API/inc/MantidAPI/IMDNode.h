@@ -204,6 +204,44 @@ public:
       signal_t &signal, signal_t &errorSquared,
       const coord_t innerRadiusSquared = 0.0,
       const bool useOnePercentBackgroundCorrection = true) const = 0;
+
+  /// One sphere, or spherical shell, to integrate with integrateSpheres
+  struct SphereIntegral {
+    /// nd-to-1 transformation to the squared distance from the center in all
+    /// dimensions, e.g. a CoordTransformDistance using all dimensions
+    CoordTransform *radiusTransform;
+    /// Array of size [nd]: the center of the sphere
+    const coord_t *center;
+    /// radius^2 below which to integrate
+    coord_t radiusSquared;
+    /// radius^2 of inner background, 0 for a sphere
+    coord_t innerRadiusSquared;
+    /// The integrated signal, to which the contribution of the box is added
+    signal_t signal;
+    /// The integrated squared error
+    signal_t errorSquared;
+  };
+  /** Integrate several spheres in one traversal of the boxes, with the same
+   * result as integrateSphere for each. Boxes touched by several of the
+   * spheres are visited once.
+   *
+   * @param spheres :: the spheres; the signals and errors are added to
+   * @param indices :: indices of the spheres to integrate in this box
+   * @param useOnePercentBackgroundCorrection :: if one percent correction
+   *should be applied to background.
+   */
+  virtual void
+  integrateSpheres(std::vector<SphereIntegral> &spheres,
+                   const std::vector<size_t> &indices,
+                   const bool useOnePercentBackgroundCorrection = true) const {
+    for (const auto index : indices) {
+      auto &sphere = spheres[index];
+      integrateSphere(*sphere.radiusTransform, sphere.radiusSquared,
+                      sphere.signal, sphere.errorSquared,
+                      sphere.innerRadiusSquared,
+                      useOnePercentBackgroundCorrection);
+    }
+  }
   /** Find the centroid of all events contained within by doing a weighted
    *average
    * of their coordinates.
@@ -173,6 +173,9 @@ public:
   /// Delets a row if it exists.
   virtual void removeRow(size_t index) = 0;
 
+  /// Deletes several rows at once.
+  virtual void removeRows(const std::vector<size_t> &indices);
+
   /// Appends a row.
   TableRowHelper appendRow();
 
@@ -322,6 +325,15 @@ protected:
    */
   void removeFromColumn(Column *c, size_t index) { c->remove(index); }
 
+  /**  Remove several elements from a column.
+         @param c :: Pointer to the column
+         @param indices :: Indices of the elements to be removed, in
+     ascending order and without duplicates.
+   */
+  void removeFromColumn(Column *c, const std::vector<size_t> &indices) {
+    c->removeRows(indices);
+  }
+
 private:
   ITableWorkspace *doClone() const override {
     return doCloneColumns(std::vector<std::string>());
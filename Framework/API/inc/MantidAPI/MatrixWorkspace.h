@@ -429,6 +429,9 @@ public:
   /// Returns true if the workspace contains common X bins
   virtual bool isCommonBins() const;
 
+  /// Makes the spectra with equal X values share a single copy of them
+  size_t shareEqualX();
+
   std::string YUnit() const;
   void setYUnit(const std::string &newUnit);
   std::string YUnitLabel(bool useLatex = false,
@@ -147,6 +147,8 @@ private:
   std::string isEmptyValueValid() const;
   std::string setValueAsSingleFile(const std::string &propValue);
   std::string setValueAsMultipleFiles(const std::string &propValue);
+  std::string resolveFileName(const std::string &unresolvedFileName,
+                              const std::string &defaultExt) const;
   /// Whether or not the user has turned on multifile loading.
   bool m_multiFileLoadingEnabled;
 
@@ -0,0 +1,62 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_PLUGINMANIFEST_H_
+#define MANTID_API_PLUGINMANIFEST_H_
+
+#include "MantidAPI/DllConfig.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+
+/** PluginManifest lists the entries that each plugin library registers with
+  the factories, e.g. Algorithm:Rebin|1, Function:Gaussian or Loader:LoadRaw,
+  so that the libraries can be opened only once one of them is requested.
+
+  The manifest is a text file with a line per library holding its filename,
+  its modification time and its entries, separated by spaces.
+*/
+class MANTID_API_DLL PluginManifest {
+public:
+  /// Read the manifest from a file, which need not exist
+  explicit PluginManifest(std::string filename);
+
+  /// Is the library listed with the given modification time
+  bool isCurrent(const std::string &library, int64_t modified) const;
+  /// The entries listed for a library
+  std::vector<std::string> entries(const std::string &library) const;
+  /// List a library, replacing what was listed for it
+  void update(const std::string &library, int64_t modified,
+              std::vector<std::string> entries);
+  /// Write the manifest back to its file if it has been updated
+  void save();
+
+private:
+  /// A library listed in the manifest
+  struct Library {
+    /// The modification time of the library when it was listed
+    int64_t modified = 0;
+    /// The entries registered by the library
+    std::vector<std::string> entries;
+  };
+
+  /// The path to the manifest
+  const std::string m_filename;
+  /// The libraries listed, keyed by filename
+  std::map<std::string, Library> m_libraries;
+  /// True if the libraries listed differ from those of the file
+  bool m_updated;
+};
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_PLUGINMANIFEST_H_ */
@@ -14,6 +14,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Mantid {
@@ -40,6 +42,11 @@ class ExperimentInfo;
   spectra (which may correspond to one or more detectors), such as mask and
   monitor flags, L1, L2, and 2-theta.
 
+  L2, 2-theta and the azimuthal angle of all spectra can also be obtained as
+  arrays, via l2s(), twoThetas() and azimuthals(). These are computed on first
+  use and kept until detectors, source or sample move or the grouping of
+  detectors into spectra changes.
+
   This class is thread safe for read operations (const access) with OpenMP BUT
   NOT WITH ANY OTHER THREADING LIBRARY such as Poco threads or Intel TBB. There
   are no thread-safety guarantees for write operations (non-const access). Reads
@@ -72,6 +79,10 @@ public:
   bool hasDetectors(const size_t index) const;
   bool hasUniqueDetector(const size_t index) const;
 
+  const std::vector<double> &l2s() const;
+  const std::vector<double> &twoThetas() const;
+  const std::vector<double> &azimuthals() const;
+
   void setMasked(const size_t index, bool masked);
 
   // This is likely to be deprecated/removed with the introduction of
@@ -93,9 +104,15 @@ public:
   friend class ExperimentInfo;
 
 private:
+  struct GeometryCache;
+  enum class CachedValue { L2 = 0, TwoTheta = 1, Azimuthal = 2 };
+
   const Geometry::IDetector &getDetector(const size_t index) const;
   const SpectrumDefinition &
   checkAndGetSpectrumDefinition(const size_t index) const;
+  const std::vector<double> &cachedValues(const CachedValue value) const;
+  double computeValue(const CachedValue value, const size_t index) const;
+  void invalidateCachedValues(const size_t index) const;
 
   const ExperimentInfo &m_experimentInfo;
   Geometry::DetectorInfo &m_detectorInfo;
@@ -103,6 +120,8 @@ private:
   mutable std::vector<boost::shared_ptr<const Geometry::IDetector>>
       m_lastDetector;
   mutable std::vector<size_t> m_lastIndex;
+  mutable std::unique_ptr<GeometryCache> m_geometryCache;
+  mutable std::mutex m_geometryCacheMutex;
 };
 
 using SpectrumInfoIt = SpectrumInfoIterator<SpectrumInfo>;
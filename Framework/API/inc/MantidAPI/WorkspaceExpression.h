@@ -0,0 +1,53 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_WORKSPACEEXPRESSION_H_
+#define MANTID_API_WORKSPACEEXPRESSION_H_
+
+#include "MantidAPI/DllConfig.h"
+
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+
+/** WorkspaceExpression : compiles an arithmetic expression of named
+  workspaces and numbers, such as (data - background) / norm * 2, into the
+  instructions of a stack machine. Algorithms evaluating the expression run
+  the instructions on blocks of values instead of creating a temporary
+  workspace per operation.
+ */
+struct MANTID_API_DLL WorkspaceExpression {
+  /// The operations of a compiled expression, evaluated on a stack
+  enum class Operation {
+    Workspace,
+    Constant,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Negate
+  };
+  /// One step of a compiled expression
+  struct Instruction {
+    Operation operation;
+    /// Index of the workspace in the input list
+    size_t index;
+    /// Value of a constant
+    double value;
+  };
+
+  static std::vector<Instruction>
+  compile(const std::string &expression,
+          const std::vector<std::string> &workspaceNames);
+  static size_t stackDepth(const std::vector<Instruction> &program);
+};
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_WORKSPACEEXPRESSION_H_ */
@@ -9,6 +9,7 @@
 
 #include "MantidAPI/DllConfig.h"
 #include "MantidGeometry/IDTypes.h"
+#include "MantidKernel/NearestNeighbours.h"
 #include "MantidKernel/V3D.h"
 // Boost graphing
 #ifndef Q_MOC_RUN
@@ -51,6 +52,7 @@ public:
   WorkspaceNearestNeighbours(int nNeighbours, const SpectrumInfo &spectrumInfo,
                              std::vector<specnum_t> spectrumNumbers,
                              bool ignoreMaskedDetectors = false);
+  ~WorkspaceNearestNeighbours();
 
   // Neighbouring spectra by radius
   std::map<specnum_t, Mantid::Kernel::V3D>
@@ -85,6 +87,10 @@ private:
   /// detector
   std::map<specnum_t, Mantid::Kernel::V3D>
   defaultNeighbours(const specnum_t spectrum) const;
+  /// Query the search tree for all the spectra within a radius of the
+  /// specified one
+  std::map<specnum_t, Mantid::Kernel::V3D>
+  treeNeighbours(const specnum_t spectrum, const double radius) const;
   /// The current number of nearest neighbours
   int m_noNeighbours;
   /// The largest value of the distance to a nearest neighbour
@@ -99,8 +105,10 @@ private:
   boost::property_map<Graph, boost::edge_name_t>::type m_edgeLength;
   /// V3D for scaling
   Kernel::V3D m_scale;
-  /// Cached radius value. used to avoid uncessary recalculations.
-  mutable double m_radius;
+  /// Scaled positions of the detectors, indexed by Graph node descriptor
+  std::vector<Eigen::Vector3d> m_points;
+  /// Search tree over the scaled positions
+  std::unique_ptr<Kernel::NearestNeighbours<3>> m_searchTree;
   /// Flag indicating that masked detectors should be ignored
   bool m_bIgnoreMaskedDetectors;
 };
@@ -8,10 +8,13 @@
 #include "MantidAPI/ADSValidator.h"
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/AlgorithmResultCache.h"
 #include "MantidAPI/AlgorithmProxy.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/DeprecatedAlgorithm.h"
+#include "MantidAPI/FileProperty.h"
 #include "MantidAPI/IWorkspaceProperty.h"
+#include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidAPI/WorkspaceHistory.h"
 
@@ -21,8 +24,10 @@
 #include "MantidKernel/EmptyValues.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
+#include "MantidKernel/RuntimeCounters.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/Timer.h"
+#include "MantidKernel/TraceRecorder.h"
 #include "MantidKernel/UsageService.h"
 
 #include "MantidParallel/Communicator.h"
@@ -32,12 +37,15 @@
 #include "MantidKernel/StringTokenizer.h"
 #include <Poco/ActiveMethod.h>
 #include <Poco/ActiveResult.h>
+#include <Poco/Exception.h>
+#include <Poco/File.h>
 #include <Poco/NotificationCenter.h>
 #include <Poco/RWLock.h>
 #include <Poco/Void.h>
 
 #include <json/json.h>
 
+#include <algorithm>
 #include <map>
 
 // Index property handling template definitions
@@ -65,6 +73,75 @@ public:
 private:
   const std::string &m_value;
 };
+
+/** Count a successful execution of an algorithm, and its run time, in the
+ * runtime counters
+ * @param name :: the name of the algorithm
+ * @param duration :: the run time in seconds
+ */
+void countExecution(const std::string &name, const float duration) {
+  auto &counters = Kernel::RuntimeCounters::Instance();
+  const std::string label = "{algorithm=\"" + name + "\"}";
+  counters.add("algorithm_executions" + label);
+  counters.add("algorithm_execution_microseconds" + label,
+               static_cast<uint64_t>(duration * 1e6));
+}
+
+/** Attach to the trace span of an algorithm the memory used by its output
+ * workspaces and the size of the files it read or wrote.
+ * @param span :: the span of the algorithm
+ * @param props :: the properties of the algorithm
+ */
+void addTraceArgs(Kernel::TraceSpan &span,
+                  const std::vector<Property *> &props) {
+  for (const auto *prop : props) {
+    if (const auto *wsProp = dynamic_cast<const IWorkspaceProperty *>(prop)) {
+      if (prop->direction() == Direction::Input)
+        continue;
+      if (const auto ws = wsProp->getWorkspace())
+        span.addArg(prop->name() + " bytes",
+                    std::to_string(ws->getMemorySize()));
+    } else if (const auto *fileProp = dynamic_cast<const FileProperty *>(prop)) {
+      const auto &path = prop->value();
+      if (fileProp->isDirectoryProperty() || path.empty())
+        continue;
+      try {
+        Poco::File file(path);
+        if (file.exists() && file.isFile())
+          span.addArg(prop->name() + (fileProp->isLoadProperty()
+                                          ? " bytes read"
+                                          : " bytes written"),
+                      std::to_string(file.getSize()));
+      } catch (Poco::Exception &) {
+        // The size is only informative
+      }
+    }
+  }
+}
+
+/** Make the spectra of new output matrix workspaces share equal X arrays.
+ * Workspaces which are also inputs were shared when first stored, and
+ * are skipped so that algorithms working in place do not pay for it again.
+ * @param props :: the properties of the algorithm
+ */
+void shareEqualXOfNewOutputs(const std::vector<Property *> &props) {
+  std::vector<Workspace_sptr> inputs;
+  for (const auto *prop : props) {
+    const auto *wsProp = dynamic_cast<const IWorkspaceProperty *>(prop);
+    if (wsProp && prop->direction() != Direction::Output)
+      inputs.emplace_back(wsProp->getWorkspace());
+  }
+  for (const auto *prop : props) {
+    const auto *wsProp = dynamic_cast<const IWorkspaceProperty *>(prop);
+    if (!wsProp || prop->direction() != Direction::Output)
+      continue;
+    const auto ws = wsProp->getWorkspace();
+    if (std::find(inputs.cbegin(), inputs.cend(), ws) != inputs.cend())
+      continue;
+    if (auto matrixWS = boost::dynamic_pointer_cast<MatrixWorkspace>(ws))
+      matrixWS->shareEqualX();
+  }
+}
 } // namespace
 
 // Doxygen can't handle member specialization at the moment:
@@ -100,10 +177,11 @@ Algorithm::Algorithm()
       m_notificationCenter(nullptr), m_progressObserver(nullptr),
       m_isInitialized(false), m_isExecuted(false), m_isChildAlgorithm(false),
       m_recordHistoryForChild(false), m_alwaysStoreInADS(true),
-      m_runningAsync(false), m_running(false), m_rethrow(false),
-      m_isAlgStartupLoggingEnabled(true), m_startChildProgress(0.),
-      m_endChildProgress(0.), m_algorithmID(this), m_singleGroup(-1),
-      m_groupsHaveSimilarNames(false), m_inputWorkspaceHistories(),
+      m_fastChildExecution(false), m_runningAsync(false), m_running(false),
+      m_rethrow(false), m_isAlgStartupLoggingEnabled(true),
+      m_startChildProgress(0.), m_endChildProgress(0.), m_algorithmID(this),
+      m_singleGroup(-1), m_groupsHaveSimilarNames(false),
+      m_inputWorkspaceHistories(),
       m_communicator(std::make_unique<Parallel::Communicator>()) {}
 
 /// Virtual destructor
@@ -158,6 +236,18 @@ void Algorithm::enableHistoryRecordingForChild(const bool on) {
   m_recordHistoryForChild = on;
 }
 
+/**
+ * Change the state of the fast execution flag. Only applicable for child
+ * algorithms. A child algorithm executed in this mode, e.g. one called for
+ * every spectrum of a workspace and reused between the calls, skips the
+ * notifications, logging, usage reporting and history recording of a normal
+ * execution. Its properties are still validated.
+ * @param on :: The new state of the flag
+ */
+void Algorithm::enableFastChildExecution(const bool on) {
+  m_fastChildExecution = on;
+}
+
 /** Do we ALWAYS store in the AnalysisDataService? This is set to true
  * for python algorithms' child algorithms
  *
@@ -374,7 +464,7 @@ void Algorithm::cacheInputWorkspaceHistories() {
   // Look over all properties so we can catch an string array properties
   // with an ADSValidator. ADSValidator indicates that the strings
   // point to workspace names so we want to pick up the history from these too.
-  const auto &ads = AnalysisDataService::Instance();
+  auto &ads = AnalysisDataService::Instance();
   m_inputWorkspaceHistories.clear();
   const auto &props = this->getProperties();
   for (const auto &prop : props) {
@@ -489,7 +579,12 @@ void Algorithm::unlockWorkspaces() {
  */
 
 bool Algorithm::executeInternal() {
+  if (m_isChildAlgorithm && m_fastChildExecution)
+    return executeFastChild();
+
   Timer timer;
+  Kernel::TraceSpan traceSpan(name(),
+                              isChild() ? "child_algorithm" : "algorithm");
   AlgorithmManager::Instance().notifyAlgorithmStarting(this->getAlgorithmID());
   {
     auto *depo = dynamic_cast<DeprecatedAlgorithm *>(this);
@@ -624,15 +719,27 @@ bool Algorithm::executeInternal() {
       }
 
       startTime = Mantid::Types::Core::DateAndTime::getCurrentTime();
-      // Call the concrete algorithm's exec method
-      this->exec(executionMode);
+      // Call the concrete algorithm's exec method, unless its result for
+      // the same inputs is cached
+      auto &resultCache = AlgorithmResultCache::Instance();
+      const auto cacheKey = resultCache.isEnabledFor(name())
+                                ? resultCache.key(*this)
+                                : std::string();
+      if (cacheKey.empty() || !resultCache.restore(cacheKey, *this)) {
+        this->exec(executionMode);
+        if (!cacheKey.empty())
+          resultCache.store(cacheKey, *this);
+      }
       registerFeatureUsage();
       // Check for a cancellation request in case the concrete algorithm doesn't
       interruption_point();
+      if (traceSpan.active())
+        addTraceArgs(traceSpan, getProperties());
       const float timingExec = timer.elapsed(resetTimer);
       // The total runtime including all init steps is used for general logging.
       const float duration = timingInit + timingPropertyValidation +
                              timingInputValidation + timingExec;
+      countExecution(name(), duration);
       // need it to throw before trying to run fillhistory() on an algorithm
       // which has failed
       if (trackingHistory() && m_history) {
@@ -730,6 +837,48 @@ bool Algorithm::executeInternal() {
   return isExecuted();
 }
 
+/** Invoked by executeInternal() for child algorithms with fast execution
+ * enabled. Only the steps needed to run exec() correctly are taken: errors are
+ * thrown without being logged or notified, and no history is recorded.
+ * @returns true if executed successfully.
+ */
+bool Algorithm::executeFastChild() {
+  Kernel::TraceSpan traceSpan(name(), "child_algorithm");
+  if (!isInitialized()) {
+    throw std::runtime_error("Algorithm is not initialised:" + this->name());
+  }
+  if (!validateProperties()) {
+    throw std::runtime_error("Some invalid Properties found");
+  }
+  cacheWorkspaceProperties();
+
+  Mantid::Types::Core::DateAndTime startTime;
+  if (this->checkGroups()) {
+    return doCallProcessGroups(startTime);
+  }
+
+  const auto executionMode = getExecutionMode();
+  if (executionMode != Parallel::ExecutionMode::MasterOnly ||
+      communicator().rank() == 0) {
+    const auto errors = this->validateInputs();
+    for (const auto &error : errors) {
+      if (this->existsProperty(error.first))
+        throw std::runtime_error("Invalid value for " + error.first + ": " +
+                                 error.second);
+    }
+  }
+
+  setExecuted(false);
+  this->exec(executionMode);
+  interruption_point();
+  if (traceSpan.active())
+    addTraceArgs(traceSpan, getProperties());
+  if (m_alwaysStoreInADS)
+    this->store();
+  setExecuted(true);
+  return true;
+}
+
 //---------------------------------------------------------------------------------------------
 /** Execute as a Child Algorithm.
  * This runs execute() but catches errors so as to log the name
@@ -758,6 +907,8 @@ void Algorithm::store() {
   const std::vector<Property *> &props = getProperties();
   std::vector<int> groupWsIndicies;
 
+  shareEqualXOfNewOutputs(props);
+
   // add any regular/child workspaces first, then add the groups
   for (unsigned int i = 0; i < props.size(); ++i) {
     auto *wsProp = dynamic_cast<IWorkspaceProperty *>(props[i]);
@@ -1067,7 +1218,7 @@ void Algorithm::trackAlgorithmHistory(
  *  @return if we are tracking the history of this algorithm
  */
 bool Algorithm::trackingHistory() {
-  return (!isChild() || m_recordHistoryForChild);
+  return (!isChild() || (m_recordHistoryForChild && !m_fastChildExecution));
 }
 
 /** Populate lists of the workspace properties for a given direction
@@ -1081,7 +1232,7 @@ bool Algorithm::trackingHistory() {
 void Algorithm::findWorkspaces(WorkspaceVector &workspaces,
                                unsigned int direction, bool checkADS) const {
   auto workspaceFromWSProperty =
-      [](const IWorkspaceProperty &prop, const AnalysisDataServiceImpl &ads,
+      [](const IWorkspaceProperty &prop, AnalysisDataServiceImpl &ads,
          const std::string &strValue, bool checkADS) {
         auto workspace = prop.getWorkspace();
         if (workspace)
@@ -1103,7 +1254,7 @@ void Algorithm::findWorkspaces(WorkspaceVector &workspaces,
   // Additional output properties can be declared on the fly
   // so we need a fresh loop over the properties
   const auto &algProperties = getProperties();
-  const auto &ads = AnalysisDataService::Instance();
+  auto &ads = AnalysisDataService::Instance();
   for (const auto &prop : algProperties) {
     const unsigned int propDirection = prop->direction();
     if (propDirection != direction && propDirection != Direction::InOut)
@@ -1166,7 +1317,7 @@ bool Algorithm::checkGroups() {
   bool processGroups = false;
 
   // Unroll the groups or single inputs into vectors of workspaces
-  const auto &ads = AnalysisDataService::Instance();
+  auto &ads = AnalysisDataService::Instance();
   m_unrolledInputWorkspaces.clear();
   m_groupWorkspaces.clear();
   for (auto inputWorkspaceProp : m_inputWorkspaceProps) {
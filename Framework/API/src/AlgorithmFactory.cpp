@@ -21,6 +21,8 @@ namespace API {
 namespace {
 /// static logger instance
 Kernel::Logger g_log("AlgorithmFactory");
+/// The prefix of the algorithm entries of deferred plugin libraries
+const char *LIBRARY_ENTRY_PREFIX = "Algorithm:";
 } // namespace
 
 AlgorithmFactoryImpl::AlgorithmFactoryImpl()
@@ -42,6 +44,8 @@ AlgorithmFactoryImpl::~AlgorithmFactoryImpl() = default;
 boost::shared_ptr<Algorithm>
 AlgorithmFactoryImpl::create(const std::string &name,
                              const int &version) const {
+  const auto lock = Kernel::LibraryManager::Instance().lockFactories();
+  openLibraryProviding(name, version);
   int local_version = version;
   if (version < 0) {
     if (version == -1) // get latest version since not supplied
@@ -82,6 +86,7 @@ AlgorithmFactoryImpl::create(const std::string &name,
  */
 void AlgorithmFactoryImpl::unsubscribe(const std::string &algorithmName,
                                        const int version) {
+  const auto lock = Kernel::LibraryManager::Instance().lockFactories();
   std::string key = this->createName(algorithmName, version);
   try {
     Kernel::DynamicFactory<Algorithm>::unsubscribe(key);
@@ -111,6 +116,8 @@ void AlgorithmFactoryImpl::unsubscribe(const std::string &algorithmName,
  */
 bool AlgorithmFactoryImpl::exists(const std::string &algorithmName,
                                   const int version) {
+  const auto lock = Kernel::LibraryManager::Instance().lockFactories();
+  openLibraryProviding(algorithmName, version);
   if (version == -1) // Find anything
   {
     return (m_vmap.find(algorithmName) != m_vmap.end());
@@ -177,9 +184,16 @@ const std::vector<std::string> AlgorithmFactoryImpl::getKeys() const {
  */
 const std::vector<std::string>
 AlgorithmFactoryImpl::getKeys(bool includeHidden) const {
-  // Start with those subscribed with the factory and add the cleanly
-  // constructed algorithm keys
-  std::vector<std::string> names = Kernel::DynamicFactory<Algorithm>::getKeys();
+  std::vector<std::string> names;
+  {
+    // List the algorithms of the deferred plugin libraries too
+    auto &libraryManager = Kernel::LibraryManager::Instance();
+    const auto lock = libraryManager.lockFactories();
+    libraryManager.openLibrariesProviding(LIBRARY_ENTRY_PREFIX);
+    // Start with those subscribed with the factory and add the cleanly
+    // constructed algorithm keys
+    names = Kernel::DynamicFactory<Algorithm>::getKeys();
+  }
 
   if (includeHidden) {
     return names;
@@ -230,6 +244,8 @@ AlgorithmFactoryImpl::getKeys(bool includeHidden) const {
  */
 int AlgorithmFactoryImpl::highestVersion(
     const std::string &algorithmName) const {
+  const auto lock = Kernel::LibraryManager::Instance().lockFactories();
+  openLibraryProviding(algorithmName, -1);
   auto viter = m_vmap.find(algorithmName);
   if (viter != m_vmap.end())
     return viter->second;
@@ -419,6 +435,26 @@ int AlgorithmFactoryImpl::extractAlgVersion(
   return alg->version();
 }
 
+/**
+ * Opens the deferred plugin libraries providing an algorithm. Called with the
+ * factories locked.
+ * @param name :: Algorithm name
+ * @param version :: Algorithm version. If negative every library providing a
+ * version of the algorithm is opened, as one may provide a newer version than
+ * those registered.
+ */
+void AlgorithmFactoryImpl::openLibraryProviding(const std::string &name,
+                                                const int version) const {
+  auto &libraryManager = Kernel::LibraryManager::Instance();
+  if (version < 0)
+    libraryManager.openLibrariesProviding(LIBRARY_ENTRY_PREFIX + name + "|");
+  else {
+    const auto key = createName(name, version);
+    if (!Kernel::DynamicFactory<Algorithm>::exists(key))
+      libraryManager.openLibraryProviding(LIBRARY_ENTRY_PREFIX + key);
+  }
+}
+
 /**
  * Create a shared pointer to an algorithm object with the given name and
  * version. If the algorithm is one registered with a clean pointer rather than
@@ -12,6 +12,7 @@
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <mutex>
 #include <sstream>
 
 namespace Mantid {
@@ -160,6 +161,9 @@ void AlgorithmHistory::addChildHistory(AlgorithmHistory_sptr childHist) {
     return;
   }
 
+  // Child algorithms of the same parent may finish on different threads
+  static std::mutex mutex;
+  std::lock_guard<std::mutex> lock(mutex);
   m_childHistories.emplace_back(childHist);
 }
 
@@ -0,0 +1,672 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/AlgorithmResultCache.h"
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/Column.h"
+#include "MantidAPI/FileProperty.h"
+#include "MantidAPI/IEventWorkspace.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/Sample.h"
+#include "MantidAPI/WorkspaceGroup.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/MeshObject.h"
+#include "MantidGeometry/Objects/MeshObject2D.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/Material.h"
+#include "MantidKernel/StringTokenizer.h"
+#include "MantidKernel/Strings.h"
+#include "MantidKernel/Unit.h"
+
+#include <Poco/DirectoryIterator.h>
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace Mantid {
+namespace API {
+namespace {
+/// static logger
+Kernel::Logger g_log("AlgorithmResultCache");
+
+/// Algorithms used by the cache itself, which are never cached
+const char *SAVE_ALGORITHM = "SaveNexusProcessed";
+const char *LOAD_ALGORITHM = "LoadNexusProcessed";
+
+/// 64-bit FNV-1a hash of a stream of values
+class Hasher {
+public:
+  void add(const void *data, size_t size) {
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; ++i) {
+      m_hash ^= bytes[i];
+      m_hash *= 1099511628211ULL;
+    }
+  }
+  void add(const std::string &value) {
+    add(value.size());
+    add(value.data(), value.size());
+  }
+  template <typename T> void add(const T &value) { add(&value, sizeof(T)); }
+  template <typename T> void add(const std::vector<T> &values) {
+    add(values.size());
+    add(values.data(), values.size() * sizeof(T));
+  }
+  std::string hex() const {
+    std::ostringstream out;
+    out << std::hex << std::setw(16) << std::setfill('0') << m_hash;
+    return out.str();
+  }
+
+private:
+  uint64_t m_hash{14695981039346656037ULL};
+};
+
+void hashV3D(const Kernel::V3D &vector, Hasher &hasher) {
+  hasher.add(vector.X());
+  hasher.add(vector.Y());
+  hasher.add(vector.Z());
+}
+
+void hashQuat(const Kernel::Quat &quat, Hasher &hasher) {
+  hasher.add(quat.real());
+  hasher.add(quat.imagI());
+  hasher.add(quat.imagJ());
+  hasher.add(quat.imagK());
+}
+
+/// Hash the instrument, with the positions and rotations of all its
+/// components, the source and sample included, and its parameters
+void hashInstrument(const MatrixWorkspace &ws, Hasher &hasher) {
+  const auto instrument = ws.getInstrument();
+  hasher.add(instrument ? instrument->getName() : std::string());
+  const auto &componentInfo = ws.componentInfo();
+  const size_t scanCount = componentInfo.scanCount();
+  hasher.add(componentInfo.size());
+  hasher.add(scanCount);
+  for (size_t i = 0; i < componentInfo.size(); ++i) {
+    for (size_t scan = 0; scan < scanCount; ++scan) {
+      hashV3D(componentInfo.position({i, scan}), hasher);
+      hashQuat(componentInfo.rotation({i, scan}), hasher);
+    }
+    hashV3D(componentInfo.scaleFactor(i), hasher);
+  }
+  const auto &detectorInfo = ws.detectorInfo();
+  hasher.add(detectorInfo.detectorIDs());
+  for (size_t i = 0; i < detectorInfo.size(); ++i)
+    hasher.add(detectorInfo.isMasked(i));
+  hasher.add(ws.instrumentParameters().asString());
+}
+
+void hashMaterial(const Kernel::Material &material, Hasher &hasher) {
+  hasher.add(material.name());
+  hasher.add(material.numberDensity());
+  hasher.add(material.temperature());
+  hasher.add(material.pressure());
+  hasher.add(material.cohScatterXSection());
+  hasher.add(material.incohScatterXSection());
+  hasher.add(material.absorbXSection());
+}
+
+void hashShape(const Geometry::IObject &shape, Hasher &hasher) {
+  hasher.add(shape.id());
+  hasher.add(shape.hasValidShape());
+  if (const auto *csg = dynamic_cast<const Geometry::CSGObject *>(&shape)) {
+    hasher.add(csg->getShapeXML());
+  } else if (const auto *mesh =
+                 dynamic_cast<const Geometry::MeshObject *>(&shape)) {
+    hasher.add(mesh->getVertices());
+    hasher.add(mesh->getTriangles());
+  } else if (const auto *mesh2D =
+                 dynamic_cast<const Geometry::MeshObject2D *>(&shape)) {
+    hasher.add(mesh2D->getVertices());
+    hasher.add(mesh2D->getTriangles());
+  }
+  hashMaterial(shape.material(), hasher);
+}
+
+void hashMatrixWorkspace(const MatrixWorkspace &ws, Hasher &hasher) {
+  hasher.add(ws.id());
+  hasher.add(ws.getTitle());
+  hasher.add(ws.YUnit());
+  for (size_t i = 0; i < ws.axes(); ++i) {
+    const auto unit = ws.getAxis(i)->unit();
+    hasher.add(unit ? unit->unitID() : std::string());
+  }
+  hasher.add(ws.isDistribution());
+
+  const auto *eventWS = dynamic_cast<const IEventWorkspace *>(&ws);
+  const size_t numberHistograms = ws.getNumberHistograms();
+  hasher.add(numberHistograms);
+  for (size_t i = 0; i < numberHistograms; ++i) {
+    const auto &spectrum = ws.getSpectrum(i);
+    hasher.add(spectrum.getSpectrumNo());
+    const auto &detectorIDs = spectrum.getDetectorIDs();
+    hasher.add(detectorIDs.size());
+    for (const auto id : detectorIDs)
+      hasher.add(id);
+    hasher.add(ws.x(i).rawData());
+    if (eventWS) {
+      const auto &eventList = eventWS->getSpectrum(i);
+      hasher.add(eventList.getTofs());
+      hasher.add(eventList.getWeights());
+      hasher.add(eventList.getWeightErrors());
+      for (const auto &pulseTime : eventList.getPulseTimes())
+        hasher.add(pulseTime.totalNanoseconds());
+    } else {
+      hasher.add(ws.y(i).rawData());
+      hasher.add(ws.e(i).rawData());
+    }
+    if (ws.hasDx(i))
+      hasher.add(ws.dx(i).rawData());
+    if (ws.hasMaskedBins(i)) {
+      for (const auto &bin : ws.maskedBins(i)) {
+        hasher.add(bin.first);
+        hasher.add(bin.second);
+      }
+    }
+  }
+
+  for (const auto *log : ws.run().getLogData()) {
+    hasher.add(log->name());
+    hasher.add(log->value());
+  }
+  const auto &goniometer = ws.run().getGoniometerMatrix();
+  for (size_t row = 0; row < goniometer.numRows(); ++row)
+    for (size_t col = 0; col < goniometer.numCols(); ++col)
+      hasher.add(goniometer[row][col]);
+  hashInstrument(ws, hasher);
+  hasher.add(ws.sample().getName());
+  hashShape(ws.sample().getShape(), hasher);
+  hashMaterial(ws.sample().getMaterial(), hasher);
+}
+
+void hashTableWorkspace(const ITableWorkspace &ws, Hasher &hasher) {
+  hasher.add(ws.id());
+  hasher.add(ws.rowCount());
+  for (size_t col = 0; col < ws.columnCount(); ++col) {
+    const auto column = ws.getColumn(col);
+    hasher.add(column->name());
+    hasher.add(column->type());
+    std::ostringstream cells;
+    for (size_t row = 0; row < ws.rowCount(); ++row) {
+      column->print(row, cells);
+      cells << '\n';
+    }
+    hasher.add(cells.str());
+  }
+}
+
+bool hashWorkspace(const Workspace &ws, Hasher &hasher) {
+  if (const auto *matrixWS = dynamic_cast<const MatrixWorkspace *>(&ws)) {
+    hashMatrixWorkspace(*matrixWS, hasher);
+    return true;
+  }
+  if (const auto *tableWS = dynamic_cast<const ITableWorkspace *>(&ws)) {
+    hashTableWorkspace(*tableWS, hasher);
+    return true;
+  }
+  if (const auto *group = dynamic_cast<const WorkspaceGroup *>(&ws)) {
+    hasher.add(ws.id());
+    const auto size = static_cast<size_t>(group->getNumberOfEntries());
+    hasher.add(size);
+    for (size_t i = 0; i < size; ++i) {
+      const auto member = group->getItem(i);
+      if (!member || !hashWorkspace(*member, hasher))
+        return false;
+    }
+    return true;
+  }
+  return false;
+}
+
+/// Convert a size in MB from the configuration to bytes
+size_t megabytesFromConfig(const std::string &key, const size_t defaultMB) {
+  const auto value = Kernel::ConfigService::Instance().getValue<double>(key);
+  const double megabytes =
+      value && *value >= 0. ? *value : static_cast<double>(defaultMB);
+  return static_cast<size_t>(megabytes * 1024. * 1024.);
+}
+
+std::string hashOfKey(const std::string &key) {
+  Hasher hasher;
+  hasher.add(key);
+  return hasher.hex();
+}
+} // namespace
+
+AlgorithmResultCacheImpl::AlgorithmResultCacheImpl()
+    : m_memoryLimit(megabytesFromConfig("algorithms.cache.memorylimit", 1024)),
+      m_diskLimit(megabytesFromConfig("algorithms.cache.disklimit", 10240)) {
+  auto &config = Kernel::ConfigService::Instance();
+  Kernel::StringTokenizer names(
+      config.getString("algorithms.cache.names"), ";",
+      Kernel::StringTokenizer::TOK_TRIM |
+          Kernel::StringTokenizer::TOK_IGNORE_EMPTY);
+  setAlgorithms(names.asVector());
+  m_directory = config.getString("algorithms.cache.directory");
+}
+
+/** Set the names of the algorithms whose results are cached.
+ * @param names :: the algorithm names, an empty list disables the cache
+ */
+void AlgorithmResultCacheImpl::setAlgorithms(
+    const std::vector<std::string> &names) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_algorithms.clear();
+  for (const auto &name : names) {
+    const auto trimmed = Kernel::Strings::strip(name);
+    if (!trimmed.empty() && trimmed != SAVE_ALGORITHM &&
+        trimmed != LOAD_ALGORITHM)
+      m_algorithms.insert(trimmed);
+  }
+  m_enabled = !m_algorithms.empty();
+}
+
+/** Set the memory held by the cached results, dropping the least recently
+ * used results beyond it.
+ * @param bytes :: the limit in bytes
+ */
+void AlgorithmResultCacheImpl::setMemoryLimit(size_t bytes) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_memoryLimit = bytes;
+  while (m_memorySize > m_memoryLimit && !m_entries.empty()) {
+    m_memorySize -= m_entries.back().second.memorySize;
+    m_index.erase(m_entries.back().first);
+    m_entries.pop_back();
+  }
+}
+
+/** Set the directory the results are saved to.
+ * @param directory :: the directory, empty to keep the results in memory only
+ * @param diskLimit :: the space the saved results may take, in bytes
+ */
+void AlgorithmResultCacheImpl::setDirectory(const std::string &directory,
+                                            size_t diskLimit) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_directory = directory;
+  m_diskLimit = diskLimit;
+}
+
+/** Declare that an algorithm only uses the instrument of one of its input
+ * workspaces, so that the cache key holds a hash of the instrument rather
+ * than of the whole workspace.
+ * @param algorithmName :: the name of the algorithm
+ * @param propertyName :: the name of the input workspace property
+ */
+void AlgorithmResultCacheImpl::setUsesOnlyInstrument(
+    const std::string &algorithmName, const std::string &propertyName) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_instrumentOnlyInputs.emplace(algorithmName, propertyName);
+}
+
+bool AlgorithmResultCacheImpl::usesOnlyInstrument(
+    const std::string &algorithmName, const std::string &propertyName) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_instrumentOnlyInputs.count({algorithmName, propertyName}) > 0;
+}
+
+bool AlgorithmResultCacheImpl::isEnabledFor(
+    const std::string &algorithmName) const {
+  if (!m_enabled)
+    return false;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_algorithms.count(algorithmName) > 0;
+}
+
+/** Build the key of the result of an algorithm from its current inputs.
+ * @param alg :: an algorithm whose properties are set
+ * @return the key, or an empty string if the result cannot be cached
+ */
+std::string AlgorithmResultCacheImpl::key(const Algorithm &alg) const {
+  std::ostringstream key;
+  key << alg.name() << '|' << alg.version();
+  for (const auto *prop : alg.getProperties()) {
+    const auto direction = prop->direction();
+    const auto *wsProp = dynamic_cast<const IWorkspaceProperty *>(prop);
+    if (wsProp) {
+      if (direction == Kernel::Direction::InOut)
+        return std::string();
+      const auto ws = wsProp->getWorkspace();
+      if (direction == Kernel::Direction::Output) {
+        // Writing over an existing workspace may be done in place
+        if (ws)
+          return std::string();
+        continue;
+      }
+      std::string hash;
+      if (ws) {
+        const auto *matrixWS = dynamic_cast<const MatrixWorkspace *>(ws.get());
+        if (matrixWS && usesOnlyInstrument(alg.name(), prop->name())) {
+          Hasher hasher;
+          hashInstrument(*matrixWS, hasher);
+          hash = hasher.hex();
+        } else if (!contentHash(*ws, hash)) {
+          return std::string();
+        }
+      }
+      key << '|' << prop->name() << '=' << hash;
+      continue;
+    }
+    if (direction == Kernel::Direction::Output)
+      continue;
+    key << '|' << prop->name() << '=' << prop->value();
+    const auto *fileProp = dynamic_cast<const FileProperty *>(prop);
+    if (fileProp && fileProp->isLoadProperty() && !prop->value().empty()) {
+      try {
+        Poco::File file(prop->value());
+        key << ':' << file.getSize() << ':'
+            << file.getLastModified().epochMicroseconds();
+      } catch (Poco::Exception &) {
+        return std::string();
+      }
+    }
+  }
+  return key.str();
+}
+
+/** Set the outputs of an algorithm from a cached result.
+ * @param key :: the key of the result, from key()
+ * @param alg :: the algorithm
+ * @return true if a result was found and restored
+ */
+bool AlgorithmResultCacheImpl::restore(const std::string &key,
+                                       Algorithm &alg) {
+  Result result;
+  bool found = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      result = it->second->second;
+      found = true;
+    }
+  }
+  if (!found) {
+    if (!loadFromDisk(key, result))
+      return false;
+    insert(key, result);
+  }
+  if (!restore(result, alg))
+    return false;
+  g_log.debug() << "Restored the result of " << alg.name()
+                << " from the cache\n";
+  return true;
+}
+
+/** Store the outputs of an algorithm that has just run.
+ * @param key :: the key of the result, from key()
+ * @param alg :: the algorithm
+ */
+void AlgorithmResultCacheImpl::store(const std::string &key,
+                                     const Algorithm &alg) {
+  Result result;
+  try {
+    for (const auto *prop : alg.getProperties()) {
+      if (prop->direction() != Kernel::Direction::Output)
+        continue;
+      if (const auto *wsProp = dynamic_cast<const IWorkspaceProperty *>(prop)) {
+        const auto ws = wsProp->getWorkspace();
+        if (!ws)
+          continue;
+        Workspace_sptr copy = ws->clone();
+        result.memorySize += copy->getMemorySize();
+        result.workspaces.emplace_back(prop->name(), std::move(copy));
+      } else {
+        result.values.emplace_back(prop->name(), prop->value());
+      }
+    }
+  } catch (std::exception &e) {
+    g_log.debug() << "The result of " << alg.name()
+                  << " cannot be cached: " << e.what() << '\n';
+    return;
+  }
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    directory = m_directory;
+  }
+  if (!directory.empty())
+    saveToDisk(key, result);
+  insert(key, std::move(result));
+}
+
+/// @return the number of results held in memory
+size_t AlgorithmResultCacheImpl::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// @return the memory used by the results held in memory
+size_t AlgorithmResultCacheImpl::memorySize() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_memorySize;
+}
+
+/// Drop the results held in memory. Results saved to disk are kept.
+void AlgorithmResultCacheImpl::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+  m_index.clear();
+  m_memorySize = 0;
+}
+
+/** Hash the content of a workspace.
+ * @param ws :: a matrix or table workspace, or a group of them
+ * @param hash :: set to the hash
+ * @return false if workspaces of this type cannot be hashed
+ */
+bool AlgorithmResultCacheImpl::contentHash(const Workspace &ws,
+                                           std::string &hash) {
+  Hasher hasher;
+  if (!hashWorkspace(ws, hasher))
+    return false;
+  hash = hasher.hex();
+  return true;
+}
+
+void AlgorithmResultCacheImpl::insert(const std::string &key, Result result) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (result.memorySize > m_memoryLimit)
+    return;
+  auto it = m_index.find(key);
+  if (it != m_index.end()) {
+    m_memorySize -= it->second->second.memorySize;
+    m_entries.erase(it->second);
+    m_index.erase(it);
+  }
+  m_memorySize += result.memorySize;
+  m_entries.emplace_front(key, std::move(result));
+  m_index[key] = m_entries.begin();
+  while (m_memorySize > m_memoryLimit) {
+    m_memorySize -= m_entries.back().second.memorySize;
+    m_index.erase(m_entries.back().first);
+    m_entries.pop_back();
+  }
+}
+
+bool AlgorithmResultCacheImpl::restore(const Result &result,
+                                       Algorithm &alg) const {
+  try {
+    for (const auto &workspace : result.workspaces) {
+      Workspace_sptr copy = workspace.second->clone();
+      alg.setProperty(workspace.first, copy);
+    }
+    for (const auto &value : result.values)
+      alg.setPropertyValue(value.first, value.second);
+  } catch (std::exception &e) {
+    g_log.debug() << "Cannot restore the result of " << alg.name() << ": "
+                  << e.what() << '\n';
+    return false;
+  }
+  return true;
+}
+
+/** Load a result saved by saveToDisk. The index file holds the full key,
+ * then a line "workspace <property>" for each workspace, saved alongside it,
+ * and a line "value <property> <value>" for each other output.
+ */
+bool AlgorithmResultCacheImpl::loadFromDisk(const std::string &key,
+                                            Result &result) const {
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    directory = m_directory;
+  }
+  if (directory.empty())
+    return false;
+  const auto stem = "algcache_" + hashOfKey(key);
+  Poco::Path indexPath(directory, stem + ".txt");
+  std::ifstream index(indexPath.toString());
+  if (!index)
+    return false;
+  std::string line;
+  if (!std::getline(index, line) || line != key)
+    return false;
+  try {
+    while (std::getline(index, line)) {
+      std::istringstream fields(line);
+      std::string kind, name;
+      fields >> kind >> name;
+      if (kind == "workspace") {
+        auto load =
+            AlgorithmManager::Instance().createUnmanaged(LOAD_ALGORITHM);
+        load->initialize();
+        load->setChild(true);
+        load->setLogging(false);
+        load->setPropertyValue(
+            "Filename",
+            Poco::Path(directory, stem + "_" + name + ".nxs").toString());
+        load->setPropertyValue("OutputWorkspace", "__algcache");
+        load->execute();
+        Workspace_sptr ws = load->getProperty("OutputWorkspace");
+        result.memorySize += ws->getMemorySize();
+        result.workspaces.emplace_back(name, ws);
+      } else if (kind == "value") {
+        std::string value;
+        std::getline(fields >> std::ws, value);
+        result.values.emplace_back(name, value);
+      }
+    }
+    Poco::File(indexPath).setLastModified(Poco::Timestamp());
+  } catch (std::exception &e) {
+    g_log.debug() << "Cannot load a cached result from " << directory << ": "
+                  << e.what() << '\n';
+    return false;
+  }
+  return true;
+}
+
+void AlgorithmResultCacheImpl::saveToDisk(const std::string &key,
+                                          const Result &result) const {
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    directory = m_directory;
+  }
+  const auto stem = "algcache_" + hashOfKey(key);
+  try {
+    Poco::File(directory).createDirectories();
+    for (const auto &workspace : result.workspaces) {
+      auto save = AlgorithmManager::Instance().createUnmanaged(SAVE_ALGORITHM);
+      save->initialize();
+      save->setChild(true);
+      save->setLogging(false);
+      save->setProperty("InputWorkspace", workspace.second);
+      save->setPropertyValue(
+          "Filename",
+          Poco::Path(directory, stem + "_" + workspace.first + ".nxs")
+              .toString());
+      save->execute();
+    }
+    std::ofstream index(Poco::Path(directory, stem + ".txt").toString());
+    index << key << '\n';
+    for (const auto &workspace : result.workspaces)
+      index << "workspace " << workspace.first << '\n';
+    for (const auto &value : result.values)
+      index << "value " << value.first << ' ' << value.second << '\n';
+  } catch (std::exception &e) {
+    g_log.debug() << "Cannot save a result to " << directory << ": "
+                  << e.what() << '\n';
+    return;
+  }
+  trimDisk();
+}
+
+/// Remove the least recently used results beyond the disk limit
+void AlgorithmResultCacheImpl::trimDisk() const {
+  std::string directory;
+  size_t diskLimit;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    directory = m_directory;
+    diskLimit = m_diskLimit;
+  }
+  struct Saved {
+    std::string stem;
+    Poco::Timestamp used;
+    size_t size;
+    std::vector<std::string> files;
+  };
+  try {
+    std::vector<Saved> saved;
+    size_t total = 0;
+    Poco::DirectoryIterator end;
+    for (Poco::DirectoryIterator it(directory); it != end; ++it) {
+      const auto name = it.name();
+      if (name.compare(0, 9, "algcache_") != 0)
+        continue;
+      const auto size = static_cast<size_t>(it->getSize());
+      total += size;
+      const auto stem = name.substr(0, name.find_first_of("_.", 9));
+      auto entry = std::find_if(
+          saved.begin(), saved.end(),
+          [&stem](const Saved &other) { return other.stem == stem; });
+      if (entry == saved.end()) {
+        saved.push_back({stem, Poco::Timestamp(0), 0, {}});
+        entry = saved.end() - 1;
+      }
+      entry->size += size;
+      entry->files.emplace_back(it->path());
+      if (name == stem + ".txt")
+        entry->used = it->getLastModified();
+    }
+    if (total <= diskLimit)
+      return;
+    std::sort(saved.begin(), saved.end(),
+              [](const Saved &a, const Saved &b) { return a.used < b.used; });
+    for (const auto &entry : saved) {
+      if (total <= diskLimit)
+        break;
+      for (const auto &file : entry.files)
+        Poco::File(file).remove();
+      total -= entry.size;
+    }
+  } catch (Poco::Exception &e) {
+    g_log.debug() << "Cannot trim the result cache in " << directory << ": "
+                  << e.displayText() << '\n';
+  }
+}
+
+} // namespace API
+} // namespace Mantid
@@ -5,12 +5,183 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+
+#include <Poco/Exception.h>
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <Poco/Process.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
 #include <iterator>
 #include <sstream>
+#include <unordered_set>
 
 namespace Mantid {
 namespace API {
+namespace {
+/// static logger for the memory limit
+Kernel::Logger g_spillLog("AnalysisDataService");
+
+/// Identifies the files of spilled workspaces
+const char SPILL_MAGIC[] = "MANTIDSPILL1";
+/// Flags of a spectrum in a spill file
+enum SpectrumFlags : uint8_t { SharesX = 1, HasDx = 2 };
+
+template <typename T> void writeValue(std::ostream &out, const T &value) {
+  out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T> T readValue(std::istream &in) {
+  T value{};
+  in.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return value;
+}
+
+void writeArray(std::ostream &out, const std::vector<double> &values) {
+  writeValue<uint64_t>(out, values.size());
+  out.write(reinterpret_cast<const char *>(values.data()),
+            values.size() * sizeof(double));
+}
+
+std::vector<double> readArray(std::istream &in) {
+  std::vector<double> values(readValue<uint64_t>(in));
+  in.read(reinterpret_cast<char *>(values.data()),
+          values.size() * sizeof(double));
+  return values;
+}
+
+/** Stands in the service for a Workspace2D whose data has been written to a
+ * file. The metadata is kept in a copy of the workspace with one bin per
+ * spectrum. The file is removed with the SpilledWorkspace.
+ */
+class SpilledWorkspace : public Workspace {
+public:
+  SpilledWorkspace(const MatrixWorkspace_const_sptr &ws,
+                   const std::string &directory);
+  ~SpilledWorkspace() override;
+  MatrixWorkspace_sptr reload() const;
+
+  const std::string id() const override { return "SpilledWorkspace"; }
+  const std::string toString() const override {
+    return "Workspace2D of " + std::to_string(m_memorySize) +
+           " bytes spilled to " + m_filename + "\n";
+  }
+  size_t getMemorySize() const override {
+    return m_skeleton->getMemorySize();
+  }
+
+private:
+  Workspace *doClone() const override {
+    throw std::runtime_error("A workspace spilled to disk cannot be cloned");
+  }
+  Workspace *doCloneEmpty() const override {
+    throw std::runtime_error("A workspace spilled to disk cannot be cloned");
+  }
+
+  /// The workspace without its data
+  MatrixWorkspace_sptr m_skeleton;
+  /// The masked bins, by workspace index
+  std::vector<std::pair<size_t, MatrixWorkspace::MaskList>> m_masks;
+  /// The memory used by the workspace before it was spilled
+  size_t m_memorySize;
+  std::string m_filename;
+};
+
+SpilledWorkspace::SpilledWorkspace(const MatrixWorkspace_const_sptr &ws,
+                                   const std::string &directory)
+    : m_memorySize(ws->getMemorySize()) {
+  static std::atomic<uint64_t> count{0};
+  Poco::File(directory).createDirectories();
+  m_filename = Poco::Path(directory, "mantid_spill_" +
+                                         std::to_string(Poco::Process::id()) +
+                                         "_" + std::to_string(count++) +
+                                         ".bin")
+                   .toString();
+
+  const size_t numberHistograms = ws->getNumberHistograms();
+  std::ofstream out(m_filename, std::ios::binary);
+  out.write(SPILL_MAGIC, sizeof(SPILL_MAGIC));
+  writeValue<uint64_t>(out, numberHistograms);
+  for (size_t i = 0; i < numberHistograms; ++i) {
+    const bool sharesX = i > 0 && &ws->x(i) == &ws->x(i - 1);
+    const bool hasDx = ws->hasDx(i);
+    writeValue<uint8_t>(out, static_cast<uint8_t>((sharesX ? SharesX : 0) |
+                                                  (hasDx ? HasDx : 0)));
+    if (!sharesX)
+      writeArray(out, ws->x(i).rawData());
+    writeArray(out, ws->y(i).rawData());
+    writeArray(out, ws->e(i).rawData());
+    if (hasDx)
+      writeArray(out, ws->dx(i).rawData());
+    if (ws->hasMaskedBins(i))
+      m_masks.emplace_back(i, ws->maskedBins(i));
+  }
+  out.close();
+  if (!out) {
+    Poco::File(m_filename).remove();
+    throw std::runtime_error("Cannot write " + m_filename);
+  }
+
+  m_skeleton = WorkspaceFactory::Instance().create(
+      ws, numberHistograms, ws->isHistogramData() ? 2 : 1, 1);
+  m_skeleton->history().addHistory(ws->getHistory());
+}
+
+SpilledWorkspace::~SpilledWorkspace() {
+  try {
+    Poco::File(m_filename).remove();
+  } catch (Poco::Exception &e) {
+    g_spillLog.warning() << "Cannot remove " << m_filename << ": "
+                         << e.displayText() << '\n';
+  }
+}
+
+/// @return a new workspace, with its data read back from the file
+MatrixWorkspace_sptr SpilledWorkspace::reload() const {
+  std::ifstream in(m_filename, std::ios::binary);
+  char magic[sizeof(SPILL_MAGIC)];
+  in.read(magic, sizeof(magic));
+  const auto numberHistograms = readValue<uint64_t>(in);
+  if (!in || std::memcmp(magic, SPILL_MAGIC, sizeof(magic)) != 0 ||
+      numberHistograms != m_skeleton->getNumberHistograms())
+    throw std::runtime_error("Cannot read the spilled workspace " +
+                             m_filename);
+
+  // Concurrent retrievals may reload the same workspace, so fill a copy
+  MatrixWorkspace_sptr workspace = m_skeleton->clone();
+  using namespace HistogramData;
+  const auto xMode = m_skeleton->histogram(0).xMode();
+  const auto yMode = m_skeleton->histogram(0).yMode();
+  Kernel::cow_ptr<HistogramX> x(nullptr);
+  for (size_t i = 0; i < numberHistograms; ++i) {
+    const auto flags = readValue<uint8_t>(in);
+    if (!(flags & SharesX) || !x)
+      x = Kernel::make_cow<HistogramX>(readArray(in));
+    Histogram histogram(xMode, yMode);
+    histogram.setX(x);
+    histogram.setSharedY(Kernel::make_cow<HistogramY>(readArray(in)));
+    histogram.setSharedE(Kernel::make_cow<HistogramE>(readArray(in)));
+    if (flags & HasDx)
+      histogram.setSharedDx(Kernel::make_cow<HistogramDx>(readArray(in)));
+    if (!in)
+      throw std::runtime_error("Cannot read the spilled workspace " +
+                               m_filename);
+    workspace->setHistogram(i, std::move(histogram));
+  }
+  for (const auto &mask : m_masks)
+    workspace->setMaskedBins(mask.first, mask.second);
+  return workspace;
+}
+} // namespace
 
 //-------------------------------------------------------------------------
 // Nested class methods
@@ -80,6 +251,8 @@ void AnalysisDataServiceImpl::add(
   if (workspace)
     workspace->setName(name);
   Kernel::DataService<API::Workspace>::add(name, workspace);
+  markUsed(*workspace);
+  spillWorkspaces();
 
   // if a group is added add its members as well
   if (!group)
@@ -120,6 +293,8 @@ void AnalysisDataServiceImpl::addOrReplace(
   if (workspace)
     workspace->setName(name);
   Kernel::DataService<API::Workspace>::addOrReplace(name, workspace);
+  markUsed(*workspace);
+  spillWorkspaces();
 
   if (!group)
     return;
@@ -149,7 +324,7 @@ void AnalysisDataServiceImpl::addOrReplace(
 void AnalysisDataServiceImpl::rename(const std::string &oldName,
                                      const std::string &newName) {
 
-  auto oldWorkspace = retrieve(oldName);
+  auto oldWorkspace = retrieveStored(oldName);
   auto group = boost::dynamic_pointer_cast<WorkspaceGroup>(oldWorkspace);
   if (group && group->containsInChildren(newName)) {
     throw std::invalid_argument(
@@ -158,7 +333,7 @@ void AnalysisDataServiceImpl::rename(const std::string &oldName,
 
   Kernel::DataService<API::Workspace>::rename(oldName, newName);
   // Attach the new name to the workspace
-  auto ws = retrieve(newName);
+  auto ws = retrieveStored(newName);
   ws->setName(newName);
 }
 
@@ -170,7 +345,7 @@ void AnalysisDataServiceImpl::rename(const std::string &oldName,
 void AnalysisDataServiceImpl::remove(const std::string &name) {
   Workspace_sptr ws;
   try {
-    ws = retrieve(name);
+    ws = retrieveStored(name);
   } catch (const Kernel::Exception::NotFoundError &) {
     // do nothing - remove will do what's needed
   }
@@ -191,7 +366,7 @@ void AnalysisDataServiceImpl::remove(const std::string &name) {
  * exist within the ADS
  */
 std::vector<Workspace_sptr> AnalysisDataServiceImpl::retrieveWorkspaces(
-    const std::vector<std::string> &names, bool unrollGroups) const {
+    const std::vector<std::string> &names, bool unrollGroups) {
   using WorkspacesVector = std::vector<Workspace_sptr>;
   WorkspacesVector workspaces;
   workspaces.reserve(names.size());
@@ -315,7 +490,7 @@ AnalysisDataServiceImpl::topLevelItems() const {
   for (const auto &topLevelName : topLevelNames) {
     try {
       const std::string &name = topLevelName;
-      auto ws = this->retrieve(topLevelName);
+      auto ws = this->retrieveStored(topLevelName);
       topLevel.emplace(name, ws);
       if (auto group = boost::dynamic_pointer_cast<WorkspaceGroup>(ws)) {
         group->reportMembers(groupMembers);
@@ -339,6 +514,51 @@ AnalysisDataServiceImpl::topLevelItems() const {
 
 void AnalysisDataServiceImpl::shutdown() { clear(); }
 
+/**
+ * Set the memory the workspaces may use. Beyond it the least recently used
+ * Workspace2Ds that are held only by the service are spilled to disk.
+ * @param bytes :: the limit in bytes, 0 for no limit
+ */
+void AnalysisDataServiceImpl::setMemoryLimit(size_t bytes) {
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_memoryLimit = bytes;
+  }
+  spillWorkspaces();
+}
+
+/**
+ * Set the directory workspaces are spilled to
+ * @param directory :: the directory, created if needed
+ */
+void AnalysisDataServiceImpl::setSpillDirectory(const std::string &directory) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  m_spillDirectory = directory;
+}
+
+/**
+ * @return the memory used by the workspaces in the service, in bytes. The
+ * members of groups are counted once and spilled workspaces only count their
+ * metadata.
+ */
+size_t AnalysisDataServiceImpl::memoryUsage() const {
+  size_t total = 0;
+  forEachStored([&total](const std::string &, const Workspace_sptr &workspace) {
+    if (!dynamic_cast<const WorkspaceGroup *>(workspace.get()))
+      total += workspace->getMemorySize();
+  });
+  return total;
+}
+
+/**
+ * @param name :: the name of a workspace
+ * @return true if the data of the workspace is currently on disk
+ */
+bool AnalysisDataServiceImpl::isSpilled(const std::string &name) const {
+  return dynamic_cast<const SpilledWorkspace *>(retrieveStored(name).get()) !=
+         nullptr;
+}
+
 //-------------------------------------------------------------------------
 // Private methods
 //-------------------------------------------------------------------------
@@ -349,7 +569,16 @@ void AnalysisDataServiceImpl::shutdown() { clear(); }
 AnalysisDataServiceImpl::AnalysisDataServiceImpl()
     : Mantid::Kernel::DataService<Mantid::API::Workspace>(
           "AnalysisDataService"),
-      m_illegalChars() {}
+      m_illegalChars() {
+  auto &config = Kernel::ConfigService::Instance();
+  const auto limit = config.getValue<double>("AnalysisDataService.MemoryLimit");
+  m_memoryLimit = limit && *limit > 0.
+                      ? static_cast<size_t>(*limit * 1024. * 1024.)
+                      : 0;
+  m_spillDirectory = config.getString("AnalysisDataService.SpillDirectory");
+  if (m_spillDirectory.empty())
+    m_spillDirectory = config.getTempDir();
+}
 
 // The following is commented using /// rather than /** to stop the compiler
 // complaining
@@ -396,5 +625,117 @@ void AnalysisDataServiceImpl::verifyName(
   }
 }
 
+/**
+ * Reload a workspace that was spilled to disk when it is retrieved. The file
+ * is read without the service locked, so that it can be used meanwhile.
+ * @param name :: the name of the workspace
+ * @param workspace :: the stored workspace
+ * @return the workspace, reloaded and stored in place of the spilled one
+ */
+Workspace_sptr
+AnalysisDataServiceImpl::beforeRetrieve(const std::string &name,
+                                        const Workspace_sptr &workspace) {
+  const auto spilled = boost::dynamic_pointer_cast<SpilledWorkspace>(workspace);
+  if (!spilled) {
+    markUsed(*workspace);
+    return workspace;
+  }
+  g_spillLog.debug() << "Reloading " << name << " from disk\n";
+  // Holding the reloaded workspace keeps it from being spilled again below
+  const Workspace_sptr reloaded = spilled->reload();
+  reloaded->setName(spilled->getName());
+  const auto stored = replaceStored(name, workspace, reloaded);
+  if (stored && stored != reloaded) {
+    // Another thread reloaded or replaced it meanwhile
+    return beforeRetrieve(name, stored);
+  }
+  markUsed(*reloaded);
+  spillWorkspaces();
+  return reloaded;
+}
+
+/**
+ * Look up a workspace without reloading it if it was spilled to disk
+ * @param name :: the name of the workspace
+ * @return the stored workspace
+ */
+Workspace_sptr
+AnalysisDataServiceImpl::retrieveStored(const std::string &name) const {
+  auto workspace = findStored(name);
+  if (!workspace)
+    throw Kernel::Exception::NotFoundError(
+        "Unable to find Data Object type with name '" + name +
+            "': data service ",
+        name);
+  return workspace;
+}
+
+/// Record that a workspace has just been used
+void AnalysisDataServiceImpl::markUsed(const Workspace &workspace) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  if (m_memoryLimit == 0)
+    return;
+  m_lastUsed[workspace.getName()] = ++m_useCount;
+}
+
+/**
+ * Spill the least recently used workspaces to disk until the memory used is
+ * within the limit. Only Workspace2Ds held by nothing but the service are
+ * spilled, as the memory of the others would not be freed.
+ */
+void AnalysisDataServiceImpl::spillWorkspaces() {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  if (m_memoryLimit == 0)
+    return;
+  size_t usage = memoryUsage();
+  if (usage <= m_memoryLimit)
+    return;
+
+  // The entries stay in place while the service is locked
+  using Candidate = std::pair<uint64_t, Workspace_sptr *>;
+  std::vector<Candidate> candidates;
+  std::unordered_set<std::string> names;
+  forEachStored([&](const std::string &name, Workspace_sptr &workspace) {
+    names.insert(name);
+    if (workspace.use_count() != 1 || workspace->id() != "Workspace2D")
+      return;
+    const auto used = m_lastUsed.find(workspace->getName());
+    candidates.emplace_back(used != m_lastUsed.end() ? used->second : 0,
+                            &workspace);
+  });
+  std::sort(candidates.begin(), candidates.end(),
+            [](const Candidate &a, const Candidate &b) {
+              return a.first < b.first;
+            });
+
+  for (const auto &candidate : candidates) {
+    if (usage <= m_memoryLimit)
+      break;
+    auto &workspace = *candidate.second;
+    try {
+      const auto memorySize = workspace->getMemorySize();
+      auto spilled = boost::make_shared<SpilledWorkspace>(
+          boost::static_pointer_cast<const MatrixWorkspace>(workspace),
+          m_spillDirectory);
+      spilled->setName(workspace->getName());
+      usage = usage - memorySize + spilled->getMemorySize();
+      g_spillLog.information() << "Spilled " << workspace->getName()
+                               << " to disk to free " << memorySize
+                               << " bytes\n";
+      workspace = std::move(spilled);
+    } catch (std::exception &e) {
+      g_spillLog.warning() << "Cannot spill " << workspace->getName()
+                           << " to disk: " << e.what() << '\n';
+    }
+  }
+  // Forget the workspaces that have gone
+  for (auto it = m_lastUsed.begin(); it != m_lastUsed.end();) {
+    if (names.count(it->first) == 0)
+      it = m_lastUsed.erase(it);
+    else
+      ++it;
+  }
+}
+
 } // Namespace API
 } // Namespace Mantid
@@ -53,6 +53,18 @@ void Column::sortValues(const std::vector<size_t> & /*unused*/) {
   throw std::runtime_error("Cannot sort column of type " + m_type);
 }
 
+/**
+ * Remove the items at the given indices. By default they are removed one by
+ * one, from the last to the first.
+ * @param indices :: Indices of the items, in ascending order and without
+ * duplicates.
+ */
+void Column::removeRows(const std::vector<size_t> &indices) {
+  for (auto index = indices.crbegin(); index != indices.crend(); ++index) {
+    remove(*index);
+  }
+}
+
 std::ostream &operator<<(std::ostream &s, const API::Boolean &b) {
   s << (b.value ? "true" : "false");
   return s;
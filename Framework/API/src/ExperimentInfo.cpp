@@ -51,6 +51,7 @@
 #include <Poco/SAX/ContentHandler.h>
 #include <Poco/SAX/SAXParser.h>
 #include <nexus/NeXusException.hpp>
+#include <mutex>
 #include <tuple>
 
 using namespace Mantid::Geometry;
@@ -101,6 +102,44 @@ class myContentHandler : public Poco::XML::ContentHandler {
                           const XMLString & /*uri*/) override {}
 };
 
+/// The last instrument definition embedded in a NeXus file that was used to
+/// set an instrument, and its mangled name in the InstrumentDataService.
+/// Files holding many runs, such as merged MD workspaces, embed the same
+/// definition for every run, and the mangled name is a hash of all of it.
+struct EmbeddedInstrument {
+  std::mutex mutex;
+  std::string name;
+  std::string xml;
+  std::string mangledName;
+};
+
+EmbeddedInstrument &lastEmbeddedInstrument() {
+  static EmbeddedInstrument instrument;
+  return instrument;
+}
+
+/// @return the mangled name of an embedded instrument definition if it is
+/// the last one used, otherwise an empty string
+std::string lastEmbeddedMangledName(const std::string &name,
+                                    const std::string &xml) {
+  auto &last = lastEmbeddedInstrument();
+  std::lock_guard<std::mutex> lock(last.mutex);
+  if (last.name == name && last.xml == xml)
+    return last.mangledName;
+  return "";
+}
+
+/// Remember the mangled name of an embedded instrument definition
+void setLastEmbeddedMangledName(const std::string &name,
+                                const std::string &xml,
+                                const std::string &mangledName) {
+  auto &last = lastEmbeddedInstrument();
+  std::lock_guard<std::mutex> lock(last.mutex);
+  last.name = name;
+  last.xml = xml;
+  last.mangledName = mangledName;
+}
+
 } // namespace
 
 /** Constructor
@@ -521,6 +560,8 @@ void ExperimentInfo::setDetectorGrouping(
   }
   m_spectrumInfo->setSpectrumDefinition(index, std::move(specDef));
   m_spectrumDefinitionNeedsUpdate.at(index) = 0;
+  if (m_spectrumInfoWrapper)
+    m_spectrumInfoWrapper->invalidateCachedValues(index);
 }
 
 /** Update detector grouping for spectrum with given index.
@@ -1313,7 +1354,8 @@ void ExperimentInfo::setInstumentFromXML(const std::string &nxFilename,
   instrumentXml = Strings::strip(instrumentXml);
   instrumentName = Strings::strip(instrumentName);
   std::string instrumentFilename;
-  if (!instrumentXml.empty()) {
+  const bool embeddedXml = !instrumentXml.empty();
+  if (embeddedXml) {
     // instrument xml is being loaded from the nxs file, set the
     // instrumentFilename
     // to identify the Nexus file as the source of the data
@@ -1330,10 +1372,27 @@ void ExperimentInfo::setInstumentFromXML(const std::string &nxFilename,
 
   // ---------- Now parse that XML to make the instrument -------------------
   if (!instrumentXml.empty() && !instrumentName.empty()) {
+    // Skip building a parser and hashing the definition if it is the same as
+    // the last embedded one and that instrument is still in the service
+    if (embeddedXml) {
+      const auto lastMangledName =
+          lastEmbeddedMangledName(instrumentName, instrumentXml);
+      if (!lastMangledName.empty() &&
+          InstrumentDataService::Instance().doesExist(lastMangledName)) {
+        this->setInstrument(
+            InstrumentDataService::Instance().retrieve(lastMangledName));
+        return;
+      }
+    }
+
     InstrumentDefinitionParser parser(instrumentFilename, instrumentName,
                                       instrumentXml);
 
     std::string instrumentNameMangled = parser.getMangledName();
+    if (embeddedXml) {
+      setLastEmbeddedMangledName(instrumentName, instrumentXml,
+                                 instrumentNameMangled);
+    }
     Instrument_sptr instr;
     // Check whether the instrument is already in the InstrumentDataService
     if (InstrumentDataService::Instance().doesExist(instrumentNameMangled)) {
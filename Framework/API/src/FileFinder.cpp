@@ -16,6 +16,7 @@
 #include "MantidKernel/FacilityInfo.h"
 #include "MantidKernel/Glob.h"
 #include "MantidKernel/InstrumentInfo.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 
 #include "MantidKernel/StringTokenizer.h"
@@ -27,6 +28,8 @@
 
 #include <algorithm>
 #include <cctype>
+#include <exception>
+#include <sstream>
 
 #include <boost/algorithm/string.hpp>
 
@@ -556,7 +559,8 @@ FileFinderImpl::findRuns(const std::string &hintstr,
                          const bool useExtsOnly) const {
   std::string hint = Kernel::Strings::strip(hintstr);
   g_log.debug() << "findRuns hint = " << hint << "\n";
-  std::vector<std::string> res;
+  // The hint to search for and the name to report if it is not found
+  std::vector<std::pair<std::string, std::string>> runs;
   Mantid::Kernel::StringTokenizer hints(
       hint, ",",
       Mantid::Kernel::StringTokenizer::TOK_TRIM |
@@ -611,23 +615,33 @@ FileFinderImpl::findRuns(const std::string &hintstr,
         run = std::to_string(irun);
         while (run.size() < nZero)
           run.insert(0, "0");
-        std::string path = findRun(p1.first + run, exts, useExtsOnly);
-        if (!path.empty()) {
-          res.push_back(path);
-        } else {
-          throw Kernel::Exception::NotFoundError("Unable to find file:", run);
-        }
+        runs.emplace_back(p1.first + run, run);
       }
     } else {
-      std::string path = findRun(*h, exts, useExtsOnly);
-      if (!path.empty()) {
-        res.push_back(path);
-      } else {
-        throw Kernel::Exception::NotFoundError("Unable to find file:", *h);
-      }
+      runs.emplace_back(*h, *h);
     }
   }
 
+  // Each search may go to the data archive, so the runs are looked for in
+  // parallel and any missing run is reported in the order they were given
+  std::vector<std::string> res(runs.size());
+  std::vector<std::exception_ptr> errors(runs.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(runs.size()); ++i) {
+    try {
+      res[i] = findRun(runs[i].first, exts, useExtsOnly);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  }
+  for (size_t i = 0; i < runs.size(); ++i) {
+    if (errors[i])
+      std::rethrow_exception(errors[i]);
+    if (res[i].empty())
+      throw Kernel::Exception::NotFoundError("Unable to find file:",
+                                             runs[i].second);
+  }
+
   return res;
 }
 
@@ -653,20 +667,45 @@ FileFinderImpl::getArchivePath(const std::vector<IArchiveSearch_sptr> &archs,
     g_log.debug() << iter << " ";
   g_log.debug() << "])\n";
 
-  std::string path;
-  for (const auto &arch : archs) {
+  std::ostringstream key;
+  for (const auto &filename : filenames)
+    key << filename << ',';
+  key << '|';
+  for (const auto &ext : exts)
+    key << ext << ',';
+  std::string path = m_cache.archivePath(key.str());
+  if (!path.empty()) {
+    g_log.debug() << "Found " << path << " in the archive path cache\n";
+    return path;
+  }
+
+  // Ask all the archives at once, as each may take a while to answer, and
+  // take the first in order that has the file
+  std::vector<std::string> paths(archs.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(archs.size()); ++i) {
     try {
       g_log.debug() << "Getting archive path for requested files\n";
-      path = arch->getArchivePath(filenames, exts);
-      if (!path.empty()) {
-        return path;
-      }
+      paths[i] = archs[i]->getArchivePath(filenames, exts);
     } catch (...) {
     }
   }
+  const auto found =
+      std::find_if(paths.cbegin(), paths.cend(),
+                   [](const std::string &p) { return !p.empty(); });
+  if (found != paths.cend()) {
+    path = *found;
+    m_cache.addArchivePath(key.str(), path);
+  }
   return path;
 }
 
+/**
+ * Forget the listings of the data search directories and the paths found in
+ * the archives, e.g. after files have been moved.
+ */
+void FileFinderImpl::clearCache() { m_cache.clear(); }
+
 /**
  * Return the full path to the file given its name, checking local directories
  * first.
@@ -706,8 +745,8 @@ FileFinderImpl::getPath(const std::vector<IArchiveSearch_sptr> &archs,
       for (const auto &searchPath : searchPaths) {
         try {
           const Poco::Path filePath(searchPath, filename + extension);
-          const Poco::File file(filePath);
-          if (file.exists())
+          if (m_cache.directoryContains(filePath.parent().toString(),
+                                        filePath.getFileName()))
             return filePath.toString();
 
         } catch (Poco::Exception &) { /* File does not exist, just carry on. */
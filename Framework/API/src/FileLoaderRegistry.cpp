@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/FileLoaderRegistry.h"
 #include "MantidAPI/IFileLoader.h"
+#include "MantidKernel/LibraryManager.h"
 
 #include <Poco/File.h>
 
@@ -86,6 +87,7 @@ searchForLoader(const std::string &filename,
  */
 void FileLoaderRegistryImpl::unsubscribe(const std::string &name,
                                          const int version) {
+  const auto lock = Kernel::LibraryManager::Instance().lockFactories();
   auto iend = m_names.end();
   for (auto it = m_names.begin(); it != iend; ++it) {
     removeAlgorithm(name, version, *it);
@@ -106,18 +108,28 @@ FileLoaderRegistryImpl::chooseLoader(const std::string &filename) const {
   using Kernel::NexusDescriptor;
 
   m_log.debug() << "Trying to find loader for '" << filename << "'\n";
+  const bool isHDF = NexusDescriptor::isHDF(filename);
+  std::multimap<std::string, int> names;
+  {
+    // Every loader must be asked, so open the libraries not opened yet. The
+    // file is read after unlocking, as it may take a while.
+    auto &libraryManager = Kernel::LibraryManager::Instance();
+    const auto lock = libraryManager.lockFactories();
+    libraryManager.openLibrariesProviding("Loader:");
+    names = m_names[isHDF ? Nexus : Generic];
+  }
 
   IAlgorithm_sptr bestLoader;
-  if (NexusDescriptor::isHDF(filename)) {
+  if (isHDF) {
     m_log.debug()
         << filename
         << " looks like a Nexus file. Checking registered Nexus loaders\n";
     bestLoader = searchForLoader<NexusDescriptor, IFileLoader<NexusDescriptor>>(
-        filename, m_names[Nexus], m_log);
+        filename, names, m_log);
   } else {
     m_log.debug() << "Checking registered non-HDF loaders\n";
     bestLoader = searchForLoader<FileDescriptor, IFileLoader<FileDescriptor>>(
-        filename, m_names[Generic], m_log);
+        filename, names, m_log);
   }
 
   if (!bestLoader) {
@@ -142,10 +154,15 @@ bool FileLoaderRegistryImpl::canLoad(const std::string &algorithmName,
 
   // Check if it is in one of our lists
   bool nexus(false), nonHDF(false);
-  if (m_names[Nexus].find(algorithmName) != m_names[Nexus].end())
-    nexus = true;
-  else if (m_names[Generic].find(algorithmName) != m_names[Generic].end())
-    nonHDF = true;
+  {
+    auto &libraryManager = Kernel::LibraryManager::Instance();
+    const auto lock = libraryManager.lockFactories();
+    libraryManager.openLibraryProviding("Loader:" + algorithmName);
+    if (m_names[Nexus].find(algorithmName) != m_names[Nexus].end())
+      nexus = true;
+    else if (m_names[Generic].find(algorithmName) != m_names[Generic].end())
+      nonHDF = true;
+  }
 
   if (!nexus && !nonHDF)
     throw std::invalid_argument(
@@ -166,6 +183,19 @@ bool FileLoaderRegistryImpl::canLoad(const std::string &algorithmName,
   return static_cast<bool>(loader);
 }
 
+/**
+ * @returns The names of the loaders registered for every format
+ */
+std::set<std::string> FileLoaderRegistryImpl::loaderNames() const {
+  const auto lock = Kernel::LibraryManager::Instance().lockFactories();
+  std::set<std::string> names;
+  for (const auto &typedLoaders : m_names) {
+    for (const auto &loader : typedLoaders)
+      names.insert(loader.first);
+  }
+  return names;
+}
+
 //----------------------------------------------------------------------------------------------
 // Private members
 //----------------------------------------------------------------------------------------------
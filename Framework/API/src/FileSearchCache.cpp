@@ -0,0 +1,232 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/FileSearchCache.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+
+#include <Poco/DirectoryIterator.h>
+#include <Poco/Exception.h>
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace Mantid {
+namespace API {
+namespace {
+/// static logger object
+Kernel::Logger g_log("FileSearchCache");
+
+/// @return the time to live of a cache from its configuration key
+std::chrono::seconds timeToLive(const std::string &key,
+                                const double defaultSeconds) {
+  const auto value = Kernel::ConfigService::Instance().getValue<double>(key);
+  const double seconds = value ? *value : defaultSeconds;
+  return std::chrono::seconds(static_cast<long long>(std::max(seconds, 0.)));
+}
+
+std::chrono::seconds directoryTimeToLive() {
+  return timeToLive("datasearch.directorycache.ttl", 60.);
+}
+
+std::chrono::seconds archiveTimeToLive() {
+  return timeToLive("datasearch.archivecache.ttl", 86400.);
+}
+
+long long toSeconds(const std::chrono::system_clock::time_point &time) {
+  return std::chrono::duration_cast<std::chrono::seconds>(
+             time.time_since_epoch())
+      .count();
+}
+} // namespace
+
+/// Save the archive paths to archive_paths.cache in the user properties
+/// directory
+FileSearchCache::FileSearchCache()
+    : FileSearchCache(
+          Poco::Path(Kernel::ConfigService::Instance().getUserPropertiesDir(),
+                     "archive_paths.cache")
+              .toString()) {}
+
+/**
+ * @param archiveCacheFile :: The file to save the archive paths to, or empty
+ * to keep them for the session only
+ */
+FileSearchCache::FileSearchCache(const std::string &archiveCacheFile)
+    : m_archiveCacheFile(archiveCacheFile) {}
+
+/**
+ * Check whether a directory holds a file, from the listing of the directory
+ * if it is recent enough or from a new listing.
+ * @param directory :: The directory to look in
+ * @param filename :: The name of the file, without any directory
+ * @return true if the listing of the directory has the file and it still
+ * exists. A directory that cannot be listed holds nothing.
+ */
+bool FileSearchCache::directoryContains(const std::string &directory,
+                                        const std::string &filename) {
+  const auto exists = [&directory, &filename]() {
+    try {
+      return Poco::File(Poco::Path(directory, filename)).exists();
+    } catch (Poco::Exception &) {
+      return false;
+    }
+  };
+  const auto ttl = directoryTimeToLive();
+  if (ttl.count() == 0)
+    return exists();
+
+  const auto now = Clock::now();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto listing = m_listings.find(directory);
+    if (listing != m_listings.end() && now - listing->second.listed < ttl) {
+      if (listing->second.names.count(filename) == 0)
+        return false;
+      // The file may have been removed since the listing
+      if (exists())
+        return true;
+      m_listings.erase(listing);
+      return false;
+    }
+  }
+
+  // List the directory without holding the lock, as it may be on a slow
+  // network file system
+  Listing listing;
+  listing.listed = now;
+  try {
+    const Poco::DirectoryIterator end;
+    for (Poco::DirectoryIterator it(directory); it != end; ++it)
+      listing.names.insert(it.name());
+  } catch (Poco::Exception &e) {
+    g_log.debug() << "Cannot list " << directory << ": " << e.displayText()
+                  << '\n';
+  }
+  const bool contains = listing.names.count(filename) > 0;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_listings[directory] = std::move(listing);
+  return contains;
+}
+
+/**
+ * @param key :: The names and extensions of the run that was looked for
+ * @return the path found in the archives for the key, or an empty string if
+ * there is none, it has expired or the file no longer exists
+ */
+std::string FileSearchCache::archivePath(const std::string &key) {
+  const auto ttl = archiveTimeToLive();
+  if (ttl.count() == 0)
+    return "";
+
+  std::string path;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    loadArchiveCache();
+    const auto entry = m_archivePaths.find(key);
+    if (entry == m_archivePaths.end())
+      return "";
+    if (Clock::now() - entry->second.found >= ttl) {
+      m_archivePaths.erase(entry);
+      return "";
+    }
+    path = entry->second.path;
+  }
+
+  try {
+    if (Poco::File(path).exists())
+      return path;
+  } catch (Poco::Exception &) {
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_archivePaths.erase(key);
+  return "";
+}
+
+/**
+ * Remember the path found in the archives for a run, and append it to the
+ * cache file.
+ * @param key :: The names and extensions of the run that was looked for
+ * @param path :: The path found
+ */
+void FileSearchCache::addArchivePath(const std::string &key,
+                                     const std::string &path) {
+  if (archiveTimeToLive().count() == 0 || path.empty())
+    return;
+
+  const auto now = Clock::now();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  loadArchiveCache();
+  m_archivePaths[key] = ArchiveEntry{path, now};
+  if (m_archiveCacheFile.empty())
+    return;
+  std::ofstream file(m_archiveCacheFile, std::ios::app);
+  if (file)
+    file << toSeconds(now) << '\t' << key << '\t' << path << '\n';
+}
+
+/// Forget the directory listings and the archive paths, including those
+/// saved to the cache file
+void FileSearchCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_listings.clear();
+  m_archivePaths.clear();
+  m_archiveCacheLoaded = true;
+  if (!m_archiveCacheFile.empty())
+    std::ofstream truncated(m_archiveCacheFile, std::ios::trunc);
+}
+
+/**
+ * Read the archive paths from the cache file, once. The file is rewritten
+ * without the entries that have expired. Must be called with the lock held.
+ */
+void FileSearchCache::loadArchiveCache() {
+  if (m_archiveCacheLoaded)
+    return;
+  m_archiveCacheLoaded = true;
+  if (m_archiveCacheFile.empty())
+    return;
+  std::ifstream file(m_archiveCacheFile);
+  if (!file)
+    return;
+
+  const auto now = Clock::now();
+  const auto ttl = archiveTimeToLive();
+  bool expired = false;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream fields(line);
+    std::string seconds, key, path;
+    if (!std::getline(fields, seconds, '\t') ||
+        !std::getline(fields, key, '\t') || !std::getline(fields, path))
+      continue;
+    Clock::time_point found;
+    try {
+      found += std::chrono::seconds(std::stoll(seconds));
+    } catch (std::exception &) {
+      continue;
+    }
+    if (now - found < ttl)
+      m_archivePaths[key] = ArchiveEntry{path, found};
+    else
+      expired = true;
+  }
+  file.close();
+
+  if (expired) {
+    std::ofstream out(m_archiveCacheFile, std::ios::trunc);
+    for (const auto &entry : m_archivePaths)
+      out << toSeconds(entry.second.found) << '\t' << entry.first << '\t'
+          << entry.second.path << '\n';
+  }
+}
+
+} // namespace API
+} // namespace Mantid
@@ -5,9 +5,14 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/AlgorithmFactory.h"
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/FileLoaderRegistry.h"
+#include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/IFunction.h"
 #include "MantidAPI/InstrumentDataService.h"
+#include "MantidAPI/PluginManifest.h"
 #include "MantidAPI/WorkspaceGroup.h"
 
 #include "MantidKernel/Exception.h"
@@ -22,10 +27,14 @@
 #include <nexus/NeXusFile.hpp>
 
 #include <Poco/ActiveResult.h>
+#include <Poco/File.h>
+#include <Poco/Path.h>
 #include <tbb/task_scheduler_init.h>
 
+#include <algorithm>
 #include <clocale>
 #include <cstdarg>
+#include <set>
 
 #ifdef _WIN32
 #include <winsock2.h>
@@ -53,6 +62,29 @@ Kernel::Logger g_log("FrameworkManager");
 const char *PLUGINS_DIR_KEY = "framework.plugins.directory";
 /// Key to define the location of the plugins to exclude from loading
 const char *PLUGINS_EXCLUDE_KEY = "framework.plugins.exclude";
+/// Key to define the manifest used to open the plugins only when needed
+const char *PLUGINS_MANIFEST_KEY = "framework.plugins.manifest";
+
+/**
+ * @returns The entries registered with the factories by the plugin libraries
+ * opened so far, e.g. Algorithm:Rebin|1, Function:Gaussian or Loader:LoadRaw.
+ * Algorithms are listed with their version, so that a library adding a version
+ * of an algorithm is opened when the latest version is requested.
+ */
+std::set<std::string> pluginEntries() {
+  std::set<std::string> entries;
+  // Ask the base classes, which do not open the deferred libraries
+  const auto &algorithms = AlgorithmFactory::Instance();
+  for (const auto &key :
+       algorithms.Kernel::DynamicFactory<Algorithm>::getKeys())
+    entries.insert("Algorithm:" + key);
+  for (const auto &name :
+       FunctionFactory::Instance().Kernel::DynamicFactory<IFunction>::getKeys())
+    entries.insert("Function:" + name);
+  for (const auto &name : FileLoaderRegistry::Instance().loaderNames())
+    entries.insert("Loader:" + name);
+  return entries;
+}
 } // namespace
 
 /** This is a function called every time NeXuS raises an error.
@@ -403,13 +435,64 @@ void FrameworkManagerImpl::loadPluginsUsingKey(const std::string &locationKey,
     boost::split(excludes, excludeStr, boost::is_any_of(";"));
     g_log.debug("Loading libraries from '" + pluginDir + "', excluding '" +
                 excludeStr + "'");
-    LibraryManager::Instance().openLibraries(
-        pluginDir, LibraryManagerImpl::NonRecursive, excludes);
+    const auto manifest = cfgSvc.getString(PLUGINS_MANIFEST_KEY);
+    if (manifest.empty())
+      LibraryManager::Instance().openLibraries(
+          pluginDir, LibraryManagerImpl::NonRecursive, excludes);
+    else
+      loadPluginsUsingManifest(pluginDir, excludes, manifest);
   } else {
     g_log.debug("No library directory found in key \"" + locationKey + "\"");
   }
 }
 
+/**
+ * Load a set of plugins, deferring the opening of each library listed in a
+ * manifest until one of the algorithms, functions or loaders it registers is
+ * first requested. Libraries missing from the manifest, or modified since it
+ * was written, are opened now and the manifest is rewritten to list them.
+ * @param pluginDir The directory containing the plugins
+ * @param excludes Substrings of the names of libraries to skip
+ * @param manifestPath The path to the manifest, created if it does not exist
+ */
+void FrameworkManagerImpl::loadPluginsUsingManifest(
+    const std::string &pluginDir, const std::vector<std::string> &excludes,
+    const std::string &manifestPath) {
+  auto &libraryManager = LibraryManager::Instance();
+  const auto lock = libraryManager.lockFactories();
+  const auto libraries = libraryManager.findLibraries(
+      pluginDir, LibraryManagerImpl::NonRecursive, excludes);
+  PluginManifest manifest(manifestPath);
+
+  // Open the unlisted libraries first, while the factories only hold entries
+  // of libraries already opened
+  std::vector<std::string> deferred;
+  auto entries = pluginEntries();
+  for (const auto &library : libraries) {
+    const auto filename = Poco::Path(library).getFileName();
+    const auto modified =
+        Poco::File(library).getLastModified().epochMicroseconds();
+    if (manifest.isCurrent(filename, modified)) {
+      deferred.emplace_back(library);
+      continue;
+    }
+    libraryManager.openLibrary(library);
+    auto opened = pluginEntries();
+    std::vector<std::string> registered;
+    std::set_difference(opened.cbegin(), opened.cend(), entries.cbegin(),
+                        entries.cend(), std::back_inserter(registered));
+    manifest.update(filename, modified, std::move(registered));
+    entries = std::move(opened);
+  }
+  for (const auto &library : deferred)
+    libraryManager.deferLibrary(
+        library, manifest.entries(Poco::Path(library).getFileName()));
+  g_log.debug() << "Deferred opening " << deferred.size() << " of "
+                << libraries.size() << " libraries from '" << pluginDir
+                << "'\n";
+  manifest.save();
+}
+
 /**
  * Set the numeric formatting category of the C locale to classic C.
  */
@@ -22,9 +22,13 @@
 
 namespace Mantid {
 namespace API {
+namespace {
+/// The prefix of the function entries of deferred plugin libraries
+const char *LIBRARY_ENTRY_PREFIX = "Function:";
+} // namespace
 
 FunctionFactoryImpl::FunctionFactoryImpl()
-    : Kernel::DynamicFactory<IFunction>() {
+    : Kernel::DynamicFactory<IFunction>(), m_parsedExpressions(256) {
   // we need to make sure the library manager has been loaded before we
   // are constructed so that it is destroyed after us and thus does
   // not close any loaded DLLs with loaded algorithms in them
@@ -33,7 +37,14 @@ FunctionFactoryImpl::FunctionFactoryImpl()
 
 IFunction_sptr
 FunctionFactoryImpl::createFunction(const std::string &type) const {
-  IFunction_sptr fun = create(type);
+  IFunction_sptr fun;
+  {
+    auto &libraryManager = Kernel::LibraryManager::Instance();
+    const auto lock = libraryManager.lockFactories();
+    if (!exists(type))
+      libraryManager.openLibraryProviding(LIBRARY_ENTRY_PREFIX + type);
+    fun = create(type);
+  }
   fun->initialize();
   return fun;
 }
@@ -52,16 +63,23 @@ FunctionFactoryImpl::createFunction(const std::string &type) const {
  */
 IFunction_sptr
 FunctionFactoryImpl::createInitialized(const std::string &input) const {
-  Expression expr;
-  try {
-    expr.parse(input);
-  } catch (Expression::ParsingError &e) {
-    inputError(input + "\n    " + e.what());
-  } catch (...) {
-    inputError(input);
+  // Fitting algorithms are often run many times with the same function, so
+  // the expressions parsed from recent strings are reused
+  auto expr = m_parsedExpressions.find(input);
+  if (!expr) {
+    auto parsed = std::make_shared<Expression>();
+    try {
+      parsed->parse(input);
+    } catch (Expression::ParsingError &e) {
+      inputError(input + "\n    " + e.what());
+    } catch (...) {
+      inputError(input);
+    }
+    expr = std::move(parsed);
+    m_parsedExpressions.insert(input, expr);
   }
 
-  const Expression &e = expr.bracketsRemoved();
+  const Expression &e = expr->bracketsRemoved();
   std::map<std::string, std::string> parentAttributes;
   if (e.name() == ";") {
     IFunction_sptr fun = createComposite(e, parentAttributes);
@@ -387,6 +405,7 @@ void FunctionFactoryImpl::subscribe(
     const std::string &className,
     std::unique_ptr<AbstractFactory> pAbstractFactory,
     Kernel::DynamicFactory<IFunction>::SubscribeAction replace) {
+  const auto lock = Kernel::LibraryManager::Instance().lockFactories();
   // Clear the cache, then do all the work in the base class method
   m_cachedFunctionNames.clear();
   Kernel::DynamicFactory<IFunction>::subscribe(
@@ -394,10 +413,30 @@ void FunctionFactoryImpl::subscribe(
 }
 
 void FunctionFactoryImpl::unsubscribe(const std::string &className) {
+  const auto lock = Kernel::LibraryManager::Instance().lockFactories();
   // Clear the cache, then do all the work in the base class method
   m_cachedFunctionNames.clear();
   Kernel::DynamicFactory<IFunction>::unsubscribe(className);
 }
 
+/**
+ * @returns The names of the registered functions, opening the deferred plugin
+ * libraries providing functions first
+ */
+const std::vector<std::string> FunctionFactoryImpl::getKeys() const {
+  const auto lock = Kernel::LibraryManager::Instance().lockFactories();
+  openDeferredLibraries();
+  return Kernel::DynamicFactory<IFunction>::getKeys();
+}
+
+/**
+ * Opens the deferred plugin libraries providing functions. Called with the
+ * factories locked.
+ */
+void FunctionFactoryImpl::openDeferredLibraries() const {
+  Kernel::LibraryManager::Instance().openLibrariesProviding(
+      LIBRARY_ENTRY_PREFIX);
+}
+
 } // namespace API
 } // namespace Mantid
@@ -16,7 +16,9 @@
 #include "MantidKernel/Exception.h"
 
 #include <boost/make_shared.hpp>
+#include <algorithm>
 #include <cmath>
+#include <functional>
 #include <limits>
 
 namespace Mantid {
@@ -91,6 +93,37 @@ const double PEAK_TOLERANCE = 1e-14;
 /// "Infinite" value for the peak radius
 const int MAX_PEAK_RADIUS = std::numeric_limits<int>::max();
 
+/**
+ * Find the points strictly within dx of the centre c. The x values of a fit
+ * are sorted, ascending or descending, so the points form a contiguous range
+ * found by binary search rather than by testing each of them.
+ * @param xValues :: X values for data points
+ * @param nData :: Number of data points
+ * @param c :: The peak centre
+ * @param dx :: Half width of the range
+ * @return The indices of the first point in the range and one past the last
+ */
+std::pair<size_t, size_t> peakWindow(const double *xValues, const size_t nData,
+                                     const double c, const double dx) {
+  if (nData == 0)
+    return {0, 0};
+  const double *begin = xValues;
+  const double *end = xValues + nData;
+  const double *first;
+  const double *last;
+  if (xValues[0] <= xValues[nData - 1]) {
+    first = std::upper_bound(begin, end, c - dx);
+    last = std::lower_bound(begin, end, c + dx);
+  } else {
+    first = std::upper_bound(begin, end, c + dx, std::greater<double>());
+    last = std::lower_bound(begin, end, c - dx, std::greater<double>());
+  }
+  // An empty range, or no range at all if dx is zero or not a number
+  if (last <= first)
+    return {0, 0};
+  return {static_cast<size_t>(first - begin), static_cast<size_t>(last - begin)};
+}
+
 } // namespace
 
 /**
@@ -118,22 +151,14 @@ void IPeakFunction::function(const FunctionDomain &domain,
  */
 void IPeakFunction::function1D(double *out, const double *xValues,
                                const size_t nData) const {
-  double c = this->centre();
-  double dx = fabs(m_peakRadius * this->fwhm());
-  int i0 = -1;
-  int n = 0;
-  for (size_t i = 0; i < nData; ++i) {
-    if (fabs(xValues[i] - c) < dx) {
-      if (i0 < 0)
-        i0 = static_cast<int>(i);
-      ++n;
-    } else {
-      out[i] = 0.0;
-    }
-  }
-  if (i0 < 0 || n == 0)
+  const auto window =
+      peakWindow(xValues, nData, this->centre(), fabs(m_peakRadius * fwhm()));
+  std::fill(out, out + window.first, 0.0);
+  std::fill(out + window.second, out + nData, 0.0);
+  if (window.first == window.second)
     return;
-  this->functionLocal(out + i0, xValues + i0, n);
+  this->functionLocal(out + window.first, xValues + window.first,
+                      window.second - window.first);
 }
 
 /**
@@ -149,25 +174,23 @@ void IPeakFunction::function1D(double *out, const double *xValues,
  */
 void IPeakFunction::functionDeriv1D(Jacobian *out, const double *xValues,
                                     const size_t nData) {
-  double c = this->centre();
-  double dx = fabs(m_peakRadius * this->fwhm());
-  int i0 = -1;
-  int n = 0;
-  for (size_t i = 0; i < nData; ++i) {
-    if (fabs(xValues[i] - c) < dx) {
-      if (i0 < 0)
-        i0 = static_cast<int>(i);
-      ++n;
-    } else {
-      for (size_t ip = 0; ip < this->nParams(); ++ip) {
+  const auto window =
+      peakWindow(xValues, nData, this->centre(), fabs(m_peakRadius * fwhm()));
+  const size_t nParams = this->nParams();
+  auto zeroRows = [out, nParams](const size_t from, const size_t to) {
+    for (size_t i = from; i < to; ++i) {
+      for (size_t ip = 0; ip < nParams; ++ip) {
         out->set(i, ip, 0.0);
       }
     }
-  }
-  if (i0 < 0 || n == 0)
+  };
+  zeroRows(0, window.first);
+  zeroRows(window.second, nData);
+  if (window.first == window.second)
     return;
-  PartialJacobian1 J(out, i0);
-  this->functionDerivLocal(&J, xValues + i0, n);
+  PartialJacobian1 J(out, window.first);
+  this->functionDerivLocal(&J, xValues + window.first,
+                           window.second - window.first);
 }
 
 void IPeakFunction::setPeakRadius(int r) const {
@@ -8,6 +8,9 @@
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidKernel/IPropertyManager.h"
 
+#include <functional>
+#include <set>
+
 namespace Mantid {
 namespace API {
 
@@ -87,6 +90,18 @@ void ITableWorkspace::modified() {
           this->getName(), tws));
 }
 
+/** Deletes several rows. By default they are removed one by one, from the
+ * last to the first, with removeRow.
+ * @param indices :: Rows to delete, in any order. They must all exist.
+ */
+void ITableWorkspace::removeRows(const std::vector<size_t> &indices) {
+  const std::set<size_t, std::greater<size_t>> sortedRows(indices.cbegin(),
+                                                          indices.cend());
+  for (const auto row : sortedRows) {
+    removeRow(row);
+  }
+}
+
 /** Overridable method to custom-sort the workspace
  *
  * @param criteria : a vector with a list of pairs: column name, bool;
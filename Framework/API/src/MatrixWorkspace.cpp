@@ -34,10 +34,12 @@
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/regex.hpp>
+#include <boost/functional/hash.hpp>
 
 #include <cmath>
 #include <functional>
 #include <numeric>
+#include <unordered_map>
 
 using Mantid::Kernel::TimeSeriesProperty;
 using Mantid::Types::Core::DateAndTime;
@@ -636,21 +638,28 @@ std::vector<size_t> MatrixWorkspace::getIndicesFromDetectorIDs(
                              "in a parallel run is most likely incorrect. "
                              "Aborting.");
 
-  std::map<detid_t, std::set<size_t>> detectorIDtoWSIndices;
+  // A sorted table of (detector ID, workspace index) pairs. This is much
+  // lighter to build than a map of sets for instruments with many detectors.
+  std::vector<std::pair<detid_t, size_t>> detectorIDtoWSIndex;
   for (size_t i = 0; i < getNumberHistograms(); ++i) {
-    auto detIDs = getSpectrum(i).getDetectorIDs();
+    const auto &detIDs = getSpectrum(i).getDetectorIDs();
     for (auto detID : detIDs) {
-      detectorIDtoWSIndices[detID].insert(i);
+      detectorIDtoWSIndex.emplace_back(detID, i);
     }
   }
+  std::sort(detectorIDtoWSIndex.begin(), detectorIDtoWSIndex.end());
 
   std::vector<size_t> indexList;
   indexList.reserve(detIdList.size());
   for (const auto detId : detIdList) {
-    auto wsIndices = detectorIDtoWSIndices.find(detId);
-    if (wsIndices != detectorIDtoWSIndices.end()) {
-      std::copy(wsIndices->second.cbegin(), wsIndices->second.cend(),
-                std::back_inserter(indexList));
+    auto wsIndex = std::lower_bound(
+        detectorIDtoWSIndex.cbegin(), detectorIDtoWSIndex.cend(), detId,
+        [](const std::pair<detid_t, size_t> &entry, const detid_t id) {
+          return entry.first < id;
+        });
+    for (; wsIndex != detectorIDtoWSIndex.cend() && wsIndex->first == detId;
+         ++wsIndex) {
+      indexList.push_back(wsIndex->second);
     }
   }
   return indexList;
@@ -1125,6 +1134,56 @@ bool MatrixWorkspace::isCommonBins() const {
   return m_isCommonBinsFlag;
 }
 
+/**
+ * Make the spectra with equal X values share a single copy of them. Arrays
+ * are compared by content, so the copies left behind by algorithms setting
+ * the X values of each spectrum separately are released. If a single array
+ * remains the common bins flag is set without a further check.
+ * @return the number of distinct X arrays left in the workspace
+ */
+size_t MatrixWorkspace::shareEqualX() {
+  const size_t numHist = this->getNumberHistograms();
+  // Spectra already sharing an array are usually neighbours, so remember the
+  // array of the previous spectrum and the one it was replaced with.
+  const HistogramData::HistogramX *previous = nullptr;
+  size_t previousShared = 0;
+  std::unordered_multimap<size_t, size_t> sharedByHash;
+  for (size_t i = 0; i < numHist; ++i) {
+    const auto &xi = x(i);
+    if (&xi == previous) {
+      if (&x(previousShared) != &xi)
+        setSharedX(i, sharedX(previousShared));
+      continue;
+    }
+    previous = &xi;
+    const size_t hash = boost::hash_range(xi.cbegin(), xi.cend());
+    const auto candidates = sharedByHash.equal_range(hash);
+    auto match = std::find_if(candidates.first, candidates.second,
+                              [this, &xi](const auto &candidate) {
+                                const auto &other = x(candidate.second);
+                                return other.size() == xi.size() &&
+                                       std::equal(xi.cbegin(), xi.cend(),
+                                                  other.cbegin());
+                              });
+    if (match == candidates.second) {
+      sharedByHash.emplace(hash, i);
+      previousShared = i;
+    } else {
+      previousShared = match->second;
+      if (&x(previousShared) != &xi)
+        setSharedX(i, sharedX(previousShared));
+    }
+  }
+
+  const size_t numShared = sharedByHash.size();
+  if (numShared == 1) {
+    std::lock_guard<std::mutex> lock{m_isCommonBinsMutex};
+    m_isCommonBinsFlag = true;
+    m_isCommonBinsFlagValid.store(true);
+  }
+  return numShared;
+}
+
 /** Called by the algorithm MaskBins to mask a single bin for the first time,
  * algorithms that later propagate the
  *  the mask from an input to the output should call flagMasked() instead. Here
@@ -11,6 +11,7 @@
 
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/MultiFileValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Property.h"
 #include "MantidKernel/PropertyHelper.h"
 #include "MantidKernel/System.h"
@@ -21,6 +22,7 @@
 #include <boost/regex.hpp>
 
 #include <cctype>
+#include <exception>
 #include <functional>
 #include <numeric>
 
@@ -361,83 +363,37 @@ MultipleFileProperty::setValueAsMultipleFiles(const std::string &propValue) {
 
   // Cycle through each vector of unresolvedFileNames in allUnresolvedFileNames.
   // Remember, each vector contains files that are to be added together.
-  for (const auto &unresolvedFileNames : allUnresolvedFileNames) {
+  std::vector<std::pair<size_t, size_t>> positions;
+  for (size_t row = 0; row < allUnresolvedFileNames.size(); ++row) {
+    const auto &unresolvedFileNames = allUnresolvedFileNames[row];
     // Check for the existance of wild cards. (Instead of iterating over all the
     // filenames just join them together and search for "*" in the result.)
     if (std::string::npos !=
         boost::algorithm::join(unresolvedFileNames, "").find("*"))
       return "Searching for files by wildcards is not currently supported.";
 
-    std::vector<std::string> fullFileNames;
-
-    for (const auto &unresolvedFileName : unresolvedFileNames) {
-      bool useDefaultExt;
-
-      try {
-        // Check for an extension.
-        Poco::Path path(unresolvedFileName);
-
-        useDefaultExt = path.getExtension().empty();
-      } catch (Poco::Exception &) {
-        // Just shove the problematic filename straight into FileProperty and
-        // see if we have any luck.
-        useDefaultExt = false;
-      }
-
-      std::string fullyResolvedFile;
-
-      if (!useDefaultExt) {
-        FileProperty slaveFileProp("Slave", "", FileProperty::Load, m_exts,
-                                   Direction::Input);
-        std::string error = slaveFileProp.setValue(unresolvedFileName);
-
-        // If an error was returned then pass it along.
-        if (!error.empty()) {
-          throw std::runtime_error(error);
-        }
-
-        fullyResolvedFile = slaveFileProp();
-      } else {
-        // If a default ext has been specified/found, then use it.
-        if (!defaultExt.empty()) {
-          fullyResolvedFile = FileFinder::Instance().findRun(
-              unresolvedFileName, std::vector<std::string>(1, defaultExt));
-        } else {
-          fullyResolvedFile =
-              FileFinder::Instance().findRun(unresolvedFileName, m_exts);
-        }
-        if (fullyResolvedFile.empty()) {
-          bool doThrow = false;
-          if (m_allowEmptyTokens) {
-            try {
-              const int unresolvedInt = std::stoi(unresolvedFileName);
-              if (unresolvedInt != 0) {
-                doThrow = true;
-              }
-            } catch (std::invalid_argument &) {
-              doThrow = true;
-            }
-          } else {
-            doThrow = true;
-          }
-          if (doThrow) {
-            throw std::runtime_error(
-                "Unable to find file matching the string \"" +
-                unresolvedFileName +
-                "\", even after appending suggested file extensions.");
-          } else {
-            // if the fullyResolvedFile is empty, it means it failed to find the
-            // file so keep the unresolvedFileName as a hint to be displayed
-            // later on in the error message
-            fullyResolvedFile = unresolvedFileName;
-          }
-        }
-      }
+    allFullFileNames.emplace_back(unresolvedFileNames.size());
+    for (size_t column = 0; column < unresolvedFileNames.size(); ++column)
+      positions.emplace_back(row, column);
+  }
 
-      // Append the file name to result.
-      fullFileNames.push_back(std::move(fullyResolvedFile));
+  // Searching the data directories and archives for a file is bound by the
+  // latency of the storage, so the files are searched for in parallel. The
+  // first error in the order of the files is reported.
+  std::vector<std::exception_ptr> errors(positions.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(positions.size()); ++i) {
+    const auto &position = positions[i];
+    try {
+      allFullFileNames[position.first][position.second] = resolveFileName(
+          allUnresolvedFileNames[position.first][position.second], defaultExt);
+    } catch (...) {
+      errors[i] = std::current_exception();
     }
-    allFullFileNames.push_back(std::move(fullFileNames));
+  }
+  for (const auto &error : errors) {
+    if (error)
+      std::rethrow_exception(error);
   }
 
   // Now re-set the value using the full paths found.
@@ -451,5 +407,82 @@ MultipleFileProperty::setValueAsMultipleFiles(const std::string &propValue) {
   return SUCCESS;
 }
 
+/**
+ * Find the full path of a file
+ * @param unresolvedFileName :: The name of the file as given, or a run
+ * @param defaultExt :: The extension to look for if the name has none, or
+ * empty to use the allowed extensions
+ * @return The full path of the file. When empty tokens are allowed, a missing
+ * zero run is returned as given
+ * @throws std::runtime_error if the file cannot be found
+ */
+std::string
+MultipleFileProperty::resolveFileName(const std::string &unresolvedFileName,
+                                      const std::string &defaultExt) const {
+  bool useDefaultExt;
+
+  try {
+    // Check for an extension.
+    Poco::Path path(unresolvedFileName);
+
+    useDefaultExt = path.getExtension().empty();
+  } catch (Poco::Exception &) {
+    // Just shove the problematic filename straight into FileProperty and
+    // see if we have any luck.
+    useDefaultExt = false;
+  }
+
+  std::string fullyResolvedFile;
+
+  if (!useDefaultExt) {
+    FileProperty slaveFileProp("Slave", "", FileProperty::Load, m_exts,
+                               Direction::Input);
+    std::string error = slaveFileProp.setValue(unresolvedFileName);
+
+    // If an error was returned then pass it along.
+    if (!error.empty()) {
+      throw std::runtime_error(error);
+    }
+
+    fullyResolvedFile = slaveFileProp();
+  } else {
+    // If a default ext has been specified/found, then use it.
+    if (!defaultExt.empty()) {
+      fullyResolvedFile = FileFinder::Instance().findRun(
+          unresolvedFileName, std::vector<std::string>(1, defaultExt));
+    } else {
+      fullyResolvedFile =
+          FileFinder::Instance().findRun(unresolvedFileName, m_exts);
+    }
+    if (fullyResolvedFile.empty()) {
+      bool doThrow = false;
+      if (m_allowEmptyTokens) {
+        try {
+          const int unresolvedInt = std::stoi(unresolvedFileName);
+          if (unresolvedInt != 0) {
+            doThrow = true;
+          }
+        } catch (std::invalid_argument &) {
+          doThrow = true;
+        }
+      } else {
+        doThrow = true;
+      }
+      if (doThrow) {
+        throw std::runtime_error(
+            "Unable to find file matching the string \"" +
+            unresolvedFileName +
+            "\", even after appending suggested file extensions.");
+      } else {
+        // if the fullyResolvedFile is empty, it means it failed to find the
+        // file so keep the unresolvedFileName as a hint to be displayed
+        // later on in the error message
+        fullyResolvedFile = unresolvedFileName;
+      }
+    }
+  }
+  return fullyResolvedFile;
+}
+
 } // namespace API
 } // namespace Mantid
@@ -0,0 +1,102 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/PluginManifest.h"
+#include "MantidKernel/Logger.h"
+
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+namespace Mantid {
+namespace API {
+namespace {
+/// static logger
+Kernel::Logger g_log("PluginManifest");
+} // namespace
+
+/**
+ * Reads the manifest from a file. A missing file lists no libraries.
+ * @param filename The path to the manifest
+ */
+PluginManifest::PluginManifest(std::string filename)
+    : m_filename(std::move(filename)), m_libraries(), m_updated(false) {
+  std::ifstream file(m_filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream fields(line);
+    std::string library;
+    Library listed;
+    if (!(fields >> library >> listed.modified))
+      continue;
+    std::string entry;
+    while (fields >> entry)
+      listed.entries.emplace_back(entry);
+    m_libraries[library] = std::move(listed);
+  }
+}
+
+/**
+ * @param library The filename of the library, i.e. no directory
+ * @param modified The modification time of the library
+ * @returns True if the library is listed and has not been modified since
+ */
+bool PluginManifest::isCurrent(const std::string &library,
+                               int64_t modified) const {
+  const auto listed = m_libraries.find(library);
+  return listed != m_libraries.end() && listed->second.modified == modified;
+}
+
+/**
+ * @param library The filename of the library, i.e. no directory
+ * @returns The entries listed for the library, empty if it is not listed
+ */
+std::vector<std::string>
+PluginManifest::entries(const std::string &library) const {
+  const auto listed = m_libraries.find(library);
+  if (listed == m_libraries.end())
+    return {};
+  return listed->second.entries;
+}
+
+/**
+ * Lists a library, e.g. after opening it because it was missing from the
+ * manifest or modified since it was listed.
+ * @param library The filename of the library, i.e. no directory
+ * @param modified The modification time of the library
+ * @param entries The entries the library registered
+ */
+void PluginManifest::update(const std::string &library, int64_t modified,
+                            std::vector<std::string> entries) {
+  auto &listed = m_libraries[library];
+  listed.modified = modified;
+  listed.entries = std::move(entries);
+  m_updated = true;
+}
+
+/**
+ * Rewrites the file of the manifest, if a library has been updated since it
+ * was read.
+ */
+void PluginManifest::save() {
+  if (!m_updated)
+    return;
+  std::ofstream file(m_filename);
+  if (!file) {
+    g_log.warning("Unable to write the plugin manifest '" + m_filename + "'");
+    return;
+  }
+  for (const auto &library : m_libraries) {
+    file << library.first << ' ' << library.second.modified;
+    for (const auto &entry : library.second.entries)
+      file << ' ' << entry;
+    file << '\n';
+  }
+  m_updated = false;
+}
+
+} // namespace API
+} // namespace Mantid
@@ -15,11 +15,26 @@
 #include "MantidTypes/SpectrumDefinition.h"
 
 #include <algorithm>
+#include <array>
 #include <boost/make_shared.hpp>
+#include <limits>
 
 namespace Mantid {
 namespace API {
 
+/// Values of all spectra computed by cachedValues(), and the geometry they were
+/// computed for.
+struct SpectrumInfo::GeometryCache {
+  size_t positionsVersion;
+  Kernel::V3D sourcePosition;
+  Kernel::V3D samplePosition;
+  /// Values, indexed by CachedValue. Empty if not computed yet.
+  std::array<std::vector<double>, 3> values;
+  /// Flags for values to compute again. A vector of char, such that the flags
+  /// of different spectra can be set from different threads.
+  std::array<std::vector<char>, 3> stale;
+};
+
 SpectrumInfo::SpectrumInfo(const Beamline::SpectrumInfo &spectrumInfo,
                            const ExperimentInfo &experimentInfo,
                            Geometry::DetectorInfo &detectorInfo)
@@ -27,7 +42,7 @@ SpectrumInfo::SpectrumInfo(const Beamline::SpectrumInfo &spectrumInfo,
       m_spectrumInfo(spectrumInfo), m_lastDetector(PARALLEL_GET_MAX_THREADS),
       m_lastIndex(PARALLEL_GET_MAX_THREADS, -1) {}
 
-// Defined as default in source for forward declaration with std::unique_ptr.
+// Defined as default in source for forward declarations with std::unique_ptr.
 SpectrumInfo::~SpectrumInfo() = default;
 
 /// Returns the size of the SpectrumInfo, i.e., the number of spectra.
@@ -133,6 +148,33 @@ bool SpectrumInfo::hasUniqueDetector(const size_t index) const {
   return spectrumDefinition(index).size() == 1;
 }
 
+/** Returns L2 of all spectra, as computed by l2(), or NaN for spectra without
+ * detectors.
+ *
+ * The values are computed on first use and kept until detectors, source or
+ * sample move or the detectors of a spectrum change. Such changes invalidate
+ * the returned reference, so obtain it once rather than for every spectrum.
+ */
+const std::vector<double> &SpectrumInfo::l2s() const {
+  return cachedValues(CachedValue::L2);
+}
+
+/** Returns 2 theta of all spectra in radians, as computed by twoTheta(), or NaN
+ * for monitors and spectra without detectors. See l2s() for the lifetime of
+ * the values.
+ */
+const std::vector<double> &SpectrumInfo::twoThetas() const {
+  return cachedValues(CachedValue::TwoTheta);
+}
+
+/** Returns the azimuthal angle of all spectra in radians, as computed by
+ * azimuthal(), or NaN for monitors and spectra without detectors. See l2s()
+ * for the lifetime of the values.
+ */
+const std::vector<double> &SpectrumInfo::azimuthals() const {
+  return cachedValues(CachedValue::Azimuthal);
+}
+
 /** Set the mask flag of the spectrum with given index. Not thread safe.
  *
  * Currently this simply sets the mask flags for the underlying detectors. */
@@ -202,6 +244,77 @@ SpectrumInfo::checkAndGetSpectrumDefinition(const size_t index) const {
   return spectrumDefinition(index);
 }
 
+/** Returns the cached values of all spectra, computing those that are missing
+ * or out of date.
+ *
+ * All values are computed again if any detector, the source or the sample has
+ * moved since they were computed. Values of spectra whose detectors have
+ * changed are flagged by invalidateCachedValues().
+ */
+const std::vector<double> &
+SpectrumInfo::cachedValues(const CachedValue value) const {
+  std::lock_guard<std::mutex> lock(m_geometryCacheMutex);
+  // Bring spectrum definitions up to date first, flagging the spectra whose
+  // detectors have changed.
+  for (size_t i = 0; i < size(); ++i)
+    m_experimentInfo.updateSpectrumDefinitionIfNecessary(i);
+
+  const auto version = m_detectorInfo.positionsVersion();
+  const auto source = sourcePosition();
+  const auto sample = samplePosition();
+  if (!m_geometryCache || m_geometryCache->positionsVersion != version ||
+      m_geometryCache->sourcePosition != source ||
+      m_geometryCache->samplePosition != sample) {
+    m_geometryCache = std::make_unique<GeometryCache>();
+    m_geometryCache->positionsVersion = version;
+    m_geometryCache->sourcePosition = source;
+    m_geometryCache->samplePosition = sample;
+  }
+
+  const auto valueIndex = static_cast<size_t>(value);
+  auto &values = m_geometryCache->values[valueIndex];
+  auto &stale = m_geometryCache->stale[valueIndex];
+  if (values.size() != size()) {
+    values.assign(size(), std::numeric_limits<double>::quiet_NaN());
+    stale.assign(size(), 1);
+  }
+  for (size_t i = 0; i < size(); ++i) {
+    if (stale[i] == 0)
+      continue;
+    values[i] = computeValue(value, i);
+    stale[i] = 0;
+  }
+  return values;
+}
+
+/// Returns a value of a spectrum for the cache, NaN where it is not defined.
+double SpectrumInfo::computeValue(const CachedValue value,
+                                  const size_t index) const {
+  const auto &specDef = spectrumDefinition(index);
+  if (specDef.size() == 0)
+    return std::numeric_limits<double>::quiet_NaN();
+  if (value == CachedValue::L2)
+    return l2(index);
+  // Angles are not defined for monitors
+  for (const auto &detIndex : specDef)
+    if (m_detectorInfo.isMonitor(detIndex))
+      return std::numeric_limits<double>::quiet_NaN();
+  if (value == CachedValue::TwoTheta)
+    return twoTheta(index);
+  return azimuthal(index);
+}
+
+/** Flags the cached values of a spectrum as out of date. Called when the
+ * detectors of the spectrum change. Thread safe for different indices.
+ */
+void SpectrumInfo::invalidateCachedValues(const size_t index) const {
+  if (!m_geometryCache)
+    return;
+  for (auto &stale : m_geometryCache->stale)
+    if (index < stale.size())
+      stale[index] = 1;
+}
+
 // Begin method for iterator
 SpectrumInfoIt SpectrumInfo::begin() { return SpectrumInfoIt(*this, 0); }
 
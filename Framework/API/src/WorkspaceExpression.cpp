@@ -0,0 +1,173 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/WorkspaceExpression.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace Mantid {
+namespace API {
+
+namespace {
+using Instruction = WorkspaceExpression::Instruction;
+using Operation = WorkspaceExpression::Operation;
+
+/** Recursive descent parser compiling an expression into the instructions
+ * of a stack machine, in reverse Polish order.
+ *   expression := term (('+' | '-') term)*
+ *   term := factor (('*' | '/') factor)*
+ *   factor := ('-' | '+') factor | number | name | '(' expression ')'
+ */
+class Parser {
+public:
+  Parser(const std::string &text, const std::vector<std::string> &names)
+      : m_text(text), m_names(names) {}
+
+  std::vector<Instruction> parse() {
+    expression();
+    skipSpaces();
+    if (m_position != m_text.size())
+      fail("unexpected '" + m_text.substr(m_position, 1) + "'");
+    if (m_program.empty())
+      fail("the expression is empty");
+    return m_program;
+  }
+
+private:
+  void expression() {
+    term();
+    while (true) {
+      const char next = peek();
+      if (next != '+' && next != '-')
+        return;
+      ++m_position;
+      term();
+      emit(next == '+' ? Operation::Add : Operation::Subtract);
+    }
+  }
+
+  void term() {
+    factor();
+    while (true) {
+      const char next = peek();
+      if (next != '*' && next != '/')
+        return;
+      ++m_position;
+      factor();
+      emit(next == '*' ? Operation::Multiply : Operation::Divide);
+    }
+  }
+
+  void factor() {
+    const char next = peek();
+    if (next == '-' || next == '+') {
+      ++m_position;
+      factor();
+      if (next == '-')
+        emit(Operation::Negate);
+    } else if (next == '(') {
+      ++m_position;
+      expression();
+      if (peek() != ')')
+        fail("missing ')'");
+      ++m_position;
+    } else if (std::isdigit(static_cast<unsigned char>(next)) || next == '.') {
+      const char *start = m_text.c_str() + m_position;
+      char *end = nullptr;
+      const double value = std::strtod(start, &end);
+      if (end == start)
+        fail("invalid number");
+      m_position += static_cast<size_t>(end - start);
+      m_program.push_back({Operation::Constant, 0, value});
+    } else if (std::isalpha(static_cast<unsigned char>(next)) || next == '_') {
+      const size_t start = m_position;
+      while (m_position < m_text.size() &&
+             (std::isalnum(static_cast<unsigned char>(m_text[m_position])) ||
+              m_text[m_position] == '_' || m_text[m_position] == '.'))
+        ++m_position;
+      const auto name = m_text.substr(start, m_position - start);
+      const auto found = std::find(m_names.begin(), m_names.end(), name);
+      if (found == m_names.end())
+        fail("'" + name + "' is not one of the InputWorkspaces");
+      m_program.push_back(
+          {Operation::Workspace,
+           static_cast<size_t>(std::distance(m_names.begin(), found)), 0.});
+    } else if (next == '\0') {
+      fail("unexpected end of the expression");
+    } else {
+      fail("unexpected '" + std::string(1, next) + "'");
+    }
+  }
+
+  /// @return the next character that is not a space, or 0 at the end
+  char peek() {
+    skipSpaces();
+    return m_position < m_text.size() ? m_text[m_position] : '\0';
+  }
+
+  void skipSpaces() {
+    while (m_position < m_text.size() &&
+           std::isspace(static_cast<unsigned char>(m_text[m_position])))
+      ++m_position;
+  }
+
+  void emit(const Operation operation) {
+    m_program.push_back({operation, 0, 0.});
+  }
+
+  void fail(const std::string &message) const {
+    throw std::invalid_argument("Invalid expression at position " +
+                                std::to_string(m_position) + ": " + message);
+  }
+
+  const std::string &m_text;
+  const std::vector<std::string> &m_names;
+  size_t m_position{0};
+  std::vector<Instruction> m_program;
+};
+} // namespace
+
+//----------------------------------------------------------------------------------------------
+/** Compile an expression into the instructions of a stack machine
+ * @param expression :: arithmetic expression of the workspaces and numbers
+ * @param workspaceNames :: names that may be used in the expression
+ * @return the instructions, in reverse Polish order
+ * @throws std::invalid_argument if the expression is not valid
+ */
+std::vector<WorkspaceExpression::Instruction>
+WorkspaceExpression::compile(const std::string &expression,
+                             const std::vector<std::string> &workspaceNames) {
+  return Parser(expression, workspaceNames).parse();
+}
+
+//----------------------------------------------------------------------------------------------
+/** @param program :: compiled instructions
+ * @return the largest number of values on the stack while running a program
+ */
+size_t
+WorkspaceExpression::stackDepth(const std::vector<Instruction> &program) {
+  size_t depth = 0;
+  size_t maxDepth = 0;
+  for (const auto &instruction : program) {
+    switch (instruction.operation) {
+    case Operation::Workspace:
+    case Operation::Constant:
+      maxDepth = std::max(maxDepth, ++depth);
+      break;
+    case Operation::Negate:
+      break;
+    default:
+      --depth;
+    }
+  }
+  return maxDepth;
+}
+
+} // namespace API
+} // namespace Mantid
@@ -9,17 +9,23 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/DetectorGroup.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
-// Nearest neighbours library
-#include "MantidKernel/ANN/ANN.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Timer.h"
 
+#include <algorithm>
+
 namespace Mantid {
 using namespace Geometry;
 namespace API {
 using Kernel::V3D;
 using Mantid::detid_t;
 
+namespace {
+V3D toV3D(const Eigen::Vector3d &point) {
+  return V3D(point[0], point[1], point[2]);
+}
+} // namespace
+
 /**
  * Constructor
  * @param nNeighbours :: Number of neighbours to use
@@ -36,11 +42,13 @@ WorkspaceNearestNeighbours::WorkspaceNearestNeighbours(
     : m_spectrumInfo(spectrumInfo),
       m_spectrumNumbers(std::move(spectrumNumbers)),
       m_noNeighbours(nNeighbours),
-      m_cutoff(std::numeric_limits<double>::lowest()), m_radius(0.),
+      m_cutoff(std::numeric_limits<double>::lowest()),
       m_bIgnoreMaskedDetectors(ignoreMaskedDetectors) {
   this->build(m_noNeighbours);
 }
 
+WorkspaceNearestNeighbours::~WorkspaceNearestNeighbours() = default;
+
 /**
  * Returns a map of the spectrum numbers to the distances for the nearest
  * neighbours.
@@ -80,22 +88,10 @@ WorkspaceNearestNeighbours::neighboursInRadius(const specnum_t spectrum,
       const_cast<WorkspaceNearestNeighbours *>(this)->build(eightNearest);
     }
     result = defaultNeighbours(spectrum);
-  } else if (radius > m_cutoff && m_radius != radius) {
-    // We might have to see how efficient this ends up being.
-    int neighbours = m_noNeighbours + 1;
-    while (true) {
-      try {
-        const_cast<WorkspaceNearestNeighbours *>(this)->build(neighbours);
-      } catch (std::invalid_argument &) {
-        break;
-      }
-      if (radius < m_cutoff)
-        break;
-      else
-        neighbours += 1;
-    }
+  } else if (radius > m_cutoff) {
+    // Some neighbours within the radius may not be in the graph
+    return treeNeighbours(spectrum, radius);
   }
-  m_radius = radius;
 
   std::map<detid_t, V3D> nearest = defaultNeighbours(spectrum);
   for (std::map<specnum_t, V3D>::const_iterator cit = nearest.begin();
@@ -128,9 +124,12 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
         "NearestNeighbours::build - Invalid number of neighbours");
   }
 
-  // Clear current
+  // Clear current. ANN shares one empty leaf between its trees and the
+  // destructor frees it, so the old tree must go before the new is made.
   m_graph.clear();
   m_specToVertex.clear();
+  m_points.clear();
+  m_searchTree.reset();
   m_noNeighbours = noNeighbours;
 
   BoundingBox bbox;
@@ -139,46 +138,32 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   const auto &firstDet = m_spectrumInfo.detector(indices.front());
   firstDet.getBoundingBox(bbox);
   m_scale = V3D(bbox.width());
-  ANNpointArray dataPoints = annAllocPts(nspectra, 3);
+  m_points.reserve(indices.size());
   MapIV pointNoToVertex;
 
   int pointNo = 0;
   for (const auto i : indices) {
     const specnum_t spectrum = m_spectrumNumbers[i];
     V3D pos = m_spectrumInfo.position(i) / m_scale;
-    dataPoints[pointNo][0] = pos.X();
-    dataPoints[pointNo][1] = pos.Y();
-    dataPoints[pointNo][2] = pos.Z();
+    m_points.emplace_back(pos.X(), pos.Y(), pos.Z());
     Vertex vertex = boost::add_vertex(spectrum, m_graph);
     pointNoToVertex[pointNo] = vertex;
     m_specToVertex[spectrum] = vertex;
     ++pointNo;
   }
 
-  auto annTree = std::make_unique<ANNkd_tree>(dataPoints, nspectra, 3);
+  m_searchTree = std::make_unique<Kernel::NearestNeighbours<3>>(m_points);
   pointNo = 0;
-  // Run the nearest neighbour search on each detector, reusing the arrays
-  // Set size initially to avoid array index error when testing in debug mode
-  std::vector<ANNidx> nnIndexList(m_noNeighbours);
-  std::vector<ANNdist> nnDistList(m_noNeighbours);
-
+  // Run the nearest neighbour search on each detector
   for (const auto idx : indices) {
-    ANNpoint scaledPos = dataPoints[pointNo];
-    annTree->annkSearch(scaledPos,      // Point to search nearest neighbours of
-                        m_noNeighbours, // Number of neighbours to find (8)
-                        nnIndexList.data(), // Index list of results
-                        nnDistList.data(), // List of distances to each of these
-                        0.0 // Error bound (?) is this the radius to search in?
-    );
+    const auto &scaledPos = m_points[pointNo];
+    const auto nearest = m_searchTree->findNearest(scaledPos, m_noNeighbours);
     // The distances that are returned are in our scaled coordinate
     // system. We store the real space ones.
-    const V3D realPos = V3D(scaledPos[0], scaledPos[1], scaledPos[2]) * m_scale;
-    for (int i = 0; i < m_noNeighbours; i++) {
-      ANNidx index = nnIndexList[i];
-      V3D neighbour = V3D(dataPoints[index][0], dataPoints[index][1],
-                          dataPoints[index][2]) *
-                      m_scale;
-      V3D distance = neighbour - realPos;
+    const V3D realPos = toV3D(scaledPos) * m_scale;
+    for (const auto &neighbour : nearest) {
+      const auto index = static_cast<int>(std::get<1>(neighbour));
+      V3D distance = toV3D(std::get<0>(neighbour)) * m_scale - realPos;
       double separation = distance.norm();
       boost::add_edge(m_specToVertex[m_spectrumNumbers[idx]], // from
                       pointNoToVertex[index],                 // to
@@ -189,8 +174,6 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
     }
     pointNo++;
   }
-  annDeallocPts(dataPoints);
-  annClose();
   pointNoToVertex.clear();
 
   m_vertexID = get(boost::vertex_name, m_graph);
@@ -228,6 +211,40 @@ WorkspaceNearestNeighbours::defaultNeighbours(const specnum_t spectrum) const {
 }
 
 /// Returns the list of valid spectrum indices
+/**
+ * Returns a map of the spectrum numbers to the distances for all the detectors
+ * within a radius of the detector specified in the argument.
+ * @param spectrum :: The spectrum number
+ * @param radius :: cut-off distance for the detectors to return
+ * @return map of spectrum number to distance
+ * @throw NotFoundError if spectrum is not recognised
+ */
+std::map<specnum_t, V3D>
+WorkspaceNearestNeighbours::treeNeighbours(const specnum_t spectrum,
+                                           const double radius) const {
+  auto vertex = m_specToVertex.find(spectrum);
+  if (vertex == m_specToVertex.end()) {
+    throw Mantid::Kernel::Exception::NotFoundError(
+        "NearestNeighbours: Unable to find spectrum in vertex map", spectrum);
+  }
+  // The vertices were added in the order of the points
+  const auto &scaledPos = m_points[vertex->second];
+  const V3D realPos = toV3D(scaledPos) * m_scale;
+  // The tree holds scaled positions so search the sphere that contains the
+  // one of the requested radius in real space
+  const double minScale = std::min({m_scale.X(), m_scale.Y(), m_scale.Z()});
+  std::map<specnum_t, V3D> result;
+  for (const auto &neighbour :
+       m_searchTree->findWithinRadius(scaledPos, radius / minScale)) {
+    const V3D distance = toV3D(std::get<0>(neighbour)) * m_scale - realPos;
+    if (distance.norm() <= radius) {
+      const auto nearest = static_cast<Vertex>(std::get<1>(neighbour));
+      result[specnum_t(m_vertexID[nearest])] = distance;
+    }
+  }
+  return result;
+}
+
 std::vector<size_t> WorkspaceNearestNeighbours::getSpectraDetectors() {
   std::vector<size_t> indices;
   const auto nSpec = m_spectrumNumbers.size();
@@ -0,0 +1,240 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_ALGORITHMRESULTCACHETEST_H_
+#define MANTID_API_ALGORITHMRESULTCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmResultCache.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/Sample.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidKernel/Material.h"
+#include "MantidKernel/NeutronAtom.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+#include "MantidTestHelpers/FakeObjects.h"
+
+using namespace Mantid::API;
+using namespace Mantid::Kernel;
+
+namespace {
+/// Scales the first value of its input and counts its executions
+class CountingAlgorithm : public Algorithm {
+public:
+  const std::string name() const override { return "CountingAlgorithm"; }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Tests"; }
+  const std::string summary() const override { return "Test summary"; }
+
+  void init() override {
+    declareProperty(std::make_unique<WorkspaceProperty<>>("InputWorkspace", "",
+                                                          Direction::Input));
+    declareProperty("Factor", 1.0);
+    declareProperty(std::make_unique<WorkspaceProperty<>>(
+        "OutputWorkspace", "", Direction::Output));
+    declareProperty("Total", 0.0, Direction::Output);
+  }
+
+  void exec() override {
+    ++executions;
+    MatrixWorkspace_sptr inputWS = getProperty("InputWorkspace");
+    const double factor = getProperty("Factor");
+    MatrixWorkspace_sptr outputWS = inputWS->clone();
+    outputWS->mutableY(0)[0] *= factor;
+    setProperty("OutputWorkspace", outputWS);
+    setProperty("Total", outputWS->y(0)[0]);
+  }
+
+  static int executions;
+};
+int CountingAlgorithm::executions = 0;
+
+/// Only uses the instrument of its input, according to the cache
+class InstrumentAlgorithm : public CountingAlgorithm {
+public:
+  const std::string name() const override { return "InstrumentAlgorithm"; }
+};
+} // namespace
+
+class AlgorithmResultCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created
+  // statically This means the constructor isn't called when running other
+  // tests
+  static AlgorithmResultCacheTest *createSuite() {
+    return new AlgorithmResultCacheTest();
+  }
+  static void destroySuite(AlgorithmResultCacheTest *suite) { delete suite; }
+
+  void setUp() override {
+    auto &cache = AlgorithmResultCache::Instance();
+    cache.setAlgorithms({"CountingAlgorithm", "InstrumentAlgorithm"});
+    cache.setMemoryLimit(100 * 1024 * 1024);
+    cache.setDirectory("", 0);
+    cache.clear();
+    CountingAlgorithm::executions = 0;
+  }
+
+  void tearDown() override {
+    auto &cache = AlgorithmResultCache::Instance();
+    cache.setAlgorithms({});
+    cache.clear();
+  }
+
+  void test_repeated_run_restores_the_result() {
+    auto ws = makeWorkspace(2.0);
+    MatrixWorkspace_sptr first = run(ws, 3.0);
+    MatrixWorkspace_sptr second = run(ws, 3.0);
+    TS_ASSERT_EQUALS(CountingAlgorithm::executions, 1);
+    TS_ASSERT_EQUALS(AlgorithmResultCache::Instance().size(), 1);
+    TS_ASSERT_DIFFERS(first, second);
+    TS_ASSERT_EQUALS(second->y(0)[0], 6.0);
+  }
+
+  void test_output_values_are_restored() {
+    auto ws = makeWorkspace(2.0);
+    run(ws, 3.0);
+    CountingAlgorithm alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", ws);
+    alg.setProperty("Factor", 3.0);
+    alg.setPropertyValue("OutputWorkspace", "out");
+    alg.execute();
+    TS_ASSERT_EQUALS(CountingAlgorithm::executions, 1);
+    const double total = alg.getProperty("Total");
+    TS_ASSERT_EQUALS(total, 6.0);
+  }
+
+  void test_changed_property_runs_again() {
+    auto ws = makeWorkspace(2.0);
+    run(ws, 3.0);
+    MatrixWorkspace_sptr second = run(ws, 4.0);
+    TS_ASSERT_EQUALS(CountingAlgorithm::executions, 2);
+    TS_ASSERT_EQUALS(second->y(0)[0], 8.0);
+  }
+
+  void test_changed_input_content_runs_again() {
+    auto ws = makeWorkspace(2.0);
+    run(ws, 3.0);
+    ws->mutableY(0)[0] = 5.0;
+    MatrixWorkspace_sptr second = run(ws, 3.0);
+    TS_ASSERT_EQUALS(CountingAlgorithm::executions, 2);
+    TS_ASSERT_EQUALS(second->y(0)[0], 15.0);
+  }
+
+  void test_input_used_only_for_its_instrument_is_not_hashed() {
+    AlgorithmResultCache::Instance().setUsesOnlyInstrument(
+        "InstrumentAlgorithm", "InputWorkspace");
+    auto ws = makeWorkspace(2.0);
+    run<InstrumentAlgorithm>(ws, 3.0);
+    ws->mutableY(0)[0] = 5.0;
+    MatrixWorkspace_sptr second = run<InstrumentAlgorithm>(ws, 3.0);
+    TS_ASSERT_EQUALS(CountingAlgorithm::executions, 1);
+    TS_ASSERT_EQUALS(second->y(0)[0], 6.0);
+  }
+
+  void test_disabled_algorithm_is_not_cached() {
+    AlgorithmResultCache::Instance().setAlgorithms({});
+    auto ws = makeWorkspace(2.0);
+    run(ws, 3.0);
+    run(ws, 3.0);
+    TS_ASSERT_EQUALS(CountingAlgorithm::executions, 2);
+    TS_ASSERT_EQUALS(AlgorithmResultCache::Instance().size(), 0);
+  }
+
+  void test_memory_limit_drops_results() {
+    AlgorithmResultCache::Instance().setMemoryLimit(0);
+    auto ws = makeWorkspace(2.0);
+    run(ws, 3.0);
+    run(ws, 3.0);
+    TS_ASSERT_EQUALS(CountingAlgorithm::executions, 2);
+    TS_ASSERT_EQUALS(AlgorithmResultCache::Instance().memorySize(), 0);
+  }
+
+  void test_contentHash_depends_on_data() {
+    auto ws1 = makeWorkspace(2.0);
+    auto ws2 = makeWorkspace(2.0);
+    std::string hash1, hash2;
+    TS_ASSERT(AlgorithmResultCacheImpl::contentHash(*ws1, hash1));
+    TS_ASSERT(AlgorithmResultCacheImpl::contentHash(*ws2, hash2));
+    TS_ASSERT_EQUALS(hash1, hash2);
+    ws2->mutableE(1)[2] = 7.0;
+    TS_ASSERT(AlgorithmResultCacheImpl::contentHash(*ws2, hash2));
+    TS_ASSERT_DIFFERS(hash1, hash2);
+  }
+
+  void test_contentHash_depends_on_the_experiment() {
+    auto ws = makeWorkspace(2.0);
+    ws->setInstrument(
+        ComponentCreationHelper::createTestInstrumentCylindrical(1));
+    std::string previous, hash;
+    TS_ASSERT(AlgorithmResultCacheImpl::contentHash(*ws, previous));
+    const auto changed = [&]() {
+      TS_ASSERT(AlgorithmResultCacheImpl::contentHash(*ws, hash));
+      const bool differs = hash != previous;
+      previous = hash;
+      return differs;
+    };
+
+    auto &componentInfo = ws->mutableComponentInfo();
+    componentInfo.setPosition(componentInfo.source(),
+                              Mantid::Kernel::V3D(0., 0., -12.));
+    TSM_ASSERT("Source position", changed());
+    componentInfo.setRotation(
+        componentInfo.sample(),
+        Mantid::Kernel::Quat(30., Mantid::Kernel::V3D(0., 1., 0.)));
+    TSM_ASSERT("Sample rotation", changed());
+
+    ws->instrumentParameters().addDouble(
+        ws->getInstrument()->getComponentID(), "efixed", 3.7);
+    TSM_ASSERT("Instrument parameter", changed());
+
+    ws->mutableRun().mutableGoniometer().makeUniversalGoniometer();
+    ws->mutableRun().mutableGoniometer().setRotationAngle(0, 30.);
+    TSM_ASSERT("Goniometer", changed());
+
+    ws->mutableSample().setShape(ComponentCreationHelper::createSphere(0.01));
+    TSM_ASSERT("Sample shape", changed());
+    auto shape = ComponentCreationHelper::createSphere(0.01);
+    shape->setMaterial(Material(
+        "V", Mantid::PhysicalConstants::getNeutronAtom(23, 0), 0.072));
+    ws->mutableSample().setShape(shape);
+    TSM_ASSERT("Sample material", changed());
+    TSM_ASSERT("Same experiment", !changed());
+  }
+
+private:
+  MatrixWorkspace_sptr makeWorkspace(const double value) {
+    auto ws = boost::make_shared<WorkspaceTester>();
+    ws->initialize(2, 4, 3);
+    ws->mutableY(0)[0] = value;
+    return ws;
+  }
+
+  template <typename AlgorithmType = CountingAlgorithm>
+  MatrixWorkspace_sptr run(const MatrixWorkspace_sptr &ws,
+                           const double factor) {
+    AlgorithmType alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", ws);
+    alg.setProperty("Factor", factor);
+    alg.setPropertyValue("OutputWorkspace", "out");
+    alg.execute();
+    TS_ASSERT(alg.isExecuted());
+    return alg.getProperty("OutputWorkspace");
+  }
+};
+
+#endif /* MANTID_API_ALGORITHMRESULTCACHETEST_H_ */
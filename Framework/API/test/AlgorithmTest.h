@@ -340,6 +340,44 @@ public:
     TS_ASSERT(alg.isExecuted());
   }
 
+  void test_fastChildExecution_validatesAndReruns() {
+    AlgorithmWithValidateInputs alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.enableHistoryRecordingForChild(true);
+    alg.enableFastChildExecution(true);
+    TS_ASSERT(alg.isFastChildExecution());
+    alg.setProperty("PropertyA", 12);
+    alg.setProperty("PropertyB", 5);
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &);
+    TS_ASSERT(!alg.isExecuted());
+
+    // The same instance can be executed again with new property values
+    for (int b = 12; b < 15; ++b) {
+      alg.setProperty("PropertyB", b);
+      TS_ASSERT_THROWS_NOTHING(alg.execute());
+      TS_ASSERT(alg.isExecuted());
+    }
+  }
+
+  void test_fastChildExecution_doesNotRecordHistory() {
+    auto ws = boost::make_shared<WorkspaceTester>();
+    ws->initialize(10, 10, 10);
+    StubbedWorkspaceAlgorithm alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.enableHistoryRecordingForChild(true);
+    alg.enableFastChildExecution(true);
+    alg.setProperty("InputWorkspace1", ws);
+    alg.setPropertyValue("OutputWorkspace1", "__fast_child_output");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    Workspace_sptr out = alg.getProperty("OutputWorkspace1");
+    TS_ASSERT(out);
+    if (out)
+      TS_ASSERT_EQUALS(out->getHistory().size(), 0);
+  }
+
   void test_WorkspaceMethodFunctionsReturnEmptyByDefault() {
     StubbedWorkspaceAlgorithm alg;
 
@@ -0,0 +1,120 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_FILESEARCHCACHETEST_H_
+#define MANTID_API_FILESEARCHCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/FileSearchCache.h"
+#include "MantidKernel/ConfigService.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <Poco/TemporaryFile.h>
+
+#include <fstream>
+
+using Mantid::API::FileSearchCache;
+using Mantid::Kernel::ConfigService;
+
+class FileSearchCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FileSearchCacheTest *createSuite() {
+    return new FileSearchCacheTest();
+  }
+  static void destroySuite(FileSearchCacheTest *suite) { delete suite; }
+
+  void setUp() override {
+    auto &config = ConfigService::Instance();
+    m_directoryTTL = config.getString("datasearch.directorycache.ttl");
+    m_archiveTTL = config.getString("datasearch.archivecache.ttl");
+    config.setString("datasearch.directorycache.ttl", "60");
+    config.setString("datasearch.archivecache.ttl", "60");
+    m_directory = Poco::TemporaryFile::tempName();
+    Poco::File(m_directory).createDirectories();
+  }
+
+  void tearDown() override {
+    auto &config = ConfigService::Instance();
+    config.setString("datasearch.directorycache.ttl", m_directoryTTL);
+    config.setString("datasearch.archivecache.ttl", m_archiveTTL);
+    Poco::File(m_directory).remove(true);
+  }
+
+  void test_directory_listing_finds_files() {
+    createFile("MUSR00015189.nxs");
+    FileSearchCache cache("");
+    TS_ASSERT(cache.directoryContains(m_directory, "MUSR00015189.nxs"))
+    TS_ASSERT(!cache.directoryContains(m_directory, "MUSR00015190.nxs"))
+    TS_ASSERT(!cache.directoryContains(m_directory + "/missing", "a.nxs"))
+  }
+
+  void test_removed_files_are_not_found_from_the_listing() {
+    const auto path = createFile("MUSR00015189.nxs");
+    FileSearchCache cache("");
+    TS_ASSERT(cache.directoryContains(m_directory, "MUSR00015189.nxs"))
+    Poco::File(path).remove();
+    TS_ASSERT(!cache.directoryContains(m_directory, "MUSR00015189.nxs"))
+  }
+
+  void test_new_files_are_found_after_clear() {
+    FileSearchCache cache("");
+    TS_ASSERT(!cache.directoryContains(m_directory, "MUSR00015189.nxs"))
+    createFile("MUSR00015189.nxs");
+    TS_ASSERT(!cache.directoryContains(m_directory, "MUSR00015189.nxs"))
+    cache.clear();
+    TS_ASSERT(cache.directoryContains(m_directory, "MUSR00015189.nxs"))
+  }
+
+  void test_zero_ttl_checks_every_file() {
+    ConfigService::Instance().setString("datasearch.directorycache.ttl", "0");
+    FileSearchCache cache("");
+    TS_ASSERT(!cache.directoryContains(m_directory, "MUSR00015189.nxs"))
+    createFile("MUSR00015189.nxs");
+    TS_ASSERT(cache.directoryContains(m_directory, "MUSR00015189.nxs"))
+  }
+
+  void test_archive_paths_are_kept_across_sessions() {
+    const auto path = createFile("MUSR00015189.nxs");
+    const auto cacheFile = Poco::Path(m_directory, "archive.cache").toString();
+    {
+      FileSearchCache cache(cacheFile);
+      TS_ASSERT_EQUALS(cache.archivePath("MUSR00015189"), "");
+      cache.addArchivePath("MUSR00015189", path);
+      TS_ASSERT_EQUALS(cache.archivePath("MUSR00015189"), path);
+    }
+    FileSearchCache cache(cacheFile);
+    TS_ASSERT_EQUALS(cache.archivePath("MUSR00015189"), path);
+    cache.clear();
+    TS_ASSERT_EQUALS(FileSearchCache(cacheFile).archivePath("MUSR00015189"),
+                     "");
+  }
+
+  void test_archive_paths_that_no_longer_exist_are_dropped() {
+    const auto path = createFile("MUSR00015189.nxs");
+    FileSearchCache cache("");
+    cache.addArchivePath("MUSR00015189", path);
+    Poco::File(path).remove();
+    TS_ASSERT_EQUALS(cache.archivePath("MUSR00015189"), "");
+  }
+
+private:
+  std::string createFile(const std::string &name) {
+    const auto path = Poco::Path(m_directory, name).toString();
+    std::ofstream file(path);
+    file << "data";
+    return path;
+  }
+
+  std::string m_directory;
+  std::string m_directoryTTL;
+  std::string m_archiveTTL;
+};
+
+#endif /* MANTID_API_FILESEARCHCACHETEST_H_ */
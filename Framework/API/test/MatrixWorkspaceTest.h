@@ -491,6 +491,31 @@ public:
     TS_ASSERT_EQUALS(ws.isCommonBins(), false);
   }
 
+  void testShareEqualX() {
+    WorkspaceTester ws;
+    ws.initialize(10, 10, 10);
+    // Writing to the X values detaches every spectrum
+    for (size_t i = 0; i < ws.getNumberHistograms(); ++i) {
+      ws.mutableX(i)[0] = i % 2 == 0 ? 1. : 2.;
+    }
+    TS_ASSERT_DIFFERS(&ws.x(0), &ws.x(2));
+    TS_ASSERT_EQUALS(ws.shareEqualX(), 2);
+    for (size_t i = 0; i < ws.getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(&ws.x(i), &ws.x(i % 2));
+      TS_ASSERT_EQUALS(ws.x(i)[0], i % 2 == 0 ? 1. : 2.);
+    }
+    TS_ASSERT_EQUALS(ws.isCommonBins(), false);
+
+    for (size_t i = 1; i < ws.getNumberHistograms(); i += 2) {
+      ws.mutableX(i)[0] = 1.;
+    }
+    TS_ASSERT_EQUALS(ws.shareEqualX(), 1);
+    for (size_t i = 0; i < ws.getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(&ws.x(i), &ws.x(0));
+    }
+    TS_ASSERT(ws.isCommonBins());
+  }
+
   void testIsCommonLogAxis() {
     WorkspaceTester ws;
     ws.initialize(10, 10, 10);
@@ -0,0 +1,96 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_PLUGINMANIFESTTEST_H_
+#define MANTID_API_PLUGINMANIFESTTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/PluginManifest.h"
+
+#include <Poco/File.h>
+#include <Poco/TemporaryFile.h>
+
+using Mantid::API::PluginManifest;
+
+class PluginManifestTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static PluginManifestTest *createSuite() { return new PluginManifestTest(); }
+  static void destroySuite(PluginManifestTest *suite) { delete suite; }
+
+  void setUp() override { m_filename = Poco::TemporaryFile::tempName(); }
+
+  void tearDown() override {
+    Poco::File file(m_filename);
+    if (file.exists())
+      file.remove();
+  }
+
+  void test_missing_manifest_lists_nothing() {
+    PluginManifest manifest(m_filename);
+    TS_ASSERT(!manifest.isCurrent("libMantidAlgorithms.so", 0))
+    TS_ASSERT(manifest.entries("libMantidAlgorithms.so").empty())
+  }
+
+  void test_manifest_is_not_written_unless_updated() {
+    PluginManifest manifest(m_filename);
+    manifest.save();
+    TS_ASSERT(!Poco::File(m_filename).exists())
+  }
+
+  void test_saved_manifest_is_read_back() {
+    const std::vector<std::string> algorithms{"Algorithm:Rebin|1",
+                                              "Loader:LoadRaw"};
+    const std::vector<std::string> functions{"Function:Gaussian"};
+    {
+      PluginManifest manifest(m_filename);
+      manifest.update("libMantidAlgorithms.so", 10, algorithms);
+      manifest.update("libMantidCurveFitting.so", 20, functions);
+      manifest.save();
+    }
+
+    PluginManifest manifest(m_filename);
+    TS_ASSERT(manifest.isCurrent("libMantidAlgorithms.so", 10))
+    TS_ASSERT(manifest.isCurrent("libMantidCurveFitting.so", 20))
+    TS_ASSERT(!manifest.isCurrent("libMantidAlgorithms.so", 11))
+    TS_ASSERT(!manifest.isCurrent("libMantidMDAlgorithms.so", 10))
+    TS_ASSERT_EQUALS(manifest.entries("libMantidAlgorithms.so"), algorithms)
+    TS_ASSERT_EQUALS(manifest.entries("libMantidCurveFitting.so"), functions)
+  }
+
+  void test_updating_a_modified_library_rewrites_its_entries() {
+    {
+      PluginManifest manifest(m_filename);
+      manifest.update("libMantidAlgorithms.so", 10, {"Algorithm:Rebin|1"});
+      manifest.update("libMantidCurveFitting.so", 20, {"Function:Gaussian"});
+      manifest.save();
+    }
+    {
+      // A new version of an algorithm is listed next to the first one
+      PluginManifest manifest(m_filename);
+      manifest.update("libMantidAlgorithms.so", 30,
+                      {"Algorithm:Rebin|1", "Algorithm:Rebin|2"});
+      manifest.save();
+    }
+
+    PluginManifest manifest(m_filename);
+    TS_ASSERT(!manifest.isCurrent("libMantidAlgorithms.so", 10))
+    TS_ASSERT(manifest.isCurrent("libMantidAlgorithms.so", 30))
+    TS_ASSERT_EQUALS(manifest.entries("libMantidAlgorithms.so"),
+                     std::vector<std::string>({"Algorithm:Rebin|1",
+                                               "Algorithm:Rebin|2"}))
+    TS_ASSERT(manifest.isCurrent("libMantidCurveFitting.so", 20))
+    TS_ASSERT_EQUALS(manifest.entries("libMantidCurveFitting.so"),
+                     std::vector<std::string>{"Function:Gaussian"})
+  }
+
+private:
+  std::string m_filename;
+};
+
+#endif /* MANTID_API_PLUGINMANIFESTTEST_H_ */
@@ -13,6 +13,7 @@
 #include "MantidAPI/SpectrumInfoIterator.h"
 #include "MantidBeamline/SpectrumInfo.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/Detector.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidKernel/MultiThreaded.h"
@@ -20,6 +21,8 @@
 #include "MantidTestHelpers/FakeObjects.h"
 #include "MantidTestHelpers/InstrumentCreationHelper.h"
 
+#include <cmath>
+
 using namespace Mantid;
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
@@ -292,6 +295,73 @@ public:
     detectorInfo.setPosition(1, oldPos);
   }
 
+  void test_cached_values() {
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const auto &l2s = spectrumInfo.l2s();
+    const auto &twoThetas = spectrumInfo.twoThetas();
+    const auto &azimuthals = spectrumInfo.azimuthals();
+    TS_ASSERT_EQUALS(l2s.size(), 5);
+    TS_ASSERT_EQUALS(twoThetas.size(), 5);
+    TS_ASSERT_EQUALS(azimuthals.size(), 5);
+    for (size_t i = 0; i < 5; ++i)
+      TS_ASSERT_EQUALS(l2s[i], spectrumInfo.l2(i));
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_EQUALS(twoThetas[i], spectrumInfo.twoTheta(i));
+      TS_ASSERT_EQUALS(azimuthals[i], spectrumInfo.azimuthal(i));
+    }
+    // Monitors
+    for (size_t i = 3; i < 5; ++i) {
+      TS_ASSERT(std::isnan(twoThetas[i]));
+      TS_ASSERT(std::isnan(azimuthals[i]));
+    }
+  }
+
+  void test_grouped_cached_values() {
+    const auto &spectrumInfo = m_grouped.spectrumInfo();
+    const auto &l2s = spectrumInfo.l2s();
+    const auto &twoThetas = spectrumInfo.twoThetas();
+    TS_ASSERT_EQUALS(l2s[GroupOfDets2And3], spectrumInfo.l2(GroupOfDets2And3));
+    TS_ASSERT_EQUALS(twoThetas[GroupOfDets2And3],
+                     spectrumInfo.twoTheta(GroupOfDets2And3));
+    TS_ASSERT_EQUALS(twoThetas[GroupOfDets1And2],
+                     spectrumInfo.twoTheta(GroupOfDets1And2));
+    // Groups including monitors
+    TS_ASSERT(std::isnan(twoThetas[GroupOfDets1And4]));
+    TS_ASSERT(std::isnan(twoThetas[GroupOfDets4And5]));
+    TS_ASSERT(std::isnan(twoThetas[GroupOfAllDets]));
+  }
+
+  void test_cached_values_track_detector_moves() {
+    auto ws = makeDefaultWorkspace();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[1], 0.0, 1e-6);
+    TS_ASSERT_DELTA(spectrumInfo.l2s()[1], 5.0, 1e-6);
+    ws.mutableDetectorInfo().setPosition(1, V3D(0.0, -0.1, 5.0));
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[1], 0.0199973, 1e-6);
+    TS_ASSERT_EQUALS(spectrumInfo.l2s()[1], spectrumInfo.l2(1));
+  }
+
+  void test_cached_values_track_sample_moves() {
+    auto ws = makeDefaultWorkspace();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    TS_ASSERT_DELTA(spectrumInfo.l2s()[1], 5.0, 1e-6);
+    auto &componentInfo = ws.mutableComponentInfo();
+    componentInfo.setPosition(componentInfo.sample(), V3D(0.0, 0.0, 1.0));
+    TS_ASSERT_DELTA(spectrumInfo.l2s()[1], 4.0, 1e-6);
+  }
+
+  void test_cached_values_track_grouping_changes() {
+    auto ws = makeDefaultWorkspace();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[1], 0.0, 1e-6);
+    // Detector IDs start at 1, detector 3 is at index 2
+    ws.getSpectrum(1).setDetectorIDs({3});
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[1], 0.0199973, 1e-6);
+    ws.getSpectrum(1).setDetectorIDs({4});
+    TS_ASSERT(std::isnan(spectrumInfo.twoThetas()[1]));
+    TS_ASSERT_EQUALS(spectrumInfo.l2s()[1], -9.0);
+  }
+
   void test_hasDetectors() {
     const auto &spectrumInfo = m_workspace.spectrumInfo();
     TS_ASSERT(spectrumInfo.hasDetectors(0));
@@ -655,6 +725,19 @@ public:
     TS_ASSERT_DELTA(result, 5214709.740869, 1e-6);
   }
 
+  void test_typical_cached() {
+    double result = 0.0;
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const auto &l2s = spectrumInfo.l2s();
+    const auto &twoThetas = spectrumInfo.twoThetas();
+    for (size_t i = 0; i < 10000; ++i) {
+      result += spectrumInfo.l1();
+      result += l2s[i];
+      result += twoThetas[i];
+    }
+    TS_ASSERT_DELTA(result, 5214709.740869, 1e-6);
+  }
+
 private:
   WorkspaceTester m_workspace;
 };
@@ -178,6 +178,31 @@ public:
     TS_ASSERT_EQUALS(nb.size(), 4);
   }
 
+  void testNeighboursInRadiusBeyondNearestNeighbours() {
+    const auto ws = makeWorkspace(256, 767);
+    // 2 Rectangular detectors, 16x16, pixels 0.008 apart
+    ws->setInstrument(
+        ComponentCreationHelper::createTestInstrumentRectangular(2, 16));
+    WorkspaceNearestNeighbours nn(8, ws->spectrumInfo(),
+                                  getSpectrumNumbers(*ws));
+
+    // Pixel (8, 8) of bank1. All the pixels up to 3.75 pixels away, many
+    // more than the 8 nearest neighbours.
+    const specnum_t spec = 256 + 8 * 16 + 8;
+    const auto nb = nn.neighboursInRadius(spec, 0.03);
+    TS_ASSERT_EQUALS(nb.size(), 44);
+    const auto &spectrumInfo = ws->spectrumInfo();
+    const auto centre = spectrumInfo.position(spec - 256);
+    for (const auto &neighbour : nb) {
+      const V3D distance =
+          spectrumInfo.position(neighbour.first - 256) - centre;
+      TS_ASSERT_DELTA(distance.norm(), neighbour.second.norm(), 1e-12);
+      TS_ASSERT_LESS_THAN_EQUALS(neighbour.second.norm(), 0.03);
+    }
+    // The nearest neighbours are unchanged
+    TS_ASSERT_EQUALS(nn.neighbours(spec).size(), 8);
+  }
+
   void testIgnoreAndApplyMasking() {
     const auto ws = makeWorkspace(1, 18);
     ws->setInstrument(
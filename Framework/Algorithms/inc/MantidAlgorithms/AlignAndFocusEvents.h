@@ -0,0 +1,66 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTS_H_
+#define MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTS_H_
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/ITableWorkspace_fwd.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidKernel/System.h"
+
+namespace Mantid {
+namespace Algorithms {
+
+/** AlignAndFocusEvents : Converts the events of a workspace from TOF to
+  d-spacing with a calibration table and histograms them straight into the
+  spectra of their groups, as AlignDetectors followed by DiffractionFocussing
+  and Rebin would, without changing the input events.
+
+  The calibration and the group of each spectrum are looked up once, before
+  the events are read.
+ */
+class DLLExport AlignAndFocusEvents : public API::Algorithm {
+public:
+  /// Algorithms name for identification. @see Algorithm::name
+  const std::string name() const override;
+  /// Algorithm's version for identification. @see Algorithm::version
+  int version() const override;
+  const std::vector<std::string> seeAlso() const override {
+    return {"AlignDetectors", "DiffractionFocussing", "AlignAndFocusPowder"};
+  }
+  const std::string category() const override;
+  /// Algorithm's summary for use in the GUI and help. @see Algorithm::summary
+  const std::string summary() const override;
+
+  /// The calibration and output spectrum of an input spectrum
+  struct SpectrumCalibration {
+    /// Index of the output spectrum of the group of the spectrum
+    size_t group;
+    double difc;
+    double difa;
+    double tzero;
+  };
+
+private:
+  void init() override;
+  /// Cross-check properties with each other @see IAlgorithm::validateInputs
+  std::map<std::string, std::string> validateInputs() override;
+  void exec() override;
+
+  API::ITableWorkspace_sptr getCalibrationWS();
+  std::vector<SpectrumCalibration>
+  makeSpectrumCalibrations(const DataObjects::EventWorkspace &inputWS,
+                           const API::ITableWorkspace &calibrationWS,
+                           const DataObjects::GroupingWorkspace &groupingWS,
+                           std::vector<int> &groups);
+};
+
+} // namespace Algorithms
+} // namespace Mantid
+
+#endif /* MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTS_H_ */
@@ -164,6 +164,13 @@ protected:
                                            const double &rhsY,
                                            const double &rhsE);
 
+  /** Should return true for operations that only append the events of the
+   * rhs to the lhs event lists. The output event lists then update their
+   * cached histograms as events are appended, so they are not cleared.
+   * @return false by default
+   */
+  virtual bool appendsEvents() const { return false; }
+
   /** Should be overridden by operations that need to manipulate the units of
    * the output workspace.
    *  Does nothing by default.
@@ -64,8 +64,10 @@ private:
 
   void setAxisValue(const double &value, std::vector<Variable_ptr> &variables);
   void calculateValues(mu::Parser &p, std::vector<double> &vec,
-                       std::vector<Variable_ptr> variables);
+                       std::vector<Variable_ptr> &variables);
   void setGeometryValues(const API::SpectrumInfo &specInfo, const size_t index,
+                         const std::vector<double> &twoThetas,
+                         const std::vector<double> &l2s,
                          std::vector<Variable_ptr> &variables);
   double evaluateResult(mu::Parser &p);
 };
@@ -72,8 +72,9 @@ private:
   createOutputWorkspace(API::Progress &progress, const std::string &targetUnit,
                         API::MatrixWorkspace_sptr &inputWS);
 
-  /// Map to which the conversion to the unit is stored.
-  std::multimap<double, size_t> m_indexMap;
+  /// Converted values and their workspace indices, sorted by value once all
+  /// are known, in case ordering is asked.
+  std::vector<std::pair<double, size_t>> m_indexMap;
 
   /// Vector of axis in case ordering is not asked.
   std::vector<double> m_axis;
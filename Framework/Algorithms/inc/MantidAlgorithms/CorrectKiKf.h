@@ -71,11 +71,11 @@ private:
    * Execute CorrectKiKf for event lists
    * @param wevector the list of events to correct
    * @param efixed the value of the fixed energy
-   * @param emodeStr the energy mode description
+   * @param direct true if the fixed energy is Ei, false if it is Ef
    */
   template <class T>
   void correctKiKfEventHelper(std::vector<T> &wevector, double efixed,
-                              const std::string emodeStr);
+                              const bool direct);
   void getEfixedFromParameterMap(double &Efi, int64_t i,
                                  const Mantid::API::SpectrumInfo &spectrumInfo,
                                  const Mantid::Geometry::ParameterMap &pmap);
@@ -83,6 +83,11 @@ public:
     return "Diffraction\\Focussing";
   }
 
+protected:
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+
 private:
   // Overridden Algorithm methods
   void init() override;
@@ -130,6 +135,9 @@ private:
   std::vector<std::vector<std::size_t>> m_wsIndices;
   /// List of valid group numbers
   std::vector<Indexing::SpectrumNumber> m_validGroups;
+  /// Set true if the spectra are distributed over the MPI ranks, the groups
+  /// are then focussed on rank 0
+  bool m_distributed{false};
 };
 
 } // namespace Algorithms
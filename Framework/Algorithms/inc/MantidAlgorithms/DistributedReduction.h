@@ -0,0 +1,64 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_ALGORITHMS_DISTRIBUTEDREDUCTION_H_
+#define MANTID_ALGORITHMS_DISTRIBUTEDREDUCTION_H_
+
+#include "MantidAlgorithms/DllConfig.h"
+#include "MantidGeometry/IDTypes.h"
+#include "MantidIndexing/IndexInfo.h"
+#include "MantidParallel/Collectives.h"
+#include "MantidParallel/Communicator.h"
+
+#include <functional>
+#include <set>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+class EventWorkspace;
+}
+namespace Algorithms {
+
+/** DistributedReduction : helpers for algorithms that reduce the spectra of a
+  workspace with Parallel::StorageMode::Distributed, such as SumSpectra and
+  DiffractionFocussing2.
+
+  Each rank reduces the spectra it holds into an output workspace with the
+  same layout on all ranks. The partial results of the other ranks are then
+  sent to rank 0 and combined there. As in Q1D2, the output is MasterOnly on
+  rank 0 and a temporary workspace on the other ranks.
+*/
+
+/// IndexInfo of an output workspace holding the result on rank 0
+MANTID_ALGORITHMS_DLL Indexing::IndexInfo
+makeRootRankIndexInfo(const Parallel::Communicator &comm,
+                      size_t numberOfSpectra);
+
+/// Add the detector IDs of all ranks to those of rank 0
+MANTID_ALGORITHMS_DLL void
+gatherOnRootRank(const Parallel::Communicator &comm,
+                 std::set<detid_t> &detectorIDs);
+
+/// Add the events of all ranks to the event lists of rank 0
+MANTID_ALGORITHMS_DLL void
+gatherOnRootRank(const Parallel::Communicator &comm,
+                 DataObjects::EventWorkspace &workspace);
+
+/// Add up the values of all ranks on rank 0
+template <typename T>
+void sumOnRootRank(const Parallel::Communicator &comm, std::vector<T> &values) {
+  if (comm.size() == 1)
+    return;
+  const auto local = values;
+  Parallel::reduce(comm, local.data(), static_cast<int>(local.size()),
+                   values.data(), std::plus<T>(), 0);
+}
+
+} // namespace Algorithms
+} // namespace Mantid
+
+#endif /* MANTID_ALGORITHMS_DISTRIBUTEDREDUCTION_H_ */
@@ -0,0 +1,49 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_ALGORITHMS_EVALUATEWORKSPACEEXPRESSION_H_
+#define MANTID_ALGORITHMS_EVALUATEWORKSPACEEXPRESSION_H_
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidKernel/System.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Algorithms {
+
+/** EvaluateWorkspaceExpression : evaluate an arithmetic expression of matrix
+  workspaces, such as (sample - background) / vanadium * 2, in a single pass
+  over their spectra. The errors are propagated as by Plus, Minus, Multiply
+  and Divide.
+ */
+class DLLExport EvaluateWorkspaceExpression : public API::Algorithm {
+public:
+  const std::string name() const override {
+    return "EvaluateWorkspaceExpression";
+  }
+  int version() const override { return 1; }
+  const std::vector<std::string> seeAlso() const override {
+    return {"Plus", "Minus", "Multiply", "Divide"};
+  }
+  const std::string category() const override { return "Arithmetic"; }
+  const std::string summary() const override {
+    return "Evaluate an arithmetic expression of workspaces in a single pass "
+           "over their spectra.";
+  }
+
+private:
+  void init() override;
+  std::map<std::string, std::string> validateInputs() override;
+  void exec() override;
+};
+
+} // namespace Algorithms
+} // namespace Mantid
+
+#endif /* MANTID_ALGORITHMS_EVALUATEWORKSPACEEXPRESSION_H_ */
@@ -82,7 +82,7 @@ private:
   /// create event workspace
   boost::shared_ptr<DataObjects::EventWorkspace> createEventWorkspaceNoLog();
   /// create output workspaces if the splitters are given in SplittersWorkspace
-  void createOutputWorkspacesSplitters();
+  void createOutputWorkspacesSplitters(const std::set<int> &targets);
   /// create output workspaces in the case of using TableWorlspace for splitters
   void createOutputWorkspacesTableSplitterCase();
   /// create output workspaces in the case of using MatrixWorkspace for
@@ -112,9 +112,19 @@ private:
   /// Filter events by splitters in format of vector
   void filterEventsByVectorSplitters(double progressamount);
 
+  /// Filter events and save the output workspaces to files, a few at a time
+  void filterEventsToFiles();
+
+  /// Save the output workspaces in memory to their files
+  void saveOutputWorkspaces(const double progressStart,
+                            const double progressEnd);
+
   /// Examine workspace
   void examineAndSortEventWS();
 
+  /// Warn if the splitters are finer than the pulse times of compressed events
+  void checkCompressedPulseTimes();
+
   /// Convert SplittersWorkspace to vector of time and vector of target
   /// (itarget)
   void convertSplittersWorkspaceToVectors();
@@ -148,11 +158,15 @@ private:
           &string_tsp_vector);
 
   template <typename TYPE>
-  void splitTimeSeriesProperty(
+  std::vector<std::unique_ptr<Kernel::Property>> splitTimeSeriesProperty(
       Kernel::TimeSeriesProperty<TYPE> *tsp,
       std::vector<Types::Core::DateAndTime> &split_datetime_vec,
       const int max_target_index);
 
+  /// Add the split-out logs of one log to the output workspaces
+  void
+  addSplitLogs(std::vector<std::unique_ptr<Kernel::Property>> &split_logs);
+
   void groupOutputWorkspace();
 
   DataObjects::EventWorkspace_sptr m_eventWS;
@@ -223,6 +237,12 @@ private:
   Types::Core::DateAndTime m_filterStartTime;
   // EventWorkspace (aka. run)'s starting time
   Types::Core::DateAndTime m_runStartTime;
+
+  /// Directory to save the output workspaces to, if they are not kept in
+  /// memory
+  std::string m_outputDirectory;
+  /// File to save the output workspace of each target to
+  std::map<int, std::string> m_outputFilenames;
 };
 
 } // namespace Algorithms
@@ -123,7 +123,8 @@ private:
   /// fit peaks in a same spectrum
   void fitSpectrumPeaks(
       size_t wi, const std::vector<double> &expected_peak_centers,
-      boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result);
+      boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result,
+      std::vector<std::vector<double>> &neighbour_parameters);
 
   /// fit background
   bool fitBackground(const size_t &ws_index,
@@ -278,6 +279,8 @@ private:
   std::string m_costFunction;
   /// Fit from right or left
   bool m_fitPeaksFromRight;
+  /// Start the fits from those of the previous spectrum
+  bool m_startFromNeighbourFits;
   /// Fit iterations
   int m_fitIterations;
 
@@ -119,9 +119,6 @@ private:
                                  bool filterIncrease, bool filterDecrease,
                                  Types::Core::DateAndTime runend);
 
-  /// Search a value in a sorted vector
-  size_t searchValue(const std::vector<double> &sorteddata, double value);
-
   /// Add a splitter
   void addNewTimeFilterSplitter(Types::Core::DateAndTime starttime,
                                 Types::Core::DateAndTime stoptime, int wsindex,
@@ -195,6 +192,11 @@ private:
 
   std::vector<std::vector<Types::Core::DateAndTime>> m_vecSplitterTimeSet;
   std::vector<std::vector<int>> m_vecGroupIndexSet;
+
+  /// Times of the entries of the double log
+  std::vector<Types::Core::DateAndTime> m_logTimes;
+  /// Values of the entries of the double log, as given by its nthValue
+  std::vector<double> m_logValues;
 };
 
 } // namespace Algorithms
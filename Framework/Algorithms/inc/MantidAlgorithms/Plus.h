@@ -64,6 +64,8 @@ private:
   void performEventBinaryOperation(DataObjects::EventList &lhs,
                                    const double &rhsY,
                                    const double &rhsE) override;
+  /// Adding event workspaces appends the events of the rhs to the lhs
+  bool appendsEvents() const override { return true; }
 
   void checkRequirements() override;
   std::string checkSizeCompatibility(
@@ -14,6 +14,7 @@
 namespace Mantid {
 namespace API {
 class SpectrumInfo;
+class WorkspaceGroup;
 }
 namespace Algorithms {
 /** Takes account of the effects of gravity for instruments where the y-axis
@@ -90,6 +91,7 @@ private:
   void getQBinPlus1(const HistogramData::HistogramX &OutQs,
                     const double QToFind,
                     HistogramData::HistogramY::const_iterator &loc) const;
+  void checkSlices(const API::WorkspaceGroup &slices) const;
   void normalize(const HistogramData::HistogramY &normSum,
                  const HistogramData::HistogramE &normError2,
                  HistogramData::HistogramY &counts,
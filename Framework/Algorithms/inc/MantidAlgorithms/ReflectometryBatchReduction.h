@@ -0,0 +1,59 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_ALGORITHMS_REFLECTOMETRYBATCHREDUCTION_H_
+#define MANTID_ALGORITHMS_REFLECTOMETRYBATCHREDUCTION_H_
+
+#include "MantidAlgorithms/ReflectometryWorkflowBase2.h"
+
+namespace Mantid {
+namespace Algorithms {
+
+/** ReflectometryBatchReduction : Reduces the runs of a batch, one per angle,
+  with ReflectometryReductionOneAuto and stitches them with Stitch1DMany.
+
+  Each distinct pair of transmission runs is converted to wavelength once and
+  shared by all the runs that use it. The runs are then reduced in parallel.
+ */
+class DLLExport ReflectometryBatchReduction
+    : public ReflectometryWorkflowBase2 {
+public:
+  const std::string name() const override;
+  int version() const override;
+  const std::vector<std::string> seeAlso() const override {
+    return {"ReflectometryReductionOneAuto", "Stitch1DMany"};
+  }
+  const std::string category() const override;
+  const std::string summary() const override;
+
+  /// Cross-check properties with each other @see IAlgorithm::validateInputs
+  std::map<std::string, std::string> validateInputs() override;
+
+private:
+  void init() override;
+  void exec() override;
+
+  std::vector<std::string>
+  getTransmissionRuns(const std::string &propertyName) const;
+  API::MatrixWorkspace_sptr getTransmissionRun(const std::string &name) const;
+  std::string getTransmissionName(const std::string &first,
+                                  const std::string &second) const;
+  void makeTransmissionWorkspace(const std::string &first,
+                                 const std::string &second,
+                                 const std::string &outputName);
+  std::vector<std::string>
+  getOutputSuffixes(const std::vector<std::string> &inputNames) const;
+  std::string reduce(const std::string &inputName, const double theta,
+                     const std::string &transmissionName,
+                     const std::string &outputSuffix);
+  API::Workspace_sptr stitch(const std::vector<std::string> &names);
+  void setReductionSettings(API::IAlgorithm &alg) const;
+};
+
+} // namespace Algorithms
+} // namespace Mantid
+
+#endif /* MANTID_ALGORITHMS_REFLECTOMETRYBATCHREDUCTION_H_ */
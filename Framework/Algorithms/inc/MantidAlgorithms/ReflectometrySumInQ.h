@@ -16,11 +16,6 @@ namespace API {
 class SpectrumInfo;
 }
 
-namespace HistogramData {
-class BinEdges;
-class Counts;
-class CountStandardDeviations;
-} // namespace HistogramData
 namespace Algorithms {
 
 /** ReflectometrySumInQ : Sum counts from the input workspace in lambda
@@ -66,15 +61,8 @@ private:
   MinMax findWavelengthMinMax(const API::MatrixWorkspace &detectorWS,
                               const Indexing::SpectrumIndexSet &indices,
                               const Angles &refAngles);
-  void processValue(const int inputIdx, const MinMax &twoThetaRange,
-                    const Angles &refAngles,
-                    const HistogramData::BinEdges &edges,
-                    const HistogramData::Counts &counts,
-                    const HistogramData::CountStandardDeviations &stdDevs,
-                    API::MatrixWorkspace &IvsLam, std::vector<double> &outputE);
-  MinMax projectedLambdaRange(const MinMax &wavelengthRange,
-                              const MinMax &twoThetaRange,
-                              const Angles &refAngles);
+  MinMax projectionFactors(const MinMax &twoThetaRange,
+                           const Angles &refAngles);
   Angles referenceAngles(const API::SpectrumInfo &spectrumInfo);
   API::MatrixWorkspace_sptr sumInQ(const API::MatrixWorkspace &detectorWS,
                                    const Indexing::SpectrumIndexSet &indices);
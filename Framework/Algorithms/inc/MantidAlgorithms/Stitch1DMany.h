@@ -38,7 +38,8 @@ public:
   /// Performs the Stitch1D algorithm at a specific workspace index
   void doStitch1D(std::vector<API::MatrixWorkspace_sptr> &toStitch,
                   const std::vector<double> &manualScaleFactors,
-                  API::Workspace_sptr &outWS, std::string &outName);
+                  API::Workspace_sptr &outWS, std::string &outName,
+                  std::vector<double> &outScaleFactors);
 
   /// Performs the Stitch1DMany algorithm at a specific period
   void doStitch1DMany(const size_t period, const bool useManualScaleFactors,
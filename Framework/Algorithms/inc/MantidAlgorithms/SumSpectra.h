@@ -58,6 +58,11 @@ public:
   /// Cross-input validation
   std::map<std::string, std::string> validateInputs() override;
 
+protected:
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+
 private:
   /// Handle logic for RebinnedOutput workspaces
   void doFractionalSum(API::MatrixWorkspace_sptr outputWorkspace,
@@ -91,6 +96,9 @@ private:
   size_t m_yLength{0};
   /// Set of indices to sum
   std::set<size_t> m_indices;
+  /// Set true if the spectra are distributed over the MPI ranks, the sum is
+  /// then made on rank 0
+  bool m_distributed{false};
 
   // if calculating additional workspace with specially weighted averages is
   // necessary
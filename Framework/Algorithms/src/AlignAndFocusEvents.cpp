@@ -0,0 +1,329 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/AlignAndFocusEvents.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/WorkspaceUnitValidator.h"
+#include "MantidDataObjects/OffsetsWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/Diffraction.h"
+#include "MantidKernel/ParallelReduce.h"
+#include "MantidKernel/RebinParamsValidator.h"
+#include "MantidKernel/UnitFactory.h"
+#include "MantidKernel/VectorHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Mantid {
+namespace Algorithms {
+
+using namespace API;
+using namespace DataObjects;
+using namespace Kernel;
+using HistogramData::BinEdges;
+
+// Register the algorithm into the AlgorithmFactory
+DECLARE_ALGORITHM(AlignAndFocusEvents)
+
+namespace {
+/// Marks a spectrum that is not focussed into any group
+const size_t NO_GROUP = std::numeric_limits<size_t>::max();
+
+/// The partial histogram of a group
+struct GroupHistogram {
+  explicit GroupHistogram(const size_t numberOfBins = 0)
+      : y(numberOfBins, 0.), e(numberOfBins, 0.) {}
+  GroupHistogram &operator+=(const GroupHistogram &other) {
+    std::transform(y.begin(), y.end(), other.y.begin(), y.begin(),
+                   std::plus<double>());
+    // The errors are summed as variances until the group is finished
+    std::transform(e.begin(), e.end(), other.e.begin(), e.begin(),
+                   std::plus<double>());
+    detectorIDs.insert(other.detectorIDs.begin(), other.detectorIDs.end());
+    return *this;
+  }
+  std::vector<double> y;
+  std::vector<double> e;
+  std::set<detid_t> detectorIDs;
+};
+
+/// Convert events to d-spacing and add them to the bins they fall in
+template <typename EventType>
+void histogramEvents(const std::vector<EventType> &events,
+                     const std::function<double(double)> &toDSpacing,
+                     const std::vector<double> &edges, GroupHistogram &sum) {
+  for (const auto &event : events) {
+    const double d = toDSpacing(event.tof());
+    const auto bin = std::upper_bound(edges.cbegin(), edges.cend(), d);
+    if (bin == edges.cbegin() || bin == edges.cend())
+      continue;
+    const auto index = static_cast<size_t>(bin - edges.cbegin()) - 1;
+    sum.y[index] += event.weight();
+    sum.e[index] += event.errorSquared();
+  }
+}
+} // namespace
+
+const std::string AlignAndFocusEvents::name() const {
+  return "AlignAndFocusEvents";
+}
+
+int AlignAndFocusEvents::version() const { return 1; }
+
+const std::string AlignAndFocusEvents::category() const {
+  return "Diffraction\\Focussing";
+}
+
+const std::string AlignAndFocusEvents::summary() const {
+  return "Converts events from TOF to d-spacing with a calibration table and "
+         "histograms them into the spectra of their groups in one pass.";
+}
+
+void AlignAndFocusEvents::init() {
+  declareProperty(
+      std::make_unique<WorkspaceProperty<EventWorkspace>>(
+          "InputWorkspace", "", Direction::Input,
+          boost::make_shared<WorkspaceUnitValidator>("TOF")),
+      "An EventWorkspace with units of TOF. It is not modified.");
+  declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "OutputWorkspace", "", Direction::Output),
+                  "A histogram workspace in d-spacing with one spectrum for "
+                  "each group");
+  declareProperty(
+      std::make_unique<WorkspaceProperty<ITableWorkspace>>(
+          "CalibrationWorkspace", "", Direction::Input, PropertyMode::Optional),
+      "Optional: A calibration table, as made by LoadDiffCal. Either this or "
+      "OffsetsWorkspace needs to be specified.");
+  declareProperty(
+      std::make_unique<WorkspaceProperty<OffsetsWorkspace>>(
+          "OffsetsWorkspace", "", Direction::Input, PropertyMode::Optional),
+      "Optional: A OffsetsWorkspace containing the calibration offsets. Either "
+      "this or CalibrationWorkspace needs to be specified.");
+  declareProperty(std::make_unique<WorkspaceProperty<GroupingWorkspace>>(
+                      "GroupingWorkspace", "", Direction::Input),
+                  "The groups of the detectors. Spectra of detectors in no "
+                  "group, or in several, are left out.");
+  declareProperty(
+      std::make_unique<ArrayProperty<double>>(
+          "Params", boost::make_shared<RebinParamsValidator>()),
+      "The binning of the output in d-spacing, as first bin boundary, width, "
+      "last bin boundary, as for Rebin. A negative width gives logarithmic "
+      "binning.");
+
+  const std::string calibrationGroup("Calibration");
+  setPropertyGroup("CalibrationWorkspace", calibrationGroup);
+  setPropertyGroup("OffsetsWorkspace", calibrationGroup);
+}
+
+std::map<std::string, std::string> AlignAndFocusEvents::validateInputs() {
+  std::map<std::string, std::string> result;
+
+  ITableWorkspace_const_sptr calibrationWS =
+      getProperty("CalibrationWorkspace");
+  OffsetsWorkspace_const_sptr offsetsWS = getProperty("OffsetsWorkspace");
+  if (bool(calibrationWS) == bool(offsetsWS)) {
+    const std::string message = "You must specify one of "
+                                "CalibrationWorkspace, OffsetsWorkspace.";
+    result["CalibrationWorkspace"] = message;
+    result["OffsetsWorkspace"] = message;
+  }
+
+  const std::vector<double> params = getProperty("Params");
+  if (params.size() < 3)
+    result["Params"] = "The first and last bin boundaries must be given, the "
+                       "range of the events in d-spacing is not known.";
+
+  return result;
+}
+
+/// @return the calibration table, converted from the offsets if needed
+ITableWorkspace_sptr AlignAndFocusEvents::getCalibrationWS() {
+  ITableWorkspace_sptr calibrationWS = getProperty("CalibrationWorkspace");
+  if (calibrationWS)
+    return calibrationWS;
+
+  OffsetsWorkspace_sptr offsetsWS = getProperty("OffsetsWorkspace");
+  auto alg = createChildAlgorithm("ConvertDiffCal", 0., 0.1);
+  alg->setProperty("OffsetsWorkspace", offsetsWS);
+  alg->executeAsChildAlg();
+  return alg->getProperty("OutputWorkspace");
+}
+
+/**
+ * Look up the group and the calibration of each spectrum. As in
+ * AlignDetectors, the calibration of a spectrum is the average of those of
+ * its detectors. Spectra that are masked, have no calibration, or whose
+ * detectors are not all in the same group are not focussed.
+ * @param inputWS :: The workspace to focus
+ * @param calibrationWS :: The calibration table
+ * @param groupingWS :: The groups of the detectors
+ * @param groups :: Set to the group numbers of the output spectra
+ * @return the calibration of each spectrum of the input workspace
+ */
+std::vector<AlignAndFocusEvents::SpectrumCalibration>
+AlignAndFocusEvents::makeSpectrumCalibrations(
+    const EventWorkspace &inputWS, const ITableWorkspace &calibrationWS,
+    const GroupingWorkspace &groupingWS, std::vector<int> &groups) {
+  std::map<detid_t, size_t> detidToRow;
+  const auto detIDs = calibrationWS.getColumn("detid");
+  for (size_t row = 0; row < calibrationWS.rowCount(); ++row)
+    detidToRow[static_cast<detid_t>(detIDs->toDouble(row))] = row;
+  const auto columnNames = calibrationWS.getColumnNames();
+  const auto hasColumn = [&columnNames](const std::string &name) {
+    return std::find(columnNames.begin(), columnNames.end(), name) !=
+           columnNames.end();
+  };
+  const auto difcs = calibrationWS.getColumn("difc");
+  // LoadDiffCal always makes these, a table made by hand may leave them out
+  const auto difas =
+      hasColumn("difa") ? calibrationWS.getColumn("difa") : nullptr;
+  const auto tzeros =
+      hasColumn("tzero") ? calibrationWS.getColumn("tzero") : nullptr;
+
+  std::vector<int> detIDToGroup;
+  int64_t maxGroup = 0;
+  groupingWS.makeDetectorIDToGroupVector(detIDToGroup, maxGroup);
+  const auto groupOf = [&detIDToGroup](const detid_t detID) {
+    if (detID < 0 || static_cast<size_t>(detID) >= detIDToGroup.size())
+      return 0;
+    return detIDToGroup[detID];
+  };
+
+  const auto &spectrumInfo = inputWS.spectrumInfo();
+  const size_t numberOfSpectra = inputWS.getNumberHistograms();
+  std::vector<SpectrumCalibration> calibrations(numberOfSpectra,
+                                                {NO_GROUP, 0., 0., 0.});
+  std::vector<int> spectrumGroups(numberOfSpectra, 0);
+  std::set<int> usedGroups;
+  for (size_t i = 0; i < numberOfSpectra; ++i) {
+    const auto &detectorIDs = inputWS.getSpectrum(i).getDetectorIDs();
+    if (detectorIDs.empty() ||
+        (spectrumInfo.hasDetectors(i) && spectrumInfo.isMasked(i)))
+      continue;
+    const int group = groupOf(*detectorIDs.begin());
+    if (group <= 0 ||
+        std::any_of(detectorIDs.begin(), detectorIDs.end(),
+                    [&](const detid_t id) { return groupOf(id) != group; }))
+      continue;
+
+    auto &calibration = calibrations[i];
+    size_t rows = 0;
+    for (const auto detID : detectorIDs) {
+      const auto row = detidToRow.find(detID);
+      if (row == detidToRow.end())
+        continue;
+      calibration.difc += difcs->toDouble(row->second);
+      if (difas)
+        calibration.difa += difas->toDouble(row->second);
+      if (tzeros)
+        calibration.tzero += tzeros->toDouble(row->second);
+      ++rows;
+    }
+    if (rows == 0 || calibration.difc == 0.)
+      continue;
+    const double norm = 1. / static_cast<double>(rows);
+    calibration.difc *= norm;
+    calibration.difa *= norm;
+    calibration.tzero *= norm;
+    spectrumGroups[i] = group;
+    usedGroups.insert(group);
+  }
+
+  groups.assign(usedGroups.begin(), usedGroups.end());
+  for (size_t i = 0; i < numberOfSpectra; ++i) {
+    if (spectrumGroups[i] <= 0)
+      continue;
+    calibrations[i].group = static_cast<size_t>(
+        std::lower_bound(groups.begin(), groups.end(), spectrumGroups[i]) -
+        groups.begin());
+  }
+  return calibrations;
+}
+
+void AlignAndFocusEvents::exec() {
+  EventWorkspace_const_sptr inputWS = getProperty("InputWorkspace");
+  GroupingWorkspace_const_sptr groupingWS = getProperty("GroupingWorkspace");
+  const auto calibrationWS = getCalibrationWS();
+
+  progress(0.1, "Looking up the calibration of the spectra");
+  std::vector<int> groups;
+  const auto calibrations =
+      makeSpectrumCalibrations(*inputWS, *calibrationWS, *groupingWS, groups);
+  if (groups.empty())
+    throw std::runtime_error("No spectra with a calibration were found in "
+                             "any group of the GroupingWorkspace.");
+
+  std::vector<std::vector<size_t>> groupIndices(groups.size());
+  size_t numberOfSpectra = 0;
+  for (size_t i = 0; i < calibrations.size(); ++i) {
+    if (calibrations[i].group == NO_GROUP)
+      continue;
+    groupIndices[calibrations[i].group].push_back(i);
+    ++numberOfSpectra;
+  }
+
+  const std::vector<double> params = getProperty("Params");
+  std::vector<double> edges;
+  VectorHelper::createAxisFromRebinParams(params, edges);
+  const size_t numberOfBins = edges.size() - 1;
+
+  MatrixWorkspace_sptr outputWS =
+      create<Workspace2D>(*inputWS, groups.size(), BinEdges(edges));
+  outputWS->getAxis(0)->unit() = UnitFactory::Instance().create("dSpacing");
+
+  Progress prog(this, 0.2, 1.0, numberOfSpectra);
+  // The events of the spectra of each group are histogrammed in chunks, in
+  // parallel, and the histograms of the chunks are then added pairwise.
+  Kernel::reduceGroups(
+      groupIndices, 200, Kernel::threadSafe(*inputWS, *outputWS),
+      [numberOfBins](size_t) { return GroupHistogram(numberOfBins); },
+      [&](GroupHistogram &partial, size_t, const size_t *first,
+          const size_t *last) {
+        for (auto index = first; index != last; ++index) {
+          const auto &calibration = calibrations[*index];
+          const auto toDSpacing = Diffraction::getTofToDConversionFunc(
+              calibration.difc, calibration.difa, calibration.tzero);
+          const auto &eventList = inputWS->getSpectrum(*index);
+          switch (eventList.getEventType()) {
+          case EventType::TOF:
+            histogramEvents(eventList.getEvents(), toDSpacing, edges, partial);
+            break;
+          case EventType::WEIGHTED:
+            histogramEvents(eventList.getWeightedEvents(), toDSpacing, edges,
+                            partial);
+            break;
+          case EventType::WEIGHTED_NOTIME:
+            histogramEvents(eventList.getWeightedEventsNoTime(), toDSpacing,
+                            edges, partial);
+            break;
+          }
+          const auto &detectorIDs = eventList.getDetectorIDs();
+          partial.detectorIDs.insert(detectorIDs.begin(), detectorIDs.end());
+          prog.report();
+        }
+      },
+      [](GroupHistogram &partial, GroupHistogram &next) { partial += next; },
+      [&](size_t group, GroupHistogram &sum) {
+        std::transform(sum.e.begin(), sum.e.end(), sum.e.begin(),
+                       static_cast<double (*)(double)>(std::sqrt));
+        auto &spectrum = outputWS->getSpectrum(group);
+        spectrum.setSpectrumNo(groups[group]);
+        spectrum.setDetectorIDs(std::move(sum.detectorIDs));
+        outputWS->setCounts(group, std::move(sum.y));
+        outputWS->setCountStandardDeviations(group, std::move(sum.e));
+      });
+
+  setProperty("OutputWorkspace", outputWS);
+}
+
+} // namespace Algorithms
+} // namespace Mantid
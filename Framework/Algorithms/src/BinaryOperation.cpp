@@ -227,9 +227,12 @@ void BinaryOperation::exec() {
       m_eout = boost::dynamic_pointer_cast<EventWorkspace>(m_out);
     }
 
-    // Always clear the MRUs.
-    m_eout->clearMRU();
-    if (m_elhs)
+    // Always clear the MRUs, except for the output of an operation that only
+    // appends events, whose event lists update their cached histograms.
+    const bool keepOutputMRU = appendsEvents();
+    if (!keepOutputMRU)
+      m_eout->clearMRU();
+    if (m_elhs && !(keepOutputMRU && m_elhs == m_eout))
       m_elhs->clearMRU();
     if (m_erhs)
       m_erhs->clearMRU();
@@ -23,6 +23,9 @@
 #include "MantidKernel/Unit.h"
 #include "MantidParallel/Communicator.h"
 
+#include <atomic>
+#include <limits>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -472,6 +475,10 @@ bool CompareWorkspaces::compareEventWorkspaces(
     return false;
   }
 
+  // An event workspace always matches itself
+  if (&ews1 == &ews2)
+    return true;
+
   // why the hell are you called after progress initialisation......... that's
   // why it segfaults
   // Both will end up sorted anyway
@@ -497,8 +504,8 @@ bool CompareWorkspaces::compareEventWorkspaces(
   }
   g_log.notice() << "TOF Tolerance = " << toleranceTOF << "\n";
 
-  bool mismatchedEvent = false;
-  int mismatchedEventWI = 0;
+  std::atomic<bool> mismatchedEvent{false};
+  int mismatchedEventWI = std::numeric_limits<int>::max();
 
   size_t numUnequalNumEventsSpectra = 0;
   size_t numUnequalEvents = 0;
@@ -536,7 +543,8 @@ bool CompareWorkspaces::compareEventWorkspaces(
         if (el1.getNumberEvents() != el2.getNumberEvents()) {
           // Number of events are different
           tempNumUnequal = -1;
-        } else {
+        } else if (checkallspectra || printdetail) {
+          // The detailed counts are only reported when checking all spectra
           tempNumUnequal = compareEventsListInDetails(
               el1, el2, toleranceTOF, toleranceWeight, tolerancePulse,
               printdetail, tempNumPulses, tempNumTof, tempNumBoth,
@@ -544,8 +552,9 @@ bool CompareWorkspaces::compareEventWorkspaces(
         }
 
         mismatchedEvent = true;
-        mismatchedEventWI = i;
         PARALLEL_CRITICAL(CompareWorkspaces) {
+          // Threads may find mismatches out of order, report the first one
+          mismatchedEventWI = std::min(mismatchedEventWI, i);
           if (tempNumUnequal == -1) {
             // 2 spectra have different number of events
             ++numUnequalNumEventsSpectra;
@@ -639,8 +648,18 @@ bool CompareWorkspaces::checkData(API::MatrixWorkspace_const_sptr ws1,
     return false;
   }
 
+  // A workspace always matches itself
+  if (ws1 == ws2)
+    return true;
+
   const double tolerance = getProperty("Tolerance");
-  bool resultBool = true;
+  std::atomic<bool> resultBool{true};
+  // Spectra of 2D workspaces that share their data arrays, e.g. after a clone,
+  // match without looking at the values. Event workspaces build their
+  // histograms on request, so there is nothing to share.
+  const bool canShareData =
+      !dynamic_cast<const EventWorkspace *>(ws1.get()) &&
+      !dynamic_cast<const EventWorkspace *>(ws2.get());
 
   // Now check the data itself
   PARALLEL_FOR_IF(m_parallelComparison && ws1->threadSafe() &&
@@ -649,8 +668,12 @@ bool CompareWorkspaces::checkData(API::MatrixWorkspace_const_sptr ws1,
     PARALLEL_START_INTERUPT_REGION
     m_progress->report("Histograms");
 
-    if (resultBool || checkAllData) // Avoid checking unnecessarily
-    {
+    const bool sharesData = canShareData &&
+                            ws1->sharedX(i) == ws2->sharedX(i) &&
+                            ws1->sharedY(i) == ws2->sharedY(i) &&
+                            ws1->sharedE(i) == ws2->sharedE(i);
+    // Avoid checking unnecessarily
+    if (!sharesData && (resultBool || checkAllData)) {
       // Get references to the current spectrum
       const auto &X1 = ws1->x(i);
       const auto &Y1 = ws1->y(i);
@@ -680,8 +703,10 @@ bool CompareWorkspaces::checkData(API::MatrixWorkspace_const_sptr ws1,
           g_log.debug() << " Difference (X,Y,E) = (" << std::fabs(X1[j] - X2[j])
                         << "," << std::fabs(Y1[j] - Y2[j]) << ","
                         << std::fabs(E1[j] - E2[j]) << ")\n";
-          PARALLEL_CRITICAL(resultBool)
           resultBool = false;
+          // One mismatch is enough unless all of the data is to be checked
+          if (!checkAllData)
+            break;
         }
       }
 
@@ -690,7 +715,6 @@ bool CompareWorkspaces::checkData(API::MatrixWorkspace_const_sptr ws1,
         g_log.debug() << " Data ranges mismatch for spectra N: (" << i << ")\n";
         g_log.debug() << " Last bin ranges (X1_end vs X2_end) = (" << X1.back()
                       << "," << X2.back() << ")\n";
-        PARALLEL_CRITICAL(resultBool)
         resultBool = false;
       }
     }
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
+#include <cmath>
 #include <sstream>
 
 namespace Mantid {
@@ -183,12 +184,19 @@ void ConvertAxisByFormula::exec() {
       size_t numberOfSpectra_i = outputWs->getNumberHistograms();
       auto &spectrumInfo = outputWs->mutableSpectrumInfo();
 
+      // Take the geometry of all spectra in one pass rather than one at a time
+      static const std::vector<double> noValues;
+      const auto &twoThetas =
+          isGeometryRequired ? spectrumInfo.twoThetas() : noValues;
+      const auto &l2s = isGeometryRequired ? spectrumInfo.l2s() : noValues;
+
       size_t failedDetectorCount = 0;
       Progress prog(this, 0.6, 1.0, numberOfSpectra_i);
       for (size_t i = 0; i < numberOfSpectra_i; ++i) {
         try {
           MantidVec &vec = outputWs->dataX(i);
-          setGeometryValues(spectrumInfo, i, variables);
+          if (isGeometryRequired)
+            setGeometryValues(spectrumInfo, i, twoThetas, l2s, variables);
           calculateValues(p, vec, variables);
         } catch (std::runtime_error &)
         // two possible exceptions runtime error and NotFoundError
@@ -273,7 +281,7 @@ void ConvertAxisByFormula::setAxisValue(const double &value,
 }
 
 void ConvertAxisByFormula::calculateValues(
-    mu::Parser &p, MantidVec &vec, std::vector<Variable_ptr> variables) {
+    mu::Parser &p, MantidVec &vec, std::vector<Variable_ptr> &variables) {
   MantidVec::iterator iter;
   for (iter = vec.begin(); iter != vec.end(); ++iter) {
     setAxisValue(*iter, variables);
@@ -281,19 +289,32 @@ void ConvertAxisByFormula::calculateValues(
   }
 }
 
+/** Set the geometry variables to the values of a spectrum.
+ * @param specInfo :: the SpectrumInfo of the workspace
+ * @param index :: the workspace index of the spectrum
+ * @param twoThetas :: specInfo.twoThetas()
+ * @param l2s :: specInfo.l2s()
+ * @param variables :: the variables used in the formula
+ */
 void ConvertAxisByFormula::setGeometryValues(
     const API::SpectrumInfo &specInfo, const size_t index,
+    const std::vector<double> &twoThetas, const std::vector<double> &l2s,
     std::vector<Variable_ptr> &variables) {
   for (const auto &variable : variables) {
     if (variable->isGeometric) {
+      // The cached values are NaN where the SpectrumInfo calls throw, so call
+      // them in that case to report the spectrum as before
       if (variable->name == "twotheta") {
-        variable->value = specInfo.twoTheta(index);
+        variable->value = std::isnan(twoThetas[index])
+                              ? specInfo.twoTheta(index)
+                              : twoThetas[index];
       } else if (variable->name == "signedtwotheta") {
         variable->value = specInfo.signedTwoTheta(index);
       } else if (variable->name == "l1") {
         variable->value = specInfo.l1();
       } else if (variable->name == "l2") {
-        variable->value = specInfo.l2(index);
+        variable->value =
+            std::isnan(l2s[index]) ? specInfo.l2(index) : l2s[index];
       }
     }
   }
@@ -24,6 +24,7 @@
 #include "MantidKernel/UnitFactory.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
+#include <algorithm>
 #include <cfloat>
 
 constexpr double rad2deg = 180.0 / M_PI;
@@ -90,10 +91,13 @@ void ConvertSpectrumAxis2::exec() {
   m_toOrder = getProperty("OrderAxis");
 
   size_t nProgress = nHist;
+  m_indexMap.clear();
+  m_axis.clear();
   if (m_toOrder) {
     // we will need to loop twice, once to build the indexMap,
     // once to copy over the spectra and set the output
     nProgress *= 2;
+    m_indexMap.reserve(nHist);
   } else {
     m_axis.reserve(nHist);
   }
@@ -108,6 +112,13 @@ void ConvertSpectrumAxis2::exec() {
              unitTarget == "ElasticDSpacing") {
     createElasticQMap(progress, unitTarget, inputWS);
   }
+  // Sort once all values are known. A stable sort keeps spectra with equal
+  // values in workspace index order.
+  std::stable_sort(m_indexMap.begin(), m_indexMap.end(),
+                   [](const std::pair<double, size_t> &a,
+                      const std::pair<double, size_t> &b) {
+                     return a.first < b.first;
+                   });
 
   // Create an output workspace and set the property for it.
   MatrixWorkspace_sptr outputWS =
@@ -134,6 +145,8 @@ void ConvertSpectrumAxis2::createThetaMap(API::Progress &progress,
   bool warningGiven = false;
 
   const auto &spectrumInfo = inputWS->spectrumInfo();
+  // The angles of all spectra, computed in one pass
+  const auto &twoThetas = spectrumInfo.twoThetas();
   for (size_t i = 0; i < spectrumInfo.size(); ++i) {
     if (!spectrumInfo.hasDetectors(i)) {
       if (!warningGiven)
@@ -146,7 +159,7 @@ void ConvertSpectrumAxis2::createThetaMap(API::Progress &progress,
       if (signedTheta)
         emplaceIndexMap(spectrumInfo.signedTwoTheta(i) * rad2deg, i);
       else
-        emplaceIndexMap(spectrumInfo.twoTheta(i) * rad2deg, i);
+        emplaceIndexMap(twoThetas[i] * rad2deg, i);
     } else {
       emplaceIndexMap(0.0, i);
     }
@@ -173,11 +186,17 @@ void ConvertSpectrumAxis2::createElasticQMap(
 
   const auto &spectrumInfo = inputWS->spectrumInfo();
   const auto &detectorInfo = inputWS->detectorInfo();
+  const auto &twoThetas = spectrumInfo.twoThetas();
+  // Efixed only differs between spectra if it is taken from the detectors
+  const double efixedProp = getProperty("Efixed");
+  const bool efixedPerDetector = efixedProp == EMPTY_DBL() && emode == 2;
+  bool haveCommonEfixed = false;
+  double commonEfixed(0.0);
   const size_t nHist = spectrumInfo.size();
   for (size_t i = 0; i < nHist; i++) {
     double theta(0.0), efixed(0.0);
     if (!spectrumInfo.isMonitor(i)) {
-      theta = 0.5 * spectrumInfo.twoTheta(i);
+      theta = 0.5 * twoThetas[i];
       /*
        * Two assumptions made in the following code.
        * 1. Getting the detector index of the first detector in the spectrum
@@ -186,9 +205,16 @@ void ConvertSpectrumAxis2::createElasticQMap(
        * accessed). i.e we are not performing scanning. Step scanning is not
        * supported at the time of writing.
        */
-      const auto detectorIndex = spectrumInfo.spectrumDefinition(i)[0].first;
-      efixed = getEfixed(detectorIndex, detectorInfo, *inputWS,
-                         emode); // get efixed
+      if (efixedPerDetector || !haveCommonEfixed) {
+        const auto detectorIndex =
+            spectrumInfo.spectrumDefinition(i)[0].first;
+        efixed = getEfixed(detectorIndex, detectorInfo, *inputWS,
+                           emode); // get efixed
+        commonEfixed = efixed;
+        haveCommonEfixed = true;
+      } else {
+        efixed = commonEfixed;
+      }
     } else {
       theta = DBL_MIN;
       efixed = DBL_MIN;
@@ -263,8 +289,7 @@ MatrixWorkspace_sptr ConvertSpectrumAxis2::createOutputWorkspace(
   // Note that this is needed only for ordered case
   if (m_toOrder) {
     size_t currentIndex = 0;
-    std::multimap<double, size_t>::const_iterator it;
-    for (it = m_indexMap.begin(); it != m_indexMap.end(); ++it) {
+    for (auto it = m_indexMap.cbegin(); it != m_indexMap.cend(); ++it) {
       // Copy over the data.
       outputWorkspace->getSpectrum(currentIndex)
           .copyDataFrom(inputWS->getSpectrum(it->second));
@@ -326,7 +351,7 @@ double ConvertSpectrumAxis2::getEfixed(
  */
 void ConvertSpectrumAxis2::emplaceIndexMap(double value, size_t wsIndex) {
   if (m_toOrder) {
-    m_indexMap.emplace(value, wsIndex);
+    m_indexMap.emplace_back(value, wsIndex);
   } else {
     m_axis.emplace_back(value);
   }
@@ -52,23 +52,13 @@ void ConvertToMatrixWorkspace::exec() {
 
     // Create the output workspace. This will copy many aspects fron the input
     // one.
-    outputWorkspace = create<Workspace2D>(*inputWorkspace);
+    auto output2D = create<Workspace2D>(*inputWorkspace);
 
     // ...but not the data, so do that here.
-    PARALLEL_FOR_IF(Kernel::threadSafe(*inputWorkspace, *outputWorkspace))
-    for (int64_t i = 0; i < static_cast<int64_t>(numHists); ++i) {
-      PARALLEL_START_INTERUPT_REGION
-      const auto &inSpec = inputWorkspace->getSpectrum(i);
-      auto &outSpec = outputWorkspace->getSpectrum(i);
-
-      outSpec.copyInfoFrom(inSpec);
-      outSpec.setHistogram(inSpec.histogram());
-
-      prog.report("Binning");
-
-      PARALLEL_END_INTERUPT_REGION
-    }
-    PARALLEL_CHECK_INTERUPT_REGION
+    eventW->generateHistograms(*output2D, false, &prog);
+    for (size_t i = 0; i < numHists; ++i)
+      output2D->getSpectrum(i).copyInfoFrom(eventW->getSpectrum(i));
+    outputWorkspace = std::move(output2D);
   } else {
     outputWorkspace = getProperty("OutputWorkspace");
     if (inputWorkspace == outputWorkspace) {
@@ -284,6 +284,7 @@ API::MatrixWorkspace_sptr ConvertUnits::setupOutputWorkspace(
   if (!m_inputEvents && m_distribution) {
     // Loop over the histograms (detector spectra)
     Progress prog(this, 0.0, 0.2, m_numberOfSpectra);
+    const std::string progressMessage = "Convert to " + m_outputUnit->unitID();
     PARALLEL_FOR_IF(Kernel::threadSafe(*outputWS))
     for (int64_t i = 0; i < static_cast<int64_t>(m_numberOfSpectra); ++i) {
       PARALLEL_START_INTERUPT_REGION
@@ -297,7 +298,7 @@ API::MatrixWorkspace_sptr ConvertUnits::setupOutputWorkspace(
         E[j] *= width;
       }
 
-      prog.report("Convert to " + m_outputUnit->unitID());
+      prog.report(progressMessage);
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
@@ -331,6 +332,7 @@ MatrixWorkspace_sptr
 ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
                              const double &factor, const double &power) {
   Progress prog(this, 0.2, 1.0, m_numberOfSpectra);
+  const std::string progressMessage = "Convert to " + m_outputUnit->unitID();
   auto numberOfSpectra_i =
       static_cast<int64_t>(m_numberOfSpectra); // cast to make openmp happy
                                                // create the output workspace
@@ -349,7 +351,7 @@ ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
     for (int64_t j = 1; j < numberOfSpectra_i; ++j) {
       PARALLEL_START_INTERUPT_REGION
       outputWS->setX(j, xVals);
-      prog.report("Convert to " + m_outputUnit->unitID());
+      prog.report(progressMessage);
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
@@ -376,7 +378,7 @@ ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
     if (m_inputEvents) {
       eventWS->getSpectrum(k).convertUnitsQuickly(factor, power);
     }
-    prog.report("Convert to " + m_outputUnit->unitID());
+    prog.report(progressMessage);
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
@@ -453,6 +455,7 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   using namespace Geometry;
 
   Progress prog(this, 0.2, 1.0, m_numberOfSpectra);
+  const std::string progressMessage = "Convert to " + m_outputUnit->unitID();
   auto numberOfSpectra_i =
       static_cast<int64_t>(m_numberOfSpectra); // cast to make openmp happy
 
@@ -578,7 +581,7 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
         outSpectrumInfo.setMasked(i, true);
     }
 
-    prog.report("Convert to " + m_outputUnit->unitID());
+    prog.report(progressMessage);
   } // loop over spectra
 
   if (failedDetectorCount != 0) {
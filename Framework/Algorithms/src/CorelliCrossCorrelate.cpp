@@ -21,6 +21,9 @@
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -33,6 +36,65 @@ using Types::Core::DateAndTime;
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(CorelliCrossCorrelate)
 
+namespace {
+/// The number of angle bins for each part of the chopper sequence
+constexpr size_t BINS_PER_PART = 4;
+
+/** Finds the part of the chopper sequence an angle falls in, giving the same
+ * index as std::lower_bound on the cumulative sequence. The angles are split
+ * into bins, with several bins for each part of the sequence, and a table
+ * holds the range of sequence indices for each bin. Most bins contain no
+ * edge of the sequence, so their index is known without a search.
+ */
+class ChopperSequenceLookup {
+public:
+  explicit ChopperSequenceLookup(const std::vector<double> &sequence)
+      : m_sequence(sequence),
+        m_binsPerDegree(static_cast<double>(BINS_PER_PART * sequence.size()) /
+                        sequence.back()),
+        m_firstIndex(BINS_PER_PART * sequence.size() + 2) {
+    // The first sequence index that falls into each bin or a later one. An
+    // angle can only have a lower_bound index from the one of its own bin up
+    // to the one of the next bin, because the binning is monotonic.
+    size_t index = 0;
+    for (size_t bin = 0; bin < m_firstIndex.size(); ++bin) {
+      while (index < m_sequence.size() &&
+             binPosition(m_sequence[index]) < static_cast<double>(bin))
+        ++index;
+      m_firstIndex[bin] = index;
+    }
+  }
+
+  /// Returns the index std::lower_bound would return for the angle
+  size_t index(const double angle) const {
+    const double position = binPosition(angle);
+    // Also catches NaN, for which std::lower_bound gives the first index
+    if (!(position >= 0. &&
+          position < static_cast<double>(m_firstIndex.size() - 1))) {
+      return std::lower_bound(m_sequence.cbegin(), m_sequence.cend(), angle) -
+             m_sequence.cbegin();
+    }
+    const auto bin = static_cast<size_t>(position);
+    const size_t first = m_firstIndex[bin];
+    const size_t last = m_firstIndex[bin + 1];
+    if (first == last)
+      return first;
+    return std::lower_bound(m_sequence.cbegin() + first,
+                            m_sequence.cbegin() + last, angle) -
+           m_sequence.cbegin();
+  }
+
+private:
+  double binPosition(const double angle) const {
+    return std::floor(angle * m_binsPerDegree);
+  }
+
+  const std::vector<double> &m_sequence;
+  const double m_binsPerDegree;
+  std::vector<size_t> m_firstIndex;
+};
+} // namespace
+
 /** Initialize the algorithm's properties.
  */
 void CorelliCrossCorrelate::init() {
@@ -191,6 +253,8 @@ void CorelliCrossCorrelate::exec() {
   const double m_convfactor = 0.5e+12 * Mantid::PhysicalConstants::NeutronMass /
                               Mantid::PhysicalConstants::meV;
 
+  const ChopperSequenceLookup sequenceLookup(sequence);
+
   // Do the cross correlation.
   auto numHistograms = static_cast<int64_t>(inputWS->getNumberHistograms());
   API::Progress prog = API::Progress(this, 0.0, 1.0, numHistograms);
@@ -247,10 +311,7 @@ void CorelliCrossCorrelate::exec() {
                                          tdc[tdc_i - 1].totalNanoseconds()) /
                      period;
 
-      std::vector<double>::iterator location;
-      location = std::lower_bound(sequence.begin(), sequence.end(), angle);
-
-      if ((location - sequence.begin()) % 2 == 0) {
+      if (sequenceLookup.index(angle) % 2 == 0) {
         it->m_weight *= weightAbsorbing;
         it->m_errorSquared *= weightAbsorbing * weightAbsorbing;
       }
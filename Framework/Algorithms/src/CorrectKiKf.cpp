@@ -79,10 +79,11 @@ void CorrectKiKf::exec() {
   bool negativeEnergyWarning = false;
 
   const std::string emodeStr = getProperty("EMode");
+  const bool direct = emodeStr == "Direct";
   double efixedProp = getProperty("EFixed");
 
   if (efixedProp == EMPTY_DBL()) {
-    if (emodeStr == "Direct") {
+    if (direct) {
       // Check if it has been store on the run object for this workspace
       if (inputWS->run().hasProperty("Ei")) {
         efixedProp = inputWS->run().getPropertyValueAsType<double>("Ei");
@@ -109,7 +110,7 @@ void CorrectKiKf::exec() {
     double Efi = 0;
     // Now get the detector object for this histogram to check if monitor
     // or to get Ef for indirect geometry
-    if (emodeStr == "Indirect") {
+    if (!direct) {
       if (efixedProp != EMPTY_DBL())
         Efi = efixedProp;
       // If a DetectorGroup is present should provide a value as a property
@@ -135,7 +136,7 @@ void CorrectKiKf::exec() {
       double Ei = 0.;
       double Ef = 0.;
       double kioverkf = 1.;
-      if (emodeStr == "Direct") // Ei=Efixed
+      if (direct) // Ei=Efixed
       {
         Ei = efixedProp;
         Ef = Ei - deltaE;
@@ -191,10 +192,11 @@ void CorrectKiKf::execEvent() {
   auto outputWS = boost::dynamic_pointer_cast<EventWorkspace>(matrixOutputWS);
 
   const std::string emodeStr = getProperty("EMode");
+  const bool direct = emodeStr == "Direct";
   double efixedProp = getProperty("EFixed"), efixed;
 
   if (efixedProp == EMPTY_DBL()) {
-    if (emodeStr == "Direct") {
+    if (direct) {
       // Check if it has been store on the run object for this workspace
       if (inputWS->run().hasProperty("Ei")) {
         efixedProp = inputWS->run().getPropertyValueAsType<double>("Ei");
@@ -224,7 +226,7 @@ void CorrectKiKf::execEvent() {
     double Efi = 0;
     // Now get the detector object for this histogram to check if monitor
     // or to get Ef for indirect geometry
-    if (emodeStr == "Indirect") {
+    if (!direct) {
       if (efixedProp != EMPTY_DBL()) {
         Efi = efixedProp;
         // If a DetectorGroup is present should provide a value as a property
@@ -250,12 +252,12 @@ void CorrectKiKf::execEvent() {
       // Fall through
 
     case WEIGHTED:
-      correctKiKfEventHelper(evlist.getWeightedEvents(), efixed, emodeStr);
+      correctKiKfEventHelper(evlist.getWeightedEvents(), efixed, direct);
       break;
 
     case WEIGHTED_NOTIME:
       correctKiKfEventHelper(evlist.getWeightedEventsNoTime(), efixed,
-                             emodeStr);
+                             direct);
       break;
     }
 
@@ -278,13 +280,14 @@ void CorrectKiKf::execEvent() {
 
 template <class T>
 void CorrectKiKf::correctKiKfEventHelper(std::vector<T> &wevector,
-                                         double efixed,
-                                         const std::string emodeStr) {
+                                         double efixed, const bool direct) {
   double Ei, Ef;
   float kioverkf;
-  typename std::vector<T>::iterator it;
-  for (it = wevector.begin(); it < wevector.end();) {
-    if (emodeStr == "Direct") // Ei=Efixed
+  // the events that are kept are moved down over the deleted ones, so the
+  // list is compacted in one pass rather than erasing events one at a time
+  auto kept = wevector.begin();
+  for (auto it = wevector.begin(); it != wevector.end(); ++it) {
+    if (direct) // Ei=Efixed
     {
       Ei = efixed;
       Ef = Ei - it->tof();
@@ -294,15 +297,16 @@ void CorrectKiKf::correctKiKfEventHelper(std::vector<T> &wevector,
       Ei = Ef + it->tof();
     }
     // if Ei or Ef is negative, delete the event
-    if ((Ei <= 0) || (Ef <= 0)) {
-      it = wevector.erase(it);
-    } else {
-      kioverkf = static_cast<float>(std::sqrt(Ei / Ef));
-      it->m_weight *= kioverkf;
-      it->m_errorSquared *= kioverkf * kioverkf;
-      ++it;
-    }
+    if ((Ei <= 0) || (Ef <= 0))
+      continue;
+    kioverkf = static_cast<float>(std::sqrt(Ei / Ef));
+    it->m_weight *= kioverkf;
+    it->m_errorSquared *= kioverkf * kioverkf;
+    if (kept != it)
+      *kept = *it;
+    ++kept;
   }
+  wevector.erase(kept, wevector.end());
 }
 
 void CorrectKiKf::getEfixedFromParameterMap(double &Efi, int64_t i,
@@ -5,6 +5,7 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/CreateGroupingWorkspace.h"
+#include "MantidAPI/AlgorithmResultCache.h"
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidDataObjects/GroupingWorkspace.h"
@@ -116,6 +117,10 @@ void CreateGroupingWorkspace::init() {
                   "The number of spectra in groups", Direction::Output);
   declareProperty("NumberGroupsResult", EMPTY_INT(), "The number of groups",
                   Direction::Output);
+
+  // Only the instrument of the input workspace is used
+  AlgorithmResultCache::Instance().setUsesOnlyInstrument(name(),
+                                                         "InputWorkspace");
 }
 
 std::map<std::string, std::string> CreateGroupingWorkspace::validateInputs() {
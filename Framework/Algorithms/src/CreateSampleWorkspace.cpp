@@ -389,12 +389,19 @@ EventWorkspace_sptr CreateSampleWorkspace::createEventWorkspace(
       std::bind(std::multiplies<double>(), event_distrib_factor, _1));
   // the array should now contain the number of events required per bin
 
+  // Every spectrum gets the same number of events, so the event lists can be
+  // sized once rather than grown an event at a time
+  size_t eventsPerSpectrum = 0;
+  for (int i = 0; i < numBins; ++i)
+    eventsPerSpectrum += static_cast<size_t>(static_cast<int>(yValues[i]));
+
   // Make fake events
   size_t workspaceIndex = 0;
 
   const double hourInSeconds = 60 * 60;
   for (int wi = 0; wi < numPixels + numMonitors; wi++) {
     EventList &el = retVal->getSpectrum(workspaceIndex);
+    el.reserve(eventsPerSpectrum);
     for (int i = 0; i < numBins; ++i) {
       // create randomised events within the bin to match the number required -
       // calculated in yValues earlier
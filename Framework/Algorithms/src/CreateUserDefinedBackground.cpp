@@ -166,10 +166,7 @@ CreateUserDefinedBackground::createBackgroundWorkspace(
 
   // Interpolate Y data in the table to get y for each point
   const auto &lerp = getInterpolator(background, data);
-  for (const auto &x : xPoints) {
-    const double y = lerp.value(x);
-    yBackground.push_back(y);
-  }
+  lerp.value(xPoints.rawData(), yBackground);
 
   auto histogram = outputWS->histogram(0);
   if (histogram.yMode() == Histogram::YMode::Frequencies) {
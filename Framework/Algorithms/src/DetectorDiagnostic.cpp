@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <cmath>
 
 namespace Mantid {
 
@@ -622,22 +623,25 @@ std::vector<double> DetectorDiagnostic::calculateMedian(
   }
   const auto &spectrumInfo = input.spectrumInfo();
 
-  for (const auto &hists : indexmap) {
+  // The groups are independent, so each thread finds the medians of whole
+  // groups. Reading one value per spectrum is cheap next to the selection
+  // of the median, so the spectra of a group are read serially.
+  const auto ngroups = static_cast<int>(indexmap.size());
+  medianvec.resize(indexmap.size());
+  PARALLEL_FOR_IF(Kernel::threadSafe(input))
+  for (int group = 0; group < ngroups; ++group) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto &hists = indexmap[group];
     std::vector<double> medianInput;
-    const auto nhists = static_cast<int>(hists.size());
-    // The maximum possible length is that of workspace length
-    medianInput.reserve(nhists);
+    medianInput.reserve(hists.size());
 
-    PARALLEL_FOR_IF(Kernel::threadSafe(input))
-    for (int i = 0; i < nhists; ++i) { // NOLINT
-      PARALLEL_START_INTERUPT_REGION
-
-      if (checkForMask && spectrumInfo.hasDetectors(hists[i])) {
-        if (spectrumInfo.isMasked(hists[i]) || spectrumInfo.isMonitor(hists[i]))
+    for (const auto hist : hists) {
+      if (checkForMask && spectrumInfo.hasDetectors(hist)) {
+        if (spectrumInfo.isMasked(hist) || spectrumInfo.isMonitor(hist))
           continue;
       }
 
-      const double yValue = input.readY(hists[i])[0];
+      const double yValue = input.readY(hist)[0];
       if (yValue < 0.0) {
         throw std::out_of_range("Negative number of counts found, could be "
                                 "corrupted raw counts or solid angle data");
@@ -648,13 +652,8 @@ std::vector<double> DetectorDiagnostic::calculateMedian(
         continue;
       }
       // Now we have a good value
-      PARALLEL_CRITICAL(DetectorDiagnostic_median_d) {
-        medianInput.push_back(yValue);
-      }
-
-      PARALLEL_END_INTERUPT_REGION
+      medianInput.push_back(yValue);
     }
-    PARALLEL_CHECK_INTERUPT_REGION
 
     if (medianInput.empty()) {
       g_log.information(
@@ -670,8 +669,10 @@ std::vector<double> DetectorDiagnostic::calculateMedian(
       throw std::out_of_range("The calculated value for the median was either "
                               "negative or unreliably large");
     }
-    medianvec.push_back(median);
+    medianvec[group] = median;
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
   return medianvec;
 }
 
@@ -216,13 +216,23 @@ void DetectorEfficiencyCor::correctForEfficiency(
   // Need the original values so this is not a reference
   const auto yValues = m_inputWS->y(spectraIn);
   const auto eValues = m_inputWS->e(spectraIn);
+  const auto &xValues = m_inputWS->x(spectraIn);
 
-  // Storage for the reciprocal wave vectors that are calculated as the
-  // correction proceeds
+  // The reciprocal wave vectors only depend on the bin, not on the detector
   std::vector<double> oneOverWaveVectors(yValues.size());
+  for (size_t j = 0; j < oneOverWaveVectors.size(); ++j) {
+    oneOverWaveVectors[j] = calculateOneOverK(xValues[j], xValues[j + 1]);
+  }
+
   const auto &detectorInfo = m_inputWS->detectorInfo();
   const auto &spectrumDefinition = spectrumInfo.spectrumDefinition(spectraIn);
 
+  // The efficiency of a detector depends only on its detector constant. Many
+  // detectors in a group usually share it, so collect the distinct constants
+  // with the number of detectors having each and evaluate the efficiency
+  // once per distinct constant rather than once per detector.
+  std::vector<std::pair<double, double>> detConstWeights;
+  detConstWeights.reserve(spectrumDefinition.size());
   for (const auto index : spectrumDefinition) {
     const auto detIndex = index.first;
     const auto &det_member = detectorInfo.detector(detIndex);
@@ -256,31 +266,32 @@ void DetectorEfficiencyCor::correctForEfficiency(
     // Detector constant
     const double det_const =
         g_helium_prefactor * (detRadius - wallThickness) * atms / sinTheta;
+    detConstWeights.emplace_back(det_const, 1.0);
+  }
+  std::sort(detConstWeights.begin(), detConstWeights.end());
+  auto last = detConstWeights.begin();
+  for (auto it = std::next(last); it != detConstWeights.end(); ++it) {
+    if (it->first == last->first) {
+      last->second += it->second;
+    } else {
+      *(++last) = *it;
+    }
+  }
+  detConstWeights.erase(std::next(last), detConstWeights.end());
+  const auto nDets(static_cast<double>(spectrumDefinition.size()));
+  for (auto &detConstWeight : detConstWeights) {
+    detConstWeight.second /= nDets;
+  }
 
-    auto yinItr = yValues.cbegin();
-    auto einItr = eValues.cbegin();
-    auto youtItr = yout.begin();
-    auto eoutItr = eout.begin();
-    auto xItr = m_inputWS->x(spectraIn).cbegin();
-    auto wavItr = oneOverWaveVectors.begin();
-
-    for (; youtItr != yout.end(); ++youtItr, ++eoutItr) {
-      if (index == spectrumDefinition[0]) {
-        *youtItr = 0.0;
-        *eoutItr = 0.0;
-        *wavItr = calculateOneOverK(*xItr, *(xItr + 1));
-      }
-      const double oneOverWave = *wavItr;
-      const auto nDets(static_cast<double>(spectrumDefinition.size()));
-      const double factor =
-          1.0 / nDets / detectorEfficiency(det_const * oneOverWave);
-      *youtItr += (*yinItr) * factor;
-      *eoutItr += (*einItr) * factor;
-      ++yinItr;
-      ++einItr;
-      ++xItr;
-      ++wavItr;
+  for (size_t j = 0; j < yout.size(); ++j) {
+    const double oneOverWave = oneOverWaveVectors[j];
+    double factor(0.0);
+    for (const auto &detConstWeight : detConstWeights) {
+      factor += detConstWeight.second /
+                detectorEfficiency(detConstWeight.first * oneOverWave);
     }
+    yout[j] = yValues[j] * factor;
+    eout[j] = eValues[j] * factor;
   }
 }
 
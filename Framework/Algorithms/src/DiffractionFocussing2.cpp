@@ -13,17 +13,20 @@
 #include "MantidAPI/SpectraAxis.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
+#include "MantidAlgorithms/DistributedReduction.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/GroupingWorkspace.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidHistogramData/LogarithmicGenerator.h"
 #include "MantidIndexing/Group.h"
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidKernel/ParallelReduce.h"
 #include "MantidKernel/VectorHelper.h"
 
 #include <cfloat>
 #include <iterator>
 #include <numeric>
+#include <set>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -35,6 +38,29 @@ namespace Mantid {
 
 namespace Algorithms {
 
+namespace {
+/// The partial sums of the rebinned spectra of a group
+struct GroupSum {
+  explicit GroupSum(const int nPoints = 0)
+      : y(nPoints, 0.0), e(nPoints, 0.0), weights(nPoints, 0.0) {}
+  GroupSum &operator+=(const GroupSum &other) {
+    std::transform(y.begin(), y.end(), other.y.begin(), y.begin(),
+                   std::plus<double>());
+    // Before the square root is taken the errors are summed variances
+    std::transform(e.begin(), e.end(), other.e.begin(), e.begin(),
+                   std::plus<double>());
+    std::transform(weights.begin(), weights.end(), other.weights.begin(),
+                   weights.begin(), std::plus<double>());
+    detectorIDs.insert(other.detectorIDs.begin(), other.detectorIDs.end());
+    return *this;
+  }
+  MantidVec y;
+  MantidVec e;
+  MantidVec weights;
+  std::set<detid_t> detectorIDs;
+};
+} // namespace
+
 // Register the class into the algorithm factory
 DECLARE_ALGORITHM(DiffractionFocussing2)
 
@@ -107,6 +133,15 @@ void DiffractionFocussing2::exec() {
   m_matrixInputW = getProperty("InputWorkspace");
   nPoints = static_cast<int>(m_matrixInputW->blocksize());
   nHist = static_cast<int>(m_matrixInputW->getNumberHistograms());
+  m_distributed =
+      m_matrixInputW->storageMode() == Parallel::StorageMode::Distributed;
+  if (m_distributed) {
+    // All ranks must make the same bins, a rank may hold no spectra
+    const int localPoints = nPoints;
+    Parallel::all_reduce(
+        communicator(), localPoints, nPoints,
+        [](const int a, const int b) { return std::max(a, b); });
+  }
 
   // Validate UnitID (spacing)
   Axis *axis = m_matrixInputW->getAxis(0);
@@ -170,8 +205,15 @@ void DiffractionFocussing2::exec() {
   if (nPoints <= 0) {
     throw std::runtime_error("No points found in the data range.");
   }
-  API::MatrixWorkspace_sptr out = API::WorkspaceFactory::Instance().create(
-      m_matrixInputW, m_validGroups.size(), nPoints + 1, nPoints);
+  API::MatrixWorkspace_sptr out;
+  if (m_distributed)
+    out = create<HistoWorkspace>(
+        *m_matrixInputW,
+        makeRootRankIndexInfo(communicator(), m_validGroups.size()),
+        BinEdges(nPoints + 1));
+  else
+    out = API::WorkspaceFactory::Instance().create(
+        m_matrixInputW, m_validGroups.size(), nPoints + 1, nPoints);
   // Caching containers that are either only read from or unused. Initialize
   // them once.
   // Helgrind will show a race-condition but the data is completely unused so it
@@ -180,115 +222,30 @@ void DiffractionFocussing2::exec() {
 
   Progress prog(this, 0.2, 1.0, static_cast<int>(totalHistProcess) + nGroups);
 
-  PARALLEL_FOR_IF(Kernel::threadSafe(*m_matrixInputW, *out))
-  for (int outWorkspaceIndex = 0;
-       outWorkspaceIndex < static_cast<int>(m_validGroups.size());
-       outWorkspaceIndex++) {
-    PARALLEL_START_INTERUPT_REGION
+  // Normalise the sum of the spectra of a group into its output spectrum
+  const auto finishGroup = [&](const size_t outWorkspaceIndex, GroupSum &sum,
+                               const size_t groupSize) {
     auto group = static_cast<int>(m_validGroups[outWorkspaceIndex]);
 
     // Get the group
     auto &Xout = group2xvector.at(group);
 
-    // Assign the new X axis only once (i.e when this group is encountered the
-    // first time)
+    // Assign the new X axis only once (i.e when this group is encountered
+    // the first time)
     out->setBinEdges(outWorkspaceIndex, Xout);
 
     // This is the output spectrum
     auto &outSpec = out->getSpectrum(outWorkspaceIndex);
     outSpec.setSpectrumNo(group);
+    outSpec.addDetectorIDs(sum.detectorIDs);
 
-    // Get the references to Y and E output and rebin
+    // Get the references to Y and E output
     // TODO can only be changed once rebin implemented in HistogramData
     auto &Yout = outSpec.dataY();
     auto &Eout = outSpec.dataE();
-
-    // Initialize the group's weight vector here and the dummy vector used for
-    // accumulating errors.
-    MantidVec groupWgt(nPoints, 0.0);
-
-    // loop through the contributing histograms
-    const std::vector<size_t> &indices = m_wsIndices[outWorkspaceIndex];
-    const size_t groupSize = indices.size();
-    for (size_t i = 0; i < groupSize; i++) {
-      size_t inWorkspaceIndex = indices[i];
-      // This is the input spectrum
-      const auto &inSpec = m_matrixInputW->getSpectrum(inWorkspaceIndex);
-      // Get reference to its old X,Y,and E.
-      auto &Xin = inSpec.x();
-      auto &Yin = inSpec.y();
-      auto &Ein = inSpec.e();
-      outSpec.addDetectorIDs(inSpec.getDetectorIDs());
-
-      try {
-        // TODO This should be implemented in Histogram as rebin
-        Mantid::Kernel::VectorHelper::rebinHistogram(
-            Xin.rawData(), Yin.rawData(), Ein.rawData(), Xout.rawData(), Yout,
-            Eout, true);
-      } catch (...) {
-        // Should never happen because Xout is constructed to envelop all of the
-        // Xin vectors
-        std::ostringstream mess;
-        mess << "Error in rebinning process for spectrum:" << inWorkspaceIndex;
-        throw std::runtime_error(mess.str());
-      }
-
-      // Check for masked bins in this spectrum
-      if (m_matrixInputW->hasMaskedBins(i)) {
-        MantidVec weight_bins, weights;
-        weight_bins.push_back(Xin.front());
-        // If there are masked bins, get a reference to the list of them
-        const API::MatrixWorkspace::MaskList &mask =
-            m_matrixInputW->maskedBins(i);
-        // Now iterate over the list, adjusting the weights for the affected
-        // bins
-        for (const auto &bin : mask) {
-          const double currentX = Xin[bin.first];
-          // Add an intermediate bin with full weight if masked bins aren't
-          // consecutive
-          if (weight_bins.back() != currentX) {
-            weights.push_back(1.0);
-            weight_bins.push_back(currentX);
-          }
-          // The weight for this masked bin is 1 - the degree to which this bin
-          // is masked
-          weights.push_back(1.0 - bin.second);
-          weight_bins.push_back(Xin[bin.first + 1]);
-        }
-        // Add on a final bin with full weight if masking doesn't go up to the
-        // end
-        if (weight_bins.back() != Xin.back()) {
-          weights.push_back(1.0);
-          weight_bins.push_back(Xin.back());
-        }
-
-        // Create a zero vector for the errors because we don't care about them
-        // here
-        const MantidVec zeroes(weights.size(), 0.0);
-        // Rebin the weights - note that this is a distribution
-        VectorHelper::rebin(weight_bins, weights, zeroes, Xout.rawData(),
-                            groupWgt, EOutDummy, true, true);
-      } else // If no masked bins we want to add 1 to the weight of the output
-             // bins that this input covers
-      {
-        // Initialized within the loop to avoid having to wrap writing to it
-        // with a PARALLEL_CRITICAL sections
-        MantidVec limits(2);
-
-        if (eventXMin > 0. && eventXMax > 0.) {
-          limits[0] = eventXMin;
-          limits[1] = eventXMax;
-        } else {
-          limits[0] = Xin.front();
-          limits[1] = Xin.back();
-        }
-
-        // Rebin the weights - note that this is a distribution
-        VectorHelper::rebin(limits, weights_default, emptyVec, Xout.rawData(),
-                            groupWgt, EOutDummy, true, true);
-      }
-      prog.report();
-    } // end of loop for input spectra
+    Yout.swap(sum.y);
+    Eout.swap(sum.e);
+    const MantidVec &groupWgt = sum.weights;
 
     // Calculate the bin widths
     std::vector<double> widths(Xout.size());
@@ -320,9 +277,143 @@ void DiffractionFocussing2::exec() {
     });
 
     prog.report();
-    PARALLEL_END_INTERUPT_REGION
-  } // end of loop for groups
-  PARALLEL_CHECK_INTERUPT_REGION
+  };
+  // In a distributed run the sums of the groups are kept to be combined
+  std::vector<GroupSum> groupSums(m_distributed ? m_validGroups.size() : 0);
+
+  // The spectra of each group are rebinned and summed in chunks, in parallel,
+  // and the partial sums of the chunks are then added pairwise.
+  Kernel::reduceGroups(
+      m_wsIndices, 1000, Kernel::threadSafe(*m_matrixInputW, *out),
+      [this](size_t) { return GroupSum(nPoints); },
+      [&](GroupSum &partial, size_t outWorkspaceIndex, const size_t *first,
+          const size_t *last) {
+        auto group = static_cast<int>(m_validGroups[outWorkspaceIndex]);
+        const auto &Xout = group2xvector.at(group);
+        const size_t *indices = m_wsIndices[outWorkspaceIndex].data();
+        for (auto index = first; index != last; ++index) {
+          // The position of the spectrum in the group
+          const auto i = static_cast<size_t>(index - indices);
+          size_t inWorkspaceIndex = *index;
+          // This is the input spectrum
+          const auto &inSpec = m_matrixInputW->getSpectrum(inWorkspaceIndex);
+          // Get reference to its old X,Y,and E.
+          auto &Xin = inSpec.x();
+          auto &Yin = inSpec.y();
+          auto &Ein = inSpec.e();
+          const auto &detectorIDs = inSpec.getDetectorIDs();
+          partial.detectorIDs.insert(detectorIDs.begin(), detectorIDs.end());
+
+          try {
+            // TODO This should be implemented in Histogram as rebin
+            Mantid::Kernel::VectorHelper::rebinHistogram(
+                Xin.rawData(), Yin.rawData(), Ein.rawData(), Xout.rawData(),
+                partial.y, partial.e, true);
+          } catch (...) {
+            // Should never happen because Xout is constructed to envelop all
+            // of the Xin vectors
+            std::ostringstream mess;
+            mess << "Error in rebinning process for spectrum:"
+                 << inWorkspaceIndex;
+            throw std::runtime_error(mess.str());
+          }
+
+          // Check for masked bins in this spectrum
+          if (m_matrixInputW->hasMaskedBins(i)) {
+            MantidVec weight_bins, weights;
+            weight_bins.push_back(Xin.front());
+            // If there are masked bins, get a reference to the list of them
+            const API::MatrixWorkspace::MaskList &mask =
+                m_matrixInputW->maskedBins(i);
+            // Now iterate over the list, adjusting the weights for the
+            // affected bins
+            for (const auto &bin : mask) {
+              const double currentX = Xin[bin.first];
+              // Add an intermediate bin with full weight if masked bins aren't
+              // consecutive
+              if (weight_bins.back() != currentX) {
+                weights.push_back(1.0);
+                weight_bins.push_back(currentX);
+              }
+              // The weight for this masked bin is 1 - the degree to which this
+              // bin is masked
+              weights.push_back(1.0 - bin.second);
+              weight_bins.push_back(Xin[bin.first + 1]);
+            }
+            // Add on a final bin with full weight if masking doesn't go up to
+            // the end
+            if (weight_bins.back() != Xin.back()) {
+              weights.push_back(1.0);
+              weight_bins.push_back(Xin.back());
+            }
+
+            // Create a zero vector for the errors because we don't care about
+            // them here
+            const MantidVec zeroes(weights.size(), 0.0);
+            // Rebin the weights - note that this is a distribution
+            VectorHelper::rebin(weight_bins, weights, zeroes, Xout.rawData(),
+                                partial.weights, EOutDummy, true, true);
+          } else // If no masked bins we want to add 1 to the weight of the
+                 // output bins that this input covers
+          {
+            // Initialized within the loop to avoid having to wrap writing to
+            // it with a PARALLEL_CRITICAL sections
+            MantidVec limits(2);
+
+            if (eventXMin > 0. && eventXMax > 0.) {
+              limits[0] = eventXMin;
+              limits[1] = eventXMax;
+            } else {
+              limits[0] = Xin.front();
+              limits[1] = Xin.back();
+            }
+
+            // Rebin the weights - note that this is a distribution
+            VectorHelper::rebin(limits, weights_default, emptyVec,
+                                Xout.rawData(), partial.weights, EOutDummy,
+                                true, true);
+          }
+          prog.report();
+        } // end of loop for input spectra
+      },
+      [](GroupSum &partial, GroupSum &next) { partial += next; },
+      [&](size_t outWorkspaceIndex, GroupSum &sum) {
+        if (m_distributed)
+          std::swap(groupSums[outWorkspaceIndex], sum);
+        else
+          finishGroup(outWorkspaceIndex, sum,
+                      m_wsIndices[outWorkspaceIndex].size());
+      });
+
+  if (m_distributed) {
+    // Add up the sums and the sizes of the groups of all ranks on rank 0, and
+    // normalise them there
+    const auto &comm = communicator();
+    const auto nOut = static_cast<int64_t>(groupSums.size());
+    std::vector<double> sums;
+    std::vector<size_t> groupSizes;
+    sums.reserve(3 * groupSums.size() * static_cast<size_t>(nPoints));
+    for (size_t i = 0; i < groupSums.size(); ++i) {
+      auto &sum = groupSums[i];
+      sums.insert(sums.end(), sum.y.begin(), sum.y.end());
+      sums.insert(sums.end(), sum.e.begin(), sum.e.end());
+      sums.insert(sums.end(), sum.weights.begin(), sum.weights.end());
+      groupSizes.push_back(m_wsIndices[i].size());
+      gatherOnRootRank(comm, sum.detectorIDs);
+    }
+    sumOnRootRank(comm, sums);
+    sumOnRootRank(comm, groupSizes);
+    PARALLEL_FOR_IF(Kernel::threadSafe(*out))
+    for (int64_t i = 0; i < nOut; ++i) {
+      auto &sum = groupSums[i];
+      auto values = sums.cbegin() + 3 * i * nPoints;
+      std::copy(values, values + nPoints, sum.y.begin());
+      std::copy(values + nPoints, values + 2 * nPoints, sum.e.begin());
+      std::copy(values + 2 * nPoints, values + 3 * nPoints,
+                sum.weights.begin());
+      finishGroup(static_cast<size_t>(i), sum, groupSizes[i]);
+    }
+  }
 
   setProperty("OutputWorkspace", out);
 
@@ -338,8 +429,15 @@ void DiffractionFocussing2::exec() {
  */
 void DiffractionFocussing2::execEvent() {
   // Create a new outputworkspace with not much in it
-  auto out = create<EventWorkspace>(*m_matrixInputW, m_validGroups.size(),
-                                    m_matrixInputW->binEdges(0));
+  std::unique_ptr<EventWorkspace> out;
+  if (m_distributed)
+    out = create<EventWorkspace>(
+        *m_matrixInputW,
+        makeRootRankIndexInfo(communicator(), m_validGroups.size()),
+        m_matrixInputW->binEdges(0));
+  else
+    out = create<EventWorkspace>(*m_matrixInputW, m_validGroups.size(),
+                                 m_matrixInputW->binEdges(0));
 
   MatrixWorkspace_const_sptr outputWS = getProperty("OutputWorkspace");
   bool inPlace = (m_matrixInputW == outputWS);
@@ -350,106 +448,54 @@ void DiffractionFocussing2::execEvent() {
 
   EventType eventWtype = m_eventW->getEventType();
 
-  std::unique_ptr<Progress> prog =
-      std::make_unique<Progress>(this, 0.2, 0.25, nGroups);
-
-  // determine precount size
-  vector<size_t> size_required(this->m_validGroups.size(), 0);
   int totalHistProcess = 0;
-  for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
-    const vector<size_t> &indices = this->m_wsIndices[iGroup];
-
+  for (const auto &indices : m_wsIndices)
     totalHistProcess += static_cast<int>(indices.size());
-    for (auto index : indices) {
-      size_required[iGroup] += m_eventW->getSpectrum(index).getNumberEvents();
-    }
-    prog->report(1, "Pre-counting");
-  }
-
-  // ------------- Pre-allocate Event Lists ----------------------------
-  prog.reset();
-  prog = std::make_unique<Progress>(this, 0.25, 0.3, totalHistProcess);
-
-  // This creates and reserves the space required
-  for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
-    const auto group = static_cast<int>(m_validGroups[iGroup]);
-    EventList &groupEL = out->getSpectrum(iGroup);
-    groupEL.switchTo(eventWtype);
-    groupEL.reserve(size_required[iGroup]);
-    groupEL.clearDetectorIDs();
-    groupEL.setSpectrumNo(group);
-    prog->reportIncrement(1, "Allocating");
-  }
 
   // ----------- Focus ---------------
-  prog.reset();
-  prog = std::make_unique<Progress>(this, 0.3, 0.9, totalHistProcess);
-
-  if (this->m_validGroups.size() == 1) {
-    g_log.information() << "Performing focussing on a single group\n";
-    // Special case of a single group - parallelize differently
-    EventList &groupEL = out->getSpectrum(0);
-    const std::vector<size_t> &indices = this->m_wsIndices[0];
-
-    int chunkSize = 200;
-
-    int end = (totalHistProcess / chunkSize) + 1;
-    // cppcheck-suppress syntaxError
-    PRAGMA_OMP(parallel for schedule(dynamic, 1) )
-    for (int wiChunk = 0; wiChunk < end; wiChunk++) {
-      PARALLEL_START_INTERUPT_REGION
-
-      // Perform in chunks for more efficiency
-      int max = (wiChunk + 1) * chunkSize;
-      if (max > totalHistProcess)
-        max = totalHistProcess;
-
-      // Make a blank EventList that will accumulate the chunk.
-      EventList chunkEL;
-      chunkEL.switchTo(eventWtype);
-      // chunkEL.reserve(numEventsInChunk);
-
-      // process the chunk
-      for (int i = wiChunk * chunkSize; i < max; i++) {
-        // Accumulate the chunk
-        size_t wi = indices[i];
-        chunkEL += m_eventW->getSpectrum(wi);
-      }
-
-      // Rejoin the chunk with the rest.
-      PARALLEL_CRITICAL(DiffractionFocussing2_JoinChunks) {
-        groupEL += chunkEL;
-      }
-
-      PARALLEL_END_INTERUPT_REGION
-    }
-    PARALLEL_CHECK_INTERUPT_REGION
-  } else {
-    // ------ PARALLELIZE BY GROUPS -------------------------
-
-    auto nValidGroups = static_cast<int>(this->m_validGroups.size());
-    PARALLEL_FOR_IF(Kernel::threadSafe(*m_eventW))
-    for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
-      PARALLEL_START_INTERUPT_REGION
-      const std::vector<size_t> &indices = this->m_wsIndices[iGroup];
-      for (auto wi : indices) {
-        // In workspace index iGroup, put what was in the OLD workspace index wi
-        out->getSpectrum(iGroup) += m_eventW->getSpectrum(wi);
-
-        prog->reportIncrement(1, "Appending Lists");
-
-        // When focussing in place, you can clear out old memory from the input
-        // one!
-        if (inPlace) {
-          boost::const_pointer_cast<EventWorkspace>(m_eventW)
-              ->getSpectrum(wi)
-              .clear();
+  // The spectra of each group are appended in chunks, in parallel, and the
+  // chunks are then joined pairwise. If the input lists are sorted by TOF the
+  // chunks are sorted and merged, so that the focussed lists are sorted too.
+  const bool sorted = m_eventW->getSortType() == TOF_SORT;
+  auto inputWS = boost::const_pointer_cast<EventWorkspace>(m_eventW);
+  std::unique_ptr<Progress> prog =
+      std::make_unique<Progress>(this, 0.2, 0.9, totalHistProcess);
+  Kernel::reduceGroups(
+      m_wsIndices, 200, Kernel::threadSafe(*m_eventW),
+      [eventWtype](size_t) {
+        EventList partial;
+        partial.switchTo(eventWtype);
+        return partial;
+      },
+      [&](EventList &partial, size_t, const size_t *first,
+          const size_t *last) {
+        size_t numberOfEvents = 0;
+        for (auto wi = first; wi != last; ++wi)
+          numberOfEvents += m_eventW->getSpectrum(*wi).getNumberEvents();
+        partial.reserve(numberOfEvents);
+        for (auto wi = first; wi != last; ++wi) {
+          partial += m_eventW->getSpectrum(*wi);
+          prog->reportIncrement(1, "Appending Lists");
+          // When focussing in place, you can clear out old memory from the
+          // input one!
+          if (inPlace)
+            inputWS->getSpectrum(*wi).clear();
         }
-      }
-      PARALLEL_END_INTERUPT_REGION
-    }
-    PARALLEL_CHECK_INTERUPT_REGION
-  } // (done with parallel by groups)
+        if (sorted)
+          partial.sortTof();
+      },
+      [](EventList &partial, EventList &next) { partial.mergeSorted(next); },
+      [&](size_t iGroup, EventList &result) {
+        EventList &groupEL = out->getSpectrum(iGroup);
+        groupEL.swapEvents(result);
+        groupEL.clearDetectorIDs();
+        groupEL.addDetectorIDs(result.getDetectorIDs());
+        groupEL.setSpectrumNo(static_cast<int>(m_validGroups[iGroup]));
+      });
+
+  // Append the focussed events of all ranks on rank 0
+  if (m_distributed)
+    gatherOnRootRank(communicator(), *out);
 
   // Now that the data is cleaned up, go through it and set the X vectors to the
   // input workspace we first talked about.
@@ -588,6 +634,30 @@ void DiffractionFocussing2::determineRebinParameters() {
       (gpit->second).second = temp;
   }
 
+  // With distributed spectra the range of a group spans those of all ranks.
+  // nGroups is still the largest group number here.
+  if (m_distributed) {
+    const auto numberOfGroups = static_cast<size_t>(nGroups) + 1;
+    // The minimum and the negated maximum of each group
+    std::vector<double> local(2 * numberOfGroups, BIGGEST);
+    for (const auto &item : group2minmax) {
+      local[2 * item.first] = item.second.first;
+      local[2 * item.first + 1] = -item.second.second;
+    }
+    std::vector<double> global(local.size());
+    Parallel::all_reduce(
+        communicator(), local.data(), static_cast<int>(local.size()),
+        global.data(), [](const double a, const double b) {
+          return std::min(a, b);
+        });
+    group2minmax.clear();
+    for (size_t group = 0; group < numberOfGroups; ++group)
+      if (global[2 * group] != BIGGEST)
+        group2minmax.emplace(
+            static_cast<int>(group),
+            std::make_pair(global[2 * group], -global[2 * group + 1]));
+  }
+
   nGroups = group2minmax.size(); // Number of unique groups
 
   double Xmin, Xmax, step;
@@ -656,6 +726,12 @@ size_t DiffractionFocussing2::setupGroupToWSIndices() {
     wsIndices[group].push_back(wi);
   }
 
+  // With distributed spectra, some groups may have no spectra on this rank
+  if (!group2xvector.empty())
+    wsIndices.resize(std::max(
+        wsIndices.size(),
+        static_cast<size_t>(group2xvector.rbegin()->first + 1)));
+
   // initialize a vector of the valid group numbers
   size_t totalHistProcess = 0;
   for (const auto &item : group2xvector) {
@@ -670,5 +746,21 @@ size_t DiffractionFocussing2::setupGroupToWSIndices() {
   return totalHistProcess;
 }
 
+Parallel::ExecutionMode DiffractionFocussing2::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  const auto inputMode = storageModes.at("InputWorkspace");
+  const auto groupingMode = storageModes.find("GroupingWorkspace");
+  if (groupingMode != storageModes.end() &&
+      groupingMode->second != Parallel::StorageMode::Cloned)
+    return Parallel::ExecutionMode::Invalid;
+  if (inputMode == Parallel::StorageMode::Distributed &&
+      !getPropertyValue("GroupingFileName").empty())
+    throw std::runtime_error(
+        "Using GroupingFileName in an MPI run of " + name() +
+        " is currently not supported, load the grouping with LoadCalFile and "
+        "pass it as GroupingWorkspace.");
+  return Parallel::getCorrespondingExecutionMode(inputMode);
+}
+
 } // namespace Algorithms
 } // namespace Mantid
\ No newline at end of file
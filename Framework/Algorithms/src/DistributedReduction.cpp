@@ -0,0 +1,258 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/DistributedReduction.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidTypes/SpectrumDefinition.h"
+
+#include <array>
+
+namespace Mantid {
+namespace Algorithms {
+
+using namespace DataObjects;
+using API::EventType;
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+
+namespace {
+/// Tag of the messages sent to rank 0
+const int TAG = 0;
+/// Number of entries of an event list in the layout of a workspace
+const size_t LAYOUT_ENTRIES = 4;
+
+/// The events of the spectra of a workspace, as arrays that can be sent
+struct EventArrays {
+  /// Event type, sorted by TOF, number of events and number of detector IDs
+  /// of each spectrum
+  std::vector<int64_t> layout;
+  std::vector<double> tofs;
+  /// Total nanoseconds of the pulse times of TOF and WEIGHTED events
+  std::vector<int64_t> pulseTimes;
+  /// Weights and squared errors of WEIGHTED and WEIGHTED_NOTIME events
+  std::vector<double> weights;
+  std::vector<double> errorSquareds;
+  std::vector<detid_t> detectorIDs;
+
+  void resize(const size_t numberOfSpectra) {
+    layout.resize(LAYOUT_ENTRIES * numberOfSpectra);
+    size_t numberOfEvents = 0, numberWithTime = 0, numberWeighted = 0,
+           numberOfIDs = 0;
+    for (size_t i = 0; i < layout.size(); i += LAYOUT_ENTRIES) {
+      const auto type = static_cast<EventType>(layout[i]);
+      const auto count = static_cast<size_t>(layout[i + 2]);
+      numberOfEvents += count;
+      if (type != EventType::WEIGHTED_NOTIME)
+        numberWithTime += count;
+      if (type != EventType::TOF)
+        numberWeighted += count;
+      numberOfIDs += static_cast<size_t>(layout[i + 3]);
+    }
+    tofs.resize(numberOfEvents);
+    pulseTimes.resize(numberWithTime);
+    weights.resize(numberWeighted);
+    errorSquareds.resize(numberWeighted);
+    detectorIDs.resize(numberOfIDs);
+  }
+
+  void send(const Parallel::Communicator &comm) const {
+    comm.send(0, TAG, layout.data(), static_cast<int>(layout.size()));
+    comm.send(0, TAG, tofs.data(), static_cast<int>(tofs.size()));
+    comm.send(0, TAG, pulseTimes.data(), static_cast<int>(pulseTimes.size()));
+    comm.send(0, TAG, weights.data(), static_cast<int>(weights.size()));
+    comm.send(0, TAG, errorSquareds.data(),
+              static_cast<int>(errorSquareds.size()));
+    comm.send(0, TAG, detectorIDs.data(),
+              static_cast<int>(detectorIDs.size()));
+  }
+
+  void recv(const Parallel::Communicator &comm, const int rank,
+            const size_t numberOfSpectra) {
+    layout.resize(LAYOUT_ENTRIES * numberOfSpectra);
+    comm.recv(rank, TAG, layout.data(), static_cast<int>(layout.size()));
+    resize(numberOfSpectra);
+    comm.recv(rank, TAG, tofs.data(), static_cast<int>(tofs.size()));
+    comm.recv(rank, TAG, pulseTimes.data(),
+              static_cast<int>(pulseTimes.size()));
+    comm.recv(rank, TAG, weights.data(), static_cast<int>(weights.size()));
+    comm.recv(rank, TAG, errorSquareds.data(),
+              static_cast<int>(errorSquareds.size()));
+    comm.recv(rank, TAG, detectorIDs.data(),
+              static_cast<int>(detectorIDs.size()));
+  }
+};
+
+/// Flatten the events of all spectra of a workspace
+EventArrays toArrays(const EventWorkspace &workspace) {
+  EventArrays arrays;
+  for (size_t i = 0; i < workspace.getNumberHistograms(); ++i) {
+    const auto &eventList = workspace.getSpectrum(i);
+    const auto type = eventList.getEventType();
+    const auto &ids = eventList.getDetectorIDs();
+    arrays.layout.push_back(static_cast<int64_t>(type));
+    arrays.layout.push_back(eventList.getSortType() == TOF_SORT ? 1 : 0);
+    arrays.layout.push_back(
+        static_cast<int64_t>(eventList.getNumberEvents()));
+    arrays.layout.push_back(static_cast<int64_t>(ids.size()));
+    arrays.detectorIDs.insert(arrays.detectorIDs.end(), ids.begin(),
+                              ids.end());
+    switch (type) {
+    case EventType::TOF:
+      for (const auto &event : eventList.getEvents()) {
+        arrays.tofs.push_back(event.tof());
+        arrays.pulseTimes.push_back(event.pulseTime().totalNanoseconds());
+      }
+      break;
+    case EventType::WEIGHTED:
+      for (const auto &event : eventList.getWeightedEvents()) {
+        arrays.tofs.push_back(event.tof());
+        arrays.pulseTimes.push_back(event.pulseTime().totalNanoseconds());
+        arrays.weights.push_back(event.weight());
+        arrays.errorSquareds.push_back(event.errorSquared());
+      }
+      break;
+    case EventType::WEIGHTED_NOTIME:
+      for (const auto &event : eventList.getWeightedEventsNoTime()) {
+        arrays.tofs.push_back(event.tof());
+        arrays.weights.push_back(event.weight());
+        arrays.errorSquareds.push_back(event.errorSquared());
+      }
+      break;
+    }
+  }
+  return arrays;
+}
+
+/// Append the events of a rank to the spectra of a workspace, in parallel
+void mergeArrays(const EventArrays &arrays, EventWorkspace &workspace) {
+  const size_t numberOfSpectra = workspace.getNumberHistograms();
+  // The offsets of the events, the pulse times, the weights and the detector
+  // IDs of each spectrum into the arrays
+  std::vector<std::array<size_t, 4>> offsets(numberOfSpectra + 1);
+  for (size_t i = 0; i < numberOfSpectra; ++i) {
+    const auto *layout = &arrays.layout[LAYOUT_ENTRIES * i];
+    const auto type = static_cast<EventType>(layout[0]);
+    const auto count = static_cast<size_t>(layout[2]);
+    offsets[i + 1] = offsets[i];
+    offsets[i + 1][0] += count;
+    if (type != EventType::WEIGHTED_NOTIME)
+      offsets[i + 1][1] += count;
+    if (type != EventType::TOF)
+      offsets[i + 1][2] += count;
+    offsets[i + 1][3] += static_cast<size_t>(layout[3]);
+  }
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t index = 0; index < static_cast<int64_t>(numberOfSpectra);
+       ++index) {
+    const auto i = static_cast<size_t>(index);
+    const auto *layout = &arrays.layout[LAYOUT_ENTRIES * i];
+    const auto type = static_cast<EventType>(layout[0]);
+    const auto count = static_cast<size_t>(layout[2]);
+    const auto &offset = offsets[i];
+    EventList part;
+    part.switchTo(type);
+    part.reserve(count);
+    for (size_t event = 0; event < count; ++event) {
+      const double tof = arrays.tofs[offset[0] + event];
+      switch (type) {
+      case EventType::TOF:
+        part.addEventQuickly(
+            TofEvent(tof, DateAndTime(arrays.pulseTimes[offset[1] + event])));
+        break;
+      case EventType::WEIGHTED:
+        part.addEventQuickly(WeightedEvent(
+            tof, DateAndTime(arrays.pulseTimes[offset[1] + event]),
+            arrays.weights[offset[2] + event],
+            arrays.errorSquareds[offset[2] + event]));
+        break;
+      case EventType::WEIGHTED_NOTIME:
+        part.addEventQuickly(
+            WeightedEventNoTime(tof, arrays.weights[offset[2] + event],
+                                arrays.errorSquareds[offset[2] + event]));
+        break;
+      }
+    }
+    if (layout[1] != 0)
+      part.setSortOrder(TOF_SORT);
+    part.setDetectorIDs(std::set<detid_t>(
+        arrays.detectorIDs.begin() + offset[3],
+        arrays.detectorIDs.begin() + offsets[i + 1][3]));
+    workspace.getSpectrum(i).mergeSorted(part);
+  }
+}
+} // namespace
+
+/**
+ * @param comm :: The communicator of the ranks
+ * @param numberOfSpectra :: The number of spectra of the output workspace
+ * @return the IndexInfo of an output workspace that is MasterOnly on rank 0
+ * and a temporary Cloned workspace on the other ranks. The spectra have no
+ * spectrum definitions, their detectors are set by the algorithm.
+ */
+Indexing::IndexInfo makeRootRankIndexInfo(const Parallel::Communicator &comm,
+                                          const size_t numberOfSpectra) {
+  Indexing::IndexInfo indexInfo(numberOfSpectra,
+                                comm.rank() == 0
+                                    ? Parallel::StorageMode::MasterOnly
+                                    : Parallel::StorageMode::Cloned,
+                                comm);
+  indexInfo.setSpectrumDefinitions(
+      std::vector<SpectrumDefinition>(numberOfSpectra));
+  return indexInfo;
+}
+
+/**
+ * @param comm :: The communicator of the ranks
+ * @param detectorIDs :: The detector IDs of this rank. On rank 0 the IDs of
+ * the other ranks are added.
+ */
+void gatherOnRootRank(const Parallel::Communicator &comm,
+                      std::set<detid_t> &detectorIDs) {
+  if (comm.size() == 1)
+    return;
+  if (comm.rank() != 0) {
+    const std::vector<detid_t> ids(detectorIDs.begin(), detectorIDs.end());
+    const auto count = static_cast<int>(ids.size());
+    comm.send(0, TAG, count);
+    comm.send(0, TAG, ids.data(), count);
+    return;
+  }
+  for (int rank = 1; rank < comm.size(); ++rank) {
+    int count;
+    comm.recv(rank, TAG, count);
+    std::vector<detid_t> ids(count);
+    comm.recv(rank, TAG, ids.data(), count);
+    detectorIDs.insert(ids.begin(), ids.end());
+  }
+}
+
+/**
+ * The workspace must have the same number of spectra on all ranks. The events
+ * and detector IDs of each spectrum of the other ranks are appended to those
+ * of the spectrum of rank 0, keeping the lists sorted by TOF if they all are.
+ * @param comm :: The communicator of the ranks
+ * @param workspace :: The workspace of this rank
+ */
+void gatherOnRootRank(const Parallel::Communicator &comm,
+                      EventWorkspace &workspace) {
+  if (comm.size() == 1)
+    return;
+  if (comm.rank() != 0) {
+    toArrays(workspace).send(comm);
+    return;
+  }
+  EventArrays arrays;
+  for (int rank = 1; rank < comm.size(); ++rank) {
+    arrays.recv(comm, rank, workspace.getNumberHistograms());
+    mergeArrays(arrays, workspace);
+  }
+  workspace.clearMRU();
+}
+
+} // namespace Algorithms
+} // namespace Mantid
@@ -0,0 +1,239 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/EvaluateWorkspaceExpression.h"
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Unit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace Mantid::Kernel;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+
+namespace Mantid {
+namespace Algorithms {
+
+// Register the algorithm into the AlgorithmFactory
+DECLARE_ALGORITHM(EvaluateWorkspaceExpression)
+
+namespace {
+using Operation = WorkspaceExpression::Operation;
+
+/// Values and variances of the bins of one spectrum
+struct Values {
+  std::vector<double> y;
+  std::vector<double> variance;
+};
+
+/// @return the unit ID of the X axis of a workspace, or an empty string
+std::string xUnitID(const MatrixWorkspace &ws) {
+  const auto unit = ws.getAxis(0)->unit();
+  return unit ? unit->unitID() : "";
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------------
+/** Initialize the algorithm's properties.
+ */
+void EvaluateWorkspaceExpression::init() {
+  declareProperty(
+      std::make_unique<ArrayProperty<std::string>>(
+          "InputWorkspaces",
+          boost::make_shared<MandatoryValidator<std::vector<std::string>>>()),
+      "The names of the workspaces used in the Expression, as a "
+      "comma-separated list. They must all have the same number of spectra "
+      "and the same bins.");
+  declareProperty("Expression", "",
+                  boost::make_shared<MandatoryValidator<std::string>>(),
+                  "Arithmetic expression of the InputWorkspaces and numbers, "
+                  "with the operators +, -, * and / and parentheses, e.g. "
+                  "(sample - background) / vanadium * 2.");
+  declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "OutputWorkspace", "", Direction::Output),
+                  "Name of the output workspace. It has the bins, "
+                  "instrument and sample logs of the first of the "
+                  "InputWorkspaces.");
+}
+
+//----------------------------------------------------------------------------------------------
+/** Check that the inputs are matrix workspaces with the same spectra and bins
+ * and that the expression is valid.
+ */
+std::map<std::string, std::string>
+EvaluateWorkspaceExpression::validateInputs() {
+  std::map<std::string, std::string> errors;
+  const std::vector<std::string> names = getProperty("InputWorkspaces");
+  MatrixWorkspace_sptr first;
+  for (const auto &name : names) {
+    if (!AnalysisDataService::Instance().doesExist(name)) {
+      errors["InputWorkspaces"] = name + " does not exist.";
+      return errors;
+    }
+    auto ws = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(name);
+    if (!ws) {
+      errors["InputWorkspaces"] = name + " is not a MatrixWorkspace.";
+      return errors;
+    }
+    if (!first) {
+      first = ws;
+      continue;
+    }
+    if (ws->getNumberHistograms() != first->getNumberHistograms()) {
+      errors["InputWorkspaces"] =
+          name + " does not have the same number of spectra as " +
+          names.front() + ".";
+      return errors;
+    }
+    if (ws->size() != first->size() ||
+        !WorkspaceHelpers::matchingBins(*first, *ws, true)) {
+      errors["InputWorkspaces"] =
+          name + " does not have the same bins as " + names.front() + ".";
+      return errors;
+    }
+    if (xUnitID(*ws) != xUnitID(*first)) {
+      errors["InputWorkspaces"] = name + " does not have the same X unit as " +
+                                  names.front() + ".";
+      return errors;
+    }
+  }
+  try {
+    WorkspaceExpression::compile(getPropertyValue("Expression"), names);
+  } catch (std::invalid_argument &e) {
+    errors["Expression"] = e.what();
+  }
+  return errors;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Execute the algorithm. Each spectrum is evaluated through the whole
+ * expression, rather than creating a temporary workspace per operation.
+ */
+void EvaluateWorkspaceExpression::exec() {
+  const std::vector<std::string> names = getProperty("InputWorkspaces");
+  const auto program =
+      WorkspaceExpression::compile(getPropertyValue("Expression"), names);
+
+  std::vector<MatrixWorkspace_const_sptr> inputs;
+  for (const auto &name : names)
+    inputs.push_back(
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(name));
+
+  // Each spectrum reads all its inputs before writing the output, so that a
+  // histogram input can be overwritten in place
+  MatrixWorkspace_sptr out;
+  const auto outName = getPropertyValue("OutputWorkspace");
+  const auto inPlace = std::find(names.begin(), names.end(), outName);
+  if (inPlace != names.end()) {
+    auto ws = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+        outName);
+    if (boost::dynamic_pointer_cast<Workspace2D>(ws))
+      out = ws;
+  }
+  if (!out)
+    out = create<HistoWorkspace>(*inputs.front());
+
+  const auto numHist = static_cast<int64_t>(out->getNumberHistograms());
+  const size_t depth = WorkspaceExpression::stackDepth(program);
+  Progress progress(this, 0.0, 1.0, static_cast<size_t>(numHist));
+
+  PARALLEL_FOR_IF(Kernel::threadSafe(*out))
+  for (int64_t i = 0; i < numHist; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto index = static_cast<size_t>(i);
+    const size_t size = inputs.front()->y(index).size();
+    std::vector<Values> stack(depth);
+    for (auto &values : stack) {
+      values.y.resize(size);
+      values.variance.resize(size);
+    }
+    size_t top = 0;
+    for (const auto &instruction : program) {
+      if (instruction.operation == Operation::Workspace) {
+        const auto &ws = *inputs[instruction.index];
+        const auto &y = ws.y(index);
+        const auto &e = ws.e(index);
+        auto &result = stack[top++];
+        std::copy(y.begin(), y.end(), result.y.begin());
+        std::transform(e.begin(), e.end(), result.variance.begin(),
+                       [](const double error) { return error * error; });
+        continue;
+      }
+      if (instruction.operation == Operation::Constant) {
+        auto &result = stack[top++];
+        std::fill(result.y.begin(), result.y.end(), instruction.value);
+        std::fill(result.variance.begin(), result.variance.end(), 0.);
+        continue;
+      }
+      if (instruction.operation == Operation::Negate) {
+        auto &result = stack[top - 1];
+        for (size_t j = 0; j < size; ++j)
+          result.y[j] = -result.y[j];
+        continue;
+      }
+
+      // Binary operations replace the two values on top by their result
+      auto &a = stack[top - 2];
+      const auto &b = stack[top - 1];
+      --top;
+      switch (instruction.operation) {
+      case Operation::Add:
+      case Operation::Subtract: {
+        const double sign =
+            (instruction.operation == Operation::Add) ? 1. : -1.;
+        for (size_t j = 0; j < size; ++j) {
+          a.y[j] += sign * b.y[j];
+          a.variance[j] += b.variance[j];
+        }
+        break;
+      }
+      case Operation::Multiply:
+        for (size_t j = 0; j < size; ++j) {
+          a.variance[j] =
+              a.variance[j] * b.y[j] * b.y[j] + b.variance[j] * a.y[j] * a.y[j];
+          a.y[j] *= b.y[j];
+        }
+        break;
+      case Operation::Divide:
+        for (size_t j = 0; j < size; ++j) {
+          const double b2 = b.y[j] * b.y[j];
+          a.variance[j] =
+              (a.variance[j] + a.y[j] * a.y[j] * b.variance[j] / b2) / b2;
+          a.y[j] /= b.y[j];
+        }
+        break;
+      default:
+        break;
+      }
+    }
+
+    const auto &result = stack.front();
+    out->mutableY(index).assign(result.y.begin(), result.y.end());
+    auto &e = out->mutableE(index);
+    std::transform(result.variance.begin(), result.variance.end(), e.begin(),
+                   [](const double variance) { return std::sqrt(variance); });
+    progress.report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  setProperty("OutputWorkspace", out);
+}
+
+} // namespace Algorithms
+} // namespace Mantid
@@ -137,15 +137,32 @@ void ExtractSpectra::exec() {
 
 /// Execute the algorithm in case of a histogrammed data.
 void ExtractSpectra::execHistogram() {
+  // Nothing to crop, the extracted spectra are kept as they are
+  if (m_commonBoundaries && !m_croppingInX)
+    return;
   auto size = static_cast<int>(m_inputWorkspace->getNumberHistograms());
   Progress prog(this, 0.0, 1.0, size);
-  for (int i = 0; i < size; ++i) {
-    if (m_commonBoundaries) {
-      m_inputWorkspace->setHistogram(i, slice(m_inputWorkspace->histogram(i),
-                                              m_minX, m_maxX - m_histogram));
-    } else {
-      this->cropRagged(*m_inputWorkspace, i);
+  if (m_commonBoundaries && size > 0) {
+    // All spectra share the X of the first cropped spectrum
+    auto first =
+        slice(m_inputWorkspace->histogram(0), m_minX, m_maxX - m_histogram);
+    const auto x = first.sharedX();
+    m_inputWorkspace->setHistogram(0, std::move(first));
+    PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWorkspace))
+    for (int i = 1; i < size; ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      auto sliced =
+          slice(m_inputWorkspace->histogram(i), m_minX, m_maxX - m_histogram);
+      sliced.setSharedX(x);
+      m_inputWorkspace->setHistogram(i, std::move(sliced));
+      PARALLEL_END_INTERUPT_REGION
     }
+    PARALLEL_CHECK_INTERUPT_REGION
+  } else {
+    for (int i = 0; i < size; ++i)
+      this->cropRagged(*m_inputWorkspace, i);
+  }
+  for (int i = 0; i < size; ++i) {
     propagateBinMasking(*m_inputWorkspace, i);
     prog.report();
   }
@@ -80,12 +80,22 @@ void ExtractSpectra2::exec() {
   }
 
   Progress prog(this, 0.0, 1.0, indexSet.size());
-  for (size_t j = 0; j < indexSet.size(); ++j) {
+  // Copying event lists copies the events, so copy the spectra in parallel
+  const auto size = static_cast<int64_t>(indexSet.size());
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
+  for (int64_t j = 0; j < size; ++j) {
+    PARALLEL_START_INTERUPT_REGION
     // Rely on Indexing::IndexSet preserving index order.
     const size_t i = indexSet[j];
     // Copy spectrum data, automatically setting up sharing for histogram.
-    outputWS->getSpectrum(j).copyDataFrom(inputWS->getSpectrum(i));
+    outputWS->getSpectrum(j).copyDataFrom(
+        static_cast<const MatrixWorkspace &>(*inputWS).getSpectrum(i));
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
 
+  for (size_t j = 0; j < indexSet.size(); ++j) {
+    const size_t i = indexSet[j];
     // Copy axis entry, SpectraAxis is implicit in workspace creation
     if (outTxtAxis)
       outTxtAxis->setLabel(j, inAxis1->label(i));
@@ -27,12 +27,49 @@
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <memory>
 #include <numeric>
 #include <sstream>
 
 namespace Mantid {
 namespace Algorithms {
 
+namespace {
+/// The GSL tables for complex transforms of one length. Setting up a
+/// wavetable costs about as much as the transform itself, so they are kept
+/// for the next transform on the same thread, e.g. when ExtractFFTSpectrum
+/// transforms every spectrum of a workspace.
+class ComplexFFTTables {
+public:
+  explicit ComplexFFTTables(const size_t n)
+      : m_n(n), m_wavetable(gsl_fft_complex_wavetable_alloc(n)),
+        m_workspace(gsl_fft_complex_workspace_alloc(n)) {}
+  ~ComplexFFTTables() {
+    gsl_fft_complex_wavetable_free(m_wavetable);
+    gsl_fft_complex_workspace_free(m_workspace);
+  }
+  ComplexFFTTables(const ComplexFFTTables &) = delete;
+  ComplexFFTTables &operator=(const ComplexFFTTables &) = delete;
+
+  size_t size() const { return m_n; }
+  gsl_fft_complex_wavetable *wavetable() const { return m_wavetable; }
+  gsl_fft_complex_workspace *workspace() const { return m_workspace; }
+
+private:
+  const size_t m_n;
+  gsl_fft_complex_wavetable *const m_wavetable;
+  gsl_fft_complex_workspace *const m_workspace;
+};
+
+/// @return the tables for transforms of length n on the calling thread
+const ComplexFFTTables &complexFFTTables(const size_t n) {
+  thread_local std::unique_ptr<ComplexFFTTables> tables;
+  if (!tables || tables->size() != n)
+    tables = std::make_unique<ComplexFFTTables>(n);
+  return *tables;
+}
+} // namespace
+
 // Register the class into the algorithm factory
 DECLARE_ALGORITHM(FFT)
 
@@ -130,8 +167,9 @@ void FFT::exec() {
 
   const int dys = nPoints % 2;
 
-  m_wavetable = gsl_fft_complex_wavetable_alloc(nPoints);
-  m_workspace = gsl_fft_complex_workspace_alloc(nPoints);
+  const auto &tables = complexFFTTables(nPoints);
+  m_wavetable = tables.wavetable();
+  m_workspace = tables.workspace();
 
   // Hardcoded "centerShift == true" means that the zero on the x axis is
   // assumed to be in the centre, at point with index i = ySize/2.
@@ -154,9 +192,6 @@ void FFT::exec() {
     m_outWS->setSharedX(m_iAbs, m_outWS->sharedX(m_iRe));
   }
 
-  gsl_fft_complex_wavetable_free(m_wavetable);
-  gsl_fft_complex_workspace_free(m_workspace);
-
   setProperty("OutputWorkspace", m_outWS);
 }
 
@@ -178,9 +213,10 @@ void FFT::transformForward(boost::shared_array<double> &data, const int xSize,
    * will store
    * dataY[j] with j running from 0 to ySize.
    */
+  const auto &yReal = m_inWS->y(iReal);
   for (int i = 0; i < ySize; i++) {
     int j = centerShift ? (ySize / 2 + i) % ySize : i;
-    data[2 * i] = m_inWS->y(iReal)[j]; // even indexes filled with the real part
+    data[2 * i] = yReal[j]; // even indexes filled with the real part
     data[2 * i + 1] = isComplex
                           ? m_inImagWS->y(iImag)[j]
                           : 0.; // odd indexes filled with the imaginary part
@@ -201,35 +237,46 @@ void FFT::transformForward(boost::shared_array<double> &data, const int xSize,
    * 'data'
    * for index j running from ySize/2 to ySize.
    */
+  // get the output arrays once rather than for every point
+  auto &xRe = m_outWS->mutableX(m_iRe);
+  auto &yRe = m_outWS->mutableY(m_iRe);
+  auto &yIm = m_outWS->mutableY(m_iIm);
+  auto &yAbs = m_outWS->mutableY(m_iAbs);
   for (int i = 0; i < ySize; i++) {
     int j = (ySize / 2 + i + dys) % ySize;
-    m_outWS->mutableX(m_iRe)[i] =
-        df * (-ySize / 2 + i); // zero frequency at i = ySize/2
+    xRe[i] = df * (-ySize / 2 + i); // zero frequency at i = ySize/2
     double re = data[2 * j] *
                 dx; // use j from ySize/2 to ySize for negative frequencies
     double im = data[2 * j + 1] * dx;
     // shift
     {
-      double c = cos(m_outWS->x(m_iRe)[i] * shift);
-      double s = sin(m_outWS->x(m_iRe)[i] * shift);
+      double c = cos(xRe[i] * shift);
+      double s = sin(xRe[i] * shift);
       double re1 = re * c - im * s;
       double im1 = re * s + im * c;
       re = re1;
       im = im1;
     }
-    m_outWS->mutableY(m_iRe)[i] = re;                       // real part
-    m_outWS->mutableY(m_iIm)[i] = im;                       // imaginary part
-    m_outWS->mutableY(m_iAbs)[i] = sqrt(re * re + im * im); // modulus
-    if (addPositiveOnly) {
-      m_outWS->dataX(0)[i] = df * i;
+    yRe[i] = re;                       // real part
+    yIm[i] = im;                       // imaginary part
+    yAbs[i] = sqrt(re * re + im * im); // modulus
+  }
+  if (addPositiveOnly) {
+    auto &x0 = m_outWS->mutableX(0);
+    auto &y0 = m_outWS->mutableY(0);
+    auto &y1 = m_outWS->mutableY(1);
+    auto &y2 = m_outWS->mutableY(2);
+    for (int i = 0; i < ySize; i++) {
+      int j = (ySize / 2 + i + dys) % ySize;
+      x0[i] = df * i;
       if (j < ySize / 2) {
-        m_outWS->mutableY(0)[j] = re;                      // real part
-        m_outWS->mutableY(1)[j] = im;                      // imaginary part
-        m_outWS->mutableY(2)[j] = sqrt(re * re + im * im); // modulus
+        y0[j] = yRe[i];  // real part
+        y1[j] = yIm[i];  // imaginary part
+        y2[j] = yAbs[i]; // modulus
       } else {
-        m_outWS->mutableY(0)[j] = 0.; // real part
-        m_outWS->mutableY(1)[j] = 0.; // imaginary part
-        m_outWS->mutableY(2)[j] = 0.; // modulus
+        y0[j] = 0.; // real part
+        y1[j] = 0.; // imaginary part
+        y2[j] = 0.; // modulus
       }
     }
   }
@@ -244,26 +291,31 @@ void FFT::transformBackward(boost::shared_array<double> &data, const int xSize,
                             const int ySize, const int dys,
                             const bool centerShift, const bool isComplex,
                             const int iReal, const int iImag, const double df) {
+  const auto &yReal = m_inWS->y(iReal);
   for (int i = 0; i < ySize; i++) {
     int j = (ySize / 2 + i) % ySize;
-    data[2 * i] = m_inWS->y(iReal)[j];
+    data[2 * i] = yReal[j];
     data[2 * i + 1] = isComplex ? m_inImagWS->y(iImag)[j] : 0.;
   }
 
   gsl_fft_complex_inverse(data.get(), 1, ySize, m_wavetable, m_workspace);
 
+  auto &x0 = m_outWS->mutableX(0);
+  auto &y0 = m_outWS->mutableY(0);
+  auto &y1 = m_outWS->mutableY(1);
+  auto &y2 = m_outWS->mutableY(2);
   for (int i = 0; i < ySize; i++) {
     double x = df * i;
     if (centerShift) {
       x -= df * (ySize / 2);
     }
-    m_outWS->mutableX(0)[i] = x;
+    x0[i] = x;
     int j = centerShift ? (ySize / 2 + i + dys) % ySize : i;
     double re = data[2 * j] / df;
     double im = data[2 * j + 1] / df;
-    m_outWS->mutableY(0)[i] = re;                      // real part
-    m_outWS->mutableY(1)[i] = im;                      // imaginary part
-    m_outWS->mutableY(2)[i] = sqrt(re * re + im * im); // modulus
+    y0[i] = re;                      // real part
+    y1[i] = im;                      // imaginary part
+    y2[i] = sqrt(re * re + im * im); // modulus
   }
   if (xSize == ySize + 1)
     m_outWS->mutableX(0)[ySize] = m_outWS->x(0)[ySize - 1] + df;
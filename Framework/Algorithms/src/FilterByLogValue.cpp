@@ -11,6 +11,10 @@
 #include "MantidKernel/ITimeSeriesProperty.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/TimeSplitter.h"
+
+#include <memory>
+#include <stdexcept>
 
 namespace Mantid {
 namespace Algorithms {
@@ -175,6 +179,14 @@ void FilterByLogValue::exec() {
   }
 
   g_log.information() << splitter.size() << " entries in the filter.\n";
+
+  // Look the events up in an index of the filter. Filters with overlapping
+  // intervals cannot be indexed and are walked through for each spectrum.
+  std::unique_ptr<TimeSplitterIndex> splitterIndex;
+  try {
+    splitterIndex = std::make_unique<TimeSplitterIndex>(splitter);
+  } catch (std::invalid_argument &) {
+  }
   size_t numberOfSpectra = inputWS->getNumberHistograms();
 
   // Initialise the progress reporting object
@@ -192,7 +204,10 @@ void FilterByLogValue::exec() {
       EventList &input_el = inputWS->getSpectrum(i);
 
       // Perform the filtering in place.
-      input_el.filterInPlace(splitter);
+      if (splitterIndex)
+        input_el.filterInPlace(*splitterIndex);
+      else
+        input_el.filterInPlace(splitter);
 
       prog.report();
       PARALLEL_END_INTERUPT_REGION
@@ -228,7 +243,10 @@ void FilterByLogValue::exec() {
 
       // Perform the filtering (using the splitting function and just one
       // output)
-      input_el.splitByTime(splitter, outputs);
+      if (splitterIndex)
+        input_el.splitByTime(*splitterIndex, outputs);
+      else
+        input_el.splitByTime(splitter, outputs);
 
       prog.report();
       PARALLEL_END_INTERUPT_REGION
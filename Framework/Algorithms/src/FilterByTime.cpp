@@ -115,6 +115,20 @@ void FilterByTime::exec() {
     throw std::invalid_argument(
         "The stop time should be larger than the start time.");
 
+  // Events compressed with a wall-clock tolerance only know their pulse time
+  // to within that tolerance
+  const auto &run = inputWS->run();
+  if (run.hasProperty("compress_wall_clock_tolerance")) {
+    const auto tolerance =
+        run.getPropertyValueAsType<double>("compress_wall_clock_tolerance");
+    if (DateAndTime::secondsFromDuration(stop - start) < tolerance)
+      g_log.warning() << "The events were compressed with a wall-clock "
+                         "tolerance of "
+                      << tolerance
+                      << " s, which is longer than the filtering interval. "
+                         "The output may not contain the expected events.\n";
+  }
+
   auto outputWS = DataObjects::create<EventWorkspace>(*inputWS);
 
   size_t numberOfSpectra = inputWS->getNumberHistograms();
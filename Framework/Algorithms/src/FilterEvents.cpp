@@ -23,6 +23,7 @@
 #include "MantidHistogramData/Histogram.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/LogFilter.h"
 #include "MantidKernel/PhysicalConstants.h"
@@ -31,6 +32,9 @@
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
+#include <Poco/Path.h>
+
+#include <limits>
 #include <memory>
 #include <sstream>
 
@@ -185,6 +189,28 @@ void FilterEvents::init() {
   declareProperty("DescriptiveOutputNames", false,
                   "If selected, the names of the output workspaces will "
                   "include information about each slice.");
+
+  declareProperty(
+      std::make_unique<FileProperty>("OutputDirectory", "",
+                                     FileProperty::OptionalDirectory),
+      "If given, each output workspace is saved to a NeXus processed file "
+      "named after it in this directory instead of being kept in memory. "
+      "Only a few output workspaces are held in memory at a time. This "
+      "requires a SplittersWorkspace.");
+
+  auto mustBeAtLeastOne = boost::make_shared<BoundedValidator<int>>();
+  mustBeAtLeastOne->setLower(1);
+  declareProperty("MaxOutputWorkspacesInMemory", 16, mustBeAtLeastOne,
+                  "The number of output workspaces filled at a time when "
+                  "saving them to OutputDirectory. Each batch requires a "
+                  "pass over the input events.");
+  setPropertySettings("MaxOutputWorkspacesInMemory",
+                      std::make_unique<EnabledWhenProperty>("OutputDirectory",
+                                                            IS_NOT_DEFAULT));
+
+  declareProperty(std::make_unique<ArrayProperty<string>>("OutputFilenames",
+                                                          Direction::Output),
+                  "List of the files the output workspaces were saved to");
 }
 
 std::map<std::string, std::string> FilterEvents::validateInputs() {
@@ -245,6 +271,18 @@ std::map<std::string, std::string> FilterEvents::validateInputs() {
   }
   // "None" and "Elastic" and "Indirect" don't require extra information
 
+  const std::string outputDirectory = getPropertyValue("OutputDirectory");
+  if (!outputDirectory.empty()) {
+    if (!boost::dynamic_pointer_cast<const SplittersWorkspace>(splitter))
+      result["OutputDirectory"] =
+          "Saving the output workspaces to files requires a "
+          "SplittersWorkspace";
+    const bool groupWorkspaces = getProperty("GroupWorkspaces");
+    if (groupWorkspaces)
+      result["GroupWorkspaces"] = "Output workspaces saved to files cannot "
+                                  "be grouped";
+  }
+
   return result;
 }
 
@@ -266,6 +304,14 @@ void FilterEvents::exec() {
     processTableSplittersWorkspace();
   else
     processMatrixSplitterWorkspace();
+  checkCompressedPulseTimes();
+
+  if (!m_outputDirectory.empty()) {
+    filterEventsToFiles();
+    m_progress = 1.0;
+    progress(m_progress, "Completed");
+    return;
+  }
 
   // Create output workspaces
   m_progress = 0.1;
@@ -273,7 +319,7 @@ void FilterEvents::exec() {
   if (m_useArbTableSplitters)
     createOutputWorkspacesTableSplitterCase();
   else if (m_useSplittersWorkspace)
-    createOutputWorkspacesSplitters();
+    createOutputWorkspacesSplitters(m_targetWorkspaceIndexSet);
   else
     createOutputWorkspacesMatrixCase();
 
@@ -336,6 +382,35 @@ void FilterEvents::exec() {
   progress(m_progress, "Completed");
 }
 
+//----------------------------------------------------------------------------------------------
+/** Events compressed with a wall-clock tolerance (by CompressEvents or
+ * LoadEventNexus) only know their pulse time to within that tolerance. Warn
+ * if some splitters are shorter than it.
+ */
+void FilterEvents::checkCompressedPulseTimes() {
+  const auto &run = m_eventWS->run();
+  if (!run.hasProperty("compress_wall_clock_tolerance"))
+    return;
+  const auto tolerance =
+      run.getPropertyValueAsType<double>("compress_wall_clock_tolerance");
+
+  double shortest = std::numeric_limits<double>::max();
+  for (const auto &splitter : m_splitters)
+    shortest = std::min(shortest, splitter.duration());
+  for (size_t i = 1; i < m_vecSplitterTime.size(); ++i)
+    shortest = std::min(
+        shortest,
+        static_cast<double>(m_vecSplitterTime[i] - m_vecSplitterTime[i - 1]) *
+            1.e-9);
+
+  if (shortest < tolerance)
+    g_log.warning() << "The events were compressed with a wall-clock "
+                       "tolerance of "
+                    << tolerance << " s, but the shortest splitter lasts "
+                    << shortest
+                    << " s. Events may be assigned to the wrong target.\n";
+}
+
 //----------------------------------------------------------------------------------------------
 /**  Examine whether any spectrum does not have detector
  * Warning message will be written out
@@ -443,6 +518,7 @@ void FilterEvents::processAlgorithmProperties() {
   m_filterByPulseTime = this->getProperty("FilterByPulseTime");
 
   m_toGroupWS = this->getProperty("GroupWorkspaces");
+  m_outputDirectory = this->getPropertyValue("OutputDirectory");
 
   if (m_toGroupWS && (m_outputWSNameBase == m_eventWS->getName())) {
     std::stringstream errss;
@@ -706,25 +782,40 @@ void FilterEvents::splitTimeSeriesLogs(
   if (m_useSplittersWorkspace)
     ++max_target_index;
 
-  // deal with integer time series property
-  for (const auto &int_tsp : int_tsp_vector) {
-    splitTimeSeriesProperty(int_tsp, split_datetime_vec, max_target_index);
-  }
-
-  // split double time series property
-  for (const auto &dbl_tsp : dbl_tsp_vector) {
-    splitTimeSeriesProperty(dbl_tsp, split_datetime_vec, max_target_index);
-  }
-
-  // deal with bool time series property
-  for (const auto &bool_tsp : bool_tsp_vector) {
-    splitTimeSeriesProperty(bool_tsp, split_datetime_vec, max_target_index);
+  // split all the logs in parallel, each into its own new properties. They
+  // are added to the output workspaces afterwards, in the order of the logs:
+  // integer, double, boolean and then string
+  const size_t numIntLogs = int_tsp_vector.size();
+  const size_t numDblLogs = dbl_tsp_vector.size();
+  const size_t numBoolLogs = bool_tsp_vector.size();
+  const size_t numLogs =
+      numIntLogs + numDblLogs + numBoolLogs + string_tsp_vector.size();
+  std::vector<std::vector<std::unique_ptr<Kernel::Property>>> split_logs(
+      numLogs);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(numLogs); ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    size_t index = static_cast<size_t>(i);
+    if (index < numIntLogs) {
+      split_logs[i] = splitTimeSeriesProperty(
+          int_tsp_vector[index], split_datetime_vec, max_target_index);
+    } else if ((index -= numIntLogs) < numDblLogs) {
+      split_logs[i] = splitTimeSeriesProperty(
+          dbl_tsp_vector[index], split_datetime_vec, max_target_index);
+    } else if ((index -= numDblLogs) < numBoolLogs) {
+      split_logs[i] = splitTimeSeriesProperty(
+          bool_tsp_vector[index], split_datetime_vec, max_target_index);
+    } else {
+      index -= numBoolLogs;
+      split_logs[i] = splitTimeSeriesProperty(
+          string_tsp_vector[index], split_datetime_vec, max_target_index);
+    }
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
 
-  // deal with string time series property
-  for (const auto &string_tsp : string_tsp_vector) {
-    splitTimeSeriesProperty(string_tsp, split_datetime_vec, max_target_index);
-  }
+  for (auto &split_log : split_logs)
+    addSplitLogs(split_log);
 
   // integrate proton charge
   for (int tindex = 0; tindex <= max_target_index; ++tindex) {
@@ -744,14 +835,17 @@ void FilterEvents::splitTimeSeriesLogs(
 }
 
 //----------------------------------------------------------------------------------------------
-/** split one single time-series property (template)
+/** split one single time-series property (template). This only reads the
+ * property and the splitters so it may run for several logs at once.
  * @brief FilterEvents::splitTimeSeriesProperty
  * @param tsp :: a time series property instance
  * @param split_datetime_vec :: splitter
  * @param max_target_index :: maximum number of separated time series
+ * @return :: the split-out properties indexed by target workspace index
  */
 template <typename TYPE>
-void FilterEvents::splitTimeSeriesProperty(
+std::vector<std::unique_ptr<Kernel::Property>>
+FilterEvents::splitTimeSeriesProperty(
     Kernel::TimeSeriesProperty<TYPE> *tsp,
     std::vector<Types::Core::DateAndTime> &split_datetime_vec,
     const int max_target_index) {
@@ -759,11 +853,14 @@ void FilterEvents::splitTimeSeriesProperty(
   // get property name and etc
   std::string property_name = tsp->name();
   // generate new propertys for the source to split to
+  std::vector<std::unique_ptr<Kernel::Property>> split_logs;
   std::vector<TimeSeriesProperty<TYPE> *> output_vector;
   for (int tindex = 0; tindex <= max_target_index; ++tindex) {
-    auto *new_property = new TimeSeriesProperty<TYPE>(property_name);
+    auto new_property =
+        std::make_unique<TimeSeriesProperty<TYPE>>(property_name);
     new_property->setUnits(tsp->units());
-    output_vector.push_back(new_property);
+    output_vector.push_back(new_property.get());
+    split_logs.push_back(std::move(new_property));
   }
 
   // duplicate the time series property if the size is just one
@@ -778,11 +875,19 @@ void FilterEvents::splitTimeSeriesProperty(
                            output_vector);
   }
 
-  // assign to output workspaces
-  for (int tindex = 0; tindex <= max_target_index; ++tindex) {
+  return split_logs;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Add the properties split out of one log to the output workspaces
+ * @param split_logs :: the split-out properties indexed by target workspace
+ * index. Those without an output workspace are discarded.
+ */
+void FilterEvents::addSplitLogs(
+    std::vector<std::unique_ptr<Kernel::Property>> &split_logs) {
+  for (size_t tindex = 0; tindex < split_logs.size(); ++tindex) {
     // find output workspace
-    std::map<int, DataObjects::EventWorkspace_sptr>::iterator wsiter;
-    wsiter = m_outputWorkspacesMap.find(tindex);
+    auto wsiter = m_outputWorkspacesMap.find(static_cast<int>(tindex));
     if (wsiter == m_outputWorkspacesMap.end()) {
       // unable to find workspace associated with target index
       g_log.information() << "Workspace target (" << tindex
@@ -790,12 +895,10 @@ void FilterEvents::splitTimeSeriesProperty(
                           << "\n";
     } else {
       // add property to the associated workspace
-      DataObjects::EventWorkspace_sptr ws_i = wsiter->second;
-      ws_i->mutableRun().addProperty(output_vector[tindex], true);
+      wsiter->second->mutableRun().addProperty(std::move(split_logs[tindex]),
+                                               true);
     }
   }
-
-  return;
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1099,8 +1202,12 @@ void FilterEvents::processTableSplittersWorkspace() {
 /** Create a list of EventWorkspace for output in the case that splitters are
  * given by
  *  SplittersWorkspace
+ * @param targets :: the target workspace indexes to create workspaces for.
+ * When saving to files, the workspaces are neither added to the ADS nor set
+ * as output properties, so that they are released once saved.
  */
-void FilterEvents::createOutputWorkspacesSplitters() {
+void FilterEvents::createOutputWorkspacesSplitters(
+    const std::set<int> &targets) {
 
   // Convert information workspace to map
   std::map<int, std::string> infomap;
@@ -1126,8 +1233,7 @@ void FilterEvents::createOutputWorkspacesSplitters() {
   }
 
   // Set up new workspaces
-  int numoutputws = 0;
-  auto numnewws = static_cast<double>(m_targetWorkspaceIndexSet.size());
+  auto numnewws = static_cast<double>(targets.size());
   double wsgindex = 0.;
 
   // Work out how it has been split so the naming can be done
@@ -1142,7 +1248,7 @@ void FilterEvents::createOutputWorkspacesSplitters() {
     }
   }
 
-  for (auto const wsgroup : m_targetWorkspaceIndexSet) {
+  for (auto const wsgroup : targets) {
     // Generate new workspace name
     bool add2output = true;
     std::stringstream wsname;
@@ -1213,11 +1319,18 @@ void FilterEvents::createOutputWorkspacesSplitters() {
       // Inserted this pair to map
       m_wsNames.push_back(wsname.str());
 
-      // Set (property) to output workspace and set to ADS
-      AnalysisDataService::Instance().addOrReplace(wsname.str(), optws);
+      if (!m_outputDirectory.empty()) {
+        Poco::Path directory(m_outputDirectory);
+        directory.makeDirectory();
+        m_outputFilenames[wsgroup] =
+            Poco::Path(directory, wsname.str() + ".nxs").toString();
+      } else {
+        // Set (property) to output workspace and set to ADS
+        AnalysisDataService::Instance().addOrReplace(wsname.str(), optws);
+      }
 
       // create these output properties
-      if (!this->m_toGroupWS) {
+      if (!this->m_toGroupWS && m_outputDirectory.empty()) {
         if (!this->existsProperty(propertynamess.str())) {
           declareProperty(
               std::make_unique<
@@ -1228,7 +1341,6 @@ void FilterEvents::createOutputWorkspacesSplitters() {
         setProperty(propertynamess.str(), optws);
       }
 
-      ++numoutputws;
       g_log.debug() << "Created output Workspace of group = " << wsgroup
                     << "  Property Name = " << propertynamess.str()
                     << " Workspace name = " << wsname.str()
@@ -1244,7 +1356,7 @@ void FilterEvents::createOutputWorkspacesSplitters() {
   } // ENDFOR
 
   // Set output and do debug report
-  setProperty("NumberOutputWS", numoutputws);
+  setProperty("NumberOutputWS", static_cast<int>(m_wsNames.size()));
 
   g_log.information("Output workspaces are created. ");
 } // namespace Algorithms
@@ -1707,6 +1819,13 @@ void FilterEvents::filterEventsBySplitters(double progressamount) {
           outputs.emplace(index, &output_el);
         }
       }
+      // The events of targets whose workspaces are not in memory, when
+      // saving to files, are dropped
+      DataObjects::EventList dropped;
+      if (outputs.size() < m_targetWorkspaceIndexSet.size()) {
+        for (const auto target : m_targetWorkspaceIndexSet)
+          outputs.emplace(target, &dropped);
+      }
       // Get a holder on input workspace's event list of this spectrum
       const DataObjects::EventList &input_el = m_eventWS->getSpectrum(iws);
 
@@ -1732,6 +1851,94 @@ void FilterEvents::filterEventsBySplitters(double progressamount) {
   return;
 }
 
+/** Filter the events into output workspaces that are saved to files. The
+ * targets are processed a batch at a time: the output workspaces of a batch
+ * are created, filled, saved and released before moving to the next, so that
+ * the input workspace and a single batch of outputs are the only event data
+ * held in memory.
+ */
+void FilterEvents::filterEventsToFiles() {
+  m_progress = 0.2;
+  progress(m_progress, "Importing TOF corrections. ");
+  setupDetectorTOFCalibration();
+
+  const int maxInMemory = getProperty("MaxOutputWorkspacesInMemory");
+  const auto batchSize = static_cast<size_t>(maxInMemory);
+  const std::vector<int> targets(m_targetWorkspaceIndexSet.begin(),
+                                 m_targetWorkspaceIndexSet.end());
+  const size_t numBatches = (targets.size() + batchSize - 1) / batchSize;
+  std::vector<std::string> filenames;
+
+  for (size_t batch = 0; batch < numBatches; ++batch) {
+    const double progressStart = 0.3 + 0.7 * static_cast<double>(batch) /
+                                           static_cast<double>(numBatches);
+    const double progressEnd = 0.3 + 0.7 * static_cast<double>(batch + 1) /
+                                         static_cast<double>(numBatches);
+    const auto first = targets.begin() + batch * batchSize;
+    const auto last =
+        targets.begin() + std::min(targets.size(), (batch + 1) * batchSize);
+    createOutputWorkspacesSplitters(std::set<int>(first, last));
+
+    std::vector<Kernel::TimeSeriesProperty<int> *> int_tsp_vector;
+    std::vector<Kernel::TimeSeriesProperty<double> *> dbl_tsp_vector;
+    std::vector<Kernel::TimeSeriesProperty<bool> *> bool_tsp_vector;
+    std::vector<Kernel::TimeSeriesProperty<string> *> string_tsp_vector;
+    copyNoneSplitLogs(int_tsp_vector, dbl_tsp_vector, bool_tsp_vector,
+                      string_tsp_vector);
+
+    progress(progressStart, "Filter Events.");
+    filterEventsBySplitters(progressStart +
+                            0.5 * (progressEnd - progressStart) - 0.1);
+    std::vector<Kernel::TimeSeriesProperty<int> *> split_tsp_vector;
+    generateSplitterTSPalpha(split_tsp_vector);
+    mapSplitterTSPtoWorkspaces(split_tsp_vector);
+    splitTimeSeriesLogs(int_tsp_vector, dbl_tsp_vector, bool_tsp_vector,
+                        string_tsp_vector);
+
+    saveOutputWorkspaces(progressStart + 0.5 * (progressEnd - progressStart),
+                         progressEnd);
+    for (const auto &output : m_outputWorkspacesMap) {
+      const auto filename = m_outputFilenames.find(output.first);
+      if (filename != m_outputFilenames.end())
+        filenames.push_back(filename->second);
+    }
+    m_outputWorkspacesMap.clear();
+  }
+  setProperty("OutputFilenames", filenames);
+}
+
+/** Save the output workspaces currently in memory to their files with
+ * SaveNexusProcessed. Workspaces without a file, such as the unfiltered
+ * events when the outputs are indexed from 1, are not saved.
+ * @param progressStart :: progress at the start of saving
+ * @param progressEnd :: progress at the end of saving
+ */
+void FilterEvents::saveOutputWorkspaces(const double progressStart,
+                                        const double progressEnd) {
+  Goniometer inputGonio = m_eventWS->run().getGoniometer();
+  const double step =
+      (progressEnd - progressStart) /
+      static_cast<double>(std::max(m_outputWorkspacesMap.size(), size_t(1)));
+  double start = progressStart;
+  for (auto &output : m_outputWorkspacesMap) {
+    const auto filename = m_outputFilenames.find(output.first);
+    if (filename == m_outputFilenames.end())
+      continue;
+    try {
+      output.second->mutableRun().setGoniometer(inputGonio, true);
+    } catch (std::runtime_error &) {
+      g_log.warning("Cannot set goniometer.");
+    }
+    auto save = createChildAlgorithm("SaveNexusProcessed", start, start + step);
+    save->setProperty("InputWorkspace", output.second);
+    save->setProperty("Filename", filename->second);
+    save->executeAsChildAlg();
+    g_log.information() << "Saved output workspace of target "
+                        << output.first << " to " << filename->second << "\n";
+    start += step;
+  }
+}
+
 /** Split events by splitters represented by vector
  */
 void FilterEvents::filterEventsByVectorSplitters(double progressamount) {
@@ -1965,6 +2172,12 @@ void FilterEvents::mapSplitterTSPtoWorkspaces(
         outws->mutableRun().addProperty(split_tsp_vec[miter->first], true);
       }
     }
+    // Delete the logs of targets without a workspace in memory
+    for (int itarget = 0; itarget < static_cast<int>(split_tsp_vec.size());
+         ++itarget) {
+      if (m_outputWorkspacesMap.count(itarget) == 0)
+        delete split_tsp_vec[itarget];
+    }
   } else {
     // Either Table-type or Matrix-type splitters
     for (int itarget = 0; itarget < static_cast<int>(split_tsp_vec.size());
@@ -196,10 +196,14 @@ size_t findXIndex(const std::vector<double> &vecx, double x) {
 
 enum PeakFitResult { NOSIGNAL, LOWPEAK, OUTOFBOUND, GOOD };
 
+/// Number of consecutive spectra fitted in order with StartFromNeighbourFits
+const size_t NEIGHBOUR_FIT_BLOCK_SIZE = 64;
+
 //----------------------------------------------------------------------------------------------
 FitPeaks::FitPeaks()
-    : m_fitPeaksFromRight(true), m_fitIterations(50), m_numPeaksToFit(0),
-      m_minPeakHeight(20.), m_bkgdSimga(1.), m_peakPosTolCase234(false) {}
+    : m_fitPeaksFromRight(true), m_startFromNeighbourFits(false),
+      m_fitIterations(50), m_numPeaksToFit(0), m_minPeakHeight(20.),
+      m_bkgdSimga(1.), m_peakPosTolCase234(false) {}
 
 //----------------------------------------------------------------------------------------------
 /** initialize the properties
@@ -292,11 +296,18 @@ void FitPeaks::init() {
                   "Name of the an optional workspace, whose each column "
                   "corresponds to given peak parameter names"
                   ", and each row corresponds to a subset of spectra.");
+  declareProperty("StartFromNeighbourFits", false,
+                  "If true, the fit of each peak starts from the fitted "
+                  "parameters of the same peak in the previous spectrum. The "
+                  "spectra are then fitted in parallel in blocks of "
+                  "consecutive workspace indexes, which suits instruments "
+                  "whose neighbouring pixels see similar peaks.");
 
   std::string startvaluegrp("Starting Parameters Setup");
   setPropertyGroup("PeakParameterNames", startvaluegrp);
   setPropertyGroup("PeakParameterValues", startvaluegrp);
   setPropertyGroup("PeakParameterValueTable", startvaluegrp);
+  setPropertyGroup("StartFromNeighbourFits", startvaluegrp);
 
   // optimization setup
   declareProperty("FitFromRight", true,
@@ -530,6 +541,7 @@ void FitPeaks::processInputs() {
   m_costFunction = getPropertyValue("CostFunction");
   m_fitPeaksFromRight = getProperty("FitFromRight");
   m_constrainPeaksPosition = getProperty("ConstrainPeakPositions");
+  m_startFromNeighbourFits = getProperty("StartFromNeighbourFits");
   m_fitIterations = getProperty("MaxFitIterations");
 
   // Peak centers, tolerance and fitting range
@@ -909,33 +921,46 @@ FitPeaks::fitPeaks() {
   std::vector<boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult>>
       fit_result_vector(num_fit_result);
 
+  // Spectra starting from their neighbours' fits are fitted in order within
+  // a block. The blocks do not depend on the number of threads so that the
+  // results do not either.
+  const size_t block_size =
+      m_startFromNeighbourFits ? NEIGHBOUR_FIT_BLOCK_SIZE : 1;
+  const auto num_blocks =
+      static_cast<int>((num_fit_result + block_size - 1) / block_size);
+
   // cppcheck-suppress syntaxError
   PRAGMA_OMP(parallel for schedule(dynamic, 1) )
-  for (auto wi = static_cast<int>(m_startWorkspaceIndex);
-       wi <= static_cast<int>(m_stopWorkspaceIndex); ++wi) {
+  for (int block = 0; block < num_blocks; ++block) {
 
     PARALLEL_START_INTERUPT_REGION
 
-    // peaks to fit
-    std::vector<double> expected_peak_centers =
-        getExpectedPeakPositions(static_cast<size_t>(wi));
-
-    // initialize output for this
-    size_t numfuncparams =
-        m_peakFunction->nParams() + m_bkgdFunction->nParams();
-    boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result =
-        boost::make_shared<FitPeaksAlgorithm::PeakFitResult>(m_numPeaksToFit,
-                                                             numfuncparams);
-
-    fitSpectrumPeaks(static_cast<size_t>(wi), expected_peak_centers,
-                     fit_result);
-
-    PARALLEL_CRITICAL(FindPeaks_WriteOutput) {
-      writeFitResult(static_cast<size_t>(wi), expected_peak_centers,
-                     fit_result);
-      fit_result_vector[wi - m_startWorkspaceIndex] = fit_result;
+    // fitted parameters of each peak in the previous spectrum of the block
+    std::vector<std::vector<double>> neighbour_parameters(m_numPeaksToFit);
+    const size_t block_start =
+        m_startWorkspaceIndex + static_cast<size_t>(block) * block_size;
+    const size_t block_stop =
+        std::min(block_start + block_size, m_stopWorkspaceIndex + 1);
+    for (size_t wi = block_start; wi < block_stop; ++wi) {
+      // peaks to fit
+      std::vector<double> expected_peak_centers = getExpectedPeakPositions(wi);
+
+      // initialize output for this
+      size_t numfuncparams =
+          m_peakFunction->nParams() + m_bkgdFunction->nParams();
+      boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result =
+          boost::make_shared<FitPeaksAlgorithm::PeakFitResult>(m_numPeaksToFit,
+                                                               numfuncparams);
+
+      fitSpectrumPeaks(wi, expected_peak_centers, fit_result,
+                       neighbour_parameters);
+
+      PARALLEL_CRITICAL(FindPeaks_WriteOutput) {
+        writeFitResult(wi, expected_peak_centers, fit_result);
+        fit_result_vector[wi - m_startWorkspaceIndex] = fit_result;
+      }
+      prog.report();
     }
-    prog.report();
 
     PARALLEL_END_INTERUPT_REGION
   }
@@ -993,10 +1018,17 @@ double numberCounts(const Histogram &histogram, const double xmin,
 
 //----------------------------------------------------------------------------------------------
 /** Fit peaks across one single spectrum
+ * @param wi :: workspace index
+ * @param expected_peak_centers :: expected positions of the peaks
+ * @param fit_result :: (output) fitting result of the peaks
+ * @param neighbour_parameters :: (in/out) fitted parameters of each peak in
+ * the previous spectrum, empty where there are none. The peaks that fit well
+ * leave their parameters for the next spectrum.
  */
 void FitPeaks::fitSpectrumPeaks(
     size_t wi, const std::vector<double> &expected_peak_centers,
-    boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result) {
+    boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result,
+    std::vector<std::vector<double>> &neighbour_parameters) {
   if (numberCounts(m_inputMatrixWS->histogram(wi)) <= m_minPeakHeight) {
     for (size_t i = 0; i < fit_result->getNumberPeaks(); ++i)
       fit_result->setBadRecord(i, -1.);
@@ -1042,9 +1074,13 @@ void FitPeaks::fitSpectrumPeaks(
     for (size_t i = 0; i < bkgdfunction->nParams(); ++i)
       bkgdfunction->setParameter(0, 0.);
 
-    // set the peak parameters from last good fit - override peak center
-    for (size_t i = 0; i < lastGoodPeakParameters.size(); ++i)
-      peakfunction->setParameter(i, lastGoodPeakParameters[i]);
+    // set the peak parameters from the same peak in the previous spectrum or
+    // from the last good fit - override peak center
+    const std::vector<double> &neighbour = neighbour_parameters[peak_index];
+    const std::vector<double> &start_parameters =
+        neighbour.empty() ? lastGoodPeakParameters : neighbour;
+    for (size_t i = 0; i < start_parameters.size(); ++i)
+      peakfunction->setParameter(i, start_parameters[i]);
     double expected_peak_pos = expected_peak_centers[peak_index];
     peakfunction->setCentre(expected_peak_pos);
 
@@ -1057,7 +1093,9 @@ void FitPeaks::fitSpectrumPeaks(
       std::pair<double, double> peak_window_i =
           getPeakFitWindow(wi, peak_index);
 
+      // the width of a neighbour's fit is a better guess than an observed one
       bool observe_peak_width_flag =
+          neighbour.empty() &&
           decideToEstimatePeakWidth(!foundAnyPeak, peakfunction);
 
       if (observe_peak_width_flag &&
@@ -1075,6 +1113,7 @@ void FitPeaks::fitSpectrumPeaks(
         foundAnyPeak = true;
         for (size_t i = 0; i < lastGoodPeakParameters.size(); ++i)
           lastGoodPeakParameters[i] = peakfunction->getParameter(i);
+        neighbour_parameters[peak_index] = lastGoodPeakParameters;
       }
     }
     foundAnyPeak = true;
@@ -33,6 +33,63 @@ namespace Mantid {
 namespace Algorithms {
 DECLARE_ALGORITHM(GenerateEventsFilter)
 
+namespace {
+/** Read the values of a log into a vector, as returned by nthValue. An
+ * unfiltered log is copied in one pass.
+ * @param log :: The log to read
+ */
+std::vector<double> readLogValues(const TimeSeriesProperty<double> &log) {
+  if (log.size() == log.realSize())
+    return log.valuesAsVector();
+  std::vector<double> values(static_cast<size_t>(log.size()));
+  for (int i = 0; i < log.size(); ++i)
+    values[static_cast<size_t>(i)] = log.nthValue(i);
+  return values;
+}
+
+/** Find the log value range holding each of the values from first to last.
+ * A range holds the values from its lower boundary up to, but not including,
+ * its upper boundary. The ranges made by processMultipleValueFilters have
+ * equal widths and each one starts where the previous one stops, so the range
+ * of a value is estimated from its distance to the first boundary and then
+ * checked against its own boundaries, instead of binary searching all of them.
+ * @param values :: The log values
+ * @param first :: Index of the first value to look up
+ * @param last :: Index of the last value to look up
+ * @param ranges :: Each 2i and 2i+1 pair is the lower and upper boundary of
+ * the i-th range
+ * @return The index in ranges of the lower boundary of the range holding each
+ * value, or ranges.size() + 1 if no range holds it
+ */
+std::vector<size_t> findValueRanges(const std::vector<double> &values,
+                                    const int first, const int last,
+                                    const std::vector<double> &ranges) {
+  const size_t outrange = ranges.size() + 1;
+  std::vector<size_t> result(static_cast<size_t>(last - first + 1), outrange);
+  const size_t numranges = ranges.size() / 2;
+  if (numranges == 0)
+    return result;
+
+  const double lower = ranges.front();
+  const double upper = ranges.back();
+  const double width = (upper - lower) / static_cast<double>(numranges);
+  for (int i = first; i <= last; ++i) {
+    const double value = values[static_cast<size_t>(i)];
+    if (!(value >= lower && value < upper))
+      continue;
+    auto range = static_cast<size_t>((value - lower) / width);
+    range = std::min(range, numranges - 1);
+    // Correct for the rounding of the estimate and of the boundaries
+    while (range > 0 && value < ranges[2 * range])
+      --range;
+    while (range + 1 < numranges && value >= ranges[2 * range + 1])
+      ++range;
+    result[static_cast<size_t>(i - first)] = 2 * range;
+  }
+  return result;
+}
+} // namespace
+
 /** Constructor
  */
 GenerateEventsFilter::GenerateEventsFilter()
@@ -41,7 +98,8 @@ GenerateEventsFilter::GenerateEventsFilter()
       m_timeUnitConvertFactorToNS(0.), m_dblLog(nullptr), m_intLog(nullptr),
       m_logAtCentre(false), m_logTimeTolerance(0.), m_forFastLog(false),
       m_splitters(), m_vecSplitterTime(), m_vecSplitterGroup(),
-      m_useParallel(false), m_vecSplitterTimeSet(), m_vecGroupIndexSet() {}
+      m_useParallel(false), m_vecSplitterTimeSet(), m_vecGroupIndexSet(),
+      m_logTimes(), m_logValues() {}
 
 /** Declare input
  */
@@ -520,6 +578,10 @@ void GenerateEventsFilter::setFilterByLogValue(std::string logname) {
     if (m_runEndTime > m_dblLog->lastTime())
       m_dblLog->addValue(m_runEndTime, 0.);
     m_dblLog->eliminateDuplicates();
+
+    // Read the log once, rather than entry by entry while making the filters
+    m_logTimes = m_dblLog->timesAsVector();
+    m_logValues = readLogValues(*m_dblLog);
   } else {
     g_log.debug("Attempting to remove duplicates in integer series log.");
     m_intLog->addValue(m_runEndTime, 0);
@@ -840,7 +902,7 @@ void GenerateEventsFilter::makeFilterBySingleValue(
   for (int i = 0; i < m_dblLog->size(); i++) {
     lastTime = currT;
     // The new entry
-    currT = m_dblLog->nthTime(i);
+    currT = m_logTimes[i];
 
     // A good value?
     isGood = identifyLogEntry(i, currT, lastGood, min, max, startTime, stopTime,
@@ -914,7 +976,7 @@ bool GenerateEventsFilter::identifyLogEntry(
     const Types::Core::DateAndTime &startT,
     const Types::Core::DateAndTime &stopT, const bool &filterIncrease,
     const bool &filterDecrease) {
-  double val = m_dblLog->nthValue(index);
+  double val = m_logValues[index];
 
   // Identify by time and value
   bool isgood =
@@ -926,10 +988,10 @@ bool GenerateEventsFilter::identifyLogEntry(
     double diff;
     if (index < numlogentries - 1) {
       // For a non-last log entry
-      diff = m_dblLog->nthValue(index + 1) - val;
+      diff = m_logValues[index + 1] - val;
     } else {
       // Last log entry: follow the last direction
-      diff = val - m_dblLog->nthValue(index - 1);
+      diff = val - m_logValues[index - 1];
     }
 
     if (diff > 0 && filterIncrease)
@@ -1081,10 +1143,12 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesParallel(
   m_vecSplitterTimeSet.clear();
   m_vecGroupIndexSet.clear();
   for (int i = 0; i < numThreads; ++i) {
+    // A splitter needs at most two boundaries per log entry of the thread
+    const auto partsize = static_cast<size_t>(vecEnd[i] - vecStart[i] + 1);
     vector<DateAndTime> tempvectimes;
-    tempvectimes.reserve(m_dblLog->size());
+    tempvectimes.reserve(2 * partsize);
     vector<int> tempvecgroup;
-    tempvecgroup.reserve(m_dblLog->size());
+    tempvecgroup.reserve(2 * partsize);
     m_vecSplitterTimeSet.push_back(tempvectimes);
     m_vecGroupIndexSet.push_back(tempvecgroup);
   }
@@ -1199,22 +1263,32 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
   // size_t progslot = 0;
 
   g_log.information() << "Log time coverage (index: " << istart << ", " << iend
-                      << ") from " << m_dblLog->nthTime(istart) << ", "
-                      << m_dblLog->nthTime(iend) << "\n";
+                      << ") from " << m_logTimes[istart] << ", "
+                      << m_logTimes[iend] << "\n";
 
   DateAndTime laststoptime(0);
   int lastlogindex = m_dblLog->size() - 1;
 
   int prevDirection = determineChangingDirection(istart);
 
+  // Find the value range and the group of all entries in one pass
+  const std::vector<size_t> valueRanges =
+      findValueRanges(m_logValues, istart, iend, logvalueranges);
+  std::vector<int> rangeGroups(logvalueranges.size() / 2, 0);
+  for (const auto &indexgroup : indexwsindexmap) {
+    if (indexgroup.first < rangeGroups.size())
+      rangeGroups[indexgroup.first] = indexgroup.second;
+  }
+  const bool debug = g_log.is(Logger::Priority::PRIO_DEBUG);
+
   for (int i = istart; i <= iend; i++) {
     // Initialize status flags and new entry
     bool breakloop = false;
     bool createsplitter = false;
 
     lastTime = currTime;
-    currTime = m_dblLog->nthTime(i);
-    double currValue = m_dblLog->nthValue(i);
+    currTime = m_logTimes[i];
+    double currValue = m_logValues[i];
 
     // Filter out by time and direction (optional)
     bool intime = true;
@@ -1238,7 +1312,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
     int direction = 0;
     if (i < lastlogindex) {
       // Not the last log entry
-      double diff = m_dblLog->nthValue(i + 1) - m_dblLog->nthValue(i);
+      double diff = m_logValues[i + 1] - m_logValues[i];
       if (diff > 0)
         direction = 1;
       else if (diff < 0)
@@ -1273,7 +1347,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
       // Treat the log entry based on: changing direction (+ time range)
       if (correctdir) {
         // Check this value whether it falls into any range
-        size_t index = searchValue(logvalueranges, currValue);
+        size_t index = valueRanges[i - istart];
 
         bool valueWithinMinMax = true;
         if (index > logvalueranges.size()) {
@@ -1281,7 +1355,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
           valueWithinMinMax = false;
         }
 
-        if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
+        if (debug) {
           stringstream dbss;
           dbss << "[DBx257] Examine Log Index " << i
                << ", Value = " << currValue << ", Data Range Index = " << index
@@ -1302,7 +1376,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
         if (valueWithinMinMax) {
           if (index % 2 == 0) {
             // [Situation] Falls in the interval
-            currindex = indexwsindexmap[index / 2];
+            currindex = rangeGroups[index / 2];
 
             if (currindex != lastindex && start.totalNanoseconds() == 0) {
               // Group index is different from last and start is not set up: new
@@ -1329,7 +1403,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
             } else {
               // An impossible situation
               std::stringstream errmsg;
-              double lastvalue = m_dblLog->nthValue(i - 1);
+              double lastvalue = m_logValues[i - 1];
               errmsg << "Impossible to have currindex == lastindex == "
                      << currindex
                      << ", while start is not init.  Log Index = " << i
@@ -1405,8 +1479,8 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
   // time
   // To make it non-empty
   if (vecSplitTime.empty()) {
-    start = m_dblLog->nthTime(istart);
-    stop = m_dblLog->nthTime(iend);
+    start = m_logTimes[istart];
+    stop = m_logTimes[iend];
     lastindex = -1;
     makeSplitterInVector(vecSplitTime, vecSplitGroup, start, stop, lastindex,
                          tol_ns, laststoptime);
@@ -1576,47 +1650,6 @@ void GenerateEventsFilter::processIntegerValueFilter(int minvalue, int maxvalue,
                       << m_filterInfoWS->rowCount() << ".\n";
 }
 
-//----------------------------------------------------------------------------------------------
-/** Do a binary search in the following list
- * Warning: if the vector is not sorted, the error will happen.
- * This algorithm won't guarantee for it
- *
- * @param sorteddata :: Sorted data.
- * @param value :: Value to look up.
- *
- * return:  if value is out of range, then return datarange.size() + 1
- */
-size_t GenerateEventsFilter::searchValue(const std::vector<double> &sorteddata,
-                                         double value) {
-  // Case of out-of-boundary
-  size_t numdata = sorteddata.size();
-  size_t outrange = numdata + 1;
-  if (numdata == 0)
-    return outrange;
-  else if (value < sorteddata.front() || value > sorteddata.back())
-    return outrange;
-
-  // Binary search
-  size_t index = static_cast<size_t>(
-      std::lower_bound(sorteddata.begin(), sorteddata.end(), value) -
-      sorteddata.begin());
-
-  if (value < sorteddata[index] && index % 2 == 1) {
-    // value to search is less than the boundary: use the index of the one just
-    // smaller to the value to search
-    --index;
-  } else if (value == sorteddata[index] && index % 2 == 1) {
-    // value to search is on the boudary, i..e, a,b,b,c,c,....,x,x,y
-    ++index;
-
-    // return if out of range
-    if (index == sorteddata.size())
-      return outrange;
-  }
-
-  return index;
-}
-
 //----------------------------------------------------------------------------------------------
 /** Determine starting value changing direction
  */
@@ -1626,7 +1659,7 @@ int GenerateEventsFilter::determineChangingDirection(int startindex) {
   // Search to earlier entries
   int index = startindex;
   while (direction == 0 && index > 0) {
-    double diff = m_dblLog->nthValue(index) - m_dblLog->nthValue(index - 1);
+    double diff = m_logValues[index] - m_logValues[index - 1];
     if (diff > 0)
       direction = 1;
     else if (diff < 0)
@@ -1642,7 +1675,7 @@ int GenerateEventsFilter::determineChangingDirection(int startindex) {
   index = startindex;
   int maxindex = m_dblLog->size() - 1;
   while (direction == 0 && index < maxindex) {
-    double diff = m_dblLog->nthValue(index + 1) - m_dblLog->nthValue(index);
+    double diff = m_logValues[index + 1] - m_logValues[index];
     if (diff > 0)
       direction = 1;
     else if (diff < 0)
@@ -17,6 +17,7 @@
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
@@ -430,23 +431,34 @@ void GeneratePeaks::generatePeaks(
                    std::vector<std::pair<double, API::IFunction_sptr>>>
         &functionmap,
     API::MatrixWorkspace_sptr dataWS) {
-  // Calcualte function
-  std::map<specnum_t,
-           std::vector<std::pair<double, API::IFunction_sptr>>>::const_iterator
-      mapiter;
-  for (mapiter = functionmap.begin(); mapiter != functionmap.end(); ++mapiter) {
-    // Get spec id and translated to wsindex in the output workspace
-    specnum_t specid = mapiter->first;
-    specnum_t wsindex;
-    if (m_newWSFromParent)
+  // Translate the spectrum numbers to workspace indices in the output
+  // workspace up front, so that the spectra can be filled in parallel
+  using PeakList = std::vector<std::pair<double, API::IFunction_sptr>>;
+  std::vector<std::pair<size_t, const PeakList *>> spectra;
+  spectra.reserve(functionmap.size());
+  for (const auto &item : functionmap) {
+    const specnum_t specid = item.first;
+    specnum_t wsindex = 0;
+    if (m_newWSFromParent) {
       wsindex = specid;
-    else
-      wsindex = m_SpectrumMap[specid];
+    } else {
+      const auto found = m_SpectrumMap.find(specid);
+      if (found != m_SpectrumMap.end())
+        wsindex = found->second;
+    }
+    spectra.emplace_back(static_cast<size_t>(wsindex), &item.second);
+  }
 
-    const std::vector<std::pair<double, API::IFunction_sptr>> &vec_centrefunc =
-        mapiter->second;
-    size_t numpeaksinspec = mapiter->second.size();
+  const auto numSpectra = static_cast<int64_t>(spectra.size());
+  PARALLEL_FOR_IF(Kernel::threadSafe(*dataWS))
+  for (int64_t ispec = 0; ispec < numSpectra; ++ispec) {
+    PARALLEL_START_INTERUPT_REGION
+    const size_t wsindex = spectra[ispec].first;
+    const PeakList &vec_centrefunc = *spectra[ispec].second;
+    size_t numpeaksinspec = vec_centrefunc.size();
 
+    const auto &X = dataWS->x(wsindex);
+    auto &dataY = dataWS->mutableY(wsindex);
     for (size_t ipeak = 0; ipeak < numpeaksinspec; ++ipeak) {
       const std::pair<double, API::IFunction_sptr> &centrefunc =
           vec_centrefunc[ipeak];
@@ -457,7 +469,6 @@ void GeneratePeaks::generatePeaks(
       double fwhm = thispeak->fwhm();
 
       //
-      const auto &X = dataWS->x(wsindex);
       double leftbound = centre - m_numPeakWidth * fwhm;
       if (ipeak > 0) {
         // Not left most peak.
@@ -495,13 +506,14 @@ void GeneratePeaks::generatePeaks(
       std::size_t offset = (left - X.begin());
       std::size_t numY = values.size();
 
-      auto &dataY = dataWS->mutableY(wsindex);
       for (std::size_t i = 0; i < numY; i++) {
         dataY[i + offset] += values[i];
       }
 
     } // ENDFOR(ipeak)
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
 }
 
 //----------------------------------------------------------------------------------------------
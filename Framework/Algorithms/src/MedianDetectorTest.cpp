@@ -238,8 +238,8 @@ API::MatrixWorkspace_sptr MedianDetectorTest::getSolidAngles(int firstSpec,
  * @returns The number failed.
  */
 int MedianDetectorTest::maskOutliers(
-    const std::vector<double> medianvec, API::MatrixWorkspace_sptr countsWS,
-    std::vector<std::vector<size_t>> indexmap) {
+    const std::vector<double> &medianvec, API::MatrixWorkspace_sptr countsWS,
+    const std::vector<std::vector<size_t>> &indexmap) {
 
   // Fractions of the median
   const double out_lo = getProperty("LowOutlier");
@@ -256,33 +256,37 @@ int MedianDetectorTest::maskOutliers(
   auto &spectrumInfo = countsWS->mutableSpectrumInfo();
 
   for (size_t i = 0; i < indexmap.size(); ++i) {
-    std::vector<size_t> &hists = indexmap[i];
-    double median = medianvec[i];
-
-    PARALLEL_FOR_IF(Kernel::threadSafe(*countsWS))
-    for (int j = 0; j < static_cast<int>(hists.size()); ++j) { // NOLINT
+    const std::vector<size_t> &hists = indexmap[i];
+    const double median = medianvec[i];
+    const auto nhists = static_cast<int>(hists.size());
+
+    // The outliers are found in parallel and then masked together, as
+    // SpectrumInfo::setMasked must not be called from several threads
+    std::vector<char> isOutlier(hists.size(), 0);
+    int numAlreadyMasked(0);
+    PRAGMA_OMP(parallel for reduction(+ : numAlreadyMasked) if (Kernel::threadSafe(*countsWS)))
+    for (int j = 0; j < nhists; ++j) { // NOLINT
       const double value = countsWS->y(hists[j])[0];
       if ((value == 0.) && checkForMask) {
         if (spectrumInfo.hasDetectors(hists[j]) &&
             spectrumInfo.isMasked(hists[j])) {
-          numFailed -= 1; // it was already masked
+          ++numAlreadyMasked;
         }
       }
-      if ((value < out_lo * median) && (value > 0.0)) {
-        countsWS->getSpectrum(hists[j]).clearData();
-        PARALLEL_CRITICAL(setMasked) {
-          spectrumInfo.setMasked(hists[j], true);
-          ++numFailed;
-        }
-      } else if (value > out_hi * median) {
+      if (((value < out_lo * median) && (value > 0.0)) ||
+          (value > out_hi * median)) {
+        isOutlier[j] = 1;
+      }
+    }
+    numFailed -= numAlreadyMasked;
+
+    for (size_t j = 0; j < hists.size(); ++j) {
+      if (isOutlier[j]) {
         countsWS->getSpectrum(hists[j]).clearData();
-        PARALLEL_CRITICAL(setMasked) {
-          spectrumInfo.setMasked(hists[j], true);
-          ++numFailed;
-        }
+        spectrumInfo.setMasked(hists[j], true);
+        ++numFailed;
       }
     }
-    PARALLEL_CHECK_INTERUPT_REGION
   }
 
   return numFailed;
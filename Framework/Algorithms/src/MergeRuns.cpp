@@ -303,39 +303,62 @@ void MergeRuns::execEvent() {
   // Make the addition tables, or throw an error if there was a problem.
   this->buildAdditionTables();
 
-  // Create a new output event workspace, by copying the first WS in the list
+  // Create a new output event workspace, with the spectra of the first WS in
+  // the list
   EventWorkspace_sptr inputWS = m_inEventWS[0];
   auto outWS =
       create<EventWorkspace>(*inputWS, m_outputSize, inputWS->binEdges(0));
+
+  // Collect the event lists to add into each output spectrum, as the tables
+  // say to do. Spectra not in the first workspace are added at the end.
+  std::vector<std::vector<const EventList *>> outputLists(m_outputSize);
   const auto inputSize = inputWS->getNumberHistograms();
   for (size_t i = 0; i < inputSize; ++i)
-    outWS->getSpectrum(i) = inputWS->getSpectrum(i);
-
-  int64_t n = m_inEventWS.size() - 1;
-  m_progress = std::make_unique<Progress>(this, 0.0, 1.0, n);
-
-  // Note that we start at 1, since we already have the 0th workspace
+    outputLists[i].push_back(&inputWS->getSpectrum(i));
   auto current = inputSize;
   for (size_t workspaceNum = 1; workspaceNum < m_inEventWS.size();
        workspaceNum++) {
     const auto &addee = *m_inEventWS[workspaceNum];
     const auto &table = m_tables[workspaceNum - 1];
-
-    // Add all the event lists together as the table says to do
     for (auto &WI : table) {
       int64_t inWI = WI.first;
       int64_t outWI = WI.second;
       if (outWI >= 0) {
-        outWS->getSpectrum(outWI) += addee.getSpectrum(inWI);
+        outputLists[outWI].push_back(&addee.getSpectrum(inWI));
       } else {
-        outWS->getSpectrum(current) = addee.getSpectrum(inWI);
+        outputLists[current].push_back(&addee.getSpectrum(inWI));
         ++current;
       }
     }
+  }
 
-    // Now we add up the runs
-    outWS->mutableRun() += addee.run();
+  m_progress = std::make_unique<Progress>(this, 0.0, 1.0,
+                                          m_outputSize + m_inEventWS.size());
+
+  // Add the event lists of each output spectrum in one go, each output list
+  // being allocated once, in parallel over the spectra
+  const auto outputSize = static_cast<int64_t>(m_outputSize);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*outWS))
+  for (int64_t outWI = 0; outWI < outputSize; ++outWI) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto &lists = outputLists[outWI];
+    auto &outEL = outWS->getSpectrum(outWI);
+    // The first list added gives the spectrum number, detectors and X
+    const EventList &first = *lists.front();
+    outEL.copyInfoFrom(first);
+    outEL.setSharedX(first.sharedX());
+    outEL.setSharedDx(first.sharedDx());
+    outEL.mergeSorted(lists);
+    m_progress->report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
 
+  // Now we add up the runs
+  auto &run = outWS->mutableRun();
+  for (size_t workspaceNum = 1; workspaceNum < m_inEventWS.size();
+       workspaceNum++) {
+    run += m_inEventWS[workspaceNum]->run();
     m_progress->report();
   }
 
@@ -402,7 +425,8 @@ void MergeRuns::execHistogram(const std::vector<std::string> &inputs) {
       if (isScanning)
         outWS = buildScanningOutputWorkspace(outWS, addee);
       else
-        outWS = outWS + addee;
+        // outWS is not an input, so the addee can be added to it in place
+        outWS += addee;
       sampleLogsBehaviour.setUpdatedSampleLogs(outWS);
       sampleLogsBehaviour.readdSampleLogToWorkspace(addee);
     } catch (std::invalid_argument &e) {
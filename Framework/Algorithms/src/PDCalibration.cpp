@@ -236,6 +236,11 @@ void PDCalibration::init() {
       "(highest Y value position) and "
       "the peak width either estimted by observation or calculate.");
 
+  declareProperty("StartFromNeighbourFits", false,
+                  "If true, the fit of each peak starts from the fitted "
+                  "parameters of the same peak in the previous spectrum. See "
+                  "FitPeaks.");
+
   declareProperty("CalibrationParameters", "DIFC",
                   boost::make_shared<StringListValidator>(modes),
                   "Select calibration parameters to fit.");
@@ -273,6 +278,7 @@ void PDCalibration::init() {
   setPropertyGroup("MinimumPeakHeight", fitPeaksGroup);
   setPropertyGroup("MaxChiSq", fitPeaksGroup);
   setPropertyGroup("ConstrainPeakPositions", fitPeaksGroup);
+  setPropertyGroup("StartFromNeighbourFits", fitPeaksGroup);
 
   // make group for type of calibration
   std::string calGroup("Calibration Type");
@@ -461,6 +467,8 @@ void PDCalibration::exec() {
   algFitPeaks->setProperty(
       "ConstrainPeakPositions",
       constrainPeakPosition); // TODO Pete: need to test this option
+  algFitPeaks->setProperty<bool>("StartFromNeighbourFits",
+                                 getProperty("StartFromNeighbourFits"));
   //  optimization setup // TODO : need to test LM or LM-MD
   algFitPeaks->setProperty("Minimizer", "Levenberg-Marquardt");
   algFitPeaks->setProperty("CostFunction", "Least squares");
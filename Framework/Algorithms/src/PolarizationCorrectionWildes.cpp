@@ -15,6 +15,7 @@
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/StringTokenizer.h"
 
 #include <Eigen/Dense>
@@ -63,18 +64,29 @@ void checkInputExists(const Mantid::API::MatrixWorkspace_sptr &ws,
   }
 }
 
+/// The matrices of the full corrections of a wavelength bin. They depend
+/// only on the efficiencies, so they are calculated once per bin and applied
+/// to all the spectra.
+struct FourInputsMatrices {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  /// The correction of the intensities
+  Eigen::Matrix4d correction;
+  /// The correction squared element-wise, propagating the intensity errors
+  Eigen::Matrix4d squaredCorrection;
+  /// The derivatives of the correction with respect to P2, P1, F2 and F1,
+  /// multiplied by the errors of the efficiencies
+  Eigen::Matrix4d errorP2;
+  Eigen::Matrix4d errorP1;
+  Eigen::Matrix4d errorF2;
+  Eigen::Matrix4d errorF1;
+};
+
+using FourInputsMatricesVector =
+    std::vector<FourInputsMatrices,
+                Eigen::aligned_allocator<FourInputsMatrices>>;
+
 /**
- * Calculate the corrected intensities and error estimates.
- * @param corrected an output vector for R00, R01, R10 and R11
- * @param errors an output vector for the error estimates
- * @param ppy intensity I00
- * @param ppyE error of ppy
- * @param pmy intensity I01
- * @param pmyE error of pmy
- * @param mpy intensity I10
- * @param mpyE error of mpy
- * @param mmy intensity I11
- * @param mmyE error of mmy
+ * Calculate the correction matrices of a wavelength bin.
  * @param f1 polarizer efficiency
  * @param f1E error of f1
  * @param f2 analyzer efficiency
@@ -83,13 +95,12 @@ void checkInputExists(const Mantid::API::MatrixWorkspace_sptr &ws,
  * @param p1E error of p1
  * @param p2 analyzer flipper efficiency
  * @param p2E error of p2
+ * @return the correction and error matrices
  */
-void fourInputsCorrectedAndErrors(
-    Eigen::Vector4d &corrected, Eigen::Vector4d &errors, const double ppy,
-    const double ppyE, const double pmy, const double pmyE, const double mpy,
-    const double mpyE, const double mmy, const double mmyE, const double f1,
-    const double f1E, const double f2, const double f2E, const double p1,
-    const double p1E, const double p2, const double p2E) {
+FourInputsMatrices fourInputsMatrices(const double f1, const double f1E,
+                                      const double f2, const double f2E,
+                                      const double p1, const double p1E,
+                                      const double p2, const double p2E) {
   using namespace boost::math;
   // Note that f1 and f2 correspond to 1-F1 and 1-F2 in [Wildes, 1999].
   // These are inverted forms of the efficiency matrices.
@@ -113,11 +124,12 @@ void fourInputsCorrectedAndErrors(
   Eigen::Matrix4d P2m;
   P2m << diag4, off4, 0., 0., off4, diag4, 0., 0., 0., 0., diag4, off4, 0., 0.,
       off4, diag4;
-  const Eigen::Vector4d intensities(ppy, pmy, mpy, mmy);
-  const auto FProduct = F2m * F1m;
-  const auto PProduct = P2m * P1m;
-  const auto PFProduct = PProduct * FProduct;
-  corrected = PFProduct * intensities;
+  const Eigen::Matrix4d FProduct = F2m * F1m;
+  const Eigen::Matrix4d PProduct = P2m * P1m;
+  FourInputsMatrices matrices;
+  matrices.correction = PProduct * FProduct;
+  matrices.squaredCorrection =
+      (matrices.correction.array() * matrices.correction.array()).matrix();
   // The error matrices here are element-wise algebraic derivatives of
   // the matrices above, multiplied by the error.
   const auto elemE1 = -1. / pow<2>(f1) * f1E;
@@ -136,17 +148,91 @@ void fourInputsCorrectedAndErrors(
   Eigen::Matrix4d P2Em;
   P2Em << elemE4, -elemE4, 0., 0., -elemE4, elemE4, 0., 0., 0., 0., elemE4,
       -elemE4, 0., 0., -elemE4, elemE4;
+  matrices.errorP2 = P2Em * P1m * FProduct;
+  matrices.errorP1 = P2m * P1Em * FProduct;
+  matrices.errorF2 = PProduct * F2Em * F1m;
+  matrices.errorF1 = PProduct * F2m * F1Em;
+  return matrices;
+}
+
+/**
+ * Calculate the corrected intensities and error estimates.
+ * @param corrected an output vector for R00, R01, R10 and R11
+ * @param errors an output vector for the error estimates
+ * @param matrices the correction matrices of the wavelength bin
+ * @param ppy intensity I00
+ * @param ppyE error of ppy
+ * @param pmy intensity I01
+ * @param pmyE error of pmy
+ * @param mpy intensity I10
+ * @param mpyE error of mpy
+ * @param mmy intensity I11
+ * @param mmyE error of mmy
+ */
+void fourInputsCorrectedAndErrors(Eigen::Vector4d &corrected,
+                                  Eigen::Vector4d &errors,
+                                  const FourInputsMatrices &matrices,
+                                  const double ppy, const double ppyE,
+                                  const double pmy, const double pmyE,
+                                  const double mpy, const double mpyE,
+                                  const double mmy, const double mmyE) {
+  const Eigen::Vector4d intensities(ppy, pmy, mpy, mmy);
+  corrected = matrices.correction * intensities;
   const Eigen::Vector4d yErrors(ppyE, pmyE, mpyE, mmyE);
-  const auto e1 = (P2Em * P1m * FProduct * intensities).array();
-  const auto e2 = (P2m * P1Em * FProduct * intensities).array();
-  const auto e3 = (PProduct * F2Em * F1m * intensities).array();
-  const auto e4 = (PProduct * F2m * F1Em * intensities).array();
-  const auto sqPFProduct = (PFProduct.array() * PFProduct.array()).matrix();
+  const Eigen::Array4d e1 = (matrices.errorP2 * intensities).array();
+  const Eigen::Array4d e2 = (matrices.errorP1 * intensities).array();
+  const Eigen::Array4d e3 = (matrices.errorF2 * intensities).array();
+  const Eigen::Array4d e4 = (matrices.errorF1 * intensities).array();
   const auto sqErrors = (yErrors.array() * yErrors.array()).matrix();
-  const auto e5 = (sqPFProduct * sqErrors).array();
+  const Eigen::Array4d e5 = (matrices.squaredCorrection * sqErrors).array();
   errors = (e1 * e1 + e2 * e2 + e3 * e3 + e4 * e4 + e5).sqrt();
 }
 
+/// The matrices of the analyzerless corrections of a wavelength bin
+struct TwoInputsMatrices {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  Eigen::Matrix2d correction;
+  Eigen::Matrix2d squaredCorrection;
+  Eigen::Matrix2d errorP1;
+  Eigen::Matrix2d errorF1;
+};
+
+using TwoInputsMatricesVector =
+    std::vector<TwoInputsMatrices, Eigen::aligned_allocator<TwoInputsMatrices>>;
+
+/**
+ * Calculate the analyzerless correction matrices of a wavelength bin.
+ * @param F1 polarizer flipper efficiency
+ * @param F1E error of F1
+ * @param P1 polarizer efficiency
+ * @param P1E error of P1
+ * @return the correction and error matrices
+ */
+TwoInputsMatrices twoInputsMatrices(const double F1, const double F1E,
+                                    const double P1, const double P1E) {
+  using namespace boost::math;
+  Eigen::Matrix2d F1m;
+  F1m << 1., 0., (F1 - 1.) / F1, 1. / F1;
+  const double divisor = (2. * P1 - 1.);
+  const double diag = (P1 - 1.) / divisor;
+  const double off = P1 / divisor;
+  Eigen::Matrix2d P1m;
+  P1m << diag, off, off, diag;
+  TwoInputsMatrices matrices;
+  matrices.correction = P1m * F1m;
+  matrices.squaredCorrection =
+      (matrices.correction.array() * matrices.correction.array()).matrix();
+  const auto elemE1 = -1. / pow<2>(F1) * F1E;
+  Eigen::Matrix2d F1Em;
+  F1Em << 0., 0., -elemE1, elemE1;
+  const auto elemE2 = 1. / pow<2>(divisor) * P1E;
+  Eigen::Matrix2d P1Em;
+  P1Em << elemE2, -elemE2, -elemE2, elemE2;
+  matrices.errorP1 = P1Em * F1m;
+  matrices.errorF1 = P1m * F1Em;
+  return matrices;
+}
+
 /**
  * Estimate errors for I01 in the two inputs case.
  * @param i00 intensity of 00 flipper configuration
@@ -679,8 +765,10 @@ PolarizationCorrectionWildes::directBeamCorrections(
   checkInputExists(inputs.ppWS, Flippers::Off);
   WorkspaceMap outputs;
   outputs.ppWS = createWorkspaceWithHistory(inputs.ppWS);
-  const size_t nHisto = inputs.ppWS->getNumberHistograms();
-  for (size_t wsIndex = 0; wsIndex != nHisto; ++wsIndex) {
+  const auto nHisto = static_cast<int64_t>(inputs.ppWS->getNumberHistograms());
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inputs.ppWS, *outputs.ppWS))
+  for (int64_t wsIndex = 0; wsIndex < nHisto; ++wsIndex) {
+    PARALLEL_START_INTERUPT_REGION
     const auto &ppY = inputs.ppWS->y(wsIndex);
     const auto &ppE = inputs.ppWS->e(wsIndex);
     auto &ppYOut = outputs.ppWS->mutableY(wsIndex);
@@ -698,7 +786,9 @@ PolarizationCorrectionWildes::directBeamCorrections(
       const auto errorSum = std::sqrt(e1 + e2 + e3);
       ppEOut[binIndex] = errorSum;
     }
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
   return outputs;
 }
 
@@ -719,8 +809,22 @@ PolarizationCorrectionWildes::analyzerlessCorrections(
   WorkspaceMap outputs;
   outputs.mmWS = createWorkspaceWithHistory(inputs.mmWS);
   outputs.ppWS = createWorkspaceWithHistory(inputs.ppWS);
-  const size_t nHisto = inputs.mmWS->getNumberHistograms();
-  for (size_t wsIndex = 0; wsIndex != nHisto; ++wsIndex) {
+  // The matrices are the same for all the spectra
+  const auto &F1 = efficiencies.F1->y();
+  const auto &F1E = efficiencies.F1->e();
+  const auto &P1 = efficiencies.P1->y();
+  const auto &P1E = efficiencies.P1->e();
+  TwoInputsMatricesVector matrices;
+  matrices.reserve(F1.size());
+  for (size_t binIndex = 0; binIndex < F1.size(); ++binIndex) {
+    matrices.emplace_back(twoInputsMatrices(F1[binIndex], F1E[binIndex],
+                                            P1[binIndex], P1E[binIndex]));
+  }
+  const auto nHisto = static_cast<int64_t>(inputs.mmWS->getNumberHistograms());
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inputs.mmWS, *inputs.ppWS,
+                                     *outputs.mmWS, *outputs.ppWS))
+  for (int64_t wsIndex = 0; wsIndex < nHisto; ++wsIndex) {
+    PARALLEL_START_INTERUPT_REGION
     const auto &mmY = inputs.mmWS->y(wsIndex);
     const auto &mmE = inputs.mmWS->e(wsIndex);
     const auto &ppY = inputs.ppWS->y(wsIndex);
@@ -730,39 +834,23 @@ PolarizationCorrectionWildes::analyzerlessCorrections(
     auto &ppYOut = outputs.ppWS->mutableY(wsIndex);
     auto &ppEOut = outputs.ppWS->mutableE(wsIndex);
     for (size_t binIndex = 0; binIndex < mmY.size(); ++binIndex) {
-      const auto F1 = efficiencies.F1->y()[binIndex];
-      const auto P1 = efficiencies.P1->y()[binIndex];
-      Eigen::Matrix2d F1m;
-      F1m << 1., 0., (F1 - 1.) / F1, 1. / F1;
-      const double divisor = (2. * P1 - 1.);
-      const double diag = (P1 - 1.) / divisor;
-      const double off = P1 / divisor;
-      Eigen::Matrix2d P1m;
-      P1m << diag, off, off, diag;
+      const auto &m = matrices[binIndex];
       const Eigen::Vector2d intensities(ppY[binIndex], mmY[binIndex]);
-      const auto PFProduct = P1m * F1m;
-      const auto corrected = PFProduct * intensities;
+      const Eigen::Vector2d corrected = m.correction * intensities;
       ppYOut[binIndex] = corrected[0];
       mmYOut[binIndex] = corrected[1];
-      const auto F1E = efficiencies.F1->e()[binIndex];
-      const auto P1E = efficiencies.P1->e()[binIndex];
-      const auto elemE1 = -1. / pow<2>(F1) * F1E;
-      Eigen::Matrix2d F1Em;
-      F1Em << 0., 0., -elemE1, elemE1;
-      const auto elemE2 = 1. / pow<2>(divisor) * P1E;
-      Eigen::Matrix2d P1Em;
-      P1Em << elemE2, -elemE2, -elemE2, elemE2;
       const Eigen::Vector2d errors(ppE[binIndex], mmE[binIndex]);
-      const auto e1 = (P1Em * F1m * intensities).array();
-      const auto e2 = (P1m * F1Em * intensities).array();
-      const auto sqPFProduct = (PFProduct.array() * PFProduct.array()).matrix();
+      const Eigen::Array2d e1 = (m.errorP1 * intensities).array();
+      const Eigen::Array2d e2 = (m.errorF1 * intensities).array();
       const auto sqErrors = (errors.array() * errors.array()).matrix();
-      const auto e3 = (sqPFProduct * sqErrors).array();
-      const auto errorSum = (e1 * e1 + e2 * e2 + e3).sqrt();
+      const Eigen::Array2d e3 = (m.squaredCorrection * sqErrors).array();
+      const Eigen::Array2d errorSum = (e1 * e1 + e2 * e2 + e3).sqrt();
       ppEOut[binIndex] = errorSum[0];
       mmEOut[binIndex] = errorSum[1];
     }
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
   return outputs;
 }
 
@@ -834,16 +922,29 @@ PolarizationCorrectionWildes::fullCorrections(
   outputs.mpWS = createWorkspaceWithHistory(inputs.mpWS);
   outputs.pmWS = createWorkspaceWithHistory(inputs.pmWS);
   outputs.ppWS = createWorkspaceWithHistory(inputs.ppWS);
-  const auto F1 = efficiencies.F1->y();
-  const auto F1E = efficiencies.F1->e();
-  const auto F2 = efficiencies.F2->y();
-  const auto F2E = efficiencies.F2->e();
-  const auto P1 = efficiencies.P1->y();
-  const auto P1E = efficiencies.P1->e();
-  const auto P2 = efficiencies.P2->y();
-  const auto P2E = efficiencies.P2->e();
-  const size_t nHisto = inputs.mmWS->getNumberHistograms();
-  for (size_t wsIndex = 0; wsIndex != nHisto; ++wsIndex) {
+  // The matrices are the same for all the spectra
+  const auto &F1 = efficiencies.F1->y();
+  const auto &F1E = efficiencies.F1->e();
+  const auto &F2 = efficiencies.F2->y();
+  const auto &F2E = efficiencies.F2->e();
+  const auto &P1 = efficiencies.P1->y();
+  const auto &P1E = efficiencies.P1->e();
+  const auto &P2 = efficiencies.P2->y();
+  const auto &P2E = efficiencies.P2->e();
+  FourInputsMatricesVector matrices;
+  matrices.reserve(F1.size());
+  for (size_t binIndex = 0; binIndex < F1.size(); ++binIndex) {
+    matrices.emplace_back(fourInputsMatrices(
+        F1[binIndex], F1E[binIndex], F2[binIndex], F2E[binIndex], P1[binIndex],
+        P1E[binIndex], P2[binIndex], P2E[binIndex]));
+  }
+  const auto nHisto = static_cast<int64_t>(inputs.mmWS->getNumberHistograms());
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inputs.mmWS, *inputs.mpWS, *inputs.pmWS,
+                                     *inputs.ppWS, *outputs.mmWS,
+                                     *outputs.mpWS, *outputs.pmWS,
+                                     *outputs.ppWS))
+  for (int64_t wsIndex = 0; wsIndex < nHisto; ++wsIndex) {
+    PARALLEL_START_INTERUPT_REGION
     const auto &mmY = inputs.mmWS->y(wsIndex);
     const auto &mmE = inputs.mmWS->e(wsIndex);
     const auto &mpY = inputs.mpWS->y(wsIndex);
@@ -863,12 +964,10 @@ PolarizationCorrectionWildes::fullCorrections(
     for (size_t binIndex = 0; binIndex < mmY.size(); ++binIndex) {
       Eigen::Vector4d corrected;
       Eigen::Vector4d errors;
-      fourInputsCorrectedAndErrors(corrected, errors, ppY[binIndex],
-                                   ppE[binIndex], pmY[binIndex], pmE[binIndex],
-                                   mpY[binIndex], mpE[binIndex], mmY[binIndex],
-                                   mmE[binIndex], F1[binIndex], F1E[binIndex],
-                                   F2[binIndex], F2E[binIndex], P1[binIndex],
-                                   P1E[binIndex], P2[binIndex], P2E[binIndex]);
+      fourInputsCorrectedAndErrors(
+          corrected, errors, matrices[binIndex], ppY[binIndex], ppE[binIndex],
+          pmY[binIndex], pmE[binIndex], mpY[binIndex], mpE[binIndex],
+          mmY[binIndex], mmE[binIndex]);
       ppYOut[binIndex] = corrected[0];
       pmYOut[binIndex] = corrected[1];
       mpYOut[binIndex] = corrected[2];
@@ -878,7 +977,9 @@ PolarizationCorrectionWildes::fullCorrections(
       mpEOut[binIndex] = errors[2];
       mmEOut[binIndex] = errors[3];
     }
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
   return outputs;
 }
 
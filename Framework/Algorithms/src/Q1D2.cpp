@@ -10,11 +10,14 @@
 #include "MantidAPI/HistogramValidator.h"
 #include "MantidAPI/ISpectrum.h"
 #include "MantidAPI/InstrumentValidator.h"
+#include "MantidAPI/Run.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
+#include "MantidAPI/WorkspaceGroup.h"
 #include "MantidAPI/WorkspaceUnitValidator.h"
 #include "MantidAlgorithms/GravitySANSHelper.h"
 #include "MantidAlgorithms/Qhelper.h"
+#include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
@@ -24,12 +27,16 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
+#include "MantidKernel/ParallelReduce.h"
 #include "MantidKernel/RebinParamsValidator.h"
+#include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VectorHelper.h"
 #include "MantidParallel/Communicator.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
+#include <numeric>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -41,6 +48,140 @@ using namespace API;
 using namespace Geometry;
 using namespace DataObjects;
 
+namespace {
+/// The partial sums of a chunk of spectra over the output Q bins
+struct QSums {
+  explicit QSums(const size_t numberOfBins = 0)
+      : counts(numberOfBins, 0.), countErrors2(numberOfBins, 0.),
+        norms(numberOfBins, 0.), normErrors2(numberOfBins, 0.),
+        qResolution(numberOfBins, 0.) {}
+  QSums &operator+=(const QSums &other) {
+    add(counts, other.counts);
+    add(countErrors2, other.countErrors2);
+    add(norms, other.norms);
+    add(normErrors2, other.normErrors2);
+    add(qResolution, other.qResolution);
+    detectorIDs.insert(other.detectorIDs.begin(), other.detectorIDs.end());
+    return *this;
+  }
+  static void add(std::vector<double> &values,
+                  const std::vector<double> &other) {
+    std::transform(values.begin(), values.end(), other.begin(),
+                   values.begin(), std::plus<double>());
+  }
+  std::vector<double> counts;
+  /// The errors and the errors of the normalisation are summed squared
+  std::vector<double> countErrors2;
+  std::vector<double> norms;
+  std::vector<double> normErrors2;
+  /// The Q resolution of the bins, weighted by the counts
+  std::vector<double> qResolution;
+  std::set<detid_t> detectorIDs;
+};
+
+/// The output Q bin of each wavelength bin of the spectra, kept to reduce the
+/// time slices of a workspace without calculating Q and the normalisation again
+struct QBinMap {
+  /// The first wavelength bin of each spectrum that is used
+  std::vector<size_t> wavStarts;
+  /// The Q bin of each used wavelength bin, or -1 if it is out of range. Empty
+  /// for spectra that are not used.
+  std::vector<std::vector<int>> bins;
+  /// sqrt(QResIn^2 + (QBin/sqrt(12))^2) of each used wavelength bin, if the Q
+  /// resolution is calculated
+  std::vector<std::vector<double>> resolutions;
+};
+
+/// Add events to the Q bins of their wavelength bins
+template <typename EventType>
+void sumEvents(const std::vector<EventType> &events,
+               const HistogramData::HistogramX &wavelengths,
+               const size_t wavStart, const std::vector<int> &bins,
+               const std::vector<double> &resolutions, QSums &sums) {
+  const auto first = wavelengths.cbegin() + wavStart;
+  for (const auto &event : events) {
+    const auto edge =
+        std::upper_bound(first, wavelengths.cend(), event.tof());
+    if (edge == first || edge == wavelengths.cend())
+      continue;
+    const auto index = static_cast<size_t>(edge - first) - 1;
+    const int bin = bins[index];
+    if (bin < 0)
+      continue;
+    sums.counts[bin] += event.weight();
+    sums.countErrors2[bin] += event.errorSquared();
+    if (!resolutions.empty())
+      sums.qResolution[bin] += event.weight() * resolutions[index];
+  }
+}
+
+/**
+ * Sum the counts of a time slice over the Q bins
+ * @param slice :: The slice, as a histogram with the binning of the workspace
+ * it was taken from or as events in wavelength
+ * @param map :: The Q bins of the wavelength bins of the spectra
+ * @param wavelengths :: The common wavelength bins of the spectra
+ * @param numberOfBins :: The number of Q bins
+ * @return the counts, the squared errors and the Q resolution weighted by the
+ * counts of each Q bin
+ */
+QSums sumSlice(const MatrixWorkspace &slice, const QBinMap &map,
+               const HistogramData::HistogramX &wavelengths,
+               const size_t numberOfBins) {
+  const auto eventWS = dynamic_cast<const EventWorkspace *>(&slice);
+  std::vector<std::vector<size_t>> spectra(1);
+  for (size_t i = 0; i < map.bins.size(); ++i)
+    if (!map.bins[i].empty())
+      spectra[0].push_back(i);
+  const std::vector<double> noResolutions;
+  QSums total;
+  Kernel::reduceGroups(
+      spectra, 200, Kernel::threadSafe(slice),
+      [numberOfBins](size_t) { return QSums(numberOfBins); },
+      [&](QSums &sums, size_t, const size_t *first, const size_t *last) {
+        for (auto index = first; index != last; ++index) {
+          const size_t i = *index;
+          const size_t wavStart = map.wavStarts[i];
+          const auto &bins = map.bins[i];
+          const auto &resolutions =
+              map.resolutions.empty() ? noResolutions : map.resolutions[i];
+          if (eventWS) {
+            const auto &eventList = eventWS->getSpectrum(i);
+            switch (eventList.getEventType()) {
+            case EventType::TOF:
+              sumEvents(eventList.getEvents(), wavelengths, wavStart, bins,
+                        resolutions, sums);
+              break;
+            case EventType::WEIGHTED:
+              sumEvents(eventList.getWeightedEvents(), wavelengths, wavStart,
+                        bins, resolutions, sums);
+              break;
+            case EventType::WEIGHTED_NOTIME:
+              sumEvents(eventList.getWeightedEventsNoTime(), wavelengths,
+                        wavStart, bins, resolutions, sums);
+              break;
+            }
+          } else {
+            const auto &y = slice.y(i);
+            const auto &e = slice.e(i);
+            for (size_t k = 0; k < bins.size(); ++k) {
+              const int bin = bins[k];
+              if (bin < 0)
+                continue;
+              sums.counts[bin] += y[wavStart + k];
+              sums.countErrors2[bin] += e[wavStart + k] * e[wavStart + k];
+              if (!resolutions.empty())
+                sums.qResolution[bin] += y[wavStart + k] * resolutions[k];
+            }
+          }
+        }
+      },
+      [](QSums &partial, QSums &next) { partial += next; },
+      [&total](size_t, QSums &sums) { std::swap(total, sums); });
+  return total;
+}
+} // namespace
+
 Q1D2::Q1D2() : API::Algorithm(), m_dataWS(), m_doSolidAngle(false) {}
 
 void Q1D2::init() {
@@ -120,6 +261,18 @@ void Q1D2::init() {
       std::make_unique<WorkspaceProperty<>>("QResolution", "", Direction::Input,
                                             PropertyMode::Optional, dataVal),
       "Workspace to calculate the Q resolution.\n");
+
+  declareProperty(
+      std::make_unique<WorkspaceProperty<WorkspaceGroup>>(
+          "SliceWorkspaces", "", Direction::Input, PropertyMode::Optional),
+      "Optional: Time slices of the DetBankWorkspace, e.g. from FilterEvents, "
+      "in wavelength. They are reduced with the Q bins and normalisation of "
+      "the DetBankWorkspace, which are only calculated once. Event slices are "
+      "summed into Q straight from their events.");
+  declareProperty(std::make_unique<WorkspaceProperty<WorkspaceGroup>>(
+                      "OutputSliceWorkspaces", "", Direction::Output,
+                      PropertyMode::Optional),
+                  "The I(Q) of each of the SliceWorkspaces");
 }
 /**
   @ throw invalid_argument if the workspaces are not mututially compatible
@@ -164,117 +317,170 @@ void Q1D2::exec() {
   // the averaged Q resolution.
   HistogramData::HistogramDx qResolutionOut(YOut.size(), 0.0);
 
-  const auto numSpec = static_cast<int>(m_dataWS->getNumberHistograms());
-  Progress progress(this, 0.05, 1.0, numSpec + 1);
+  const auto numSpec = m_dataWS->getNumberHistograms();
+  WorkspaceGroup_sptr slices = getProperty("SliceWorkspaces");
+  if (slices)
+    checkSlices(*slices);
+  Progress progress(this, 0.05, 1.0,
+                    numSpec + 1 + (slices ? slices->size() : 0));
+
+  // The Q bins of the spectra are kept if there are slices to reduce
+  QBinMap qBinMap;
+  if (slices) {
+    qBinMap.wavStarts.resize(numSpec);
+    qBinMap.bins.resize(numSpec);
+    if (useQResolution)
+      qBinMap.resolutions.resize(numSpec);
+  }
 
   const auto &spectrumInfo = m_dataWS->spectrumInfo();
-  PARALLEL_FOR_IF(Kernel::threadSafe(*m_dataWS, *outputWS, pixelAdj.get()))
-  for (int i = 0; i < numSpec; ++i) {
-    PARALLEL_START_INTERUPT_REGION
-    if (!spectrumInfo.hasDetectors(i)) {
-      g_log.warning() << "Workspace index " << i << " (SpectrumIndex = "
-                      << m_dataWS->getSpectrum(i).getSpectrumNo()
-                      << ") has no detector assigned to it - discarding\n";
-      continue;
-    }
-    // Skip if we have a monitor or if the detector is masked.
-    if (spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i))
-      continue;
-
-    // get the bins that are included inside the RadiusCut/WaveCutcut off, those
-    // to calculate for
-    // const size_t wavStart = waveLengthCutOff(i);
-    const size_t wavStart = helper.waveLengthCutOff(m_dataWS, spectrumInfo,
-                                                    getProperty("RadiusCut"),
-                                                    getProperty("WaveCut"), i);
-    if (wavStart >= m_dataWS->y(i).size()) {
-      // all the spectra in this detector are out of range
-      continue;
-    }
-
-    const size_t numWavbins = m_dataWS->y(i).size() - wavStart;
-    // make just one call to new to reduce CPU overhead on each thread, access
-    // to these
-    // three "arrays" is via iterators
-    HistogramData::HistogramY _noDirectUseStorage_(3 * numWavbins);
-    // normalization term
-    auto norms = _noDirectUseStorage_.begin();
-    // the error on these weights, it contributes to the error calculation on
-    // the output workspace
-    auto normETo2s = norms + numWavbins;
-    // the Q values calculated from input wavelength workspace
-    auto QIn = normETo2s + numWavbins;
-
-    // the weighting for this input spectrum that is added to the normalization
-    calculateNormalization(wavStart, i, pixelAdj, wavePixelAdj, binNorms,
-                           binNormEs, norms, normETo2s);
-
-    // now read the data from the input workspace, calculate Q for each bin
-    convertWavetoQ(spectrumInfo, i, doGravity, wavStart, QIn,
-                   getProperty("ExtraLength"));
-
-    // Pointers to the counts data and it's error
-    auto YIn = m_dataWS->y(i).cbegin() + wavStart;
-    auto EIn = m_dataWS->e(i).cbegin() + wavStart;
-
-    // Pointers to the QResolution data. Note that the xdata was initially the
-    // same, hence
-    // the same indexing applies to the y values of m_dataWS and qResolution
-    // If we want to use it set it to the correct value, else to YIN, although
-    // that does not matter, as
-    // we won't use it
-    auto QResIn =
-        useQResolution ? (qResolution->y(i).cbegin() + wavStart) : YIn;
-
-    // when finding the output Q bin remember that the input Q bins (from the
-    // convert to wavelength) start high and reduce
-    auto loc = QOut.cend();
-    // sum the Q contributions from each individual spectrum into the output
-    // array
-    const auto end = m_dataWS->y(i).cend();
-    for (; YIn != end; ++YIn, ++EIn, ++QIn, ++norms, ++normETo2s) {
-      // find the output bin that each input y-value will fall into, remembering
-      // there is one more bin boundary than bins
-      getQBinPlus1(QOut, *QIn, loc);
-      // ignore counts that are out of the output range
-      if ((loc != QOut.begin()) && (loc != QOut.end())) {
-        // the actual Q-bin to add something to
-        const size_t bin = loc - QOut.begin() - 1;
-        PARALLEL_CRITICAL(q1d_counts_sum) {
-          YOut[bin] += *YIn;
-          normSum[bin] += *norms;
-          // these are the errors squared which will be summed and square rooted
-          // at the end
-          EOutTo2[bin] += (*EIn) * (*EIn);
-          normError2[bin] += *normETo2s;
-          if (useQResolution) {
-            auto QBin = (QOut[bin + 1] - QOut[bin]);
-            // Here we need to take into account the Bin width and the count
-            // weigthing. The
-            // formula should be YIN* sqrt(QResIn^2 + (QBin/sqrt(12))^2)
-            qResolutionOut[bin] +=
-                (*YIn) * std::sqrt((*QResIn) * (*QResIn) + QBin * QBin / 12.0);
+  const double radiusCut = getProperty("RadiusCut");
+  const double waveCut = getProperty("WaveCut");
+  const double extraLength = getProperty("ExtraLength");
+
+  // Every spectrum is summed into the one output spectrum. The spectra are
+  // summed in chunks, in parallel, each into its own partial sums, which are
+  // then added pairwise, so no thread waits on another to update the output.
+  std::vector<std::vector<size_t>> spectra(1, std::vector<size_t>(numSpec));
+  std::iota(spectra[0].begin(), spectra[0].end(), size_t(0));
+  QSums total;
+  Kernel::reduceGroups(
+      spectra, 200, Kernel::threadSafe(*m_dataWS, *outputWS, pixelAdj.get()),
+      [&YOut](size_t) { return QSums(YOut.size()); },
+      [&](QSums &sums, size_t, const size_t *first, const size_t *last) {
+        for (auto index = first; index != last; ++index) {
+          const size_t i = *index;
+          interruption_point();
+          if (!spectrumInfo.hasDetectors(i)) {
+            g_log.warning()
+                << "Workspace index " << i << " (SpectrumIndex = "
+                << m_dataWS->getSpectrum(i).getSpectrumNo()
+                << ") has no detector assigned to it - discarding\n";
+            continue;
+          }
+          // Skip if we have a monitor or if the detector is masked.
+          if (spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i))
+            continue;
+
+          // get the bins that are included inside the RadiusCut/WaveCutcut
+          // off, those to calculate for
+          const size_t wavStart = helper.waveLengthCutOff(
+              m_dataWS, spectrumInfo, radiusCut, waveCut, i);
+          if (wavStart >= m_dataWS->y(i).size()) {
+            // all the spectra in this detector are out of range
+            continue;
           }
-        }
-      }
-
-      // Increment the QResolution iterator
-      if (useQResolution) {
-        ++QResIn;
-      }
-    }
 
-    PARALLEL_CRITICAL(q1d_spectra_map) {
-      progress.report("Computing I(Q)");
-      // Add up the detector IDs in the output spectrum at workspace index 0
-      const auto &inSpec = m_dataWS->getSpectrum(i);
-      auto &outSpec = outputWS->getSpectrum(0);
-      outSpec.addDetectorIDs(inSpec.getDetectorIDs());
-    }
+          const size_t numWavbins = m_dataWS->y(i).size() - wavStart;
+          // make just one call to new to reduce CPU overhead on each thread,
+          // access to these three "arrays" is via iterators
+          HistogramData::HistogramY _noDirectUseStorage_(3 * numWavbins);
+          // normalization term
+          auto norms = _noDirectUseStorage_.begin();
+          // the error on these weights, it contributes to the error
+          // calculation on the output workspace
+          auto normETo2s = norms + numWavbins;
+          // the Q values calculated from input wavelength workspace
+          auto QIn = normETo2s + numWavbins;
+
+          // the weighting for this input spectrum that is added to the
+          // normalization
+          calculateNormalization(wavStart, i, pixelAdj, wavePixelAdj, binNorms,
+                                 binNormEs, norms, normETo2s);
+
+          // now read the data from the input workspace, calculate Q for each
+          // bin
+          convertWavetoQ(spectrumInfo, i, doGravity, wavStart, QIn,
+                         extraLength);
+
+          // Pointers to the counts data and it's error
+          auto YIn = m_dataWS->y(i).cbegin() + wavStart;
+          auto EIn = m_dataWS->e(i).cbegin() + wavStart;
+
+          // Pointers to the QResolution data. Note that the xdata was
+          // initially the same, hence the same indexing applies to the y
+          // values of m_dataWS and qResolution. If we want to use it set it to
+          // the correct value, else to YIN, although that does not matter, as
+          // we won't use it
+          auto QResIn =
+              useQResolution ? (qResolution->y(i).cbegin() + wavStart) : YIn;
+
+          // when finding the output Q bin remember that the input Q bins (from
+          // the convert to wavelength) start high and reduce
+          auto loc = QOut.cend();
+          // the Q bins of the spectrum are recorded for the slices
+          int *sliceBins = nullptr;
+          double *sliceResolutions = nullptr;
+          if (slices) {
+            qBinMap.wavStarts[i] = wavStart;
+            qBinMap.bins[i].assign(numWavbins, -1);
+            sliceBins = qBinMap.bins[i].data();
+            if (useQResolution) {
+              qBinMap.resolutions[i].assign(numWavbins, 0.);
+              sliceResolutions = qBinMap.resolutions[i].data();
+            }
+          }
+          // sum the Q contributions from each individual spectrum into the
+          // partial sums
+          const auto end = m_dataWS->y(i).cend();
+          for (; YIn != end; ++YIn, ++EIn, ++QIn, ++norms, ++normETo2s) {
+            // find the output bin that each input y-value will fall into,
+            // remembering there is one more bin boundary than bins
+            getQBinPlus1(QOut, *QIn, loc);
+            // ignore counts that are out of the output range
+            if ((loc != QOut.begin()) && (loc != QOut.end())) {
+              // the actual Q-bin to add something to
+              const size_t bin = loc - QOut.begin() - 1;
+              sums.counts[bin] += *YIn;
+              sums.norms[bin] += *norms;
+              // these are the errors squared which will be summed and square
+              // rooted at the end
+              sums.countErrors2[bin] += (*EIn) * (*EIn);
+              sums.normErrors2[bin] += *normETo2s;
+              if (useQResolution) {
+                auto QBin = (QOut[bin + 1] - QOut[bin]);
+                // Here we need to take into account the Bin width and the
+                // count weigthing. The formula should be
+                // YIN* sqrt(QResIn^2 + (QBin/sqrt(12))^2)
+                const double resolution =
+                    std::sqrt((*QResIn) * (*QResIn) + QBin * QBin / 12.0);
+                sums.qResolution[bin] += (*YIn) * resolution;
+                if (sliceResolutions)
+                  *sliceResolutions = resolution;
+              }
+              if (sliceBins)
+                *sliceBins = static_cast<int>(bin);
+            }
+
+            // Increment the QResolution iterator
+            if (useQResolution) {
+              ++QResIn;
+            }
+            if (sliceBins) {
+              ++sliceBins;
+              if (sliceResolutions)
+                ++sliceResolutions;
+            }
+          }
 
-    PARALLEL_END_INTERUPT_REGION
-  }
-  PARALLEL_CHECK_INTERUPT_REGION
+          // Add up the detector IDs in the output spectrum
+          const auto &detectorIDs = m_dataWS->getSpectrum(i).getDetectorIDs();
+          sums.detectorIDs.insert(detectorIDs.begin(), detectorIDs.end());
+          progress.report("Computing I(Q)");
+        }
+      },
+      [](QSums &partial, QSums &next) { partial += next; },
+      [&total](size_t, QSums &sums) { std::swap(total, sums); });
+
+  std::copy(total.counts.cbegin(), total.counts.cend(), YOut.begin());
+  std::copy(total.countErrors2.cbegin(), total.countErrors2.cend(),
+            EOutTo2.begin());
+  std::copy(total.norms.cbegin(), total.norms.cend(), normSum.begin());
+  std::copy(total.normErrors2.cbegin(), total.normErrors2.cend(),
+            normError2.begin());
+  std::copy(total.qResolution.cbegin(), total.qResolution.cend(),
+            qResolutionOut.begin());
+  outputWS->getSpectrum(0).addDetectorIDs(total.detectorIDs);
 
   if (communicator().size() > 1) {
     int tag = 0;
@@ -353,11 +559,65 @@ void Q1D2::exec() {
   // finally divide the number of counts in each output Q bin by its weighting
   normalize(normSum, normError2, YOut, EOutTo2);
 
+  if (slices) {
+    // Each slice only needs its counts summing, Q and the normalisation are
+    // those of the whole workspace
+    auto outputSlices = boost::make_shared<WorkspaceGroup>();
+    for (size_t index = 0; index < slices->size(); ++index) {
+      const auto slice =
+          boost::dynamic_pointer_cast<MatrixWorkspace>(slices->getItem(index));
+      auto sums = sumSlice(*slice, qBinMap, m_dataWS->x(0), YOut.size());
+      MatrixWorkspace_sptr sliceWS = outputWS->clone();
+      sliceWS->mutableRun() = slice->run();
+      auto &sliceY = sliceWS->mutableY(0);
+      auto &sliceE = sliceWS->mutableE(0);
+      std::copy(sums.counts.cbegin(), sums.counts.cend(), sliceY.begin());
+      std::copy(sums.countErrors2.cbegin(), sums.countErrors2.cend(),
+                sliceE.begin());
+      normalize(normSum, normError2, sliceY, sliceE);
+      if (useQResolution) {
+        HistogramData::HistogramDx resolution(std::move(sums.qResolution));
+        for (size_t bin = 0; bin < resolution.size(); ++bin)
+          if (sums.counts[bin] > 0.0)
+            resolution[bin] /= sums.counts[bin];
+        sliceWS->setPointStandardDeviations(0, std::move(resolution));
+      }
+      outputSlices->addWorkspace(sliceWS);
+      progress.report("Reducing slices");
+    }
+    setProperty("OutputSliceWorkspaces", outputSlices);
+  }
+
   if (communicator().rank() == 0) {
     setProperty("OutputWorkspace", outputWS);
   }
 }
 
+/**
+ * @param slices :: The time slices to reduce with the DetBankWorkspace
+ * @throw std::invalid_argument if a slice does not match the DetBankWorkspace
+ */
+void Q1D2::checkSlices(const WorkspaceGroup &slices) const {
+  for (size_t index = 0; index < slices.size(); ++index) {
+    const auto slice =
+        boost::dynamic_pointer_cast<MatrixWorkspace>(slices.getItem(index));
+    if (!slice)
+      throw std::invalid_argument(
+          "The SliceWorkspaces must all be matrix workspaces");
+    if (slice->getNumberHistograms() != m_dataWS->getNumberHistograms())
+      throw std::invalid_argument("The SliceWorkspaces must have the same "
+                                  "number of spectra as the DetBankWorkspace");
+    if (slice->getAxis(0)->unit()->unitID() != "Wavelength")
+      throw std::invalid_argument(
+          "The SliceWorkspaces must have units of wavelength");
+    if (!boost::dynamic_pointer_cast<const EventWorkspace>(slice) &&
+        slice->blocksize() != m_dataWS->blocksize())
+      throw std::invalid_argument(
+          "SliceWorkspaces that are not event workspaces must have the bins "
+          "of the DetBankWorkspace");
+  }
+}
+
 /** Creates the output workspace, its size, units, etc.
  *  @param binParams the bin boundary specification using the same same syntax
  * as param the Rebin algorithm
@@ -732,10 +992,11 @@ void checkStorageMode(
 Parallel::ExecutionMode Q1D2::getParallelExecutionMode(
     const std::map<std::string, Parallel::StorageMode> &storageModes) const {
   if (storageModes.count("PixelAdj") || storageModes.count("WavePixelAdj") ||
-      storageModes.count("QResolution"))
-    throw std::runtime_error(
-        "Using in PixelAdj, WavePixelAdj, or QResolution in an MPI run of " +
-        name() + " is currently not supported.");
+      storageModes.count("QResolution") ||
+      storageModes.count("SliceWorkspaces"))
+    throw std::runtime_error("Using in PixelAdj, WavePixelAdj, QResolution, "
+                             "or SliceWorkspaces in an MPI run of " +
+                             name() + " is currently not supported.");
   checkStorageMode(storageModes, "WavelengthAdj");
   return Parallel::getCorrespondingExecutionMode(
       storageModes.at("DetBankWorkspace"));
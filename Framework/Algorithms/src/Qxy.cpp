@@ -19,11 +19,14 @@
 #include "MantidHistogramData/LinearGenerator.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/ParallelReduce.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VectorHelper.h"
 
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 
 namespace Mantid {
 namespace Algorithms {
@@ -35,6 +38,33 @@ using namespace Kernel;
 using namespace API;
 using namespace Geometry;
 
+namespace {
+/// The partial sums of a chunk of spectra over the cells of the Qx-Qy grid
+struct QxySums {
+  explicit QxySums(const size_t numberOfCells = 0)
+      : counts(numberOfCells, 0.), countErrors2(numberOfCells, 0.),
+        weights(numberOfCells, 0.), weightErrors2(numberOfCells, 0.) {}
+  QxySums &operator+=(const QxySums &other) {
+    add(counts, other.counts);
+    add(countErrors2, other.countErrors2);
+    add(weights, other.weights);
+    add(weightErrors2, other.weightErrors2);
+    return *this;
+  }
+  static void add(std::vector<double> &values,
+                  const std::vector<double> &other) {
+    std::transform(values.begin(), values.end(), other.begin(),
+                   values.begin(), std::plus<double>());
+  }
+  /// The cells of each row of Qy follow each other
+  std::vector<double> counts;
+  /// The errors are summed squared
+  std::vector<double> countErrors2;
+  std::vector<double> weights;
+  std::vector<double> weightErrors2;
+};
+} // namespace
+
 void Qxy::init() {
   auto wsValidator = boost::make_shared<CompositeValidator>();
   wsValidator->add<WorkspaceUnitValidator>("Wavelength");
@@ -137,191 +167,210 @@ void Qxy::exec() {
   // the samplePos is often not (0, 0, 0) because the instruments components are
   // moved to account for the beam centre
   const V3D samplePos = spectrumInfo.samplePosition();
-
-  for (int64_t i = 0; i < int64_t(numSpec); ++i) {
-    if (!spectrumInfo.hasDetectors(i)) {
-      g_log.warning() << "Workspace index " << i
-                      << " has no detector assigned to it - discarding\n";
-      continue;
-    }
-    // If no detector found or if it's masked or a monitor, skip onto the next
-    // spectrum
-    if (spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i))
-      continue;
-
-    // get the bins that are included inside the RadiusCut/WaveCutcut off, those
-    // to calculate for
-    const size_t wavStart = helper.waveLengthCutOff(
-        inputWorkspace, spectrumInfo, getProperty("RadiusCut"),
-        getProperty("WaveCut"), i);
-    if (wavStart >= inputWorkspace->y(i).size()) {
-      // all the spectra in this detector are out of range
-      continue;
-    }
-
-    V3D detPos = spectrumInfo.position(i) - samplePos;
-
-    // these will be re-calculated if gravity is on but without gravity there is
-    // no need
-    double phi = atan2(detPos.Y(), detPos.X());
-    double a = cos(phi);
-    double b = sin(phi);
-    double sinTheta = sin(spectrumInfo.twoTheta(i) * 0.5);
-
-    // Get references to the data for this spectrum
-    const auto &X = inputWorkspace->x(i);
-    const auto &Y = inputWorkspace->y(i);
-    const auto &E = inputWorkspace->e(i);
-
-    const auto &axis = outputWorkspace->x(0);
-
-    // the solid angle of the detector as seen by the sample is used for
-    // normalisation later on
-    double angle = 0.0;
-    for (const auto detID : inputWorkspace->getSpectrum(i).getDetectorIDs()) {
-      const auto index = detectorInfo.indexOf(detID);
-      if (!detectorInfo.isMasked(index))
-        angle += detectorInfo.detector(index).solidAngle(samplePos);
-    }
-
-    // some bins are masked completely or partially, the following vector will
-    // contain the fractions
-    std::vector<double> maskFractions;
-    if (inputWorkspace->hasMaskedBins(i)) {
-      // go through the set and convert it to a vector
-      const MatrixWorkspace::MaskList &mask = inputWorkspace->maskedBins(i);
-      maskFractions.resize(numBins, 1.0);
-      MatrixWorkspace::MaskList::const_iterator it, itEnd(mask.end());
-      for (it = mask.begin(); it != itEnd; ++it) {
-        // The weight for this masked bin is 1 minus the degree to which this
-        // bin is masked
-        maskFractions[it->first] -= it->second;
-      }
+  const double radiusCut = getProperty("RadiusCut");
+  const double waveCut = getProperty("WaveCut");
+  const double extraLength = getProperty("ExtraLength");
+  const auto &axis = outputWorkspace->x(0);
+  const size_t numQBins = axis.size() - 1;
+
+  // The spectra are summed in chunks, in parallel, each into its own partial
+  // sums over the Qx-Qy grid, which are then added pairwise, so no thread
+  // waits on another to update the output.
+  std::vector<std::vector<size_t>> spectra(1, std::vector<size_t>(numSpec));
+  std::iota(spectra[0].begin(), spectra[0].end(), size_t(0));
+  const auto chunkSize = std::max<size_t>(
+      numSpec / (4 * static_cast<size_t>(PARALLEL_GET_MAX_THREADS)), 100);
+  QxySums total;
+  Kernel::reduceGroups(
+      spectra, chunkSize,
+      Kernel::threadSafe(*inputWorkspace, waveAdj.get(), pixelAdj.get()),
+      [numQBins](size_t) { return QxySums(numQBins * numQBins); },
+      [&](QxySums &sums, size_t, const size_t *first, const size_t *last) {
+        for (auto index = first; index != last; ++index) {
+          const size_t i = *index;
+          interruption_point();
+          if (!spectrumInfo.hasDetectors(i)) {
+            g_log.warning() << "Workspace index " << i
+                            << " has no detector assigned to it - "
+                               "discarding\n";
+            continue;
+          }
+          // If no detector found or if it's masked or a monitor, skip onto
+          // the next spectrum
+          if (spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i))
+            continue;
+
+          // get the bins that are included inside the RadiusCut/WaveCutcut
+          // off, those to calculate for
+          const size_t wavStart = helper.waveLengthCutOff(
+              inputWorkspace, spectrumInfo, radiusCut, waveCut, i);
+          if (wavStart >= inputWorkspace->y(i).size()) {
+            // all the spectra in this detector are out of range
+            continue;
+          }
+
+          V3D detPos = spectrumInfo.position(i) - samplePos;
+
+          // these will be re-calculated if gravity is on but without gravity
+          // there is no need
+          double phi = atan2(detPos.Y(), detPos.X());
+          double a = cos(phi);
+          double b = sin(phi);
+          double sinTheta = sin(spectrumInfo.twoTheta(i) * 0.5);
+
+          // Get references to the data for this spectrum
+          const auto &X = inputWorkspace->x(i);
+          const auto &Y = inputWorkspace->y(i);
+          const auto &E = inputWorkspace->e(i);
+
+          // the solid angle of the detector as seen by the sample is used for
+          // normalisation later on
+          double angle = 0.0;
+          for (const auto detID :
+               inputWorkspace->getSpectrum(i).getDetectorIDs()) {
+            const auto detIndex = detectorInfo.indexOf(detID);
+            if (!detectorInfo.isMasked(detIndex))
+              angle += detectorInfo.detector(detIndex).solidAngle(samplePos);
+          }
+
+          // some bins are masked completely or partially, the following
+          // vector will contain the fractions
+          std::vector<double> maskFractions;
+          if (inputWorkspace->hasMaskedBins(i)) {
+            // go through the set and convert it to a vector
+            const MatrixWorkspace::MaskList &mask =
+                inputWorkspace->maskedBins(i);
+            maskFractions.resize(numBins, 1.0);
+            for (const auto &bin : mask) {
+              // The weight for this masked bin is 1 minus the degree to which
+              // this bin is masked
+              maskFractions[bin.first] -= bin.second;
+            }
+          }
+          double maskFraction(1);
+
+          // this object is not used if gravity correction is off, but it is
+          // only constructed once per spectrum
+          GravitySANSHelper grav;
+          if (doGravity) {
+            grav = GravitySANSHelper(spectrumInfo, i, extraLength);
+          }
+
+          for (int j = static_cast<int>(numBins) - 1;
+               j >= static_cast<int>(wavStart); --j) {
+            if (j < 0)
+              break; // Be careful with counting down. Need a better fix but
+                     // this will work for now
+            const double binWidth = X[j + 1] - X[j];
+            // Calculate the wavelength at the mid-point of this bin
+            const double wavLength = X[j] + (binWidth) / 2.0;
+
+            if (doGravity) {
+              // SANS instruments must have their y-axis pointing up, show the
+              // detector position as where the neutron would be without
+              // gravity
+              sinTheta = grav.calcComponents(wavLength, a, b);
+            }
+
+            // Calculate |Q| for this bin
+            const double Q = 4.0 * M_PI * sinTheta / wavLength;
+
+            // Now get the x & y components of Q.
+            const double Qx = a * Q;
+            // Test whether they're in range, if not go to next spectrum.
+            if (Qx < axis.front() || Qx >= axis.back())
+              break;
+            const double Qy = b * Q;
+            if (Qy < axis.front() || Qy >= axis.back())
+              break;
+            // Find the indices pointing to the place in the 2D array where
+            // this bin's contents should go
+            const auto xIndex = static_cast<size_t>(
+                std::upper_bound(axis.begin(), axis.end(), Qx) - axis.begin() -
+                1);
+            const auto yIndex = static_cast<size_t>(
+                std::upper_bound(axis.begin(), axis.end(), Qy) - axis.begin() -
+                1);
+            const size_t cell = yIndex * numQBins + xIndex;
+
+            // Add the contents of the current bin to the 2D array, the errors
+            // are added in quadrature
+            sums.counts[cell] += Y[j];
+            sums.countErrors2[cell] += E[j] * E[j];
+
+            // account for masked bins
+            if (!maskFractions.empty()) {
+              maskFraction = maskFractions[j];
+            }
+            // add the total weight for this bin in the weights workspace,
+            // in an equivalent bin to where the data was stored
+
+            // first take into account the product of contributions to the
+            // weight which have no errors
+            double weight = 0.0;
+            if (doSolidAngle)
+              weight = maskFraction * angle;
+            else
+              weight = maskFraction;
+
+            // then the product of contributions which have errors, i.e.
+            // optional pixelAdj and waveAdj contributions
+            if (pixelAdj && waveAdj) {
+              auto pixelY = pixelAdj->y(i)[0];
+              auto pixelE = pixelAdj->e(i)[0];
+
+              auto waveY = waveAdj->y(0)[j];
+              auto waveE = waveAdj->e(0)[j];
+
+              sums.weights[cell] += weight * pixelY * waveY;
+              const double pixelYSq = pixelY * pixelY;
+              const double pixelESq = pixelE * pixelE;
+              const double waveYSq = waveY * waveY;
+              const double waveESq = waveE * waveE;
+              // add product of errors from pixelAdj and waveAdj (note no
+              // error on weight is assumed)
+              sums.weightErrors2[cell] +=
+                  weight * weight * (waveESq * pixelYSq + pixelESq * waveYSq);
+            } else if (pixelAdj) {
+              auto pixelY = pixelAdj->y(i)[0];
+              auto pixelE = pixelAdj->e(i)[0];
+
+              sums.weights[cell] += weight * pixelY;
+              const double pixelESq = weight * pixelE;
+              // add error from pixelAdj
+              sums.weightErrors2[cell] += pixelESq * pixelESq;
+            } else if (waveAdj) {
+              auto waveY = waveAdj->y(0)[j];
+              auto waveE = waveAdj->e(0)[j];
+
+              sums.weights[cell] += weight * waveY;
+              const double waveESq = weight * waveE;
+              // add error from waveAdj
+              sums.weightErrors2[cell] += waveESq * waveESq;
+            } else
+              sums.weights[cell] += weight;
+          } // loop over single spectrum
+
+          prog.report("Calculating Q");
+        } // loop over the spectra of the chunk
+      },
+      [](QxySums &partial, QxySums &next) { partial += next; },
+      [&total](size_t, QxySums &sums) { std::swap(total, sums); });
+
+  // copy the sums to the output and weights workspaces, taking the square
+  // root of the summed squared errors
+  for (size_t yIndex = 0; yIndex < numQBins; ++yIndex) {
+    const size_t offset = yIndex * numQBins;
+    auto &outputY = outputWorkspace->mutableY(yIndex);
+    auto &outputE = outputWorkspace->mutableE(yIndex);
+    auto &weightsY = weights->mutableY(yIndex);
+    auto &weightsE = weights->mutableE(yIndex);
+    for (size_t xIndex = 0; xIndex < numQBins; ++xIndex) {
+      outputY[xIndex] = total.counts[offset + xIndex];
+      outputE[xIndex] = std::sqrt(total.countErrors2[offset + xIndex]);
+      weightsY[xIndex] = total.weights[offset + xIndex];
+      weightsE[xIndex] = std::sqrt(total.weightErrors2[offset + xIndex]);
     }
-    double maskFraction(1);
-
-    // this object is not used if gravity correction is off, but it is only
-    // constructed once per spectrum
-    GravitySANSHelper grav;
-    if (doGravity) {
-      grav = GravitySANSHelper(spectrumInfo, i, getProperty("ExtraLength"));
-    }
-
-    for (int j = static_cast<int>(numBins) - 1; j >= static_cast<int>(wavStart);
-         --j) {
-      if (j < 0)
-        break; // Be careful with counting down. Need a better fix but this will
-               // work for now
-      const double binWidth = X[j + 1] - X[j];
-      // Calculate the wavelength at the mid-point of this bin
-      const double wavLength = X[j] + (binWidth) / 2.0;
-
-      if (doGravity) {
-        // SANS instruments must have their y-axis pointing up, show the
-        // detector position as where the neutron would be without gravity
-        sinTheta = grav.calcComponents(wavLength, a, b);
-      }
-
-      // Calculate |Q| for this bin
-      const double Q = 4.0 * M_PI * sinTheta / wavLength;
-
-      // Now get the x & y components of Q.
-      const double Qx = a * Q;
-      // Test whether they're in range, if not go to next spectrum.
-      if (Qx < axis.front() || Qx >= axis.back())
-        break;
-      const double Qy = b * Q;
-      if (Qy < axis.front() || Qy >= axis.back())
-        break;
-      // Find the indices pointing to the place in the 2D array where this bin's
-      // contents should go
-      const auto xIndex =
-          std::upper_bound(axis.begin(), axis.end(), Qx) - axis.begin() - 1;
-      const int yIndex = static_cast<int>(
-          std::upper_bound(axis.begin(), axis.end(), Qy) - axis.begin() - 1);
-      //      PARALLEL_CRITICAL(qxy)    /* Write to shared memory - must protect
-      //      */
-      {
-        // the data will be copied to this bin in the output array
-        double &outputBinY = outputWorkspace->mutableY(yIndex)[xIndex];
-        double &outputBinE = outputWorkspace->mutableE(yIndex)[xIndex];
-
-        if (std::isnan(outputBinY)) {
-          outputBinY = outputBinE = 0;
-        }
-        // Add the contents of the current bin to the 2D array.
-        outputBinY += Y[j];
-        // add the errors in quadranture
-        outputBinE = std::sqrt((outputBinE * outputBinE) + (E[j] * E[j]));
-
-        // account for masked bins
-        if (!maskFractions.empty()) {
-          maskFraction = maskFractions[j];
-        }
-        // add the total weight for this bin in the weights workspace,
-        // in an equivalent bin to where the data was stored
-
-        // first take into account the product of contributions to the weight
-        // which have no errors
-        double weight = 0.0;
-        if (doSolidAngle)
-          weight = maskFraction * angle;
-        else
-          weight = maskFraction;
-
-        // then the product of contributions which have errors, i.e. optional
-        // pixelAdj and waveAdj contributions
-        auto &outWeightsY = weights->mutableY(yIndex);
-        auto &outWeightsE = weights->mutableE(yIndex);
-
-        if (pixelAdj && waveAdj) {
-          auto pixelY = pixelAdj->y(i)[0];
-          auto pixelE = pixelAdj->e(i)[0];
-
-          auto waveY = waveAdj->y(0)[j];
-          auto waveE = waveAdj->e(0)[j];
-
-          outWeightsY[xIndex] += weight * pixelY * waveY;
-          const double pixelYSq = pixelY * pixelY;
-          const double pixelESq = pixelE * pixelE;
-          const double waveYSq = waveY * waveY;
-          const double waveESq = waveE * waveE;
-          // add product of errors from pixelAdj and waveAdj (note no error on
-          // weight is assumed)
-          outWeightsE[xIndex] +=
-              weight * weight * (waveESq * pixelYSq + pixelESq * waveYSq);
-        } else if (pixelAdj) {
-          auto pixelY = pixelAdj->y(i)[0];
-          auto pixelE = pixelAdj->e(i)[0];
-
-          outWeightsY[xIndex] += weight * pixelY;
-          const double pixelESq = weight * pixelE;
-          // add error from pixelAdj
-          outWeightsE[xIndex] += pixelESq * pixelESq;
-        } else if (waveAdj) {
-          auto waveY = waveAdj->y(0)[j];
-          auto waveE = waveAdj->e(0)[j];
-
-          outWeightsY[xIndex] += weight * waveY;
-          const double waveESq = weight * waveE;
-          // add error from waveAdj
-          outWeightsE[xIndex] += waveESq * waveESq;
-        } else
-          outWeightsY[xIndex] += weight;
-      }
-    } // loop over single spectrum
-
-    prog.report("Calculating Q");
-
-  } // loop over all spectra
-
-  // take sqrt of error weight values
-  // left to be executed here for computational efficiency
-  size_t numHist = weights->getNumberHistograms();
-  for (size_t i = 0; i < numHist; i++) {
-    auto &weightsE = weights->mutableE(i);
-    std::transform(weightsE.cbegin(), weightsE.cend(), weightsE.begin(),
-                   [&](double val) { return sqrt(val); });
   }
 
   bool doOutputParts = getProperty("OutputParts");
@@ -111,7 +111,7 @@ void RealFFT::exec() {
     gsl_fft_real_workspace *workspace = gsl_fft_real_workspace_alloc(ySize);
     boost::shared_array<double> data(new double[2 * ySize]);
 
-    auto &yData = inWS->mutableY(spec);
+    const auto &yData = inWS->y(spec);
     for (int i = 0; i < ySize; i++) {
       data[i] = yData[i];
     }
@@ -163,8 +163,8 @@ void RealFFT::exec() {
 
     auto &xData = outWS->mutableX(0);
     auto &yData = outWS->mutableY(0);
-    auto &y0 = inWS->mutableY(0);
-    auto &y1 = inWS->mutableY(1);
+    const auto &y0 = inWS->y(0);
+    const auto &y1 = inWS->y(1);
     for (int i = 0; i < ySize; i++) {
       int j = i * 2;
       xData[i] = df * i;
@@ -10,6 +10,7 @@
 
 #include "MantidAPI/Axis.h"
 #include "MantidAPI/HistoWorkspace.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
 #include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
@@ -250,14 +251,28 @@ void Rebin::exec() {
           1, std::unique_ptr<Axis>(inputWS->getAxis(1)->clone(outputWS.get())));
     bool ignoreBinErrors = getProperty("IgnoreBinErrors");
 
+    // When all the spectra share their bin edges, find the overlaps of the
+    // old and new bins only once. Invalid bin edges are left to be reported
+    // for each spectrum as usual.
+    std::unique_ptr<HistogramData::Rebinner> rebinner;
+    if (histnumber > 1 && WorkspaceHelpers::sharedXData(*inputWS)) {
+      try {
+        rebinner = std::make_unique<HistogramData::Rebinner>(
+            inputWS->binEdges(0), XValues_new);
+      } catch (InvalidBinEdgesError &) {
+      }
+    }
+
     Progress prog(this, 0.0, 1.0, histnumber);
     PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
     for (int hist = 0; hist < histnumber; ++hist) {
       PARALLEL_START_INTERUPT_REGION
 
       try {
+        const auto &histogram = inputWS->histogram(hist);
         outputWS->setHistogram(
-            hist, HistogramData::rebin(inputWS->histogram(hist), XValues_new));
+            hist, rebinner ? rebinner->rebin(histogram)
+                           : HistogramData::rebin(histogram, XValues_new));
       } catch (InvalidBinEdgesError &) {
         if (ignoreBinErrors)
           outputWS->setBinEdges(hist, XValues_new);
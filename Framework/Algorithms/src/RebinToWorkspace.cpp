@@ -7,6 +7,7 @@
 #include "MantidAlgorithms/RebinToWorkspace.h"
 #include "MantidAPI/HistogramValidator.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
@@ -130,6 +131,14 @@ void RebinToWorkspace::rebin(MatrixWorkspace_sptr &toRebin,
   const bool matchingX =
       (toRebin->getNumberHistograms() != toMatch->getNumberHistograms());
 
+  // When all the input spectra share their bin edges and are rebinned onto
+  // the same edges, find the overlaps of the bins only once
+  std::unique_ptr<HistogramData::Rebinner> rebinner;
+  if (!m_isEvents && matchingX && numHist > 1 &&
+      WorkspaceHelpers::sharedXData(*toRebin))
+    rebinner = std::make_unique<HistogramData::Rebinner>(
+        toRebin->binEdges(0), toMatch->binEdges(0));
+
   // rebin
   PARALLEL_FOR_IF(Kernel::threadSafe(*toMatch, *outputWS))
   for (int i = 0; i < numHist; ++i) {
@@ -138,6 +147,8 @@ void RebinToWorkspace::rebin(MatrixWorkspace_sptr &toRebin,
                                   : toMatch->histogram(i).binEdges();
     if (m_isEvents) {
       outputWSEvents->getSpectrum(i).setHistogram(edges);
+    } else if (rebinner) {
+      outputWS->setHistogram(i, rebinner->rebin(toRebin->histogram(i)));
     } else {
       outputWS->setHistogram(
           i, HistogramData::rebin(toRebin->histogram(i), edges));
@@ -0,0 +1,342 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/ReflectometryBatchReduction.h"
+#include "MantidAPI/ADSValidator.h"
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Progress.h"
+#include "MantidAPI/WorkspaceGroup.h"
+#include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/RebinParamsValidator.h"
+
+#include <set>
+
+namespace Mantid {
+namespace Algorithms {
+
+using namespace Mantid::API;
+using namespace Mantid::Kernel;
+
+namespace {
+/// The transmission workspaces are stored in the ADS with this prefix
+const std::string TRANSMISSION_PREFIX("TRANS_LAM");
+
+/// Whether a property of ReflectometryReductionOneAuto is a setting that is
+/// shared by all the runs of the batch
+bool isReductionSetting(const Property &prop) {
+  static const std::set<std::string> perRun{"ThetaIn", "MomentumTransferMin",
+                                            "MomentumTransferMax"};
+  return prop.direction() == Direction::Input &&
+         !dynamic_cast<const IWorkspaceProperty *>(&prop) &&
+         perRun.count(prop.name()) == 0;
+}
+} // namespace
+
+// Register the algorithm into the AlgorithmFactory
+DECLARE_ALGORITHM(ReflectometryBatchReduction)
+
+/// Algorithm's name for identification. @see Algorithm::name
+const std::string ReflectometryBatchReduction::name() const {
+  return "ReflectometryBatchReduction";
+}
+
+/// Algorithm's version for identification. @see Algorithm::version
+int ReflectometryBatchReduction::version() const { return 1; }
+
+/// Algorithm's category for identification. @see Algorithm::category
+const std::string ReflectometryBatchReduction::category() const {
+  return "Reflectometry\\ISIS";
+}
+
+/// Algorithm's summary for use in the GUI and help. @see Algorithm::summary
+const std::string ReflectometryBatchReduction::summary() const {
+  return "Reduces the runs of a batch, one per angle, in parallel and "
+         "stitches them into a single workspace in Q.";
+}
+
+/** Initialize the algorithm's properties.
+ */
+void ReflectometryBatchReduction::init() {
+  declareProperty(std::make_unique<ArrayProperty<std::string>>(
+                      "InputWorkspaces", boost::make_shared<ADSValidator>()),
+                  "The runs of the batch in TOF or wavelength, one per angle.");
+  declareProperty(std::make_unique<ArrayProperty<double>>("ThetaIn"),
+                  "The angle in degrees of each run. If empty, the angles "
+                  "are found as in ReflectometryReductionOneAuto.");
+  declareProperty(std::make_unique<ArrayProperty<std::string>>(
+                      "FirstTransmissionRuns",
+                      boost::make_shared<ADSValidator>(true, true)),
+                  "The first transmission run of each run, or a single one "
+                  "for all of them.");
+  declareProperty(std::make_unique<ArrayProperty<std::string>>(
+                      "SecondTransmissionRuns",
+                      boost::make_shared<ADSValidator>(true, true)),
+                  "The second transmission run of each run, or a single one "
+                  "for all of them.");
+
+  // The settings shared by the reductions of all the runs
+  auto reduction = AlgorithmManager::Instance().createUnmanaged(
+      "ReflectometryReductionOneAuto", 3);
+  reduction->initialize();
+  for (const auto prop : reduction->getProperties()) {
+    if (isReductionSetting(*prop))
+      copyProperty(reduction, prop->name());
+  }
+
+  declareProperty(std::make_unique<ArrayProperty<double>>(
+                      "StitchParams",
+                      boost::make_shared<RebinParamsValidator>(true)),
+                  "Rebinning parameters in Q of the stitched workspace, see "
+                  "Stitch1DMany.");
+  declareProperty(std::make_unique<WorkspaceProperty<Workspace>>(
+                      "OutputWorkspace", "", Direction::Output),
+                  "The stitched workspace in Q.");
+}
+
+/// Cross-check properties with each other @see IAlgorithm::validateInputs
+std::map<std::string, std::string>
+ReflectometryBatchReduction::validateInputs() {
+  std::map<std::string, std::string> results;
+  const std::vector<std::string> inputNames = getProperty("InputWorkspaces");
+  const std::vector<double> thetas = getProperty("ThetaIn");
+  if (!thetas.empty() && thetas.size() != inputNames.size())
+    results["ThetaIn"] = "Must have one angle per input workspace.";
+  for (const auto &propertyName :
+       {"FirstTransmissionRuns", "SecondTransmissionRuns"}) {
+    const std::vector<std::string> transmissionNames =
+        getProperty(propertyName);
+    if (transmissionNames.size() > 1 &&
+        transmissionNames.size() != inputNames.size())
+      results[propertyName] = "Must have a single transmission run or one per "
+                              "input workspace.";
+  }
+  if (isDefault("FirstTransmissionRuns") &&
+      !isDefault("SecondTransmissionRuns"))
+    results["SecondTransmissionRuns"] =
+        "Second transmission runs require first transmission runs.";
+  return results;
+}
+
+/** Execute the algorithm.
+ */
+void ReflectometryBatchReduction::exec() {
+  const std::vector<std::string> inputNames = getProperty("InputWorkspaces");
+  const auto numberOfRuns = static_cast<int64_t>(inputNames.size());
+  std::vector<double> thetas = getProperty("ThetaIn");
+  if (thetas.empty())
+    thetas.assign(inputNames.size(), EMPTY_DBL());
+  const auto firstTransmissions = getTransmissionRuns("FirstTransmissionRuns");
+  const auto secondTransmissions =
+      getTransmissionRuns("SecondTransmissionRuns");
+
+  // Runs that share transmission runs share the transmission workspace, which
+  // is identified by the run numbers
+  std::vector<std::string> transmissionNames(inputNames.size());
+  std::map<std::string, size_t> firstUse;
+  for (size_t i = 0; i < inputNames.size(); ++i) {
+    if (firstTransmissions[i].empty())
+      continue;
+    transmissionNames[i] =
+        getTransmissionName(firstTransmissions[i], secondTransmissions[i]);
+    firstUse.emplace(transmissionNames[i], i);
+  }
+  const std::vector<std::pair<std::string, size_t>> transmissions(
+      firstUse.begin(), firstUse.end());
+  const auto numberOfTransmissions =
+      static_cast<int64_t>(transmissions.size());
+
+  Progress progress(this, 0.0, 1.0, numberOfTransmissions + numberOfRuns + 1);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfTransmissions; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto run = transmissions[i].second;
+    makeTransmissionWorkspace(firstTransmissions[run],
+                              secondTransmissions[run],
+                              transmissions[i].first);
+    progress.report("Converting transmission runs");
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // The names of the outputs are chosen here, as the reductions running in
+  // parallel would not see each other's outputs in the ADS
+  const auto outputSuffixes = getOutputSuffixes(inputNames);
+  std::vector<std::string> reducedNames(inputNames.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfRuns; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    reducedNames[i] = reduce(inputNames[i], thetas[i], transmissionNames[i],
+                             outputSuffixes[i]);
+    progress.report("Reducing runs");
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  progress.report("Stitching");
+  setProperty("OutputWorkspace", stitch(reducedNames));
+}
+
+/** Get the transmission runs of all the input workspaces from a property
+ * @param propertyName :: The name of the property listing the transmission
+ * runs
+ * @return :: The name of the transmission run of each input workspace, or
+ * empty names if there are none
+ */
+std::vector<std::string> ReflectometryBatchReduction::getTransmissionRuns(
+    const std::string &propertyName) const {
+  const std::vector<std::string> inputNames = getProperty("InputWorkspaces");
+  const std::vector<std::string> names = getProperty(propertyName);
+  if (names.empty())
+    return std::vector<std::string>(inputNames.size());
+  if (names.size() == 1)
+    return std::vector<std::string>(inputNames.size(), names.front());
+  return names;
+}
+
+/** Get a transmission run from the ADS. As in ReflectometryReductionOneAuto,
+ * only the first workspace of a group is used.
+ * @param name :: The name of the transmission run
+ * @return :: The transmission run
+ */
+MatrixWorkspace_sptr
+ReflectometryBatchReduction::getTransmissionRun(const std::string &name) const {
+  auto ws = AnalysisDataService::Instance().retrieve(name);
+  if (auto group = boost::dynamic_pointer_cast<WorkspaceGroup>(ws))
+    ws = group->getItem(0);
+  auto matrixWS = boost::dynamic_pointer_cast<MatrixWorkspace>(ws);
+  if (!matrixWS)
+    throw std::invalid_argument("Transmission run " + name +
+                                " is not a MatrixWorkspace");
+  return matrixWS;
+}
+
+/** Get the name of the transmission workspace made from a pair of
+ * transmission runs, from their run numbers if they have them
+ * @param first :: The name of the first transmission run
+ * @param second :: The name of the second transmission run, or empty
+ * @return :: The name of the transmission workspace in the ADS
+ */
+std::string ReflectometryBatchReduction::getTransmissionName(
+    const std::string &first, const std::string &second) const {
+  std::string name = TRANSMISSION_PREFIX;
+  for (const auto &runName : {first, second}) {
+    if (runName.empty())
+      continue;
+    const auto runNumber = getRunNumber(*getTransmissionRun(runName));
+    name += runNumber.empty() ? "_" + runName : runNumber;
+  }
+  return name;
+}
+
+/** Convert a pair of transmission runs to a transmission workspace in
+ * wavelength and store it in the ADS
+ * @param first :: The name of the first transmission run
+ * @param second :: The name of the second transmission run, or empty
+ * @param outputName :: The name of the transmission workspace
+ */
+void ReflectometryBatchReduction::makeTransmissionWorkspace(
+    const std::string &first, const std::string &second,
+    const std::string &outputName) {
+  auto alg =
+      createChildAlgorithm("CreateTransmissionWorkspaceAuto", -1, -1, true, 2);
+  setReductionSettings(*alg);
+  if (!isDefault("TransmissionProcessingInstructions"))
+    alg->setPropertyValue(
+        "ProcessingInstructions",
+        getPropertyValue("TransmissionProcessingInstructions"));
+  alg->setProperty("FirstTransmissionRun", getTransmissionRun(first));
+  if (!second.empty())
+    alg->setProperty("SecondTransmissionRun", getTransmissionRun(second));
+  alg->execute();
+  MatrixWorkspace_sptr transmissionWS = alg->getProperty("OutputWorkspace");
+  AnalysisDataService::Instance().addOrReplace(outputName, transmissionWS);
+}
+
+/** Get the suffix of the names of the outputs of each run. As for the
+ * transmission workspaces, it is the run number if the run has one, or else
+ * the name of the run. The name is also used if an earlier run has the same
+ * run number, so that the suffixes are unique.
+ * @param inputNames :: The names of the runs
+ * @return :: The suffix of each run
+ */
+std::vector<std::string> ReflectometryBatchReduction::getOutputSuffixes(
+    const std::vector<std::string> &inputNames) const {
+  std::vector<std::string> suffixes;
+  std::set<std::string> used;
+  for (const auto &inputName : inputNames) {
+    const auto ws =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(inputName);
+    auto suffix = ws ? getRunNumber(*ws) : "";
+    if (suffix.empty() || used.count(suffix) > 0)
+      suffix = "_" + inputName;
+    used.insert(suffix);
+    suffixes.emplace_back(std::move(suffix));
+  }
+  return suffixes;
+}
+
+/** Reduce a run with ReflectometryReductionOneAuto. The outputs are stored in
+ * the ADS with the default prefixes followed by the given suffix.
+ * @param inputName :: The name of the run
+ * @param theta :: The angle of the run, or EMPTY_DBL() to find it
+ * @param transmissionName :: The name of the transmission workspace, or empty
+ * @param outputSuffix :: The suffix of the names of the outputs
+ * @return :: The name of the binned output workspace in Q
+ */
+std::string
+ReflectometryBatchReduction::reduce(const std::string &inputName,
+                                    const double theta,
+                                    const std::string &transmissionName,
+                                    const std::string &outputSuffix) {
+  auto alg =
+      createChildAlgorithm("ReflectometryReductionOneAuto", -1, -1, true, 3);
+  alg->setAlwaysStoreInADS(true);
+  alg->setRethrows(true);
+  setReductionSettings(*alg);
+  alg->setPropertyValue("InputWorkspace", inputName);
+  if (theta != EMPTY_DBL())
+    alg->setProperty("ThetaIn", theta);
+  if (!transmissionName.empty())
+    alg->setPropertyValue("FirstTransmissionRun", transmissionName);
+  alg->setPropertyValue("OutputWorkspace", "IvsQ" + outputSuffix);
+  alg->setPropertyValue("OutputWorkspaceBinned", "IvsQ_binned" + outputSuffix);
+  alg->setPropertyValue("OutputWorkspaceWavelength", "IvsLam" + outputSuffix);
+  alg->execute();
+  return alg->getPropertyValue("OutputWorkspaceBinned");
+}
+
+/** Stitch the reduced runs together in one pass with Stitch1DMany
+ * @param names :: The names of the reduced runs in the ADS
+ * @return :: The stitched workspace
+ */
+Workspace_sptr
+ReflectometryBatchReduction::stitch(const std::vector<std::string> &names) {
+  if (names.size() == 1)
+    return AnalysisDataService::Instance().retrieve(names.front());
+  auto alg = createChildAlgorithm("Stitch1DMany");
+  alg->setProperty("InputWorkspaces", names);
+  alg->setPropertyValue("Params", getPropertyValue("StitchParams"));
+  alg->setPropertyValue("OutputWorkspace",
+                        getPropertyValue("OutputWorkspace"));
+  alg->execute();
+  return alg->getProperty("OutputWorkspace");
+}
+
+/** Set the settings of a child algorithm that were given to this algorithm
+ * @param alg :: The child algorithm
+ */
+void ReflectometryBatchReduction::setReductionSettings(IAlgorithm &alg) const {
+  for (const auto prop : alg.getProperties()) {
+    const auto &name = prop->name();
+    if (isReductionSetting(*prop) && existsProperty(name) && !isDefault(name))
+      alg.setPropertyValue(name, getPropertyValue(name));
+  }
+}
+
+} // namespace Algorithms
+} // namespace Mantid
@@ -20,6 +20,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/ParallelReduce.h"
 #include "MantidKernel/Strings.h"
 
 namespace {
@@ -70,6 +71,21 @@ double projectToReference(
          std::sin(twoTheta - refAngles.horizon);
 }
 
+/// Counts and squared errors summed in virtual lambda by a chunk of spectra
+struct ProjectedSums {
+  explicit ProjectedSums(const size_t numberOfBins = 0)
+      : counts(numberOfBins, 0.), errors2(numberOfBins, 0.) {}
+  ProjectedSums &operator+=(const ProjectedSums &other) {
+    std::transform(counts.begin(), counts.end(), other.counts.begin(),
+                   counts.begin(), std::plus<double>());
+    std::transform(errors2.begin(), errors2.end(), other.errors2.begin(),
+                   errors2.begin(), std::plus<double>());
+    return *this;
+  }
+  std::vector<double> counts;
+  std::vector<double> errors2;
+};
+
 /**
  * Share the given input counts into the output array bins proportionally
  * according to how much the bins overlap the given lambda range.
@@ -78,33 +94,20 @@ double projectToReference(
  * @param inputCounts [in] :: the input counts to share out
  * @param inputErr [in] :: the input errors to share out
  * @param lambdaRange [in] :: the width of the input in virtual lambda
- * @param IvsLam [in,out] :: the output workspace
+ * @param outputX [in] :: the output bin edges
+ * @param startIdx [in] :: the first output bin overlapping lambdaRange
+ * @param outputY [in,out] :: the projected counts
  * @param outputE [in,out] :: the projected E values
  */
 void shareCounts(
     const double inputCounts, const double inputErr,
     const Mantid::Algorithms::ReflectometrySumInQ::MinMax &lambdaRange,
-    Mantid::API::MatrixWorkspace &IvsLam, std::vector<double> &outputE) {
-  // Check that we have histogram data
-  const auto &outputX = IvsLam.x(0);
-  auto &outputY = IvsLam.mutableY(0);
-
+    const Mantid::HistogramData::HistogramX &outputX, const size_t startIdx,
+    std::vector<double> &outputY, std::vector<double> &outputE) {
   const double totalWidth = lambdaRange.max - lambdaRange.min;
 
-  // Get the first bin edge in the output X array that is within range.
-  // There will probably be some overlap, so start from the bin edge before
-  // this (unless we're already at the first bin edge).
-  auto startIter =
-      std::lower_bound(outputX.begin(), outputX.end(), lambdaRange.min);
-  if (startIter != outputX.begin()) {
-    --startIter;
-  }
-
-  // Loop through all overlapping output bins. Convert the iterator to an
-  // index because we need to index both the X and Y arrays.
-  const auto xSize = static_cast<int>(outputX.size());
-  for (auto outIdx = startIter - outputX.begin(); outIdx < xSize - 1;
-       ++outIdx) {
+  // Loop through all overlapping output bins.
+  for (auto outIdx = startIdx; outIdx + 1 < outputX.size(); ++outIdx) {
     const double binStart = outputX[outIdx];
     const double binEnd = outputX[outIdx + 1];
     if (binStart > lambdaRange.max) {
@@ -130,6 +133,61 @@ void shareCounts(
   }
 }
 
+/**
+ * Share the counts of a spectrum onto the projected output in virtual-lambda.
+ *
+ * @param edges [in] :: the input spectrum bin edges
+ * @param counts [in] :: the input spectrum counts
+ * @param stdDevs [in] :: the input spectrum count standard deviations
+ * @param factors [in] :: the projection factors of the pixel
+ * @param outputX [in] :: the output bin edges
+ * @param sums [in,out] :: the projected counts and squared errors
+ * @param projectedE [out] :: workspace for the projected errors
+ */
+void sumSpectrum(
+    const Mantid::HistogramData::BinEdges &edges,
+    const Mantid::HistogramData::Counts &counts,
+    const Mantid::HistogramData::CountStandardDeviations &stdDevs,
+    const Mantid::Algorithms::ReflectometrySumInQ::MinMax &factors,
+    const Mantid::HistogramData::HistogramX &outputX, ProjectedSums &sums,
+    std::vector<double> &projectedE) {
+  // Project the bin edges to virtual lambda. The projection of a pixel is a
+  // scaling, so this is a plain loop of products.
+  const size_t ySize = counts.size();
+  std::vector<double> lower(ySize);
+  std::vector<double> upper(ySize);
+  for (size_t i = 0; i < ySize; ++i) {
+    lower[i] = edges[i] * factors.min;
+    upper[i] = edges[i + 1] * factors.max;
+  }
+  // Output Y values can simply be accumulated, but the projected errors of
+  // each input spectrum are summed first and then added in quadrature.
+  std::fill(projectedE.begin(), projectedE.end(), 0.);
+  // The projected ranges increase with the input bins, so the first output
+  // bin they overlap is found by moving on from that of the previous bin.
+  size_t startIdx = 0;
+  Mantid::Algorithms::ReflectometrySumInQ::MinMax lambdaRange;
+  for (size_t i = 0; i < ySize; ++i) {
+    // Check whether there are any counts (if not, nothing to share)
+    const double inputCounts = counts[i];
+    if (edges[i] < 0. || inputCounts <= 0.0 || std::isnan(inputCounts) ||
+        std::isinf(inputCounts)) {
+      continue;
+    }
+    lambdaRange.min = lower[i];
+    lambdaRange.max = upper[i];
+    while (startIdx + 1 < outputX.size() &&
+           outputX[startIdx + 1] < lambdaRange.min) {
+      ++startIdx;
+    }
+    shareCounts(inputCounts, stdDevs[i], lambdaRange, outputX, startIdx,
+                sums.counts, projectedE);
+  }
+  for (size_t outIdx = 0; outIdx < projectedE.size(); ++outIdx) {
+    sums.errors2[outIdx] += projectedE[outIdx] * projectedE[outIdx];
+  }
+}
+
 /**
  * Return the angular 2theta width of a pixel.
  *
@@ -427,57 +485,24 @@ ReflectometrySumInQ::MinMax ReflectometrySumInQ::findWavelengthMinMax(
 }
 
 /**
- * Share counts from an input value onto the projected output in virtual-lambda
- *
- * @param inputIdx [in] :: the index of the input histogram
- * @param twoThetaRange [in] :: the 2theta width of the pixel
- * @param refAngles [in] :: the reference 2theta angles
- * @param edges [in] :: the input spectrum bin edges
- * @param counts [in] :: the input spectrum counts
- * @param stdDevs [in] :: the input spectrum count standard deviations
- * @param IvsLam [in,out] :: the output workspace
- * @param outputE [in,out] :: the projected E values
- */
-void ReflectometrySumInQ::processValue(
-    const int inputIdx, const MinMax &twoThetaRange, const Angles &refAngles,
-    const HistogramData::BinEdges &edges, const HistogramData::Counts &counts,
-    const HistogramData::CountStandardDeviations &stdDevs,
-    API::MatrixWorkspace &IvsLam, std::vector<double> &outputE) {
-
-  // Check whether there are any counts (if not, nothing to share)
-  const double inputCounts = counts[inputIdx];
-  if (edges[inputIdx] < 0. || inputCounts <= 0.0 || std::isnan(inputCounts) ||
-      std::isinf(inputCounts)) {
-    return;
-  }
-  // Get the bin width and the bin centre
-  const MinMax wavelengthRange(edges[inputIdx], edges[inputIdx + 1]);
-  // Project these coordinates onto the virtual-lambda output (at twoThetaR)
-  const auto lambdaRange =
-      projectedLambdaRange(wavelengthRange, twoThetaRange, refAngles);
-  // Share the input counts into the output array
-  shareCounts(inputCounts, stdDevs[inputIdx], lambdaRange, IvsLam, outputE);
-}
-
-/**
- * Project an input pixel onto an arbitrary reference line at a reference angle.
- * The projection is done along lines of constant Q, which emanate from the
- * horizon angle at wavelength = 0. The top-left and bottom-right corners of
- * the pixel are projected, resulting in an output range in "virtual" lambda.
+ * Return the factors projecting an input pixel onto an arbitrary reference
+ * line at a reference angle. The projection is done along lines of constant
+ * Q, which emanate from the horizon angle at wavelength = 0. The top-left and
+ * bottom-right corners of the pixel are projected, so the lower edge of an
+ * input bin is scaled by `min` and the upper edge by `max` to give its range
+ * in "virtual" lambda.
  *
  * For a description of this projection, see:
  *   R. Cubitt, T. Saerbeck, R.A. Campbell, R. Barker, P. Gutfreund
  *   J. Appl. Crystallogr., 48 (6) (2015)
  *
- * @param wavelengthRange [in] :: the bin edges of the input bin
  * @param twoThetaRange [in] :: the 2theta width of the pixel
  * @param refAngles [in] :: the reference angles
- * @return :: the projected wavelength range
+ * @return :: the projection factors of the lower and upper bin edges
  */
 ReflectometrySumInQ::MinMax
-ReflectometrySumInQ::projectedLambdaRange(const MinMax &wavelengthRange,
-                                          const MinMax &twoThetaRange,
-                                          const Angles &refAngles) {
+ReflectometrySumInQ::projectionFactors(const MinMax &twoThetaRange,
+                                       const Angles &refAngles) {
 
   // We cannot project pixels below the horizon angle
   if (twoThetaRange.min <= refAngles.horizon) {
@@ -489,13 +514,10 @@ ReflectometrySumInQ::projectedLambdaRange(const MinMax &wavelengthRange,
         std::to_string(refAngles.horizon * Geometry::rad2deg));
   }
 
-  // Calculate the projected wavelength range
-  MinMax range;
-  range.max =
-      projectToReference(wavelengthRange.max, twoThetaRange.min, refAngles);
-  range.min =
-      projectToReference(wavelengthRange.min, twoThetaRange.max, refAngles);
-  return range;
+  MinMax factors;
+  factors.max = projectToReference(1., twoThetaRange.min, refAngles);
+  factors.min = projectToReference(1., twoThetaRange.max, refAngles);
+  return factors;
 }
 
 /**
@@ -532,46 +554,52 @@ API::MatrixWorkspace_sptr
 ReflectometrySumInQ::sumInQ(const API::MatrixWorkspace &detectorWS,
                             const Indexing::SpectrumIndexSet &indices) {
 
-  const auto spectrumInfo = detectorWS.spectrumInfo();
+  const auto &spectrumInfo = detectorWS.spectrumInfo();
   const auto refAngles = referenceAngles(spectrumInfo);
   // Construct the output workspace in virtual lambda
   API::MatrixWorkspace_sptr IvsLam =
       constructIvsLamWS(detectorWS, indices, refAngles);
-  auto &outputE = IvsLam->mutableE(0);
-  // Loop through each spectrum in the detector group
+  const auto &outputX = IvsLam->x(0);
+  const auto numberOfBins = IvsLam->blocksize();
+  // The projection of each pixel in the detector group depends only on its
+  // size in twoTheta, so the factors are calculated once per pixel.
+  std::vector<std::vector<size_t>> spectra(1);
+  std::vector<MinMax> factors;
   for (const auto spIdx : indices) {
     if (spectrumInfo.isMasked(spIdx) || spectrumInfo.isMonitor(spIdx)) {
       continue;
     }
-    // Get the size of this detector in twoTheta
-    const auto twoThetaRange = twoThetaWidth(spIdx, spectrumInfo);
-    const auto inputBinEdges = detectorWS.binEdges(spIdx);
-    const auto inputCounts = detectorWS.counts(spIdx);
-    const auto inputStdDevs = detectorWS.countStandardDeviations(spIdx);
-    // Create a vector for the projected errors for this spectrum.
-    // (Output Y values can simply be accumulated directly into the output
-    // workspace, but for error values we need to create a separate error
-    // vector for the projected errors from each input spectrum and then
-    // do an overall sum in quadrature.)
-    std::vector<double> projectedE(outputE.size(), 0.0);
-    // Process each value in the spectrum
-    const auto ySize = static_cast<int>(inputCounts.size());
-    for (int inputIdx = 0; inputIdx < ySize; ++inputIdx) {
-      // Do the summation in Q
-      processValue(inputIdx, twoThetaRange, refAngles, inputBinEdges,
-                   inputCounts, inputStdDevs, *IvsLam, projectedE);
-    }
-    // Sum errors in quadrature
-    const auto eSize = static_cast<int>(outputE.size());
-    for (int outIdx = 0; outIdx < eSize; ++outIdx) {
-      outputE[outIdx] += projectedE[outIdx] * projectedE[outIdx];
-    }
+    spectra.front().emplace_back(spIdx);
+    factors.emplace_back(
+        projectionFactors(twoThetaWidth(spIdx, spectrumInfo), refAngles));
   }
+  // Sum the spectra in chunks in parallel
+  ProjectedSums total;
+  Kernel::reduceGroups(
+      spectra, 50, Kernel::threadSafe(detectorWS),
+      [numberOfBins](size_t) { return ProjectedSums(numberOfBins); },
+      [&](ProjectedSums &sums, size_t, const size_t *first,
+          const size_t *last) {
+        std::vector<double> projectedE(numberOfBins);
+        for (auto index = first; index != last; ++index) {
+          const auto spIdx = *index;
+          const auto &pixelFactors = factors[index - spectra.front().data()];
+          sumSpectrum(detectorWS.binEdges(spIdx), detectorWS.counts(spIdx),
+                      detectorWS.countStandardDeviations(spIdx), pixelFactors,
+                      outputX, sums, projectedE);
+        }
+      },
+      [](ProjectedSums &sums, ProjectedSums &next) { sums += next; },
+      [&total](size_t, ProjectedSums &sums) { std::swap(total, sums); });
 
   // Take the square root of all the accumulated squared errors for this
   // detector group. Assumes Gaussian errors
+  auto &outputY = IvsLam->mutableY(0);
+  auto &outputE = IvsLam->mutableE(0);
+  std::copy(total.counts.cbegin(), total.counts.cend(), outputY.begin());
   double (*rs)(double) = std::sqrt;
-  std::transform(outputE.begin(), outputE.end(), outputE.begin(), rs);
+  std::transform(total.errors2.cbegin(), total.errors2.cend(), outputE.begin(),
+                 rs);
 
   return IvsLam;
 }
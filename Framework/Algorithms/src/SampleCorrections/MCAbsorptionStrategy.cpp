@@ -11,12 +11,118 @@
 
 #include "MantidAlgorithms/SampleCorrections/RectangularBeamProfile.h"
 #include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/Material.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace Mantid {
+using Geometry::IObject;
+using Geometry::Track;
 using Kernel::PseudoRandomNumberGenerator;
 
 namespace Algorithms {
 
+namespace {
+/// Number of events whose tracks are generated before they are evaluated
+constexpr size_t EVENTS_PER_BATCH = 1024;
+
+/**
+ * The segments of the tracks of a batch of events, held in flat arrays so
+ * that the attenuation of the whole batch is evaluated in tight loops. The
+ * attenuation coefficient of each object crossed is only computed once.
+ */
+class TrackBatch {
+public:
+  TrackBatch(const double lambdaBefore, const double lambdaAfter)
+      : m_lambdaBefore(lambdaBefore), m_lambdaAfter(lambdaAfter) {
+    m_segmentEvent.reserve(4 * EVENTS_PER_BATCH);
+    m_segmentCoefficient.reserve(4 * EVENTS_PER_BATCH);
+    m_segmentLength.reserve(4 * EVENTS_PER_BATCH);
+    m_exponents.reserve(EVENTS_PER_BATCH);
+  }
+
+  /// Remove the events of the batch
+  void clear() {
+    m_segmentEvent.clear();
+    m_segmentCoefficient.clear();
+    m_segmentLength.clear();
+    m_nevents = 0;
+  }
+
+  /// Add an event from its tracks before and after scattering
+  void addEvent(const Track &beforeScatter, const Track &afterScatter) {
+    addSegments(beforeScatter, false);
+    addSegments(afterScatter, true);
+    ++m_nevents;
+  }
+
+  /// @return the sum of the attenuation factors of the events
+  double sumAttenuation() {
+    // exp(-sum(mu * l)) is the product of the attenuations of the segments
+    m_exponents.assign(m_nevents, 0.0);
+    for (size_t i = 0; i < m_segmentLength.size(); ++i) {
+      m_exponents[m_segmentEvent[i]] -=
+          m_coefficients[m_segmentCoefficient[i]] * m_segmentLength[i];
+    }
+    std::transform(m_exponents.cbegin(), m_exponents.cend(),
+                   m_exponents.begin(),
+                   [](const double exponent) { return std::exp(exponent); });
+    double sum(0.0);
+    for (const double factor : m_exponents) {
+      sum += factor;
+    }
+    return sum;
+  }
+
+private:
+  void addSegments(const Track &path, const bool afterScatter) {
+    for (const auto &segment : path) {
+      m_segmentEvent.emplace_back(m_nevents);
+      m_segmentCoefficient.emplace_back(
+          coefficientIndex(*segment.object, afterScatter));
+      m_segmentLength.emplace_back(segment.distInsideObject);
+    }
+  }
+
+  /// @return the index in m_coefficients of the attenuation coefficient of
+  /// an object, before or after scattering
+  size_t coefficientIndex(const IObject &object, const bool afterScatter) {
+    auto found = std::find(m_objects.cbegin(), m_objects.cend(), &object);
+    const auto index =
+        static_cast<size_t>(std::distance(m_objects.cbegin(), found));
+    if (found == m_objects.cend()) {
+      m_objects.emplace_back(&object);
+      const auto &material = object.material();
+      // The same coefficient as Material::attenuation
+      const auto coefficient = [&material](const double lambda) {
+        return 100 * material.numberDensity() *
+               (material.totalScatterXSection() +
+                material.absorbXSection(lambda));
+      };
+      m_coefficients.emplace_back(coefficient(m_lambdaBefore));
+      m_coefficients.emplace_back(coefficient(m_lambdaAfter));
+    }
+    return 2 * index + (afterScatter ? 1 : 0);
+  }
+
+  const double m_lambdaBefore;
+  const double m_lambdaAfter;
+  /// Objects crossed by the tracks, in the order they were first seen
+  std::vector<const IObject *> m_objects;
+  /// Attenuation coefficients of the objects before and after scattering
+  std::vector<double> m_coefficients;
+  /// Event, coefficient and length of each segment
+  std::vector<uint32_t> m_segmentEvent;
+  std::vector<size_t> m_segmentCoefficient;
+  std::vector<double> m_segmentLength;
+  /// Attenuation exponents, then factors, of the events
+  std::vector<double> m_exponents;
+  uint32_t m_nevents = 0;
+};
+} // namespace
+
 /**
  * Constructor
  * @param beamProfile A reference to the object the beam profile
@@ -50,29 +156,37 @@ MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
                                 const Kernel::V3D &finalPos,
                                 double lambdaBefore, double lambdaAfter) const {
   const auto scatterBounds = m_scatterVol.getBoundingBox();
+  // The tracks are generated a batch at a time, in the same order as the
+  // random numbers are drawn, and the attenuation of each batch evaluated
+  // in one go
+  TrackBatch batch(lambdaBefore, lambdaAfter);
+  Track beforeScatter, afterScatter;
   double factor(0.0);
-  for (size_t i = 0; i < m_nevents; ++i) {
-    size_t attempts(0);
-    do {
-      const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
-
-      const double wgt = m_scatterVol.calculateAbsorption(
-          rng, neutron.startPos, finalPos, lambdaBefore, lambdaAfter);
-      if (wgt < 0.0) {
+  for (size_t first = 0; first < m_nevents; first += EVENTS_PER_BATCH) {
+    const size_t batchSize = std::min(EVENTS_PER_BATCH, m_nevents - first);
+    batch.clear();
+    for (size_t i = 0; i < batchSize; ++i) {
+      size_t attempts(0);
+      do {
+        const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
+        if (m_scatterVol.calculateBeforeAfterTrack(rng, neutron.startPos,
+                                                   finalPos, beforeScatter,
+                                                   afterScatter)) {
+          batch.addEvent(beforeScatter, afterScatter);
+          break;
+        }
         ++attempts;
-      } else {
-        factor += wgt;
-        break;
-      }
-      if (attempts == m_maxScatterAttempts) {
-        throw std::runtime_error("Unable to generate valid track through "
-                                 "sample interaction volume after " +
-                                 std::to_string(m_maxScatterAttempts) +
-                                 " attempts. Try increasing the maximum "
-                                 "threshold or if this does not help then "
-                                 "please check the defined shape.");
-      }
-    } while (true);
+        if (attempts == m_maxScatterAttempts) {
+          throw std::runtime_error("Unable to generate valid track through "
+                                   "sample interaction volume after " +
+                                   std::to_string(m_maxScatterAttempts) +
+                                   " attempts. Try increasing the maximum "
+                                   "threshold or if this does not help then "
+                                   "please check the defined shape.");
+        }
+      } while (true);
+    }
+    factor += batch.sumAttenuation();
   }
   using std::make_tuple;
   return make_tuple(factor / static_cast<double>(m_nevents), m_error);
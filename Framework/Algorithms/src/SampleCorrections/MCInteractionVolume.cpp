@@ -72,6 +72,44 @@ const Geometry::BoundingBox &MCInteractionVolume::getBoundingBox() const {
 double MCInteractionVolume::calculateAbsorption(
     Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
     const Kernel::V3D &endPos, double lambdaBefore, double lambdaAfter) const {
+  Track beforeScatter, afterScatter;
+  if (!calculateBeforeAfterTrack(rng, startPos, endPos, beforeScatter,
+                                 afterScatter)) {
+    return -1.0;
+  }
+
+  // Function to calculate total attenuation for a track
+  auto calculateAttenuation = [](const Track &path, double lambda) {
+    double factor(1.0);
+    for (const auto &segment : path) {
+      const double length = segment.distInsideObject;
+      const auto &segObj = *(segment.object);
+      factor *= segObj.material().attenuation(length, lambda);
+    }
+    return factor;
+  };
+  return calculateAttenuation(beforeScatter, lambdaBefore) *
+         calculateAttenuation(afterScatter, lambdaAfter);
+}
+
+/**
+ * Generate a scatter point and the tracks through the volume from it back to
+ * the start point and on to the end point.
+ * @param rng A reference to a PseudoRandomNumberGenerator producing
+ * random number between [0,1]
+ * @param startPos Origin of the initial track
+ * @param endPos Final position of neutron after scattering (assumed to be
+ * outside of the "volume")
+ * @param beforeScatter Reset to the track from the scatter point towards the
+ * start point, with its links through the volume
+ * @param afterScatter Reset to the track from the scatter point towards the
+ * end point, with its links through the volume
+ * @return False if the tracks are not valid
+ */
+bool MCInteractionVolume::calculateBeforeAfterTrack(
+    Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
+    const Kernel::V3D &endPos, Track &beforeScatter,
+    Track &afterScatter) const {
   // Generate scatter point. If there is an environment present then
   // first select whether the scattering occurs on the sample or the
   // environment. The attenuation for the path leading to the scatter point
@@ -86,8 +124,8 @@ double MCInteractionVolume::calculateAbsorption(
     scatterPos = m_sample->generatePointInObject(rng, m_activeRegion,
                                                  m_maxScatterAttempts);
   }
-  const auto toStart = normalize(startPos - scatterPos);
-  Track beforeScatter(scatterPos, toStart);
+  beforeScatter.clearIntersectionResults();
+  beforeScatter.reset(scatterPos, normalize(startPos - scatterPos));
   int nlinks = m_sample->interceptSurface(beforeScatter);
   if (m_env) {
     nlinks += m_env->interceptSurfaces(beforeScatter);
@@ -95,29 +133,17 @@ double MCInteractionVolume::calculateAbsorption(
   // This should not happen but numerical precision means that it can
   // occasionally occur with tracks that are very close to the surface
   if (nlinks == 0) {
-    return -1.0;
+    return false;
   }
 
-  // Function to calculate total attenuation for a track
-  auto calculateAttenuation = [](const Track &path, double lambda) {
-    double factor(1.0);
-    for (const auto &segment : path) {
-      const double length = segment.distInsideObject;
-      const auto &segObj = *(segment.object);
-      factor *= segObj.material().attenuation(length, lambda);
-    }
-    return factor;
-  };
-
   // Now track to final destination
-  const V3D scatteredDirec = normalize(endPos - scatterPos);
-  Track afterScatter(scatterPos, scatteredDirec);
+  afterScatter.clearIntersectionResults();
+  afterScatter.reset(scatterPos, normalize(endPos - scatterPos));
   m_sample->interceptSurface(afterScatter);
   if (m_env) {
     m_env->interceptSurfaces(afterScatter);
   }
-  return calculateAttenuation(beforeScatter, lambdaBefore) *
-         calculateAttenuation(afterScatter, lambdaAfter);
+  return true;
 }
 
 } // namespace Algorithms
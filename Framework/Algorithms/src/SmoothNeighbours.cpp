@@ -258,6 +258,15 @@ void SmoothNeighbours::findNeighboursRectangular() {
     EndY = SumY - 1;
   }
 
+  // The weights depend only on the offset from the centre pixel, so they are
+  // the same for every pixel and are calculated once
+  const int stencilY = EndY - StartY + 1;
+  std::vector<double> stencil((EndX - StartX + 1) * stencilY);
+  for (int ix = StartX; ix <= EndX; ix++)
+    for (int iy = StartY; iy <= EndY; iy++)
+      stencil[(ix - StartX) * stencilY + (iy - StartY)] =
+          WeightedSum->weightAt(AdjX, ix, AdjY, iy);
+
   outWI = 0;
   // Build a map to sort by the detectorID
   std::vector<std::pair<int, int>> v1;
@@ -285,15 +294,16 @@ void SmoothNeighbours::findNeighboursRectangular() {
           for (int ix = StartX; ix <= EndX; ix++)
             for (int iy = StartY; iy <= EndY; iy++) {
               // Weights for corners=1; higher for center and adjacent pixels
-              double smweight = WeightedSum->weightAt(AdjX, ix, AdjY, iy);
+              double smweight =
+                  stencil[(ix - StartX) * stencilY + (iy - StartY)];
 
               // Find the pixel ID at that XY position on the rectangular
-              // detector
+              // detector, without creating the detector object
               if (j + ix >= det->xpixels() - Edge || j + ix < Edge)
                 continue;
               if (k + iy >= det->ypixels() - Edge || k + iy < Edge)
                 continue;
-              int pixelID = det->getAtXY(j + ix, k + iy)->getID();
+              int pixelID = det->getDetectorIDAtXY(j + ix, k + iy);
 
               // Find the corresponding workspace index, if any
               auto mapEntry = pixel_to_wi.find(pixelID);
@@ -614,35 +624,31 @@ void SmoothNeighbours::execWorkspace2D() {
     auto &outX = outSpec.mutableX();
 
     // Which are the neighbours?
-    std::vector<weightedNeighbour> &neighbours = m_neighbours[outWIi];
-    std::vector<weightedNeighbour>::iterator it;
-    for (it = neighbours.begin(); it != neighbours.end(); ++it) {
-      size_t inWI = it->first;
-      double weight = it->second;
-      double weightSquared = weight * weight;
+    const std::vector<weightedNeighbour> &neighbours = m_neighbours[outWIi];
+    for (const auto &neighbour : neighbours) {
+      const double weight = neighbour.second;
+      const double weightSquared = weight * weight;
 
-      const auto &inSpec = inWS->getSpectrum(inWI);
-      const auto &inY = inSpec.y();
-      const auto &inE = inSpec.e();
-      const auto &inX = inSpec.x();
+      const auto &inSpec = inWS->getSpectrum(neighbour.first);
+      const double *inY = inSpec.y().rawData().data();
+      const double *inE = inSpec.e().rawData().data();
 
       for (size_t i = 0; i < YLength; i++) {
         // Add the weighted signal
         outY[i] += inY[i] * weight;
         // Square the error, scale by weight (which you have to square too),
         // then add in quadrature
-        double errorSquared = inE[i];
-        errorSquared *= errorSquared;
-        errorSquared *= weightSquared;
-        outE[i] += errorSquared;
-        // Copy the X values as well
-        outX[i] = inX[i];
-      }
-      if (inWS->isHistogramData()) {
-        outX[YLength] = inX[YLength];
+        outE[i] += inE[i] * inE[i] * weightSquared;
       }
     } //(each neighbour)
 
+    // Copy the X values as well, from the last neighbour as before
+    if (!neighbours.empty()) {
+      const auto &inX = inWS->x(neighbours.back().first);
+      const size_t xLength = std::min(inX.size(), outX.size());
+      std::copy(inX.cbegin(), inX.cbegin() + xLength, outX.begin());
+    }
+
     // Now un-square the error, since we summed it in quadrature
     for (size_t i = 0; i < YLength; i++)
       outE[i] = sqrt(outE[i]);
@@ -27,6 +27,8 @@
 
 #include <boost/math/special_functions/pow.hpp>
 
+#include <mutex>
+
 using Mantid::Geometry::rad2deg;
 using boost::math::pow;
 
@@ -269,6 +271,83 @@ std::pair<double, double> twoThetasFromTable(
   }
   return minmax;
 }
+
+using BinOverlap = Mantid::DataObjects::FractionalRebinning::BinOverlap;
+
+/// Overlaps of the input bins with the output grid, by output workspace index
+using OverlapsByOutput = std::vector<std::vector<BinOverlap>>;
+
+/// The parameters that determine the overlaps of the input and output bins
+struct OverlapGeometry {
+  int emode{0};
+  std::vector<double> energyBins;
+  std::vector<double> qBins;
+  std::vector<double> outputEnergyBins;
+  /// Whether each input spectrum is rebinned
+  std::vector<bool> rebinned;
+  /// Lower and upper 2theta and efixed of each input spectrum
+  std::vector<double> spectra;
+
+  bool operator==(const OverlapGeometry &other) const {
+    return emode == other.emode && energyBins == other.energyBins &&
+           qBins == other.qBins && outputEnergyBins == other.outputEnergyBins &&
+           rebinned == other.rebinned && spectra == other.spectra;
+  }
+};
+
+/// Overlaps kept from the last run with CacheOverlaps set
+struct OverlapCache {
+  std::mutex mutex;
+  OverlapGeometry geometry;
+  std::shared_ptr<const OverlapsByOutput> overlaps;
+};
+
+OverlapCache &overlapCache() {
+  static OverlapCache cache;
+  return cache;
+}
+
+/**
+ * Collect the parameters which determine the overlaps of the input bins with
+ * the output grid. Runs with equal geometries share the same overlaps.
+ * @param inputWS the input workspace
+ * @param outputWS the output workspace
+ * @param emodeProperties the energy mode and efixed of the rebinning
+ * @param qBins the output Q axis
+ * @param twoThetaLowers the lower 2theta of each input spectrum
+ * @param twoThetaUppers the upper 2theta of each input spectrum
+ * @return the geometry of the rebinning
+ */
+OverlapGeometry
+overlapGeometry(const Mantid::API::MatrixWorkspace &inputWS,
+                const Mantid::API::MatrixWorkspace &outputWS,
+                const Mantid::Algorithms::SofQCommon &emodeProperties,
+                const std::vector<double> &qBins,
+                const std::vector<double> &twoThetaLowers,
+                const std::vector<double> &twoThetaUppers) {
+  OverlapGeometry geometry;
+  geometry.emode = emodeProperties.m_emode;
+  geometry.energyBins = inputWS.x(0).rawData();
+  geometry.qBins = qBins;
+  geometry.outputEnergyBins = outputWS.x(0).rawData();
+  const size_t nHistos = inputWS.getNumberHistograms();
+  geometry.rebinned.resize(nHistos, false);
+  geometry.spectra.reserve(3 * nHistos);
+  const auto &spectrumInfo = inputWS.spectrumInfo();
+  for (size_t i = 0; i < nHistos; ++i) {
+    if (spectrumInfo.isMasked(i) || spectrumInfo.isMonitor(i)) {
+      continue;
+    }
+    geometry.rebinned[i] = true;
+    geometry.spectra.emplace_back(twoThetaLowers[i]);
+    geometry.spectra.emplace_back(twoThetaUppers[i]);
+    geometry.spectra.emplace_back(
+        emodeProperties.m_emode == 2
+            ? emodeProperties.getEFixed(spectrumInfo.detector(i))
+            : emodeProperties.m_efixed);
+  }
+  return geometry;
+}
 } // namespace
 
 namespace Mantid {
@@ -309,6 +388,12 @@ const std::string SofQWNormalisedPolygon::category() const {
  */
 void SofQWNormalisedPolygon::init() {
   SofQW::createCommonInputProperties(*this);
+  declareProperty(
+      "CacheOverlaps", false,
+      "If true, keep the overlaps of the input bins with the output grid in "
+      "memory and reuse them in later runs with the same binning, angles and "
+      "efixed, for example for the sample, container and vanadium runs. The "
+      "overlaps are released by the next run without this option.");
 }
 
 /** Checks that the input workspace and table have compatible dimensions
@@ -398,6 +483,31 @@ void SofQWNormalisedPolygon::exec() {
   const auto &inputIndices = inputWS->indexInfo();
   const auto &spectrumInfo = inputWS->spectrumInfo();
 
+  // With CacheOverlaps the overlaps are calculated once for a geometry and
+  // applied as a whole, so that the output spectra can be filled in parallel
+  const bool cacheOverlaps = getProperty("CacheOverlaps");
+  OverlapGeometry geometry;
+  std::shared_ptr<const OverlapsByOutput> cachedOverlaps;
+  if (cacheOverlaps) {
+    geometry = overlapGeometry(*inputWS, *outputWS, m_EmodeProperties, m_Qout,
+                               m_twoThetaLowers, m_twoThetaUppers);
+    auto &cache = overlapCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.overlaps && cache.geometry == geometry) {
+      g_log.debug("Reusing the cached bin overlaps.\n");
+      cachedOverlaps = cache.overlaps;
+    }
+  } else {
+    auto &cache = overlapCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.overlaps.reset();
+    cache.geometry = OverlapGeometry();
+  }
+  const bool calculateOverlaps = cacheOverlaps && !cachedOverlaps;
+  std::vector<std::vector<BinOverlap>> inputOverlaps(
+      calculateOverlaps ? nHistos : 0);
+  const auto &outputX = outputWS->x(0).rawData();
+
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
   for (int64_t i = 0; i < static_cast<int64_t>(nHistos); ++i) {
     PARALLEL_START_INTERUPT_REGION
@@ -422,21 +532,29 @@ void SofQWNormalisedPolygon::exec() {
 
       const double lrQ = m_EmodeProperties.q(dE_jp1, thetaLower, det);
 
-      const V2D ll(dE_j, m_EmodeProperties.q(dE_j, thetaLower, det));
-      const V2D lr(dE_jp1, lrQ);
-      const V2D ur(dE_jp1, m_EmodeProperties.q(dE_jp1, thetaUpper, det));
-      const V2D ul(dE_j, m_EmodeProperties.q(dE_j, thetaUpper, det));
-      if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
-        logStream << "Spectrum=" << specNo
-                  << ", lower theta=" << thetaLower * rad2deg
-                  << ", upper theta=" << thetaUpper * rad2deg
-                  << ". QE polygon: ll=" << ll << ", lr=" << lr << ", ur=" << ur
-                  << ", ul=" << ul << "\n";
-      }
+      if (!cachedOverlaps) {
+        const V2D ll(dE_j, m_EmodeProperties.q(dE_j, thetaLower, det));
+        const V2D lr(dE_jp1, lrQ);
+        const V2D ur(dE_jp1, m_EmodeProperties.q(dE_jp1, thetaUpper, det));
+        const V2D ul(dE_j, m_EmodeProperties.q(dE_j, thetaUpper, det));
+        if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
+          logStream << "Spectrum=" << specNo
+                    << ", lower theta=" << thetaLower * rad2deg
+                    << ", upper theta=" << thetaUpper * rad2deg
+                    << ". QE polygon: ll=" << ll << ", lr=" << lr
+                    << ", ur=" << ur << ", ul=" << ul << "\n";
+        }
 
-      using FractionalRebinning::rebinToFractionalOutput;
-      rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i, j,
-                              *outputWS, m_Qout);
+        if (calculateOverlaps) {
+          FractionalRebinning::calculateOverlaps(Quadrilateral(ll, lr, ur, ul),
+                                                 i, j, outputX, m_Qout,
+                                                 inputOverlaps[i]);
+        } else {
+          using FractionalRebinning::rebinToFractionalOutput;
+          rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i,
+                                  j, *outputWS, m_Qout);
+        }
+      }
 
       // Find which q bin this point lies in
       const MantidVec::difference_type qIndex =
@@ -460,6 +578,27 @@ void SofQWNormalisedPolygon::exec() {
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  if (calculateOverlaps) {
+    // Group the overlaps by output spectrum, keeping the input order
+    auto overlaps =
+        std::make_shared<OverlapsByOutput>(outputWS->getNumberHistograms());
+    for (auto &spectrumOverlaps : inputOverlaps) {
+      for (const auto &overlap : spectrumOverlaps) {
+        (*overlaps)[overlap.outputIndex].push_back(overlap);
+      }
+      std::vector<BinOverlap>().swap(spectrumOverlaps);
+    }
+    cachedOverlaps = std::move(overlaps);
+    auto &cache = overlapCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.geometry = std::move(geometry);
+    cache.overlaps = cachedOverlaps;
+  }
+  if (cachedOverlaps) {
+    FractionalRebinning::rebinToFractionalOutput(*cachedOverlaps, inputWS,
+                                                 *outputWS);
+  }
+
   outputWS->finalize();
   FractionalRebinning::normaliseOutput(outputWS, inputWS, m_progress.get());
 
@@ -111,7 +111,9 @@ protected:
 struct GenericShape : public SolidAngleCalculator {
   using SolidAngleCalculator::SolidAngleCalculator;
   double solidAngle(size_t index) const override {
-    return m_detectorInfo.detector(index).solidAngle(m_samplePos);
+    // Going through ComponentInfo avoids building a parametrized detector for
+    // every pixel
+    return m_componentInfo.solidAngle(index, m_samplePos);
   }
 };
 
@@ -275,8 +277,8 @@ void SolidAngle::exec() {
     initSpectrum(*inputWS, *outputWS, j);
     if (spectrumInfo.hasDetectors(j)) {
       double solidAngle = 0.0;
-      for (const auto detID : inputWS->getSpectrum(j).getDetectorIDs()) {
-        const auto index = detectorInfo.indexOf(detID);
+      for (const auto &spectrumIndex : spectrumInfo.spectrumDefinition(j)) {
+        const auto index = spectrumIndex.first;
         if (!detectorInfo.isMasked(index) && !detectorInfo.isMonitor(index)) {
           solidAngle += solidAngleCalculator->solidAngle(index);
         }
@@ -12,6 +12,7 @@
 #include "MantidAlgorithms/RunCombinationHelpers/RunCombinationHelper.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 #include <boost/make_shared.hpp>
@@ -235,27 +236,27 @@ void Stitch1DMany::exec() {
   if (m_inputWSMatrix.size() > 1) {   // groups
     std::vector<std::string> toGroup; // List of workspaces to be grouped
     std::string groupName = this->getProperty("OutputWorkspace");
-    std::string outName;
 
     // Determine whether or not we are scaling workspaces using scale
     // factors from a specific period
     const bool usingScaleFromPeriod =
         m_useManualScaleFactors && isDefault("ManualScaleFactors");
 
-    if (!usingScaleFromPeriod) {
-      for (size_t i = 0; i < m_inputWSMatrix.front().size(); ++i) {
-
-        outName = groupName;
-        std::vector<double> scaleFactors;
-        doStitch1DMany(i, m_useManualScaleFactors, outName, scaleFactors);
+    // The periods are independent of each other and are stitched in parallel
+    const auto numberOfPeriods =
+        static_cast<int64_t>(m_inputWSMatrix.front().size());
+    std::vector<std::string> outNames(numberOfPeriods, groupName);
+    std::vector<std::vector<double>> scaleFactors(numberOfPeriods);
 
-        // Add the resulting workspace to the list to be grouped together
-        toGroup.emplace_back(outName);
-
-        // Add the scalefactors to the list so far
-        m_scaleFactors.insert(m_scaleFactors.end(), scaleFactors.begin(),
-                              scaleFactors.end());
+    if (!usingScaleFromPeriod) {
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t i = 0; i < numberOfPeriods; ++i) {
+        PARALLEL_START_INTERUPT_REGION
+        doStitch1DMany(static_cast<size_t>(i), m_useManualScaleFactors,
+                       outNames[i], scaleFactors[i]);
+        PARALLEL_END_INTERUPT_REGION
       }
+      PARALLEL_CHECK_INTERUPT_REGION
     } else {
       // Obtain scale factors for the specified period
       std::string tempOutName;
@@ -265,20 +266,29 @@ void Stitch1DMany::exec() {
       doStitch1DMany(m_scaleFactorFromPeriod, false, tempOutName,
                      periodScaleFactors, storeInADS);
 
-      // Iterate over each period
-      for (size_t i = 0; i < m_inputWSMatrix.front().size(); ++i) {
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t i = 0; i < numberOfPeriods; ++i) {
+        PARALLEL_START_INTERUPT_REGION
         std::vector<MatrixWorkspace_sptr> inMatrix;
         inMatrix.reserve(m_inputWSMatrix.size());
         for (const auto &ws : m_inputWSMatrix)
           inMatrix.emplace_back(ws[i]);
 
-        outName = groupName;
         Workspace_sptr outStitchedWS;
-        doStitch1D(inMatrix, periodScaleFactors, outStitchedWS, outName);
-        // Add name of stitched workspaces to group list and ADS
-        toGroup.emplace_back(outName);
-        AnalysisDataService::Instance().addOrReplace(outName, outStitchedWS);
+        doStitch1D(inMatrix, periodScaleFactors, outStitchedWS, outNames[i],
+                   scaleFactors[i]);
+        AnalysisDataService::Instance().addOrReplace(outNames[i],
+                                                     outStitchedWS);
+        PARALLEL_END_INTERUPT_REGION
       }
+      PARALLEL_CHECK_INTERUPT_REGION
+    }
+
+    // Group the stitched workspaces and list the scale factors in period order
+    for (int64_t i = 0; i < numberOfPeriods; ++i) {
+      toGroup.emplace_back(outNames[i]);
+      m_scaleFactors.insert(m_scaleFactors.end(), scaleFactors[i].begin(),
+                            scaleFactors[i].end());
     }
 
     IAlgorithm_sptr groupAlg = createChildAlgorithm("GroupWorkspaces");
@@ -293,7 +303,7 @@ void Stitch1DMany::exec() {
   } else {
     std::string tempOutName;
     doStitch1D(m_inputWSMatrix.front(), m_manualScaleFactors, m_outputWorkspace,
-               tempOutName);
+               tempOutName, m_scaleFactors);
   }
   // Save output
   this->setProperty("OutputWorkspace", m_outputWorkspace);
@@ -305,10 +315,12 @@ void Stitch1DMany::exec() {
  * @param manualScaleFactors :: Provided values for scaling factors
  * @param outWS :: Output stitched workspace
  * @param outName :: Output stitched workspace name
+ * @param outScaleFactors :: Actual values used for scale factors
  */
 void Stitch1DMany::doStitch1D(std::vector<MatrixWorkspace_sptr> &toStitch,
                               const std::vector<double> &manualScaleFactors,
-                              Workspace_sptr &outWS, std::string &outName) {
+                              Workspace_sptr &outWS, std::string &outName,
+                              std::vector<double> &outScaleFactors) {
 
   auto lhsWS = toStitch.front();
   outName += "_" + lhsWS->getName();
@@ -335,7 +347,7 @@ void Stitch1DMany::doStitch1D(std::vector<MatrixWorkspace_sptr> &toStitch,
 
     lhsWS = alg->getProperty("OutputWorkspace");
     double outScaleFactor = alg->getProperty("OutScaleFactor");
-    m_scaleFactors.emplace_back(outScaleFactor);
+    outScaleFactors.emplace_back(outScaleFactor);
 
     if (!isChild()) {
       // Copy each input workspace's history into our output workspace's
@@ -31,6 +31,9 @@
 
 #include <boost/math/special_functions/round.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -42,6 +45,31 @@ using namespace HistogramData;
 using namespace DataObjects;
 using namespace Kernel;
 
+namespace {
+/// Where the counts of one spectrum go in the output, with their weights
+struct BinContribution {
+  size_t heightIndex = 0;
+  /// The scattering angle bin, negative if the spectrum is not used
+  int angleIndex = -1;
+  double weight = 1.0;
+  /// The neighbouring bin that takes a share of split counts, or -1
+  int neighbourIndex = -1;
+  double neighbourWeight = 0.0;
+  double counts = 0.0;
+  double error = 0.0;
+};
+
+/// Add weighted counts to a bin, summing the errors in quadrature
+void addToBin(HistogramY &yData, HistogramE &eSquared,
+              std::vector<double> &normalisation, const int index,
+              const double weight, const double counts, const double error) {
+  const auto newError = error * weight;
+  yData[index] += counts * weight;
+  eSquared[index] += newError * newError;
+  normalisation[index] += weight;
+}
+} // namespace
+
 void SumOverlappingTubes::init() {
   declareProperty(std::make_unique<ArrayProperty<std::string>>(
                       "InputWorkspaces", boost::make_shared<ADSValidator>()),
@@ -295,9 +323,12 @@ SumOverlappingTubes::performBinning(MatrixWorkspace_sptr &outputWS) {
   // loop over all workspaces
   for (auto &ws : m_workspaceList) {
     m_progress->report("Processing workspace " + std::string(ws->getName()));
-    // loop over spectra
+    // Work out where each spectrum goes in parallel, then add the counts up in
+    // spectrum order, so no locking is needed and the sums do not depend on
+    // the scheduling of the threads
     const auto &specInfo = ws->spectrumInfo();
-    PARALLEL_FOR_IF(Kernel::threadSafe(*ws, *outputWS))
+    std::vector<BinContribution> contributions(specInfo.size());
+    PARALLEL_FOR_IF(Kernel::threadSafe(*ws))
     for (int i = 0; i < static_cast<int>(specInfo.size()); ++i) {
       PARALLEL_START_INTERUPT_REGION
       if (specInfo.isMonitor(i) || specInfo.isMasked(i))
@@ -335,56 +366,55 @@ SumOverlappingTubes::performBinning(MatrixWorkspace_sptr &outputWS) {
         continue;
 
       const double deltaAngle = distanceFromAngle(angleIndex, angle);
-      const auto counts = ws->histogram(i).y()[0];
-      const auto error = ws->histogram(i).e()[0];
-
-      PARALLEL_CRITICAL(Histogramming2ThetaVsHeight) {
-        auto &yData = outputWS->mutableY(heightIndex);
-        auto &eData = outputWS->mutableE(heightIndex);
-        // counts are split between bins if outside this tolerance
-        if (splitCounts &&
-            deltaAngle > m_stepScatteringAngle * scatteringAngleTolerance) {
-          int angleIndexNeighbor;
-          if (distanceFromAngle(angleIndex - 1, angle) <
-              distanceFromAngle(angleIndex + 1, angle))
-            angleIndexNeighbor = angleIndex - 1;
-          else
-            angleIndexNeighbor = angleIndex + 1;
-
-          double deltaAngleNeighbor =
-              distanceFromAngle(angleIndexNeighbor, angle);
-
-          const auto scalingFactor = deltaAngleNeighbor / m_stepScatteringAngle;
-          const auto newError = error * scalingFactor;
-          yData[angleIndex] += counts * scalingFactor;
-          eData[angleIndex] =
-              sqrt(eData[angleIndex] * eData[angleIndex] + newError * newError);
-
-          normalisation[heightIndex][angleIndex] +=
-              (deltaAngleNeighbor / m_stepScatteringAngle);
-
-          if (angleIndexNeighbor >= 0 &&
-              angleIndexNeighbor < int(m_numPoints)) {
-            const auto scalingFactorNeighbor =
-                deltaAngle / m_stepScatteringAngle;
-            const auto newErrorNeighbor = error * scalingFactorNeighbor;
-            yData[angleIndexNeighbor] += counts * scalingFactorNeighbor;
-            eData[angleIndexNeighbor] =
-                sqrt(eData[angleIndexNeighbor] * eData[angleIndexNeighbor] +
-                     newErrorNeighbor * newErrorNeighbor);
-            normalisation[heightIndex][angleIndexNeighbor] +=
-                (deltaAngle / m_stepScatteringAngle);
-          }
-        } else {
-          yData[angleIndex] += counts;
-          eData[angleIndex] =
-              sqrt(eData[angleIndex] * eData[angleIndex] + error * error);
-          normalisation[heightIndex][angleIndex]++;
+
+      auto &contribution = contributions[i];
+      contribution.heightIndex = heightIndex;
+      contribution.angleIndex = angleIndex;
+      contribution.counts = ws->y(i)[0];
+      contribution.error = ws->e(i)[0];
+      // counts are split between bins if outside this tolerance
+      if (splitCounts &&
+          deltaAngle > m_stepScatteringAngle * scatteringAngleTolerance) {
+        int angleIndexNeighbor;
+        if (distanceFromAngle(angleIndex - 1, angle) <
+            distanceFromAngle(angleIndex + 1, angle))
+          angleIndexNeighbor = angleIndex - 1;
+        else
+          angleIndexNeighbor = angleIndex + 1;
+
+        double deltaAngleNeighbor =
+            distanceFromAngle(angleIndexNeighbor, angle);
+
+        contribution.weight = deltaAngleNeighbor / m_stepScatteringAngle;
+        if (angleIndexNeighbor >= 0 && angleIndexNeighbor < int(m_numPoints)) {
+          contribution.neighbourIndex = angleIndexNeighbor;
+          contribution.neighbourWeight = deltaAngle / m_stepScatteringAngle;
         }
       }
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
+
+    // The errors are held squared until all workspaces have been added
+    for (const auto &contribution : contributions) {
+      if (contribution.angleIndex < 0)
+        continue;
+      auto &yData = outputWS->mutableY(contribution.heightIndex);
+      auto &eSquared = outputWS->mutableE(contribution.heightIndex);
+      auto &norm = normalisation[contribution.heightIndex];
+      addToBin(yData, eSquared, norm, contribution.angleIndex,
+               contribution.weight, contribution.counts, contribution.error);
+      if (contribution.neighbourIndex >= 0)
+        addToBin(yData, eSquared, norm, contribution.neighbourIndex,
+                 contribution.neighbourWeight, contribution.counts,
+                 contribution.error);
+    }
+  }
+
+  for (size_t j = 0; j < m_numHistograms; ++j) {
+    auto &eData = outputWS->mutableE(j);
+    std::transform(eData.cbegin(), eData.cend(), eData.begin(),
+                   [](const double eSquared) { return std::sqrt(eSquared); });
   }
 
   return normalisation;
@@ -10,15 +10,23 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidAlgorithms/DistributedReduction.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/RebinnedOutput.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/IDetector.h"
+#include "MantidIndexing/GlobalSpectrumIndex.h"
+#include "MantidIndexing/SpectrumIndexSet.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/ParallelReduce.h"
+#include "MantidParallel/Collectives.h"
 
+#include <algorithm>
 #include <functional>
+#include <limits>
+#include <set>
 
 namespace Mantid {
 namespace Algorithms {
@@ -43,7 +51,8 @@ bool validateSingleMatrixWorkspace(
     const MatrixWorkspace &ws, const int minIndex, const int maxIndex,
     const std::vector<int> &indices) {
   bool success(true);
-  const auto numSpectra = static_cast<int>(ws.getNumberHistograms());
+  // The indices are global if the spectra are distributed over MPI ranks
+  const auto numSpectra = static_cast<int>(ws.indexInfo().globalSize());
   // check StartWorkSpaceIndex,  >=0 done by validator
   if (minIndex >= numSpectra) {
     validationOutput["StartWorkspaceIndex"] =
@@ -85,7 +94,7 @@ void validateWorkspaceName(std::map<std::string, std::string> &validationOutput,
                            const std::string &name, const int minIndex,
                            const int maxIndex,
                            const std::vector<int> &indices) {
-  const auto &ads = AnalysisDataService::Instance();
+  auto &ads = AnalysisDataService::Instance();
   if (!ads.doesExist(name))
     return;
   auto wsGroup = ads.retrieveWS<WorkspaceGroup>(name);
@@ -210,9 +219,25 @@ void SumSpectra::exec() {
 
   // Get the input workspace
   MatrixWorkspace_const_sptr localworkspace = getProperty("InputWorkspace");
-  m_numberOfSpectra = static_cast<int>(localworkspace->getNumberHistograms());
+  m_distributed =
+      localworkspace->storageMode() == Parallel::StorageMode::Distributed;
+  m_numberOfSpectra = localworkspace->indexInfo().globalSize();
   determineIndices(m_numberOfSpectra);
-  m_yLength = localworkspace->y(*(m_indices.begin())).size();
+  if (m_distributed) {
+    if (localworkspace->id() == "RebinnedOutput")
+      throw std::runtime_error("Summing a distributed RebinnedOutput "
+                               "workspace is not supported.");
+    // Keep the indices of the spectra on this rank, which may be none
+    const std::vector<Indexing::GlobalSpectrumIndex> globalIndices(
+        m_indices.begin(), m_indices.end());
+    const auto localIndices =
+        localworkspace->indexInfo().makeIndexSet(globalIndices);
+    m_indices.clear();
+    m_indices.insert(localIndices.begin(), localIndices.end());
+  }
+  // All spectra have the same bins, any of them will do
+  const size_t firstIndex = m_indices.empty() ? 0 : *m_indices.begin();
+  m_yLength = localworkspace->y(firstIndex).size();
 
   // determine the output spectrum number
   m_outSpecNum = getOutputSpecNo(localworkspace);
@@ -239,16 +264,26 @@ void SumSpectra::exec() {
       g_log.warning("Ignoring request for WeightedSum");
       m_calculateWeightedSum = false;
     }
-    outputWorkspace = create<EventWorkspace>(*eventW, 1, eventW->binEdges(0));
+    if (m_distributed)
+      outputWorkspace = create<EventWorkspace>(
+          *eventW, makeRootRankIndexInfo(communicator(), 1),
+          eventW->binEdges(0));
+    else
+      outputWorkspace =
+          create<EventWorkspace>(*eventW, 1, eventW->binEdges(0));
 
     execEvent(outputWorkspace, progress, numSpectra, numMasked, numZeros);
   } else {
     //-------Workspace 2D mode -----
 
     // Create the 2D workspace for the output
-    outputWorkspace = API::WorkspaceFactory::Instance().create(
-        localworkspace, 1, localworkspace->x(*(m_indices.begin())).size(),
-        m_yLength);
+    if (m_distributed)
+      outputWorkspace = create<MatrixWorkspace>(
+          *localworkspace, makeRootRankIndexInfo(communicator(), 1),
+          detail::stripData(localworkspace->histogram(firstIndex)));
+    else
+      outputWorkspace = API::WorkspaceFactory::Instance().create(
+          localworkspace, 1, localworkspace->x(firstIndex).size(), m_yLength);
 
     // This is the (only) output spectrum
     auto &outSpec = outputWorkspace->getSpectrum(0);
@@ -321,9 +356,8 @@ void SumSpectra::determineIndices(const size_t numberOfSpectra) {
  */
 specnum_t
 SumSpectra::getOutputSpecNo(MatrixWorkspace_const_sptr localworkspace) {
-  // initial value - any included spectrum will do
-  specnum_t specId =
-      localworkspace->getSpectrum(*(m_indices.begin())).getSpectrumNo();
+  // initial value - larger than any included spectrum
+  specnum_t specId = std::numeric_limits<specnum_t>::max();
 
   // the total number of spectra
   size_t totalSpec = localworkspace->getNumberHistograms();
@@ -337,6 +371,13 @@ SumSpectra::getOutputSpecNo(MatrixWorkspace_const_sptr localworkspace) {
     }
   }
 
+  // The minimum over the spectra of all ranks
+  if (m_distributed) {
+    std::vector<specnum_t> specIds;
+    Parallel::all_gather(communicator(), specId, specIds);
+    specId = *std::min_element(specIds.begin(), specIds.end());
+  }
+
   return specId;
 }
 
@@ -419,6 +460,31 @@ bool useSpectrum(const SpectrumInfo &spectrumInfo, const size_t wsIndex,
   }
   return true;
 }
+
+/// The partial sums of a chunk of the spectra of a Workspace2D
+struct SpectraSum {
+  SpectraSum(const size_t yLength = 0, const bool weighted = false)
+      : y(yLength, 0.), e(yLength, 0.), weight(weighted ? yLength : 0, 0.),
+        nZeros(weighted ? yLength : 0, 0) {}
+  SpectraSum &operator+=(const SpectraSum &other) {
+    std::transform(y.begin(), y.end(), other.y.begin(), y.begin(),
+                   std::plus<double>());
+    // The errors are summed in quadrature
+    std::transform(e.begin(), e.end(), other.e.begin(), e.begin(),
+                   std::plus<double>());
+    std::transform(weight.begin(), weight.end(), other.weight.begin(),
+                   weight.begin(), std::plus<double>());
+    std::transform(nZeros.begin(), nZeros.end(), other.nZeros.begin(),
+                   nZeros.begin(), std::plus<size_t>());
+    detectorIDs.insert(other.detectorIDs.begin(), other.detectorIDs.end());
+    return *this;
+  }
+  std::vector<double> y;
+  std::vector<double> e;
+  std::vector<double> weight;
+  std::vector<size_t> nZeros;
+  std::set<detid_t> detectorIDs;
+};
 } // anonymous namespace
 
 /**
@@ -442,55 +508,83 @@ void SumSpectra::doSimpleSum(MatrixWorkspace_sptr outputWorkspace,
   auto &YSum = outSpec.mutableY();
   auto &YErrorSum = outSpec.mutableE();
 
-  std::vector<double> Weight;
-  std::vector<size_t> nZeros;
-  if (m_calculateWeightedSum) {
-    Weight.assign(YSum.size(), 0.);
-    nZeros.assign(YSum.size(), 0);
-  }
-
+  // Select the spectra to sum first, they are then summed in parallel chunks
+  std::vector<std::vector<size_t>> spectra(1);
   const auto &spectrumInfo = localworkspace->spectrumInfo();
-  // Loop over spectra
   for (const auto wsIndex : m_indices) {
     if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
       continue;
     numSpectra++;
+    spectra[0].push_back(wsIndex);
+  }
 
-    const auto &YValues = localworkspace->y(wsIndex);
-    const auto &YErrors = localworkspace->e(wsIndex);
-
-    if (m_calculateWeightedSum) {
-      // Retrieve the spectrum into a vector
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double yErrorsVal = YErrors[yIndex];
-        if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
-          const double errsq = yErrorsVal * yErrorsVal;
-          YErrorSum[yIndex] += errsq;
-          Weight[yIndex] += 1. / errsq;
-          YSum[yIndex] += YValues[yIndex] / errsq;
-        } else {
-          nZeros[yIndex]++;
+  SpectraSum total;
+  Kernel::reduceGroups(
+      spectra, 1000, Kernel::threadSafe(*localworkspace),
+      [this](size_t) { return SpectraSum(m_yLength, m_calculateWeightedSum); },
+      [&](SpectraSum &partial, size_t, const size_t *first,
+          const size_t *last) {
+        for (auto index = first; index != last; ++index) {
+          const size_t wsIndex = *index;
+          const auto &YValues = localworkspace->y(wsIndex);
+          const auto &YErrors = localworkspace->e(wsIndex);
+
+          if (m_calculateWeightedSum) {
+            // Retrieve the spectrum into a vector
+            for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
+              const double yErrorsVal = YErrors[yIndex];
+              if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
+                const double errsq = yErrorsVal * yErrorsVal;
+                partial.e[yIndex] += errsq;
+                partial.weight[yIndex] += 1. / errsq;
+                partial.y[yIndex] += YValues[yIndex] / errsq;
+              } else {
+                partial.nZeros[yIndex]++;
+              }
+            }
+          } else {
+            std::transform(partial.y.begin(), partial.y.end(),
+                           YValues.begin(), partial.y.begin(),
+                           std::plus<double>());
+            std::transform(partial.e.begin(), partial.e.end(),
+                           YErrors.begin(), partial.e.begin(),
+                           [](const double accum, const double yerrorSpec) {
+                             return accum + yerrorSpec * yerrorSpec;
+                           });
+          }
+
+          // Map all the detectors onto the spectrum of the output
+          const auto &detectorIDs =
+              localworkspace->getSpectrum(wsIndex).getDetectorIDs();
+          partial.detectorIDs.insert(detectorIDs.begin(), detectorIDs.end());
+
+          progress.report();
         }
-      }
-    } else {
-      YSum += YValues;
-      std::transform(YErrorSum.begin(), YErrorSum.end(), YErrors.begin(),
-                     YErrorSum.begin(),
-                     [](const double accum, const double yerrorSpec) {
-                       return accum + yerrorSpec * yerrorSpec;
-                     });
-    }
-
-    // Map all the detectors onto the spectrum of the output
-    outSpec.addDetectorIDs(
-        localworkspace->getSpectrum(wsIndex).getDetectorIDs());
-
-    progress.report();
+      },
+      [](SpectraSum &partial, SpectraSum &next) { partial += next; },
+      [&total](size_t, SpectraSum &sum) { std::swap(total, sum); });
+
+  if (m_distributed) {
+    // Add up the sums of all ranks on rank 0
+    const auto &comm = communicator();
+    sumOnRootRank(comm, total.y);
+    sumOnRootRank(comm, total.e);
+    sumOnRootRank(comm, total.weight);
+    sumOnRootRank(comm, total.nZeros);
+    gatherOnRootRank(comm, total.detectorIDs);
+    std::vector<size_t> counts{numSpectra, numMasked};
+    sumOnRootRank(comm, counts);
+    numSpectra = counts[0];
+    numMasked = counts[1];
   }
 
+  std::copy(total.y.cbegin(), total.y.cend(), YSum.begin());
+  std::copy(total.e.cbegin(), total.e.cend(), YErrorSum.begin());
+  outSpec.addDetectorIDs(total.detectorIDs);
+
   if (m_calculateWeightedSum) {
-    numZeros =
-        applyWeight(numSpectra, YSum, Weight, nZeros, m_multiplyByNumSpec);
+    numZeros = applyWeight(numSpectra, YSum, total.weight, total.nZeros,
+                           m_multiplyByNumSpec);
   } else {
     numZeros = 0;
   }
@@ -610,8 +704,10 @@ void SumSpectra::execEvent(MatrixWorkspace_sptr outputWorkspace,
   outputEL.setSpectrumNo(m_outSpecNum);
   outputEL.clearDetectorIDs();
 
+  // Select the spectra to sum first, they are then summed in parallel chunks
+  std::vector<std::vector<size_t>> spectra(1);
+  EventType eventType = TOF;
   const auto &spectrumInfo = inputWorkspace->spectrumInfo();
-  // Loop over spectra
   for (const auto i : m_indices) {
     if (spectrumInfo.hasDetectors(i)) {
       // Skip monitors, if the property is set to do so
@@ -625,16 +721,62 @@ void SumSpectra::execEvent(MatrixWorkspace_sptr outputWorkspace,
     }
     numSpectra++;
 
-    // Add the event lists with the operator
     const EventList &inputEL = inputWorkspace->getSpectrum(i);
     if (inputEL.empty()) {
       ++numZeros;
     }
-    outputEL += inputEL;
+    eventType = std::max(eventType, inputEL.getEventType());
+    spectra[0].push_back(i);
+  }
 
-    progress.report();
+  // Add the event lists with the operator. If they are all sorted by TOF the
+  // chunks are sorted and merged, so that the sum is sorted as well.
+  const bool sorted = inputWorkspace->getSortType() == TOF_SORT;
+  Kernel::reduceGroups(
+      spectra, 200, Kernel::threadSafe(*inputWorkspace),
+      [eventType](size_t) {
+        EventList partial;
+        partial.switchTo(eventType);
+        return partial;
+      },
+      [&](EventList &partial, size_t, const size_t *first,
+          const size_t *last) {
+        size_t numberOfEvents = 0;
+        for (auto i = first; i != last; ++i)
+          numberOfEvents += inputWorkspace->getSpectrum(*i).getNumberEvents();
+        partial.reserve(numberOfEvents);
+        for (auto i = first; i != last; ++i) {
+          partial += inputWorkspace->getSpectrum(*i);
+          progress.report();
+        }
+        if (sorted)
+          partial.sortTof();
+      },
+      [](EventList &partial, EventList &next) { partial.mergeSorted(next); },
+      [&outputEL](size_t, EventList &sum) {
+        outputEL.swapEvents(sum);
+        outputEL.addDetectorIDs(sum.getDetectorIDs());
+      });
+
+  if (m_distributed) {
+    // Append the events of all ranks on rank 0
+    gatherOnRootRank(communicator(), *outputEventWorkspace);
+    std::vector<size_t> counts{numSpectra, numMasked, numZeros};
+    sumOnRootRank(communicator(), counts);
+    numSpectra = counts[0];
+    numMasked = counts[1];
+    numZeros = counts[2];
   }
 }
 
+Parallel::ExecutionMode SumSpectra::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  // Distributed spectra are summed on each rank, the sums are then added up on
+  // rank 0
+  if (storageModes.at("InputWorkspace") == Parallel::StorageMode::Distributed)
+    return Parallel::ExecutionMode::Distributed;
+  return ParallelAlgorithm::getParallelExecutionMode(storageModes);
+}
+
 } // namespace Algorithms
 } // namespace Mantid
@@ -19,7 +19,7 @@ using namespace API;
 
 /// Initialisation method
 void UnGroupWorkspace::init() {
-  const AnalysisDataServiceImpl &data_store = AnalysisDataService::Instance();
+  AnalysisDataServiceImpl &data_store = AnalysisDataService::Instance();
   // Get the list of workspaces in the ADS
   auto workspaceList = data_store.getObjectNames();
   std::unordered_set<std::string> groupWorkspaceList;
@@ -0,0 +1,159 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTSTEST_H_
+#define MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTSTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/TableRow.h"
+#include "MantidAlgorithms/AlignAndFocusEvents.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidDataObjects/TableWorkspace.h"
+#include "MantidKernel/Unit.h"
+#include "MantidKernel/UnitFactory.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <cmath>
+
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using namespace Mantid::Kernel;
+using Mantid::Algorithms::AlignAndFocusEvents;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+const double DIFC = 1000.;
+
+/// Four spectra in TOF, spectrum i has one event at d = 1.5 + i
+EventWorkspace_sptr makeInput() {
+  auto ws = WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(
+      1, 2, true);
+  ws->getAxis(0)->unit() = UnitFactory::Instance().create("TOF");
+  for (size_t i = 0; i < ws->getNumberHistograms(); ++i)
+    ws->getSpectrum(i).addEventQuickly(
+        TofEvent(DIFC * (1.5 + static_cast<double>(i))));
+  return ws;
+}
+
+/// Spectra 0 and 1 in group 1, 2 and 3 in group 2
+GroupingWorkspace_sptr makeGrouping(const EventWorkspace &ws) {
+  auto grouping = boost::make_shared<GroupingWorkspace>(ws.getInstrument());
+  for (size_t i = 0; i < grouping->getNumberHistograms(); ++i)
+    grouping->mutableY(i)[0] = static_cast<double>(1 + i / 2);
+  return grouping;
+}
+
+ITableWorkspace_sptr makeCalibration(const EventWorkspace &ws) {
+  ITableWorkspace_sptr table = boost::make_shared<TableWorkspace>();
+  table->addColumn("int", "detid");
+  table->addColumn("double", "difc");
+  table->addColumn("double", "difa");
+  table->addColumn("double", "tzero");
+  for (size_t i = 0; i < ws.getNumberHistograms(); ++i) {
+    TableRow row = table->appendRow();
+    row << *ws.getSpectrum(i).getDetectorIDs().begin() << DIFC << 0. << 0.;
+  }
+  return table;
+}
+
+MatrixWorkspace_sptr focus(const EventWorkspace_sptr &ws,
+                           const GroupingWorkspace_sptr &grouping,
+                           const ITableWorkspace_sptr &calibration) {
+  AlignAndFocusEvents alg;
+  alg.setChild(true);
+  alg.initialize();
+  alg.setProperty("InputWorkspace", ws);
+  alg.setProperty("GroupingWorkspace", grouping);
+  alg.setProperty("CalibrationWorkspace", calibration);
+  alg.setPropertyValue("Params", "0,1,10");
+  alg.setPropertyValue("OutputWorkspace", "out");
+  alg.execute();
+  TS_ASSERT(alg.isExecuted());
+  return alg.getProperty("OutputWorkspace");
+}
+} // namespace
+
+class AlignAndFocusEventsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AlignAndFocusEventsTest *createSuite() {
+    return new AlignAndFocusEventsTest();
+  }
+  static void destroySuite(AlignAndFocusEventsTest *suite) { delete suite; }
+
+  void test_init() {
+    AlignAndFocusEvents alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_requires_a_calibration() {
+    auto ws = makeInput();
+    AlignAndFocusEvents alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", ws);
+    alg.setProperty("GroupingWorkspace", makeGrouping(*ws));
+    alg.setPropertyValue("Params", "0,1,10");
+    alg.setPropertyValue("OutputWorkspace", "out");
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &);
+  }
+
+  void test_events_are_focussed_into_their_groups() {
+    auto ws = makeInput();
+    auto out = focus(ws, makeGrouping(*ws), makeCalibration(*ws));
+    TS_ASSERT(!boost::dynamic_pointer_cast<EventWorkspace>(out));
+    TS_ASSERT_EQUALS(out->getAxis(0)->unit()->unitID(), "dSpacing");
+    TS_ASSERT_EQUALS(out->getNumberHistograms(), 2);
+    TS_ASSERT_EQUALS(out->x(0).size(), 11);
+    TS_ASSERT_EQUALS(out->getSpectrum(0).getSpectrumNo(), 1);
+    TS_ASSERT_EQUALS(out->getSpectrum(1).getSpectrumNo(), 2);
+    TS_ASSERT_EQUALS(out->getSpectrum(0).getDetectorIDs().size(), 2);
+    TS_ASSERT_EQUALS(out->getSpectrum(1).getDetectorIDs().size(), 2);
+    const std::vector<double> group1{0, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+    const std::vector<double> group2{0, 0, 0, 1, 1, 0, 0, 0, 0, 0};
+    TS_ASSERT_EQUALS(out->y(0).rawData(), group1);
+    TS_ASSERT_EQUALS(out->e(0).rawData(), group1);
+    TS_ASSERT_EQUALS(out->y(1).rawData(), group2);
+    // The input events are left in TOF
+    TS_ASSERT_EQUALS(ws->getSpectrum(0).getEvents()[0].tof(), 1.5 * DIFC);
+  }
+
+  void test_tzero_and_weights_are_applied() {
+    auto ws = makeInput();
+    auto &eventList = ws->getSpectrum(0);
+    eventList.switchTo(EventType::WEIGHTED);
+    eventList.addEventQuickly(WeightedEvent(1000. + 2. * DIFC, {}, 2., 9.));
+    auto calibration = makeCalibration(*ws);
+    calibration->cell<double>(0, 3) = 1000.;
+    auto out = focus(ws, makeGrouping(*ws), calibration);
+    TS_ASSERT_EQUALS(out->y(0)[0], 1.);
+    TS_ASSERT_EQUALS(out->y(0)[2], 3.);
+    TS_ASSERT_EQUALS(out->e(0)[2], std::sqrt(10.));
+  }
+
+  void test_spectra_without_group_or_calibration_are_left_out() {
+    auto ws = makeInput();
+    auto grouping = makeGrouping(*ws);
+    grouping->mutableY(1)[0] = 0.;
+    auto calibration = makeCalibration(*ws);
+    calibration->removeRow(2);
+    auto out = focus(ws, grouping, calibration);
+    TS_ASSERT_EQUALS(out->getNumberHistograms(), 2);
+    TS_ASSERT_EQUALS(out->getSpectrum(0).getDetectorIDs().size(), 1);
+    TS_ASSERT_EQUALS(out->getSpectrum(1).getDetectorIDs().size(), 1);
+    TS_ASSERT_EQUALS(out->y(0)[1], 1.);
+    TS_ASSERT_EQUALS(out->y(0)[2], 0.);
+    TS_ASSERT_EQUALS(out->y(1)[3], 0.);
+    TS_ASSERT_EQUALS(out->y(1)[4], 1.);
+  }
+};
+
+#endif /* MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTSTEST_H_ */
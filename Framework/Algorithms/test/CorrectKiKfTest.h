@@ -189,6 +189,18 @@ public:
     TS_ASSERT_LESS_THAN(
         out_ws->getNumberEvents(),
         in_ws->getNumberEvents()); // Check that events with Ef<0 are dropped
+    // The events that are kept are all those with Ef>0, in the same order
+    const auto &inEvents = in_ws->getSpectrum(0).getEvents();
+    const auto &outEvents = out_ws->getSpectrum(0).getWeightedEvents();
+    std::vector<double> expectedTofs, tofs;
+    for (const auto &event : inEvents) {
+      if (event.tof() < 3.)
+        expectedTofs.push_back(event.tof());
+    }
+    for (const auto &event : outEvents) {
+      tofs.push_back(event.tof());
+    }
+    TS_ASSERT_EQUALS(tofs, expectedTofs);
 
     AnalysisDataService::Instance().remove(outputEvWSname);
     AnalysisDataService::Instance().remove(inputEvWSname);
@@ -9,6 +9,7 @@
 
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/SpectraAxis.h"
+#include "MantidAPI/SpectrumInfo.h"
 #include "MantidAlgorithms/AlignDetectors.h"
 #include "MantidAlgorithms/DiffractionFocussing2.h"
 #include "MantidAlgorithms/MaskBins.h"
@@ -16,10 +17,16 @@
 #include "MantidDataHandling/LoadNexus.h"
 #include "MantidDataHandling/LoadRaw3.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidHistogramData/LinearGenerator.h"
+#include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/cow_ptr.h"
+#include "MantidTestHelpers/ParallelAlgorithmCreation.h"
+#include "MantidTestHelpers/ParallelRunner.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
+#include "MantidTypes/SpectrumDefinition.h"
 #include <cxxtest/TestSuite.h>
 
 using namespace Mantid;
@@ -31,6 +38,86 @@ using namespace Mantid::DataObjects;
 using Mantid::HistogramData::BinEdges;
 using Mantid::Types::Event::TofEvent;
 
+namespace {
+/// A copy of an event workspace with its spectra distributed over the ranks
+EventWorkspace_sptr distribute(const Parallel::Communicator &comm,
+                               const EventWorkspace &ws) {
+  const auto &spectrumNumbers = ws.indexInfo().spectrumNumbers();
+  Indexing::IndexInfo indexInfo(spectrumNumbers,
+                                Parallel::StorageMode::Distributed, comm);
+  std::vector<size_t> globalIndices;
+  std::vector<SpectrumDefinition> definitions;
+  for (size_t i = 0; i < indexInfo.size(); ++i) {
+    const auto global =
+        std::find(spectrumNumbers.begin(), spectrumNumbers.end(),
+                  indexInfo.spectrumNumber(i));
+    globalIndices.push_back(
+        static_cast<size_t>(global - spectrumNumbers.begin()));
+    definitions.push_back(
+        ws.spectrumInfo().spectrumDefinition(globalIndices.back()));
+  }
+  indexInfo.setSpectrumDefinitions(definitions);
+  EventWorkspace_sptr distributed =
+      create<EventWorkspace>(ws, indexInfo, ws.binEdges(0));
+  for (size_t i = 0; i < globalIndices.size(); ++i) {
+    distributed->setBinEdges(i, ws.binEdges(globalIndices[i]));
+    distributed->getSpectrum(i) += ws.getSpectrum(globalIndices[i]);
+  }
+  return distributed;
+}
+
+void run_focus_distributed(const Parallel::Communicator &comm,
+                           const bool preserveEvents) {
+  EventWorkspace_sptr ws =
+      WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(2, 4);
+  ws->getAxis(0)->unit() = UnitFactory::Instance().create("dSpacing");
+  for (size_t pix = 0; pix < ws->getNumberHistograms(); pix++) {
+    double x = static_cast<double>(1 + pix);
+    ws->setHistogram(pix, BinEdges{x + 0, x + 1, x + 2, x + 3, 1e6});
+  }
+  auto grouping = boost::make_shared<GroupingWorkspace>(ws->getInstrument());
+  for (size_t i = 0; i < grouping->getNumberHistograms(); ++i)
+    grouping->mutableY(i)[0] = static_cast<double>(1 + i % 3);
+
+  auto focus = ParallelTestHelpers::create<DiffractionFocussing2>(comm);
+  focus->setProperty("InputWorkspace", distribute(comm, *ws));
+  focus->setProperty("GroupingWorkspace", grouping);
+  focus->setProperty("PreserveEvents", preserveEvents);
+  TS_ASSERT_THROWS_NOTHING(focus->execute());
+  MatrixWorkspace_const_sptr out = focus->getProperty("OutputWorkspace");
+  if (comm.rank() != 0)
+    return;
+  TS_ASSERT_EQUALS(out->storageMode(), Parallel::StorageMode::MasterOnly);
+
+  DiffractionFocussing2 serial;
+  serial.setChild(true);
+  serial.initialize();
+  serial.setProperty("InputWorkspace", ws);
+  serial.setProperty("GroupingWorkspace", grouping);
+  serial.setProperty("PreserveEvents", preserveEvents);
+  serial.setPropertyValue("OutputWorkspace", "unused");
+  serial.execute();
+  MatrixWorkspace_const_sptr expected = serial.getProperty("OutputWorkspace");
+
+  TS_ASSERT_EQUALS(out->id(), expected->id());
+  TS_ASSERT_EQUALS(out->getNumberHistograms(), 3);
+  TS_ASSERT_EQUALS(out->getNumberHistograms(),
+                   expected->getNumberHistograms());
+  for (size_t i = 0; i < expected->getNumberHistograms(); ++i) {
+    TS_ASSERT_EQUALS(out->getSpectrum(i).getSpectrumNo(),
+                     expected->getSpectrum(i).getSpectrumNo());
+    TS_ASSERT_EQUALS(out->getSpectrum(i).getDetectorIDs(),
+                     expected->getSpectrum(i).getDetectorIDs());
+    TS_ASSERT_EQUALS(out->x(i).rawData(), expected->x(i).rawData());
+    const auto &y = out->y(i);
+    const auto &yExpected = expected->y(i);
+    TS_ASSERT_EQUALS(y.size(), yExpected.size());
+    for (size_t j = 0; j < std::min(y.size(), yExpected.size()); ++j)
+      TS_ASSERT_DELTA(y[j], yExpected[j], 1e-9 * (1. + yExpected[j]));
+  }
+}
+} // namespace
+
 class DiffractionFocussing2Test : public CxxTest::TestSuite {
 public:
   void testName() { TS_ASSERT_EQUALS(focus.name(), "DiffractionFocussing"); }
@@ -244,6 +331,14 @@ public:
     }
   }
 
+  void test_distributed_events() {
+    ParallelTestHelpers::runParallel(run_focus_distributed, true);
+  }
+
+  void test_distributed_histograms() {
+    ParallelTestHelpers::runParallel(run_focus_distributed, false);
+  }
+
 private:
   DiffractionFocussing2 focus;
 };
@@ -0,0 +1,135 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_ALGORITHMS_EVALUATEWORKSPACEEXPRESSIONTEST_H_
+#define MANTID_ALGORITHMS_EVALUATEWORKSPACEEXPRESSIONTEST_H_
+
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
+#include "MantidAlgorithms/EvaluateWorkspaceExpression.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using Mantid::Algorithms::EvaluateWorkspaceExpression;
+
+class EvaluateWorkspaceExpressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EvaluateWorkspaceExpressionTest *createSuite() {
+    return new EvaluateWorkspaceExpressionTest();
+  }
+  static void destroySuite(EvaluateWorkspaceExpressionTest *suite) {
+    delete suite;
+  }
+
+  EvaluateWorkspaceExpressionTest() {
+    FrameworkManager::Instance();
+    // Different values in every bin
+    auto &ads = AnalysisDataService::Instance();
+    for (const std::string name : {"sample", "background", "vanadium"}) {
+      auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(5, 20);
+      const double offset = static_cast<double>(name.size());
+      for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+        auto &y = ws->mutableY(i);
+        auto &e = ws->mutableE(i);
+        for (size_t j = 0; j < y.size(); ++j) {
+          y[j] = offset + static_cast<double>((i + j) % 7);
+          e[j] = 0.5 * offset + static_cast<double>(j % 3);
+        }
+      }
+      ads.addOrReplace(name, ws);
+    }
+  }
+
+  ~EvaluateWorkspaceExpressionTest() override {
+    AnalysisDataService::Instance().clear();
+  }
+
+  void test_Init() {
+    EvaluateWorkspaceExpression alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_matches_the_binary_operations() {
+    auto result =
+        run("(sample - background) / vanadium * 2 + -sample", "result");
+    TS_ASSERT(result);
+    if (!result)
+      return;
+
+    // The same expression, one operation at a time
+    auto &ads = AnalysisDataService::Instance();
+    auto sample = ads.retrieveWS<MatrixWorkspace>("sample");
+    auto background = ads.retrieveWS<MatrixWorkspace>("background");
+    auto vanadium = ads.retrieveWS<MatrixWorkspace>("vanadium");
+    auto expected = (sample - background) / vanadium * 2. - sample;
+
+    for (size_t i = 0; i < expected->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(result->x(i).rawData(), expected->x(i).rawData());
+      for (size_t j = 0; j < expected->blocksize(); ++j) {
+        TS_ASSERT_DELTA(result->y(i)[j], expected->y(i)[j], 1e-10);
+        TS_ASSERT_DELTA(result->e(i)[j], expected->e(i)[j], 1e-10);
+      }
+    }
+    // The inputs are left untouched
+    TS_ASSERT_DELTA(sample->y(0)[1], 7., 1e-12);
+  }
+
+  void test_in_place() {
+    auto &ads = AnalysisDataService::Instance();
+    auto vanadium = ads.retrieveWS<MatrixWorkspace>("vanadium")->clone();
+    ads.addOrReplace("inplace", MatrixWorkspace_sptr(std::move(vanadium)));
+    auto before = ads.retrieveWS<MatrixWorkspace>("inplace");
+    const double y = before->y(2)[3];
+    const double e = before->e(2)[3];
+
+    auto result = run("inplace * 3", "inplace",
+                      {"sample", "background", "vanadium", "inplace"});
+    TS_ASSERT_EQUALS(result, before);
+    TS_ASSERT_DELTA(result->y(2)[3], 3. * y, 1e-12);
+    TS_ASSERT_DELTA(result->e(2)[3], 3. * e, 1e-12);
+    ads.remove("inplace");
+  }
+
+  void test_inputs_must_have_the_same_bins() {
+    auto &ads = AnalysisDataService::Instance();
+    ads.addOrReplace(
+        "shifted", WorkspaceCreationHelper::create2DWorkspaceBinned(5, 20, 1.));
+    EvaluateWorkspaceExpression alg;
+    alg.setRethrows(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspaces",
+                    std::vector<std::string>{"sample", "shifted"});
+    alg.setPropertyValue("Expression", "sample + shifted");
+    alg.setPropertyValue("OutputWorkspace", "result");
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &);
+    ads.remove("shifted");
+  }
+
+private:
+  MatrixWorkspace_sptr run(const std::string &expression,
+                           const std::string &outName,
+                           const std::vector<std::string> &names = {
+                               "sample", "background", "vanadium"}) {
+    EvaluateWorkspaceExpression alg;
+    alg.setRethrows(true);
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("InputWorkspaces", names));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Expression", expression));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", outName));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+    return AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+        outName);
+  }
+};
+
+#endif /* MANTID_ALGORITHMS_EVALUATEWORKSPACEEXPRESSIONTEST_H_ */
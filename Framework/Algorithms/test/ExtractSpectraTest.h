@@ -127,6 +127,19 @@ public:
     params.testXRange(*ws);
   }
 
+  void test_x_range_shares_cropped_x() {
+    Parameters params;
+    params.setXRange();
+
+    auto ws = runAlgorithm(params);
+    if (!ws)
+      return;
+
+    TS_ASSERT_EQUALS(ws->x(0).size(), 2);
+    for (size_t i = 1; i < ws->getNumberHistograms(); ++i)
+      TS_ASSERT_EQUALS(ws->sharedX(i), ws->sharedX(0));
+  }
+
   void test_index_range() {
     Parameters params;
     params.setIndexRange();
@@ -12,6 +12,7 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/TableRow.h"
 #include "MantidAlgorithms/FilterEvents.h"
+#include "MantidDataHandling/LoadNexusProcessed.h"
 #include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Events.h"
@@ -22,6 +23,9 @@
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
 #include <random>
 
 using namespace Mantid;
@@ -1262,6 +1266,78 @@ public:
     return;
   }
 
+  /** test saving the output workspaces to files, a few at a time, instead of
+   * keeping them in memory
+   */
+  void test_outputDirectory() {
+    int64_t runstart_i64 = 20000000000;
+    int64_t pulsedt = 100 * 1000 * 1000;
+    int64_t tofdt = 10 * 1000 * 1000;
+    size_t numpulses = 5;
+
+    EventWorkspace_sptr inpWS =
+        createEventWorkspace(runstart_i64, pulsedt, tofdt, numpulses);
+    AnalysisDataService::Instance().addOrReplace("TestFiles", inpWS);
+    SplittersWorkspace_sptr splws =
+        createSplittersWorkspace(runstart_i64, pulsedt, tofdt);
+    AnalysisDataService::Instance().addOrReplace("SplitterFiles", splws);
+
+    FilterEvents filter;
+    filter.initialize();
+    filter.setProperty("InputWorkspace", "TestFiles");
+    filter.setProperty("OutputWorkspaceBaseName", "FilteredFiles");
+    filter.setProperty("SplitterWorkspace", "SplitterFiles");
+    filter.setProperty("OutputDirectory", Poco::Path::temp());
+    filter.setProperty("MaxOutputWorkspacesInMemory", 2);
+
+    TS_ASSERT_THROWS_NOTHING(filter.execute());
+    TS_ASSERT(filter.isExecuted());
+
+    int numsplittedws = filter.getProperty("NumberOutputWS");
+    TS_ASSERT_EQUALS(numsplittedws, 4);
+    std::vector<std::string> filenames = filter.getProperty("OutputFilenames");
+    TS_ASSERT_EQUALS(filenames.size(), 4);
+    TS_ASSERT(!AnalysisDataService::Instance().doesExist("FilteredFiles_0"));
+
+    // The workspaces saved hold the same events as when kept in memory
+    Mantid::DataHandling::LoadNexusProcessed loader;
+    loader.initialize();
+    loader.setPropertyValue(
+        "Filename", Poco::Path(Poco::Path::temp(), "FilteredFiles_0.nxs")
+                        .toString());
+    loader.setPropertyValue("OutputWorkspace", "FilteredFiles_0_loaded");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+    auto filteredws0 =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            "FilteredFiles_0_loaded");
+    TS_ASSERT(filteredws0);
+    if (filteredws0) {
+      TS_ASSERT_EQUALS(filteredws0->getSpectrum(0).getNumberEvents(), 4);
+      TS_ASSERT_EQUALS(filteredws0->run().getProtonCharge(), 2);
+      TS_ASSERT(filteredws0->run().hasProperty("splitter"));
+    }
+
+    for (const auto &filename : filenames)
+      Poco::File(filename).remove();
+    AnalysisDataService::Instance().remove("TestFiles");
+    AnalysisDataService::Instance().remove("SplitterFiles");
+    AnalysisDataService::Instance().remove("FilteredFiles_0_loaded");
+  }
+
+  void test_outputDirectory_requires_SplittersWorkspace() {
+    EventWorkspace_sptr inpWS =
+        createEventWorkspace(20000000000, 100 * 1000 * 1000, 10 * 1000 * 1000,
+                             5);
+    FilterEvents filter;
+    filter.initialize();
+    filter.setProperty("InputWorkspace", inpWS);
+    filter.setProperty("SplitterWorkspace",
+                       createTableSplitters(0, 100 * 1000 * 1000,
+                                            10 * 1000 * 1000));
+    filter.setProperty("OutputDirectory", Poco::Path::temp());
+    TS_ASSERT_EQUALS(filter.validateInputs().count("OutputDirectory"), 1);
+  }
+
   //----------------------------------------------------------------------------------------------
   /** Create an EventWorkspace.  This workspace has
    * @param runstart_i64 : absolute run start time in int64_t format with unit
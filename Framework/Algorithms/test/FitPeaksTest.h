@@ -242,6 +242,62 @@ public:
     AnalysisDataService::Instance().remove("PeakParametersWS");
   }
 
+  //----------------------------------------------------------------------------------------------
+  /** Test that starting from the fits of the previous spectrum finds the same
+   * peaks
+   */
+  void test_multiPeaksMultiSpectraStartingFromNeighbours() {
+    std::vector<string> peakparnames;
+    std::vector<double> peakparvalues;
+    createGuassParameters(peakparnames, peakparvalues);
+    createTestData(m_inputWorkspaceName);
+
+    FitPeaks fitpeaks;
+    fitpeaks.initialize();
+    TS_ASSERT_THROWS_NOTHING(
+        fitpeaks.setProperty("InputWorkspace", m_inputWorkspaceName));
+    TS_ASSERT_THROWS_NOTHING(fitpeaks.setProperty("PeakCenters", "5.0, 10.0"));
+    TS_ASSERT_THROWS_NOTHING(
+        fitpeaks.setProperty("FitWindowBoundaryList", "2.5, 6.5, 8.0, 12.0"));
+    TS_ASSERT_THROWS_NOTHING(
+        fitpeaks.setProperty("PeakParameterNames", peakparnames));
+    TS_ASSERT_THROWS_NOTHING(
+        fitpeaks.setProperty("PeakParameterValues", peakparvalues));
+    TS_ASSERT_THROWS_NOTHING(fitpeaks.setProperty("HighBackground", false));
+    TS_ASSERT_THROWS_NOTHING(
+        fitpeaks.setProperty("StartFromNeighbourFits", true));
+    fitpeaks.setProperty("OutputWorkspace", "PeakPositionsWS");
+    fitpeaks.setProperty("OutputPeakParametersWorkspace", "PeakParametersWS");
+
+    fitpeaks.execute();
+    TS_ASSERT(fitpeaks.isExecuted());
+    if (!fitpeaks.isExecuted())
+      return;
+
+    auto main_out_ws =
+        AnalysisDataService::Instance().retrieveWS<API::MatrixWorkspace>(
+            "PeakPositionsWS");
+    TS_ASSERT_EQUALS(main_out_ws->getNumberHistograms(), 3);
+    const auto &fitted_positions_0 = main_out_ws->histogram(0).y();
+    TS_ASSERT_DELTA(fitted_positions_0[0], 5.0, 1.E-6);
+    TS_ASSERT_DELTA(fitted_positions_0[1], 10.0, 1.E-6);
+    const auto &fitted_positions_2 = main_out_ws->histogram(2).y();
+    TS_ASSERT_DELTA(fitted_positions_2[0], 5.03, 1.E-6);
+    TS_ASSERT_DELTA(fitted_positions_2[1], 10.02, 1.E-6);
+
+    auto param_ws =
+        AnalysisDataService::Instance().retrieveWS<API::ITableWorkspace>(
+            "PeakParametersWS");
+    TS_ASSERT_DELTA(param_ws->cell<double>(2, 2), 4., 1E-6);
+    TS_ASSERT_DELTA(param_ws->cell<double>(2, 4), 0.17, 1E-6);
+    TS_ASSERT_DELTA(param_ws->cell<double>(3, 2), 2., 1E-6);
+    TS_ASSERT_DELTA(param_ws->cell<double>(3, 4), 0.12, 1E-6);
+
+    AnalysisDataService::Instance().remove(m_inputWorkspaceName);
+    AnalysisDataService::Instance().remove("PeakPositionsWS");
+    AnalysisDataService::Instance().remove("PeakParametersWS");
+  }
+
   //----------------------------------------------------------------------------------------------
   /** Test output of effective peak parameters
    * @brief test_effectivePeakParameters
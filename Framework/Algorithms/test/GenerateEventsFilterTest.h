@@ -1214,6 +1214,40 @@ public:
     alg.isExecuted();
   }
 
+  void testPerformanceManyLogValueRanges() {
+    // A double log with a million entries, split into 1000 value ranges
+    auto largeLog = new TimeSeriesProperty<double>("LargeDoubleLog");
+    const int64_t logstart_ns = 10000000000;
+    const int numentries = 1000000;
+    std::vector<Types::Core::DateAndTime> times(numentries);
+    std::vector<double> values(numentries);
+    for (int i = 0; i < numentries; ++i) {
+      times[i] = Types::Core::DateAndTime(logstart_ns + 10000 * int64_t(i));
+      values[i] = sin(static_cast<double>(i) * 1.0E-4) * 100.;
+    }
+    largeLog->addValues(times, values);
+    inputEvent->mutableRun().addProperty(largeLog, true);
+
+    GenerateEventsFilter alg;
+    alg.initialize();
+
+    alg.setProperty("InputWorkspace", inputEvent);
+    alg.setProperty("OutputWorkspace", "output");
+    alg.setProperty("InformationWorkspace", "infoOutput");
+    alg.setProperty("FastLog", true);
+
+    alg.setProperty("LogName", "LargeDoubleLog");
+    alg.setProperty("MinimumLogValue", -100.);
+    alg.setProperty("MaximumLogValue", 100.);
+    alg.setProperty("LogValueInterval", 0.2);
+
+    alg.setProperty("FilterLogValueByChangingDirection", "Both");
+    alg.setProperty("LogBoundary", "Centre");
+
+    alg.execute();
+    alg.isExecuted();
+  }
+
 private:
   Mantid::DataObjects::EventWorkspace_sptr inputEvent;
 };
@@ -63,6 +63,40 @@ public:
     TS_ASSERT_DELTA(1.0 / std::sqrt(nevents), error, 1e-08);
   }
 
+  void test_Simulation_Over_Several_Batches_Averages_All_Events() {
+    using Mantid::Kernel::V3D;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    MockBeamProfile testBeamProfile;
+    EXPECT_CALL(testBeamProfile, defineActiveRegion(_))
+        .WillOnce(Return(testSampleSphere.getShape().getBoundingBox()));
+    // More events than are evaluated in one batch
+    const size_t nevents(2500), maxTries(100);
+    MCAbsorptionStrategy mcabsorb(testBeamProfile, testSampleSphere, nevents,
+                                  maxTries);
+    MockRNG rng;
+    EXPECT_CALL(rng, nextValue())
+        .Times(Exactly(static_cast<int>(3 * nevents)))
+        .WillRepeatedly(Return(0.5));
+    const Mantid::Algorithms::IBeamProfile::Ray testRay = {V3D(-2, 0, 0),
+                                                           V3D(1, 0, 0)};
+    EXPECT_CALL(testBeamProfile, generatePoint(_, _))
+        .Times(Exactly(static_cast<int>(nevents)))
+        .WillRepeatedly(Return(testRay));
+    const V3D endPos(0.7, 0.7, 1.4);
+    const double lambdaBefore(2.5), lambdaAfter(3.5);
+
+    double factor(0.0), error(0.0);
+    std::tie(factor, error) =
+        mcabsorb.calculate(rng, endPos, lambdaBefore, lambdaAfter);
+    // Every event is the same so the average is the factor of one of them
+    TS_ASSERT_DELTA(0.0043828472, factor, 1e-08);
+    TS_ASSERT_DELTA(1.0 / std::sqrt(nevents), error, 1e-08);
+  }
+
   //----------------------------------------------------------------------------
   // Failure cases
   //----------------------------------------------------------------------------
@@ -10,6 +10,8 @@
 #include <cxxtest/TestSuite.h>
 
 #include "MantidAlgorithms/SampleCorrections/MCInteractionVolume.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/Material.h"
 #include "MantidKernel/MersenneTwister.h"
 #include "MonteCarloTesting.h"
 
@@ -60,6 +62,36 @@ public:
     TS_ASSERT_DELTA(0.0028357258, factor, 1e-8);
   }
 
+  void test_Tracks_Before_And_After_Scatter_Start_At_Scatter_Point() {
+    using Mantid::Geometry::Track;
+    using Mantid::Kernel::V3D;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    const V3D startPos(-2.0, 0.0, 0.0), endPos(0.7, 0.7, 1.4);
+    const double lambdaBefore(2.5), lambdaAfter(3.5);
+    MockRNG rng;
+    EXPECT_CALL(rng, nextValue())
+        .Times(Exactly(3))
+        .WillRepeatedly(Return(0.25));
+
+    auto sample = createTestSample(TestSampleType::SolidSphere);
+    MCInteractionVolume interactor(sample, sample.getShape().getBoundingBox());
+    Track beforeScatter, afterScatter;
+    TS_ASSERT(interactor.calculateBeforeAfterTrack(
+        rng, startPos, endPos, beforeScatter, afterScatter));
+    TS_ASSERT_EQUALS(beforeScatter.startPoint(), afterScatter.startPoint());
+    TS_ASSERT_EQUALS(1, beforeScatter.count());
+    TS_ASSERT_EQUALS(1, afterScatter.count());
+    const auto &material = sample.getShape().material();
+    const double factor =
+        material.attenuation(beforeScatter.front().distInsideObject,
+                             lambdaBefore) *
+        material.attenuation(afterScatter.front().distInsideObject,
+                             lambdaAfter);
+    TS_ASSERT_DELTA(0.0028357258, factor, 1e-8);
+  }
+
   void test_Absorption_In_Sample_With_Hole_Container_Scatter_In_All_Segments() {
     using Mantid::Kernel::V3D;
     using namespace MonteCarloTesting;
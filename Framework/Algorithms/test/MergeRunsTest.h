@@ -581,6 +581,36 @@ public:
     EventTeardown();
   }
 
+  //-----------------------------------------------------------------------------------------------
+  void testExec_Events_SortedInputsGiveSortedOutput() {
+    EventSetup();
+    ev1->sortAll(TOF_SORT, nullptr);
+    AnalysisDataService::Instance().retrieveWS<EventWorkspace>("ev2")->sortAll(
+        TOF_SORT, nullptr);
+    MergeRuns mrg;
+    mrg.initialize();
+    mrg.setPropertyValue("InputWorkspaces", "ev1,ev2");
+    mrg.setPropertyValue("OutputWorkspace", "outWS");
+    mrg.execute();
+    TS_ASSERT(mrg.isExecuted());
+
+    EventWorkspace_const_sptr output =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>("outWS");
+    TS_ASSERT(output);
+    TS_ASSERT_EQUALS(output->getNumberEvents(), 900);
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 3);
+    for (size_t i = 0; i < output->getNumberHistograms(); ++i) {
+      const auto &spectrum = output->getSpectrum(i);
+      TS_ASSERT_EQUALS(spectrum.getSortType(), TOF_SORT);
+      const auto tofs = spectrum.getTofs();
+      TS_ASSERT(std::is_sorted(tofs.begin(), tofs.end()));
+      TS_ASSERT_EQUALS(spectrum.getDetectorIDs(),
+                       ev1->getSpectrum(i).getDetectorIDs());
+    }
+
+    EventTeardown();
+  }
+
   //-----------------------------------------------------------------------------------------------
   void testExec_Events_MatchingPixelIDs_WithWorkspaceGroup() {
     EventSetup();
@@ -8,6 +8,7 @@
 #define Q1D2Test_H_
 
 #include "MantidAPI/Axis.h"
+#include "MantidAPI/WorkspaceGroup.h"
 #include "MantidAlgorithms/ConvertUnits.h"
 #include "MantidAlgorithms/CropWorkspace.h"
 #include "MantidAlgorithms/Q1D2.h"
@@ -496,6 +497,68 @@ public:
     Mantid::API::AnalysisDataService::Instance().remove(outputWS);
   }
 
+  void testSlicesAreReducedWithTheNormalisationOfTheWholeWorkspace() {
+    auto half = m_inputWS->clone();
+    for (size_t i = 0; i < half->getNumberHistograms(); ++i) {
+      half->mutableY(i) *= 0.5;
+      half->mutableE(i) *= 0.5;
+    }
+    auto slices = boost::make_shared<Mantid::API::WorkspaceGroup>();
+    slices->addWorkspace(m_inputWS->clone());
+    slices->addWorkspace(std::move(half));
+
+    Mantid::Algorithms::Q1D2 Q1D;
+    Q1D.setChild(true);
+    Q1D.initialize();
+    Q1D.setProperty("DetBankWorkspace", m_inputWS);
+    Q1D.setProperty("WavelengthAdj", m_wavNorm);
+    Q1D.setProperty("PixelAdj", m_pixel);
+    Q1D.setProperty("SliceWorkspaces", slices);
+    Q1D.setPropertyValue("OutputWorkspace", "Q1D2Test_result");
+    Q1D.setPropertyValue("OutputSliceWorkspaces", "Q1D2Test_slices");
+    Q1D.setPropertyValue("OutputBinning", "0.1,-0.02,0.5");
+    TS_ASSERT_THROWS_NOTHING(Q1D.execute());
+    TS_ASSERT(Q1D.isExecuted())
+
+    Mantid::API::MatrixWorkspace_sptr result =
+        Q1D.getProperty("OutputWorkspace");
+    Mantid::API::WorkspaceGroup_sptr results =
+        Q1D.getProperty("OutputSliceWorkspaces");
+    TS_ASSERT_EQUALS(results->size(), 2)
+    auto whole = boost::dynamic_pointer_cast<Mantid::API::MatrixWorkspace>(
+        results->getItem(0));
+    auto halved = boost::dynamic_pointer_cast<Mantid::API::MatrixWorkspace>(
+        results->getItem(1));
+    TS_ASSERT_EQUALS(whole->x(0).rawData(), result->x(0).rawData())
+    for (size_t bin = 0; bin < result->y(0).size(); ++bin) {
+      if (std::isnan(result->y(0)[bin])) {
+        TS_ASSERT(std::isnan(whole->y(0)[bin]))
+        continue;
+      }
+      TS_ASSERT_DELTA(whole->y(0)[bin], result->y(0)[bin],
+                      1e-9 * std::abs(result->y(0)[bin]))
+      TS_ASSERT_DELTA(whole->e(0)[bin], result->e(0)[bin],
+                      1e-9 * std::abs(result->e(0)[bin]))
+      TS_ASSERT_DELTA(halved->y(0)[bin], 0.5 * result->y(0)[bin],
+                      1e-9 * std::abs(result->y(0)[bin]))
+    }
+  }
+
+  void testSlicesMustMatchTheDetBankWorkspace() {
+    auto slices = boost::make_shared<Mantid::API::WorkspaceGroup>();
+    slices->addWorkspace(
+        WorkspaceCreationHelper::create2DWorkspace(1, 10));
+
+    Mantid::Algorithms::Q1D2 Q1D;
+    Q1D.setChild(true);
+    Q1D.initialize();
+    Q1D.setProperty("DetBankWorkspace", m_inputWS);
+    Q1D.setProperty("SliceWorkspaces", slices);
+    Q1D.setPropertyValue("OutputWorkspace", "Q1D2Test_result");
+    Q1D.setPropertyValue("OutputBinning", "0.1,-0.02,0.5");
+    TS_ASSERT_THROWS(Q1D.execute(), const std::invalid_argument &)
+  }
+
   /// stop the constructor from being run every time algorithms test suite is
   /// initialised
   static Q1D2Test *createSuite() { return new Q1D2Test(); }
@@ -0,0 +1,146 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_ALGORITHMS_REFLECTOMETRYBATCHREDUCTIONTEST_H_
+#define MANTID_ALGORITHMS_REFLECTOMETRYBATCHREDUCTIONTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAlgorithms/ReflectometryBatchReduction.h"
+
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Run.h"
+#include "MantidKernel/Unit.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <algorithm>
+
+using namespace Mantid::Algorithms;
+using namespace Mantid::API;
+
+namespace {
+void addRun(const std::string &name, const std::string &runNumber) {
+  MatrixWorkspace_sptr ws = WorkspaceCreationHelper::
+      create2DWorkspaceWithReflectometryInstrumentMultiDetector();
+  if (!runNumber.empty())
+    ws->mutableRun().addProperty<std::string>("run_number", runNumber);
+  AnalysisDataService::Instance().addOrReplace(name, ws);
+}
+
+void setDefaults(ReflectometryBatchReduction &alg) {
+  alg.setChild(true);
+  alg.initialize();
+  alg.setPropertyValue("InputWorkspaces", "run1,run2");
+  alg.setPropertyValue("ThetaIn", "10,10");
+  alg.setProperty("WavelengthMin", 1.5);
+  alg.setProperty("WavelengthMax", 15.0);
+  alg.setProperty("ProcessingInstructions", "2");
+  alg.setProperty("MomentumTransferStep", 0.04);
+  alg.setPropertyValue("OutputWorkspace", "stitched");
+}
+} // namespace
+
+class ReflectometryBatchReductionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ReflectometryBatchReductionTest *createSuite() {
+    return new ReflectometryBatchReductionTest();
+  }
+  static void destroySuite(ReflectometryBatchReductionTest *suite) {
+    delete suite;
+  }
+
+  ReflectometryBatchReductionTest() { FrameworkManager::Instance(); }
+
+  void setUp() override {
+    addRun("run1", "1");
+    addRun("run2", "2");
+  }
+
+  void tearDown() override { AnalysisDataService::Instance().clear(); }
+
+  void test_init() {
+    ReflectometryBatchReduction alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize());
+    TS_ASSERT(alg.isInitialized());
+    TS_ASSERT(alg.existsProperty("ProcessingInstructions"));
+    TS_ASSERT(!alg.existsProperty("MomentumTransferMin"));
+  }
+
+  void test_theta_is_needed_for_each_run() {
+    ReflectometryBatchReduction alg;
+    setDefaults(alg);
+    alg.setPropertyValue("ThetaIn", "10");
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &);
+  }
+
+  void test_runs_are_reduced_and_stitched() {
+    ReflectometryBatchReduction alg;
+    setDefaults(alg);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    Workspace_sptr stitched = alg.getProperty("OutputWorkspace");
+    auto stitchedMatrix =
+        boost::dynamic_pointer_cast<MatrixWorkspace>(stitched);
+    TS_ASSERT(stitchedMatrix);
+    TS_ASSERT_EQUALS(stitchedMatrix->getNumberHistograms(), 1);
+    TS_ASSERT_EQUALS(stitchedMatrix->getAxis(0)->unit()->unitID(),
+                     "MomentumTransfer");
+    auto &ads = AnalysisDataService::Instance();
+    TS_ASSERT(ads.doesExist("IvsQ_binned_1"));
+    TS_ASSERT(ads.doesExist("IvsQ_binned_2"));
+  }
+
+  void test_runs_without_run_numbers_are_named_after_their_workspace() {
+    addRun("run1", "");
+    addRun("run2", "");
+    ReflectometryBatchReduction alg;
+    setDefaults(alg);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    auto &ads = AnalysisDataService::Instance();
+    for (const auto &name : {"run1", "run2"}) {
+      TS_ASSERT(ads.doesExist(std::string("IvsQ_binned_") + name));
+      TS_ASSERT(ads.doesExist(std::string("IvsQ_") + name));
+      TS_ASSERT(ads.doesExist(std::string("IvsLam_") + name));
+    }
+    TS_ASSERT(!ads.doesExist("IvsQ_binned"));
+  }
+
+  void test_runs_with_the_same_run_number_have_different_outputs() {
+    addRun("run2", "1");
+    ReflectometryBatchReduction alg;
+    setDefaults(alg);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    auto &ads = AnalysisDataService::Instance();
+    TS_ASSERT(ads.doesExist("IvsQ_binned_1"));
+    TS_ASSERT(ads.doesExist("IvsQ_binned_run2"));
+  }
+
+  void test_transmission_runs_are_converted_once_per_run_number() {
+    addRun("trans", "3");
+    addRun("transCopy", "3");
+    ReflectometryBatchReduction alg;
+    setDefaults(alg);
+    alg.setPropertyValue("FirstTransmissionRuns", "trans,transCopy");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    auto &ads = AnalysisDataService::Instance();
+    TS_ASSERT(ads.doesExist("TRANS_LAM_3"));
+    auto transmission = ads.retrieveWS<MatrixWorkspace>("TRANS_LAM_3");
+    TS_ASSERT_EQUALS(transmission->getAxis(0)->unit()->unitID(),
+                     "Wavelength");
+    const auto names = ads.getObjectNames();
+    TS_ASSERT_EQUALS(std::count_if(names.cbegin(), names.cend(),
+                                   [](const std::string &name) {
+                                     return name.find("TRANS_LAM") == 0;
+                                   }),
+                     1);
+  }
+};
+
+#endif /* MANTID_ALGORITHMS_REFLECTOMETRYBATCHREDUCTIONTEST_H_ */
@@ -19,6 +19,8 @@
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 #include <cxxtest/TestSuite.h>
 
+#include <cmath>
+
 #include "SofQWTest.h"
 
 using namespace Mantid::Algorithms;
@@ -270,6 +272,49 @@ public:
     }
   }
 
+  void testCachedOverlapsGiveSameResult() {
+    auto inWS = SofQWTest::loadTestFile();
+    auto runAlg = [&inWS](const bool cacheOverlaps) {
+      Mantid::Algorithms::SofQWNormalisedPolygon alg;
+      alg.initialize();
+      alg.setChild(true);
+      alg.setRethrows(true);
+      alg.setProperty("InputWorkspace", inWS);
+      alg.setProperty("OutputWorkspace", "_unused");
+      alg.setProperty("EMode", "Indirect");
+      alg.setProperty("EFixed", 1.84);
+      alg.setProperty("QAxisBinning", "0.5,0.25,2");
+      alg.setProperty("CacheOverlaps", cacheOverlaps);
+      alg.execute();
+      Mantid::API::MatrixWorkspace_sptr outWS =
+          alg.getProperty("OutputWorkspace");
+      return outWS;
+    };
+    const auto expected = runAlg(false);
+    // The first run calculates the overlaps, the second reuses them
+    for (int run = 0; run < 2; ++run) {
+      const auto outWS = runAlg(true);
+      TS_ASSERT_EQUALS(outWS->getNumberHistograms(),
+                       expected->getNumberHistograms())
+      for (size_t i = 0; i < outWS->getNumberHistograms(); ++i) {
+        const auto &y = outWS->y(i);
+        const auto &e = outWS->e(i);
+        const auto &expectedY = expected->y(i);
+        const auto &expectedE = expected->e(i);
+        for (size_t j = 0; j < y.size(); ++j) {
+          if (std::isnan(expectedY[j])) {
+            TS_ASSERT(std::isnan(y[j]))
+            continue;
+          }
+          TS_ASSERT_DELTA(y[j], expectedY[j], 1e-12)
+          TS_ASSERT_DELTA(e[j], expectedE[j], 1e-12)
+        }
+      }
+    }
+    // Release the cached overlaps
+    runAlg(false);
+  }
+
   void testQBinWidthAsQAxisBinning() {
     // SofQWNormalisedPolygon uses it's own setUpOutputWorkspace while
     // the other SofQW* algorithms use the one in SofQW.
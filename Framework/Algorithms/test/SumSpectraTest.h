@@ -9,10 +9,17 @@
 
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/SpectrumInfo.h"
+#include "MantidAlgorithms/CreateWorkspace.h"
 #include "MantidAlgorithms/SumSpectra.h"
+#include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidIndexing/IndexInfo.h"
+#include "MantidTestHelpers/ParallelAlgorithmCreation.h"
+#include "MantidTestHelpers/ParallelRunner.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
+#include "MantidTypes/SpectrumDefinition.h"
 #include <boost/lexical_cast.hpp>
 #include <cmath>
 #include <cxxtest/TestSuite.h>
@@ -22,6 +29,97 @@ using namespace Mantid;
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
 
+namespace {
+void run_sum_distributed_histograms(const Parallel::Communicator &comm) {
+  using namespace Parallel;
+  auto create = ParallelTestHelpers::create<Algorithms::CreateWorkspace>(comm);
+  std::vector<double> dataEYX(2000);
+  for (size_t i = 0; i < dataEYX.size(); ++i)
+    dataEYX[i] = static_cast<double>(i % 2);
+  create->setProperty<int>("NSpec", 1000);
+  create->setProperty<std::vector<double>>("DataX", dataEYX);
+  create->setProperty<std::vector<double>>("DataY", dataEYX);
+  create->setProperty<std::vector<double>>("DataE", dataEYX);
+  create->setProperty("ParallelStorageMode",
+                      toString(StorageMode::Distributed));
+  create->execute();
+  MatrixWorkspace_sptr ws = create->getProperty("OutputWorkspace");
+
+  auto sum = ParallelTestHelpers::create<Algorithms::SumSpectra>(comm);
+  sum->setProperty("InputWorkspace", ws);
+  sum->setProperty("StartWorkspaceIndex", 100);
+  sum->setProperty("EndWorkspaceIndex", 299);
+  TS_ASSERT_THROWS_NOTHING(sum->execute());
+  MatrixWorkspace_const_sptr out = sum->getProperty("OutputWorkspace");
+  TS_ASSERT_EQUALS(out->getNumberHistograms(), 1);
+  if (comm.rank() != 0) {
+    TS_ASSERT_EQUALS(out->storageMode(), StorageMode::Cloned);
+    return;
+  }
+  TS_ASSERT_EQUALS(out->storageMode(), StorageMode::MasterOnly);
+  TS_ASSERT_EQUALS(out->y(0)[0], 0.);
+  TS_ASSERT_EQUALS(out->y(0)[1], 200.);
+  TS_ASSERT_DELTA(out->e(0)[1], std::sqrt(200.), 1e-12);
+  TS_ASSERT_EQUALS(out->getSpectrum(0).getSpectrumNo(), 101);
+  TS_ASSERT_EQUALS(out->run().getPropertyValueAsType<int>("NumAllSpectra"),
+                   200);
+}
+
+/// A copy of an event workspace with its spectra distributed over the ranks
+EventWorkspace_sptr distribute(const Parallel::Communicator &comm,
+                               const EventWorkspace &ws) {
+  const auto &spectrumNumbers = ws.indexInfo().spectrumNumbers();
+  Indexing::IndexInfo indexInfo(spectrumNumbers,
+                                Parallel::StorageMode::Distributed, comm);
+  std::vector<size_t> globalIndices;
+  std::vector<SpectrumDefinition> definitions;
+  for (size_t i = 0; i < indexInfo.size(); ++i) {
+    const auto global =
+        std::find(spectrumNumbers.begin(), spectrumNumbers.end(),
+                  indexInfo.spectrumNumber(i));
+    globalIndices.push_back(
+        static_cast<size_t>(global - spectrumNumbers.begin()));
+    definitions.push_back(
+        ws.spectrumInfo().spectrumDefinition(globalIndices.back()));
+  }
+  indexInfo.setSpectrumDefinitions(definitions);
+  EventWorkspace_sptr distributed =
+      create<EventWorkspace>(ws, indexInfo, ws.binEdges(0));
+  for (size_t i = 0; i < globalIndices.size(); ++i)
+    distributed->getSpectrum(i) += ws.getSpectrum(globalIndices[i]);
+  return distributed;
+}
+
+void run_sum_distributed_events(const Parallel::Communicator &comm) {
+  EventWorkspace_sptr ws =
+      WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(1, 4);
+  auto sum = ParallelTestHelpers::create<Algorithms::SumSpectra>(comm);
+  sum->setProperty("InputWorkspace", distribute(comm, *ws));
+  sum->setProperty("ListOfWorkspaceIndices", "2-7,11");
+  TS_ASSERT_THROWS_NOTHING(sum->execute());
+  MatrixWorkspace_const_sptr out = sum->getProperty("OutputWorkspace");
+  if (comm.rank() != 0)
+    return;
+
+  Algorithms::SumSpectra serial;
+  serial.setChild(true);
+  serial.initialize();
+  serial.setProperty("InputWorkspace", ws);
+  serial.setProperty("ListOfWorkspaceIndices", "2-7,11");
+  serial.setPropertyValue("OutputWorkspace", "unused");
+  serial.execute();
+  MatrixWorkspace_const_sptr expected = serial.getProperty("OutputWorkspace");
+
+  const auto &events = dynamic_cast<const EventWorkspace &>(*out);
+  TS_ASSERT_EQUALS(events.getNumberEvents(), 7 * 200);
+  TS_ASSERT_EQUALS(out->y(0).rawData(), expected->y(0).rawData());
+  TS_ASSERT_EQUALS(out->getSpectrum(0).getDetectorIDs(),
+                   expected->getSpectrum(0).getDetectorIDs());
+  TS_ASSERT_EQUALS(out->getSpectrum(0).getSpectrumNo(),
+                   expected->getSpectrum(0).getSpectrumNo());
+}
+} // namespace
+
 class SumSpectraTest : public CxxTest::TestSuite {
 public:
   static SumSpectraTest *createSuite() { return new SumSpectraTest(); }
@@ -669,6 +767,14 @@ public:
     AnalysisDataService::Instance().remove(outWsName);
   }
 
+  void test_distributed_histograms() {
+    ParallelTestHelpers::runParallel(run_sum_distributed_histograms);
+  }
+
+  void test_distributed_events() {
+    ParallelTestHelpers::runParallel(run_sum_distributed_events);
+  }
+
 private:
   int nTestHist;
   Mantid::Algorithms::SumSpectra alg; // Test with range limits
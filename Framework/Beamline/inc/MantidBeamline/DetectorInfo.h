@@ -13,6 +13,8 @@
 #include "Eigen/Geometry"
 #include "Eigen/StdVector"
 
+#include <atomic>
+
 namespace Mantid {
 namespace Beamline {
 
@@ -55,6 +57,10 @@ public:
                            Eigen::aligned_allocator<Eigen::Quaterniond>>
                    rotations,
                const std::vector<size_t> &monitorIndices);
+  DetectorInfo(const DetectorInfo &other);
+  DetectorInfo(DetectorInfo &&other) noexcept;
+  DetectorInfo &operator=(const DetectorInfo &other);
+  DetectorInfo &operator=(DetectorInfo &&other) noexcept;
 
   bool isEquivalent(const DetectorInfo &other) const;
 
@@ -78,6 +84,7 @@ public:
   void setRotation(const size_t index, const Eigen::Quaterniond &rotation);
   void setRotation(const std::pair<size_t, size_t> &index,
                    const Eigen::Quaterniond &rotation);
+  size_t positionsVersion() const;
 
   size_t scanCount() const;
   const std::vector<std::pair<int64_t, int64_t>> scanIntervals() const;
@@ -109,6 +116,9 @@ private:
   Kernel::cow_ptr<std::vector<Eigen::Quaterniond,
                               Eigen::aligned_allocator<Eigen::Quaterniond>>>
       m_rotations{nullptr};
+  /// Incremented whenever a position is set, see positionsVersion(). Atomic
+  /// since positions of different detectors may be set from several threads.
+  std::atomic<size_t> m_positionsVersion{0};
 
   ComponentInfo *m_componentInfo = nullptr; // Geometry::ComponentInfo owner
 };
@@ -168,12 +178,14 @@ inline void DetectorInfo::setPosition(const size_t index,
                                       const Eigen::Vector3d &position) {
   checkNoTimeDependence();
   m_positions.access()[index] = position;
+  m_positionsVersion.fetch_add(1, std::memory_order_relaxed);
 }
 
 /// Set the position of the detector with given index.
 inline void DetectorInfo::setPosition(const std::pair<size_t, size_t> &index,
                                       const Eigen::Vector3d &position) {
   m_positions.access()[linearIndex(index)] = position;
+  m_positionsVersion.fetch_add(1, std::memory_order_relaxed);
 }
 
 /** Set the rotation of the detector with given detector index.
@@ -192,6 +204,14 @@ inline void DetectorInfo::setRotation(const std::pair<size_t, size_t> &index,
   m_rotations.access()[linearIndex(index)] = rotation.normalized();
 }
 
+/** Returns a number that changes whenever the position of any detector is set.
+ *
+ * Clients caching results derived from detector positions can compare it with
+ * the value they saw when filling the cache. */
+inline size_t DetectorInfo::positionsVersion() const {
+  return m_positionsVersion.load(std::memory_order_relaxed);
+}
+
 /// Throws if this has time-dependent data.
 inline void DetectorInfo::checkNoTimeDependence() const {
   if (isScanning())
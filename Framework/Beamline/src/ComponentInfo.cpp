@@ -277,15 +277,23 @@ void ComponentInfo::doSetPosition(const std::pair<size_t, size_t> &index,
   const auto componentIndex = index.first;
   const auto timeIndex = index.second;
   const Eigen::Vector3d offset = newPosition - position(componentIndex);
-  for (const auto &subIndex : detectorRange) {
-    m_detectorInfo->setPosition(
-        {subIndex, timeIndex},
-        m_detectorInfo->position({subIndex, timeIndex}) + offset);
+  // Update the detectors in one pass over the position array, rather than
+  // through DetectorInfo::setPosition, which would check the copy-on-write
+  // pointer and bump the positions version once per detector.
+  if (!detectorRange.empty()) {
+    auto &detPositions = m_detectorInfo->m_positions.access();
+    for (const auto &subIndex : detectorRange) {
+      detPositions[m_detectorInfo->linearIndex({subIndex, timeIndex})] +=
+          offset;
+    }
+    m_detectorInfo->m_positionsVersion.fetch_add(1,
+                                                 std::memory_order_relaxed);
   }
 
+  auto &positions = m_positions.access();
   for (const auto &subIndex : componentRangeInSubtree(componentIndex)) {
     size_t offsetIndex = compOffsetIndex(subIndex);
-    m_positions.access()[offsetIndex] += offset;
+    positions[offsetIndex] += offset;
   }
 }
 
@@ -301,23 +309,27 @@ void ComponentInfo::doSetRotation(const std::pair<size_t, size_t> &index,
       (newRotation * currentRotInv).normalized();
   auto transform = Eigen::Matrix3d(rotDelta);
 
-  for (const auto &subDetIndex : detectorRange) {
-    auto oldPos = m_detectorInfo->position({subDetIndex, timeIndex});
-    auto newPos = transform * (oldPos - compPos) + compPos;
-    auto newRot = rotDelta * m_detectorInfo->rotation({subDetIndex, timeIndex});
-    m_detectorInfo->setPosition({subDetIndex, timeIndex}, newPos);
-    m_detectorInfo->setRotation({subDetIndex, timeIndex}, newRot);
+  // As in doSetPosition, the detectors are updated in a single batch over the
+  // position and rotation arrays.
+  if (!detectorRange.empty()) {
+    auto &detPositions = m_detectorInfo->m_positions.access();
+    auto &detRotations = m_detectorInfo->m_rotations.access();
+    for (const auto &subDetIndex : detectorRange) {
+      const size_t i = m_detectorInfo->linearIndex({subDetIndex, timeIndex});
+      detPositions[i] = transform * (detPositions[i] - compPos) + compPos;
+      detRotations[i] = (rotDelta * detRotations[i]).normalized();
+    }
+    m_detectorInfo->m_positionsVersion.fetch_add(1,
+                                                 std::memory_order_relaxed);
   }
 
+  auto &positions = m_positions.access();
+  auto &rotations = m_rotations.access();
   for (const auto &subCompIndex : componentRangeInSubtree(componentIndex)) {
-    auto oldPos = position({subCompIndex, timeIndex});
-    auto newPos = transform * (oldPos - compPos) + compPos;
-    auto newRot = rotDelta * rotation({subCompIndex, timeIndex});
     const size_t childCompIndexOffset = compOffsetIndex(subCompIndex);
-    m_positions.access()[linearIndex({childCompIndexOffset, timeIndex})] =
-        newPos;
-    m_rotations.access()[linearIndex({childCompIndexOffset, timeIndex})] =
-        newRot.normalized();
+    const size_t i = linearIndex({childCompIndexOffset, timeIndex});
+    positions[i] = transform * (positions[i] - compPos) + compPos;
+    rotations[i] = (rotDelta * rotations[i]).normalized();
   }
 }
 
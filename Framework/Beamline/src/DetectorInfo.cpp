@@ -42,6 +42,46 @@ DetectorInfo::DetectorInfo(
     m_isMonitor.access().at(i) = true;
 }
 
+DetectorInfo::DetectorInfo(const DetectorInfo &other)
+    : m_isMonitor(other.m_isMonitor), m_isMasked(other.m_isMasked),
+      m_positions(other.m_positions), m_rotations(other.m_rotations),
+      m_positionsVersion(other.positionsVersion()),
+      m_componentInfo(other.m_componentInfo) {}
+
+DetectorInfo::DetectorInfo(DetectorInfo &&other) noexcept
+    : m_isMonitor(std::move(other.m_isMonitor)),
+      m_isMasked(std::move(other.m_isMasked)),
+      m_positions(std::move(other.m_positions)),
+      m_rotations(std::move(other.m_rotations)),
+      m_positionsVersion(other.positionsVersion()),
+      m_componentInfo(other.m_componentInfo) {}
+
+/** Copy assignment. The positions version is moved past the versions of both
+ * objects, such that caches filled from this before the assignment are seen to
+ * be out of date. */
+DetectorInfo &DetectorInfo::operator=(const DetectorInfo &other) {
+  m_isMonitor = other.m_isMonitor;
+  m_isMasked = other.m_isMasked;
+  m_positions = other.m_positions;
+  m_rotations = other.m_rotations;
+  m_positionsVersion =
+      std::max(positionsVersion(), other.positionsVersion()) + 1;
+  m_componentInfo = other.m_componentInfo;
+  return *this;
+}
+
+/// Move assignment. The positions version changes as for copy assignment.
+DetectorInfo &DetectorInfo::operator=(DetectorInfo &&other) noexcept {
+  m_isMonitor = std::move(other.m_isMonitor);
+  m_isMasked = std::move(other.m_isMasked);
+  m_positions = std::move(other.m_positions);
+  m_rotations = std::move(other.m_rotations);
+  m_positionsVersion =
+      std::max(positionsVersion(), other.positionsVersion()) + 1;
+  m_componentInfo = other.m_componentInfo;
+  return *this;
+}
+
 /** Returns true if the content of this is equivalent to the content of other.
  *
  * Here "equivalent" implies equality of all member, except for positions and
@@ -206,6 +246,7 @@ void DetectorInfo::merge(const DetectorInfo &other,
     rotations.insert(rotations.end(), other.m_rotations->begin() + indexStart,
                      other.m_rotations->begin() + indexEnd);
   }
+  m_positionsVersion.fetch_add(1, std::memory_order_relaxed);
 }
 
 void DetectorInfo::setComponentInfo(ComponentInfo *componentInfo) {
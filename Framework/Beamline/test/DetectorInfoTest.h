@@ -268,6 +268,24 @@ public:
     TS_ASSERT_EQUALS(info.position(0), pos);
   }
 
+  void test_setPosition_changes_positionsVersion() {
+    DetectorInfo info(PosVec(2), RotVec(2));
+    const auto version = info.positionsVersion();
+    info.setRotation(0, Eigen::Quaterniond{1, 2, 3, 4});
+    TS_ASSERT_EQUALS(info.positionsVersion(), version);
+    info.setPosition(1, Eigen::Vector3d{1, 2, 3});
+    TS_ASSERT_DIFFERS(info.positionsVersion(), version);
+  }
+
+  void test_assignment_changes_positionsVersion() {
+    DetectorInfo info(PosVec(1), RotVec(1));
+    const DetectorInfo other(info);
+    TS_ASSERT_EQUALS(other.positionsVersion(), info.positionsVersion());
+    const auto version = info.positionsVersion();
+    info = other;
+    TS_ASSERT_DIFFERS(info.positionsVersion(), version);
+  }
+
   void test_setRotattion() {
     DetectorInfo info(PosVec(1), RotVec(1));
     Eigen::Quaterniond rot{1, 2, 3, 4};
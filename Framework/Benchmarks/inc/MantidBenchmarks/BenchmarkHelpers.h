@@ -0,0 +1,28 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_BENCHMARKS_BENCHMARKHELPERS_H_
+#define MANTID_BENCHMARKS_BENCHMARKHELPERS_H_
+
+#include "MantidAPI/Algorithm.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace Mantid {
+namespace Benchmarks {
+
+/// Create an initialized child algorithm from the plugins loaded at startup
+API::Algorithm_sptr createAlgorithm(const std::string &name);
+
+/// Execute an algorithm, marking the benchmark as failed if it throws
+bool executeAlgorithm(benchmark::State &state, API::Algorithm &alg);
+
+} // namespace Benchmarks
+} // namespace Mantid
+
+#endif /* MANTID_BENCHMARKS_BENCHMARKHELPERS_H_ */
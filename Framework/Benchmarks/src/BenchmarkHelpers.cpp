@@ -0,0 +1,43 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/BenchmarkHelpers.h"
+#include "MantidAPI/AlgorithmManager.h"
+
+namespace Mantid {
+namespace Benchmarks {
+
+/** Create an algorithm run as a child: its output workspaces are not stored
+ * in the AnalysisDataService and errors are thrown.
+ * @param name :: name of the algorithm
+ * @return the initialized algorithm
+ */
+API::Algorithm_sptr createAlgorithm(const std::string &name) {
+  auto alg = API::AlgorithmManager::Instance().createUnmanaged(name);
+  alg->initialize();
+  alg->setChild(true);
+  alg->setRethrows(true);
+  alg->setLogging(false);
+  return alg;
+}
+
+/** Execute an algorithm. The benchmark is stopped with an error if it fails.
+ * @param state :: the state of the benchmark
+ * @param alg :: the algorithm
+ * @return true if the algorithm succeeded
+ */
+bool executeAlgorithm(benchmark::State &state, API::Algorithm &alg) {
+  try {
+    alg.execute();
+    return true;
+  } catch (std::exception &e) {
+    state.SkipWithError(e.what());
+    return false;
+  }
+}
+
+} // namespace Benchmarks
+} // namespace Mantid
@@ -0,0 +1,23 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/FrameworkManager.h"
+
+#include <benchmark/benchmark.h>
+
+/** Runs the benchmarks selected on the command line. See --help for the
+ * options, such as --benchmark_filter=<regex> and
+ * --benchmark_out=<file> --benchmark_out_format=json.
+ */
+int main(int argc, char **argv) {
+  // Load the algorithm plugins
+  Mantid::API::FrameworkManager::Instance();
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,41 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/BenchmarkHelpers.h"
+#include "MantidTestHelpers/MDEventsTestHelper.h"
+
+using namespace Mantid;
+using namespace Mantid::DataObjects;
+using Mantid::Benchmarks::createAlgorithm;
+using Mantid::Benchmarks::executeAlgorithm;
+
+/// Bin a 3D MDEventWorkspace on a 100^3 grid; argument: number of events in
+/// each of the 1000 boxes of the workspace
+void BM_BinMD(benchmark::State &state, const bool iterateEvents) {
+  API::IMDWorkspace_sptr input = MDEventsTestHelper::makeMDEW<3>(
+      10, 0.0, 10.0, static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto bin = createAlgorithm("BinMD");
+    bin->setProperty("InputWorkspace", input);
+    bin->setProperty("AxisAligned", true);
+    bin->setPropertyValue("AlignedDim0", "Axis0,0,10,100");
+    bin->setPropertyValue("AlignedDim1", "Axis1,0,10,100");
+    bin->setPropertyValue("AlignedDim2", "Axis2,0,10,100");
+    bin->setProperty("IterateEvents", iterateEvents);
+    bin->setPropertyValue("OutputWorkspace", "out");
+    if (!executeAlgorithm(state, *bin))
+      break;
+  }
+  state.SetItemsProcessed(state.iterations() * 1000 * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_BinMD, IterateEvents, true)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_BinMD, IterateBoxes, false)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,79 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/ExperimentInfo.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/V3D.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Mantid;
+
+namespace {
+/// An instrument of 10 rectangular banks with pixels by pixels detectors
+std::unique_ptr<API::ExperimentInfo> makeInstrument(const int pixels) {
+  auto experiment = std::make_unique<API::ExperimentInfo>();
+  experiment->setInstrument(
+      ComponentCreationHelper::createTestInstrumentRectangular(10, pixels));
+  return experiment;
+}
+} // namespace
+
+/// Read the position of every component; argument: pixels per bank side
+void BM_ComponentInfo_positions(benchmark::State &state) {
+  const auto experiment = makeInstrument(static_cast<int>(state.range(0)));
+  const auto &componentInfo = experiment->componentInfo();
+  for (auto _ : state) {
+    Kernel::V3D sum;
+    for (size_t i = 0; i < componentInfo.size(); ++i)
+      sum += componentInfo.position(i);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * componentInfo.size());
+}
+BENCHMARK(BM_ComponentInfo_positions)
+    ->RangeMultiplier(2)
+    ->Range(16, 256)
+    ->Unit(benchmark::kMicrosecond);
+
+/// Walk the detectors of every bank from the root; argument: pixels per bank
+/// side
+void BM_ComponentInfo_detectorsInSubtree(benchmark::State &state) {
+  const auto experiment = makeInstrument(static_cast<int>(state.range(0)));
+  const auto &componentInfo = experiment->componentInfo();
+  for (auto _ : state) {
+    size_t count = 0;
+    for (const auto bank : componentInfo.children(componentInfo.root()))
+      count += componentInfo.detectorsInSubtree(bank).size();
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          experiment->detectorInfo().size());
+}
+BENCHMARK(BM_ComponentInfo_detectorsInSubtree)
+    ->RangeMultiplier(2)
+    ->Range(16, 256)
+    ->Unit(benchmark::kMicrosecond);
+
+/// Compute the scattering angle of every detector; argument: pixels per bank
+/// side
+void BM_DetectorInfo_twoTheta(benchmark::State &state) {
+  const auto experiment = makeInstrument(static_cast<int>(state.range(0)));
+  const auto &detectorInfo = experiment->detectorInfo();
+  for (auto _ : state) {
+    double sum = 0.;
+    for (size_t i = 0; i < detectorInfo.size(); ++i)
+      sum += detectorInfo.twoTheta(i);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * detectorInfo.size());
+}
+BENCHMARK(BM_DetectorInfo_twoTheta)
+    ->RangeMultiplier(2)
+    ->Range(16, 256)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,40 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/BenchmarkHelpers.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidTestHelpers/MDEventsTestHelper.h"
+
+using namespace Mantid;
+using namespace Mantid::DataObjects;
+using Mantid::Benchmarks::createAlgorithm;
+using Mantid::Benchmarks::executeAlgorithm;
+
+/// Convert diffraction events to Q in the lab frame; argument: number of
+/// events per pixel of the 400 pixels of MINITOPAZ
+void BM_ConvertToMD_Q3D(benchmark::State &state) {
+  const auto input = MDEventsTestHelper::createDiffractionEventWorkspace(
+      static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto convert = createAlgorithm("ConvertToMD");
+    convert->setProperty(
+        "InputWorkspace",
+        boost::static_pointer_cast<API::MatrixWorkspace>(input));
+    convert->setPropertyValue("OutputWorkspace", "out");
+    convert->setPropertyValue("QDimensions", "Q3D");
+    convert->setPropertyValue("dEAnalysisMode", "Elastic");
+    convert->setPropertyValue("Q3DFrames", "Q_lab");
+    convert->setPropertyValue("MinValues", "-50,-50,-50");
+    convert->setPropertyValue("MaxValues", "50,50,50");
+    if (!executeAlgorithm(state, *convert))
+      break;
+  }
+  state.SetItemsProcessed(state.iterations() * input->getNumberEvents());
+}
+BENCHMARK(BM_ConvertToMD_Q3D)
+    ->RangeMultiplier(10)
+    ->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,67 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/Axis.h"
+#include "MantidBenchmarks/BenchmarkHelpers.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidKernel/UnitFactory.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+using namespace Mantid;
+using Mantid::Benchmarks::createAlgorithm;
+using Mantid::Benchmarks::executeAlgorithm;
+
+namespace {
+void runConvertUnits(benchmark::State &state, API::MatrixWorkspace_sptr input,
+                     const std::string &target) {
+  input->getAxis(0)->unit() = Kernel::UnitFactory::Instance().create("TOF");
+  for (auto _ : state) {
+    auto convert = createAlgorithm("ConvertUnits");
+    convert->setProperty("InputWorkspace", input);
+    convert->setPropertyValue("OutputWorkspace", "out");
+    convert->setPropertyValue("Target", target);
+    if (!executeAlgorithm(state, *convert))
+      break;
+  }
+  state.SetItemsProcessed(state.iterations() * input->getNumberHistograms());
+}
+} // namespace
+
+/// Convert a histogram workspace from TOF; arguments: number of spectra and
+/// of bins
+void BM_ConvertUnits_Workspace2D(benchmark::State &state,
+                                 const std::string &target) {
+  runConvertUnits(state,
+                  WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(
+                      static_cast<int>(state.range(0)),
+                      static_cast<int>(state.range(1))),
+                  target);
+}
+BENCHMARK_CAPTURE(BM_ConvertUnits_Workspace2D, Wavelength,
+                  std::string("Wavelength"))
+    ->Ranges({{1000, 100000}, {100, 10000}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ConvertUnits_Workspace2D, dSpacing,
+                  std::string("dSpacing"))
+    ->Ranges({{1000, 100000}, {100, 10000}})
+    ->Unit(benchmark::kMillisecond);
+
+/// Convert an event workspace from TOF; argument: number of pixels per side of
+/// each of 4 rectangular banks, with events in every pixel
+void BM_ConvertUnits_EventWorkspace(benchmark::State &state,
+                                    const std::string &target) {
+  runConvertUnits(
+      state,
+      WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(
+          4, static_cast<int>(state.range(0)), false),
+      target);
+}
+BENCHMARK_CAPTURE(BM_ConvertUnits_EventWorkspace, dSpacing,
+                  std::string("dSpacing"))
+    ->RangeMultiplier(2)
+    ->Range(16, 128)
+    ->Unit(benchmark::kMillisecond);
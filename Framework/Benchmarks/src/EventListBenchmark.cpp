@@ -0,0 +1,85 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventList.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using Mantid::DataObjects::EventList;
+using Mantid::MantidVec;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+/// Events with random time-of-flight up to 1e5 and increasing pulse times
+EventList makeEvents(const size_t numEvents) {
+  std::mt19937 generator(numEvents);
+  std::uniform_real_distribution<double> tof(0., 100000.);
+  EventList events;
+  events.reserve(numEvents);
+  for (size_t i = 0; i < numEvents; ++i)
+    events.addEventQuickly(TofEvent(tof(generator), static_cast<int64_t>(i)));
+  return events;
+}
+
+/// Bin edges covering the time-of-flight of makeEvents()
+MantidVec makeBinEdges(const size_t numBins) {
+  MantidVec edges(numBins + 1);
+  const double width = 100000. / static_cast<double>(numBins);
+  for (size_t i = 0; i <= numBins; ++i)
+    edges[i] = width * static_cast<double>(i);
+  return edges;
+}
+} // namespace
+
+/// Sort events by time-of-flight; argument: number of events
+void BM_EventList_sortTof(benchmark::State &state) {
+  const auto source = makeEvents(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    EventList events(source);
+    state.ResumeTiming();
+    events.sortTof();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EventList_sortTof)
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+
+/// Compress sorted events; argument: number of events
+void BM_EventList_compressEvents(benchmark::State &state) {
+  auto source = makeEvents(static_cast<size_t>(state.range(0)));
+  source.sortTof();
+  for (auto _ : state) {
+    EventList compressed;
+    source.compressEvents(0.05, &compressed);
+    benchmark::DoNotOptimize(compressed.getNumberEvents());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EventList_compressEvents)
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+
+/// Histogram sorted events; arguments: number of events and of bins
+void BM_EventList_generateHistogram(benchmark::State &state) {
+  auto source = makeEvents(static_cast<size_t>(state.range(0)));
+  source.sortTof();
+  const auto edges = makeBinEdges(static_cast<size_t>(state.range(1)));
+  MantidVec y, e;
+  for (auto _ : state) {
+    source.generateHistogram(edges, y, e);
+    benchmark::DoNotOptimize(y.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EventList_generateHistogram)
+    ->Ranges({{10000, 10000000}, {100, 100000}})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,59 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/BenchmarkHelpers.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <cmath>
+#include <random>
+
+using namespace Mantid;
+using Mantid::Benchmarks::createAlgorithm;
+using Mantid::Benchmarks::executeAlgorithm;
+
+namespace {
+/// A noisy Gaussian peak on a flat background, over [0, 10]
+API::MatrixWorkspace_sptr makePeak(const size_t numPoints) {
+  auto ws = WorkspaceCreationHelper::create2DWorkspaceFromFunction(
+      [](double x, int) {
+        return 2.0 + 10.0 * std::exp(-0.5 * std::pow((x - 5.1) / 0.7, 2));
+      },
+      1, 0.0, 10.0, 10.0 / static_cast<double>(numPoints));
+  std::mt19937 generator(42);
+  std::normal_distribution<double> noise(0.0, 0.1);
+  auto &y = ws->mutableY(0);
+  for (auto &value : y)
+    value += noise(generator);
+  ws->mutableE(0) = 0.1;
+  return ws;
+}
+} // namespace
+
+/// Fit a peak from the same starting point; argument: number of data points
+void BM_Fit_Gaussian(benchmark::State &state, const std::string &minimizer) {
+  const auto input = makePeak(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto fit = createAlgorithm("Fit");
+    fit->setPropertyValue(
+        "Function", "name=FlatBackground,A0=1;"
+                    "name=Gaussian,Height=8,PeakCentre=4.8,Sigma=1");
+    fit->setProperty("InputWorkspace", input);
+    fit->setPropertyValue("Minimizer", minimizer);
+    if (!executeAlgorithm(state, *fit))
+      break;
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_Fit_Gaussian, LevenbergMarquardt,
+                  std::string("Levenberg-Marquardt"))
+    ->RangeMultiplier(10)
+    ->Range(100, 1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Fit_Gaussian, Simplex, std::string("Simplex"))
+    ->RangeMultiplier(10)
+    ->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
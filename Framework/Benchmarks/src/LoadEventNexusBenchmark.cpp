@@ -0,0 +1,40 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/FileFinder.h"
+#include "MantidBenchmarks/BenchmarkHelpers.h"
+
+using namespace Mantid;
+using Mantid::Benchmarks::createAlgorithm;
+using Mantid::Benchmarks::executeAlgorithm;
+
+/// Load an event file of the unit test data; arguments: the file and whether
+/// to precount the events
+void BM_LoadEventNexus(benchmark::State &state, const std::string &file) {
+  const auto path = API::FileFinder::Instance().getFullPath(file);
+  if (path.empty()) {
+    state.SkipWithError((file + " is not in the data search directories, "
+                                "build the StandardTestData target")
+                            .c_str());
+    return;
+  }
+  for (auto _ : state) {
+    auto load = createAlgorithm("LoadEventNexus");
+    load->setPropertyValue("Filename", path);
+    load->setPropertyValue("OutputWorkspace", "out");
+    load->setProperty("Precount", state.range(0) != 0);
+    if (!executeAlgorithm(state, *load))
+      break;
+  }
+}
+BENCHMARK_CAPTURE(BM_LoadEventNexus, ARCS, std::string("ARCS_sim_event.nxs"))
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadEventNexus, BSS, std::string("BSS_11841_event.nxs"))
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,68 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/BenchmarkHelpers.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+using namespace Mantid;
+using Mantid::Benchmarks::createAlgorithm;
+using Mantid::Benchmarks::executeAlgorithm;
+
+/// Rebin a histogram workspace; arguments: number of spectra and of bins
+void BM_Rebin_Workspace2D(benchmark::State &state) {
+  const auto numBins = state.range(1);
+  API::MatrixWorkspace_sptr input =
+      WorkspaceCreationHelper::create2DWorkspaceBinned(
+          static_cast<size_t>(state.range(0)), static_cast<size_t>(numBins));
+  // Coarser, misaligned bins covering most of the input
+  const std::string params =
+      "0.5," + std::to_string(1.77 * static_cast<double>(numBins) / 1000.) +
+      "," + std::to_string(numBins - 1);
+  for (auto _ : state) {
+    auto rebin = createAlgorithm("Rebin");
+    rebin->setProperty("InputWorkspace", input);
+    rebin->setPropertyValue("OutputWorkspace", "out");
+    rebin->setPropertyValue("Params", params);
+    if (!executeAlgorithm(state, *rebin))
+      break;
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Rebin_Workspace2D)
+    ->Args({1000, 1000})
+    ->Args({1000, 20000})
+    ->Args({10000, 1000})
+    ->Args({10000, 20000})
+    ->Unit(benchmark::kMillisecond);
+
+/// Rebin an event workspace to histograms; arguments: number of spectra and
+/// of bins, with 100 events per spectrum
+void BM_Rebin_EventWorkspace(benchmark::State &state) {
+  DataObjects::EventWorkspace_sptr input =
+      WorkspaceCreationHelper::createRandomEventWorkspace(
+          static_cast<size_t>(100), static_cast<size_t>(state.range(0)));
+  double xmin, xmax;
+  input->getEventXMinMax(xmin, xmax);
+  const std::string params =
+      std::to_string(xmin) + "," +
+      std::to_string((xmax - xmin) / static_cast<double>(state.range(1))) +
+      "," + std::to_string(xmax);
+  for (auto _ : state) {
+    auto rebin = createAlgorithm("Rebin");
+    rebin->setProperty("InputWorkspace",
+                       boost::static_pointer_cast<API::MatrixWorkspace>(input));
+    rebin->setPropertyValue("OutputWorkspace", "out");
+    rebin->setPropertyValue("Params", params);
+    rebin->setProperty("PreserveEvents", false);
+    if (!executeAlgorithm(state, *rebin))
+      break;
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Rebin_EventWorkspace)
+    ->Ranges({{1000, 100000}, {100, 10000}})
+    ->Unit(benchmark::kMillisecond);
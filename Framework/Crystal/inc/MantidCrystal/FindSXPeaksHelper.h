@@ -73,6 +73,14 @@ public:
 
   detid_t getDetectorId() const;
 
+  double getTOF() const;
+
+  double getDSpacing() const;
+
+  double getTwoTheta() const;
+
+  double getPhi() const;
+
 private:
   /// TOF for the peak centre
   double m_tof;
@@ -224,10 +232,22 @@ private:
  * Comparison Strategy
  * ------------------------------------------------------------------------------------------
  */
+/// Absolute tolerances beyond which two peaks never compare as alike
+struct DLLExport CompareTolerances {
+  double x;
+  double twoTheta;
+  double phi;
+  XAxisUnit units;
+};
+
 class DLLExport CompareStrategy {
 public:
   virtual ~CompareStrategy() = default;
   virtual bool compare(const SXPeak &lhs, const SXPeak &rhs) const = 0;
+  /// The tolerances bounding compare, if it has absolute ones
+  virtual boost::optional<CompareTolerances> getTolerances() const {
+    return boost::none;
+  }
 };
 
 class DLLExport RelativeCompareStrategy : public CompareStrategy {
@@ -246,6 +266,7 @@ public:
                           const double twoThetaResolution,
                           const XAxisUnit units = XAxisUnit::TOF);
   bool compare(const SXPeak &lhs, const SXPeak &rhs) const override;
+  boost::optional<CompareTolerances> getTolerances() const override;
 
 private:
   const double m_xUnitResolution;
@@ -15,6 +15,10 @@
 
 #include "MantidKernel/V3D.h"
 
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
 namespace Mantid {
 namespace Crystal {
 namespace PeakStatisticsTools {
@@ -67,6 +71,10 @@ private:
  * counts can be obtained, for example to calculate redundancy or
  * completeness of the observations.
  *
+ * The reflection family of an HKL is the same as the one from
+ * PointGroup::getReflectionFamily, but it is found with integer copies of the
+ * point group's HKL transformations and looked up in a hash map, as this is
+ * done for every peak.
  */
 class DLLExport UniqueReflectionCollection {
 public:
@@ -75,6 +83,11 @@ public:
       const Geometry::PointGroup_sptr &pointGroup,
       const Geometry::ReflectionCondition_sptr &centering);
 
+  UniqueReflectionCollection(const UniqueReflectionCollection &other);
+  UniqueReflectionCollection(UniqueReflectionCollection &&) = default;
+  UniqueReflectionCollection &
+  operator=(const UniqueReflectionCollection &other);
+  UniqueReflectionCollection &operator=(UniqueReflectionCollection &&) = default;
   ~UniqueReflectionCollection() = default;
 
   void addObservations(const std::vector<DataObjects::Peak> &peaks);
@@ -93,11 +106,23 @@ protected:
   UniqueReflectionCollection(
       const std::map<Kernel::V3D, UniqueReflection> &reflections,
       const Geometry::PointGroup_sptr &pointGroup)
-      : m_reflections(reflections), m_pointgroup(pointGroup) {}
+      : m_reflections(reflections), m_pointgroup(pointGroup) {
+    setHKLTransformations();
+    indexReflections();
+  }
 
 private:
+  void setHKLTransformations();
+  void indexReflections();
+  bool getFamilyKey(const Kernel::V3D &hkl, int64_t &key) const;
+  Kernel::V3D getFamily(const Kernel::V3D &hkl) const;
+
   std::map<Kernel::V3D, UniqueReflection> m_reflections;
   Geometry::PointGroup_sptr m_pointgroup;
+  /// The HKL transformation matrices of the point group's operations
+  std::vector<std::array<int, 9>> m_hklTransformations;
+  /// The reflections in m_reflections by the key of their family
+  std::unordered_map<int64_t, UniqueReflection *> m_reflectionIndex;
 };
 
 /**
@@ -85,6 +85,8 @@ private:
 
   /// Number of edge pixels with no peaks
   int m_edge;
+  /// Whether to predict peaks outside the detectors
+  bool m_useExtendedDetectorSpace;
 
   /// Reflection conditions possible
   std::vector<Mantid::Geometry::ReflectionCondition_sptr> m_refConds;
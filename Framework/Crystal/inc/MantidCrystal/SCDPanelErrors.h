@@ -13,12 +13,21 @@
 #include "MantidAPI/IFunction1D.h"
 #include "MantidAPI/ParamFunction.h"
 #include "MantidAPI/Workspace_fwd.h"
+#include "MantidKernel/Matrix.h"
+#include "MantidKernel/Quat.h"
 #include "MantidKernel/System.h"
+#include "MantidKernel/V3D.h"
 #include <cmath>
+#include <vector>
 
 namespace Mantid {
 namespace Crystal {
 /*
+The errors between the Q of the peaks, with the panel moved by the
+parameters, and the Q of their HKLs. The peaks are indexed and the positions
+of their detectors are read once, so that the errors and their derivatives
+are calculated analytically, without moving the instrument.
+
 @author Vickie Lynch, SNS
 @date 7/25/2016
 */
@@ -59,15 +68,29 @@ private:
   /// Clear all data
   void clear() const;
 
-  /// Evaluate the function for a list of arguments and given scaling factor
-  void eval(double xshift, double yshift, double zshift, double xrotate,
-            double yrotate, double zrotate, double scalex, double scaley,
-            double *out, const double *xValues, const size_t nData,
-            double tShift) const;
+  /// Evaluate the errors, and their derivatives if a Jacobian is given
+  void eval(double *out, API::Jacobian *jacobian, const size_t nData) const;
 
-  /// Fill in the workspace and bank names
+  /// Fill in the workspace and bank names, and the geometry of the peaks
   void setupData() const;
 
+  /// The geometry of a peak that does not change as the panel moves
+  struct PeakGeometry {
+    /// Whether the peak is indexed. The others have a fixed penalty.
+    bool indexed;
+    /// Position of the detector, relative to the panel in its own frame if
+    /// the panel moves it
+    Kernel::V3D position;
+    /// Whether the detector is moved with the panel
+    bool onPanel;
+    /// Time of flight
+    double tof;
+    /// Inverse of the goniometer matrix
+    Kernel::DblMatrix inverseGoniometer;
+    /// Q of the HKL of the peak in the sample frame
+    Kernel::V3D qHKL;
+  };
+
   /// The default value for the workspace index
   static const int defaultIndexValue;
 
@@ -79,6 +102,23 @@ private:
 
   /// Flag of completing data setup
   mutable bool m_setupFinished;
+
+  /// The geometry of each peak
+  mutable std::vector<PeakGeometry> m_peaks;
+  /// Whether the parameters move the source rather than a panel
+  mutable bool m_movesSource{false};
+  /// Whether the panel is a rectangular detector that can be scaled
+  mutable bool m_scalable{false};
+  /// Position and rotation of the panel
+  mutable Kernel::V3D m_panelPosition;
+  mutable Kernel::Quat m_panelRotation;
+  /// Scale of the panel before the fit
+  mutable double m_scaleX{1.0};
+  mutable double m_scaleY{1.0};
+  mutable Kernel::V3D m_sourcePosition;
+  mutable Kernel::V3D m_samplePosition;
+  /// -1 for the crystallography convention of Q, 1 otherwise
+  mutable double m_qSign{1.0};
 };
 
 } // namespace Crystal
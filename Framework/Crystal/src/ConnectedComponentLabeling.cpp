@@ -11,9 +11,14 @@
 #include "MantidAPI/IMDIterator.h"
 #include "MantidCrystal/BackgroundStrategy.h"
 #include "MantidCrystal/Cluster.h"
-#include "MantidCrystal/ClusterRegister.h"
+#include "MantidCrystal/CompositeCluster.h"
 #include "MantidCrystal/ICluster.h"
 #include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <atomic>
+#include <boost/scoped_ptr.hpp>
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -104,6 +109,53 @@ bool does_contain_key(const Container &container,
 using EdgeIndexPair = boost::tuple<size_t, size_t>;
 using VecEdgeIndexPair = std::vector<EdgeIndexPair>;
 
+/**
+ * Disjoint sets of labels which may be joined from several threads at once,
+ * without locking. Joining links the root with the larger index to the one
+ * with the smaller, so the root of each set is its smallest member and the
+ * parent of an element only ever decreases.
+ */
+class ConcurrentDisjointSets {
+public:
+  explicit ConcurrentDisjointSets(const size_t size) : m_parents(size) {
+    for (size_t i = 0; i < size; ++i)
+      m_parents[i].store(i, std::memory_order_relaxed);
+  }
+
+  /// @return the root of the set of an element, halving the path to it
+  size_t find(size_t element) {
+    while (true) {
+      size_t parent = m_parents[element].load();
+      if (parent == element)
+        return element;
+      const size_t grandParent = m_parents[parent].load();
+      // Fails harmlessly if another thread has moved the parent meanwhile
+      if (grandParent != parent)
+        m_parents[element].compare_exchange_weak(parent, grandParent);
+      element = grandParent;
+    }
+  }
+
+  /// Join the sets of two elements
+  void join(size_t a, size_t b) {
+    while (true) {
+      a = find(a);
+      b = find(b);
+      if (a == b)
+        return;
+      if (a < b)
+        std::swap(a, b);
+      // Retry if a has been linked elsewhere since it was found to be a root
+      size_t expected = a;
+      if (m_parents[a].compare_exchange_strong(expected, b))
+        return;
+    }
+  }
+
+private:
+  std::vector<std::atomic<size_t>> m_parents;
+};
+
 /**
  * Free function performing the CCL implementation over a range defined by the
  *iterator.
@@ -300,12 +352,14 @@ ClusterMap ConnectedComponentLabeling::calculateDisjointTree(
 
     std::vector<VecEdgeIndexPair> parallelEdgeVec(nThreadsToUse);
 
-    std::vector<std::map<size_t, boost::shared_ptr<Cluster>>>
-        parallelClusterMapVec(nThreadsToUse);
+    // The clusters of the labels of each thread, in label order
+    std::vector<size_t> startLabels(nThreadsToUse);
+    std::vector<std::vector<boost::shared_ptr<Cluster>>> parallelClusterVec(
+        nThreadsToUse);
 
     // ------------- Stage One. Local CCL in parallel.
     g_log.debug("Parallel solve local CCL");
-    // PARALLEL_FOR_NO_WSP_CHECK()
+    PARALLEL_FOR_NO_WSP_CHECK()
     for (int i = 0; i < nThreadsToUse; ++i) {
       API::IMDIterator *iterator = iterators[i].get();
       boost::scoped_ptr<BackgroundStrategy> strategy(
@@ -321,51 +375,88 @@ ClusterMap ConnectedComponentLabeling::calculateDisjointTree(
           startLabel, edgeVec);
 
       // Create clusters from labels.
-      std::map<size_t, boost::shared_ptr<Cluster>> &localClusterMap =
-          parallelClusterMapVec[i]; // local cluster map.
+      startLabels[i] = startLabel;
+      auto &localClusters = parallelClusterVec[i];
+      localClusters.reserve(endLabel - startLabel);
       for (size_t labelId = startLabel; labelId != endLabel; ++labelId) {
-        auto cluster = boost::make_shared<Cluster>(
-            labelId); // Create a cluster for the label and key it by the label.
-        localClusterMap[labelId] = cluster;
+        localClusters.emplace_back(boost::make_shared<Cluster>(labelId));
       }
 
       // Associate the member DisjointElements with a cluster. Involves looping
       // back over iterator.
       iterator->jumpTo(0); // Reset
       do {
-        if (!baseStrategy->isBackground(iterator)) {
+        if (!strategy->isBackground(iterator)) {
           // Second pass smoothing step
           const size_t currentIndex = iterator->getLinearIndex();
 
-          const size_t &labelAtIndex =
-              neighbourElements[currentIndex].getRoot();
-          localClusterMap[labelAtIndex]->addIndex(currentIndex);
+          const size_t labelAtIndex = neighbourElements[currentIndex].getRoot();
+          localClusters[labelAtIndex - startLabel]->addIndex(currentIndex);
         }
       } while (iterator->next());
     }
 
-    // -------------------- Stage 2 --- Preparation stage for combining
-    // equivalent clusters. Must be done in sequence.
-    // Combine cluster maps processed by each thread.
-    ClusterRegister clusterRegister;
-    for (const auto &parallelClusterMap : parallelClusterMapVec) {
-      for (const auto &cluster : parallelClusterMap) {
-        clusterRegister.add(cluster.first, cluster.second);
+    // -------------------- Stage 2 --- Join the labels of clusters which meet
+    // across the boundaries between threads, in parallel.
+    std::vector<size_t> offsets(nThreadsToUse + 1, 0);
+    for (int i = 0; i < nThreadsToUse; ++i) {
+      offsets[i + 1] = offsets[i] + parallelClusterVec[i].size();
+    }
+    // Labels increase with the thread, and so do their positions
+    const auto positionOf = [&startLabels, &offsets](const size_t label) {
+      const auto thread =
+          std::upper_bound(startLabels.cbegin(), startLabels.cend(), label) -
+          startLabels.cbegin() - 1;
+      return offsets[thread] + (label - startLabels[thread]);
+    };
+
+    g_log.debug("Join labels across boundaries");
+    ConcurrentDisjointSets labelSets(offsets.back());
+    for (const auto &edgeVec : parallelEdgeVec) {
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t j = 0; j < static_cast<int64_t>(edgeVec.size()); ++j) {
+        const DisjointElement &a = neighbourElements[edgeVec[j].get<0>()];
+        const DisjointElement &b = neighbourElements[edgeVec[j].get<1>()];
+        if (!a.isEmpty() && !b.isEmpty()) {
+          labelSets.join(positionOf(a.getRoot()), positionOf(b.getRoot()));
+        }
       }
     }
 
-    // Percolate minimum label across boundaries for indexes where there is
-    // ambiguity.
-    g_log.debug("Percolate minimum label across boundaries");
-
-    for (auto &indexPairVec : parallelEdgeVec) {
-      for (auto &iit : indexPairVec) {
-        DisjointElement &a = neighbourElements[iit.get<0>()];
-        DisjointElement &b = neighbourElements[iit.get<1>()];
-        clusterRegister.merge(a, b);
+    // Clusters whose labels were joined become composites, labelled by their
+    // minimum label. The others are kept as they are.
+    std::vector<size_t> roots(offsets.back());
+    std::vector<size_t> setSizes(offsets.back(), 0);
+    for (size_t position = 0; position < roots.size(); ++position) {
+      roots[position] = labelSets.find(position);
+      ++setSizes[roots[position]];
+    }
+    std::vector<boost::shared_ptr<CompositeCluster>> composites;
+    std::vector<size_t> compositeOfRoot(offsets.back());
+    size_t position = 0;
+    for (const auto &localClusters : parallelClusterVec) {
+      for (const auto &cluster : localClusters) {
+        const size_t root = roots[position++];
+        if (setSizes[root] == 1) {
+          clusterMap.emplace(cluster->getLabel(), cluster);
+          continue;
+        }
+        if (root == position - 1) {
+          compositeOfRoot[root] = composites.size();
+          composites.emplace_back(boost::make_shared<CompositeCluster>());
+        }
+        boost::shared_ptr<ICluster> member = cluster;
+        composites[compositeOfRoot[root]]->add(member);
       }
     }
-    clusterMap = clusterRegister.clusters(neighbourElements);
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(composites.size()); ++i) {
+      composites[i]->toUniformMinimum(neighbourElements);
+    }
+    for (const auto &composite : composites) {
+      clusterMap.emplace(composite->getLabel(), composite);
+    }
 
   } else {
     auto iterator = ws->createIterator(nullptr);
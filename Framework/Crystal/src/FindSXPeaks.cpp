@@ -9,6 +9,7 @@
 #include "MantidAPI/HistogramValidator.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/WorkspaceUnitValidator.h"
+#include "MantidDataObjects/EventWorkspace.h"
 #include "MantidGeometry/Instrument/Goniometer.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/BoundedValidator.h"
@@ -289,9 +290,14 @@ void FindSXPeaks::exec() {
   auto peakFindingStrategy = getPeakFindingStrategy(
       backgroundStrategy.get(), spectrumInfo, m_MinRange, m_MaxRange, xUnit);
 
-  peakvector entries;
-  entries.reserve(m_MaxWsIndex - m_MinWsIndex);
-  // Count the peaks so that we can resize the peak vector at the end.
+  // Event lists are histogrammed for the search only, skipping the errors
+  // and the MRU, so that the threads do not compete for it
+  const auto eventWorkspace =
+      boost::dynamic_pointer_cast<const EventWorkspace>(localworkspace);
+
+  // Keep the peaks of each spectrum apart so that the reduction sees them in
+  // the same order whatever the threads do
+  std::vector<PeakList> foundPeaks(m_MaxWsIndex - m_MinWsIndex + 1);
   PARALLEL_FOR_IF(Kernel::threadSafe(*localworkspace))
   for (auto wsIndex = static_cast<int>(m_MinWsIndex);
        wsIndex <= static_cast<int>(m_MaxWsIndex); ++wsIndex) {
@@ -304,25 +310,31 @@ void FindSXPeaks::exec() {
       continue;
     }
 
-    // Retrieve the spectrum into a vector
-    const auto &x = localworkspace->x(wsIndex);
-    const auto &y = localworkspace->y(wsIndex);
-
     // Run the peak finding strategy
-    auto foundPeaks = peakFindingStrategy->findSXPeaks(x, y, wsIndex);
-    if (!foundPeaks) {
-      continue;
-    }
-
-    PARALLEL_CRITICAL(entries) {
-      std::copy(foundPeaks->cbegin(), foundPeaks->cend(),
-                std::back_inserter(entries));
+    const auto &x = localworkspace->x(wsIndex);
+    auto &peaks = foundPeaks[wsIndexSize_t - m_MinWsIndex];
+    if (eventWorkspace) {
+      MantidVec y, e;
+      eventWorkspace->getSpectrum(wsIndexSize_t)
+          .generateHistogram(x.rawData(), y, e, true);
+      peaks = peakFindingStrategy->findSXPeaks(
+          x, HistogramData::HistogramY(std::move(y)), wsIndex);
+    } else {
+      peaks = peakFindingStrategy->findSXPeaks(x, localworkspace->y(wsIndex),
+                                               wsIndex);
     }
     progress.report();
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  peakvector entries;
+  for (const auto &peaks : foundPeaks) {
+    if (peaks) {
+      entries.insert(entries.end(), peaks->cbegin(), peaks->cend());
+    }
+  }
+
   // Now reduce the list with duplicate entries
   reducePeakList(entries, progress);
 
@@ -15,9 +15,12 @@
 
 #include "MantidTypes/SpectrumDefinition.h"
 
+#include <boost/functional/hash.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/connected_components.hpp>
+#include <array>
 #include <cmath>
+#include <unordered_map>
 
 namespace {
 
@@ -204,6 +207,26 @@ Getter for the detector Id.
 */
 detid_t SXPeak::getDetectorId() const { return m_detId; }
 
+/**
+Getter for the TOF, summed over the pixels until reduce is called.
+*/
+double SXPeak::getTOF() const { return m_tof; }
+
+/**
+Getter for the d-spacing of the first pixel.
+*/
+double SXPeak::getDSpacing() const { return m_dSpacing; }
+
+/**
+Getter for 2 * theta, summed over the pixels until reduce is called.
+*/
+double SXPeak::getTwoTheta() const { return m_twoTheta; }
+
+/**
+Getter for phi, summed over the pixels until reduce is called.
+*/
+double SXPeak::getPhi() const { return m_phi; }
+
 PeakContainer::PeakContainer(const HistogramData::HistogramY &y)
     : m_y(y), m_startIndex(0), m_stopIndex(m_y.size() - 1), m_maxIndex(0) {}
 
@@ -535,6 +558,103 @@ PeakList AllPeaksStrategy::convertToSXPeaks(
  * ------------------------------------------------------------------------------------------
  */
 
+namespace {
+/// The most cells either angle is divided into
+constexpr int64_t MAX_ANGLE_CELLS = 1 << 16;
+
+/**
+PeakGrid : buckets peaks into cells of (x, 2theta, phi) which are at least as
+wide as the tolerances of a compare strategy, so that the only peaks which can
+be alike to a peak are in its own cell or the neighbouring ones. The angles
+wrap around the circle as they do in the comparison.
+*/
+class PeakGrid {
+public:
+  explicit PeakGrid(const CompareTolerances &tolerances)
+      : m_tolerances(tolerances),
+        m_twoThetaCells(angleCells(tolerances.twoTheta)),
+        m_phiCells(angleCells(tolerances.phi)) {}
+
+  /// Add the peak with the given index
+  void insert(const SXPeak &peak, const size_t index) {
+    m_cells[key(peak)].push_back(index);
+  }
+
+  /// Remove the peak with the given index, before it is moved
+  void erase(const SXPeak &peak, const size_t index) {
+    auto &cell = m_cells[key(peak)];
+    cell.erase(std::remove(cell.begin(), cell.end(), index), cell.end());
+  }
+
+  /// @return the indices of the peaks around a peak in ascending order
+  std::vector<size_t> neighbours(const SXPeak &peak) const {
+    const auto centre = key(peak);
+    std::vector<size_t> indices;
+    for (const auto x : {centre[0] - 1, centre[0], centre[0] + 1}) {
+      for (const auto twoTheta : around(centre[1], m_twoThetaCells)) {
+        for (const auto phi : around(centre[2], m_phiCells)) {
+          const auto cell = m_cells.find({{x, twoTheta, phi}});
+          if (cell != m_cells.end()) {
+            indices.insert(indices.end(), cell->second.cbegin(),
+                           cell->second.cend());
+          }
+        }
+      }
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+  }
+
+private:
+  using Key = std::array<int64_t, 3>;
+  struct KeyHash {
+    size_t operator()(const Key &key) const {
+      return boost::hash_range(key.cbegin(), key.cend());
+    }
+  };
+
+  /// Divide the circle into cells which are at least as wide as the tolerance
+  static int64_t angleCells(const double tolerance) {
+    const auto maxCells = static_cast<double>(MAX_ANGLE_CELLS);
+    const auto cells =
+        tolerance > 0. ? std::min(std::floor(TWO_PI / tolerance), maxCells)
+                       : maxCells;
+    // With fewer than three cells every cell neighbours the others
+    return cells < 3. ? 1 : static_cast<int64_t>(cells);
+  }
+
+  static int64_t angleCell(const double angle, const int64_t nCells) {
+    auto wrapped = std::fmod(angle, TWO_PI);
+    if (wrapped < 0.) {
+      wrapped += TWO_PI;
+    }
+    const auto cell = static_cast<int64_t>(wrapped / TWO_PI * nCells);
+    return std::min(cell, nCells - 1);
+  }
+
+  static std::vector<int64_t> around(const int64_t cell,
+                                     const int64_t nCells) {
+    if (nCells == 1) {
+      return {0};
+    }
+    return {(cell + nCells - 1) % nCells, cell, (cell + 1) % nCells};
+  }
+
+  Key key(const SXPeak &peak) const {
+    const auto x = m_tolerances.units == XAxisUnit::TOF ? peak.getTOF()
+                                                        : peak.getDSpacing();
+    return {{static_cast<int64_t>(std::floor(x / m_tolerances.x)),
+             angleCell(peak.getTwoTheta(), m_twoThetaCells),
+             angleCell(peak.getPhi(), m_phiCells)}};
+  }
+
+  const CompareTolerances m_tolerances;
+  const int64_t m_twoThetaCells;
+  const int64_t m_phiCells;
+  std::unordered_map<Key, std::vector<size_t>, KeyHash> m_cells;
+};
+} // namespace
+
 ReducePeakListStrategy::ReducePeakListStrategy(
     const CompareStrategy *compareStrategy)
     : m_compareStrategy(compareStrategy) {}
@@ -552,6 +672,32 @@ std::vector<SXPeak> SimpleReduceStrategy::reduce(
   }
 
   std::vector<SXPeak> finalPeaks;
+  const auto tolerances = m_compareStrategy->getTolerances();
+  if (tolerances) {
+    // Only the final peaks around a peak can be alike to it. They are checked
+    // in the order of the scan below, so the same final peak takes it.
+    PeakGrid grid(*tolerances);
+    for (const auto &currentPeak : peaks) {
+      const auto candidates = grid.neighbours(currentPeak);
+      const auto alike = std::find_if(
+          candidates.cbegin(), candidates.cend(),
+          [&currentPeak, &finalPeaks, this](const size_t index) {
+            return m_compareStrategy->compare(currentPeak, finalPeaks[index]);
+          });
+      if (alike == candidates.cend()) {
+        grid.insert(currentPeak, finalPeaks.size());
+        finalPeaks.push_back(currentPeak);
+      } else {
+        // Adding the peak moves the final peak
+        auto &peak = finalPeaks[*alike];
+        grid.erase(peak, *alike);
+        peak += currentPeak;
+        grid.insert(peak, *alike);
+      }
+    }
+    return finalPeaks;
+  }
+
   for (const auto &currentPeak : peaks) {
     auto pos = std::find_if(finalPeaks.begin(), finalPeaks.end(),
                             [&currentPeak, this](SXPeak &peak) {
@@ -630,6 +776,13 @@ std::vector<std::vector<SXPeak *>> FindMaxReduceStrategy::getPeakGroups(
                         std::string(" peaks. Investigating peak number ");
   int peakCounter = 0;
 
+  // With absolute tolerances only the peaks around a peak need comparing
+  const auto tolerances = m_compareStrategy->getTolerances();
+  std::unique_ptr<PeakGrid> grid;
+  if (tolerances) {
+    grid = std::make_unique<PeakGrid>(*tolerances);
+  }
+
   for (auto peak : peaks) {
     ++peakCounter;
 
@@ -645,6 +798,16 @@ std::vector<std::vector<SXPeak *>> FindMaxReduceStrategy::getPeakGroups(
       progress.doReport(message + std::to_string(peakCounter));
     }
 
+    if (grid) {
+      for (const auto other : grid->neighbours(*peak)) {
+        if (m_compareStrategy->compare(*peak, *graph[other])) {
+          add_edge(vertex, other, graph);
+        }
+      }
+      grid->insert(*peak, vertex);
+      continue;
+    }
+
     for (; vertexIt != vertexEnd; ++vertexIt) {
       // 2.1 Check if we are looking at the new vertex itself. We don't want
       // self-loops
@@ -731,6 +894,15 @@ bool AbsoluteCompareStrategy::compare(const SXPeak &lhs,
                      m_twoThetaResolution, m_units);
 }
 
+boost::optional<CompareTolerances>
+AbsoluteCompareStrategy::getTolerances() const {
+  if (m_xUnitResolution <= 0.) {
+    return boost::none;
+  }
+  return CompareTolerances{m_xUnitResolution, m_twoThetaResolution,
+                           m_phiResolution, m_units};
+}
+
 } // namespace FindSXPeaksHelper
 } // namespace Crystal
 } // namespace Mantid
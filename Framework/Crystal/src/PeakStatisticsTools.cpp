@@ -9,9 +9,12 @@
 #include "MantidGeometry/Crystal/BasicHKLFilters.h"
 #include "MantidGeometry/Crystal/HKLGenerator.h"
 
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Statistics.h"
 
 #include <boost/make_shared.hpp>
+#include <cmath>
+#include <iterator>
 #include <numeric>
 
 namespace Mantid {
@@ -22,6 +25,61 @@ using namespace Mantid::DataObjects;
 using namespace Mantid::Geometry;
 using namespace Mantid::Kernel;
 
+namespace {
+/// The number of bits for each index of a packed HKL
+constexpr int KEY_BITS = 21;
+/// The offset that makes the packed indices positive
+constexpr int64_t KEY_OFFSET = int64_t(1) << (KEY_BITS - 1);
+/// The largest index taken, so that the equivalents of an HKL, which are
+/// sums of up to three indices, can still be packed
+constexpr int MAX_INDEX = KEY_OFFSET / 4;
+
+/// @return true and the HKL as integers if it is integral and small enough to
+/// be packed
+bool toIntegers(const V3D &hkl, std::array<int, 3> &indices) {
+  for (size_t i = 0; i < 3; ++i) {
+    if (hkl[i] != std::round(hkl[i]) || std::abs(hkl[i]) >= MAX_INDEX)
+      return false;
+    indices[i] = static_cast<int>(hkl[i]);
+  }
+  return true;
+}
+
+/// @return the key of an integer HKL for the index of reflections
+int64_t packHKL(const std::array<int, 3> &indices) {
+  return ((indices[0] + KEY_OFFSET) << (2 * KEY_BITS)) |
+         ((indices[1] + KEY_OFFSET) << KEY_BITS) | (indices[2] + KEY_OFFSET);
+}
+
+/// @return the largest of the HKLs equivalent to an integer HKL, as in
+/// PointGroup::getReflectionFamily
+std::array<int, 3>
+maximumEquivalent(const std::vector<std::array<int, 9>> &transformations,
+                  const std::array<int, 3> &hkl) {
+  // The identity is always one of the transformations
+  std::array<int, 3> family = hkl;
+  for (const auto &m : transformations) {
+    const std::array<int, 3> equivalent{
+        {m[0] * hkl[0] + m[1] * hkl[1] + m[2] * hkl[2],
+         m[3] * hkl[0] + m[4] * hkl[1] + m[5] * hkl[2],
+         m[6] * hkl[0] + m[7] * hkl[1] + m[8] * hkl[2]}};
+    if (family < equivalent)
+      family = equivalent;
+  }
+  return family;
+}
+
+/// The statistics of the observations of one unique reflection
+struct ReflectionStatistics {
+  std::vector<Peak> peaks;
+  double iOverSigmaSum = 0.0;
+  double relativeStandardDeviation = 0.0;
+  double sumOfDeviationsFromMean = 0.0;
+  double rPimNumerator = 0.0;
+  double intensitySum = 0.0;
+};
+} // namespace
+
 /// Returns a vector with the wavelengths of the Peaks stored in this
 /// reflection.
 std::vector<double> UniqueReflection::getWavelengths() const {
@@ -129,13 +187,34 @@ UniqueReflectionCollection::UniqueReflectionCollection(
       boost::make_shared<const HKLFilterCentering>(centering);
   auto filter = dFilter & centeringFilter;
 
+  setHKLTransformations();
+
   // Generate map of UniqueReflection-objects with reflection family as key.
   for (const auto &hkl : generator) {
     if (filter->isAllowed(hkl)) {
-      V3D hklFamily = m_pointgroup->getReflectionFamily(hkl);
+      V3D hklFamily = getFamily(hkl);
       m_reflections.emplace(hklFamily, UniqueReflection(hklFamily));
     }
   }
+  indexReflections();
+}
+
+UniqueReflectionCollection::UniqueReflectionCollection(
+    const UniqueReflectionCollection &other)
+    : m_reflections(other.m_reflections), m_pointgroup(other.m_pointgroup),
+      m_hklTransformations(other.m_hklTransformations) {
+  indexReflections();
+}
+
+UniqueReflectionCollection &UniqueReflectionCollection::
+operator=(const UniqueReflectionCollection &other) {
+  if (this != &other) {
+    m_reflections = other.m_reflections;
+    m_pointgroup = other.m_pointgroup;
+    m_hklTransformations = other.m_hklTransformations;
+    indexReflections();
+  }
+  return *this;
 }
 
 /// Assigns the supplied peaks to the proper UniqueReflection. Peaks for which
@@ -146,11 +225,12 @@ void UniqueReflectionCollection::addObservations(
     V3D hkl = peak.getHKL();
     hkl.round();
 
-    auto reflection =
-        m_reflections.find(m_pointgroup->getReflectionFamily(hkl));
-
-    if (reflection != m_reflections.end()) {
-      (*reflection).second.addPeak(peak);
+    int64_t key;
+    if (!getFamilyKey(hkl, key))
+      continue;
+    auto reflection = m_reflectionIndex.find(key);
+    if (reflection != m_reflectionIndex.end()) {
+      reflection->second->addPeak(peak);
     }
   }
 }
@@ -159,7 +239,13 @@ void UniqueReflectionCollection::addObservations(
 /// exception if the reflection is not found.
 UniqueReflection
 UniqueReflectionCollection::getReflection(const V3D &hkl) const {
-  return m_reflections.at(m_pointgroup->getReflectionFamily(hkl));
+  int64_t key;
+  if (getFamilyKey(hkl, key)) {
+    auto reflection = m_reflectionIndex.find(key);
+    if (reflection != m_reflectionIndex.end())
+      return *reflection->second;
+  }
+  throw std::out_of_range("Reflection " + hkl.toString() + " not found.");
 }
 
 /// Total number of unique reflections (theoretically possible).
@@ -210,6 +296,55 @@ UniqueReflectionCollection::getReflections() const {
   return m_reflections;
 }
 
+/// Takes the HKL transformation matrices of the point group's operations as
+/// integers.
+void UniqueReflectionCollection::setHKLTransformations() {
+  m_hklTransformations.clear();
+  for (const auto &operation : m_pointgroup->getSymmetryOperations()) {
+    std::array<int, 9> matrix;
+    for (size_t column = 0; column < 3; ++column) {
+      V3D unit;
+      unit[column] = 1.0;
+      const V3D transformed = operation.transformHKL(unit);
+      for (size_t row = 0; row < 3; ++row)
+        matrix[row * 3 + column] =
+            static_cast<int>(std::round(transformed[row]));
+    }
+    m_hklTransformations.push_back(matrix);
+  }
+}
+
+/// Indexes the reflections by the keys of their HKLs, which are families.
+void UniqueReflectionCollection::indexReflections() {
+  m_reflectionIndex.clear();
+  m_reflectionIndex.reserve(m_reflections.size());
+  for (auto &reflection : m_reflections) {
+    std::array<int, 3> indices;
+    if (toIntegers(reflection.first, indices))
+      m_reflectionIndex.emplace(packHKL(indices), &reflection.second);
+  }
+}
+
+/// Finds the key of the reflection family of an HKL. Returns false if the HKL
+/// is not integral or is too large to have a key.
+bool UniqueReflectionCollection::getFamilyKey(const V3D &hkl,
+                                              int64_t &key) const {
+  std::array<int, 3> indices;
+  if (!toIntegers(hkl, indices))
+    return false;
+  key = packHKL(maximumEquivalent(m_hklTransformations, indices));
+  return true;
+}
+
+/// Returns the reflection family of an HKL.
+V3D UniqueReflectionCollection::getFamily(const V3D &hkl) const {
+  std::array<int, 3> indices;
+  if (!toIntegers(hkl, indices))
+    return m_pointgroup->getReflectionFamily(hkl);
+  const auto family = maximumEquivalent(m_hklTransformations, indices);
+  return V3D(family[0], family[1], family[2]);
+}
+
 /**
  * @brief PeaksStatistics::calculatePeaksStatistics
  *
@@ -231,70 +366,90 @@ void PeaksStatistics::calculatePeaksStatistics(
     const std::map<V3D, UniqueReflection> &uniqueReflections,
     std::string &equivalentIntensities, double &sigmaCritical,
     bool &weightedZ) {
+  /* Since all possible unique reflections are explored
+   * there may be 0 observations for some of them.
+   * In that case, nothing can be done.*/
+  std::vector<const UniqueReflection *> observed;
+  for (const auto &unique : uniqueReflections) {
+    if (unique.second.count() > 0)
+      observed.push_back(&unique.second);
+  }
+  if (!observed.empty() && sigmaCritical <= 0.0) {
+    throw std::invalid_argument(
+        "Critical sigma value has to be greater than 0.");
+  }
+
+  // The statistics of each reflection are independent, and are summed in
+  // order afterwards so that the sums do not depend on the threads.
+  std::vector<ReflectionStatistics> statistics(observed.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(observed.size()); ++i) {
+    ReflectionStatistics &reflection = statistics[i];
+
+    // Possibly remove outliers.
+    auto outliersRemoved =
+        observed[i]->removeOutliers(sigmaCritical, weightedZ);
+
+    // I/sigma is calculated for all reflections, even if there is only one
+    // observation.
+    auto intensities = outliersRemoved.getIntensities();
+    auto sigmas = outliersRemoved.getSigmas();
+
+    // Accumulate the I/sigma's for current reflection into sum
+    reflection.iOverSigmaSum = getIOverSigmaSum(sigmas, intensities);
+
+    if (outliersRemoved.count() > 1) {
+      // Get mean, standard deviation for intensities
+      auto intensityStatistics = Kernel::getStatistics(
+          intensities, StatOptions::Mean | StatOptions::UncorrectedStdDev |
+                           StatOptions::Median);
+
+      double meanIntensity = intensityStatistics.mean;
+      if (equivalentIntensities == "Median")
+        meanIntensity = intensityStatistics.median;
+
+      /* This was in the original algorithm, not entirely sure where it is
+       * used. It's basically the sum of all relative standard deviations.
+       * In a perfect data set with all equivalent reflections exactly
+       * equivalent that would be 0. */
+      reflection.relativeStandardDeviation =
+          intensityStatistics.standard_deviation / meanIntensity;
+
+      // For both RMerge and RPim sum(|I - <I>|) is required
+      reflection.sumOfDeviationsFromMean =
+          std::accumulate(intensities.begin(), intensities.end(), 0.0,
+                          [meanIntensity](double sum, double intensity) {
+                            return sum + fabs(intensity - meanIntensity);
+                          });
+
+      // For Rpim, the sum is weighted by a factor depending on N
+      double rPimFactor =
+          sqrt(1.0 / (static_cast<double>(outliersRemoved.count()) - 1.0));
+      reflection.rPimNumerator =
+          rPimFactor * reflection.sumOfDeviationsFromMean;
+
+      // Collect sum of intensities for R-value calculation
+      reflection.intensitySum =
+          std::accumulate(intensities.begin(), intensities.end(), 0.0);
+    }
+
+    reflection.peaks = outliersRemoved.getPeaks();
+  }
+
   double rMergeNumerator = 0.0;
   double rPimNumerator = 0.0;
   double intensitySumRValues = 0.0;
   double iOverSigmaSum = 0.0;
-
-  for (const auto &unique : uniqueReflections) {
-    /* Since all possible unique reflections are explored
-     * there may be 0 observations for some of them.
-     * In that case, nothing can be done.*/
-    if (unique.second.count() > 0) {
-      ++m_uniqueReflections;
-
-      // Possibly remove outliers.
-      auto outliersRemoved =
-          unique.second.removeOutliers(sigmaCritical, weightedZ);
-
-      // I/sigma is calculated for all reflections, even if there is only one
-      // observation.
-      auto intensities = outliersRemoved.getIntensities();
-      auto sigmas = outliersRemoved.getSigmas();
-
-      // Accumulate the I/sigma's for current reflection into sum
-      iOverSigmaSum += getIOverSigmaSum(sigmas, intensities);
-
-      if (outliersRemoved.count() > 1) {
-        // Get mean, standard deviation for intensities
-        auto intensityStatistics = Kernel::getStatistics(
-            intensities, StatOptions::Mean | StatOptions::UncorrectedStdDev |
-                             StatOptions::Median);
-
-        double meanIntensity = intensityStatistics.mean;
-        if (equivalentIntensities == "Median")
-          meanIntensity = intensityStatistics.median;
-
-        /* This was in the original algorithm, not entirely sure where it is
-         * used. It's basically the sum of all relative standard deviations.
-         * In a perfect data set with all equivalent reflections exactly
-         * equivalent that would be 0. */
-        m_chiSquared += intensityStatistics.standard_deviation / meanIntensity;
-
-        // For both RMerge and RPim sum(|I - <I>|) is required
-        double sumOfDeviationsFromMean =
-            std::accumulate(intensities.begin(), intensities.end(), 0.0,
-                            [meanIntensity](double sum, double intensity) {
-                              return sum + fabs(intensity - meanIntensity);
-                            });
-
-        // Accumulate into total sum for numerator of RMerge
-        rMergeNumerator += sumOfDeviationsFromMean;
-
-        // For Rpim, the sum is weighted by a factor depending on N
-        double rPimFactor =
-            sqrt(1.0 / (static_cast<double>(outliersRemoved.count()) - 1.0));
-        rPimNumerator += (rPimFactor * sumOfDeviationsFromMean);
-
-        // Collect sum of intensities for R-value calculation
-        intensitySumRValues +=
-            std::accumulate(intensities.begin(), intensities.end(), 0.0);
-      }
-
-      const std::vector<Peak> &reflectionPeaks = outliersRemoved.getPeaks();
-      m_peaks.insert(m_peaks.end(), reflectionPeaks.begin(),
-                     reflectionPeaks.end());
-    }
+  m_uniqueReflections = static_cast<int>(observed.size());
+  for (auto &reflection : statistics) {
+    iOverSigmaSum += reflection.iOverSigmaSum;
+    m_chiSquared += reflection.relativeStandardDeviation;
+    rMergeNumerator += reflection.sumOfDeviationsFromMean;
+    rPimNumerator += reflection.rPimNumerator;
+    intensitySumRValues += reflection.intensitySum;
+    m_peaks.insert(m_peaks.end(),
+                   std::make_move_iterator(reflection.peaks.begin()),
+                   std::make_move_iterator(reflection.peaks.end()));
   }
 
   m_measuredReflections = static_cast<int>(m_peaks.size());
@@ -14,6 +14,7 @@
 #include "MantidGeometry/Crystal/HKLFilterWavelength.h"
 #include "MantidGeometry/Crystal/HKLGenerator.h"
 #include "MantidGeometry/Crystal/StructureFactorCalculatorSummation.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/Instrument/Goniometer.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
@@ -23,6 +24,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <fstream>
 using Mantid::Kernel::EnabledWhenProperty;
@@ -48,12 +50,136 @@ double get_factor_for_q_convention(const std::string &convention) {
 
   return 1.0;
 }
+
+/// The number of HKLs checked in parallel, over several goniometer settings
+constexpr size_t MAX_CANDIDATES = 1 << 24;
+
+/// What is known of an HKL at a goniometer setting before searching for its
+/// detector
+enum Candidate : char { NotAllowed, Allowed, ToSearch };
+
+/// The bins of the scattering angle in the detector coverage
+constexpr long NUMBER_OF_THETA_BINS = 360;
+/// The bins of the azimuthal angle in the detector coverage
+constexpr long NUMBER_OF_PHI_BINS = 2 * NUMBER_OF_THETA_BINS;
+/// The width of the bins of the detector coverage, in radians
+constexpr double BIN_WIDTH = M_PI / NUMBER_OF_THETA_BINS;
+
+/**
+ * The directions from the sample in which there are detectors, on a grid of
+ * scattering and azimuthal angles. Each detector covers the cells within its
+ * angular size, plus a margin, so a diffracted beam outside the coverage
+ * cannot hit a detector and need not be searched for.
+ */
+class DetectorCoverage {
+public:
+  /**
+   * @param detectorInfo :: The detectors
+   * @param componentInfo :: The shapes of the detectors
+   * @param frame :: The reference frame of the instrument
+   * @param margin :: An angle, in radians, to widen the coverage by
+   */
+  DetectorCoverage(const DetectorInfo &detectorInfo,
+                   const ComponentInfo &componentInfo,
+                   const ReferenceFrame &frame, const double margin)
+      : m_beam(frame.vecPointingAlongBeam()), m_up(frame.vecPointingUp()),
+        m_horizontal(m_up.cross_prod(m_beam)),
+        m_covered(NUMBER_OF_THETA_BINS * NUMBER_OF_PHI_BINS, false) {
+    const auto samplePos = detectorInfo.samplePosition();
+    for (size_t i = 0; i < detectorInfo.size(); ++i) {
+      if (detectorInfo.isMonitor(i) || detectorInfo.isMasked(i))
+        continue;
+      const auto toDetector = detectorInfo.position(i) - samplePos;
+      const auto distance = toDetector.norm();
+      if (distance == 0.)
+        continue;
+      double radius = 0.;
+      if (componentInfo.hasValidShape(i)) {
+        const auto &box = componentInfo.shape(i).getBoundingBox();
+        const auto scale = componentInfo.scaleFactor(i);
+        const double maxScale = std::max(
+            {std::abs(scale.X()), std::abs(scale.Y()), std::abs(scale.Z())});
+        radius = 0.5 * maxScale *
+                 V3D(box.xMax() - box.xMin(), box.yMax() - box.yMin(),
+                     box.zMax() - box.zMin())
+                     .norm();
+      }
+      const double angularSize =
+          radius >= distance ? M_PI : std::asin(radius / distance);
+      cover(toDetector / distance, angularSize + margin + BIN_WIDTH);
+    }
+  }
+
+  /// @return whether there may be a detector in the unit direction
+  bool covers(const V3D &direction) const {
+    if (!std::isfinite(direction.norm2()))
+      return false;
+    const double theta = thetaOf(direction);
+    return m_covered[static_cast<size_t>(thetaBin(theta) * NUMBER_OF_PHI_BINS +
+                                         phiBin(phiOf(direction)))];
+  }
+
+private:
+  double thetaOf(const V3D &direction) const {
+    return std::acos(
+        std::max(-1., std::min(1., direction.scalar_prod(m_beam))));
+  }
+
+  double phiOf(const V3D &direction) const {
+    return std::atan2(direction.scalar_prod(m_up),
+                      direction.scalar_prod(m_horizontal));
+  }
+
+  static long thetaBin(const double theta) {
+    const auto bin = static_cast<long>(std::floor(theta / BIN_WIDTH));
+    return std::max(0L, std::min(bin, NUMBER_OF_THETA_BINS - 1));
+  }
+
+  /// @return the bin of an azimuthal angle, wrapped around
+  static long phiBin(const double phi) {
+    return wrapPhiBin(static_cast<long>(std::floor((phi + M_PI) / BIN_WIDTH)));
+  }
+
+  static long wrapPhiBin(const long bin) {
+    return ((bin % NUMBER_OF_PHI_BINS) + NUMBER_OF_PHI_BINS) %
+           NUMBER_OF_PHI_BINS;
+  }
+
+  /// Cover the cells within an angle of a unit direction
+  void cover(const V3D &direction, const double angle) {
+    const double theta = thetaOf(direction);
+    const double thetaMin = std::max(0., theta - angle);
+    const double thetaMax = std::min(M_PI, theta + angle);
+    // The azimuthal extent of the cells to cover grows towards the beam axis
+    const double sinTheta = std::min(std::sin(thetaMin), std::sin(thetaMax));
+    long phiBins = NUMBER_OF_PHI_BINS;
+    if (angle < M_PI / 2 && sinTheta > std::sin(angle))
+      phiBins = static_cast<long>(
+          std::ceil(std::asin(std::sin(angle) / sinTheta) / BIN_WIDTH));
+    const auto centre = phiBin(phiOf(direction));
+    for (auto t = thetaBin(thetaMin); t <= thetaBin(thetaMax); ++t) {
+      const auto row = m_covered.begin() + t * NUMBER_OF_PHI_BINS;
+      if (2 * phiBins + 1 >= NUMBER_OF_PHI_BINS) {
+        std::fill(row, row + NUMBER_OF_PHI_BINS, true);
+        continue;
+      }
+      for (auto p = centre - phiBins; p <= centre + phiBins; ++p)
+        row[wrapPhiBin(p)] = true;
+    }
+  }
+
+  const V3D m_beam;
+  const V3D m_up;
+  const V3D m_horizontal;
+  std::vector<bool> m_covered;
+};
 } // namespace
 
 /** Constructor
  */
 PredictPeaks::PredictPeaks()
-    : m_runNumber(-1), m_inst(), m_pw(), m_sfCalculator(),
+    : m_useExtendedDetectorSpace(false), m_runNumber(-1), m_inst(), m_pw(),
+      m_sfCalculator(),
       m_qConventionFactor(get_factor_for_q_convention(
           ConfigService::Instance().getString("Q.convention"))) {
   m_refConds = getAllReflectionConditions();
@@ -301,6 +427,8 @@ void PredictPeaks::exec() {
   m_detectorCacheSearch =
       std::make_unique<DetectorSearcher>(m_inst, m_pw->detectorInfo());
 
+  m_useExtendedDetectorSpace = getProperty("PredictPeaksOutsideDetectors");
+
   if (getProperty("CalculateGoniometerForCW")) {
     size_t allowedPeakCount = 0;
 
@@ -339,33 +467,72 @@ void PredictPeaks::exec() {
     logNumberOfPeaksFound(allowedPeakCount);
 
   } else {
-    for (auto &goniometerMatrix : gonioVec) {
-      // Final transformation matrix (HKL to Q in lab frame)
-      DblMatrix orientedUB = goniometerMatrix * ub;
-
-      /* Because of the additional filtering step it's better to keep track of
-       * the allowed peaks with a counter. */
-      HKLFilterWavelength lambdaFilter(orientedUB, lambdaMin, lambdaMax);
-
-      size_t allowedPeakCount = 0;
-
-      bool useExtendedDetectorSpace =
-          getProperty("PredictPeaksOutsideDetectors");
-      if (useExtendedDetectorSpace &&
-          !m_inst->getComponentByName("extended-detector-space")) {
-        g_log.warning() << "Attempting to find peaks outside of detectors but "
-                           "no extended detector space has been defined\n";
+    if (m_useExtendedDetectorSpace &&
+        !m_inst->getComponentByName("extended-detector-space")) {
+      g_log.warning() << "Attempting to find peaks outside of detectors but "
+                         "no extended detector space has been defined\n";
+    }
+
+    // Only the HKLs whose diffracted beams may hit a detector are searched
+    // for, unless peaks are also predicted outside the detectors
+    std::unique_ptr<DetectorCoverage> coverage;
+    if (!m_useExtendedDetectorSpace) {
+      const auto gaps = m_inst->getNumberParameter("tube-gap", true);
+      coverage = std::make_unique<DetectorCoverage>(
+          m_pw->detectorInfo(), m_pw->componentInfo(), *m_refFrame,
+          gaps.empty() ? 0. : gaps.front());
+    }
+
+    // The HKLs are checked in parallel for batches of goniometer settings,
+    // then searched for in order so that the peaks are added in order
+    const size_t numberOfHKLs = possibleHKLs.size();
+    const size_t batchSize =
+        std::max<size_t>(1, MAX_CANDIDATES / std::max<size_t>(1, numberOfHKLs));
+    std::vector<Candidate> candidates;
+    for (size_t first = 0; first < gonioVec.size(); first += batchSize) {
+      const size_t last = std::min(first + batchSize, gonioVec.size());
+      // Final transformation matrices (HKL to Q in lab frame)
+      std::vector<DblMatrix> orientedUBs;
+      std::vector<HKLFilterWavelength> lambdaFilters;
+      for (size_t i = first; i < last; ++i) {
+        orientedUBs.emplace_back(gonioVec[i] * ub);
+        lambdaFilters.emplace_back(orientedUBs.back(), lambdaMin, lambdaMax);
       }
 
-      for (auto &possibleHKL : possibleHKLs) {
-        if (lambdaFilter.isAllowed(possibleHKL)) {
-          calculateQAndAddToOutput(possibleHKL, orientedUB, goniometerMatrix);
-          ++allowedPeakCount;
+      candidates.assign((last - first) * numberOfHKLs, NotAllowed);
+      const auto numberOfCandidates = static_cast<int64_t>(candidates.size());
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t i = 0; i < numberOfCandidates; ++i) {
+        const auto setting = static_cast<size_t>(i) / numberOfHKLs;
+        const auto &hkl = possibleHKLs[static_cast<size_t>(i) % numberOfHKLs];
+        if (!lambdaFilters[setting].isAllowed(hkl))
+          continue;
+        candidates[i] = ToSearch;
+        if (coverage) {
+          const auto q =
+              orientedUBs[setting] * hkl * (2.0 * M_PI * m_qConventionFactor);
+          if (!coverage->covers(std::get<0>(getPeakParametersFromQ(q))))
+            candidates[i] = Allowed;
         }
-        prog.report();
       }
 
-      logNumberOfPeaksFound(allowedPeakCount);
+      for (size_t setting = 0; setting < last - first; ++setting) {
+        /* Because of the additional filtering step it's better to keep track
+         * of the allowed peaks with a counter. */
+        size_t allowedPeakCount = 0;
+        const auto candidate = candidates.cbegin() + setting * numberOfHKLs;
+        for (size_t i = 0; i < numberOfHKLs; ++i) {
+          if (candidate[i] == NotAllowed)
+            continue;
+          ++allowedPeakCount;
+          if (candidate[i] == ToSearch)
+            calculateQAndAddToOutput(possibleHKLs[i], orientedUBs[setting],
+                                     gonioVec[first + setting]);
+        }
+        prog.reportIncrement(numberOfHKLs);
+
+        logNumberOfPeaksFound(allowedPeakCount);
+      }
     }
   }
 
@@ -389,8 +556,6 @@ void PredictPeaks::exec() {
  * @param allowedPeakCount :: number of candidate peaks found
  */
 void PredictPeaks::logNumberOfPeaksFound(size_t allowedPeakCount) const {
-  const bool usingExtendedDetectorSpace =
-      getProperty("PredictPeaksOutsideDetectors");
   const auto &peaks = m_pw->getPeaks();
   size_t offDetectorPeakCount = 0;
   size_t onDetectorPeakCount = 0;
@@ -407,7 +572,7 @@ void PredictPeaks::logNumberOfPeaksFound(size_t allowedPeakCount) const {
                  << " allowed peaks within parameters, " << onDetectorPeakCount
                  << " were found to hit a detector";
 
-  if (usingExtendedDetectorSpace) {
+  if (m_useExtendedDetectorSpace) {
     g_log.notice() << " and " << offDetectorPeakCount << " were found in "
                    << "extended detector space.";
   }
@@ -574,13 +739,11 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl,
   const auto detectorDir = std::get<0>(params);
   const auto wl = std::get<1>(params);
 
-  const bool useExtendedDetectorSpace =
-      getProperty("PredictPeaksOutsideDetectors");
   const auto result = m_detectorCacheSearch->findDetectorIndex(q);
   const auto hitDetector = std::get<0>(result);
   const auto index = std::get<1>(result);
 
-  if (!hitDetector && !useExtendedDetectorSpace) {
+  if (!hitDetector && !m_useExtendedDetectorSpace) {
     return;
   }
 
@@ -594,7 +757,7 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl,
     if (!peak->getDetector())
       return;
 
-  } else if (useExtendedDetectorSpace) {
+  } else if (m_useExtendedDetectorSpace) {
     // use extended detector space to try and guess peak position
     const auto returnedComponent =
         m_inst->getComponentByName("extended-detector-space");
@@ -638,6 +638,10 @@ void SCDCalibratePanels::findL2(boost::container::flat_set<string> MyBankNames,
   bool changeSize = getProperty("ChangePanelSize");
   Geometry::Instrument_const_sptr inst = peaksWs->getInstrument();
 
+  // The banks are fitted in parallel, each to a copy of its peaks, and are
+  // only moved once all the fits are done. Banks that are skipped have no
+  // moves.
+  std::vector<std::vector<double>> bankMoves(MyBankNames.size());
   PARALLEL_FOR_IF(Kernel::threadSafe(*peaksWs))
   for (int i = 0; i < static_cast<int>(MyBankNames.size()); ++i) {
     PARALLEL_START_INTERUPT_REGION
@@ -767,12 +771,21 @@ void SCDCalibratePanels::findL2(boost::container::flat_set<string> MyBankNames,
       scaleHeight = paramsWS->getRef<double>("Value", 7);
     }
     AnalysisDataService::Instance().remove(bankName);
-    SCDPanelErrors det;
-    det.moveDetector(xShift, yShift, zShift, xRotate, yRotate, zRotate,
-                     scaleWidth, scaleHeight, iBank, peaksWs);
+    bankMoves[i] = {xShift,  yShift,  zShift,     xRotate,
+                    yRotate, zRotate, scaleWidth, scaleHeight};
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
+
+  auto bankName = MyBankNames.begin();
+  for (const auto &move : bankMoves) {
+    if (!move.empty()) {
+      SCDPanelErrors det;
+      det.moveDetector(move[0], move[1], move[2], move[3], move[4], move[5],
+                       move[6], move[7], *bankName, peaksWs);
+    }
+    ++bankName;
+  }
 }
 } // namespace Crystal
 } // namespace Mantid
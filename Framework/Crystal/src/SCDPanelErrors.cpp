@@ -16,9 +16,14 @@
 #include "MantidGeometry/Crystal/OrientedLattice.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/Component.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/FileValidator.h"
+#include "MantidKernel/Unit.h"
 #include <algorithm>
+#include <array>
 #include <boost/math/special_functions/round.hpp>
 #include <cmath>
 #include <fstream>
@@ -36,6 +41,19 @@ using namespace API;
 namespace {
 /// static logger
 Logger g_log("SCDPanelErrors");
+
+/// The penalty for each component of the error of an unindexed peak,
+/// greater than the indexing tolerance
+constexpr double UNINDEXED_PENALTY = 0.15;
+
+/// @return the name of the component moved for a detector name.
+/// CORELLI has sixteenpack under bank.
+std::string componentToMove(const Geometry::Instrument &inst,
+                            std::string detname) {
+  if (inst.getName().compare("CORELLI") == 0.0 && detname != "moderator")
+    detname.append("/sixteenpack");
+  return detname;
+}
 } // namespace
 
 DECLARE_FUNCTION(SCDPanelErrors)
@@ -77,13 +95,11 @@ void SCDPanelErrors::moveDetector(double x, double y, double z, double rotx,
                                   Workspace_sptr inputW) const {
   if (detname.compare("none") == 0.0)
     return;
-  // CORELLI has sixteenpack under bank
   DataObjects::PeaksWorkspace_sptr inputP =
       boost::dynamic_pointer_cast<DataObjects::PeaksWorkspace>(inputW);
   Geometry::Instrument_sptr inst =
       boost::const_pointer_cast<Geometry::Instrument>(inputP->getInstrument());
-  if (inst->getName().compare("CORELLI") == 0.0 && detname != "moderator")
-    detname.append("/sixteenpack");
+  detname = componentToMove(*inst, detname);
 
   if (x != 0.0 || y != 0.0 || z != 0.0) {
     IAlgorithm_sptr alg1 = Mantid::API::AlgorithmFactory::Instance().create(
@@ -171,60 +187,135 @@ void SCDPanelErrors::moveDetector(double x, double y, double z, double rotx,
   }
 }
 
-/// Evaluate the function for a list of arguments and given scaling factor
-void SCDPanelErrors::eval(double xshift, double yshift, double zshift,
-                          double xrotate, double yrotate, double zrotate,
-                          double scalex, double scaley, double *out,
-                          const double *xValues, const size_t nData,
-                          double tShift) const {
-  UNUSED_ARG(xValues);
+/**
+ * Evaluate the errors between the Q of the peaks, with the panel moved by the
+ * parameters, and the Q of their HKLs, in the same way as moveDetector would
+ * move the panel. The panel is shifted, then rotated in its own frame about
+ * X, Y and Z in turn, then scaled.
+ * @param out :: The three errors of each peak
+ * @param jacobian :: The derivatives of the errors over the parameters, or
+ * null if they are not needed
+ * @param nData :: The number of errors
+ */
+void SCDPanelErrors::eval(double *out, API::Jacobian *jacobian,
+                          const size_t nData) const {
   if (nData == 0)
     return;
 
   setupData();
 
-  boost::shared_ptr<API::Workspace> cloned = m_workspace->clone();
-  moveDetector(xshift, yshift, zshift, xrotate, yrotate, zrotate, scalex,
-               scaley, m_bank, cloned);
+  const V3D shift(getParameter("XShift"), getParameter("YShift"),
+                  getParameter("ZShift"));
+  const Quat rotateX(getParameter("XRotate"), V3D(1, 0, 0));
+  const Quat rotateY(getParameter("YRotate"), V3D(0, 1, 0));
+  const Quat rotateZ(getParameter("ZRotate"), V3D(0, 0, 1));
+  // The rotations applied after each of the X, Y and Z rotations
+  const Quat afterX = m_panelRotation * rotateX;
+  const Quat afterY = afterX * rotateY;
+  const Quat afterZ = afterY * rotateZ;
+  const double scaleWidth = getParameter("ScaleWidth");
+  const double scaleHeight = getParameter("ScaleHeight");
+  const bool scaled = m_scalable && (scaleWidth != 1.0 || scaleHeight != 1.0);
+  const double tShift = getParameter("T0Shift");
+  const V3D sourcePosition =
+      m_movesSource ? m_sourcePosition + shift : m_sourcePosition;
+  const double degrees = M_PI / 180.0;
+
+  const size_t nPeaks = std::min(m_peaks.size(), nData / 3);
+  for (size_t i = 0; i < nPeaks; ++i) {
+    const PeakGeometry &peak = m_peaks[i];
+    if (!peak.indexed) {
+      for (size_t j = 0; j < 3; ++j) {
+        out[i * 3 + j] = UNINDEXED_PENALTY;
+        if (jacobian)
+          for (size_t k = 0; k < nParams(); ++k)
+            jacobian->set(i * 3 + j, k, 0.0);
+      }
+      continue;
+    }
+
+    // The detector position and its derivatives over the parameters
+    V3D detectorPosition = peak.position;
+    std::array<V3D, 9> positionDerivs;
+    if (peak.onPanel) {
+      V3D scaledPosition = peak.position;
+      if (scaled) {
+        scaledPosition[0] *= scaleWidth / m_scaleX;
+        scaledPosition[1] *= scaleHeight / m_scaleY;
+      }
+      V3D afterZPosition = scaledPosition;
+      rotateZ.rotate(afterZPosition);
+      V3D afterYPosition = afterZPosition;
+      rotateY.rotate(afterYPosition);
+      detectorPosition = afterYPosition;
+      afterX.rotate(detectorPosition);
+      detectorPosition += m_panelPosition + shift;
+
+      if (jacobian) {
+        for (size_t k = 0; k < 3; ++k)
+          positionDerivs[k][k] = 1.0;
+        positionDerivs[3] = V3D(1, 0, 0).cross_prod(afterYPosition) * degrees;
+        afterX.rotate(positionDerivs[3]);
+        positionDerivs[4] = V3D(0, 1, 0).cross_prod(afterZPosition) * degrees;
+        afterY.rotate(positionDerivs[4]);
+        positionDerivs[5] = V3D(0, 0, 1).cross_prod(scaledPosition) * degrees;
+        afterZ.rotate(positionDerivs[5]);
+        if (m_scalable) {
+          positionDerivs[6] = V3D(peak.position[0] / m_scaleX, 0, 0);
+          afterZ.rotate(positionDerivs[6]);
+          positionDerivs[7] = V3D(0, peak.position[1] / m_scaleY, 0);
+          afterZ.rotate(positionDerivs[7]);
+        }
+      }
+    }
 
-  auto inputP =
-      boost::dynamic_pointer_cast<DataObjects::PeaksWorkspace>(cloned);
-  IAlgorithm_sptr alg =
-      Mantid::API::AlgorithmFactory::Instance().create("IndexPeaks", -1);
-  alg->initialize();
-  alg->setChild(true);
-  alg->setLogging(false);
-  alg->setProperty("PeaksWorkspace", inputP);
-  alg->setProperty("Tolerance", 0.15);
-  alg->execute();
-  auto inst = inputP->getInstrument();
-  Geometry::OrientedLattice lattice =
-      inputP->mutableSample().getOrientedLattice();
-  for (int i = 0; i < inputP->getNumberPeaks(); i++) {
-    const DataObjects::Peak &peak = inputP->getPeak(i);
-    V3D hkl =
-        V3D(boost::math::iround(peak.getH()), boost::math::iround(peak.getK()),
-            boost::math::iround(peak.getL()));
-    V3D Q2 = lattice.qFromHKL(hkl);
-    try {
-      if (hkl == V3D(0, 0, 0))
-        throw std::runtime_error("unindexed peak");
-      DataObjects::Peak peak2(inst, peak.getDetectorID(), peak.getWavelength(),
-                              hkl, peak.getGoniometerMatrix());
-      Units::Wavelength wl;
-
-      wl.initialize(peak2.getL1(), peak2.getL2(), peak2.getScattering(), 0,
-                    peak2.getInitialEnergy(), 0.0);
-      peak2.setWavelength(wl.singleFromTOF(peak.getTOF() + tShift));
-      V3D Q3 = peak2.getQSampleFrame();
-      out[i * 3] = Q3[0] - Q2[0];
-      out[i * 3 + 1] = Q3[1] - Q2[1];
-      out[i * 3 + 2] = Q3[2] - Q2[2];
-    } catch (std::runtime_error &) {
-      // set penalty for unindexed peaks greater than tolerance
-      out[i * 3] = 0.15;
-      out[i * 3 + 1] = 0.15;
-      out[i * 3 + 2] = 0.15;
+    V3D beamDir = m_samplePosition - sourcePosition;
+    const double l1 = beamDir.norm();
+    beamDir /= l1;
+    V3D detectorDir = detectorPosition - m_samplePosition;
+    const double l2 = detectorDir.norm();
+    detectorDir /= l2;
+    Units::Wavelength wl;
+    wl.initialize(l1, l2, 0.0, 0, 0.0, 0.0);
+    const double tof = peak.tof + tShift;
+    // |Q| = 2 pi / wavelength, as in Peak::getQLabFrame
+    const double wavevector = 2.0 * M_PI / wl.singleFromTOF(tof);
+    const V3D qDir = beamDir - detectorDir;
+    const V3D qLab = qDir * (wavevector * m_qSign);
+    const V3D error = peak.inverseGoniometer * qLab - peak.qHKL;
+    for (size_t j = 0; j < 3; ++j)
+      out[i * 3 + j] = error[j];
+
+    if (!jacobian)
+      continue;
+    // The wavevector is proportional to (L1 + L2) / TOF
+    const double dWavevectorByLength = wavevector / (l1 + l2);
+    std::array<V3D, 9> qLabDerivs;
+    if (peak.onPanel) {
+      for (size_t k = 0; k < 8; ++k) {
+        const V3D &dPosition = positionDerivs[k];
+        const double dL2 = detectorDir.scalar_prod(dPosition);
+        const V3D dDetectorDir = (dPosition - detectorDir * dL2) / l2;
+        qLabDerivs[k] =
+            (qDir * (dWavevectorByLength * dL2) - dDetectorDir * wavevector) *
+            m_qSign;
+      }
+    } else if (m_movesSource) {
+      for (size_t k = 0; k < 3; ++k) {
+        V3D dSource;
+        dSource[k] = 1.0;
+        const double dL1 = -beamDir.scalar_prod(dSource);
+        const V3D dBeamDir = (beamDir * dL1 + dSource) / -l1;
+        qLabDerivs[k] =
+            (qDir * (dWavevectorByLength * dL1) + dBeamDir * wavevector) *
+            m_qSign;
+      }
+    }
+    qLabDerivs[8] = qDir * (-wavevector / tof * m_qSign);
+    for (size_t k = 0; k < 9; ++k) {
+      const V3D dError = peak.inverseGoniometer * qLabDerivs[k];
+      for (size_t j = 0; j < 3; ++j)
+        jacobian->set(i * 3 + j, k, dError[j]);
     }
   }
 }
@@ -237,17 +328,8 @@ void SCDPanelErrors::eval(double xshift, double yshift, double zshift,
  */
 void SCDPanelErrors::function1D(double *out, const double *xValues,
                                 const size_t nData) const {
-  const double xshift = getParameter("XShift");
-  const double yshift = getParameter("YShift");
-  const double zshift = getParameter("ZShift");
-  const double xrotate = getParameter("XRotate");
-  const double yrotate = getParameter("YRotate");
-  const double zrotate = getParameter("ZRotate");
-  const double scalex = getParameter("ScaleWidth");
-  const double scaley = getParameter("ScaleHeight");
-  const double tShift = getParameter("T0Shift");
-  eval(xshift, yshift, zshift, xrotate, yrotate, zrotate, scalex, scaley, out,
-       xValues, nData, tShift);
+  UNUSED_ARG(xValues);
+  eval(out, nullptr, nData);
 }
 
 /**
@@ -259,8 +341,9 @@ void SCDPanelErrors::function1D(double *out, const double *xValues,
  */
 void SCDPanelErrors::functionDeriv1D(API::Jacobian *out, const double *xValues,
                                      const size_t nData) {
-  FunctionDomain1DView domain(xValues, nData);
-  this->calNumericalDeriv(domain, *out);
+  UNUSED_ARG(xValues);
+  std::vector<double> values(nData);
+  eval(values.data(), out, nData);
 }
 
 /// Clear all data
@@ -366,6 +449,102 @@ void SCDPanelErrors::setupData() const {
   g_log.debug() << "Setting up " << m_workspace->getName() << " bank " << m_bank
                 << '\n';
 
+  auto peaksWS =
+      boost::dynamic_pointer_cast<DataObjects::PeaksWorkspace>(m_workspace);
+  if (!peaksWS)
+    throw std::invalid_argument("Workspace of " + this->name() +
+                                " is not a PeaksWorkspace");
+  // Moving the panel does not move the peaks, so they are indexed only once
+  DataObjects::PeaksWorkspace_sptr indexed = peaksWS->clone();
+  IAlgorithm_sptr alg =
+      Mantid::API::AlgorithmFactory::Instance().create("IndexPeaks", -1);
+  alg->initialize();
+  alg->setChild(true);
+  alg->setLogging(false);
+  alg->setProperty("PeaksWorkspace", indexed);
+  alg->setProperty("Tolerance", UNINDEXED_PENALTY);
+  alg->execute();
+
+  const auto &componentInfo = indexed->componentInfo();
+  const auto &detectorInfo = indexed->detectorInfo();
+  m_sourcePosition = componentInfo.sourcePosition();
+  m_samplePosition = componentInfo.samplePosition();
+  m_qSign =
+      ConfigService::Instance().getString("Q.convention") == "Crystallography"
+          ? -1.0
+          : 1.0;
+
+  // The panel moved by the parameters, if any
+  m_movesSource = false;
+  m_scalable = false;
+  bool movesPanel = false;
+  size_t panelIndex = 0;
+  if (m_bank != "none") {
+    auto inst = indexed->getInstrument();
+    const auto panelName = componentToMove(*inst, m_bank);
+    auto panel = inst->getComponentByName(panelName);
+    if (!panel)
+      throw std::invalid_argument("Component with name " + panelName +
+                                  " was not found.");
+    panelIndex = componentInfo.indexOf(panel->getComponentID());
+    m_movesSource =
+        componentInfo.hasSource() && panelIndex == componentInfo.source();
+    movesPanel = !m_movesSource;
+    m_panelPosition = componentInfo.position(panelIndex);
+    m_panelRotation = componentInfo.rotation(panelIndex);
+    auto rectDet =
+        boost::dynamic_pointer_cast<const Geometry::RectangularDetector>(
+            panel);
+    if (rectDet) {
+      m_scalable = true;
+      const auto &pmap = indexed->constInstrumentParameters();
+      auto scalex = pmap.getDouble(rectDet->getName(), "scalex");
+      auto scaley = pmap.getDouble(rectDet->getName(), "scaley");
+      m_scaleX = scalex.empty() ? 1.0 : scalex[0];
+      m_scaleY = scaley.empty() ? 1.0 : scaley[0];
+    }
+  }
+  Quat inversePanelRotation = m_panelRotation;
+  inversePanelRotation.inverse();
+
+  const auto &lattice = indexed->sample().getOrientedLattice();
+  const int nPeaks = indexed->getNumberPeaks();
+  m_peaks.assign(nPeaks, PeakGeometry());
+  for (int i = 0; i < nPeaks; ++i) {
+    const DataObjects::Peak &peak = indexed->getPeak(i);
+    PeakGeometry &geometry = m_peaks[i];
+    const V3D hkl(boost::math::iround(peak.getH()),
+                  boost::math::iround(peak.getK()),
+                  boost::math::iround(peak.getL()));
+    size_t detectorIndex;
+    try {
+      detectorIndex = detectorInfo.indexOf(peak.getDetectorID());
+    } catch (std::out_of_range &) {
+      geometry.indexed = false;
+      continue;
+    }
+    geometry.indexed = hkl != V3D(0, 0, 0);
+    geometry.qHKL = lattice.qFromHKL(hkl);
+    geometry.tof = peak.getTOF();
+    geometry.inverseGoniometer = peak.getGoniometerMatrix();
+    geometry.inverseGoniometer.Invert();
+    geometry.position = detectorInfo.position(detectorIndex);
+
+    // Is the detector in the panel?
+    geometry.onPanel = false;
+    size_t index = detectorIndex;
+    while (movesPanel && !geometry.onPanel) {
+      geometry.onPanel = index == panelIndex;
+      if (!componentInfo.hasParent(index))
+        break;
+      index = componentInfo.parent(index);
+    }
+    if (geometry.onPanel) {
+      geometry.position -= m_panelPosition;
+      inversePanelRotation.rotate(geometry.position);
+    }
+  }
+
   m_setupFinished = true;
 }
 
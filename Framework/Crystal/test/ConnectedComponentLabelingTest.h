@@ -551,6 +551,24 @@ public:
     do_test_3d_with_many_objects(2 /*N threads*/);
   }
 
+  void test_3d_object_spanning_many_threads() {
+    const double raisedSignal = 1;
+    // Every element is part of the one object, which each thread sees part of
+    IMDHistoWorkspace_sptr inWS =
+        MDEventsTestHelper::makeFakeMDHistoWorkspace(raisedSignal, 3, 10);
+
+    HardThresholdBackground strategy(0, NoNormalization);
+    size_t labelingId = 1;
+    ConnectedComponentLabeling ccl(labelingId, 8);
+    Progress prog;
+    auto outWS = ccl.execute(inWS, &strategy, prog);
+
+    auto uniqueEntries = connection_workspace_to_set_of_labels(outWS.get());
+    TSM_ASSERT_EQUALS("Just one object", 1, uniqueEntries.size());
+    TSM_ASSERT("Labelled with the minimum label",
+               does_set_contain(uniqueEntries, labelingId));
+  }
+
   void do_test_brige_link_schenario(int nThreads) // Regression test
   {
 
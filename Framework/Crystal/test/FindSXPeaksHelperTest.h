@@ -283,6 +283,54 @@ public:
     TS_ASSERT(Mock::VerifyAndClearExpectations(&progress));
   }
 
+  void testThatReduceStrategiesFindAlikePeaksWithAbsoluteTolerances() {
+    // GIVEN
+    auto workspace =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(10, 10);
+    const auto &spectrumInfo = workspace->spectrumInfo();
+
+    const double degreeToRad = M_PI / 180.;
+    auto compareStrategy =
+        std::make_unique<AbsoluteCompareStrategy>(1., 1., 1.);
+
+    // The first two peaks are alike across the wrap around of phi
+    std::vector<SXPeak> peaks;
+    peaks.emplace_back(100 /*TOF*/, -179.9 * degreeToRad /*phi*/,
+                       0.1 /*intensity*/, std::vector<int>(1, 1), 1,
+                       spectrumInfo);
+    peaks.emplace_back(100.5 /*TOF*/, 179.9 * degreeToRad /*phi*/,
+                       0.2 /*intensity*/, std::vector<int>(1, 1), 1,
+                       spectrumInfo);
+    peaks.emplace_back(100 /*TOF*/, 90 * degreeToRad /*phi*/,
+                       0.3 /*intensity*/, std::vector<int>(1, 1), 1,
+                       spectrumInfo);
+    peaks.emplace_back(102.5 /*TOF*/, 90 * degreeToRad /*phi*/,
+                       0.4 /*intensity*/, std::vector<int>(1, 1), 1,
+                       spectrumInfo);
+    peaks.emplace_back(102 /*TOF*/, 90.5 * degreeToRad /*phi*/,
+                       0.5 /*intensity*/, std::vector<int>(1, 1), 1,
+                       spectrumInfo);
+
+    NiceMock<MockProgressBase> progress;
+
+    // WHEN
+    const auto summedPeaks =
+        SimpleReduceStrategy(compareStrategy.get()).reduce(peaks, progress);
+    const auto maxPeaks =
+        FindMaxReduceStrategy(compareStrategy.get()).reduce(peaks, progress);
+
+    // THEN
+    const double tolerance = 1e-6;
+    TS_ASSERT_EQUALS(summedPeaks.size(), 3);
+    TS_ASSERT_DELTA(summedPeaks[0].getIntensity(), 0.3, tolerance);
+    TS_ASSERT_DELTA(summedPeaks[1].getIntensity(), 0.3, tolerance);
+    TS_ASSERT_DELTA(summedPeaks[2].getIntensity(), 0.9, tolerance);
+    TS_ASSERT_EQUALS(maxPeaks.size(), 3);
+    TS_ASSERT_DELTA(maxPeaks[0].getIntensity(), 0.2, tolerance);
+    TS_ASSERT_DELTA(maxPeaks[1].getIntensity(), 0.3, tolerance);
+    TS_ASSERT_DELTA(maxPeaks[2].getIntensity(), 0.5, tolerance);
+  }
+
   /* ------------------------------------------------------------------------------------------
    * Comparison Strategy
    * ------------------------------------------------------------------------------------------
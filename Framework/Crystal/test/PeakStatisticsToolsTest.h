@@ -289,6 +289,38 @@ public:
     TS_ASSERT_EQUALS(reflections.getUnobservedUniqueReflections().size(), 2);
   }
 
+  void test_UniqueReflectionCollectionFamiliesMatchPointGroup() {
+    for (const std::string symbol : {"-1", "2/m", "4/mmm", "6/mmm", "m-3m"}) {
+      PointGroup_sptr pg =
+          PointGroupFactory::Instance().createPointGroup(symbol);
+      UniqueReflectionCollection reflections =
+          getUniqueReflectionCollection(5.0, "P", symbol, 1.0);
+
+      for (int h = -2; h <= 2; ++h)
+        for (int k = -2; k <= 2; ++k)
+          for (int l = -2; l <= 2; ++l) {
+            const V3D hkl(h, k, l);
+            if (hkl == V3D(0, 0, 0))
+              continue;
+            TSM_ASSERT_EQUALS(symbol + " " + hkl.toString(),
+                              reflections.getReflection(hkl).getHKL(),
+                              pg->getReflectionFamily(hkl));
+          }
+    }
+  }
+
+  void test_UniqueReflectionCollectionCopiesAreIndependent() {
+    UniqueReflectionCollection reflections =
+        getUniqueReflectionCollection(3.0, "P", "m-3m", 1.5);
+    UniqueReflectionCollection copy(reflections);
+
+    copy.addObservations(
+        getPeaksWithIandSigma({1.0, 1.0}, {2.0, 2.0}, V3D(1, 0, 0)));
+
+    TS_ASSERT_EQUALS(copy.getObservedReflectionCount(), 2);
+    TS_ASSERT_EQUALS(reflections.getObservedReflectionCount(), 0);
+  }
+
   void test_PeaksStatisticsNoObservation() {
     std::map<V3D, UniqueReflection> uniques;
     uniques.insert(
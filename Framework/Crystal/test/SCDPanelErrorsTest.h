@@ -0,0 +1,159 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_CRYSTAL_SCDPANELERRORSTEST_H_
+#define MANTID_CRYSTAL_SCDPANELERRORSTEST_H_
+
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/FunctionDomain1D.h"
+#include "MantidAPI/Jacobian.h"
+#include "MantidAPI/Sample.h"
+#include "MantidCrystal/SCDPanelErrors.h"
+#include "MantidDataObjects/PeaksWorkspace.h"
+#include "MantidGeometry/Crystal/OrientedLattice.h"
+#include "MantidKernel/Unit.h"
+#include <boost/math/special_functions/round.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid::API;
+using namespace Mantid::Crystal;
+using namespace Mantid::DataObjects;
+using namespace Mantid::Kernel;
+
+namespace {
+class PanelJacobian : public Jacobian {
+public:
+  PanelJacobian(size_t nData, size_t nParams)
+      : m_nParams(nParams), m_values(nData * nParams) {}
+  void set(size_t iY, size_t iP, double value) override {
+    m_values[iY * m_nParams + iP] = value;
+  }
+  double get(size_t iY, size_t iP) override {
+    return m_values[iY * m_nParams + iP];
+  }
+  void zero() override { std::fill(m_values.begin(), m_values.end(), 0.0); }
+
+private:
+  size_t m_nParams;
+  std::vector<double> m_values;
+};
+} // namespace
+
+class SCDPanelErrorsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SCDPanelErrorsTest *createSuite() { return new SCDPanelErrorsTest(); }
+  static void destroySuite(SCDPanelErrorsTest *suite) { delete suite; }
+
+  SCDPanelErrorsTest() {
+    auto alg = AlgorithmManager::Instance().create("LoadIsawPeaks");
+    alg->setPropertyValue("Filename", "Peaks5637.integrate");
+    alg->setPropertyValue("OutputWorkspace", m_wsName);
+    alg->execute();
+    m_peaksWS =
+        AnalysisDataService::Instance().retrieveWS<PeaksWorkspace>(m_wsName);
+    std::vector<int> notBank47;
+    for (int i = 0; i < m_peaksWS->getNumberPeaks(); i++)
+      if (m_peaksWS->getPeak(i).getBankName() != "bank47")
+        notBank47.push_back(i);
+    m_peaksWS->removePeaks(std::move(notBank47));
+
+    alg = AlgorithmManager::Instance().create("CalculateUMatrix");
+    alg->setPropertyValue("PeaksWorkspace", m_wsName);
+    alg->setProperty("a", 4.75);
+    alg->setProperty("b", 4.75);
+    alg->setProperty("c", 13.0);
+    alg->setProperty("alpha", 90.0);
+    alg->setProperty("beta", 90.0);
+    alg->setProperty("gamma", 120.0);
+    alg->execute();
+  }
+
+  ~SCDPanelErrorsTest() override {
+    AnalysisDataService::Instance().remove(m_wsName);
+  }
+
+  void test_errors_match_moved_panel() {
+    SCDPanelErrors errors;
+    setUpFunction(errors);
+    const size_t nData = 3 * m_peaksWS->getNumberPeaks();
+    std::vector<double> xValues(nData), out(nData);
+    errors.function1D(out.data(), xValues.data(), nData);
+
+    PeaksWorkspace_sptr indexed = m_peaksWS->clone();
+    auto alg = AlgorithmManager::Instance().create("IndexPeaks");
+    alg->setChild(true);
+    alg->setProperty("PeaksWorkspace", indexed);
+    alg->execute();
+    PeaksWorkspace_sptr moved = m_peaksWS->clone();
+    errors.moveDetector(0.002, -0.001, 0.003, 0.2, -0.3, 0.1, 1.01, 0.99,
+                        "bank47", moved);
+    const double tShift = 1.5;
+    const auto inst = moved->getInstrument();
+    const auto &lattice = moved->sample().getOrientedLattice();
+    for (int i = 0; i < indexed->getNumberPeaks(); ++i) {
+      const Peak &peak = indexed->getPeak(i);
+      const V3D hkl(boost::math::iround(peak.getH()),
+                    boost::math::iround(peak.getK()),
+                    boost::math::iround(peak.getL()));
+      V3D expected(0.15, 0.15, 0.15);
+      if (hkl != V3D(0, 0, 0)) {
+        Peak movedPeak(inst, peak.getDetectorID(), peak.getWavelength(), hkl,
+                       peak.getGoniometerMatrix());
+        Units::Wavelength wl;
+        wl.initialize(movedPeak.getL1(), movedPeak.getL2(),
+                      movedPeak.getScattering(), 0,
+                      movedPeak.getInitialEnergy(), 0.0);
+        movedPeak.setWavelength(wl.singleFromTOF(peak.getTOF() + tShift));
+        expected = movedPeak.getQSampleFrame() - lattice.qFromHKL(hkl);
+      }
+      for (size_t j = 0; j < 3; ++j)
+        TS_ASSERT_DELTA(out[i * 3 + j], expected[j], 1e-6);
+    }
+  }
+
+  void test_derivatives_match_numerical_derivatives() {
+    SCDPanelErrors errors;
+    setUpFunction(errors);
+    const size_t nData = 3 * m_peaksWS->getNumberPeaks();
+    std::vector<double> xValues(nData);
+    PanelJacobian analytic(nData, errors.nParams());
+    errors.functionDeriv1D(&analytic, xValues.data(), nData);
+    PanelJacobian numerical(nData, errors.nParams());
+    FunctionDomain1DVector domain(xValues);
+    errors.calNumericalDeriv(domain, numerical);
+
+    for (size_t iY = 0; iY < nData; ++iY)
+      for (size_t iP = 0; iP < errors.nParams(); ++iP) {
+        const double expected = numerical.get(iY, iP);
+        TS_ASSERT_DELTA(analytic.get(iY, iP), expected,
+                        1e-2 * (1.0 + std::abs(expected)));
+      }
+  }
+
+private:
+  void setUpFunction(SCDPanelErrors &errors) {
+    errors.initialize();
+    errors.setAttributeValue("Workspace", m_wsName);
+    errors.setAttributeValue("Bank", "bank47");
+    errors.setParameter("XShift", 0.002);
+    errors.setParameter("YShift", -0.001);
+    errors.setParameter("ZShift", 0.003);
+    errors.setParameter("XRotate", 0.2);
+    errors.setParameter("YRotate", -0.3);
+    errors.setParameter("ZRotate", 0.1);
+    errors.setParameter("ScaleWidth", 1.01);
+    errors.setParameter("ScaleHeight", 0.99);
+    errors.setParameter("T0Shift", 1.5);
+  }
+
+  const std::string m_wsName{"SCDPanelErrorsTest_peaks"};
+  PeaksWorkspace_sptr m_peaksWS;
+};
+
+#endif /* MANTID_CRYSTAL_SCDPANELERRORSTEST_H_ */
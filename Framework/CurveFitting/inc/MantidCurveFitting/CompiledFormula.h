@@ -0,0 +1,114 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_CURVEFITTING_COMPILEDFORMULA_H_
+#define MANTID_CURVEFITTING_COMPILEDFORMULA_H_
+
+#include "MantidCurveFitting/DllConfig.h"
+
+#include <boost/shared_ptr.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class Jacobian;
+}
+namespace CurveFitting {
+
+/**
+ * A formula of x and some parameters, in the syntax of muParser, compiled to
+ * a program that evaluates it on blocks of x values at a time together with
+ * its exact derivatives with respect to the parameters. The derivatives are
+ * found by differentiating the parsed formula symbolically.
+ *
+ * Only arithmetic, powers and the common functions of one variable are
+ * supported; the constructor throws std::invalid_argument for any other
+ * formula, which should then be evaluated by muParser. Evaluation only reads
+ * the compiled program, so one CompiledFormula can be shared by any number of
+ * functions and threads.
+ */
+class MANTID_CURVEFITTING_DLL CompiledFormula {
+public:
+  CompiledFormula(const std::string &formula,
+                  const std::vector<std::string> &parameterNames);
+
+  /// The compiled formula from a cache of the formulas already compiled, or
+  /// a null pointer if the formula cannot be compiled
+  static boost::shared_ptr<const CompiledFormula>
+  compile(const std::string &formula,
+          const std::vector<std::string> &parameterNames);
+
+  /// Evaluate the formula
+  void function(double *out, const double *xValues, const size_t nData,
+                const std::vector<double> &parameters) const;
+  /// Evaluate the derivatives of the formula with respect to its parameters
+  void derivatives(API::Jacobian &jacobian, const double *xValues,
+                   const size_t nData,
+                   const std::vector<double> &parameters) const;
+
+  /// The operations of a compiled formula
+  enum class Operation {
+    Constant,
+    X,
+    Parameter,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Power,
+    Negate,
+    Sign,
+    Exp,
+    Ln,
+    Log10,
+    Log2,
+    Sqrt,
+    Abs,
+    Sin,
+    Cos,
+    Tan,
+    Asin,
+    Acos,
+    Atan,
+    Sinh,
+    Cosh,
+    Tanh,
+    Erf,
+    Erfc
+  };
+  /// One step of a compiled formula. Its result is stored in the register
+  /// of the same index as the instruction.
+  struct Instruction {
+    Operation operation;
+    /// The registers of the arguments
+    size_t a;
+    size_t b;
+    /// The value of a constant, or the index of a parameter
+    double value;
+    size_t index;
+  };
+
+private:
+  template <typename Output>
+  void run(const double *xValues, const size_t nData,
+           const std::vector<double> &parameters, Output output) const;
+
+  /// The number of parameters
+  size_t m_nParams;
+  /// The instructions, evaluating every register in order
+  std::vector<Instruction> m_program;
+  /// The register holding the value of the formula
+  size_t m_valueRegister;
+  /// The registers holding the derivatives
+  std::vector<size_t> m_derivativeRegisters;
+};
+
+} // namespace CurveFitting
+} // namespace Mantid
+
+#endif /* MANTID_CURVEFITTING_COMPILEDFORMULA_H_ */
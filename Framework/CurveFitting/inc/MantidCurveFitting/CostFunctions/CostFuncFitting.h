@@ -90,7 +90,8 @@ protected:
   virtual void calActiveCovarianceMatrix(GSLMatrix &covar,
                                          double epsrel = 1e-8);
   /// Increment to the cost function by evaluating it on a domain
-  virtual void addVal(API::FunctionDomain_sptr domain,
+  virtual void addVal(API::IFunction_sptr function,
+                      API::FunctionDomain_sptr domain,
                       API::FunctionValues_sptr values) const = 0;
 
   /// Increments the cost function and its derivatives by evaluating them on a
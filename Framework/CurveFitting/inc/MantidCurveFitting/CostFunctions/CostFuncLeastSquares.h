@@ -37,7 +37,7 @@ protected:
   void calActiveCovarianceMatrix(GSLMatrix &covar,
                                  double epsrel = 1e-8) override;
 
-  void addVal(API::FunctionDomain_sptr domain,
+  void addVal(API::IFunction_sptr function, API::FunctionDomain_sptr domain,
               API::FunctionValues_sptr values) const override;
   void addValDerivHessian(API::IFunction_sptr function,
                           API::FunctionDomain_sptr domain,
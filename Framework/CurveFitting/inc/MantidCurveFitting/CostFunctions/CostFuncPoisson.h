@@ -41,7 +41,7 @@ public:
   /// Get short name of minimizer - useful for say labels in guis
   virtual std::string shortName() const override { return "Poisson"; };
 
-  void addVal(API::FunctionDomain_sptr domain,
+  void addVal(API::IFunction_sptr function, API::FunctionDomain_sptr domain,
               API::FunctionValues_sptr values) const override;
   void addValDerivHessian(API::IFunction_sptr function,
                           API::FunctionDomain_sptr domain,
@@ -0,0 +1,255 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_CURVEFITTING_DUALNUMBER_H_
+#define MANTID_CURVEFITTING_DUALNUMBER_H_
+
+#include "MantidAPI/IFunction.h"
+#include "MantidAPI/Jacobian.h"
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <gsl/gsl_sf_erf.h>
+#include <stdexcept>
+
+namespace Mantid {
+namespace CurveFitting {
+namespace AutoDiff {
+
+/**
+ * A value with its derivatives with respect to N variables, for forward mode
+ * automatic differentiation. A function written as a template of its scalar
+ * type computes doubles when called with doubles and exact derivatives when
+ * called with dual numbers:
+ *
+ *   auto p = parameterVariables<3>(*this);
+ *   for (size_t i = 0; i < nData; ++i)
+ *     setJacobianRow(*out, i, p[0] * exp(-p[1] * (xValues[i] - p[2])));
+ *
+ * The functions of dual numbers are found by argument dependent lookup, so
+ * templated code should bring the std ones into scope (using std::exp). They
+ * are in their own namespace so as not to hide the std ones elsewhere.
+ */
+template <size_t N> class DualNumber {
+public:
+  /// A constant
+  DualNumber(const double value = 0.) : m_value(value) {
+    m_derivatives.fill(0.);
+  }
+  /// The variable of index i
+  static DualNumber variable(const double value, const size_t i) {
+    DualNumber x(value);
+    x.m_derivatives[i] = 1.;
+    return x;
+  }
+  /// A function of x, given its value and derivative at x
+  static DualNumber chain(const DualNumber &x, const double value,
+                          const double derivative) {
+    DualNumber y(value);
+    for (size_t i = 0; i < N; ++i)
+      y.m_derivatives[i] = derivative * x.m_derivatives[i];
+    return y;
+  }
+
+  double value() const { return m_value; }
+  double derivative(const size_t i) const { return m_derivatives[i]; }
+
+  DualNumber &operator+=(const DualNumber &x) {
+    m_value += x.m_value;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] += x.m_derivatives[i];
+    return *this;
+  }
+  DualNumber &operator-=(const DualNumber &x) {
+    m_value -= x.m_value;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] -= x.m_derivatives[i];
+    return *this;
+  }
+  DualNumber &operator*=(const DualNumber &x) {
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] =
+          m_derivatives[i] * x.m_value + m_value * x.m_derivatives[i];
+    m_value *= x.m_value;
+    return *this;
+  }
+  DualNumber &operator/=(const DualNumber &x) {
+    const double inverse = 1. / x.m_value;
+    m_value *= inverse;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] =
+          (m_derivatives[i] - m_value * x.m_derivatives[i]) * inverse;
+    return *this;
+  }
+  DualNumber &operator+=(const double x) {
+    m_value += x;
+    return *this;
+  }
+  DualNumber &operator-=(const double x) {
+    m_value -= x;
+    return *this;
+  }
+  DualNumber &operator*=(const double x) {
+    m_value *= x;
+    for (auto &derivative : m_derivatives)
+      derivative *= x;
+    return *this;
+  }
+  DualNumber &operator/=(const double x) { return *this *= 1. / x; }
+
+private:
+  double m_value;
+  std::array<double, N> m_derivatives;
+};
+
+template <size_t N> DualNumber<N> operator-(DualNumber<N> x) {
+  return x *= -1.;
+}
+
+template <size_t N>
+DualNumber<N> operator+(DualNumber<N> x, const DualNumber<N> &y) {
+  return x += y;
+}
+template <size_t N>
+DualNumber<N> operator-(DualNumber<N> x, const DualNumber<N> &y) {
+  return x -= y;
+}
+template <size_t N>
+DualNumber<N> operator*(DualNumber<N> x, const DualNumber<N> &y) {
+  return x *= y;
+}
+template <size_t N>
+DualNumber<N> operator/(DualNumber<N> x, const DualNumber<N> &y) {
+  return x /= y;
+}
+
+template <size_t N> DualNumber<N> operator+(DualNumber<N> x, const double y) {
+  return x += y;
+}
+template <size_t N> DualNumber<N> operator-(DualNumber<N> x, const double y) {
+  return x -= y;
+}
+template <size_t N> DualNumber<N> operator*(DualNumber<N> x, const double y) {
+  return x *= y;
+}
+template <size_t N> DualNumber<N> operator/(DualNumber<N> x, const double y) {
+  return x /= y;
+}
+template <size_t N> DualNumber<N> operator+(const double x, DualNumber<N> y) {
+  return y += x;
+}
+template <size_t N> DualNumber<N> operator-(const double x, DualNumber<N> y) {
+  return (y *= -1.) += x;
+}
+template <size_t N> DualNumber<N> operator*(const double x, DualNumber<N> y) {
+  return y *= x;
+}
+template <size_t N>
+DualNumber<N> operator/(const double x, const DualNumber<N> &y) {
+  const double value = x / y.value();
+  return DualNumber<N>::chain(y, value, -value / y.value());
+}
+
+template <size_t N> DualNumber<N> exp(const DualNumber<N> &x) {
+  const double value = std::exp(x.value());
+  return DualNumber<N>::chain(x, value, value);
+}
+template <size_t N> DualNumber<N> log(const DualNumber<N> &x) {
+  return DualNumber<N>::chain(x, std::log(x.value()), 1. / x.value());
+}
+template <size_t N> DualNumber<N> sqrt(const DualNumber<N> &x) {
+  const double value = std::sqrt(x.value());
+  return DualNumber<N>::chain(x, value, 0.5 / value);
+}
+template <size_t N> DualNumber<N> pow(const DualNumber<N> &x, const double y) {
+  const double value = std::pow(x.value(), y);
+  return DualNumber<N>::chain(x, value, y * std::pow(x.value(), y - 1.));
+}
+template <size_t N> DualNumber<N> erfc(const DualNumber<N> &x) {
+  return DualNumber<N>::chain(x, std::erfc(x.value()),
+                              -M_2_SQRTPI * std::exp(-x.value() * x.value()));
+}
+
+/// log(erfc(x)), accurate for large x where erfc(x) underflows
+template <size_t N> DualNumber<N> logErfc(const DualNumber<N> &x) {
+  const double value = gsl_sf_log_erfc(x.value());
+  return DualNumber<N>::chain(
+      x, value, -M_2_SQRTPI * std::exp(-x.value() * x.value() - value));
+}
+
+/// The value of a dual number, without its derivatives
+template <size_t N> double valueOf(const DualNumber<N> &x) { return x.value(); }
+
+/** The imaginary part of f(z) for an analytic function f of z = re + i im
+ * @param value :: f(z)
+ * @param derivative :: f'(z)
+ * @param re :: the real part of z
+ * @param im :: the imaginary part of z
+ * @return the imaginary part of f(z), with its derivatives
+ */
+template <size_t N>
+DualNumber<N> imagOfAnalytic(const std::complex<double> &value,
+                             const std::complex<double> &derivative,
+                             const DualNumber<N> &re, const DualNumber<N> &im) {
+  // By the Cauchy-Riemann equations, d Im(f) = Im(f') d re + Re(f') d im
+  return DualNumber<N>::chain(re, value.imag(), derivative.imag()) +
+         DualNumber<N>::chain(im, 0., derivative.real());
+}
+
+} // namespace AutoDiff
+
+/// log(erfc(x)), accurate for large x where erfc(x) underflows
+inline double logErfc(const double x) { return gsl_sf_log_erfc(x); }
+
+/// The value of a double, for code templated on dual numbers
+inline double valueOf(const double x) { return x; }
+
+/** The imaginary part of f(z) for an analytic function f of z = re + i im
+ * @param value :: f(z)
+ * @return the imaginary part of the value
+ */
+inline double imagOfAnalytic(const std::complex<double> &value,
+                             const std::complex<double> &, const double,
+                             const double) {
+  return value.imag();
+}
+
+/** The parameters of a function, each the variable of its own derivative
+ * @param function :: a function of N parameters
+ * @return the parameters as dual numbers
+ */
+template <size_t N>
+std::array<AutoDiff::DualNumber<N>, N>
+parameterVariables(const API::IFunction &function) {
+  if (function.nParams() != N)
+    throw std::logic_error("Function " + function.name() + " has " +
+                           std::to_string(function.nParams()) +
+                           " parameters rather than " + std::to_string(N));
+  std::array<AutoDiff::DualNumber<N>, N> parameters;
+  for (size_t i = 0; i < N; ++i)
+    parameters[i] =
+        AutoDiff::DualNumber<N>::variable(function.getParameter(i), i);
+  return parameters;
+}
+
+/** Set the derivatives of a function value in a row of a Jacobian
+ * @param jacobian :: the Jacobian
+ * @param iY :: index of the data point
+ * @param value :: the function value, with its derivatives with respect to
+ *                 the parameters of the function
+ */
+template <size_t N>
+void setJacobianRow(API::Jacobian &jacobian, const size_t iY,
+                    const AutoDiff::DualNumber<N> &value) {
+  for (size_t iP = 0; iP < N; ++iP)
+    jacobian.set(iY, iP, value.derivative(iP));
+}
+
+} // namespace CurveFitting
+} // namespace Mantid
+
+#endif /* MANTID_CURVEFITTING_DUALNUMBER_H_ */
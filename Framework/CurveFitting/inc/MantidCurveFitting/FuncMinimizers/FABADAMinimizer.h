@@ -69,6 +69,9 @@ private:
   /// Check for convergence (including Overexploration convergence), updates
   /// m_converged
   void convergenceCheck();
+  /// Check whether the posterior chain can be stopped early, updates
+  /// m_posteriorConverged
+  void gelmanRubinCheck();
   /// Refrigerates the system if appropriate
   void simAnnealingRefrigeration();
   /// Decides wheather iteration must continue or not
@@ -136,6 +139,8 @@ private:
   bool m_converged;
   /// The point when convergence has been reached
   size_t m_convPoint;
+  /// Boolean that indicates the posterior chain has mixed well enough to stop
+  bool m_posteriorConverged;
   /// Convergence of each parameter
   std::vector<bool> m_parConverged;
   /// Convergence criteria for each parameter
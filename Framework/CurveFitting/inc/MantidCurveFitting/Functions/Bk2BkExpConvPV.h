@@ -10,6 +10,7 @@
 #include "MantidAPI/IFunctionMW.h"
 #include "MantidAPI/IPeakFunction.h"
 #include "MantidKernel/System.h"
+#include <array>
 #include <complex>
 
 namespace Mantid {
@@ -51,8 +52,6 @@ protected:
                      const size_t nData) const override;
   void functionDerivLocal(API::Jacobian *out, const double *xValues,
                           const size_t nData) override;
-  void functionDeriv(const API::FunctionDomain &domain,
-                     API::Jacobian &jacobian) override;
 
   /// overwrite IFunction base class method, which declare function parameters
   void init() override;
@@ -61,12 +60,21 @@ private:
   /// container for storing wavelength values for each data point
   mutable std::vector<double> m_dtt1;
 
-  double calOmega(double x, double eta, double N, double alpha, double beta,
-                  double H, double sigma2, double invert_sqrt2sigma) const;
+  template <typename T, typename Output>
+  void calculatePeak(const std::array<T, 6> &parameters, const double *xValues,
+                     const size_t nData, const Output &output) const;
+
+  template <typename T>
+  T calOmega(const T &x, const T &eta, const T &N, const T &alpha,
+             const T &beta, const T &H, const T &sigma2,
+             const T &invert_sqrt2sigma) const;
+
+  template <typename T> T imagOfExpE1(const T &re, const T &im) const;
 
   std::complex<double> E1(std::complex<double> z) const;
 
-  void calHandEta(double sigma2, double gamma, double &H, double &eta) const;
+  template <typename T>
+  void calHandEta(const T &sigma2, const T &gamma, T &H, T &eta) const;
 
   mutable double mFWHM;
   mutable double mLowTOF;
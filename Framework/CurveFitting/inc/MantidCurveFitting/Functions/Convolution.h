@@ -12,6 +12,7 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/CompositeFunction.h"
 #include <boost/shared_array.hpp>
+#include <boost/shared_ptr.hpp>
 #include <cmath>
 #include <vector>
 
@@ -113,6 +114,8 @@ public:
                        API::FunctionValues &values) const;
   void functionDirectMode(const API::FunctionDomain &domain,
                           API::FunctionValues &values) const;
+  bool functionAnalytic(const API::FunctionDomain &domain,
+                        API::FunctionValues &values) const;
   /// Derivatives of function with respect to active parameters
   void functionDeriv(const API::FunctionDomain &domain,
                      API::Jacobian &jacobian) override;
@@ -134,10 +137,19 @@ protected:
   void init() override;
 
 private:
+  struct FFTWorkspace;
+  /// The FFT wavetables and workspace for a domain of nData points
+  FFTWorkspace &fftWorkspace(size_t nData) const;
+
   /// Keep the Fourier transform of the resolution function (divided by the
   /// step in xValues) when in FFT mode, and the inverted resolution if in
   /// Direct mode
   mutable std::vector<double> m_resolution;
+  /// The step in xValues of the transform in m_resolution, or 0 if it holds
+  /// the inverted resolution
+  mutable double m_resolutionStep = 0.;
+  /// Kept between calls so that the wavetables are only set up once per fit
+  mutable boost::shared_ptr<FFTWorkspace> m_fftWorkspace;
 };
 
 } // namespace Functions
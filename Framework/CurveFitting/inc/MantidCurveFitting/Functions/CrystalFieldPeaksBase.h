@@ -12,6 +12,9 @@
 #include "MantidCurveFitting/DllConfig.h"
 #include "MantidCurveFitting/FortranDefs.h"
 
+#include <string>
+#include <vector>
+
 namespace Mantid {
 namespace CurveFitting {
 namespace Functions {
@@ -26,7 +29,8 @@ public:
   CrystalFieldPeaksBase();
   void setAttribute(const std::string &name, const Attribute &) override;
 
-  /// Calculate the crystal field eigensystem
+  /// Calculate the crystal field eigensystem, or return the one calculated
+  /// last if neither the ion nor any field parameter has changed since
   void calculateEigenSystem(DoubleFortranVector &en, ComplexFortranMatrix &wf,
                             ComplexFortranMatrix &ham, ComplexFortranMatrix &hz,
                             int &nre) const;
@@ -40,6 +44,20 @@ protected:
   /// Store the default domain size after first
   /// function evaluation
   mutable size_t m_defaultDomainSize;
+
+private:
+  /// The inputs and results of the last diagonalisation of the Hamiltonian
+  struct EigenSystemCache {
+    bool valid = false;
+    std::string ion;
+    std::vector<double> fields;
+    DoubleFortranVector en;
+    ComplexFortranMatrix wf;
+    ComplexFortranMatrix ham;
+    ComplexFortranMatrix hz;
+    int nre = 0;
+  };
+  mutable EigenSystemCache m_eigenSystemCache;
 };
 
 class MANTID_CURVEFITTING_DLL CrystalFieldPeaksBaseImpl
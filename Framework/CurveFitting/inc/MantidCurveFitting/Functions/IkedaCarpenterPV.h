@@ -13,6 +13,8 @@
 #include "MantidAPI/IFunctionMW.h"
 #include "MantidAPI/IPeakFunction.h"
 
+#include <array>
+
 namespace Mantid {
 namespace CurveFitting {
 namespace Functions {
@@ -47,8 +49,6 @@ protected:
                      const size_t nData) const override;
   void functionDerivLocal(API::Jacobian *out, const double *xValues,
                           const size_t nData) override;
-  void functionDeriv(const API::FunctionDomain &domain,
-                     API::Jacobian &jacobian) override;
 
   /// overwrite IFunction base class method, which declare function parameters
   void init() override;
@@ -65,10 +65,15 @@ private:
   void calWavelengthAtEachDataPoint(const double *xValues,
                                     const size_t &nData) const;
 
+  /// calculate the peak, or its derivatives when T is a dual number
+  template <typename T, typename Output>
+  void calculatePeak(const std::array<T, 8> &parameters, const double *xValues,
+                     const size_t nData, const Output &output) const;
+
   /// convert voigt params to pseudo voigt params
-  void convertVoigtToPseudo(const double &voigtSigmaSq,
-                            const double &voigtGamma, double &H,
-                            double &eta) const;
+  template <typename T>
+  void convertVoigtToPseudo(const T &voigtSigmaSq, const T &voigtGamma, T &H,
+                            T &eta) const;
 
   /// constrain all parameters to be non-negative
   void lowerConstraint0(std::string paramName);
@@ -12,6 +12,7 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/IFunction1D.h"
 #include "MantidAPI/ParamFunction.h"
+#include "MantidCurveFitting/CompiledFormula.h"
 #include <boost/shared_array.hpp>
 
 namespace mu {
@@ -24,6 +25,10 @@ namespace Functions {
 /**
 A user defined function.
 
+Formulas of arithmetic and the common functions are compiled, with exact
+derivatives (see CompiledFormula). Any other formula is evaluated by muParser
+with numerical derivatives.
+
 @author Roman Tolchenov, Tessella plc
 @date 15/01/2010
 */
@@ -70,6 +75,8 @@ private:
   std::string m_formula;
   /// extended muParser instance
   mu::Parser *m_parser;
+  /// The compiled formula, if it could be compiled
+  boost::shared_ptr<const CompiledFormula> m_compiledFormula;
   /// Used as 'x' variable in m_parser.
   mutable double m_x;
   /// True indicates that input formula contains 'x' variable
@@ -9,6 +9,7 @@
 
 #include "MantidAPI/Jacobian.h"
 
+#include <utility>
 #include <vector>
 
 namespace Mantid {
@@ -73,6 +74,23 @@ public:
   }
   /// overwrite base method
   void zero() override { m_data.assign(m_data.size(), 0.0); }
+  /// The range [first, last) of the data points where the derivative by a
+  /// parameter is not zero, empty if it is zero everywhere
+  /// @param iP :: the index of the parameter
+  std::pair<size_t, size_t> nonZeroRange(size_t iP) const {
+    if (iP >= m_np) {
+      throw Kernel::Exception::FitSizeWarning(m_np);
+    }
+    size_t first = 0;
+    while (first < m_ny && m_data[first * m_np + iP] == 0.0)
+      ++first;
+    if (first == m_ny)
+      return {0, 0};
+    size_t last = m_ny;
+    while (m_data[(last - 1) * m_np + iP] == 0.0)
+      --last;
+    return {first, last};
+  }
 };
 
 } // namespace CurveFitting
@@ -24,7 +24,7 @@ double finalEnergyUranium(const double randv);
 // Ties together random numbers with various probability distributions
 class RandomVariateGenerator {
 public:
-  RandomVariateGenerator(const int seed);
+  RandomVariateGenerator(const int seed, const size_t stream = 0);
   /// Returns a flat random number between 0.0 & 1.0
   double flat();
   /// Returns a random number distributed  by a normal distribution
@@ -19,6 +19,10 @@ namespace CurveFitting {
     An implementation of SeqDomain for parallel cost function and derivatives
    computation.
 
+    Each thread evaluates its own copy of the fitting function, as functions
+    are not required to be safe to evaluate from several threads at once. The
+    copies are kept between evaluations and only their parameters are updated.
+
     @author Roman Tolchenov, Tessella plc
 */
 class MANTID_CURVEFITTING_DLL ParDomain : public SeqDomain {
@@ -35,6 +39,14 @@ public:
   void additiveCostFunctionValDerivHessian(
       const CostFunctions::CostFuncFitting &costFunction, bool evalDeriv,
       bool evalHessian) override;
+
+private:
+  /// Update the per-thread copies of a fitting function
+  void updateThreadFunctions(const API::IFunction_sptr &function) const;
+  /// The function the copies in m_threadFunctions are of
+  mutable API::IFunction_sptr m_sourceFunction;
+  /// A copy of the fitting function for each thread
+  mutable std::vector<API::IFunction_sptr> m_threadFunctions;
 };
 
 } // namespace CurveFitting
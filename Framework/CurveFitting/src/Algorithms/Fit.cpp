@@ -147,6 +147,9 @@ void Fit::copyMinimizerOutput(const API::IFuncMinimizer &minimizer) {
         (*property).isValid().empty()) {
       auto clonedProperty =
           std::unique_ptr<Kernel::Property>((*property).clone());
+      // Replace the output of a previous execution of this Fit
+      if (existsProperty(clonedProperty->name()))
+        removeProperty(clonedProperty->name());
       declareProperty(std::move(clonedProperty));
     }
   }
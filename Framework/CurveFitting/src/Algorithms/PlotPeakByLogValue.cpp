@@ -33,11 +33,38 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 
 namespace {
 Mantid::Kernel::Logger g_log("PlotPeakByLogValue");
-}
+
+/// A spectrum to fit
+struct SpectrumToFit {
+  /// Index of the input the spectrum comes from
+  size_t input;
+  Mantid::API::MatrixWorkspace_sptr ws;
+  /// Workspace index of the spectrum
+  int index;
+  /// The value to plot the fitted parameters against
+  double logValue;
+  std::string minimizer;
+  /// Base name of the output workspaces of the fit
+  std::string outputBaseName;
+};
+
+/// The results of the fit of a spectrum
+struct FitResult {
+  Mantid::API::IFunction_sptr function;
+  /// The fitted parameters and their errors
+  std::vector<double> parameters;
+  std::vector<double> errors;
+  double chi2 = 0.;
+  Mantid::API::MatrixWorkspace_sptr fitWorkspace;
+  Mantid::API::ITableWorkspace_sptr parameterWorkspace;
+  Mantid::API::ITableWorkspace_sptr covarianceWorkspace;
+};
+} // namespace
 
 namespace Mantid {
 namespace CurveFitting {
@@ -204,14 +231,6 @@ void PlotPeakByLogValue::exec() {
     throw std::invalid_argument("Fitting function failed to initialize");
   }
 
-  // for inidividual fittings store the initial parameters
-  std::vector<double> initialParams(ifun->nParams());
-  if (individual) {
-    for (size_t i = 0; i < initialParams.size(); ++i) {
-      initialParams[i] = ifun->getParameter(i);
-    }
-  }
-
   for (size_t iPar = 0; iPar < ifun->nParams(); ++iPar) {
     result->addColumn("double", ifun->parameterName(iPar));
     result->addColumn("double", ifun->parameterName(iPar) + "_Err");
@@ -220,13 +239,10 @@ void PlotPeakByLogValue::exec() {
 
   setProperty("OutputWorkspace", result);
 
-  std::vector<MatrixWorkspace_sptr> fitWorkspaces;
-  std::vector<ITableWorkspace_sptr> parameterWorkspaces;
-  std::vector<ITableWorkspace_sptr> covarianceWorkspaces;
-
-  double dProg = 1. / static_cast<double>(wsNames.size());
-  double Prog = 0.;
-  for (int i = 0; i < static_cast<int>(wsNames.size()); ++i) {
+  // Collect the spectra to fit, with the values to plot their parameters
+  // against
+  std::vector<SpectrumToFit> spectra;
+  for (size_t i = 0; i < wsNames.size(); ++i) {
     InputData data = getWorkspace(wsNames[i]);
 
     if (!data.ws) {
@@ -249,15 +265,7 @@ void PlotPeakByLogValue::exec() {
       jend = data.indx.back() + 1;
     }
 
-    if (createFitOutput) {
-      covarianceWorkspaces.reserve(covarianceWorkspaces.size() + jend);
-      fitWorkspaces.reserve(fitWorkspaces.size() + jend);
-      parameterWorkspaces.reserve(parameterWorkspaces.size() + jend);
-    }
-
-    dProg /= abs(jend - j);
     for (; j < jend; ++j) {
-
       // Find the log value: it is either a log-file value or simply the
       // workspace number
       double logValue = 0;
@@ -283,103 +291,158 @@ void PlotPeakByLogValue::exec() {
         logValue = logp->lastValue();
       }
 
-      double chi2;
-
-      try {
-        if (passWSIndexToFunction) {
-          setWorkspaceIndexAttribute(ifun, j);
-        }
+      const std::string spectrum_index = std::to_string(j);
+      spectra.push_back(
+          {i, data.ws, j, logValue,
+           getMinimizerString(wsNames[i].name, spectrum_index),
+           createFitOutput ? wsNames[i].name + "_" + spectrum_index : ""});
+    }
+  }
 
-        g_log.debug() << "Fitting " << data.ws->getName() << " index " << j
-                      << " with \n";
-        g_log.debug() << ifun->asString() << '\n';
-
-        const std::string spectrum_index = std::to_string(j);
-        std::string wsBaseName;
-
-        if (createFitOutput)
-          wsBaseName = wsNames[i].name + "_" + spectrum_index;
-
-        bool histogramFit = getPropertyValue("EvaluationType") == "Histogram";
-        bool ignoreInvalidData = getProperty("IgnoreInvalidData");
-
-        // Fit the function
-        auto fit = this->createChildAlgorithm("Fit");
-        fit->initialize();
-        fit->setPropertyValue("EvaluationType",
-                              getPropertyValue("EvaluationType"));
-        fit->setProperty("Function", ifun);
-        fit->setProperty("InputWorkspace", data.ws);
-        fit->setProperty("WorkspaceIndex", j);
-        fit->setPropertyValue("StartX", getPropertyValue("StartX"));
-        fit->setPropertyValue("EndX", getPropertyValue("EndX"));
-        fit->setProperty("IgnoreInvalidData", ignoreInvalidData);
-        fit->setPropertyValue(
-            "Minimizer", getMinimizerString(wsNames[i].name, spectrum_index));
-        fit->setPropertyValue("CostFunction", getPropertyValue("CostFunction"));
-        fit->setPropertyValue("MaxIterations",
-                              getPropertyValue("MaxIterations"));
-        fit->setPropertyValue("PeakRadius", getPropertyValue("PeakRadius"));
-        fit->setProperty("CalcErrors", true);
-        fit->setProperty("CreateOutput", createFitOutput);
-        if (!histogramFit) {
-          fit->setProperty("OutputCompositeMembers", outputCompositeMembers);
-          fit->setProperty("ConvolveMembers", outputConvolvedMembers);
-          fit->setProperty("Exclude", exclude);
-        }
-        fit->setProperty("Output", wsBaseName);
-        fit->execute();
+  // The options of the fits, common to all spectra
+  const std::string evaluationType = getPropertyValue("EvaluationType");
+  const bool histogramFit = evaluationType == "Histogram";
+  const bool ignoreInvalidData = getProperty("IgnoreInvalidData");
+  const double startX = getProperty("StartX");
+  const double endX = getProperty("EndX");
+  const std::string costFunction = getPropertyValue("CostFunction");
+  const int maxIterations = getProperty("MaxIterations");
+  const int peakRadius = getProperty("PeakRadius");
+
+  // Fit declares its output workspace properties as it runs, so a Fit can
+  // only be reused between spectra if those are not created. Otherwise each
+  // thread keeps one Fit for all its spectra.
+  std::vector<Algorithm_sptr> fits(PARALLEL_GET_MAX_THREADS);
+
+  auto fitSpectrum = [&](const SpectrumToFit &spectrum,
+                         IFunction_sptr function) {
+    try {
+      if (passWSIndexToFunction) {
+        setWorkspaceIndexAttribute(function, spectrum.index);
+      }
 
-        if (!fit->isExecuted()) {
-          throw std::runtime_error("Fit child algorithm failed: " +
-                                   data.ws->getName());
-        }
+      g_log.debug() << "Fitting " << spectrum.ws->getName() << " index "
+                    << spectrum.index << " with \n";
+      g_log.debug() << function->asString() << '\n';
 
-        ifun = fit->getProperty("Function");
-        chi2 = fit->getProperty("OutputChi2overDoF");
-
-        if (createFitOutput) {
-          MatrixWorkspace_sptr outputFitWorkspace =
-              fit->getProperty("OutputWorkspace");
-          ITableWorkspace_sptr outputParamWorkspace =
-              fit->getProperty("OutputParameters");
-          ITableWorkspace_sptr outputCovarianceWorkspace =
-              fit->getProperty("OutputNormalisedCovarianceMatrix");
-          fitWorkspaces.emplace_back(outputFitWorkspace);
-          parameterWorkspaces.emplace_back(outputParamWorkspace);
-          covarianceWorkspaces.emplace_back(outputCovarianceWorkspace);
-        }
-        g_log.debug() << "Fit result " << fit->getPropertyValue("OutputStatus")
-                      << ' ' << chi2 << '\n';
-      } catch (...) {
-        g_log.error("Error in Fit ChildAlgorithm");
-        throw;
+      // Fit the function
+      auto &fit = fits[PARALLEL_THREAD_NUMBER];
+      if (!fit || createFitOutput) {
+        fit = this->createChildAlgorithm("Fit");
+        fit->enableFastChildExecution(true);
+      }
+      fit->setPropertyValue("EvaluationType", evaluationType);
+      fit->setProperty("Function", function);
+      fit->setProperty("InputWorkspace", spectrum.ws);
+      fit->setProperty("WorkspaceIndex", spectrum.index);
+      fit->setProperty("StartX", startX);
+      fit->setProperty("EndX", endX);
+      fit->setProperty("IgnoreInvalidData", ignoreInvalidData);
+      fit->setPropertyValue("Minimizer", spectrum.minimizer);
+      fit->setPropertyValue("CostFunction", costFunction);
+      fit->setProperty("MaxIterations", maxIterations);
+      fit->setProperty("PeakRadius", peakRadius);
+      fit->setProperty("CalcErrors", true);
+      fit->setProperty("CreateOutput", createFitOutput);
+      if (!histogramFit) {
+        fit->setProperty("OutputCompositeMembers", outputCompositeMembers);
+        fit->setProperty("ConvolveMembers", outputConvolvedMembers);
+        fit->setProperty("Exclude", exclude);
       }
+      fit->setProperty("Output", spectrum.outputBaseName);
+      fit->execute();
 
-      // Extract the fitted parameters and put them into the result table
-      TableRow row = result->appendRow();
-      if (isDataName) {
-        row << wsNames[i].name;
-      } else {
-        row << logValue;
+      if (!fit->isExecuted()) {
+        throw std::runtime_error("Fit child algorithm failed: " +
+                                 spectrum.ws->getName());
       }
 
-      for (size_t iPar = 0; iPar < ifun->nParams(); ++iPar) {
-        row << ifun->getParameter(iPar) << ifun->getError(iPar);
+      FitResult fitResult;
+      IFunction_sptr fittedFunction = fit->getProperty("Function");
+      fitResult.function = fittedFunction;
+      for (size_t iPar = 0; iPar < fittedFunction->nParams(); ++iPar) {
+        fitResult.parameters.push_back(fittedFunction->getParameter(iPar));
+        fitResult.errors.push_back(fittedFunction->getError(iPar));
+      }
+      fitResult.chi2 = fit->getProperty("OutputChi2overDoF");
+
+      if (createFitOutput) {
+        MatrixWorkspace_sptr outputFitWorkspace =
+            fit->getProperty("OutputWorkspace");
+        ITableWorkspace_sptr outputParamWorkspace =
+            fit->getProperty("OutputParameters");
+        ITableWorkspace_sptr outputCovarianceWorkspace =
+            fit->getProperty("OutputNormalisedCovarianceMatrix");
+        fitResult.fitWorkspace = outputFitWorkspace;
+        fitResult.parameterWorkspace = outputParamWorkspace;
+        fitResult.covarianceWorkspace = outputCovarianceWorkspace;
       }
-      row << chi2;
+      g_log.debug() << "Fit result " << fit->getPropertyValue("OutputStatus")
+                    << ' ' << fitResult.chi2 << '\n';
+      return fitResult;
+    } catch (...) {
+      g_log.error("Error in Fit ChildAlgorithm");
+      throw;
+    }
+  };
 
-      Prog += dProg;
-      std::string current = std::to_string(i);
-      progress(Prog, ("Fitting Workspace: (" + current + ") - "));
+  std::vector<FitResult> fitResults(spectra.size());
+  Progress prog(this, 0.0, 1.0, spectra.size());
+  if (individual) {
+    // The fits are independent: run them in parallel, each starting from its
+    // own copy of the initial function
+    std::vector<IFunction_sptr> functions(spectra.size());
+    for (auto &function : functions)
+      function = ifun->clone();
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int k = 0; k < static_cast<int>(spectra.size()); ++k) {
+      PARALLEL_START_INTERUPT_REGION
+      fitResults[k] = fitSpectrum(spectra[k], functions[k]);
+      prog.report("Fitting Workspace: (" + std::to_string(spectra[k].input) +
+                  ") - ");
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+  } else {
+    // Every fit starts with the parameters of the previous one
+    for (size_t k = 0; k < spectra.size(); ++k) {
+      fitResults[k] = fitSpectrum(spectra[k], ifun);
+      ifun = fitResults[k].function;
+      prog.report("Fitting Workspace: (" + std::to_string(spectra[k].input) +
+                  ") - ");
       interruption_point();
+    }
+  }
 
-      if (individual) {
-        for (size_t k = 0; k < initialParams.size(); ++k) {
-          ifun->setParameter(k, initialParams[k]);
-        }
-      }
-    } // for(;j < jend;++j)
+  std::vector<MatrixWorkspace_sptr> fitWorkspaces;
+  std::vector<ITableWorkspace_sptr> parameterWorkspaces;
+  std::vector<ITableWorkspace_sptr> covarianceWorkspaces;
+  if (createFitOutput) {
+    covarianceWorkspaces.reserve(spectra.size());
+    fitWorkspaces.reserve(spectra.size());
+    parameterWorkspaces.reserve(spectra.size());
+  }
+
+  for (size_t k = 0; k < spectra.size(); ++k) {
+    const auto &fitResult = fitResults[k];
+    // Extract the fitted parameters and put them into the result table
+    TableRow row = result->appendRow();
+    if (isDataName) {
+      row << wsNames[spectra[k].input].name;
+    } else {
+      row << spectra[k].logValue;
+    }
+
+    for (size_t iPar = 0; iPar < fitResult.parameters.size(); ++iPar) {
+      row << fitResult.parameters[iPar] << fitResult.errors[iPar];
+    }
+    row << fitResult.chi2;
+
+    if (createFitOutput) {
+      fitWorkspaces.emplace_back(fitResult.fitWorkspace);
+      parameterWorkspaces.emplace_back(fitResult.parameterWorkspace);
+      covarianceWorkspaces.emplace_back(fitResult.covarianceWorkspace);
+    }
   }
 
   if (createFitOutput) {
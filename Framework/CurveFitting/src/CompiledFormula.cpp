@@ -0,0 +1,712 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidCurveFitting/CompiledFormula.h"
+#include "MantidAPI/Jacobian.h"
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace Mantid {
+namespace CurveFitting {
+
+namespace {
+using Operation = CompiledFormula::Operation;
+
+/// The number of x values evaluated by each instruction at a time
+constexpr size_t BLOCK_SIZE = 256;
+/// The number of formulas kept by CompiledFormula::compile
+constexpr size_t MAX_CACHE_SIZE = 1000;
+
+/// The functions of one variable, by their names in muParser. muParser's
+/// "log" is left out as its base has changed between versions.
+const std::map<std::string, Operation> FUNCTIONS = {
+    {"exp", Operation::Exp},     {"ln", Operation::Ln},
+    {"log10", Operation::Log10}, {"log2", Operation::Log2},
+    {"sqrt", Operation::Sqrt},   {"abs", Operation::Abs},
+    {"sign", Operation::Sign},   {"sin", Operation::Sin},
+    {"cos", Operation::Cos},     {"tan", Operation::Tan},
+    {"asin", Operation::Asin},   {"acos", Operation::Acos},
+    {"atan", Operation::Atan},   {"sinh", Operation::Sinh},
+    {"cosh", Operation::Cosh},   {"tanh", Operation::Tanh},
+    {"erf", Operation::Erf},     {"erfc", Operation::Erfc}};
+
+struct Node;
+using NodePtr = std::shared_ptr<const Node>;
+/// A node of the tree of a parsed formula
+struct Node {
+  Operation operation;
+  double value;
+  size_t index;
+  NodePtr a;
+  NodePtr b;
+};
+
+NodePtr makeNode(const Operation operation, NodePtr a, NodePtr b,
+                 const double value = 0., const size_t index = 0) {
+  return std::make_shared<const Node>(
+      Node{operation, value, index, std::move(a), std::move(b)});
+}
+
+NodePtr constant(const double value) {
+  return makeNode(Operation::Constant, nullptr, nullptr, value);
+}
+
+bool isConstant(const NodePtr &node) {
+  return node->operation == Operation::Constant;
+}
+
+bool isConstant(const NodePtr &node, const double value) {
+  return isConstant(node) && node->value == value;
+}
+
+double sign(const double a) {
+  return static_cast<double>((a > 0.) - (a < 0.));
+}
+
+/// The value of an operation of constant arguments
+double apply(const Operation operation, const double a, const double b) {
+  switch (operation) {
+  case Operation::Add:
+    return a + b;
+  case Operation::Subtract:
+    return a - b;
+  case Operation::Multiply:
+    return a * b;
+  case Operation::Divide:
+    return a / b;
+  case Operation::Power:
+    return std::pow(a, b);
+  case Operation::Negate:
+    return -a;
+  case Operation::Sign:
+    return sign(a);
+  case Operation::Exp:
+    return std::exp(a);
+  case Operation::Ln:
+    return std::log(a);
+  case Operation::Log10:
+    return std::log10(a);
+  case Operation::Log2:
+    return std::log2(a);
+  case Operation::Sqrt:
+    return std::sqrt(a);
+  case Operation::Abs:
+    return std::abs(a);
+  case Operation::Sin:
+    return std::sin(a);
+  case Operation::Cos:
+    return std::cos(a);
+  case Operation::Tan:
+    return std::tan(a);
+  case Operation::Asin:
+    return std::asin(a);
+  case Operation::Acos:
+    return std::acos(a);
+  case Operation::Atan:
+    return std::atan(a);
+  case Operation::Sinh:
+    return std::sinh(a);
+  case Operation::Cosh:
+    return std::cosh(a);
+  case Operation::Tanh:
+    return std::tanh(a);
+  case Operation::Erf:
+    return std::erf(a);
+  case Operation::Erfc:
+    return std::erfc(a);
+  default:
+    throw std::logic_error("CompiledFormula: not an operation of arguments");
+  }
+}
+
+/// A function of one argument, folding constants
+NodePtr unary(const Operation operation, const NodePtr &a) {
+  if (isConstant(a))
+    return constant(apply(operation, a->value, 0.));
+  if (operation == Operation::Negate && a->operation == Operation::Negate)
+    return a->a;
+  return makeNode(operation, a, nullptr);
+}
+
+/// A binary operation, folding constants and dropping the zeros and ones left
+/// by differentiation
+NodePtr binary(const Operation operation, const NodePtr &a, const NodePtr &b) {
+  if (isConstant(a) && isConstant(b))
+    return constant(apply(operation, a->value, b->value));
+  switch (operation) {
+  case Operation::Add:
+    if (isConstant(a, 0.))
+      return b;
+    if (isConstant(b, 0.))
+      return a;
+    break;
+  case Operation::Subtract:
+    if (isConstant(b, 0.))
+      return a;
+    if (isConstant(a, 0.))
+      return unary(Operation::Negate, b);
+    break;
+  case Operation::Multiply:
+    if (isConstant(a, 0.) || isConstant(b, 0.))
+      return constant(0.);
+    if (isConstant(a, 1.))
+      return b;
+    if (isConstant(b, 1.))
+      return a;
+    break;
+  case Operation::Divide:
+    if (isConstant(a, 0.))
+      return constant(0.);
+    if (isConstant(b, 1.))
+      return a;
+    break;
+  case Operation::Power:
+    if (isConstant(b, 1.))
+      return a;
+    if (isConstant(b, 2.))
+      return binary(Operation::Multiply, a, a);
+    break;
+  default:
+    break;
+  }
+  return makeNode(operation, a, b);
+}
+
+/**
+ * Parses formulas in the syntax of muParser, with its precedence of the
+ * operators: the signs bind more tightly than * and /, and less tightly than
+ * ^. Chained powers (a^b^c) are rejected rather than guessing their
+ * associativity.
+ */
+class Parser {
+public:
+  Parser(const std::string &formula,
+         const std::vector<std::string> &parameterNames)
+      : m_formula(formula), m_parameterNames(parameterNames), m_i(0) {}
+
+  NodePtr parse() {
+    auto node = expression();
+    skipSpaces();
+    if (m_i != m_formula.size())
+      fail("Unexpected character");
+    return node;
+  }
+
+private:
+  [[noreturn]] void fail(const std::string &message) const {
+    throw std::invalid_argument(message + " at position " +
+                                std::to_string(m_i) + " of formula " +
+                                m_formula);
+  }
+
+  void skipSpaces() {
+    while (m_i < m_formula.size() &&
+           std::isspace(static_cast<unsigned char>(m_formula[m_i])))
+      ++m_i;
+  }
+
+  bool accept(const char c) {
+    skipSpaces();
+    if (m_i < m_formula.size() && m_formula[m_i] == c) {
+      ++m_i;
+      return true;
+    }
+    return false;
+  }
+
+  bool isDigit(const size_t i) const {
+    return i < m_formula.size() &&
+           std::isdigit(static_cast<unsigned char>(m_formula[i]));
+  }
+
+  NodePtr expression() {
+    auto node = term();
+    for (;;) {
+      if (accept('+')) {
+        auto right = term();
+        node = binary(Operation::Add, node, right);
+      } else if (accept('-')) {
+        auto right = term();
+        node = binary(Operation::Subtract, node, right);
+      } else {
+        return node;
+      }
+    }
+  }
+
+  NodePtr term() {
+    auto node = signedPower();
+    for (;;) {
+      if (accept('*')) {
+        auto right = signedPower();
+        node = binary(Operation::Multiply, node, right);
+      } else if (accept('/')) {
+        auto right = signedPower();
+        node = binary(Operation::Divide, node, right);
+      } else {
+        return node;
+      }
+    }
+  }
+
+  NodePtr signedPower() {
+    if (accept('-'))
+      return unary(Operation::Negate, signedPower());
+    if (accept('+'))
+      return signedPower();
+    auto base = primary();
+    if (!accept('^'))
+      return base;
+    auto exponent = signedPrimary();
+    if (accept('^'))
+      fail("Chained powers are not supported");
+    return binary(Operation::Power, base, exponent);
+  }
+
+  NodePtr signedPrimary() {
+    if (accept('-'))
+      return unary(Operation::Negate, signedPrimary());
+    if (accept('+'))
+      return signedPrimary();
+    return primary();
+  }
+
+  NodePtr primary() {
+    if (accept('(')) {
+      auto node = expression();
+      if (!accept(')'))
+        fail("Expected )");
+      return node;
+    }
+    skipSpaces();
+    if (m_i >= m_formula.size())
+      fail("Unexpected end");
+    const auto c = static_cast<unsigned char>(m_formula[m_i]);
+    if (std::isdigit(c) || c == '.')
+      return constant(number());
+    if (!std::isalpha(c) && c != '_')
+      fail("Unexpected character");
+
+    const size_t start = m_i;
+    while (m_i < m_formula.size() &&
+           (std::isalnum(static_cast<unsigned char>(m_formula[m_i])) ||
+            m_formula[m_i] == '_'))
+      ++m_i;
+    const std::string name = m_formula.substr(start, m_i - start);
+    if (accept('(')) {
+      const auto function = FUNCTIONS.find(name);
+      if (function == FUNCTIONS.end())
+        fail("Unsupported function " + name);
+      auto argument = expression();
+      if (!accept(')'))
+        fail("Expected )");
+      return unary(function->second, argument);
+    }
+    return variable(name);
+  }
+
+  double number() {
+    const size_t start = m_i;
+    while (isDigit(m_i))
+      ++m_i;
+    if (m_i < m_formula.size() && m_formula[m_i] == '.') {
+      ++m_i;
+      while (isDigit(m_i))
+        ++m_i;
+    }
+    if (m_i == start + 1 && m_formula[start] == '.')
+      fail("Invalid number");
+    if (m_i < m_formula.size() &&
+        (m_formula[m_i] == 'e' || m_formula[m_i] == 'E')) {
+      size_t i = m_i + 1;
+      if (i < m_formula.size() && (m_formula[i] == '+' || m_formula[i] == '-'))
+        ++i;
+      if (isDigit(i)) {
+        m_i = i;
+        while (isDigit(m_i))
+          ++m_i;
+      }
+    }
+    return std::stod(m_formula.substr(start, m_i - start));
+  }
+
+  NodePtr variable(const std::string &name) {
+    if (name == "x")
+      return makeNode(Operation::X, nullptr, nullptr);
+    if (name == "_pi")
+      return constant(M_PI);
+    if (name == "_e")
+      return constant(M_E);
+    const auto parameter =
+        std::find(m_parameterNames.begin(), m_parameterNames.end(), name);
+    if (parameter == m_parameterNames.end())
+      fail("Unknown variable " + name);
+    return makeNode(Operation::Parameter, nullptr, nullptr, 0.,
+                    static_cast<size_t>(parameter - m_parameterNames.begin()));
+  }
+
+  const std::string &m_formula;
+  const std::vector<std::string> &m_parameterNames;
+  size_t m_i;
+};
+
+/// Differentiates formulas with respect to one parameter. The derivative of
+/// a node shared by several others is only found once.
+class Differentiator {
+public:
+  explicit Differentiator(const size_t parameter) : m_parameter(parameter) {}
+
+  NodePtr operator()(const NodePtr &node) {
+    const auto found = m_derivatives.find(node.get());
+    if (found != m_derivatives.end())
+      return found->second;
+    auto derivative = differentiate(node);
+    m_derivatives.emplace(node.get(), derivative);
+    return derivative;
+  }
+
+private:
+  NodePtr differentiate(const NodePtr &node) {
+    switch (node->operation) {
+    case Operation::Constant:
+    case Operation::X:
+    case Operation::Sign:
+      return constant(0.);
+    case Operation::Parameter:
+      return constant(node->index == m_parameter ? 1. : 0.);
+    default:
+      break;
+    }
+
+    const auto &a = node->a;
+    const auto &b = node->b;
+    const auto da = (*this)(a);
+    const auto db = b ? (*this)(b) : constant(0.);
+    if (isConstant(da, 0.) && isConstant(db, 0.))
+      return constant(0.);
+    // Shorthands for building the derivatives
+    auto add = [](const NodePtr &u, const NodePtr &v) {
+      return binary(Operation::Add, u, v);
+    };
+    auto subtract = [](const NodePtr &u, const NodePtr &v) {
+      return binary(Operation::Subtract, u, v);
+    };
+    auto multiply = [](const NodePtr &u, const NodePtr &v) {
+      return binary(Operation::Multiply, u, v);
+    };
+    auto divide = [](const NodePtr &u, const NodePtr &v) {
+      return binary(Operation::Divide, u, v);
+    };
+    auto function = [](const Operation operation, const NodePtr &u) {
+      return unary(operation, u);
+    };
+    const auto one = constant(1.);
+
+    switch (node->operation) {
+    case Operation::Add:
+      return add(da, db);
+    case Operation::Subtract:
+      return subtract(da, db);
+    case Operation::Multiply:
+      return add(multiply(da, b), multiply(a, db));
+    case Operation::Divide:
+      return divide(subtract(da, multiply(node, db)), b);
+    case Operation::Power:
+      if (isConstant(b))
+        return multiply(multiply(b, binary(Operation::Power, a,
+                                           constant(b->value - 1.))),
+                        da);
+      return multiply(node, add(multiply(db, function(Operation::Ln, a)),
+                                divide(multiply(b, da), a)));
+    case Operation::Negate:
+      return function(Operation::Negate, da);
+    case Operation::Exp:
+      return multiply(node, da);
+    case Operation::Ln:
+      return divide(da, a);
+    case Operation::Log10:
+      return divide(da, multiply(a, constant(M_LN10)));
+    case Operation::Log2:
+      return divide(da, multiply(a, constant(M_LN2)));
+    case Operation::Sqrt:
+      return divide(multiply(constant(0.5), da), node);
+    case Operation::Abs:
+      return multiply(function(Operation::Sign, a), da);
+    case Operation::Sin:
+      return multiply(function(Operation::Cos, a), da);
+    case Operation::Cos:
+      return multiply(
+          function(Operation::Negate, function(Operation::Sin, a)), da);
+    case Operation::Tan:
+      return multiply(add(one, multiply(node, node)), da);
+    case Operation::Asin:
+      return divide(da, function(Operation::Sqrt,
+                                 subtract(one, multiply(a, a))));
+    case Operation::Acos:
+      return function(Operation::Negate,
+                      divide(da, function(Operation::Sqrt,
+                                          subtract(one, multiply(a, a)))));
+    case Operation::Atan:
+      return divide(da, add(one, multiply(a, a)));
+    case Operation::Sinh:
+      return multiply(function(Operation::Cosh, a), da);
+    case Operation::Cosh:
+      return multiply(function(Operation::Sinh, a), da);
+    case Operation::Tanh:
+      return multiply(subtract(one, multiply(node, node)), da);
+    case Operation::Erf:
+    case Operation::Erfc: {
+      const auto gaussian = multiply(
+          constant(node->operation == Operation::Erf ? M_2_SQRTPI
+                                                     : -M_2_SQRTPI),
+          function(Operation::Exp,
+                   function(Operation::Negate, multiply(a, a))));
+      return multiply(gaussian, da);
+    }
+    default:
+      throw std::logic_error("CompiledFormula: cannot differentiate");
+    }
+  }
+
+  size_t m_parameter;
+  std::map<const Node *, NodePtr> m_derivatives;
+};
+
+/// Turns trees of nodes into a program, with one instruction per distinct
+/// node
+class Assembler {
+public:
+  explicit Assembler(std::vector<CompiledFormula::Instruction> &program)
+      : m_program(program) {}
+
+  /// Add the instructions of a tree and return the register of its result
+  size_t operator()(const NodePtr &node) {
+    const auto found = m_registers.find(node.get());
+    if (found != m_registers.end())
+      return found->second;
+    CompiledFormula::Instruction instruction{node->operation, 0, 0,
+                                             node->value, node->index};
+    if (node->a)
+      instruction.a = (*this)(node->a);
+    if (node->b)
+      instruction.b = (*this)(node->b);
+    m_program.push_back(instruction);
+    const size_t result = m_program.size() - 1;
+    m_registers.emplace(node.get(), result);
+    return result;
+  }
+
+private:
+  std::vector<CompiledFormula::Instruction> &m_program;
+  std::map<const Node *, size_t> m_registers;
+};
+
+/// Apply a function to each value of a block
+template <typename Function>
+void transform(const double *a, const size_t n, double *result,
+               Function function) {
+  std::transform(a, a + n, result, function);
+}
+
+/// Apply a function to each pair of values of two blocks
+template <typename Function>
+void transform(const double *a, const double *b, const size_t n,
+               double *result, Function function) {
+  std::transform(a, a + n, b, result, function);
+}
+} // namespace
+
+/**
+ * Compile a formula
+ * @param formula :: A muParser expression of x and the parameters
+ * @param parameterNames :: The names of the parameters, in the order of their
+ * values and derivatives
+ * @throws std::invalid_argument if the formula uses anything not supported
+ */
+CompiledFormula::CompiledFormula(const std::string &formula,
+                                 const std::vector<std::string> &parameterNames)
+    : m_nParams(parameterNames.size()) {
+  const auto value = Parser(formula, parameterNames).parse();
+  std::vector<NodePtr> derivatives;
+  for (size_t i = 0; i < m_nParams; ++i) {
+    derivatives.push_back(Differentiator(i)(value));
+  }
+
+  Assembler assemble(m_program);
+  m_valueRegister = assemble(value);
+  for (const auto &derivative : derivatives) {
+    m_derivativeRegisters.push_back(assemble(derivative));
+  }
+}
+
+/**
+ * Compiling a formula takes much longer than evaluating it, and functions
+ * are often copied, so the compiled formulas are cached.
+ * @param formula :: A muParser expression of x and the parameters
+ * @param parameterNames :: The names of the parameters
+ * @return the compiled formula, or a null pointer if the formula uses
+ * anything not supported
+ */
+boost::shared_ptr<const CompiledFormula>
+CompiledFormula::compile(const std::string &formula,
+                         const std::vector<std::string> &parameterNames) {
+  static std::mutex cacheMutex;
+  static std::map<std::string, boost::shared_ptr<const CompiledFormula>> cache;
+
+  std::string key = formula;
+  for (const auto &name : parameterNames) {
+    key += '\n' + name;
+  }
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  const auto found = cache.find(key);
+  if (found != cache.end())
+    return found->second;
+
+  boost::shared_ptr<const CompiledFormula> compiled;
+  try {
+    compiled = boost::make_shared<const CompiledFormula>(formula,
+                                                         parameterNames);
+  } catch (std::invalid_argument &) {
+    // Left to muParser
+  }
+  if (cache.size() >= MAX_CACHE_SIZE)
+    cache.clear();
+  cache.emplace(key, compiled);
+  return compiled;
+}
+
+/**
+ * Run the program on blocks of x values, passing the registers of each block
+ * to an output.
+ * @param xValues :: The x values
+ * @param nData :: The number of x values
+ * @param parameters :: The values of the parameters
+ * @param output :: Called with the index of the first x value of a block,
+ * the size of the block and the registers
+ */
+template <typename Output>
+void CompiledFormula::run(const double *xValues, const size_t nData,
+                          const std::vector<double> &parameters,
+                          Output output) const {
+  if (parameters.size() != m_nParams)
+    throw std::invalid_argument("CompiledFormula: wrong number of parameters");
+  std::vector<double> registers(m_program.size() * BLOCK_SIZE);
+  for (size_t start = 0; start < nData; start += BLOCK_SIZE) {
+    const size_t n = std::min(BLOCK_SIZE, nData - start);
+    for (size_t k = 0; k < m_program.size(); ++k) {
+      const auto &instruction = m_program[k];
+      double *result = &registers[k * BLOCK_SIZE];
+      const double *a = &registers[instruction.a * BLOCK_SIZE];
+      const double *b = &registers[instruction.b * BLOCK_SIZE];
+      switch (instruction.operation) {
+      case Operation::Constant:
+        std::fill_n(result, n, instruction.value);
+        break;
+      case Operation::X:
+        std::copy_n(xValues + start, n, result);
+        break;
+      case Operation::Parameter:
+        std::fill_n(result, n, parameters[instruction.index]);
+        break;
+      case Operation::Add:
+        transform(a, b, n, result, std::plus<double>());
+        break;
+      case Operation::Subtract:
+        transform(a, b, n, result, std::minus<double>());
+        break;
+      case Operation::Multiply:
+        transform(a, b, n, result, std::multiplies<double>());
+        break;
+      case Operation::Divide:
+        transform(a, b, n, result, std::divides<double>());
+        break;
+      case Operation::Power:
+        transform(a, b, n, result,
+                  [](double u, double v) { return std::pow(u, v); });
+        break;
+      case Operation::Negate:
+        transform(a, n, result, std::negate<double>());
+        break;
+      case Operation::Sign:
+        transform(a, n, result, sign);
+        break;
+      case Operation::Exp:
+        transform(a, n, result, [](double u) { return std::exp(u); });
+        break;
+      case Operation::Ln:
+        transform(a, n, result, [](double u) { return std::log(u); });
+        break;
+      case Operation::Sqrt:
+        transform(a, n, result, [](double u) { return std::sqrt(u); });
+        break;
+      case Operation::Sin:
+        transform(a, n, result, [](double u) { return std::sin(u); });
+        break;
+      case Operation::Cos:
+        transform(a, n, result, [](double u) { return std::cos(u); });
+        break;
+      default: {
+        // The less common functions
+        const auto operation = instruction.operation;
+        transform(a, n, result, [operation](double u) {
+          return apply(operation, u, 0.);
+        });
+      }
+      }
+    }
+    output(start, n, registers);
+  }
+}
+
+/**
+ * @param out :: The values of the formula
+ * @param xValues :: The x values
+ * @param nData :: The number of x values
+ * @param parameters :: The values of the parameters
+ */
+void CompiledFormula::function(double *out, const double *xValues,
+                               const size_t nData,
+                               const std::vector<double> &parameters) const {
+  run(xValues, nData, parameters,
+      [this, out](const size_t start, const size_t n,
+                  const std::vector<double> &registers) {
+        std::copy_n(&registers[m_valueRegister * BLOCK_SIZE], n, out + start);
+      });
+}
+
+/**
+ * @param jacobian :: The derivatives with respect to the parameters, in the
+ * order of their names
+ * @param xValues :: The x values
+ * @param nData :: The number of x values
+ * @param parameters :: The values of the parameters
+ */
+void CompiledFormula::derivatives(API::Jacobian &jacobian,
+                                  const double *xValues, const size_t nData,
+                                  const std::vector<double> &parameters) const {
+  run(xValues, nData, parameters,
+      [this, &jacobian](const size_t start, const size_t n,
+                        const std::vector<double> &registers) {
+        for (size_t iP = 0; iP < m_nParams; ++iP) {
+          const double *derivative =
+              &registers[m_derivativeRegisters[iP] * BLOCK_SIZE];
+          for (size_t i = 0; i < n; ++i)
+            jacobian.set(start + i, iP, derivative[i]);
+        }
+      });
+}
+
+} // namespace CurveFitting
+} // namespace Mantid
@@ -300,7 +300,7 @@ double CostFuncFitting::val() const {
     if (!m_values) {
       throw std::runtime_error("CostFunction: undefined FunctionValues.");
     }
-    addVal(m_domain, m_values);
+    addVal(m_function, m_domain, m_values);
   }
 
   // add penalty
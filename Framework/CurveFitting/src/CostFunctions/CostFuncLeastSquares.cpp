@@ -16,6 +16,7 @@
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/MultiThreaded.h"
 
+#include <algorithm>
 #include <sstream>
 
 namespace Mantid {
@@ -36,12 +37,14 @@ CostFuncLeastSquares::CostFuncLeastSquares()
 /**
  * Add a contribution to the cost function value from the fitting function
  * evaluated on a particular domain.
+ * @param function :: The fitting function, or a copy of it
  * @param domain :: A domain
  * @param values :: Values
  */
-void CostFuncLeastSquares::addVal(API::FunctionDomain_sptr domain,
+void CostFuncLeastSquares::addVal(API::IFunction_sptr function,
+                                  API::FunctionDomain_sptr domain,
                                   API::FunctionValues_sptr values) const {
-  m_function->function(*domain, *values);
+  function->function(*domain, *values);
   size_t ny = values->size();
 
   double retVal = 0.0;
@@ -79,29 +82,36 @@ void CostFuncLeastSquares::addValDerivHessian(API::IFunction_sptr function,
   Jacobian jacobian(ny, np);
   function->functionDeriv(*domain, jacobian);
 
-  size_t iActiveP = 0;
-  double fVal = 0.0;
   std::vector<double> weights = getFitWeights(values);
+  double fVal = 0.0;
+  std::vector<double> residuals(ny);
+  for (size_t i = 0; i < ny; ++i) {
+    double y = (values->getCalculated(i) - values->getFitData(i)) * weights[i];
+    residuals[i] = y * weights[i];
+    fVal += y * y;
+  }
 
+  // The data points where the derivatives of each active parameter are not
+  // zero. In a fit over many domains a local parameter only has derivatives
+  // on its own domain, so the sums below only run over these ranges.
+  std::vector<size_t> activeParameters;
+  std::vector<std::pair<size_t, size_t>> ranges;
   for (size_t ip = 0; ip < np; ++ip) {
-    if (!function->isActive(ip))
-      continue;
-    double d = 0.0;
-    for (size_t i = 0; i < ny; ++i) {
-      double calc = values->getCalculated(i);
-      double obs = values->getFitData(i);
-      double w = weights[i];
-      double y = (calc - obs) * w;
-      d += y * jacobian.get(i, ip) * w;
-      if (iActiveP == 0) {
-        fVal += y * y;
-      }
+    if (function->isActive(ip)) {
+      activeParameters.push_back(ip);
+      ranges.push_back(jacobian.nonZeroRange(ip));
     }
+  }
+
+  for (size_t iActiveP = 0; iActiveP < activeParameters.size(); ++iActiveP) {
+    const size_t ip = activeParameters[iActiveP];
+    double d = 0.0;
+    for (size_t i = ranges[iActiveP].first; i < ranges[iActiveP].second; ++i)
+      d += residuals[i] * jacobian.get(i, ip);
     PARALLEL_CRITICAL(der_set) {
       double der = m_der.get(iActiveP);
       m_der.set(iActiveP, der + d);
     }
-    ++iActiveP;
   }
 
   PARALLEL_ATOMIC
@@ -110,18 +120,18 @@ void CostFuncLeastSquares::addValDerivHessian(API::IFunction_sptr function,
   if (!evalHessian)
     return;
 
-  size_t i1 = 0;                  // active parameter index
-  for (size_t i = 0; i < np; ++i) // over parameters
+  for (size_t i1 = 0; i1 < activeParameters.size(); ++i1) // active parameters
   {
-    if (!function->isActive(i))
-      continue;
-    size_t i2 = 0;                  // active parameter index
-    for (size_t j = 0; j <= i; ++j) // over ~ half of parameters
+    const size_t i = activeParameters[i1];
+    for (size_t i2 = 0; i2 <= i1; ++i2) // over ~ half of active parameters
     {
-      if (!function->isActive(j))
-        continue;
+      const size_t j = activeParameters[i2];
+      const size_t kStart = std::max(ranges[i1].first, ranges[i2].first);
+      const size_t kEnd = std::min(ranges[i1].second, ranges[i2].second);
+      if (kStart >= kEnd)
+        continue; // the parameters share no data points
       double d = 0.0;
-      for (size_t k = 0; k < ny; ++k) // over fitting data
+      for (size_t k = kStart; k < kEnd; ++k) // over fitting data
       {
         double w = weights[k];
         d += jacobian.get(k, i) * jacobian.get(k, j) * w * w;
@@ -133,9 +143,7 @@ void CostFuncLeastSquares::addValDerivHessian(API::IFunction_sptr function,
           m_hessian.set(i2, i1, h + d);
         }
       }
-      ++i2;
     }
-    ++i1;
   }
 }
 
@@ -47,12 +47,14 @@ CostFuncPoisson::CostFuncPoisson() : CostFuncFitting() {}
 /**
  * Add a contribution to the cost function value from the fitting function
  * evaluated on a particular domain.
+ * @param function :: The fitting function, or a copy of it
  * @param domain :: A domain
  * @param values :: Values
  */
-void CostFuncPoisson::addVal(API::FunctionDomain_sptr domain,
+void CostFuncPoisson::addVal(API::IFunction_sptr function,
+                             API::FunctionDomain_sptr domain,
                              API::FunctionValues_sptr values) const {
-  m_function->function(*domain, *values);
+  function->function(*domain, *values);
   size_t ny = values->size();
 
   double retVal = 0.0;
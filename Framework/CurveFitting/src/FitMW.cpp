@@ -27,6 +27,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EmptyValues.h"
 #include "MantidKernel/Matrix.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <algorithm>
 #include <cmath>
@@ -180,8 +181,9 @@ void FitMW::declareDatasetProperties(const std::string &suffix, bool addProp) {
       auto mustBePositive = boost::make_shared<BoundedValidator<int>>();
       mustBePositive->setLower(0);
       declareProperty(
-          new PropertyWithValue<int>(m_maxSizePropertyName, 1, mustBePositive),
-          "The maximum number of values per a simple domain.");
+          new PropertyWithValue<int>(m_maxSizePropertyName, 0, mustBePositive),
+          "The maximum number of values per a simple domain. If 0 a "
+          "Parallel domain is split evenly between the threads.");
     }
     if (!m_manager->existsProperty(m_normalisePropertyName)) {
       declareProperty(
@@ -216,7 +218,14 @@ void FitMW::createDomain(boost::shared_ptr<API::FunctionDomain> &domain,
   auto n = endIndex - m_startIndex;
 
   if (m_domainType != Simple) {
-    if (m_maxSize < n) {
+    // A MaxSize of 0 splits a parallel domain into one part per thread and
+    // leaves a sequential one whole
+    size_t maxSize = m_maxSize;
+    if (maxSize == 0) {
+      const auto nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+      maxSize = m_domainType == Parallel ? (n + nThreads - 1) / nThreads : n;
+    }
+    if (maxSize < n) {
       SeqDomain *seqDomain = SeqDomain::create(m_domainType);
       domain.reset(seqDomain);
       size_t m = 0;
@@ -225,7 +234,7 @@ void FitMW::createDomain(boost::shared_ptr<API::FunctionDomain> &domain,
         auto creator = new FitMW;
         creator->setWorkspace(m_matrixWorkspace);
         creator->setWorkspaceIndex(m_workspaceIndex);
-        size_t k = m + m_maxSize;
+        size_t k = m + maxSize;
         if (k > n)
           k = n;
         creator->setRange(*(from + m), *(from + k - 1));
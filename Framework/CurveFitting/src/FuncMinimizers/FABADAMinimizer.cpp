@@ -28,10 +28,12 @@
 #include "MantidKernel/PseudoRandomNumberGenerator.h"
 #include "MantidKernel/normal_distribution.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <numeric>
 #include <random>
 
 namespace Mantid {
@@ -51,6 +53,10 @@ const size_t LOWER_CONVERGENCE_LIMIT = 350;
 const size_t JUMP_CHECKING_RATE = 200;
 // low jump limit
 const double LOW_JUMP_LIMIT = 1e-25;
+// number of segments of the posterior chain compared by the Gelman-Rubin check
+const size_t GELMAN_RUBIN_SEGMENTS = 4;
+// minimum number of chain points in each of the segments
+const size_t GELMAN_RUBIN_MIN_SEGMENT_LENGTH = 500;
 // random number generator
 std::mt19937 rng;
 
@@ -74,6 +80,40 @@ createWorkspace(std::vector<double> const &xValues,
   return createWorkspaceAlgorithm->getProperty("OutputWorkspace");
 }
 
+/** The Gelman-Rubin potential scale reduction factor of consecutive segments
+ * of a chain, each taken as an independent chain
+ * @param chain :: the start of the chain
+ * @param segmentLength :: the number of chain points in each segment
+ * @return :: the factor, which approaches 1 as the chain mixes
+ */
+double splitGelmanRubin(std::vector<double>::const_iterator chain,
+                        const size_t segmentLength) {
+  const auto n = static_cast<double>(segmentLength);
+  std::vector<double> means(GELMAN_RUBIN_SEGMENTS);
+  double within = 0.;
+  for (size_t s = 0; s < GELMAN_RUBIN_SEGMENTS; ++s) {
+    const auto begin = chain + s * segmentLength;
+    const auto end = begin + segmentLength;
+    means[s] = std::accumulate(begin, end, 0.) / n;
+    double variance = 0.;
+    for (auto value = begin; value != end; ++value)
+      variance += (*value - means[s]) * (*value - means[s]);
+    within += variance / (n - 1.);
+  }
+  within /= static_cast<double>(GELMAN_RUBIN_SEGMENTS);
+  // A parameter that never moves has nothing left to mix
+  if (within == 0.)
+    return 1.;
+  const double mean = std::accumulate(means.begin(), means.end(), 0.) /
+                      static_cast<double>(GELMAN_RUBIN_SEGMENTS);
+  double between = 0.;
+  for (const double segmentMean : means)
+    between += (segmentMean - mean) * (segmentMean - mean);
+  between /= static_cast<double>(GELMAN_RUBIN_SEGMENTS - 1);
+  const double pooled = (n - 1.) / n * within + between;
+  return std::sqrt(pooled / within);
+}
+
 } // namespace
 
 DECLARE_FUNCMINIMIZER(FABADAMinimizer, FABADA)
@@ -82,10 +122,11 @@ DECLARE_FUNCMINIMIZER(FABADAMinimizer, FABADA)
 FABADAMinimizer::FABADAMinimizer()
     : m_counter(0), m_chainIterations(0), m_changes(), m_jump(), m_parameters(),
       m_chain(), m_chi2(0.), m_converged(false), m_convPoint(0),
-      m_parConverged(), m_criteria(), m_maxIter(0), m_parChanged(),
-      m_temperature(0.), m_counterGlobal(0), m_simAnnealingItStep(0),
-      m_leftRefrPoints(0), m_tempStep(0.), m_overexploration(false),
-      m_nParams(0), m_numInactiveRegenerations(), m_changesOld() {
+      m_posteriorConverged(false), m_parConverged(), m_criteria(),
+      m_maxIter(0), m_parChanged(), m_temperature(0.), m_counterGlobal(0),
+      m_simAnnealingItStep(0), m_leftRefrPoints(0), m_tempStep(0.),
+      m_overexploration(false), m_nParams(0), m_numInactiveRegenerations(),
+      m_changesOld() {
   declareProperty("ChainLength", static_cast<size_t>(10000),
                   "Length of the converged chain.");
   declareProperty("StepsBetweenValues", 10,
@@ -99,6 +140,11 @@ FABADAMinimizer::FABADAMinimizer()
                   " a certain parameter to be converged");
   declareProperty("JumpAcceptanceRate", 0.6666666,
                   "Desired jumping acceptance rate");
+  declareProperty("GelmanRubinThreshold", 0.0,
+                  "If positive, the posterior chain stops before ChainLength"
+                  " steps once the Gelman-Rubin statistic of four segments"
+                  " of it is below this value for every parameter"
+                  " (1.1 is usual).");
   // Simulated Annealing properties
   declareProperty("SimAnnealingApplied", false,
                   "If minimization should be run with Simulated"
@@ -164,6 +210,7 @@ void FABADAMinimizer::initialize(API::ICostFunction_sptr function,
   m_counter = 0;
   m_counterGlobal = 0;
   m_converged = false;
+  m_posteriorConverged = false;
   m_maxIter = maxIterations;
 
   // Initialize member variables related to fitting parameters, such as
@@ -298,6 +345,10 @@ bool FABADAMinimizer::iterate(size_t /*iteration*/) {
   // if overexploring or Simulated Annealing completed
   convergenceCheck(); // updates m_converged
 
+  // Check whether the posterior chain has mixed well enough to stop early
+  if (m_converged && m_counter % JUMP_CHECKING_RATE == 0)
+    gelmanRubinCheck(); // updates m_posteriorConverged
+
   // Check wheather it is refrigeration time or not (for Simulated Annealing)
   if (m_leftRefrPoints != 0 && m_counter == m_simAnnealingItStep) {
     simAnnealingRefrigeration();
@@ -318,6 +369,9 @@ void FABADAMinimizer::finalize() {
   // Creating the reduced chain (considering only one each
   // "Steps between values" values)
   size_t chainLength = getProperty("ChainLength");
+  // A posterior chain stopped early is shorter
+  if (m_posteriorConverged)
+    chainLength = m_chain[0].size() - m_convPoint;
   int nSteps = getProperty("StepsBetweenValues");
   if (nSteps <= 0) {
     g_log.warning() << "StepsBetweenValues has a non valid value"
@@ -642,6 +696,38 @@ void FABADAMinimizer::convergenceCheck() {
   }
 }
 
+/** Check whether the posterior chain has mixed well enough to stop it
+ * before ChainLength steps. The chain is split into segments, which are
+ * compared as independent chains by the Gelman-Rubin statistic.
+ *
+ */
+void FABADAMinimizer::gelmanRubinCheck() {
+  const double threshold = getProperty("GelmanRubinThreshold");
+  if (threshold <= 0.)
+    return;
+  const size_t segmentLength =
+      (m_chain[0].size() - m_convPoint) / GELMAN_RUBIN_SEGMENTS;
+  if (segmentLength < GELMAN_RUBIN_MIN_SEGMENT_LENGTH)
+    return;
+
+  double worst = 0.;
+  for (size_t j = 0; j < m_nParams; ++j) {
+    if (m_fitFunction->isFixed(j))
+      continue;
+    const double rHat = splitGelmanRubin(
+        m_chain[j].cbegin() + static_cast<std::ptrdiff_t>(m_convPoint),
+        segmentLength);
+    worst = std::max(worst, rHat);
+  }
+  if (worst < threshold) {
+    m_posteriorConverged = true;
+    g_log.notice() << "Posterior chain stopped after "
+                   << GELMAN_RUBIN_SEGMENTS * segmentLength
+                   << " steps, with a Gelman-Rubin statistic of " << worst
+                   << "\n";
+  }
+}
+
 /** Refrigerates the system if appropriate
  *
  */
@@ -700,8 +786,8 @@ bool FABADAMinimizer::iterationContinuation() {
     }
   } else {
     // If convergence has been reached, continue until we complete the chain
-    // length. Otherwise, stop interations.
-    return m_counter < m_chainIterations;
+    // length or the chain has mixed. Otherwise, stop interations.
+    return m_counter < m_chainIterations && !m_posteriorConverged;
   }
   // can we even get here? -> Nope (we should not, so we do not want it to
   // continue)
@@ -7,9 +7,11 @@
 #include <cmath>
 
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidCurveFitting/DualNumber.h"
 #include "MantidCurveFitting/Functions/Bk2BkExpConvPV.h"
 #include "MantidKernel/System.h"
 
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_sf_erf.h>
 
 using namespace Mantid::Kernel;
@@ -92,80 +94,99 @@ double Bk2BkExpConvPV::centre() const {
  */
 void Bk2BkExpConvPV::functionLocal(double *out, const double *xValues,
                                    const size_t nData) const {
+  std::array<double, 6> parameters;
+  for (size_t i = 0; i < parameters.size(); ++i)
+    parameters[i] = getParameter(i);
+  calculatePeak(parameters, xValues, nData,
+                [out](const size_t i, const double value) { out[i] = value; });
+}
+
+/** Local derivative, exact through automatic differentiation
+ */
+void Bk2BkExpConvPV::functionDerivLocal(API::Jacobian *jacobian,
+                                        const double *xValues,
+                                        const size_t nData) {
+  using Dual = AutoDiff::DualNumber<6>;
+  calculatePeak(parameterVariables<6>(*this), xValues, nData,
+                [jacobian](const size_t i, const Dual &value) {
+                  setJacobianRow(*jacobian, i, value);
+                });
+}
+
+/** Calculate the peak at each x
+ * @param parameters :: TOF_h, Height, Alpha, Beta, Sigma2 and Gamma, as
+ * doubles or as dual numbers to calculate the derivatives
+ * @param xValues :: the x values
+ * @param nData :: the number of x values
+ * @param output :: called with the index and the value of each point
+ */
+template <typename T, typename Output>
+void Bk2BkExpConvPV::calculatePeak(const std::array<T, 6> &parameters,
+                                   const double *xValues, const size_t nData,
+                                   const Output &output) const {
+  using std::sqrt;
   // 1. Prepare constants
-  const double alpha = this->getParameter("Alpha");
-  const double beta = this->getParameter("Beta");
-  const double sigma2 = this->getParameter("Sigma2");
-  const double gamma = this->getParameter("Gamma");
-  const double height = this->getParameter("Height");
-  const double tof_h = this->getParameter("TOF_h");
+  const T &tof_h = parameters[0];
+  const T &height = parameters[1];
+  const T &alpha = parameters[2];
+  const T &beta = parameters[3];
+  const T &sigma2 = parameters[4];
+  const T &gamma = parameters[5];
 
-  double invert_sqrt2sigma = 1.0 / sqrt(2.0 * sigma2);
-  double N = alpha * beta * 0.5 / (alpha + beta);
+  const T invert_sqrt2sigma = 1.0 / sqrt(2.0 * sigma2);
+  const T N = alpha * beta * 0.5 / (alpha + beta);
 
-  double H, eta;
+  T H, eta;
   calHandEta(sigma2, gamma, H, eta);
 
-  /*
-  g_log.debug() << "DB1143:  nData = " << nData << " From " << xValues[0] << "
-  To " << xValues[nData-1]
-                << " TOF_h = " << tof_h << " Height = " << height << " alpha = "
-  << alpha << " beta = "
-                << beta << " H = " << H << " eta = " << eta << '\n';
-                */
-
   // 2. Do calculation for each data point
   for (size_t id = 0; id < nData; ++id) {
-    double dT = xValues[id] - tof_h;
-    double omega =
-        calOmega(dT, eta, N, alpha, beta, H, sigma2, invert_sqrt2sigma);
-    out[id] = height * omega;
+    const T dT = xValues[id] - tof_h;
+    output(id, height * calOmega(dT, eta, N, alpha, beta, H, sigma2,
+                                 invert_sqrt2sigma));
   }
 }
 
-/** Local derivative
- */
-void Bk2BkExpConvPV::functionDerivLocal(API::Jacobian * /*jacobian*/,
-                                        const double * /*xValues*/,
-                                        const size_t /*nData*/) {
-  throw Mantid::Kernel::Exception::NotImplementedError(
-      "functionDerivLocal is not implemented for IkedaCarpenterPV.");
-}
-
-/** Numerical derivative
- */
-void Bk2BkExpConvPV::functionDeriv(const API::FunctionDomain &domain,
-                                   API::Jacobian &jacobian) {
-  calNumericalDeriv(domain, jacobian);
-}
-
 /** Calculate Omega(x) = ... ...
  */
-double Bk2BkExpConvPV::calOmega(double x, double eta, double N, double alpha,
-                                double beta, double H, double sigma2,
-                                double invert_sqrt2sigma) const {
+template <typename T>
+T Bk2BkExpConvPV::calOmega(const T &x, const T &eta, const T &N,
+                           const T &alpha, const T &beta, const T &H,
+                           const T &sigma2, const T &invert_sqrt2sigma) const {
+  using std::erfc;
+  using std::exp;
   // 1. Prepare
-  std::complex<double> p(alpha * x, alpha * H * 0.5);
-  std::complex<double> q(-beta * x, beta * H * 0.5);
+  const T pRe = alpha * x;
+  const T pIm = alpha * H * 0.5;
+  const T qRe = -beta * x;
+  const T qIm = beta * H * 0.5;
 
-  double u = 0.5 * alpha * (alpha * sigma2 + 2 * x);
-  double y = (alpha * sigma2 + x) * invert_sqrt2sigma;
+  T u = 0.5 * alpha * (alpha * sigma2 + 2 * x);
+  T y = (alpha * sigma2 + x) * invert_sqrt2sigma;
 
-  double v = 0.5 * beta * (beta * sigma2 - 2 * x);
-  double z = (beta * sigma2 - x) * invert_sqrt2sigma;
+  T v = 0.5 * beta * (beta * sigma2 - 2 * x);
+  T z = (beta * sigma2 - x) * invert_sqrt2sigma;
 
   // 2. Calculate
-  double omega1 =
-      (1 - eta) * N * (exp(u) * gsl_sf_erfc(y) + std::exp(v) * gsl_sf_erfc(z));
-  double omega2;
-  if (eta < 1.0E-8) {
-    omega2 = 0.0;
-  } else {
-    omega2 = 2 * N * eta / M_PI * (imag(exp(p) * E1(p)) + imag(exp(q) * E1(q)));
+  T omega1 = (1 - eta) * N * (exp(u) * erfc(y) + exp(v) * erfc(z));
+  T omega2(0.0);
+  if (valueOf(eta) >= 1.0E-8) {
+    omega2 = 2 * N * eta / M_PI *
+             (imagOfExpE1(pRe, pIm) + imagOfExpE1(qRe, qIm));
   }
-  double omega = omega1 + omega2;
+  return omega1 + omega2;
+}
 
-  return omega;
+/** Calculate Im(exp(z) * E_1(z))
+ * @param re :: the real part of z
+ * @param im :: the imaginary part of z
+ */
+template <typename T>
+T Bk2BkExpConvPV::imagOfExpE1(const T &re, const T &im) const {
+  const std::complex<double> z(valueOf(re), valueOf(im));
+  const std::complex<double> value = exp(z) * E1(z);
+  // d/dz (exp(z) * E_1(z)) = exp(z) * E_1(z) - 1 / z
+  return imagOfAnalytic(value, value - 1.0 / z, re, im);
 }
 
 /** Implementation of complex integral E_1
@@ -188,7 +209,7 @@ std::complex<double> Bk2BkExpConvPV::E1(std::complex<double> z) const {
 
     for (size_t k = 0; k < 150; ++k) {
       auto dk = double(k);
-      cr = -cr * dk * z / ((dk + 2.0) * (dk + 2.0));
+      cr = -cr * (dk + 1.0) * z / ((dk + 2.0) * (dk + 2.0));
       e1 += cr;
       if (abs(cr) < abs(e1) * 1.0E-15) {
         // cr is converged to zero
@@ -196,12 +217,12 @@ std::complex<double> Bk2BkExpConvPV::E1(std::complex<double> z) const {
       }
     } // ENDFOR k
 
-    e1 = -e1 - log(z) + (z * e1);
+    e1 = -M_EULER - log(z) + (z * e1);
   } else {
     complex<double> ct0(0.0, 0.0);
     for (int k = 120; k > 0; --k) {
       complex<double> dk(double(k), 0.0);
-      ct0 = dk / (10.0 + dk / (z + ct0));
+      ct0 = dk / (1.0 + dk / (z + ct0));
     } // ENDFOR k
 
     e1 = 1.0 / (z + ct0);
@@ -220,28 +241,31 @@ void Bk2BkExpConvPV::geneatePeak(double *out, const double *xValues,
   this->functionLocal(out, xValues, nData);
 }
 
-void Bk2BkExpConvPV::calHandEta(double sigma2, double gamma, double &H,
-                                double &eta) const {
+template <typename T>
+void Bk2BkExpConvPV::calHandEta(const T &sigma2, const T &gamma, T &H,
+                                T &eta) const {
+  using std::pow;
+  using std::sqrt;
   // 1. Calculate H
-  double H_G = sqrt(8.0 * sigma2 * M_LN2);
-  double H_L = gamma;
+  const T H_G = sqrt(8.0 * sigma2 * M_LN2);
+  const T &H_L = gamma;
 
-  double temp1 = std::pow(H_L, 5) + 0.07842 * H_G * std::pow(H_L, 4) +
-                 4.47163 * std::pow(H_G, 2) * std::pow(H_L, 3) +
-                 2.42843 * std::pow(H_G, 3) * std::pow(H_L, 2) +
-                 2.69269 * std::pow(H_G, 4) * H_L + std::pow(H_G, 5);
+  const T temp1 = pow(H_L, 5) + 0.07842 * H_G * pow(H_L, 4) +
+                  4.47163 * pow(H_G, 2) * pow(H_L, 3) +
+                  2.42843 * pow(H_G, 3) * pow(H_L, 2) +
+                  2.69269 * pow(H_G, 4) * H_L + pow(H_G, 5);
 
-  H = std::pow(temp1, 0.2);
+  H = pow(temp1, 0.2);
 
-  mFWHM = H;
+  mFWHM = valueOf(H);
 
   // 2. Calculate eta
-  double gam_pv = H_L / H;
-  eta = 1.36603 * gam_pv - 0.47719 * std::pow(gam_pv, 2) +
-        0.11116 * std::pow(gam_pv, 3);
+  const T gam_pv = H_L / H;
+  eta = 1.36603 * gam_pv - 0.47719 * pow(gam_pv, 2) +
+        0.11116 * pow(gam_pv, 3);
 
-  if (eta > 1 || eta < 0) {
-    g_log.error() << "Bk2BkExpConvPV: Calculated eta = " << eta
+  if (valueOf(eta) > 1 || valueOf(eta) < 0) {
+    g_log.error() << "Bk2BkExpConvPV: Calculated eta = " << valueOf(eta)
                   << " is out of range [0, 1].\n";
   }
 }
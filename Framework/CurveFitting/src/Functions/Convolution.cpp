@@ -14,8 +14,11 @@
 #include "MantidAPI/IFunction1D.h"
 #include "MantidCurveFitting/Functions/DeltaFunction.h"
 
+#include <boost/make_shared.hpp>
+
 #include <algorithm>
 #include <cmath>
+#include <complex>
 #include <functional>
 
 #include <gsl/gsl_errno.h>
@@ -74,19 +77,83 @@ void Convolution::setAttribute(const std::string &attName,
 namespace {
 // anonymous namespace for local definitions
 
-// A struct incapsulating workspaces for real fft
-struct RealFFTWorkspace {
-  explicit RealFFTWorkspace(size_t nData)
-      : workspace(gsl_fft_real_workspace_alloc(nData)),
-        wavetable(gsl_fft_real_wavetable_alloc(nData)) {}
-  ~RealFFTWorkspace() {
+/// The number of terms in the approximation of the Faddeeva function
+const size_t FADDEEVA_TERMS = 40;
+
+/// The coefficients of the polynomial in Weideman's approximation of the
+/// Faddeeva function
+std::vector<double> faddeevaCoefficients() {
+  const size_t m = 2 * FADDEEVA_TERMS;
+  const double l = std::sqrt(FADDEEVA_TERMS / M_SQRT2);
+  std::vector<double> coefficients(FADDEEVA_TERMS);
+  for (size_t n = 1; n <= FADDEEVA_TERMS; ++n) {
+    double sum = 0.;
+    for (size_t k = 1; k < m; ++k) {
+      const double t = l * std::tan(static_cast<double>(k) * M_PI /
+                                    (2. * static_cast<double>(m)));
+      sum += 2. * std::exp(-t * t) * (l * l + t * t) *
+             std::cos(M_PI * static_cast<double>(k * n) /
+                      static_cast<double>(m));
+    }
+    coefficients[n - 1] = (l * l + sum) / (2. * static_cast<double>(m));
+  }
+  return coefficients;
+}
+
+/**
+ * The real part of the Faddeeva function w(z) = exp(-z^2) erfc(-iz) in the
+ * upper half plane, using the rational approximation of J.A.C. Weideman,
+ * SIAM J. Numer. Anal. 31 (1994) 1497, accurate to about 1e-10.
+ * @param x :: The real part of z
+ * @param y :: The imaginary part of z, y >= 0
+ * @return Re w(x + iy)
+ */
+double realFaddeeva(const double x, const double y) {
+  static const auto coefficients = faddeevaCoefficients();
+  const double l = std::sqrt(FADDEEVA_TERMS / M_SQRT2);
+  // l - iz and the Moebius transform (l + iz) / (l - iz) of z
+  const std::complex<double> denominator(l + y, -x);
+  const auto z = std::complex<double>(l - y, x) / denominator;
+  std::complex<double> polynomial = 0.;
+  for (auto c = coefficients.rbegin(); c != coefficients.rend(); ++c) {
+    polynomial = polynomial * z + *c;
+  }
+  const auto w = (2. * polynomial / denominator + M_2_SQRTPI / 2.) /
+                 denominator;
+  return w.real();
+}
+} // namespace
+
+/// The wavetables and workspace of the GSL real and half-complex transforms
+struct Convolution::FFTWorkspace {
+  explicit FFTWorkspace(size_t nData)
+      : size(nData), workspace(gsl_fft_real_workspace_alloc(nData)),
+        wavetable(gsl_fft_real_wavetable_alloc(nData)),
+        inverseWavetable(gsl_fft_halfcomplex_wavetable_alloc(nData)) {}
+  ~FFTWorkspace() {
+    gsl_fft_halfcomplex_wavetable_free(inverseWavetable);
     gsl_fft_real_wavetable_free(wavetable);
     gsl_fft_real_workspace_free(workspace);
   }
+  FFTWorkspace(const FFTWorkspace &) = delete;
+  FFTWorkspace &operator=(const FFTWorkspace &) = delete;
+  const size_t size;
   gsl_fft_real_workspace *workspace;
   gsl_fft_real_wavetable *wavetable;
+  gsl_fft_halfcomplex_wavetable *inverseWavetable;
 };
-} // namespace
+
+/**
+ * The FFT wavetables and workspace are only allocated again when the size of
+ * the domain changes.
+ * @param nData :: The size of the domain
+ */
+Convolution::FFTWorkspace &Convolution::fftWorkspace(size_t nData) const {
+  if (!m_fftWorkspace || m_fftWorkspace->size != nData) {
+    m_fftWorkspace = boost::make_shared<FFTWorkspace>(nData);
+  }
+  return *m_fftWorkspace;
+}
 
 /**
  * Calculates convolution of the two member functions. Switches from FFT mode
@@ -102,6 +169,9 @@ void Convolution::function(const FunctionDomain &domain,
     values.zeroCalculated();
     return;
   }
+  if (functionAnalytic(domain, values)) {
+    return;
+  }
   const auto &d1d = dynamic_cast<const FunctionDomain1D &>(domain);
   const size_t nData = domain.size();
   const double *xValues = d1d.getPointerAt(0);
@@ -133,17 +203,24 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
   const auto &d1d = dynamic_cast<const FunctionDomain1D &>(domain);
   size_t nData = domain.size();
   const double *xValues = d1d.getPointerAt(0);
+  // the transform of the resolution is only valid on the domain it was
+  // calculated for
+  const double resolutionStep =
+      (xValues[nData - 1] - xValues[0]) / static_cast<double>((nData - 1));
+  if (m_resolution.size() != nData || m_resolutionStep != resolutionStep) {
+    m_resolution.clear();
+  }
   refreshResolution();
-  RealFFTWorkspace workspace(nData);
+  auto &workspace = fftWorkspace(nData);
   int n2 = static_cast<int>(nData) / 2;
   bool odd = n2 * 2 != static_cast<int>(nData);
   if (m_resolution.empty()) {
     m_resolution.resize(nData);
+    m_resolutionStep = resolutionStep;
     // the resolution must be defined on interval -L < xr < L, L ==
     // (xValues[nData-1] - xValues[0]) / 2
     std::vector<double> xr(nData);
-    double dx =
-        (xValues[nData - 1] - xValues[0]) / static_cast<double>((nData - 1));
+    const double dx = resolutionStep;
     // make sure that xr[nData/2] == 0.0
     xr[n2] = 0.0;
     for (int i = 1; i < n2; i++) {
@@ -265,11 +342,8 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
     }
 
     // Inverse fourier transform of fun
-    gsl_fft_halfcomplex_wavetable *wavetable_r =
-        gsl_fft_halfcomplex_wavetable_alloc(nData);
-    gsl_fft_halfcomplex_inverse(out, 1, nData, wavetable_r,
+    gsl_fft_halfcomplex_inverse(out, 1, nData, workspace.inverseWavetable,
                                 workspace.workspace);
-    gsl_fft_halfcomplex_wavetable_free(wavetable_r);
 
     // Inverse fourier transform is integration - multiply by the step in the
     // integration variable
@@ -346,9 +420,8 @@ void Convolution::functionDirectMode(const FunctionDomain &domain,
   if (!resolution) {
     throw std::runtime_error("Convolution can work only with 1D functions");
   }
-  if (m_resolution.empty()) {
-    m_resolution.resize(nData);
-  }
+  m_resolution.resize(nData);
+  m_resolutionStep = 0.;
   resolution->function1D(m_resolution.data(), xValues, nData);
 
   // Reverse the axis of the resolution data
@@ -435,6 +508,64 @@ void Convolution::functionDirectMode(const FunctionDomain &domain,
 
 } // end of Convolution::functionDirectMode()
 
+/**
+ * Calculates the convolution analytically when it has a closed form, which is
+ * when a Gaussian resolution is convolved with Lorentzians: each gives a
+ * Voigt profile. Unlike the FFT this has no discretisation or wrap-around
+ * error, and it does not depend on the symmetry of the domain.
+ * @param domain :: space on which the function acts
+ * @param values :: buffer to store the values returned by the function after
+ * acting on the domain.
+ * @return false, leaving the values untouched, if there is no closed form
+ */
+bool Convolution::functionAnalytic(const FunctionDomain &domain,
+                                   FunctionValues &values) const {
+  if (nFunctions() != 2 || getFunction(0)->name() != "Gaussian") {
+    return false;
+  }
+  std::vector<IFunction_sptr> lorentzians;
+  auto model = getFunction(1);
+  if (model->name() == "CompositeFunction") {
+    const auto &cf = dynamic_cast<const CompositeFunction &>(*model);
+    for (size_t i = 0; i < cf.nFunctions(); ++i) {
+      lorentzians.push_back(cf.getFunction(i));
+    }
+  } else {
+    lorentzians.push_back(model);
+  }
+  for (const auto &lorentzian : lorentzians) {
+    if (lorentzian->name() != "Lorentzian" ||
+        !(lorentzian->getParameter("FWHM") > 0.)) {
+      return false;
+    }
+  }
+  const auto &resolution = *getFunction(0);
+  const double sigma = std::abs(resolution.getParameter("Sigma"));
+  if (sigma == 0.) {
+    return false;
+  }
+
+  // A Gaussian of height h convolved with a Lorentzian of amplitude a is
+  // h a Re w(z), where z = (x - centres + i FWHM / 2) / (sigma sqrt(2))
+  const double height = resolution.getParameter("Height");
+  const double centre = resolution.getParameter("PeakCentre");
+  const double scale = 1. / (sigma * M_SQRT2);
+  const auto &d1d = dynamic_cast<const FunctionDomain1D &>(domain);
+  const size_t nData = domain.size();
+  const double *xValues = d1d.getPointerAt(0);
+  values.zeroCalculated();
+  double *out = values.getPointerToCalculated(0);
+  for (const auto &lorentzian : lorentzians) {
+    const double amplitude = height * lorentzian->getParameter("Amplitude");
+    const double shift = centre + lorentzian->getParameter("PeakCentre");
+    const double y = 0.5 * lorentzian->getParameter("FWHM") * scale;
+    for (size_t i = 0; i < nData; ++i) {
+      out[i] += amplitude * realFaddeeva((xValues[i] - shift) * scale, y);
+    }
+  }
+  return true;
+}
+
 /**
  * The first function added must be the resolution.
  * The second is the convoluted (model) function. If third, fourth and so on
@@ -11,6 +11,7 @@
 #include <cctype>
 #include <functional>
 #include <map>
+#include <utility>
 
 namespace Mantid {
 namespace CurveFitting {
@@ -24,6 +25,14 @@ const std::map<std::string, int> ION_2_NRE{
     {"Eu", 6},  {"Gd", 7},  {"Tb", 8}, {"Dy", 9}, {"Ho", 10},
     {"Er", 11}, {"Tm", 12}, {"Yb", 13}};
 
+// The parameters the crystal field Hamiltonian depends on.
+const std::vector<std::string> FIELD_PARAMETERS{
+    "BmolX", "BmolY", "BmolZ", "BextX", "BextY", "BextZ", "B20",  "B21",
+    "B22",   "B40",   "B41",   "B42",   "B43",   "B44",   "B60",  "B61",
+    "B62",   "B63",   "B64",   "B65",   "B66",   "IB21",  "IB22", "IB41",
+    "IB42",  "IB43",  "IB44",  "IB61",  "IB62",  "IB63",  "IB64", "IB65",
+    "IB66"};
+
 const bool REAL_PARAM_PART = true;
 const bool IMAG_PARAM_PART = false;
 
@@ -372,6 +381,23 @@ void CrystalFieldPeaksBase::calculateEigenSystem(DoubleFortranVector &en,
     nre = ionIter->second;
   }
 
+  // Fitting only the peak widths or intensities leaves the fields unchanged,
+  // so there is no need to diagonalise the same Hamiltonian again.
+  std::vector<double> fields;
+  fields.reserve(FIELD_PARAMETERS.size());
+  for (const auto &name : FIELD_PARAMETERS) {
+    fields.push_back(getParameter(name));
+  }
+  auto &cache = m_eigenSystemCache;
+  if (cache.valid && cache.nre == nre && cache.ion == ion &&
+      cache.fields == fields) {
+    en = cache.en;
+    wf = cache.wf;
+    ham = cache.ham;
+    hz = cache.hz;
+    return;
+  }
+
   DoubleFortranVector bmol(1, 3);
   bmol(1) = getParameter("BmolX");
   bmol(2) = getParameter("BmolY");
@@ -432,6 +458,14 @@ void CrystalFieldPeaksBase::calculateEigenSystem(DoubleFortranVector &en,
   bkq(6, 6) = ComplexType(B66, IB66);
 
   calculateEigensystem(en, wf, ham, hz, nre, bmol, bext, bkq);
+  cache.valid = true;
+  cache.ion = ion;
+  cache.fields = std::move(fields);
+  cache.en = en;
+  cache.wf = wf;
+  cache.ham = ham;
+  cache.hz = hz;
+  cache.nre = nre;
   // MaxPeakCount is a read-only "mutable" attribute.
   const_cast<CrystalFieldPeaksBase *>(this)->setAttributeValue(
       "MaxPeakCount", static_cast<int>(en.size()));
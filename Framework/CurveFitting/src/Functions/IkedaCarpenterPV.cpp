@@ -12,6 +12,7 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/PeakFunctionIntegrator.h"
 #include "MantidCurveFitting/Constraints/BoundaryConstraint.h"
+#include "MantidCurveFitting/DualNumber.h"
 #include "MantidCurveFitting/SpecialFunctionSupport.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/Component.h"
@@ -35,6 +36,17 @@ using namespace CurveFitting;
 namespace {
 /// static logger
 Kernel::Logger g_log("IkedaCarpenterPV");
+
+/** Calculate Im(exp(z) * E_1(z))
+ * @param re :: the real part of z
+ * @param im :: the imaginary part of z
+ */
+template <typename T> T imagOfExponentialIntegral(const T &re, const T &im) {
+  const std::complex<double> z(valueOf(re), valueOf(im));
+  const auto value = SpecialFunctionSupport::exponentialIntegral(z);
+  // d/dz (exp(z) * E_1(z)) = exp(z) * E_1(z) - 1 / z
+  return imagOfAnalytic(value, value - 1.0 / z, re, im);
+}
 } // namespace
 
 using namespace Kernel;
@@ -195,15 +207,18 @@ void IkedaCarpenterPV::calWavelengthAtEachDataPoint(const double *xValues,
  *  @param H :: pseudo voigt param
  *  @param eta :: pseudo voigt param
  */
-void IkedaCarpenterPV::convertVoigtToPseudo(const double &voigtSigmaSq,
-                                            const double &voigtGamma, double &H,
-                                            double &eta) const {
-  double fwhmGsq = 8.0 * M_LN2 * voigtSigmaSq;
-  double fwhmG = sqrt(fwhmGsq);
-  double fwhmG4 = fwhmGsq * fwhmGsq;
-  double fwhmL = voigtGamma;
-  double fwhmLsq = voigtGamma * voigtGamma;
-  double fwhmL4 = fwhmLsq * fwhmLsq;
+template <typename T>
+void IkedaCarpenterPV::convertVoigtToPseudo(const T &voigtSigmaSq,
+                                            const T &voigtGamma, T &H,
+                                            T &eta) const {
+  using std::pow;
+  using std::sqrt;
+  const T fwhmGsq = 8.0 * M_LN2 * voigtSigmaSq;
+  const T fwhmG = sqrt(fwhmGsq);
+  const T fwhmG4 = fwhmGsq * fwhmGsq;
+  const T &fwhmL = voigtGamma;
+  const T fwhmLsq = voigtGamma * voigtGamma;
+  const T fwhmL4 = fwhmLsq * fwhmLsq;
 
   H = pow(fwhmG4 * fwhmG + 2.69269 * fwhmG4 * fwhmL +
               2.42843 * fwhmGsq * fwhmG * fwhmLsq +
@@ -211,116 +226,69 @@ void IkedaCarpenterPV::convertVoigtToPseudo(const double &voigtSigmaSq,
               fwhmL4 * fwhmL,
           0.2);
 
-  if (H == 0.0)
+  if (valueOf(H) == 0.0)
     H = std::numeric_limits<double>::epsilon() * 1000.0;
 
-  double tmp = fwhmL / H;
+  const T tmp = fwhmL / H;
 
   eta = 1.36603 * tmp - 0.47719 * tmp * tmp + 0.11116 * tmp * tmp * tmp;
 }
 
 void IkedaCarpenterPV::constFunction(double *out, const double *xValues,
                                      const int &nData) const {
-  const double I = getParameter("I");
-  const double alpha0 = getParameter("Alpha0");
-  const double alpha1 = getParameter("Alpha1");
-  const double beta0 = getParameter("Beta0");
-  const double kappa = getParameter("Kappa");
-  const double voigtsigmaSquared = getParameter("SigmaSquared");
-  const double voigtgamma = getParameter("Gamma");
-  const double X0 = getParameter("X0");
-
-  // cal pseudo voigt sigmaSq and gamma and eta
-  double gamma = 1.0; // dummy initialization
-  double eta = 0.5;   // dummy initialization
-  convertVoigtToPseudo(voigtsigmaSquared, voigtgamma, gamma, eta);
-  double sigmaSquared = gamma * gamma / (8.0 * M_LN2);
-
-  const double beta = 1 / beta0;
-
-  // equations taken from Fullprof manual
-
-  const double k = 0.05;
-
-  // Not entirely sure what to do if sigmaSquared ever negative
-  // for now just post a warning
-  double someConst = std::numeric_limits<double>::max() / 100.0;
-  if (sigmaSquared > 0)
-    someConst = 1 / sqrt(2.0 * sigmaSquared);
-  else if (sigmaSquared < 0) {
-    g_log.warning() << "sigmaSquared negative in functionLocal.\n";
-  }
-
-  // update wavelength vector
-  calWavelengthAtEachDataPoint(xValues, nData);
-
-  for (int i = 0; i < nData; i++) {
-    double diff = xValues[i] - X0;
-
-    double R = exp(-81.799 / (m_waveLength[i] * m_waveLength[i] * kappa));
-    double alpha = 1.0 / (alpha0 + m_waveLength[i] * alpha1);
-
-    double a_minus = alpha * (1 - k);
-    double a_plus = alpha * (1 + k);
-    double x = a_minus - beta;
-    double y = alpha - beta;
-    double z = a_plus - beta;
-
-    double Nu = 1 - R * a_minus / x;
-    double Nv = 1 - R * a_plus / z;
-    double Ns = -2 * (1 - R * alpha / y);
-    double Nr = 2 * R * alpha * alpha * beta * k * k / (x * y * z);
-
-    double u = a_minus * (a_minus * sigmaSquared - 2 * diff) / 2.0;
-    double v = a_plus * (a_plus * sigmaSquared - 2 * diff) / 2.0;
-    double s = alpha * (alpha * sigmaSquared - 2 * diff) / 2.0;
-    double r = beta * (beta * sigmaSquared - 2 * diff) / 2.0;
-
-    double yu = (a_minus * sigmaSquared - diff) * someConst;
-    double yv = (a_plus * sigmaSquared - diff) * someConst;
-    double ys = (alpha * sigmaSquared - diff) * someConst;
-    double yr = (beta * sigmaSquared - diff) * someConst;
-
-    std::complex<double> zs =
-        std::complex<double>(-alpha * diff, 0.5 * alpha * gamma);
-    std::complex<double> zu = (1 - k) * zs;
-    std::complex<double> zv = (1 + k) * zs;
-    std::complex<double> zr =
-        std::complex<double>(-beta * diff, 0.5 * beta * gamma);
-
-    double N = 0.25 * alpha * (1 - k * k) / (k * k);
-
-    out[i] = I * N *
-             ((1 - eta) * (Nu * exp(u + gsl_sf_log_erfc(yu)) +
-                           Nv * exp(v + gsl_sf_log_erfc(yv)) +
-                           Ns * exp(s + gsl_sf_log_erfc(ys)) +
-                           Nr * exp(r + gsl_sf_log_erfc(yr))) -
-              eta * 2.0 / M_PI *
-                  (Nu * exponentialIntegral(zu).imag() +
-                   Nv * exponentialIntegral(zv).imag() +
-                   Ns * exponentialIntegral(zs).imag() +
-                   Nr * exponentialIntegral(zr).imag()));
-  }
+  functionLocal(out, xValues, static_cast<size_t>(nData));
 }
 
 void IkedaCarpenterPV::functionLocal(double *out, const double *xValues,
                                      const size_t nData) const {
-  const double I = getParameter("I");
-  const double alpha0 = getParameter("Alpha0");
-  const double alpha1 = getParameter("Alpha1");
-  const double beta0 = getParameter("Beta0");
-  const double kappa = getParameter("Kappa");
-  const double voigtsigmaSquared = getParameter("SigmaSquared");
-  const double voigtgamma = getParameter("Gamma");
-  const double X0 = getParameter("X0");
+  std::array<double, 8> parameters;
+  for (size_t i = 0; i < parameters.size(); ++i)
+    parameters[i] = getParameter(i);
+  calculatePeak(parameters, xValues, nData,
+                [out](const size_t i, const double value) { out[i] = value; });
+}
+
+/** Local derivative, exact through automatic differentiation
+ */
+void IkedaCarpenterPV::functionDerivLocal(API::Jacobian *jacobian,
+                                          const double *xValues,
+                                          const size_t nData) {
+  using Dual = AutoDiff::DualNumber<8>;
+  calculatePeak(parameterVariables<8>(*this), xValues, nData,
+                [jacobian](const size_t i, const Dual &value) {
+                  setJacobianRow(*jacobian, i, value);
+                });
+}
+
+/** Calculate the peak at each x
+ * @param parameters :: I, Alpha0, Alpha1, Beta0, Kappa, SigmaSquared, Gamma
+ * and X0, as doubles or as dual numbers to calculate the derivatives
+ * @param xValues :: the x values
+ * @param nData :: the number of x values
+ * @param output :: called with the index and the value of each point
+ */
+template <typename T, typename Output>
+void IkedaCarpenterPV::calculatePeak(const std::array<T, 8> &parameters,
+                                     const double *xValues, const size_t nData,
+                                     const Output &output) const {
+  using std::exp;
+  using std::sqrt;
+  const T &I = parameters[0];
+  const T &alpha0 = parameters[1];
+  const T &alpha1 = parameters[2];
+  const T &beta0 = parameters[3];
+  const T &kappa = parameters[4];
+  const T &voigtsigmaSquared = parameters[5];
+  const T &voigtgamma = parameters[6];
+  const T &X0 = parameters[7];
 
   // cal pseudo voigt sigmaSq and gamma and eta
-  double gamma = 1.0; // dummy initialization
-  double eta = 0.5;   // dummy initialization
+  T gamma = 1.0; // dummy initialization
+  T eta = 0.5;   // dummy initialization
   convertVoigtToPseudo(voigtsigmaSquared, voigtgamma, gamma, eta);
-  double sigmaSquared = gamma * gamma / (8.0 * M_LN2); // pseudo voigt sigma^2
+  const T sigmaSquared = gamma * gamma / (8.0 * M_LN2); // pseudo voigt sigma^2
 
-  const double beta = 1 / beta0;
+  const T beta = 1 / beta0;
 
   // equations taken from Fullprof manual
 
@@ -328,10 +296,10 @@ void IkedaCarpenterPV::functionLocal(double *out, const double *xValues,
 
   // Not entirely sure what to do if sigmaSquared ever negative
   // for now just post a warning
-  double someConst = std::numeric_limits<double>::max() / 100.0;
-  if (sigmaSquared > 0)
+  T someConst = std::numeric_limits<double>::max() / 100.0;
+  if (valueOf(sigmaSquared) > 0)
     someConst = 1 / sqrt(2.0 * sigmaSquared);
-  else if (sigmaSquared < 0) {
+  else if (valueOf(sigmaSquared) < 0) {
     g_log.warning() << "sigmaSquared negative in functionLocal.\n";
   }
 
@@ -339,66 +307,56 @@ void IkedaCarpenterPV::functionLocal(double *out, const double *xValues,
   calWavelengthAtEachDataPoint(xValues, nData);
 
   for (size_t i = 0; i < nData; i++) {
-    double diff = xValues[i] - X0;
-
-    double R = exp(-81.799 / (m_waveLength[i] * m_waveLength[i] * kappa));
-    double alpha = 1.0 / (alpha0 + m_waveLength[i] * alpha1);
-
-    double a_minus = alpha * (1 - k);
-    double a_plus = alpha * (1 + k);
-    double x = a_minus - beta;
-    double y = alpha - beta;
-    double z = a_plus - beta;
-
-    double Nu = 1 - R * a_minus / x;
-    double Nv = 1 - R * a_plus / z;
-    double Ns = -2 * (1 - R * alpha / y);
-    double Nr = 2 * R * alpha * alpha * beta * k * k / (x * y * z);
-
-    double u = a_minus * (a_minus * sigmaSquared - 2 * diff) / 2.0;
-    double v = a_plus * (a_plus * sigmaSquared - 2 * diff) / 2.0;
-    double s = alpha * (alpha * sigmaSquared - 2 * diff) / 2.0;
-    double r = beta * (beta * sigmaSquared - 2 * diff) / 2.0;
-
-    double yu = (a_minus * sigmaSquared - diff) * someConst;
-    double yv = (a_plus * sigmaSquared - diff) * someConst;
-    double ys = (alpha * sigmaSquared - diff) * someConst;
-    double yr = (beta * sigmaSquared - diff) * someConst;
-
-    std::complex<double> zs =
-        std::complex<double>(-alpha * diff, 0.5 * alpha * gamma);
-    std::complex<double> zu = (1 - k) * zs;
-    std::complex<double> zv = (1 + k) * zs;
-    std::complex<double> zr =
-        std::complex<double>(-beta * diff, 0.5 * beta * gamma);
-
-    double N = 0.25 * alpha * (1 - k * k) / (k * k);
-
-    out[i] = I * N *
-             ((1 - eta) * (Nu * exp(u + gsl_sf_log_erfc(yu)) +
-                           Nv * exp(v + gsl_sf_log_erfc(yv)) +
-                           Ns * exp(s + gsl_sf_log_erfc(ys)) +
-                           Nr * exp(r + gsl_sf_log_erfc(yr))) -
-              eta * 2.0 / M_PI *
-                  (Nu * exponentialIntegral(zu).imag() +
-                   Nv * exponentialIntegral(zv).imag() +
-                   Ns * exponentialIntegral(zs).imag() +
-                   Nr * exponentialIntegral(zr).imag()));
+    const T diff = xValues[i] - X0;
+
+    const T R = exp(-81.799 / (m_waveLength[i] * m_waveLength[i] * kappa));
+    const T alpha = 1.0 / (alpha0 + m_waveLength[i] * alpha1);
+
+    const T a_minus = alpha * (1 - k);
+    const T a_plus = alpha * (1 + k);
+    const T x = a_minus - beta;
+    const T y = alpha - beta;
+    const T z = a_plus - beta;
+
+    const T Nu = 1 - R * a_minus / x;
+    const T Nv = 1 - R * a_plus / z;
+    const T Ns = -2 * (1 - R * alpha / y);
+    const T Nr = 2 * R * alpha * alpha * beta * k * k / (x * y * z);
+
+    const T u = a_minus * (a_minus * sigmaSquared - 2 * diff) / 2.0;
+    const T v = a_plus * (a_plus * sigmaSquared - 2 * diff) / 2.0;
+    const T s = alpha * (alpha * sigmaSquared - 2 * diff) / 2.0;
+    const T r = beta * (beta * sigmaSquared - 2 * diff) / 2.0;
+
+    const T yu = (a_minus * sigmaSquared - diff) * someConst;
+    const T yv = (a_plus * sigmaSquared - diff) * someConst;
+    const T ys = (alpha * sigmaSquared - diff) * someConst;
+    const T yr = (beta * sigmaSquared - diff) * someConst;
+
+    // zs = -alpha * diff + i * alpha * gamma / 2, zu = (1 - k) * zs,
+    // zv = (1 + k) * zs and zr = -beta * diff + i * beta * gamma / 2
+    const T zsRe = -alpha * diff;
+    const T zsIm = 0.5 * alpha * gamma;
+    const T zrRe = -beta * diff;
+    const T zrIm = 0.5 * beta * gamma;
+
+    const T N = 0.25 * alpha * (1 - k * k) / (k * k);
+
+    output(i, I * N *
+                  ((1 - eta) * (Nu * exp(u + logErfc(yu)) +
+                                Nv * exp(v + logErfc(yv)) +
+                                Ns * exp(s + logErfc(ys)) +
+                                Nr * exp(r + logErfc(yr))) -
+                   eta * 2.0 / M_PI *
+                       (Nu * imagOfExponentialIntegral((1 - k) * zsRe,
+                                                       (1 - k) * zsIm) +
+                        Nv * imagOfExponentialIntegral((1 + k) * zsRe,
+                                                       (1 + k) * zsIm) +
+                        Ns * imagOfExponentialIntegral(zsRe, zsIm) +
+                        Nr * imagOfExponentialIntegral(zrRe, zrIm))));
   }
 }
 
-void IkedaCarpenterPV::functionDerivLocal(API::Jacobian * /*jacobian*/,
-                                          const double * /*xValues*/,
-                                          const size_t /*nData*/) {
-  throw Mantid::Kernel::Exception::NotImplementedError(
-      "functionDerivLocal is not implemented for IkedaCarpenterPV.");
-}
-
-void IkedaCarpenterPV::functionDeriv(const API::FunctionDomain &domain,
-                                     API::Jacobian &jacobian) {
-  calNumericalDeriv(domain, jacobian);
-}
-
 /// Returns the integral intensity of the peak
 double IkedaCarpenterPV::intensity() const {
   auto interval = getDomainInterval(1e-2);
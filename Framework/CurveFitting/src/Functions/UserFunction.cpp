@@ -8,6 +8,7 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/UserFunction.h"
+#include "MantidAPI/FunctionDomain1D.h"
 #include "MantidAPI/FunctionFactory.h"
 #include "MantidAPI/MuParserUtils.h"
 #include "MantidGeometry/muParser_Silent.h"
@@ -26,6 +27,17 @@ using Mantid::API::MuParserUtils::extraOneVarFunctions;
 using namespace Kernel;
 using namespace API;
 
+namespace {
+/// The values of all the parameters of a function
+std::vector<double> parameterValues(const IFunction &function) {
+  std::vector<double> values(function.nParams());
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = function.getParameter(i);
+  }
+  return values;
+}
+} // namespace
+
 /// Constructor
 UserFunction::UserFunction()
     : m_parser(new mu::Parser()), m_x(0.), m_x_set(false) {
@@ -69,6 +81,7 @@ void UserFunction::setAttribute(const std::string &attName,
   }
 
   m_x_set = false;
+  m_compiledFormula.reset();
   clearAllParameters();
 
   try {
@@ -99,6 +112,12 @@ void UserFunction::setAttribute(const std::string &attName,
   }
 
   m_parser->SetExpr(m_formula);
+
+  std::vector<std::string> names;
+  for (size_t i = 0; i < nParams(); i++) {
+    names.push_back(parameterName(i));
+  }
+  m_compiledFormula = CompiledFormula::compile(m_formula, names);
 }
 
 /** Calculate the fitting function.
@@ -110,6 +129,10 @@ void UserFunction::setAttribute(const std::string &attName,
  */
 void UserFunction::function1D(double *out, const double *xValues,
                               const size_t nData) const {
+  if (m_compiledFormula) {
+    m_compiledFormula->function(out, xValues, nData, parameterValues(*this));
+    return;
+  }
   for (size_t i = 0; i < nData; i++) {
     m_x = xValues[i];
     out[i] = m_parser->Eval();
@@ -123,6 +146,13 @@ void UserFunction::function1D(double *out, const double *xValues,
  */
 void UserFunction::functionDeriv(const API::FunctionDomain &domain,
                                  API::Jacobian &jacobian) {
+  const auto *domain1D = dynamic_cast<const FunctionDomain1D *>(&domain);
+  if (m_compiledFormula && domain1D &&
+      !dynamic_cast<const FunctionDomain1DHistogram *>(&domain)) {
+    m_compiledFormula->derivatives(jacobian, domain1D->getPointerAt(0),
+                                   domain1D->size(), parameterValues(*this));
+    return;
+  }
   calNumericalDeriv(domain, jacobian);
 }
 
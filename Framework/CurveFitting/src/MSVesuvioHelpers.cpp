@@ -9,6 +9,8 @@
 //-----------------------------------------------------------------------------
 #include "MantidCurveFitting/MSVesuvioHelpers.h"
 
+#include "MantidKernel/Philox.h"
+
 #include <algorithm>
 #include <numeric>
 
@@ -356,9 +358,24 @@ double finalEnergyUranium(const double randv) {
 //-------------------------------------------------------------------------
 /**
  * Produces random numbers with various probability distributions
+ * @param seed The seed for the generator
+ * @param stream Selects an independent sequence for the seed, e.g. one per
+ * spectrum. Stream 0 is the sequence of the plain seed, the others are seeded
+ * by hashing the stream number with the seed through Philox so that the
+ * streams of neighbouring seeds do not overlap.
  */
-RandomVariateGenerator::RandomVariateGenerator(const int seed) : m_engine() {
-  m_engine.seed(static_cast<std::mt19937::result_type>(seed));
+RandomVariateGenerator::RandomVariateGenerator(const int seed,
+                                               const size_t stream)
+    : m_engine() {
+  auto engineSeed = static_cast<std::mt19937::result_type>(seed);
+  if (stream > 0) {
+    const auto counter = static_cast<uint64_t>(stream);
+    engineSeed = Kernel::Philox::block(
+        {{static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32),
+          0, 0}},
+        {{static_cast<uint32_t>(seed), 0}})[0];
+  }
+  m_engine.seed(engineSeed);
 }
 /// Returns a flat random number between 0.0 & 1.0
 double RandomVariateGenerator::flat() {
@@ -10,6 +10,8 @@
 #include "MantidCurveFitting/ParDomain.h"
 #include "MantidKernel/MultiThreaded.h"
 
+#include <exception>
+
 namespace Mantid {
 namespace CurveFitting {
 
@@ -30,23 +32,71 @@ void ParDomain::getDomainAndValues(size_t i, API::FunctionDomain_sptr &domain,
   values = m_values[i];
 }
 
+/**
+ * Make the per-thread copies of a fitting function match it. The copies are
+ * only remade if the function or its active parameters have changed,
+ * otherwise their parameter values are set to the function's.
+ * @param function :: The fitting function
+ */
+void ParDomain::updateThreadFunctions(
+    const API::IFunction_sptr &function) const {
+  const auto nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  const size_t np = function->nParams();
+  bool isUpToDate =
+      function == m_sourceFunction && m_threadFunctions.size() == nThreads;
+  for (size_t k = 0; isUpToDate && k < nThreads; ++k) {
+    const auto &copy = m_threadFunctions[k];
+    isUpToDate = copy->nParams() == np;
+    for (size_t i = 0; isUpToDate && i < np; ++i) {
+      isUpToDate = copy->isActive(i) == function->isActive(i);
+    }
+  }
+
+  if (!isUpToDate) {
+    m_sourceFunction = function;
+    m_threadFunctions.resize(nThreads);
+    for (auto &copy : m_threadFunctions) {
+      copy = function->clone();
+    }
+    return;
+  }
+  for (auto &copy : m_threadFunctions) {
+    for (size_t i = 0; i < np; ++i) {
+      copy->setParameter(i, function->getParameter(i), false);
+    }
+  }
+}
+
 /**
  * Calculate the value of a least squares cost function
  * @param costFunction :: The cost func to calculate the value for
  */
 void ParDomain::additiveCostFunctionVal(
     const CostFunctions::CostFuncFitting &costFunction) {
+  updateThreadFunctions(costFunction.getFittingFunction());
   const int n = static_cast<int>(getNDomains());
+  // Exceptions cannot leave a parallel loop, the first one is rethrown after
+  std::exception_ptr exception;
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int i = 0; i < n; ++i) {
-    API::FunctionDomain_sptr domain;
-    API::FunctionValues_sptr values;
-    getDomainAndValues(static_cast<size_t>(i), domain, values);
-    if (!values) {
-      throw std::runtime_error("CostFunction: undefined FunctionValues.");
+    try {
+      API::FunctionDomain_sptr domain;
+      API::FunctionValues_sptr values;
+      getDomainAndValues(static_cast<size_t>(i), domain, values);
+      if (!values) {
+        throw std::runtime_error("CostFunction: undefined FunctionValues.");
+      }
+      costFunction.addVal(m_threadFunctions[PARALLEL_THREAD_NUMBER], domain,
+                          values);
+    } catch (...) {
+      PARALLEL_CRITICAL(ParDomain_exception) {
+        if (!exception)
+          exception = std::current_exception();
+      }
     }
-    costFunction.addVal(domain, values);
   }
+  if (exception)
+    std::rethrow_exception(exception);
 }
 
 /**
@@ -59,31 +109,33 @@ void ParDomain::additiveCostFunctionVal(
 void ParDomain::additiveCostFunctionValDerivHessian(
     const CostFunctions::CostFuncFitting &costFunction, bool evalDeriv,
     bool evalHessian) {
+  updateThreadFunctions(costFunction.getFittingFunction());
   const auto n = static_cast<int>(getNDomains());
+  std::exception_ptr exception;
   PARALLEL_SET_DYNAMIC(0);
-  std::vector<API::IFunction_sptr> funs;
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int i = 0; i < n; ++i) {
-    API::FunctionDomain_sptr domain;
-    API::FunctionValues_sptr values;
-    getDomainAndValues(i, domain, values);
-    auto simpleValues =
-        boost::dynamic_pointer_cast<API::FunctionValues>(values);
-    if (!simpleValues) {
-      throw std::runtime_error("CostFunction: undefined FunctionValues.");
-    }
-    std::vector<API::IFunction_sptr>::size_type k = PARALLEL_THREAD_NUMBER;
-    PARALLEL_CRITICAL(resize) {
-      if (k >= funs.size()) {
-        funs.resize(k + 1);
+    try {
+      API::FunctionDomain_sptr domain;
+      API::FunctionValues_sptr values;
+      getDomainAndValues(i, domain, values);
+      auto simpleValues =
+          boost::dynamic_pointer_cast<API::FunctionValues>(values);
+      if (!simpleValues) {
+        throw std::runtime_error("CostFunction: undefined FunctionValues.");
       }
-      if (!funs[k]) {
-        funs[k] = costFunction.getFittingFunction()->clone();
+      costFunction.addValDerivHessian(m_threadFunctions[PARALLEL_THREAD_NUMBER],
+                                      domain, simpleValues, evalDeriv,
+                                      evalHessian);
+    } catch (...) {
+      PARALLEL_CRITICAL(ParDomain_exception) {
+        if (!exception)
+          exception = std::current_exception();
       }
     }
-    costFunction.addValDerivHessian(funs[k], domain, simpleValues, evalDeriv,
-                                    evalHessian);
   }
+  if (exception)
+    std::rethrow_exception(exception);
 }
 
 } // namespace CurveFitting
@@ -86,7 +86,7 @@ void SeqDomain::additiveCostFunctionVal(
     if (!values) {
       throw std::runtime_error("CostFunction: undefined FunctionValues.");
     }
-    costFunction.addVal(domain, values);
+    costFunction.addVal(costFunction.getFittingFunction(), domain, values);
   }
 }
 
@@ -105,7 +105,7 @@ void SeqDomain::rwpVal(const CostFunctions::CostFuncRwp &rwp) {
     if (!values) {
       throw std::runtime_error("Rwp: undefined FunctionValues.");
     }
-    rwp.addVal(domain, values);
+    rwp.addVal(rwp.getFittingFunction(), domain, values);
   }
 }
 
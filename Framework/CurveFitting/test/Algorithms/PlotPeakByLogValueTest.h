@@ -342,6 +342,38 @@ public:
     AnalysisDataService::Instance().clear();
   }
 
+  void test_individual_fits_are_in_input_order() {
+    const int nSpectra = 20;
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceFromFunction(
+        Fun(), nSpectra, -5.0, 5.0, 0.1, false);
+    AnalysisDataService::Instance().add("PLOTPEAKBYLOGVALUETEST_WS", ws);
+    PlotPeakByLogValue alg;
+    alg.initialize();
+    alg.setPropertyValue("Input", "PLOTPEAKBYLOGVALUETEST_WS,v1:20");
+    alg.setPropertyValue("OutputWorkspace", "PlotPeakResult");
+    alg.setPropertyValue("FitType", "Individual");
+    alg.setPropertyValue("Function", "name=FlatBackground,A0=0.5");
+    alg.execute();
+
+    TS_ASSERT(alg.isExecuted());
+
+    TWS_type result =
+        WorkspaceCreationHelper::getWS<TableWorkspace>("PlotPeakResult");
+    TS_ASSERT(result);
+    TS_ASSERT_EQUALS(result->rowCount(), nSpectra);
+
+    // each spectrum contains values equal to its spectrum number
+    double a = 1.0;
+    TableRow row = result->getFirstRow();
+    do {
+      TS_ASSERT_DELTA(row.Double(0), a, 1e-15);
+      TS_ASSERT_DELTA(row.Double(1), a, 1e-10);
+      a += 1.0;
+    } while (row.next());
+
+    AnalysisDataService::Instance().clear();
+  }
+
   void test_passWorkspaceIndexToFunction_composit_function_case() {
     auto ws = WorkspaceCreationHelper::create2DWorkspaceFromFunction(
         Fun(), 3, -5.0, 5.0, 0.1, false);
@@ -0,0 +1,121 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_CURVEFITTING_COMPILEDFORMULATEST_H_
+#define MANTID_CURVEFITTING_COMPILEDFORMULATEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidCurveFitting/CompiledFormula.h"
+#include "MantidCurveFitting/Jacobian.h"
+
+#include <cmath>
+#include <functional>
+
+using Mantid::CurveFitting::CompiledFormula;
+
+namespace {
+using Reference = std::function<double(double, const std::vector<double> &)>;
+
+/// Compare a compiled formula and its derivatives with a reference
+/// implementation and its finite differences
+void checkFormula(const std::string &formula,
+                  const std::vector<std::string> &names,
+                  const std::vector<double> &parameters,
+                  const Reference &reference) {
+  CompiledFormula compiled(formula, names);
+  // More x values than are evaluated at a time
+  const size_t nData = 600;
+  std::vector<double> x(nData), y(nData);
+  for (size_t i = 0; i < nData; ++i) {
+    x[i] = 0.1 + 0.001 * static_cast<double>(i);
+  }
+  compiled.function(y.data(), x.data(), nData, parameters);
+  Mantid::CurveFitting::Jacobian jacobian(nData, parameters.size());
+  compiled.derivatives(jacobian, x.data(), nData, parameters);
+
+  const double step = 1e-6;
+  for (size_t i = 0; i < nData; i += 7) {
+    TS_ASSERT_DELTA(y[i], reference(x[i], parameters), 1e-12);
+    for (size_t iP = 0; iP < parameters.size(); ++iP) {
+      auto plus = parameters;
+      auto minus = parameters;
+      plus[iP] += step;
+      minus[iP] -= step;
+      const double difference =
+          (reference(x[i], plus) - reference(x[i], minus)) / (2 * step);
+      TS_ASSERT_DELTA(jacobian.get(i, iP), difference,
+                      1e-6 * (1. + std::abs(difference)));
+    }
+  }
+}
+} // namespace
+
+class CompiledFormulaTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CompiledFormulaTest *createSuite() {
+    return new CompiledFormulaTest();
+  }
+  static void destroySuite(CompiledFormulaTest *suite) { delete suite; }
+
+  void test_arithmetic() {
+    checkFormula("h*sin(a*x-c)", {"h", "a", "c"}, {2.2, 2., 1.2},
+                 [](double x, const std::vector<double> &p) {
+                   return p[0] * std::sin(p[1] * x - p[2]);
+                 });
+    checkFormula("-a^2*x + b/x - c^x + 1.5e-1", {"a", "b", "c"},
+                 {1.5, 2., 0.7}, [](double x, const std::vector<double> &p) {
+                   return -std::pow(p[0], 2) * x + p[1] / x -
+                          std::pow(p[2], x) + 0.15;
+                 });
+    checkFormula("2^-a*x*-b", {"a", "b"}, {0.5, 3.},
+                 [](double x, const std::vector<double> &p) {
+                   return std::pow(2., -p[0]) * x * -p[1];
+                 });
+  }
+
+  void test_functions() {
+    checkFormula("x^a * exp(-x/t) + sqrt(abs(b*x)) * ln(t)", {"a", "t", "b"},
+                 {1.3, 0.8, -2.}, [](double x, const std::vector<double> &p) {
+                   return std::pow(x, p[0]) * std::exp(-x / p[1]) +
+                          std::sqrt(std::abs(p[2] * x)) * std::log(p[1]);
+                 });
+    checkFormula("erf(a*x) + erfc(b - x) + tanh(a*b*x) + atan(x/b) + "
+                 "asin(x*a/3) + acos(x/b) + cosh(a) - sinh(x*b) + tan(a*x) + "
+                 "log10(b*x) + log2(x) * _pi - _e",
+                 {"a", "b"}, {0.9, 2.5},
+                 [](double x, const std::vector<double> &p) {
+                   const double a = p[0];
+                   const double b = p[1];
+                   return std::erf(a * x) + std::erfc(b - x) +
+                          std::tanh(a * b * x) + std::atan(x / b) +
+                          std::asin(x * a / 3) + std::acos(x / b) +
+                          std::cosh(a) - std::sinh(x * b) + std::tan(a * x) +
+                          std::log10(b * x) + std::log2(x) * M_PI - M_E;
+                 });
+  }
+
+  void test_unsupported_formulas_throw() {
+    for (const std::string formula :
+         {"x^2^3", "x<a", "max(x,a)", "log(x)", "a+", "(a", "y*x", "2x",
+          "x ? a : 2"}) {
+      TS_ASSERT_THROWS(CompiledFormula(formula, {"a"}),
+                       const std::invalid_argument &);
+    }
+  }
+
+  void test_compile_caches_formulas() {
+    const auto compiled = CompiledFormula::compile("a*x+b", {"a", "b"});
+    TS_ASSERT(compiled);
+    TS_ASSERT_EQUALS(compiled, CompiledFormula::compile("a*x+b", {"a", "b"}));
+    TS_ASSERT_DIFFERS(compiled, CompiledFormula::compile("a*x+b", {"b", "a"}));
+    TS_ASSERT(!CompiledFormula::compile("max(x,a)", {"a"}));
+  }
+};
+
+#endif /* MANTID_CURVEFITTING_COMPILEDFORMULATEST_H_ */
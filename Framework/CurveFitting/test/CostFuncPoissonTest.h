@@ -107,7 +107,7 @@ public:
     CostFuncPoisson atZero;
     atZero.setFittingFunction(getFakeFunction(), domainAtZero, vals);
 
-    atZero.addVal(domainAtZero, vals);
+    atZero.addVal(atZero.getFittingFunction(), domainAtZero, vals);
     TS_ASSERT(std::isinf(atZero.val()));
   }
 
@@ -118,7 +118,7 @@ public:
     CostFuncPoisson belowZero;
     belowZero.setFittingFunction(getFakeFunction(), domainBelowZero, vals);
 
-    belowZero.addVal(domainBelowZero, vals);
+    belowZero.addVal(belowZero.getFittingFunction(), domainBelowZero, vals);
     TS_ASSERT(std::isinf(belowZero.val()));
   }
 
@@ -135,7 +135,7 @@ public:
     CostFuncPoisson testInstance;
     testInstance.setFittingFunction(getFakeFunction(), domain, vals);
 
-    testInstance.addVal(domain, vals);
+    testInstance.addVal(testInstance.getFittingFunction(), domain, vals);
 
     const int sumOfValues =
         std::accumulate(differenceVals.begin(), differenceVals.end(), 0);
@@ -150,7 +150,7 @@ public:
     CostFuncPoisson testInstance;
     testInstance.setFittingFunction(getFakeFunction(), domain, vals);
 
-    testInstance.addVal(domain, vals);
+    testInstance.addVal(testInstance.getFittingFunction(), domain, vals);
 
     const double expected = calculatePoisson(*vals);
 
@@ -166,7 +166,7 @@ public:
     CostFuncPoisson testInstance;
     testInstance.setFittingFunction(getFakeFunction(), domain, vals);
 
-    testInstance.addVal(domain, vals);
+    testInstance.addVal(testInstance.getFittingFunction(), domain, vals);
     const double expected = calculatePoisson(*vals);
 
     TS_ASSERT_EQUALS(testInstance.val(), expected)
@@ -188,7 +188,7 @@ public:
     CostFuncPoisson testInstance;
     testInstance.setFittingFunction(getFakeFunction(), domain, vals);
 
-    testInstance.addVal(domain, vals);
+    testInstance.addVal(testInstance.getFittingFunction(), domain, vals);
 
     double expectedVal = 0.0;
     for (size_t i = 0; i < vals->size(); i++) {
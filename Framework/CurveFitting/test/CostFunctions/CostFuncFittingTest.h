@@ -24,8 +24,9 @@ namespace {
 class CostFuncMock : public CostFuncFitting {
 public:
   std::string name() const override { return "CostFuncMock"; }
-  void addVal(FunctionDomain_sptr domain,
+  void addVal(IFunction_sptr function, FunctionDomain_sptr domain,
               FunctionValues_sptr values) const override {
+    UNUSED_ARG(function)
     UNUSED_ARG(domain)
     UNUSED_ARG(values)
   }
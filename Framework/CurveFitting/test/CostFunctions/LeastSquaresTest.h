@@ -12,6 +12,8 @@
 #include "MantidAPI/CompositeFunction.h"
 #include "MantidAPI/FunctionDomain1D.h"
 #include "MantidAPI/FunctionValues.h"
+#include "MantidAPI/JointDomain.h"
+#include "MantidAPI/MultiDomainFunction.h"
 #include "MantidCurveFitting/CostFunctions/CostFuncLeastSquares.h"
 #include "MantidCurveFitting/CostFunctions/CostFuncRwp.h"
 #include "MantidCurveFitting/FuncMinimizers/BFGS_Minimizer.h"
@@ -21,6 +23,7 @@
 #include "MantidCurveFitting/Functions/Gaussian.h"
 #include "MantidCurveFitting/Functions/LinearBackground.h"
 #include "MantidCurveFitting/Functions/UserFunction.h"
+#include "MantidCurveFitting/Jacobian.h"
 
 #include <gsl/gsl_blas.h>
 #include <sstream>
@@ -342,6 +345,70 @@ public:
       //}
     }
   }
+
+  void test_hessian_of_multi_domain_fit() {
+    auto domain = boost::make_shared<JointDomain>();
+    domain->addDomain(boost::make_shared<FunctionDomain1DVector>(0., 1., 5));
+    domain->addDomain(boost::make_shared<FunctionDomain1DVector>(1., 2., 5));
+    auto values = boost::make_shared<FunctionValues>(*domain);
+    values->setFitData(std::vector<double>(domain->size(), 1.));
+    values->setFitWeights(2.0);
+
+    auto multi = boost::make_shared<MultiDomainFunction>();
+    for (size_t i = 0; i < 2; ++i) {
+      auto bk = boost::make_shared<LinearBackground>();
+      bk->initialize();
+      bk->setParameter("A0", 0.5);
+      bk->setParameter("A1", 0.5);
+      multi->addFunction(bk);
+      multi->setDomainIndex(i, i);
+    }
+
+    auto costFun = boost::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(multi, domain, values);
+    costFun->valDerivHessian();
+    const GSLVector &g = costFun->getDeriv();
+    const GSLMatrix &H = costFun->getHessian();
+
+    // Each function only has derivatives on its own domain
+    for (size_t iDomain = 0; iDomain < 2; ++iDomain) {
+      const auto &x =
+          static_cast<const FunctionDomain1D &>(domain->getDomain(iDomain));
+      double sumX = 0., sumX2 = 0., gradA0 = 0., gradA1 = 0.;
+      for (size_t i = 0; i < x.size(); ++i) {
+        const double residual = (0.5 + 0.5 * x[i] - 1.) * 4.;
+        sumX += x[i];
+        sumX2 += x[i] * x[i];
+        gradA0 += residual;
+        gradA1 += residual * x[i];
+      }
+      const size_t i0 = 2 * iDomain;
+      TS_ASSERT_DELTA(g.get(i0), gradA0, 1e-10);
+      TS_ASSERT_DELTA(g.get(i0 + 1), gradA1, 1e-10);
+      TS_ASSERT_DELTA(H.get(i0, i0), 4. * static_cast<double>(x.size()),
+                      1e-10);
+      TS_ASSERT_DELTA(H.get(i0, i0 + 1), 4. * sumX, 1e-10);
+      TS_ASSERT_DELTA(H.get(i0 + 1, i0), 4. * sumX, 1e-10);
+      TS_ASSERT_DELTA(H.get(i0 + 1, i0 + 1), 4. * sumX2, 1e-10);
+      const size_t other = 2 - i0;
+      for (size_t i = i0; i < i0 + 2; ++i) {
+        TS_ASSERT_EQUALS(H.get(i, other), 0.);
+        TS_ASSERT_EQUALS(H.get(i, other + 1), 0.);
+      }
+    }
+  }
+
+  void test_jacobian_non_zero_range() {
+    Mantid::CurveFitting::Jacobian jacobian(6, 3);
+    jacobian.set(1, 0, 1.);
+    jacobian.set(3, 0, 2.);
+    for (size_t i = 0; i < 6; ++i)
+      jacobian.set(i, 1, 1.);
+    using Range = std::pair<size_t, size_t>;
+    TS_ASSERT_EQUALS(jacobian.nonZeroRange(0), Range(1, 4));
+    TS_ASSERT_EQUALS(jacobian.nonZeroRange(1), Range(0, 6));
+    TS_ASSERT_EQUALS(jacobian.nonZeroRange(2), Range(0, 0));
+  }
 };
 
 #endif /*CURVEFITTING_LEASTSQUARESTEST_H_*/
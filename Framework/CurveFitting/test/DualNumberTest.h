@@ -0,0 +1,92 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_CURVEFITTING_DUALNUMBERTEST_H_
+#define MANTID_CURVEFITTING_DUALNUMBERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidCurveFitting/DualNumber.h"
+
+using namespace Mantid::CurveFitting;
+using Dual = AutoDiff::DualNumber<2>;
+
+namespace {
+/// A function of two variables using every operation
+template <typename T> T testFunction(const T &a, const T &b) {
+  using std::erfc;
+  using std::exp;
+  using std::log;
+  using std::pow;
+  using std::sqrt;
+  return (a * b - 2.0 * a) / (1.0 + b) + exp(-a / b) - log(a) * sqrt(b) +
+         pow(b, 2.5) - 3.0 / a + erfc(a - b) + logErfc(a + b) + (-b - 1.0);
+}
+
+/// Im(exp(z)) for z = a b + i (a - b)
+template <typename T> T imagOfExp(const T &a, const T &b) {
+  const T re = a * b;
+  const T im = a - b;
+  const std::complex<double> z(valueOf(re), valueOf(im));
+  return imagOfAnalytic(std::exp(z), std::exp(z), re, im);
+}
+
+template <typename Function>
+void checkDerivatives(const Function &function, const double a,
+                      const double b) {
+  const auto result = function(Dual::variable(a, 0), Dual::variable(b, 1));
+  TS_ASSERT_DELTA(result.value(), function(a, b), 1e-12);
+  const double step = 1e-6;
+  TS_ASSERT_DELTA(result.derivative(0),
+                  (function(a + step, b) - function(a - step, b)) / (2 * step),
+                  1e-6);
+  TS_ASSERT_DELTA(result.derivative(1),
+                  (function(a, b + step) - function(a, b - step)) / (2 * step),
+                  1e-6);
+}
+} // namespace
+
+class DualNumberTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static DualNumberTest *createSuite() { return new DualNumberTest(); }
+  static void destroySuite(DualNumberTest *suite) { delete suite; }
+
+  void test_constants_have_no_derivatives() {
+    const Dual x(3.5);
+    TS_ASSERT_EQUALS(x.value(), 3.5);
+    TS_ASSERT_EQUALS(x.derivative(0), 0.);
+    TS_ASSERT_EQUALS(x.derivative(1), 0.);
+  }
+
+  void test_product_rule() {
+    const auto x = Dual::variable(3., 0);
+    const auto y = Dual::variable(-2., 1);
+    const auto product = x * y * x;
+    TS_ASSERT_EQUALS(product.value(), -18.);
+    TS_ASSERT_EQUALS(product.derivative(0), -12.);
+    TS_ASSERT_EQUALS(product.derivative(1), 9.);
+  }
+
+  void test_derivatives_match_finite_differences() {
+    auto function = [](const auto &a, const auto &b) {
+      return testFunction(a, b);
+    };
+    checkDerivatives(function, 0.7, 1.3);
+    checkDerivatives(function, 2.1, 0.4);
+  }
+
+  void test_imaginary_part_of_analytic_function() {
+    auto function = [](const auto &a, const auto &b) {
+      return imagOfExp(a, b);
+    };
+    checkDerivatives(function, 0.7, 1.3);
+    checkDerivatives(function, -1.1, 0.2);
+  }
+};
+
+#endif /* MANTID_CURVEFITTING_DUALNUMBERTEST_H_ */
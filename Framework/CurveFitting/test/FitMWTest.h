@@ -32,6 +32,7 @@
 
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyManager.h"
 
 #include <sstream>
@@ -494,6 +495,69 @@ public:
     TS_ASSERT_DELTA(v1d->getFitData(0), 4.0, 1e-13);
   }
 
+  void test_MaxSize_0_splits_a_parallel_domain_between_threads() {
+    auto ws = createTestWorkspace(false, 1, 100);
+    const size_t nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+
+    FunctionDomain_sptr domain;
+    FunctionValues_sptr values;
+    FitMW parallel(FitMW::Parallel);
+    parallel.setWorkspace(ws);
+    parallel.setWorkspaceIndex(0);
+    parallel.setMaxSize(0);
+    parallel.createDomain(domain, values);
+    auto seq = dynamic_cast<SeqDomain *>(domain.get());
+    if (nThreads > 1) {
+      TS_ASSERT(seq);
+      const size_t partSize = (100 + nThreads - 1) / nThreads;
+      TS_ASSERT_EQUALS(seq->getNDomains(), (100 + partSize - 1) / partSize);
+      TS_ASSERT_EQUALS(seq->size(), 100);
+    } else {
+      TS_ASSERT(!seq);
+    }
+
+    // A sequential domain is left whole
+    FitMW sequential(FitMW::Sequential);
+    sequential.setWorkspace(ws);
+    sequential.setWorkspaceIndex(0);
+    sequential.setMaxSize(0);
+    domain.reset();
+    values.reset();
+    sequential.createDomain(domain, values);
+    TS_ASSERT(!dynamic_cast<SeqDomain *>(domain.get()));
+    TS_ASSERT_EQUALS(domain->size(), 100);
+  }
+
+  void test_fit_with_parallel_domain_matches_simple_domain() {
+    auto ws = createTestWorkspace(false, 1, 100);
+    auto fitWith = [&ws](const std::string &domainType) {
+      // A user function is not safe to evaluate from several threads
+      IFunction_sptr fun(new UserFunction);
+      fun->setAttributeValue("Formula", "h*exp(-x/t)");
+      fun->setParameter("h", 1.);
+      fun->setParameter("t", 1.);
+      Fit fit;
+      fit.initialize();
+      fit.setProperty("Function", fun);
+      fit.setProperty("DomainType", domainType);
+      fit.setProperty("InputWorkspace", ws);
+      fit.setProperty("WorkspaceIndex", 0);
+      if (domainType != "Simple")
+        fit.setProperty("MaxSize", 7);
+      fit.execute();
+      TS_ASSERT(fit.isExecuted());
+      return fun;
+    };
+    auto simple = fitWith("Simple");
+    TS_ASSERT_DELTA(simple->getParameter("h"), 10.0, 1e-4);
+    TS_ASSERT_DELTA(simple->getParameter("t"), 0.5, 1e-5);
+    for (const std::string domainType : {"Sequential", "Parallel"}) {
+      auto fun = fitWith(domainType);
+      TS_ASSERT_DELTA(fun->getParameter("h"), simple->getParameter("h"), 1e-6);
+      TS_ASSERT_DELTA(fun->getParameter("t"), simple->getParameter("t"), 1e-6);
+    }
+  }
+
   void
   test_Composite_Function_With_SeparateMembers_Option_On_FitMW_Outputs_Composite_Values_Plus_Each_Member() {
     const bool histogram = true;
@@ -269,6 +269,39 @@ public:
     TS_ASSERT(param->Double(1, 1) == fun->getParameter("Lifetime"));
   }
 
+  void test_gelmanRubin_stops_the_posterior_chain_early() {
+    auto ws2 = createExpDecayWorkspace();
+
+    Mantid::API::IFunction_sptr fun(new ExpDecay);
+    fun->setParameter("Height", 8.);
+    fun->setParameter("Lifetime", 1.0);
+
+    Fit fit;
+    fit.initialize();
+    fit.setChild(true);
+    fit.setProperty("Function", fun);
+    fit.setProperty("InputWorkspace", ws2);
+    fit.setProperty("WorkspaceIndex", 0);
+    fit.setProperty("MaxIterations", 100000);
+    fit.setProperty("Minimizer", "FABADA,ChainLength=50000,StepsBetweenValues="
+                                 "10,ConvergenceCriteria=0.1,"
+                                 "GelmanRubinThreshold=1.1,ConvergedChain"
+                                 "=ConvergedChain,Chains=Chain");
+
+    TS_ASSERT_THROWS_NOTHING(fit.execute());
+    TS_ASSERT(fit.isExecuted());
+
+    TS_ASSERT_DELTA(fun->getParameter("Height"), 10.0, 0.3);
+    TS_ASSERT_DELTA(fun->getParameter("Lifetime"), 0.5, 0.05);
+
+    // The converged chain is shorter than the requested 50000 / 10 points
+    MatrixWorkspace_sptr convChain = fit.getProperty("ConvergedChain");
+    TS_ASSERT(convChain);
+    const size_t convLength = convChain->x(0).size();
+    TS_ASSERT_LESS_THAN(convLength, 5000u);
+    TS_ASSERT_LESS_THAN_EQUALS(4u * 500u / 10u, convLength);
+  }
+
   void test_low_MaxIterations() {
     auto ws2 = createExpDecayWorkspace();
 
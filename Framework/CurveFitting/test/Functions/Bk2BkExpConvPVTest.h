@@ -10,7 +10,12 @@
 #include <cxxtest/TestSuite.h>
 #include <fstream>
 
+#include "MantidAPI/FunctionDomain1D.h"
 #include "MantidCurveFitting/Functions/Bk2BkExpConvPV.h"
+#include "MantidCurveFitting/Jacobian.h"
+
+#include <algorithm>
+#include <cmath>
 
 using namespace Mantid::CurveFitting::Functions;
 
@@ -46,6 +51,32 @@ public:
     TS_ASSERT_DELTA(y[50], 2.7983, 1e-4);
     TS_ASSERT_DELTA(y[99], 0.0000, 1e-4);
   }
+
+  void test_derivatives_match_numerical_derivatives() {
+    Bk2BkExpConvPV peak;
+    peak.initialize();
+    peak.setParameter("Height", 100.0);
+    peak.setParameter("TOF_h", 400.0);
+    peak.setParameter("Alpha", 1.0);
+    peak.setParameter("Beta", 1.5);
+    peak.setParameter("Sigma2", 200.0);
+    // A Lorentzian part to include the exponential integrals
+    peak.setParameter("Gamma", 10.0);
+
+    Mantid::API::FunctionDomain1DVector x(300, 500, 100);
+    Mantid::CurveFitting::Jacobian analytic(x.size(), 6);
+    Mantid::CurveFitting::Jacobian numerical(x.size(), 6);
+    TS_ASSERT_THROWS_NOTHING(peak.functionDeriv(x, analytic));
+    peak.calNumericalDeriv(x, numerical);
+    for (size_t iP = 0; iP < 6; ++iP) {
+      double scale = 0.;
+      for (size_t i = 0; i < x.size(); ++i)
+        scale = std::max(scale, std::fabs(numerical.get(i, iP)));
+      for (size_t i = 0; i < x.size(); ++i)
+        TS_ASSERT_DELTA(analytic.get(i, iP), numerical.get(i, iP),
+                        1e-2 * scale);
+    }
+  }
 };
 
 #endif /* MANTID_CURVEFITTING_BK2BKEXPCONVPVTEST_H_ */
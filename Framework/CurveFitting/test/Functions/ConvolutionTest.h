@@ -402,6 +402,77 @@ public:
     }
   }
 
+  void test_resolution_transform_follows_the_domain() {
+    Convolution conv;
+    const double pi = acos(0.) * 2;
+    auto res = boost::make_shared<ConvolutionTest_Gauss>();
+    res->setParameter("c", 0.);
+    res->setParameter("h", 3.);
+    res->setParameter("s", pi / 2);
+    conv.addFunction(res);
+    auto fun = boost::make_shared<ConvolutionTest_Gauss>();
+    fun->setParameter("h", 10.);
+    fun->setParameter("s", pi / 3);
+    conv.addFunction(fun);
+
+    // a convolution of two gaussians is a gaussian with h == hp and s == sp
+    const double sp = (pi / 2) * (pi / 3) / (pi / 2 + pi / 3);
+    const double hp = 3. * 10. * sqrt(pi / (pi / 2 + pi / 3));
+    for (const int n : {116, 100, 100}) {
+      const double dx = 15.08 / n;
+      std::vector<double> x(n);
+      for (int i = 0; i < n; i++) {
+        x[i] = i * dx;
+      }
+      const double c = dx * n / 2;
+      fun->setParameter("c", c);
+      FunctionDomain1DView xView(x.data(), n);
+      FunctionValues out(xView);
+      conv.function(xView, out);
+      for (int i = 0; i < n; i++) {
+        const double xi = x[i] - c;
+        TS_ASSERT_DELTA(out.getCalculated(i), hp * exp(-sp * xi * xi), 1e-10);
+      }
+    }
+  }
+
+  void test_gaussian_and_lorentzians_are_convolved_analytically() {
+    auto conv = FunctionFactory::Instance().createInitialized(
+        "composite=Convolution;"
+        "name=Gaussian,Height=2.5,PeakCentre=0.1,Sigma=0.4;"
+        "name=Lorentzian,Amplitude=3,PeakCentre=-1,FWHM=0.6;"
+        "name=Lorentzian,Amplitude=1.5,PeakCentre=2,FWHM=0.05");
+    // an asymmetric domain which would be convolved directly
+    const size_t n = 200;
+    std::vector<double> x(n);
+    for (size_t i = 0; i < n; i++) {
+      x[i] = -3. + 0.05 * static_cast<double>(i);
+    }
+    FunctionDomain1DView xView(x.data(), n);
+    FunctionValues out(xView);
+    conv->function(xView, out);
+
+    // Integrate the Gaussian along each Lorentzian, substituting
+    // t = centre + FWHM / 2 tan(theta)
+    auto convolution = [](double xi, double amplitude, double centre,
+                          double fwhm) {
+      const size_t nTheta = 100000;
+      const double step = M_PI / nTheta;
+      double sum = 0.;
+      for (size_t j = 1; j < nTheta; ++j) {
+        const double theta = -M_PI / 2 + static_cast<double>(j) * step;
+        const double t = xi - centre - 0.5 * fwhm * tan(theta) - 0.1;
+        sum += 2.5 * exp(-0.5 * t * t / (0.4 * 0.4));
+      }
+      return amplitude * sum * step / M_PI;
+    };
+    for (size_t i = 0; i < n; i++) {
+      const double expected =
+          convolution(x[i], 3., -1., 0.6) + convolution(x[i], 1.5, 2., 0.05);
+      TS_ASSERT_DELTA(out.getCalculated(i), expected, 1e-8);
+    }
+  }
+
   void testForCategories() {
     Convolution forCat;
     const std::vector<std::string> categories = forCat.categories();
@@ -20,6 +20,8 @@
 #include "MantidCurveFitting/Functions/CrystalFieldPeaks.h"
 #include "MantidDataObjects/TableWorkspace.h"
 
+using Mantid::CurveFitting::ComplexFortranMatrix;
+using Mantid::CurveFitting::DoubleFortranVector;
 using Mantid::CurveFitting::Functions::CrystalFieldPeaks;
 using namespace Mantid::CurveFitting::Algorithms;
 using namespace Mantid::API;
@@ -525,6 +527,43 @@ public:
     TS_ASSERT_EQUALS(tie->asString(), "B64=-21*B60");
   }
 
+  void test_eigensystem_is_recalculated_when_fields_change() {
+    CrystalFieldPeaks fun;
+    fun.setParameter("B20", 0.37737);
+    fun.setParameter("B22", 3.9770);
+    fun.setAttributeValue("Ion", "Ce");
+    DoubleFortranVector en1, en2, en3;
+    ComplexFortranMatrix wf1, wf2, wf3;
+    int nre = 0;
+    fun.calculateEigenSystem(en1, wf1, nre);
+    // Attributes that don't enter the Hamiltonian keep the eigensystem
+    fun.setAttributeValue("Temperature", 10.0);
+    fun.calculateEigenSystem(en2, wf2, nre);
+    TS_ASSERT_EQUALS(en2.size(), en1.size());
+    for (size_t i = 0; i < en1.size(); ++i) {
+      TS_ASSERT_EQUALS(en2.get(i), en1.get(i));
+    }
+
+    fun.setParameter("B40", -0.031787);
+    fun.calculateEigenSystem(en2, wf2, nre);
+    CrystalFieldPeaks fresh;
+    fresh.setParameter("B20", 0.37737);
+    fresh.setParameter("B22", 3.9770);
+    fresh.setParameter("B40", -0.031787);
+    fresh.setAttributeValue("Ion", "Ce");
+    fresh.calculateEigenSystem(en3, wf3, nre);
+    TS_ASSERT_EQUALS(en2.size(), en3.size());
+    for (size_t i = 0; i < en3.size(); ++i) {
+      TS_ASSERT_EQUALS(en2.get(i), en3.get(i));
+    }
+    TS_ASSERT_DIFFERS(en2.get(2), en1.get(2));
+
+    fun.setAttributeValue("Ion", "Pr");
+    fun.calculateEigenSystem(en2, wf2, nre);
+    TS_ASSERT_EQUALS(nre, 2);
+    TS_ASSERT_EQUALS(en2.size(), 9);
+  }
+
   void test_CrystalFieldPeaksBaseImpl() {
     Mantid::CurveFitting::Functions::CrystalFieldPeaksBaseImpl fun;
   }
@@ -19,6 +19,10 @@
 #include "MantidCurveFitting/Functions/Gaussian.h"
 #include "MantidCurveFitting/Functions/LinearBackground.h"
 #include "MantidCurveFitting/Functions/UserFunction.h"
+#include "MantidCurveFitting/Jacobian.h"
+
+#include <algorithm>
+#include <cmath>
 
 using namespace Mantid;
 using namespace Mantid::Kernel;
@@ -171,6 +175,35 @@ public:
     TS_ASSERT_DELTA(fn.intensity(), intensity, 1e-6);
     TS_ASSERT_DELTA(fn.getParameter("Height"), 0.398942, 1e-6);
   }
+
+  void test_peak_radius_limits_evaluation_in_either_x_order() {
+    Gaussian fn;
+    fn.initialize();
+    fn.setParameter("Height", 1.0);
+    fn.setParameter("PeakCentre", 1.0);
+    fn.setParameter("Sigma", 1.0);
+    // Three FWHMs are 7.06 either side of the centre
+    std::vector<double> xValues;
+    for (int i = 0; i <= 40; ++i)
+      xValues.push_back(-10.0 + 0.5 * i);
+    for (const bool descending : {false, true}) {
+      if (descending)
+        std::reverse(xValues.begin(), xValues.end());
+      FunctionDomain1DVector domain(xValues);
+      domain.setPeakRadius(3);
+      FunctionValues values(domain);
+      fn.function(domain, values);
+      Mantid::CurveFitting::Jacobian jacobian(domain.size(), fn.nParams());
+      fn.functionDeriv(domain, jacobian);
+      for (size_t i = 0; i < domain.size(); ++i) {
+        const double diff = domain[i] - 1.0;
+        const double expected =
+            std::fabs(diff) < 7.06 ? std::exp(-0.5 * diff * diff) : 0.0;
+        TS_ASSERT_DELTA(values[i], expected, 1e-12);
+        TS_ASSERT_DELTA(jacobian.get(i, 0), expected, 1e-12);
+      }
+    }
+  }
 };
 
 #endif /*GAUSSIANTEST_H_*/
\ No newline at end of file
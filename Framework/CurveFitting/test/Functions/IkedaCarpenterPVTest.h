@@ -12,11 +12,15 @@
 #include "MantidAPI/Axis.h"
 #include "MantidCurveFitting/Algorithms/Fit.h"
 #include "MantidCurveFitting/Functions/IkedaCarpenterPV.h"
+#include "MantidCurveFitting/Jacobian.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidKernel/ConfigService.h"
 
 #include <boost/scoped_array.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace Mantid::CurveFitting::Functions;
 
 class IkedaCarpenterPVTest : public CxxTest::TestSuite {
@@ -76,6 +80,33 @@ public:
     fn.setParameter("X0", 0);
     TS_ASSERT_DELTA(fn.intensity(), 810.7256, 1e-4);
   }
+
+  void test_derivatives_match_numerical_derivatives() {
+    IkedaCarpenterPV fn;
+    fn.initialize();
+    fn.setParameter("I", 3101.672);
+    fn.setParameter("Alpha0", 1.6);
+    fn.setParameter("Alpha1", 1.5);
+    fn.setParameter("Beta0", 31.9);
+    fn.setParameter("Kappa", 46.0);
+    fn.setParameter("SigmaSquared", 99.935);
+    fn.setParameter("Gamma", 2.5);
+    fn.setParameter("X0", 49.984);
+
+    Mantid::API::FunctionDomain1DVector x(0, 155, 31);
+    Mantid::CurveFitting::Jacobian analytic(x.size(), 8);
+    Mantid::CurveFitting::Jacobian numerical(x.size(), 8);
+    TS_ASSERT_THROWS_NOTHING(fn.functionDeriv(x, analytic));
+    fn.calNumericalDeriv(x, numerical);
+    for (size_t iP = 0; iP < 8; ++iP) {
+      double scale = 0.;
+      for (size_t i = 0; i < x.size(); ++i)
+        scale = std::max(scale, std::fabs(numerical.get(i, iP)));
+      for (size_t i = 0; i < x.size(); ++i)
+        TS_ASSERT_DELTA(analytic.get(i, iP), numerical.get(i, iP),
+                        1e-2 * scale);
+    }
+  }
 };
 
 #endif /*IKEDACARPENTERPVTEST_H_*/
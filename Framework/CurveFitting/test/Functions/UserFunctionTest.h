@@ -13,6 +13,9 @@
 #include "MantidAPI/Jacobian.h"
 #include "MantidCurveFitting/Functions/UserFunction.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace Mantid::CurveFitting;
 using namespace Mantid::CurveFitting::Functions;
 using namespace Mantid::API;
@@ -84,6 +87,58 @@ public:
     TS_ASSERT(categories.size() == 1);
     TS_ASSERT(categories[0] == "General");
   }
+
+  void test_compiled_formula_has_exact_derivatives() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("h*exp(-(x-c)^2/w)"));
+    fun.setParameter("h", 2.5);
+    fun.setParameter("c", 0.4);
+    fun.setParameter("w", 0.3);
+
+    const size_t nData = 10;
+    std::vector<double> x(nData), y(nData);
+    for (size_t i = 0; i < nData; i++) {
+      x[i] = 0.1 * static_cast<double>(i);
+    }
+    fun.function1D(y.data(), x.data(), nData);
+    FunctionDomain1DVector domain(x);
+    UserTestJacobian J(nData, 3);
+    fun.functionDeriv(domain, J);
+
+    for (size_t i = 0; i < nData; i++) {
+      const double dx = x[i] - 0.4;
+      const double gaussian = std::exp(-dx * dx / 0.3);
+      TS_ASSERT_DELTA(y[i], 2.5 * gaussian, 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 0), gaussian, 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 1), 2.5 * gaussian * 2 * dx / 0.3, 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 2), 2.5 * gaussian * dx * dx / 0.09, 1e-12);
+    }
+  }
+
+  void test_formula_left_to_muParser() {
+    // A formula the compiler does not support
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("h*(x < c ? x : c)"));
+    fun.setParameter("h", 2.);
+    fun.setParameter("c", 0.45);
+
+    const size_t nData = 10;
+    std::vector<double> x(nData), y(nData);
+    for (size_t i = 0; i < nData; i++) {
+      x[i] = 0.1 * static_cast<double>(i);
+    }
+    fun.function1D(y.data(), x.data(), nData);
+    FunctionDomain1DVector domain(x);
+    UserTestJacobian J(nData, 2);
+    fun.functionDeriv(domain, J);
+
+    for (size_t i = 0; i < nData; i++) {
+      const double value = std::min(x[i], 0.45);
+      TS_ASSERT_DELTA(y[i], 2. * value, 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 0), value, 1e-6);
+      TS_ASSERT_DELTA(J.get(i, 1), x[i] < 0.45 ? 0. : 2., 1e-6);
+    }
+  }
 };
 
 #endif /*USERFUNCTIONTEST_H_*/
@@ -71,6 +71,17 @@ public:
     TS_ASSERT_DELTA(z.real(), 0.0085, 0.001);
     TS_ASSERT_DELTA(z.imag(), -0.0984, 0.001);
   }
+
+  void test_exponentialIntegral_is_accurate_in_the_right_half_plane() {
+    // The derivatives of IkedaCarpenterPV rely on values accurate to much
+    // better than the 0.001 above
+    complex<double> z = exponentialIntegral(complex<double>(4.0, 1.0));
+    TS_ASSERT_DELTA(z.real(), 0.197360250839, 1e-11);
+    TS_ASSERT_DELTA(z.imag(), -0.041685232071, 1e-11);
+    z = exponentialIntegral(complex<double>(9.5, 0.4));
+    TS_ASSERT_DELTA(z.real(), 0.095842544331, 1e-11);
+    TS_ASSERT_DELTA(z.imag(), -0.003704979397, 1e-11);
+  }
 };
 
 #endif /*SPECIALFUNCTIONSUPPORTTEST_H_*/
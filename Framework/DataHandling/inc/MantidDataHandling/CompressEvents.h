@@ -10,6 +10,9 @@
 #include "MantidAPI/DistributedAlgorithm.h"
 
 namespace Mantid {
+namespace API {
+class Run;
+}
 namespace DataHandling {
 /** Compress an EventWorkspace by lumping together events with very close TOF
  value,
@@ -44,6 +47,9 @@ public:
   /// Algorithm's category for identification overriding a virtual method
   const std::string category() const override { return "Events"; }
 
+  static void addCompressionLogs(API::Run &run, const double tolerance,
+                                 const double wallClockTolerance);
+
 private:
   // Implement abstract Algorithm methods
   void init() override;
@@ -28,7 +28,8 @@ public:
        bool event_id_is_spec, std::vector<std::string> bankNames,
        const std::vector<int> &periodLog, const std::string &classType,
        std::vector<std::size_t> bankNumEvents, const bool oldNeXusFileNames,
-       const bool precount, const int chunk, const int totalChunks);
+       const bool precount, const int chunk, const int totalChunks,
+       const int processTasksPerBank = 0, const int readAheadBanks = 0);
 
   /// Flag for dealing with a simulated file
   bool m_haveWeights;
@@ -36,8 +37,8 @@ public:
   /// True if the event_id is spectrum no not pixel ID
   bool event_id_is_spec;
 
-  /// whether or not to launch multiple ProcessBankData jobs per bank
-  bool splitProcessing;
+  /// number of ProcessBankData jobs to launch per bank
+  size_t processTasksPerBank;
 
   /// Do we pre-count the # of events in each pixel ID?
   bool precount;
@@ -81,7 +82,8 @@ private:
   DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                      bool haveWeights, bool event_id_is_spec,
                      const size_t numBanks, const bool precount,
-                     const int chunk, const int totalChunks);
+                     const int chunk, const int totalChunks,
+                     const int processTasksPerBank);
   std::pair<size_t, size_t>
   setupChunking(std::vector<std::string> &bankNames,
                 std::vector<std::size_t> &bankNumEvents);
@@ -0,0 +1,68 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAHANDLING_EVENTCACHEFILE_H_
+#define MANTID_DATAHANDLING_EVENTCACHEFILE_H_
+
+#include "MantidDataHandling/DllConfig.h"
+
+#include <string>
+
+namespace Mantid {
+namespace DataObjects {
+class EventWorkspace;
+}
+namespace DataHandling {
+
+/** EventCacheFile : a binary cache of the events of an EventWorkspace, used by
+  LoadEventNexus to avoid decoding the same NeXus file again.
+
+  The events of each spectrum are stored as one contiguous block in workspace
+  index order, i.e. already grouped by pixel, behind a table of offsets. The
+  cache is read through a read-only memory mapping of the file, so each
+  spectrum is filled with a single copy straight from the page cache, and
+  reopening a run that is still cached by the operating system does not touch
+  the disk at all.
+
+  The cache records the size and modification time of the file it was created
+  from and is rejected if either has changed. It is a local, machine-specific
+  format and is not meant to be shared or archived.
+*/
+class MANTID_DATAHANDLING_DLL EventCacheFile {
+public:
+  static void write(const std::string &cacheFilename,
+                    const std::string &sourceFilename,
+                    const DataObjects::EventWorkspace &workspace);
+  static bool read(const std::string &cacheFilename,
+                   const std::string &sourceFilename,
+                   DataObjects::EventWorkspace &workspace);
+};
+
+/** SharedEventCache : the same cache of the events of an EventWorkspace, held
+  in a named shared memory segment, so that several processes on a node can
+  load a run once and share it.
+
+  The process publishing the events keeps the segment until it calls
+  release() or exits. Readers attach, copy the events into their own
+  workspace and detach, so modifying a workspace never affects the shared
+  events. The segment counts the processes attached to it and the last one to
+  detach removes it. A process that crashes while attached leaves the segment
+  behind until it is removed by the operating system or a reboot.
+*/
+class MANTID_DATAHANDLING_DLL SharedEventCache {
+public:
+  static bool publish(const std::string &name,
+                      const std::string &sourceFilename,
+                      const DataObjects::EventWorkspace &workspace);
+  static bool read(const std::string &name, const std::string &sourceFilename,
+                   DataObjects::EventWorkspace &workspace);
+  static void release(const std::string &name);
+};
+
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_EVENTCACHEFILE_H_ */
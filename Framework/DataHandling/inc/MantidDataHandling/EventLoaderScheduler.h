@@ -0,0 +1,63 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAHANDLING_EVENTLOADERSCHEDULER_H_
+#define MANTID_DATAHANDLING_EVENTLOADERSCHEDULER_H_
+
+#include "MantidDataHandling/DllConfig.h"
+#include "MantidKernel/ThreadSchedulerMutexes.h"
+
+namespace Mantid {
+namespace DataHandling {
+
+/** EventLoaderScheduler : schedules the tasks of DefaultEventLoader as a
+  bounded two-stage pipeline.
+
+  Tasks holding a mutex (LoadBankFromDiskTask, which reads a bank from the
+  file) are producers and tasks without one (ProcessBankData, which scatters
+  the events of a bank into the event lists) are consumers. The scheduler
+  differs from ThreadSchedulerMutexes in three ways:
+
+  - Consumers are always handed out first, and a producer is only handed out
+    while the consumers it will create fit in a bounded queue. This gives
+    back-pressure: reading stops getting ahead of processing, which bounds the
+    memory held by banks that have been read but not yet processed.
+  - A task whose mutex is busy is never handed out, so idle threads poll for
+    processing work instead of blocking on the file mutex.
+  - The queue only reports empty once every task has finished, so that threads
+    do not exit while a running read is about to create more work.
+*/
+class MANTID_DATAHANDLING_DLL EventLoaderScheduler
+    : public Kernel::ThreadSchedulerMutexes {
+public:
+  EventLoaderScheduler(const size_t maxQueuedProcessTasks,
+                       const size_t processTasksPerRead);
+
+  void push(std::shared_ptr<Kernel::Task> newTask) override;
+  std::shared_ptr<Kernel::Task> pop(size_t threadnum) override;
+  void finished(Kernel::Task *task, size_t threadnum) override;
+  bool empty() override;
+  void clear() override;
+
+private:
+  bool canStartRead() const;
+
+  /// Capacity of the queue between reading and processing, in tasks
+  const size_t m_maxQueuedProcessTasks;
+  /// Number of processing tasks created by each read
+  const size_t m_processTasksPerRead;
+  /// Processing tasks queued or running
+  size_t m_processTasks{0};
+  /// Read tasks running
+  size_t m_runningReads{0};
+  /// All tasks running
+  size_t m_running{0};
+};
+
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_EVENTLOADERSCHEDULER_H_ */
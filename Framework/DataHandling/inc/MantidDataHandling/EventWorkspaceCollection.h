@@ -49,6 +49,7 @@ public:
       size_t nPeriods,
       std::unique_ptr<const Kernel::TimeSeriesProperty<int>> &periodLog);
   void reserveEventListAt(size_t wi, size_t size);
+  void shrinkEventListsToFit();
   size_t nPeriods() const;
   DataObjects::EventWorkspace_sptr getSingleHeldWorkspace();
   API::Workspace_sptr combinedWorkspace();
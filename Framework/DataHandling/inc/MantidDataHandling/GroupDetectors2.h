@@ -202,7 +202,9 @@ private:
   /// input into the output workspace
   size_t formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
                          DataObjects::EventWorkspace_sptr outputWS,
-                         const double prog4Copy);
+                         const double prog4Copy, const bool keepAll,
+                         const std::set<int64_t> &unGroupedSet,
+                         Indexing::IndexInfo &indexInfo);
 
   /// Copy the ungrouped spectra from the input workspace to the output
   template <class TIn, class TOut>
@@ -90,6 +90,11 @@ private:
                                    const std::string &wsName);
   /// Plus two workspaces together, "in place".
   API::Workspace_sptr plusWs(API::Workspace_sptr ws1, API::Workspace_sptr ws2);
+  /// Load files and add them to a workspace, "in place".
+  API::Workspace_sptr
+  loadAndPlusWs(API::Workspace_sptr sumWs,
+                const std::vector<std::string> &fileNames,
+                std::vector<API::Workspace_sptr> &tempWsList);
   /// Manually group workspaces.
   API::WorkspaceGroup_sptr
   groupWsList(const std::vector<API::Workspace_sptr> &wsList);
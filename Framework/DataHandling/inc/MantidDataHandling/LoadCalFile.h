@@ -47,6 +47,7 @@ public:
   const std::string category() const override {
     return R"(DataHandling\Text;Diffraction\DataHandling\CalFiles)";
   }
+  void afterPropertySet(const std::string &name) override;
 
   static void getInstrument3WaysInit(Mantid::API::Algorithm *alg);
 
@@ -54,6 +55,10 @@ public:
   getInstrument3Ways(API::Algorithm *alg);
   static bool instrumentIsSpecified(API::Algorithm *alg);
 
+  static void declareOutputProperty(API::Algorithm *alg,
+                                    std::unique_ptr<Kernel::Property> property,
+                                    bool wanted, const std::string &doc);
+
   static void readCalFile(const std::string &calFileName,
                           Mantid::DataObjects::GroupingWorkspace_sptr groupWS,
                           Mantid::DataObjects::OffsetsWorkspace_sptr offsetsWS,
@@ -69,6 +74,8 @@ private:
   void init() override;
   /// Run the algorithm
   void exec() override;
+  /// Declare the output workspace properties that were asked for
+  void declareOutputProperties();
 
   /// Checks if a detector ID is for a monitor on a given instrument
   static bool idIsMonitor(Mantid::Geometry::Instrument_const_sptr inst,
@@ -30,6 +30,7 @@ public:
   }
   const std::string category() const override;
   const std::string summary() const override;
+  void afterPropertySet(const std::string &name) override;
 
 protected:
   Parallel::ExecutionMode getParallelExecutionMode(
@@ -39,6 +40,7 @@ protected:
 private:
   void init() override;
   void exec() override;
+  void declareOutputProperties();
   void getInstrument(H5::H5File &file);
   void loadGroupingFromAlternateFile();
   void runLoadCalFile();
@@ -170,6 +170,11 @@ public:
 
   /// Tolerance for CompressEvents; use -1 to mean don't compress.
   double compressTolerance;
+  /// Wall-clock tolerance (in seconds) for CompressEvents; EMPTY_DBL() to
+  /// compress all the pulse times together.
+  double compressWallClockTolerance;
+  /// Time the pulse time bins of the compressed events start from
+  Mantid::Types::Core::DateAndTime compressStartTime;
 
   /// Pulse times for ALL banks, taken from proton_charge log.
   boost::shared_ptr<BankPulseTimes> m_allBanksPulseTimes;
@@ -200,9 +205,13 @@ private:
   DataObjects::EventWorkspace_sptr createEmptyEventWorkspace();
 
   void loadEvents(API::Progress *const prog, const bool monitors);
+  bool canUseEventCache(const bool isTimeFiltered);
+  void filterEventsAfterParallelLoad(DataObjects::EventWorkspace &ws);
   void createSpectraMapping(
       const std::string &nxsfile, const bool monitorsOnly,
-      const std::vector<std::string> &bankNames = std::vector<std::string>());
+      const std::vector<std::string> &bankNames = std::vector<std::string>(),
+      const std::vector<std::string> &eventBankNames = {},
+      const std::vector<size_t> &bankEventCounts = {});
   void deleteBanks(EventWorkspaceCollection_sptr workspace,
                    std::vector<std::string> bankNames);
   bool hasEventMonitors();
@@ -34,6 +34,9 @@ public:
 
   std::pair<int32_t, int32_t> eventIDLimits() const;
 
+  void setBankEventCounts(const std::vector<std::string> &bankNames,
+                          const std::vector<size_t> &eventCounts);
+
   Indexing::IndexInfo makeIndexInfo();
   Indexing::IndexInfo makeIndexInfo(const std::vector<std::string> &bankNames);
   Indexing::IndexInfo
@@ -43,12 +46,15 @@ public:
 
 private:
   Indexing::IndexInfo filterIndexInfo(const Indexing::IndexInfo &indexInfo);
+  Indexing::IndexInfo scatter(const Indexing::IndexInfo &indexInfo) const;
 
   const API::MatrixWorkspace_const_sptr m_instrumentWorkspace;
   int32_t m_min;
   int32_t m_max;
   std::vector<int32_t> m_range;
   const Parallel::Communicator m_communicator;
+  std::vector<std::string> m_bankNames;
+  std::vector<size_t> m_bankEventCounts;
 };
 
 } // namespace DataHandling
@@ -89,7 +89,7 @@ private:
 
   /// Initialises a workspace with IDF and fills it with data
   DataObjects::Workspace2D_sptr makeWorkspace(
-      const FITSInfo &fileInfo, size_t &newFileNumber,
+      const FITSInfo &fileInfo, const size_t fileNumber,
       std::vector<char> &buffer, API::MantidImage &imageY,
       API::MantidImage &imageE, const DataObjects::Workspace2D_sptr parent,
       bool loadAsRectImg = false, int binSize = 1, double noiseThresh = false);
@@ -22,10 +22,15 @@
 #include <boost/scoped_ptr.hpp>
 
 #include <climits>
+#include <memory>
 
 //----------------------------------------------------------------------
 // Forward declaration
 //----------------------------------------------------------------------
+namespace H5 {
+class DataSet;
+} // namespace H5
+
 namespace Mantid {
 namespace DataHandling {
 
@@ -124,6 +129,13 @@ private:
                  int64_t period, int64_t start, int64_t &hist,
                  int64_t &spec_num,
                  DataObjects::Workspace2D_sptr &local_workspace);
+  // Open the detector counts with HDF5
+  std::unique_ptr<H5::DataSet>
+  openCountsDataSet(const NeXus::NXEntry &entry) const;
+  // Load a range of spectra with HDF5
+  void loadSpectraRange(H5::DataSet &data, int64_t nSpectra, int64_t period,
+                        int64_t start, int64_t &hist, int64_t &spec_num,
+                        DataObjects::Workspace2D_sptr &local_workspace);
 
   // Create period logs
   void createPeriodLogs(int64_t period,
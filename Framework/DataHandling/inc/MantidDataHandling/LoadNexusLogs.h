@@ -10,6 +10,8 @@
 #include "MantidAPI/DistributedAlgorithm.h"
 #include <nexus/NeXusFile.hpp>
 
+#include <set>
+
 namespace Mantid {
 namespace Kernel {
 class Property;
@@ -79,6 +81,8 @@ private:
   /// Create a time series property
   Kernel::Property *createTimeSeries(::NeXus::File &file,
                                      const std::string &prop_name) const;
+  /// Whether a log should be read given the allow and block lists
+  bool isLogWanted(const std::string &name) const;
 
   /// Progress reporting object
   boost::shared_ptr<API::Progress> m_progress;
@@ -86,6 +90,11 @@ private:
   /// Use frequency start for Monitor19 and Special1_19 logs with "No Time" for
   /// SNAP
   std::string freqStart;
+
+  /// The only logs to read, if not empty
+  std::set<std::string> m_allowList;
+  /// The logs not to read
+  std::set<std::string> m_blockList;
 };
 
 } // namespace DataHandling
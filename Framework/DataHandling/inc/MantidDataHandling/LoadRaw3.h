@@ -81,8 +81,15 @@ private:
                         DataObjects::Workspace2D_sptr ws_sptr,
                         DataObjects::Workspace2D_sptr mws_sptr);
 
-  /// skip all spectra in a period
-  void skipPeriod(FILE *file, const int64_t &period);
+  /// A spectrum of the file and where to put it
+  struct SpectrumToLoad {
+    int64_t hist;
+    specnum_t specNum;
+    DataObjects::Workspace2D_sptr workspace;
+    int64_t wsIndex;
+  };
+  /// read spectra from the file and decompress them in parallel
+  void loadSpectra(FILE *file, const std::vector<SpectrumToLoad> &spectra);
   /// return true if loading a selection of periods
   bool isSelectedPeriods() const { return !m_periodList.empty(); }
   /// check if a period should be loaded
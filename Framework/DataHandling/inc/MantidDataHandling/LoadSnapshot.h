@@ -0,0 +1,49 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAHANDLING_LOADSNAPSHOT_H_
+#define MANTID_DATAHANDLING_LOADSNAPSHOT_H_
+
+#include "MantidAPI/IFileLoader.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+
+#include <iosfwd>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** LoadSnapshot : loads a workspace saved by SaveSnapshot. The data of the
+  spectra are read by several threads.
+*/
+class DLLExport LoadSnapshot
+    : public API::IFileLoader<Kernel::FileDescriptor> {
+public:
+  const std::string name() const override { return "LoadSnapshot"; }
+  int version() const override { return 1; }
+  const std::vector<std::string> seeAlso() const override {
+    return {"SaveSnapshot", "LoadNexusProcessed"};
+  }
+  const std::string category() const override { return "DataHandling"; }
+  const std::string summary() const override {
+    return "Loads a workspace from a binary snapshot file written by "
+           "SaveSnapshot.";
+  }
+  int confidence(Kernel::FileDescriptor &descriptor) const override;
+
+private:
+  void init() override;
+  void exec() override;
+  void readMetadata(std::istream &in, const API::MatrixWorkspace_sptr &ws);
+  void readLogs(std::istream &in, API::MatrixWorkspace &ws) const;
+  void loadInstrument(const API::MatrixWorkspace_sptr &ws,
+                      const std::string &instrumentName,
+                      const std::string &instrumentXml);
+};
+
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_LOADSNAPSHOT_H_ */
@@ -14,6 +14,9 @@
 #include "MantidAPI/MatrixWorkspace_fwd.h"
 
 namespace Mantid {
+namespace Kernel {
+class NumberFormat;
+}
 namespace DataHandling {
 /** @class SaveAscii2 SaveAscii2.h DataHandling/SaveAscii2.h
 
@@ -52,8 +55,9 @@ private:
   void init() override;
   /// Overwrites Algorithm method
   void exec() override;
-  /// Writes a spectrum to the file using a workspace index
-  void writeSpectrum(const int &wsIndex, std::ofstream &file);
+  /// Appends the text of a spectrum to a string using a workspace index
+  void formatSpectrum(const size_t wsIndex, const Kernel::NumberFormat &format,
+                      std::string &text) const;
   std::vector<std::string> stringListToVector(std::string &inputString);
   void populateQMetaData();
   void populateSpectrumNumberMetaData();
@@ -0,0 +1,48 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAHANDLING_SAVESNAPSHOT_H_
+#define MANTID_DATAHANDLING_SAVESNAPSHOT_H_
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+
+#include <iosfwd>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** SaveSnapshot : saves a Workspace2D or an EventWorkspace to a flat binary
+  file that LoadSnapshot reads back quickly, e.g. to checkpoint a reduction.
+  The layout is described in SnapshotFormat.h. The data of the spectra are
+  written by several threads.
+*/
+class DLLExport SaveSnapshot : public API::Algorithm {
+public:
+  const std::string name() const override { return "SaveSnapshot"; }
+  int version() const override { return 1; }
+  const std::vector<std::string> seeAlso() const override {
+    return {"LoadSnapshot", "SaveNexusProcessed"};
+  }
+  const std::string category() const override { return "DataHandling"; }
+  const std::string summary() const override {
+    return "Saves a Workspace2D or an EventWorkspace to a binary snapshot "
+           "file, which is much faster to save and load than a processed "
+           "NeXus file.";
+  }
+  std::map<std::string, std::string> validateInputs() override;
+
+private:
+  void init() override;
+  void exec() override;
+  void writeMetadata(std::ostream &out, const API::MatrixWorkspace &ws) const;
+  void writeLogs(std::ostream &out, const API::MatrixWorkspace &ws) const;
+};
+
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_SAVESNAPSHOT_H_ */
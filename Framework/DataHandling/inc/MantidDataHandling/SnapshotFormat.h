@@ -0,0 +1,125 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAHANDLING_SNAPSHOTFORMAT_H_
+#define MANTID_DATAHANDLING_SNAPSHOTFORMAT_H_
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** The layout of the workspace snapshots written by SaveSnapshot and read by
+  LoadSnapshot. All values are in the native byte order of the machine that
+  wrote the file, which is checked when it is read.
+
+  <ul>
+  <li>Header: the magic "MTDSNAP", the version, the byte order marker
+  0x01020304, the workspace kind and the sizes of the three event types.</li>
+  <li>Metadata, read serially: the title, units, logs, instrument definition
+  and parameters, the positions, rotations and masks of the detectors, the
+  vertical axis, the spectrum numbers, detector IDs and masked bins, and the
+  X values shared by all the spectra, if any.</li>
+  <li>Data: a table of the offsets of the block of each spectrum from the
+  start of the data, then the blocks. A block holds its own X values unless
+  they are shared, then Y, E and Dx for histograms or the raw events. The
+  offsets let the blocks be written and read by several threads.</li>
+  </ul>
+*/
+namespace Snapshot {
+
+const char MAGIC[8] = "MTDSNAP";
+const uint32_t VERSION = 1;
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+/// The kinds of workspace a snapshot can hold
+enum class Kind : uint32_t { Workspace2D = 0, EventWorkspace = 1 };
+/// The kinds of vertical axis
+enum class AxisKind : uint8_t {
+  Spectra = 0,
+  Numeric = 1,
+  BinEdge = 2,
+  Text = 3
+};
+/// The kinds of logs. Logs of other types are saved as strings.
+enum class LogKind : uint8_t {
+  String = 0,
+  Double = 1,
+  Int = 2,
+  DoubleSeries = 3,
+  IntSeries = 4,
+  BoolSeries = 5,
+  StringSeries = 6
+};
+/// The flags of a spectrum block
+enum BlockFlags : uint8_t { SharedX = 1, HasDx = 2 };
+
+template <typename T> void write(std::ostream &out, const T &value) {
+  out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+inline void write(std::ostream &out, const std::string &value) {
+  write<uint64_t>(out, value.size());
+  out.write(value.data(), value.size());
+}
+
+/// Write the size of an array of plain values, then the values
+template <typename T>
+void writeArray(std::ostream &out, const T *values, const size_t size) {
+  write<uint64_t>(out, size);
+  out.write(reinterpret_cast<const char *>(values), size * sizeof(T));
+}
+
+template <typename T>
+void writeArray(std::ostream &out, const std::vector<T> &values) {
+  writeArray(out, values.data(), values.size());
+}
+
+/// @return the number of bytes writeArray writes
+template <typename T> size_t arrayBytes(const size_t size) {
+  return sizeof(uint64_t) + size * sizeof(T);
+}
+
+template <typename T> T read(std::istream &in) {
+  T value{};
+  in.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return value;
+}
+
+inline std::string readString(std::istream &in) {
+  std::string value(read<uint64_t>(in), '\0');
+  in.read(&value[0], value.size());
+  return value;
+}
+
+template <typename T> void readArray(std::istream &in, std::vector<T> &values) {
+  values.resize(read<uint64_t>(in));
+  in.read(reinterpret_cast<char *>(values.data()), values.size() * sizeof(T));
+}
+
+template <typename T> std::vector<T> readArray(std::istream &in) {
+  std::vector<T> values;
+  readArray(in, values);
+  return values;
+}
+
+/// Throw if a stream has failed
+inline void check(const std::ios &stream, const std::string &filename) {
+  if (!stream)
+    throw std::runtime_error("Error accessing the snapshot file " + filename);
+}
+
+} // namespace Snapshot
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_SNAPSHOTFORMAT_H_ */
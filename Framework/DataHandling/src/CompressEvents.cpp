@@ -12,9 +12,11 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/DateAndTimeHelpers.h"
 #include "MantidKernel/DateTimeValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include "tbb/parallel_for.h"
 
+#include <algorithm>
 #include <numeric>
 #include <set>
 
@@ -27,6 +29,11 @@ using namespace Kernel;
 using namespace API;
 using namespace DataObjects;
 
+namespace {
+/// Spectra with fewer events than this are never compressed in parallel
+const size_t MIN_EVENTS_FOR_PARALLEL_SPECTRUM = 1000000;
+} // namespace
+
 void CompressEvents::init() {
   declareProperty(
       std::make_unique<WorkspaceProperty<EventWorkspace>>("InputWorkspace", "",
@@ -97,49 +104,88 @@ void CompressEvents::exec() {
   if (!inplace) {
     outputWS = create<EventWorkspace>(*inputWS, HistogramData::BinEdges(2));
     // We DONT copy the data though
-    // Loop over the histograms (detector spectra)
-    tbb::parallel_for(
-        tbb::blocked_range<size_t>(0, noSpectra),
-        [compressFat, toleranceTof, startTime, toleranceWallClock, &inputWS,
-         &outputWS, &prog](const tbb::blocked_range<size_t> &range) {
-          for (size_t index = range.begin(); index < range.end(); ++index) {
-            // The input event list
-            EventList &input_el = inputWS->getSpectrum(index);
-            // And on the output side
-            EventList &output_el = outputWS->getSpectrum(index);
-            // Copy other settings into output
-            output_el.setX(input_el.ptrX());
-            // The EventList method does the work.
-            if (compressFat)
-              input_el.compressFatEvents(toleranceTof, startTime,
-                                         toleranceWallClock, &output_el);
-            else
-              input_el.compressEvents(toleranceTof, &output_el);
-            prog.report("Compressing");
-          }
-        });
-  } else { // inplace
-    tbb::parallel_for(
-        tbb::blocked_range<size_t>(0, noSpectra),
-        [compressFat, toleranceTof, startTime, toleranceWallClock, &outputWS,
-         &prog](const tbb::blocked_range<size_t> &range) {
-          for (size_t index = range.begin(); index < range.end(); ++index) {
-            // The input (also output) event list
-            auto &output_el = outputWS->getSpectrum(index);
-            // The EventList method does the work.
-            if (compressFat)
-              output_el.compressFatEvents(toleranceTof, startTime,
-                                          toleranceWallClock, &output_el);
-            else
-              output_el.compressEvents(toleranceTof, &output_el);
-            prog.report("Compressing");
-          }
-        });
   }
 
+  // Spectra holding more than their share of the events of a thread, such as
+  // monitors or summed banks, would run on a single core. They are compressed
+  // one at a time, with their events split between the threads, and the
+  // other spectra in parallel.
+  std::vector<bool> compressWithinSpectrum(noSpectra, false);
+  if (!compressFat) {
+    const size_t numEvents = inputWS->getNumberEvents();
+    const auto numThreads =
+        static_cast<size_t>(std::max(PARALLEL_GET_MAX_THREADS, 1));
+    const size_t threshold =
+        std::max(numEvents / numThreads, MIN_EVENTS_FOR_PARALLEL_SPECTRUM);
+    if (numThreads > 1) {
+      for (size_t index = 0; index < noSpectra; ++index)
+        compressWithinSpectrum[index] =
+            inputWS->getSpectrum(index).getNumberEvents() > threshold;
+    }
+  }
+
+  auto compressSpectrum = [compressFat, toleranceTof, startTime,
+                           toleranceWallClock, inplace, &inputWS, &outputWS,
+                           &prog](const size_t index, const bool parallel) {
+    // The input event list
+    EventList &input_el = inputWS->getSpectrum(index);
+    // And on the output side
+    EventList &output_el = outputWS->getSpectrum(index);
+    // Copy other settings into output
+    if (!inplace)
+      output_el.setX(input_el.ptrX());
+    // The EventList method does the work.
+    if (compressFat)
+      input_el.compressFatEvents(toleranceTof, startTime, toleranceWallClock,
+                                 &output_el);
+    else
+      input_el.compressEvents(toleranceTof, &output_el, parallel);
+    prog.report("Compressing");
+  };
+
+  // Loop over the histograms (detector spectra)
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, noSpectra),
+                    [&compressSpectrum, &compressWithinSpectrum](
+                        const tbb::blocked_range<size_t> &range) {
+                      for (size_t index = range.begin(); index < range.end();
+                           ++index) {
+                        if (!compressWithinSpectrum[index])
+                          compressSpectrum(index, false);
+                      }
+                    });
+  for (size_t index = 0; index < noSpectra; ++index) {
+    if (compressWithinSpectrum[index])
+      compressSpectrum(index, true);
+  }
+
+  addCompressionLogs(outputWS->mutableRun(), toleranceTof,
+                     toleranceWallClock);
+
   // Cast to the matrixOutputWS and save it
   this->setProperty("OutputWorkspace", outputWS);
 }
 
+/** Record the tolerances of a compression in the logs of a run, so that the
+ * resolution of the compressed events is known to the algorithms filtering
+ * them. Compressing events again keeps the coarsest tolerances.
+ * @param run :: the run of the compressed workspace
+ * @param tolerance :: the tolerance on the X values of the events
+ * @param wallClockTolerance :: the tolerance (in seconds) on the pulse times,
+ * EMPTY_DBL() if all the pulse times were compressed together
+ */
+void CompressEvents::addCompressionLogs(API::Run &run, const double tolerance,
+                                        const double wallClockTolerance) {
+  auto addCoarsest = [&run](const std::string &name, double value) {
+    if (run.hasProperty(name))
+      value = std::max(value, run.getPropertyValueAsType<double>(name));
+    run.addProperty(name, value, true);
+  };
+  addCoarsest("compress_tolerance", tolerance);
+  if (!isEmpty(wallClockTolerance))
+    addCoarsest("compress_wall_clock_tolerance", wallClockTolerance);
+  else if (run.hasProperty("compress_wall_clock_tolerance"))
+    run.removeProperty("compress_wall_clock_tolerance");
+}
+
 } // namespace DataHandling
 } // namespace Mantid
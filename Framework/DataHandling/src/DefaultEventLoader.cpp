@@ -6,10 +6,10 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataHandling/DefaultEventLoader.h"
 #include "MantidAPI/Progress.h"
+#include "MantidDataHandling/EventLoaderScheduler.h"
 #include "MantidDataHandling/LoadBankFromDiskTask.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidKernel/ThreadPool.h"
-#include "MantidKernel/ThreadSchedulerMutexes.h"
 
 using namespace Mantid::Kernel;
 
@@ -23,21 +23,28 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                               const std::string &classType,
                               std::vector<std::size_t> bankNumEvents,
                               const bool oldNeXusFileNames, const bool precount,
-                              const int chunk, const int totalChunks) {
+                              const int chunk, const int totalChunks,
+                              const int processTasksPerBank,
+                              const int readAheadBanks) {
   DefaultEventLoader loader(alg, ws, haveWeights, event_id_is_spec,
-                            bankNames.size(), precount, chunk, totalChunks);
+                            bankNames.size(), precount, chunk, totalChunks,
+                            processTasksPerBank);
 
   auto bankRange = loader.setupChunking(bankNames, bankNumEvents);
 
-  // Make the thread pool
-  auto scheduler = new ThreadSchedulerMutexes;
+  // Make the thread pool. Reading is limited so that at most readAheadBanks
+  // banks are waiting to be, or being, processed.
+  const size_t banksInFlight =
+      readAheadBanks > 0 ? static_cast<size_t>(readAheadBanks)
+                         : static_cast<size_t>(ThreadPool::getNumPhysicalCores());
+  auto scheduler = new EventLoaderScheduler(
+      banksInFlight * loader.processTasksPerBank, loader.processTasksPerBank);
   ThreadPool pool(scheduler);
   auto diskIOMutex = boost::make_shared<std::mutex>();
 
   // set up progress bar for the rest of the (multi-threaded) process
-  size_t numProg = bankNames.size() * (1 + 3); // 1 = disktask, 3 = proc task
-  if (loader.splitProcessing)
-    numProg += bankNames.size() * 3; // 3 = second proc task
+  // 1 = disktask, 3 = each proc task
+  size_t numProg = bankNames.size() * (1 + 3 * loader.processTasksPerBank);
   auto prog = std::make_unique<API::Progress>(loader.alg, 0.3, 1.0, numProg);
 
   for (size_t i = bankRange.first; i < bankRange.second; i++) {
@@ -49,6 +56,10 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
   // Start and end all threads
   pool.joinAll();
   diskIOMutex.reset();
+
+  // Compressing events, or a spectrum being filled from several banks, can
+  // leave spare capacity behind
+  ws.shrinkEventListsToFit();
 }
 
 DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
@@ -56,7 +67,8 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
                                        bool haveWeights, bool event_id_is_spec,
                                        const size_t numBanks,
                                        const bool precount, const int chunk,
-                                       const int totalChunks)
+                                       const int totalChunks,
+                                       const int processTasksPerBank)
     : m_haveWeights(haveWeights), event_id_is_spec(event_id_is_spec),
       precount(precount), chunk(chunk), totalChunks(totalChunks), alg(alg),
       m_ws(ws) {
@@ -79,9 +91,14 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
     makeMapToEventLists(weightedEventVectors);
   }
 
-  // split banks up if the number of cores is more than twice the number of
-  // banks
-  splitProcessing = bool(numBanks * 2 < ThreadPool::getNumPhysicalCores());
+  if (processTasksPerBank > 0) {
+    this->processTasksPerBank = static_cast<size_t>(processTasksPerBank);
+  } else {
+    // split banks up if the number of cores is more than twice the number of
+    // banks
+    this->processTasksPerBank =
+        numBanks * 2 < ThreadPool::getNumPhysicalCores() ? 2 : 1;
+  }
 }
 
 std::pair<size_t, size_t>
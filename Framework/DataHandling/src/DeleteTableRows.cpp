@@ -13,8 +13,7 @@
 #include "MantidAPI/IWorkspaceProperty.h"
 #include "MantidKernel/ArrayProperty.h"
 
-#include <functional>
-#include <set>
+#include <algorithm>
 
 namespace Mantid {
 namespace DataHandling {
@@ -42,17 +41,16 @@ void DeleteTableRows::exec() {
   API::IPeaksWorkspace_sptr pw =
       boost::dynamic_pointer_cast<API::IPeaksWorkspace>(tw);
   std::vector<size_t> rows = getProperty("Rows");
-  // sort the row indices in reverse order
-  std::set<size_t, std::greater<size_t>> sortedRows(rows.begin(), rows.end());
-  auto it = sortedRows.begin();
-  for (; it != sortedRows.end(); ++it) {
-    if (*it >= tw->rowCount())
-      continue;
-    if (pw) {
-      pw->removePeak(static_cast<int>(*it));
-    } else {
-      tw->removeRow(*it);
-    }
+  // rows that don't exist are ignored
+  const size_t rowCount = tw->rowCount();
+  rows.erase(std::remove_if(rows.begin(), rows.end(),
+                            [rowCount](size_t row) { return row >= rowCount; }),
+             rows.end());
+  // remove all the rows in one go rather than one at a time
+  if (pw) {
+    pw->removePeaks(std::vector<int>(rows.begin(), rows.end()));
+  } else {
+    tw->removeRows(rows);
   }
   setProperty("TableWorkspace", tw);
 }
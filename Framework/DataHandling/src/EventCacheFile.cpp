@@ -0,0 +1,434 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataHandling/EventCacheFile.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <Poco/File.h>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace Mantid {
+namespace DataHandling {
+
+using namespace DataObjects;
+using Types::Event::TofEvent;
+
+namespace {
+/// static logger
+Kernel::Logger g_log("EventCacheFile");
+
+const char MAGIC[8] = {'M', 'T', 'D', 'E', 'V', 'C', 'A', 'C'};
+const uint32_t VERSION = 1;
+/// Event blocks start on multiples of this many bytes
+const uint64_t ALIGNMENT = 16;
+
+static_assert(std::is_trivially_copyable<TofEvent>::value &&
+                  std::is_trivially_copyable<WeightedEvent>::value &&
+                  std::is_trivially_copyable<WeightedEventNoTime>::value,
+              "Events are written to the cache as raw bytes");
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  /// sizeof each event type, to reject caches from a different build
+  uint32_t eventSizes[3];
+  uint64_t sourceSize;
+  int64_t sourceModified;
+  uint64_t numSpectra;
+};
+
+struct SpectrumEntry {
+  uint64_t offset;
+  uint64_t numEvents;
+  uint32_t eventType;
+  uint32_t sortOrder;
+};
+
+Header makeHeader(const std::string &sourceFilename,
+                  const uint64_t numSpectra) {
+  Header header;
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.eventSizes[0] = sizeof(TofEvent);
+  header.eventSizes[1] = sizeof(WeightedEvent);
+  header.eventSizes[2] = sizeof(WeightedEventNoTime);
+  Poco::File source(sourceFilename);
+  header.sourceSize = source.getSize();
+  header.sourceModified = source.getLastModified().epochMicroseconds();
+  header.numSpectra = numSpectra;
+  return header;
+}
+
+size_t eventSize(const uint32_t eventType) {
+  switch (eventType) {
+  case API::TOF:
+    return sizeof(TofEvent);
+  case API::WEIGHTED:
+    return sizeof(WeightedEvent);
+  default:
+    return sizeof(WeightedEventNoTime);
+  }
+}
+
+const char *eventData(const EventList &events) {
+  switch (events.getEventType()) {
+  case API::TOF:
+    return reinterpret_cast<const char *>(events.getEvents().data());
+  case API::WEIGHTED:
+    return reinterpret_cast<const char *>(events.getWeightedEvents().data());
+  case API::WEIGHTED_NOTIME:
+  default:
+    return reinterpret_cast<const char *>(
+        events.getWeightedEventsNoTime().data());
+  }
+}
+
+template <class T>
+void assignEvents(std::vector<T> &events, const char *data,
+                  const uint64_t numEvents) {
+  const auto *begin = reinterpret_cast<const T *>(data);
+  events.assign(begin, begin + numEvents);
+}
+
+/// The table of spectra of a workspace. size is set to the size of the cache.
+std::vector<SpectrumEntry> makeTable(const EventWorkspace &workspace,
+                                     uint64_t &size) {
+  const auto numSpectra = workspace.getNumberHistograms();
+  std::vector<SpectrumEntry> table(numSpectra);
+  uint64_t offset = sizeof(Header) + numSpectra * sizeof(SpectrumEntry);
+  for (size_t i = 0; i < numSpectra; ++i) {
+    const auto &events = workspace.getSpectrum(i);
+    offset = (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    table[i].offset = offset;
+    table[i].numEvents = events.getNumberEvents();
+    table[i].eventType = static_cast<uint32_t>(events.getEventType());
+    table[i].sortOrder = static_cast<uint32_t>(events.getSortType());
+    offset += table[i].numEvents * eventSize(table[i].eventType);
+  }
+  size = offset;
+  return table;
+}
+
+/** Fill the event lists of a workspace from a cache held in memory.
+ * @param base :: the start of the cache, aligned to ALIGNMENT
+ * @param size :: the size of the cache in bytes
+ * @param cacheName :: the name of the cache, for log messages
+ * @param sourceFilename :: path of the file the events are to be loaded from
+ * @param workspace :: the workspace to fill
+ * @return true if the events were read
+ */
+bool readCache(const char *base, const uint64_t size,
+               const std::string &cacheName, const std::string &sourceFilename,
+               EventWorkspace &workspace) {
+  if (size < sizeof(Header))
+    return false;
+  // Validate everything before modifying the workspace
+  const auto numSpectra = workspace.getNumberHistograms();
+  const Header expected = makeHeader(sourceFilename, numSpectra);
+  Header header;
+  std::memcpy(&header, base, sizeof(header));
+  if (std::memcmp(header.magic, expected.magic, sizeof(MAGIC)) != 0 ||
+      header.version != expected.version ||
+      std::memcmp(header.eventSizes, expected.eventSizes,
+                  sizeof(header.eventSizes)) != 0) {
+    g_log.information() << cacheName << " is not a compatible event cache.\n";
+    return false;
+  }
+  if (header.sourceSize != expected.sourceSize ||
+      header.sourceModified != expected.sourceModified ||
+      header.numSpectra != expected.numSpectra) {
+    g_log.information() << cacheName << " is out of date for "
+                        << sourceFilename << ".\n";
+    return false;
+  }
+  if (size < sizeof(Header) + numSpectra * sizeof(SpectrumEntry))
+    return false;
+  const auto *table =
+      reinterpret_cast<const SpectrumEntry *>(base + sizeof(Header));
+  for (size_t i = 0; i < numSpectra; ++i) {
+    const auto &entry = table[i];
+    // Event lists can only be switched towards types holding less information
+    if (entry.eventType > API::WEIGHTED_NOTIME ||
+        entry.eventType < static_cast<uint32_t>(
+                              workspace.getSpectrum(i).getEventType()) ||
+        entry.sortOrder > TIMEATSAMPLE_SORT || entry.offset % ALIGNMENT != 0 ||
+        entry.offset > size ||
+        entry.numEvents >
+            (size - entry.offset) / eventSize(entry.eventType)) {
+      g_log.warning() << cacheName << " is corrupt and will be ignored.\n";
+      return false;
+    }
+  }
+
+  const auto numHistograms = static_cast<int64_t>(numSpectra);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numHistograms; ++i) {
+    const auto &entry = table[i];
+    auto &events = workspace.getSpectrum(i);
+    events.clear(false);
+    const char *data = base + entry.offset;
+    switch (entry.eventType) {
+    case API::TOF:
+      assignEvents(events.getEvents(), data, entry.numEvents);
+      break;
+    case API::WEIGHTED:
+      events.switchTo(API::WEIGHTED);
+      assignEvents(events.getWeightedEvents(), data, entry.numEvents);
+      break;
+    case API::WEIGHTED_NOTIME:
+      events.switchTo(API::WEIGHTED_NOTIME);
+      assignEvents(events.getWeightedEventsNoTime(), data, entry.numEvents);
+      break;
+    }
+    events.setSortOrder(static_cast<EventSortType>(entry.sortOrder));
+  }
+  return true;
+}
+
+namespace bip = boost::interprocess;
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2,
+              "The reference count in shared memory must be lock free");
+
+/// The start of a shared memory segment, followed by the cache
+struct SegmentHeader {
+  /// Number of processes attached to the segment. The last one to detach
+  /// removes it.
+  std::atomic<uint32_t> references;
+  /// Set once the cache has been written
+  std::atomic<uint32_t> complete;
+};
+
+/// Offset of the cache in a segment, keeping it aligned
+const uint64_t CACHE_OFFSET =
+    (sizeof(SegmentHeader) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+/// Add a reference to a segment unless it is already being removed
+bool addReference(SegmentHeader &header) {
+  auto references = header.references.load();
+  while (references != 0)
+    if (header.references.compare_exchange_weak(references, references + 1))
+      return true;
+  return false;
+}
+
+/// Drop a reference to a segment, removing it if it was the last
+void dropReference(const std::string &name, SegmentHeader &header) {
+  if (header.references.fetch_sub(1) == 1)
+    bip::shared_memory_object::remove(name.c_str());
+}
+
+/// A segment mapped into this process, dropping its reference when destroyed
+struct Segment {
+  Segment(const std::string &name, bip::shared_memory_object &&memory,
+          bip::mapped_region &&region)
+      : name(name), memory(std::move(memory)), region(std::move(region)) {}
+  ~Segment() {
+    if (hasReference)
+      dropReference(name, header());
+  }
+  SegmentHeader &header() {
+    return *static_cast<SegmentHeader *>(region.get_address());
+  }
+  const std::string name;
+  bip::shared_memory_object memory;
+  bip::mapped_region region;
+  bool hasReference{false};
+};
+
+/// The segments published by this process, kept until released or exit
+std::map<std::string, std::unique_ptr<Segment>> &publishedSegments() {
+  static std::map<std::string, std::unique_ptr<Segment>> segments;
+  return segments;
+}
+std::mutex g_publishedMutex;
+} // namespace
+
+/** Write the events of a workspace to a cache file. The file is written under
+ * a temporary name and renamed once complete, so that a reader never sees a
+ * partially written cache.
+ * @param cacheFilename :: path of the cache file to create
+ * @param sourceFilename :: path of the file the events were loaded from
+ * @param workspace :: the workspace holding the events
+ */
+void EventCacheFile::write(const std::string &cacheFilename,
+                           const std::string &sourceFilename,
+                           const EventWorkspace &workspace) {
+  const auto numSpectra = workspace.getNumberHistograms();
+  const Header header = makeHeader(sourceFilename, numSpectra);
+  uint64_t size;
+  const auto table = makeTable(workspace, size);
+
+  const std::string partialFilename = cacheFilename + ".part";
+  {
+    std::ofstream out(partialFilename, std::ios::binary | std::ios::trunc);
+    if (!out)
+      throw std::runtime_error("Unable to open event cache file " +
+                               partialFilename + " for writing");
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(table.data()),
+              table.size() * sizeof(SpectrumEntry));
+    const char padding[ALIGNMENT] = {};
+    uint64_t position = sizeof(Header) + numSpectra * sizeof(SpectrumEntry);
+    for (size_t i = 0; i < numSpectra; ++i) {
+      out.write(padding, table[i].offset - position);
+      const auto bytes = table[i].numEvents * eventSize(table[i].eventType);
+      out.write(eventData(workspace.getSpectrum(i)), bytes);
+      position = table[i].offset + bytes;
+    }
+    if (!out)
+      throw std::runtime_error("Failed to write event cache file " +
+                               partialFilename);
+  }
+  Poco::File(partialFilename).renameTo(cacheFilename);
+}
+
+/** Fill the event lists of a workspace from a cache file.
+ * @param cacheFilename :: path of the cache file
+ * @param sourceFilename :: path of the file the events are to be loaded from.
+ * The cache is only used if it was created from this file, unchanged.
+ * @param workspace :: the workspace to fill. It must have the same number of
+ * spectra as the workspace the cache was written from.
+ * @return true if the events were read. false if the cache does not exist or
+ * does not match, in which case the workspace is left untouched.
+ */
+bool EventCacheFile::read(const std::string &cacheFilename,
+                          const std::string &sourceFilename,
+                          EventWorkspace &workspace) {
+  Poco::File cache(cacheFilename);
+  if (!cache.exists() || cache.getSize() < sizeof(Header))
+    return false;
+
+  bip::file_mapping mapping(cacheFilename.c_str(), bip::read_only);
+  bip::mapped_region region(mapping, bip::read_only);
+  return readCache(static_cast<const char *>(region.get_address()),
+                   region.get_size(), cacheFilename, sourceFilename,
+                   workspace);
+}
+
+/** Copy the events of a workspace into a new shared memory segment, which is
+ * kept until release() is called or this process exits, and removed once no
+ * other process is reading from it either.
+ * @param name :: the name of the segment
+ * @param sourceFilename :: path of the file the events were loaded from
+ * @param workspace :: the workspace holding the events
+ * @return false if a segment with this name exists already
+ */
+bool SharedEventCache::publish(const std::string &name,
+                               const std::string &sourceFilename,
+                               const EventWorkspace &workspace) {
+  const auto numSpectra = workspace.getNumberHistograms();
+  const Header header = makeHeader(sourceFilename, numSpectra);
+  uint64_t size;
+  const auto table = makeTable(workspace, size);
+
+  bip::shared_memory_object memory;
+  try {
+    bip::permissions permissions;
+    permissions.set_unrestricted();
+    memory = bip::shared_memory_object(bip::create_only, name.c_str(),
+                                       bip::read_write, permissions);
+  } catch (const bip::interprocess_exception &) {
+    g_log.information() << "Shared event cache " << name
+                        << " exists already.\n";
+    return false;
+  }
+  bip::mapped_region region;
+  try {
+    memory.truncate(static_cast<bip::offset_t>(CACHE_OFFSET + size));
+    region = bip::mapped_region(memory, bip::read_write);
+  } catch (...) {
+    bip::shared_memory_object::remove(name.c_str());
+    throw;
+  }
+  // The segment is zero filled, so readers see it as incomplete until the
+  // events have been copied
+  auto *base = static_cast<char *>(region.get_address());
+  auto *segmentHeader = new (base) SegmentHeader();
+  segmentHeader->references = 1;
+  auto segment = std::make_unique<Segment>(name, std::move(memory),
+                                           std::move(region));
+  segment->hasReference = true;
+
+  char *cache = base + CACHE_OFFSET;
+  std::memcpy(cache, &header, sizeof(header));
+  std::memcpy(cache + sizeof(header), table.data(),
+              table.size() * sizeof(SpectrumEntry));
+  const auto numHistograms = static_cast<int64_t>(numSpectra);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numHistograms; ++i) {
+    const auto &entry = table[i];
+    if (entry.numEvents > 0)
+      std::memcpy(cache + entry.offset, eventData(workspace.getSpectrum(i)),
+                  entry.numEvents * eventSize(entry.eventType));
+  }
+  segmentHeader->complete = 1;
+
+  std::lock_guard<std::mutex> lock(g_publishedMutex);
+  publishedSegments()[name] = std::move(segment);
+  return true;
+}
+
+/** Fill the event lists of a workspace from a shared memory segment created
+ * by publish(), possibly in another process. The events are copied, so the
+ * workspace can be modified freely.
+ * @param name :: the name of the segment
+ * @param sourceFilename :: path of the file the events are to be loaded from.
+ * The segment is only used if it was created from this file, unchanged.
+ * @param workspace :: the workspace to fill
+ * @return true if the events were read. false if there is no complete segment
+ * of this name or it does not match, in which case the workspace is left
+ * untouched.
+ */
+bool SharedEventCache::read(const std::string &name,
+                            const std::string &sourceFilename,
+                            EventWorkspace &workspace) {
+  bip::shared_memory_object memory;
+  bip::mapped_region region;
+  try {
+    memory = bip::shared_memory_object(bip::open_only, name.c_str(),
+                                       bip::read_write);
+    region = bip::mapped_region(memory, bip::read_write);
+  } catch (const bip::interprocess_exception &) {
+    return false;
+  }
+  if (region.get_size() < CACHE_OFFSET)
+    return false;
+  Segment segment(name, std::move(memory), std::move(region));
+  // A segment without references is being removed
+  segment.hasReference = addReference(segment.header());
+  if (!segment.hasReference || segment.header().complete == 0)
+    return false;
+  const auto *base = static_cast<const char *>(segment.region.get_address());
+  const auto size = segment.region.get_size() - CACHE_OFFSET;
+  return readCache(base + CACHE_OFFSET, size, name, sourceFilename,
+                   workspace);
+}
+
+/** Drop the reference of this process to a segment created by publish().
+ * The segment is removed once no other process is reading from it.
+ * @param name :: the name of the segment
+ */
+void SharedEventCache::release(const std::string &name) {
+  std::lock_guard<std::mutex> lock(g_publishedMutex);
+  publishedSegments().erase(name);
+}
+
+} // namespace DataHandling
+} // namespace Mantid
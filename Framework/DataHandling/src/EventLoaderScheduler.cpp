@@ -0,0 +1,124 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataHandling/EventLoaderScheduler.h"
+
+#include <algorithm>
+
+namespace Mantid {
+namespace DataHandling {
+
+using Kernel::Task;
+
+/** Constructor
+ * @param maxQueuedProcessTasks :: number of processing tasks that may be
+ * queued or running before no more reads are started
+ * @param processTasksPerRead :: number of processing tasks created by each
+ * read task
+ */
+EventLoaderScheduler::EventLoaderScheduler(const size_t maxQueuedProcessTasks,
+                                           const size_t processTasksPerRead)
+    : m_maxQueuedProcessTasks(std::max(maxQueuedProcessTasks, size_t(1))),
+      m_processTasksPerRead(std::max(processTasksPerRead, size_t(1))) {}
+
+void EventLoaderScheduler::push(std::shared_ptr<Task> newTask) {
+  std::lock_guard<std::mutex> lock(m_queueLock);
+  m_cost += newTask->cost();
+  boost::shared_ptr<std::mutex> mut = newTask->getMutex();
+  if (!mut)
+    ++m_processTasks;
+  m_supermap[mut].emplace(newTask->cost(), newTask);
+}
+
+/** @return the next task to run, or nullptr if no task can run yet: all the
+ * remaining tasks are reads and either their mutex is busy or the processing
+ * queue is full.
+ * @param threadnum :: unused argument
+ */
+std::shared_ptr<Task> EventLoaderScheduler::pop(size_t threadnum) {
+  UNUSED_ARG(threadnum);
+  std::shared_ptr<Task> task;
+  std::lock_guard<std::mutex> lock(m_queueLock);
+
+  // Processing first, to drain the queue of banks already read
+  auto processing = m_supermap.find(boost::shared_ptr<std::mutex>());
+  if (processing != m_supermap.end() && !processing->second.empty()) {
+    auto largest = std::prev(processing->second.end());
+    task = std::move(largest->second);
+    processing->second.erase(largest);
+  } else if (canStartRead()) {
+    for (auto &mutexedMap : m_supermap) {
+      const auto &mut = mutexedMap.first;
+      auto &map = mutexedMap.second;
+      if (!mut || map.empty() || m_mutexes.count(mut) > 0)
+        continue;
+      auto largest = std::prev(map.end());
+      task = std::move(largest->second);
+      map.erase(largest);
+      m_mutexes.insert(mut);
+      ++m_runningReads;
+      break;
+    }
+  }
+  if (task)
+    ++m_running;
+  return task;
+}
+
+/** Signal to the scheduler that a task is complete.
+ * @param task :: the Task that was completed.
+ * @param threadnum :: unused argument
+ */
+void EventLoaderScheduler::finished(Task *task, size_t threadnum) {
+  UNUSED_ARG(threadnum);
+  std::lock_guard<std::mutex> lock(m_queueLock);
+  boost::shared_ptr<std::mutex> mut = task->getMutex();
+  if (mut) {
+    m_mutexes.erase(mut);
+    --m_runningReads;
+  } else {
+    --m_processTasks;
+  }
+  --m_running;
+}
+
+/// @return true once no tasks are queued and none are running
+bool EventLoaderScheduler::empty() {
+  std::lock_guard<std::mutex> lock(m_queueLock);
+  if (m_running > 0)
+    return false;
+  return std::all_of(m_supermap.cbegin(), m_supermap.cend(),
+                     [](const SuperMap::value_type &mutexedMap) {
+                       return mutexedMap.second.empty();
+                     });
+}
+
+/// Remove all queued tasks. Tasks already running still report finished().
+void EventLoaderScheduler::clear() {
+  std::lock_guard<std::mutex> lock(m_queueLock);
+  auto processing = m_supermap.find(boost::shared_ptr<std::mutex>());
+  if (processing != m_supermap.end())
+    m_processTasks -= processing->second.size();
+  m_supermap.clear();
+  m_cost = 0;
+  m_costExecuted = 0;
+}
+
+/** Check whether the processing tasks of one more read fit in the queue. A
+ * read is always allowed when nothing is in flight, so that loading
+ * progresses whatever the capacity.
+ * @return true if a read task may be started. Must be called with the queue
+ * locked.
+ */
+bool EventLoaderScheduler::canStartRead() const {
+  if (m_processTasks == 0 && m_runningReads == 0)
+    return true;
+  return m_processTasks + (m_runningReads + 1) * m_processTasksPerRead <=
+         m_maxQueuedProcessTasks;
+}
+
+} // namespace DataHandling
+} // namespace Mantid
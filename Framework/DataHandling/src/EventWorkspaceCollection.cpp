@@ -12,6 +12,7 @@
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/UnitFactory.h"
 
 #include <boost/bind.hpp>
@@ -121,6 +122,20 @@ void EventWorkspaceCollection::reserveEventListAt(size_t wi, size_t size) {
   }
 }
 
+/** Release any spare capacity of the event lists in all periods, so that the
+ * events of each spectrum occupy a single block of exactly the right size.
+ * Intended to be called once, after loading is complete.
+ */
+void EventWorkspaceCollection::shrinkEventListsToFit() {
+  for (auto &ws : m_WsVec) {
+    const auto numHistograms = static_cast<int64_t>(ws->getNumberHistograms());
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < numHistograms; ++i) {
+      ws->getSpectrum(static_cast<size_t>(i)).shrinkToFit();
+    }
+  }
+}
+
 size_t EventWorkspaceCollection::nPeriods() const { return m_WsVec.size(); }
 
 DataObjects::EventWorkspace_sptr
@@ -288,7 +288,9 @@ void GroupDetectors2::execEvent() {
                : 1.);
 
   // Build a new map
-  const size_t outIndex = formGroupsEvent(inputWS, outputWS, prog4Copy);
+  auto indexInfo = Indexing::IndexInfo(0);
+  const size_t outIndex = formGroupsEvent(inputWS, outputWS, prog4Copy,
+                                          keepAll, unGroupedSet, indexInfo);
 
   // If we're keeping ungrouped spectra
   if (keepAll) {
@@ -296,6 +298,8 @@ void GroupDetectors2::execEvent() {
     moveOthers(unGroupedSet, *inputWS, *outputWS, outIndex);
   }
 
+  outputWS->setIndexInfo(indexInfo);
+
   // Set all X bins on the output
   outputWS->setAllX(inputWS->binEdges(0));
 
@@ -1055,17 +1059,24 @@ size_t GroupDetectors2::formGroups(API::MatrixWorkspace_const_sptr inputWS,
 
 /**
  *  Move the user selected spectra in the input workspace into groups in the
- * output workspace
+ * output workspace. The groups are formed in parallel, the events of each
+ * group being gathered in one buffer. If the input event lists are sorted by
+ * TOF they are merged, so that the grouped lists are sorted too.
  *  @param inputWS :: user selected input workspace for the algorithm
  *  @param outputWS :: user selected output workspace for the algorithm
  *  @param prog4Copy :: the amount of algorithm progress to attribute to moving
  * a single spectra
+ *  @param keepAll :: whether or not to keep ungrouped spectra
+ *  @param unGroupedSet :: the set of workspace indexes that are left ungrouped
+ *  @param indexInfo :: an IndexInfo object that will contain the desired
+ * indexing after grouping
  *  @return number of new grouped spectra
  */
-size_t
-GroupDetectors2::formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
-                                 DataObjects::EventWorkspace_sptr outputWS,
-                                 const double prog4Copy) {
+size_t GroupDetectors2::formGroupsEvent(
+    DataObjects::EventWorkspace_const_sptr inputWS,
+    DataObjects::EventWorkspace_sptr outputWS, const double prog4Copy,
+    const bool keepAll, const std::set<int64_t> &unGroupedSet,
+    Indexing::IndexInfo &indexInfo) {
   if (inputWS->detectorInfo().isScanning())
     throw std::runtime_error("GroupDetectors does not currently support "
                              "EventWorkspaces with detector scans.");
@@ -1082,36 +1093,25 @@ GroupDetectors2::formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
   g_log.debug() << name() << ": Preparing to group spectra into "
                 << m_GroupWsInds.size() << " groups\n";
 
-  // where we are copying spectra to, we start copying to the start of the
-  // output workspace
-  size_t outIndex = 0;
+  const auto nFinalHistograms =
+      m_GroupWsInds.size() + (keepAll ? unGroupedSet.size() : 0);
+  auto spectrumGroups = std::vector<std::vector<size_t>>();
+  spectrumGroups.reserve(nFinalHistograms);
+  auto spectrumNumbers = std::vector<Indexing::SpectrumNumber>();
+  spectrumNumbers.reserve(nFinalHistograms);
+
   // Only used for averaging behaviour. We may have a 1:1 map where a Divide
   // would be waste as it would be just dividing by 1
   bool requireDivide(false);
   const auto &spectrumInfo = inputWS->spectrumInfo();
-  for (storage_map::const_iterator it = m_GroupWsInds.begin();
-       it != m_GroupWsInds.end(); ++it) {
-    // This is the grouped spectrum
-    EventList &outEL = outputWS->getSpectrum(outIndex);
-
+  for (const auto &group : m_GroupWsInds) {
     // The spectrum number of the group is the key
-    outEL.setSpectrumNo(it->first);
-    // Start fresh with no detector IDs
-    outEL.clearDetectorIDs();
+    spectrumNumbers.emplace_back(group.first);
+    spectrumGroups.emplace_back(group.second.begin(), group.second.end());
 
-    // the Y values and errors from spectra being grouped are combined in the
-    // output spectrum
     // Keep track of number of detectors required for masking
     size_t nonMaskedSpectra(0);
-    beh->mutableX(outIndex)[0] = 0.0;
-    beh->mutableE(outIndex)[0] = 0.0;
-    for (auto originalWI : it->second) {
-      const EventList &fromEL = inputWS->getSpectrum(originalWI);
-      // Add the event lists with the operator
-      outEL += fromEL;
-
-      // detectors to add to the output spectrum
-      outEL.addDetectorIDs(fromEL.getDetectorIDs());
+    for (auto originalWI : group.second) {
       if (!spectrumInfo.hasDetectors(originalWI) ||
           !spectrumInfo.isMasked(originalWI)) {
         ++nonMaskedSpectra;
@@ -1121,19 +1121,57 @@ GroupDetectors2::formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
       ++nonMaskedSpectra; // Avoid possible divide by zero
     if (!requireDivide)
       requireDivide = (nonMaskedSpectra > 1);
+    const size_t outIndex = spectrumGroups.size() - 1;
+    beh->mutableX(outIndex)[0] = 0.0;
+    beh->mutableE(outIndex)[0] = 0.0;
     beh->mutableY(outIndex)[0] = static_cast<double>(nonMaskedSpectra);
+  }
+
+  // Gather the events of each group, in parallel over the groups
+  const auto numGroups = static_cast<int64_t>(spectrumGroups.size());
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
+  for (int64_t outIndex = 0; outIndex < numGroups; ++outIndex) {
+    PARALLEL_START_INTERUPT_REGION
+    std::vector<const EventList *> groupLists;
+    groupLists.reserve(spectrumGroups[outIndex].size());
+    for (const auto originalWI : spectrumGroups[outIndex])
+      groupLists.push_back(&inputWS->getSpectrum(originalWI));
+    // Add the event lists, merging them if they are sorted
+    outputWS->getSpectrum(outIndex).mergeSorted(groupLists);
 
     // make regular progress reports and check for cancelling the algorithm
     if (outIndex % INTERVAL == 0) {
-      m_FracCompl += INTERVAL * prog4Copy;
-      if (m_FracCompl > 1.0)
-        m_FracCompl = 1.0;
-      progress(m_FracCompl);
+      PARALLEL_CRITICAL(GroupDetectors2_progress) {
+        m_FracCompl += INTERVAL * prog4Copy;
+        if (m_FracCompl > 1.0)
+          m_FracCompl = 1.0;
+        progress(m_FracCompl);
+      }
       interruption_point();
     }
-    outIndex++;
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+  const auto outIndex = static_cast<size_t>(numGroups);
+
+  // Add the ungrouped spectra to IndexInfo, if they are being kept
+  if (keepAll) {
+    for (const auto originalWI : unGroupedSet) {
+      // Negative WIs are intended to be invalid
+      if (originalWI < 0)
+        continue;
+
+      spectrumGroups.emplace_back(std::vector<size_t>(1, originalWI));
+
+      auto spectrumNumber = inputWS->getSpectrum(originalWI).getSpectrumNo();
+      spectrumNumbers.emplace_back(spectrumNumber);
+    }
   }
 
+  // The detector IDs of all the output spectra are set at once from this
+  indexInfo = Indexing::group(inputWS->indexInfo(), std::move(spectrumNumbers),
+                              spectrumGroups);
+
   if (bhv == 1 && requireDivide) {
     g_log.debug() << "Running Divide algorithm to perform averaging.\n";
     Mantid::API::IAlgorithm_sptr divide = createChildAlgorithm("Divide");
@@ -15,7 +15,9 @@
 #include "MantidAPI/MultipleFileProperty.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/FacilityInfo.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <Poco/Path.h>
 
@@ -23,6 +25,7 @@
 #include <cctype>
 #include <cstdio>
 #include <functional>
+#include <iterator>
 #include <numeric>
 #include <set>
 
@@ -84,6 +87,29 @@ flattenVecOfVec(std::vector<std::vector<std::string>> vecOfVec) {
 
   return flattenedVec;
 }
+
+/**
+ * The number of files to load at once when summing files. Each load holds a
+ * running sum as well as the file being loaded, so it is limited by the
+ * memory the first file took.
+ *
+ * @param firstWs :: The workspace loaded from the first file.
+ * @returns the number of concurrent loads, at least 1.
+ */
+size_t concurrentLoads(const Mantid::API::Workspace &firstWs) {
+  auto &config = Mantid::Kernel::ConfigService::Instance();
+  const auto concurrency =
+      config.getValue<int>("loading.multifile.concurrency");
+  size_t loads =
+      concurrency && *concurrency > 1 ? static_cast<size_t>(*concurrency) : 1;
+  const auto limit = config.getValue<double>("loading.multifile.memorylimit");
+  const auto perLoad = 2.0 * static_cast<double>(firstWs.getMemorySize());
+  if (limit && *limit > 0.0 && perLoad > 0.0) {
+    const auto fits = static_cast<size_t>(*limit * 1024.0 * 1024.0 / perLoad);
+    loads = std::min(loads, std::max<size_t>(fits, 1));
+  }
+  return loads;
+}
 } // namespace
 
 namespace Mantid {
@@ -396,18 +422,16 @@ void Load::loadMultipleFiles() {
   std::vector<API::Workspace_sptr> loadedWsList;
   loadedWsList.reserve(allFilenames.size());
 
-  Workspace_sptr tempWs;
+  std::vector<Workspace_sptr> tempWsList;
 
   // Cycle through the filenames and wsNames.
   for (auto filenames = allFilenames.cbegin(); filenames != allFilenames.cend();
        ++filenames, ++wsName) {
-    auto filename = filenames->cbegin();
-    Workspace_sptr sumWS = loadFileToWs(*filename, *wsName);
-
-    ++filename;
-    for (; filename != filenames->cend(); ++filename) {
-      tempWs = loadFileToWs(*filename, "__@loadsum_temp@");
-      sumWS = plusWs(sumWS, tempWs);
+    Workspace_sptr sumWS = loadFileToWs(filenames->front(), *wsName);
+    if (filenames->size() > 1) {
+      const std::vector<std::string> otherFilenames(filenames->cbegin() + 1,
+                                                    filenames->cend());
+      sumWS = loadAndPlusWs(sumWS, otherFilenames, tempWsList);
     }
 
     API::WorkspaceGroup_sptr group =
@@ -468,7 +492,9 @@ void Load::loadMultipleFiles() {
   }
 
   // Clean up.
-  if (tempWs) {
+  for (const auto &tempWs : tempWsList) {
+    if (!AnalysisDataService::Instance().doesExist(tempWs->getName()))
+      continue;
     Algorithm_sptr alg =
         AlgorithmManager::Instance().createUnmanaged("DeleteWorkspace");
     alg->initialize();
@@ -721,6 +747,71 @@ API::Workspace_sptr Load::plusWs(Workspace_sptr ws1, Workspace_sptr ws2) {
   return ws1;
 }
 
+/**
+ * Load files and add them to a workspace, "in place".
+ *
+ * The files are split into contiguous runs, one per concurrent load, each
+ * loaded and summed by its own thread. The first is added straight to sumWs
+ * and the others to the first file of their run. The sums are then added
+ * pairwise in a tree, always keeping the earlier files on the left so that
+ * the result matches adding the files one by one.
+ *
+ * @param sumWs :: The workspace to add the files to.
+ * @param fileNames :: The files to load.
+ * @param tempWsList :: The temporary workspaces are appended to this, to be
+ * deleted once everything is loaded.
+ *
+ * @returns a pointer to the result (sumWs).
+ */
+API::Workspace_sptr
+Load::loadAndPlusWs(Workspace_sptr sumWs,
+                    const std::vector<std::string> &fileNames,
+                    std::vector<API::Workspace_sptr> &tempWsList) {
+  const auto nRuns = static_cast<int>(
+      std::min(fileNames.size(), concurrentLoads(*sumWs)));
+  if (nRuns > 1)
+    g_log.information() << "Loading " << fileNames.size() << " files with "
+                        << nRuns << " concurrent loads\n";
+
+  std::vector<Workspace_sptr> sums(nRuns);
+  std::vector<Workspace_sptr> lastTempWs(nRuns);
+  sums[0] = sumWs;
+  PARALLEL_FOR_IF(nRuns > 1)
+  for (int run = 0; run < nRuns; ++run) {
+    PARALLEL_START_INTERUPT_REGION
+    const std::string tempName = "__@loadsum_temp@_" + std::to_string(run);
+    const size_t begin = run * fileNames.size() / nRuns;
+    const size_t end = (run + 1) * fileNames.size() / nRuns;
+    for (size_t i = begin; i < end; ++i) {
+      if (!sums[run]) {
+        sums[run] = loadFileToWs(fileNames[i], tempName + "_sum");
+        continue;
+      }
+      lastTempWs[run] = loadFileToWs(fileNames[i], tempName);
+      plusWs(sums[run], lastTempWs[run]);
+    }
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  for (int stride = 1; stride < nRuns; stride *= 2) {
+    PARALLEL_FOR_IF(nRuns > 2 * stride)
+    for (int left = 0; left < nRuns - stride; left += 2 * stride) {
+      PARALLEL_START_INTERUPT_REGION
+      plusWs(sums[left], sums[left + stride]);
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+  }
+
+  std::copy_if(sums.cbegin() + 1, sums.cend(), std::back_inserter(tempWsList),
+               [](const Workspace_sptr &ws) { return ws != nullptr; });
+  std::copy_if(lastTempWs.cbegin(), lastTempWs.cend(),
+               std::back_inserter(tempWsList),
+               [](const Workspace_sptr &ws) { return ws != nullptr; });
+  return sumWs;
+}
+
 /**
  * Groups together a vector of workspaces.  This is done "manually", since the
  * workspaces being passed will be outside of the ADS and so the GroupWorkspaces
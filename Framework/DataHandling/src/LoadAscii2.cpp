@@ -15,6 +15,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/StringTokenizer.h"
+#include "MantidKernel/TextFormat.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
@@ -271,7 +272,7 @@ void LoadAscii2::setcolumns(std::ifstream &file, std::string &line,
           } else if (cols != 1) {
             try {
               fillInputValues(values, columns);
-            } catch (boost::bad_lexical_cast &) {
+            } catch (std::invalid_argument &) {
               continue;
             }
             // a size of 1 is most likely a spectra ID so ignore it, a value of
@@ -352,7 +353,7 @@ void LoadAscii2::processHeader(std::ifstream &file) {
           } else if (lineCols != 1) {
             try {
               fillInputValues(values, columns);
-            } catch (boost::bad_lexical_cast &) {
+            } catch (std::invalid_argument &) {
               matchingRows = 0;
               validRows = 0;
               continue;
@@ -581,14 +582,18 @@ void LoadAscii2::fillInputValues(std::vector<double> &values,
   int i = 0;
   for (auto value : columns) {
     boost::trim(value);
-    boost::to_lower(value);
-    if (value == "nan" || value == "1.#qnan") // ignores nans (not a number) and
-                                              // replaces them with a nan
-    {
-      double nan = std::numeric_limits<double>::quiet_NaN(); //(0.0/0.0);
-      values[i] = nan;
-    } else {
-      values[i] = boost::lexical_cast<double>(value);
+    if (!parseNumber(value, values[i])) {
+      boost::to_lower(value);
+      if (value == "1.#qnan") // ignores nans (not a number) and
+                              // replaces them with a nan
+      {
+        double nan = std::numeric_limits<double>::quiet_NaN(); //(0.0/0.0);
+        values[i] = nan;
+      } else {
+        throw std::invalid_argument("Line " + std::to_string(m_lineNo) +
+                                    ": Could not interpret \"" + value +
+                                    "\" as a number.");
+      }
     }
     ++i;
   }
@@ -9,6 +9,7 @@
 #include "MantidDataHandling/DefaultEventLoader.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidDataHandling/ProcessBankData.h"
+#include "MantidKernel/RuntimeCounters.h"
 #include "MantidKernel/Unit.h"
 #include <algorithm>
 
@@ -17,6 +18,25 @@
 namespace Mantid {
 namespace DataHandling {
 
+namespace {
+/** Count the events read from a bank, and the bytes of their ids, times of
+ * flight and weights, in the runtime counters
+ * @param numberOfEvents :: the number of events read
+ * @param haveWeights :: true if the events have weights
+ */
+void countLoadedEvents(const int64_t numberOfEvents, const bool haveWeights) {
+  static auto &events =
+      Kernel::RuntimeCounters::Instance().counter("nexus_events_read");
+  static auto &bytes =
+      Kernel::RuntimeCounters::Instance().counter("nexus_event_bytes_read");
+  const auto count = static_cast<uint64_t>(numberOfEvents);
+  const size_t eventSize =
+      sizeof(uint32_t) + sizeof(float) + (haveWeights ? sizeof(float) : 0);
+  events.fetch_add(count, std::memory_order_relaxed);
+  bytes.fetch_add(count * eventSize, std::memory_order_relaxed);
+}
+} // namespace
+
 /** Constructor
  *
  * @param loader :: Handle to the main loader
@@ -131,13 +151,27 @@ void LoadBankFromDiskTask::prepareEventId(
   int64_t dim0 = recalculateDataSize(id_info.dims[0]);
   stop_event = dim0;
 
-  // Handle the time filtering by changing the start/end offsets.
-  for (size_t i = 0; i < thisBankPulseTimes->numPulses; i++) {
-    if (thisBankPulseTimes->pulseTimes[i] >= m_loader.alg->filter_time_start) {
-      start_event = static_cast<int64_t>(event_index[i]);
-      break; // stop looking
-    }
-  }
+  // Handle the time filtering by changing the start/end offsets, so that only
+  // the events of the pulses inside the time window are read from the file.
+  // Normally the pulse times are in order and the window can be found by
+  // bisection; otherwise use the first pulse in and the first pulse after it.
+  const auto numPulses =
+      std::min(thisBankPulseTimes->numPulses, event_index.size());
+  const auto *pulseTimesBegin = thisBankPulseTimes->pulseTimes;
+  const auto *pulseTimesEnd = pulseTimesBegin + numPulses;
+  const auto &filterStart = m_loader.alg->filter_time_start;
+  const auto &filterStop = m_loader.alg->filter_time_stop;
+  const bool pulseTimesSorted = std::is_sorted(pulseTimesBegin, pulseTimesEnd);
+  const auto *firstPulse =
+      pulseTimesSorted
+          ? std::lower_bound(pulseTimesBegin, pulseTimesEnd, filterStart)
+          : std::find_if(pulseTimesBegin, pulseTimesEnd,
+                         [&filterStart](const auto &pulse) {
+                           return pulse >= filterStart;
+                         });
+  if (firstPulse != pulseTimesEnd)
+    start_event =
+        static_cast<int64_t>(event_index[firstPulse - pulseTimesBegin]);
 
   if (start_event > dim0) {
     // If the frame indexes are bad then we can't construct the times of the
@@ -152,12 +186,16 @@ void LoadBankFromDiskTask::prepareEventId(
     start_event = 0;
     stop_event = dim0;
   } else {
-    for (size_t i = 0; i < thisBankPulseTimes->numPulses; i++) {
-      if (thisBankPulseTimes->pulseTimes[i] > m_loader.alg->filter_time_stop) {
-        stop_event = event_index[i];
-        break;
-      }
-    }
+    const auto *stopPulse =
+        pulseTimesSorted
+            ? std::upper_bound(pulseTimesBegin, pulseTimesEnd, filterStop)
+            : std::find_if(pulseTimesBegin, pulseTimesEnd,
+                           [&filterStop](const auto &pulse) {
+                             return pulse > filterStop;
+                           });
+    if (stopPulse != pulseTimesEnd)
+      stop_event =
+          static_cast<int64_t>(event_index[stopPulse - pulseTimesBegin]);
   }
   // We are loading part - work out the event number range
   if (m_loader.chunk != EMPTY_INT()) {
@@ -332,6 +370,37 @@ LoadBankFromDiskTask::loadEventWeights(::NeXus::File &file) {
   return event_weight;
 }
 
+/** Restrict the range of pixel IDs to process to the spectra that were
+ * requested, if any.
+ * @returns false if none of the pixel IDs loaded are to be processed
+ */
+bool LoadBankFromDiskTask::restrictToSpectraRange() {
+  const auto minSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMin);
+  const auto maxSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMax);
+  const auto emptyInt = static_cast<uint32_t>(EMPTY_INT());
+  // check that if a range of spectra were requested that these fit within
+  // this bank
+  if (minSpectraToLoad != emptyInt && m_min_id < minSpectraToLoad) {
+    if (minSpectraToLoad > m_max_id) { // the minimum spectra to load is more
+                                       // than the max of this bank
+      return false;
+    }
+    // the min spectra to load is higher than the min for this bank
+    m_min_id = minSpectraToLoad;
+  }
+  if (maxSpectraToLoad != emptyInt && m_max_id > maxSpectraToLoad) {
+    if (maxSpectraToLoad < m_min_id) {
+      // the maximum spectra to load is less than the minimum of this bank
+      return false;
+    }
+    // the max spectra to load is lower than the max for this bank
+    m_max_id = maxSpectraToLoad;
+  }
+  // if the min is now larger than the max the entire block of spectra to
+  // load is outside this bank
+  return m_min_id <= m_max_id;
+}
+
 void LoadBankFromDiskTask::run() {
   // These give the limits in each file as to which events we actually load
   // (when filtering by time).
@@ -348,6 +417,9 @@ void LoadBankFromDiskTask::run() {
   std::unique_ptr<float[]> event_time_of_flight;
   std::unique_ptr<float[]> event_weight;
   std::vector<uint64_t> event_index;
+  // Range of pixel IDs in the loaded events, before restricting to spectra
+  uint32_t bank_size = 0;
+  bool inSpectraRange = true;
 
   // Open the file
   ::NeXus::File file(m_loader.alg->m_filename);
@@ -390,12 +462,19 @@ void LoadBankFromDiskTask::run() {
           m_loadError = true; // To allow cancelling the algorithm
         }
 
-        // And TOF.
+        // Only read the TOF of banks with pixels in the requested spectra
         if (!m_loadError) {
+          bank_size = m_max_id - m_min_id;
+          inSpectraRange = this->restrictToSpectraRange();
+        }
+
+        // And TOF.
+        if (!m_loadError && inSpectraRange) {
           event_time_of_flight = this->loadTof(file);
           if (m_have_weight) {
             event_weight = this->loadEventWeights(file);
           }
+          countLoadedEvents(m_loadSize[0], m_have_weight);
         }
       } // Size is at least 1
       else {
@@ -431,42 +510,18 @@ void LoadBankFromDiskTask::run() {
     return;
   }
 
-  const auto bank_size = m_max_id - m_min_id;
-  const auto minSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMin);
-  const auto maxSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMax);
-  const auto emptyInt = static_cast<uint32_t>(EMPTY_INT());
-  // check that if a range of spectra were requested that these fit within
-  // this bank
-  if (minSpectraToLoad != emptyInt && m_min_id < minSpectraToLoad) {
-    if (minSpectraToLoad > m_max_id) { // the minimum spectra to load is more
-                                       // than the max of this bank
-      return;
-    }
-    // the min spectra to load is higher than the min for this bank
-    m_min_id = minSpectraToLoad;
-  }
-  if (maxSpectraToLoad != emptyInt && m_max_id > maxSpectraToLoad) {
-    if (maxSpectraToLoad < m_min_id) {
-      // the maximum spectra to load is less than the minimum of this bank
-      return;
-    }
-    // the max spectra to load is lower than the max for this bank
-    m_max_id = maxSpectraToLoad;
-  }
-  if (m_min_id > m_max_id) {
-    // the min is now larger than the max, this means the entire block of
-    // spectra to load is outside this bank
+  // Nothing more to do if none of the requested spectra are in this bank
+  if (!inSpectraRange)
     return;
-  }
 
-  // schedule the job to generate the event lists
-  auto mid_id = m_max_id;
-  if (m_loader.splitProcessing && m_max_id > (m_min_id + (bank_size / 4)))
-    // only split if told to and the section to load is at least 1/4 the size
-    // of the whole bank
-    mid_id = (m_max_id + m_min_id) / 2;
+  // schedule the jobs to generate the event lists. Only split if told to and
+  // the section to load is at least 1/4 the size of the whole bank.
+  size_t numTasks = m_loader.processTasksPerBank;
+  if (m_max_id <= (m_min_id + (bank_size / 4)))
+    numTasks = 1;
+  numTasks = std::min(numTasks, static_cast<size_t>(m_max_id - m_min_id) + 1);
 
-  // No error? Launch a new task to process that data.
+  // No error? Launch new tasks to process that data.
   auto numEvents = static_cast<size_t>(m_loadSize[0]);
   auto startAt = static_cast<size_t>(m_loadStart[0]);
 
@@ -478,17 +533,18 @@ void LoadBankFromDiskTask::run() {
   auto event_index_shrd =
       boost::make_shared<std::vector<uint64_t>>(std::move(event_index));
 
-  std::shared_ptr<Task> newTask1 = std::make_shared<ProcessBankData>(
-      m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
-      numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
-      event_weight_shrd, m_min_id, mid_id);
-  scheduler.push(newTask1);
-  if (m_loader.splitProcessing && (mid_id < m_max_id)) {
-    std::shared_ptr<Task> newTask2 = std::make_shared<ProcessBankData>(
+  // Each task handles a contiguous, disjoint range of detector IDs
+  const size_t numIds = static_cast<size_t>(m_max_id - m_min_id) + 1;
+  for (size_t task = 0; task < numTasks; ++task) {
+    const auto first =
+        static_cast<detid_t>(m_min_id + task * numIds / numTasks);
+    const auto last =
+        static_cast<detid_t>(m_min_id + (task + 1) * numIds / numTasks - 1);
+    std::shared_ptr<Task> newTask = std::make_shared<ProcessBankData>(
         m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
-        numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
-        event_weight_shrd, (mid_id + 1), m_max_id);
-    scheduler.push(newTask2);
+        numEvents, startAt, event_index_shrd, thisBankPulseTimes,
+        m_have_weight, event_weight_shrd, first, last);
+    scheduler.push(newTask);
   }
 }
 
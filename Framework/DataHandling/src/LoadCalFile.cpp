@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataHandling/LoadCalFile.h"
 #include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmResultCache.h"
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/ITableWorkspace.h"
 #include "MantidAPI/MatrixWorkspace.h"
@@ -19,6 +20,7 @@
 #include "MantidKernel/System.h"
 #include <Poco/Path.h>
 #include <fstream>
+#include <typeinfo>
 
 using Mantid::Geometry::Instrument_const_sptr;
 using namespace Mantid::Kernel;
@@ -56,6 +58,11 @@ void LoadCalFile::getInstrument3WaysInit(Algorithm *alg) {
   alg->setPropertyGroup("InputWorkspace", grpName);
   alg->setPropertyGroup("InstrumentName", grpName);
   alg->setPropertyGroup("InstrumentFilename", grpName);
+
+  // Only the instrument of the input workspace is used, so a cached result
+  // does not depend on the rest of its content
+  AlgorithmResultCache::Instance().setUsesOnlyInstrument(alg->name(),
+                                                         "InputWorkspace");
 }
 
 bool LoadCalFile::instrumentIsSpecified(API::Algorithm *alg) {
@@ -153,6 +160,76 @@ void LoadCalFile::init() {
       "'_cal', '_offsets', '_mask' appended to them.");
 }
 
+/** Declare the output workspace properties as soon as their names and the
+ * workspaces to make are known, so that the AlgorithmResultCache can restore
+ * them when the same file is loaded again.
+ * @param name :: the name of the property that was set
+ */
+void LoadCalFile::afterPropertySet(const std::string &name) {
+  if (name == "WorkspaceName" || name == "MakeGroupingWorkspace" ||
+      name == "MakeOffsetsWorkspace" || name == "MakeMaskWorkspace")
+    declareOutputProperties();
+}
+
+/// Declare the output workspace properties that were asked for
+void LoadCalFile::declareOutputProperties() {
+  const std::string WorkspaceName = getPropertyValue("WorkspaceName");
+  const bool MakeGroupingWorkspace = getProperty("MakeGroupingWorkspace");
+  const bool MakeOffsetsWorkspace = getProperty("MakeOffsetsWorkspace");
+  const bool MakeMaskWorkspace = getProperty("MakeMaskWorkspace");
+
+  const bool named = !WorkspaceName.empty();
+  declareOutputProperty(
+      this,
+      std::make_unique<WorkspaceProperty<GroupingWorkspace>>(
+          "OutputGroupingWorkspace", WorkspaceName + "_group",
+          Direction::Output),
+      named && MakeGroupingWorkspace,
+      "Set the the output GroupingWorkspace, if any.");
+  declareOutputProperty(
+      this,
+      std::make_unique<WorkspaceProperty<OffsetsWorkspace>>(
+          "OutputOffsetsWorkspace", WorkspaceName + "_offsets",
+          Direction::Output),
+      named && MakeOffsetsWorkspace,
+      "Set the the output OffsetsWorkspace, if any.");
+  declareOutputProperty(
+      this,
+      std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+          "OutputMaskWorkspace", WorkspaceName + "_mask", Direction::Output),
+      named && MakeMaskWorkspace, "Set the the output MaskWorkspace, if any.");
+  declareOutputProperty(
+      this,
+      std::make_unique<WorkspaceProperty<ITableWorkspace>>(
+          "OutputCalWorkspace", WorkspaceName + "_cal", Direction::Output),
+      named && MakeOffsetsWorkspace,
+      "Set the output Diffraction Calibration workspace, if any.");
+}
+
+/** Declare or remove an optional output property of an algorithm. A
+ * property of the same name and type is kept if its value was set by the
+ * caller or already is the default, so that declaring the outputs again
+ * does not lose the names given to them.
+ * @param alg :: the algorithm
+ * @param property :: the property, with its default value
+ * @param wanted :: whether the output is made, otherwise it is removed
+ * @param doc :: the documentation of the property
+ */
+void LoadCalFile::declareOutputProperty(API::Algorithm *alg,
+                                        std::unique_ptr<Property> property,
+                                        bool wanted, const std::string &doc) {
+  const std::string name = property->name();
+  if (alg->existsProperty(name)) {
+    const auto *existing = alg->getPointerToProperty(name);
+    if (wanted && typeid(*existing) == typeid(*property) &&
+        (!existing->isDefault() || existing->value() == property->value()))
+      return;
+    alg->removeProperty(name);
+  }
+  if (wanted)
+    alg->declareProperty(std::move(property), doc);
+}
+
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
@@ -165,6 +242,7 @@ void LoadCalFile::exec() {
 
   if (WorkspaceName.empty())
     throw std::invalid_argument("Must specify WorkspaceName.");
+  declareOutputProperties();
 
   Instrument_const_sptr inst = LoadCalFile::getInstrument3Ways(this);
 
@@ -179,10 +257,6 @@ void LoadCalFile::exec() {
   if (MakeGroupingWorkspace) {
     groupWS = GroupingWorkspace_sptr(new GroupingWorkspace(inst));
     groupWS->setTitle(title);
-    declareProperty(std::make_unique<WorkspaceProperty<GroupingWorkspace>>(
-                        "OutputGroupingWorkspace", WorkspaceName + "_group",
-                        Direction::Output),
-                    "Set the the output GroupingWorkspace, if any.");
     groupWS->mutableRun().addProperty("Filename", CalFilename);
     setProperty("OutputGroupingWorkspace", groupWS);
   }
@@ -190,10 +264,6 @@ void LoadCalFile::exec() {
   if (MakeOffsetsWorkspace) {
     offsetsWS = OffsetsWorkspace_sptr(new OffsetsWorkspace(inst));
     offsetsWS->setTitle(title);
-    declareProperty(std::make_unique<WorkspaceProperty<OffsetsWorkspace>>(
-                        "OutputOffsetsWorkspace", WorkspaceName + "_offsets",
-                        Direction::Output),
-                    "Set the the output OffsetsWorkspace, if any.");
     offsetsWS->mutableRun().addProperty("Filename", CalFilename);
     setProperty("OutputOffsetsWorkspace", offsetsWS);
   }
@@ -201,10 +271,6 @@ void LoadCalFile::exec() {
   if (MakeMaskWorkspace) {
     maskWS = MaskWorkspace_sptr(new MaskWorkspace(inst));
     maskWS->setTitle(title);
-    declareProperty(
-        std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
-            "OutputMaskWorkspace", WorkspaceName + "_mask", Direction::Output),
-        "Set the the output MaskWorkspace, if any.");
     maskWS->mutableRun().addProperty("Filename", CalFilename);
     setProperty("OutputMaskWorkspace", maskWS);
   }
@@ -217,10 +283,6 @@ void LoadCalFile::exec() {
     alg->executeAsChildAlg();
     ITableWorkspace_sptr calWS = alg->getProperty("OutputWorkspace");
     calWS->setTitle(title);
-    declareProperty(
-        std::make_unique<WorkspaceProperty<ITableWorkspace>>(
-            "OutputCalWorkspace", WorkspaceName + "_cal", Direction::Output),
-        "Set the output Diffraction Calibration workspace, if any.");
     setProperty("OutputCalWorkspace", calWS);
   }
 }
@@ -120,42 +120,53 @@ void LoadDiffCal::init() {
   setPropertyGroup("FixConversionIssues", grpName);
 }
 
-namespace { // anonymous
-
-bool endswith(const std::string &str, const std::string &ending) {
-  if (ending.size() > str.size()) {
-    return false;
-  }
-
-  return std::equal(str.begin() + str.size() - ending.size(), str.end(),
-                    ending.begin());
+/** Declare the output workspace properties as soon as their names and the
+ * workspaces to make are known. Declaring them before exec() lets the
+ * AlgorithmResultCache restore them when the same calibration is loaded
+ * again.
+ * @param name :: the name of the property that was set
+ */
+void LoadDiffCal::afterPropertySet(const std::string &name) {
+  if (name == "WorkspaceName" || name == PropertyNames::MAKE_GRP ||
+      name == PropertyNames::MAKE_MSK || name == PropertyNames::MAKE_CAL)
+    declareOutputProperties();
 }
 
-void setGroupWSProperty(API::Algorithm *alg, const std::string &prefix,
-                        GroupingWorkspace_sptr wksp) {
-  alg->declareProperty(
+/// Declare the output workspace properties that were asked for
+void LoadDiffCal::declareOutputProperties() {
+  const std::string prefix = getPropertyValue("WorkspaceName");
+  const bool makeGrouping = getProperty(PropertyNames::MAKE_GRP);
+  const bool makeMask = getProperty(PropertyNames::MAKE_MSK);
+  const bool makeCal = getProperty(PropertyNames::MAKE_CAL);
+
+  const bool named = !prefix.empty();
+  LoadCalFile::declareOutputProperty(
+      this,
       std::make_unique<WorkspaceProperty<DataObjects::GroupingWorkspace>>(
           "OutputGroupingWorkspace", prefix + "_group", Direction::Output),
-      "Set the the output GroupingWorkspace, if any.");
-  alg->setProperty("OutputGroupingWorkspace", wksp);
-}
-
-void setMaskWSProperty(API::Algorithm *alg, const std::string &prefix,
-                       MaskWorkspace_sptr wksp) {
-  alg->declareProperty(
+      named && makeGrouping, "Set the the output GroupingWorkspace, if any.");
+  LoadCalFile::declareOutputProperty(
+      this,
       std::make_unique<WorkspaceProperty<DataObjects::MaskWorkspace>>(
           "OutputMaskWorkspace", prefix + "_mask", Direction::Output),
-      "Set the the output MaskWorkspace, if any.");
-  alg->setProperty("OutputMaskWorkspace", wksp);
-}
-
-void setCalWSProperty(API::Algorithm *alg, const std::string &prefix,
-                      ITableWorkspace_sptr wksp) {
-  alg->declareProperty(
+      named && makeMask, "Set the the output MaskWorkspace, if any.");
+  LoadCalFile::declareOutputProperty(
+      this,
       std::make_unique<WorkspaceProperty<ITableWorkspace>>(
           "OutputCalWorkspace", prefix + "_cal", Direction::Output),
+      named && makeCal,
       "Set the output Diffraction Calibration workspace, if any.");
-  alg->setProperty("OutputCalWorkspace", wksp);
+}
+
+namespace { // anonymous
+
+bool endswith(const std::string &str, const std::string &ending) {
+  if (ending.size() > str.size()) {
+    return false;
+  }
+
+  return std::equal(str.begin() + str.size() - ending.size(), str.end(),
+                    ending.begin());
 }
 
 } // anonymous namespace
@@ -229,7 +240,7 @@ void LoadDiffCal::makeGroupingWorkspace(const std::vector<int32_t> &detids,
     progress.report();
   }
 
-  setGroupWSProperty(this, m_workspaceName, wksp);
+  setProperty("OutputGroupingWorkspace", wksp);
 }
 
 void LoadDiffCal::makeMaskWorkspace(const std::vector<int32_t> &detids,
@@ -257,7 +268,7 @@ void LoadDiffCal::makeMaskWorkspace(const std::vector<int32_t> &detids,
     progress.report();
   }
 
-  setMaskWSProperty(this, m_workspaceName, wksp);
+  setProperty("OutputMaskWorkspace", wksp);
 }
 
 void LoadDiffCal::makeCalWorkspace(const std::vector<int32_t> &detids,
@@ -368,7 +379,7 @@ void LoadDiffCal::makeCalWorkspace(const std::vector<int32_t> &detids,
                           << " rows have reduced time-of-flight range\n";
   }
 
-  setCalWSProperty(this, m_workspaceName, wksp);
+  setProperty("OutputCalWorkspace", wksp);
 }
 
 /// @return true if the grouping information should be taken from the
@@ -412,7 +423,7 @@ void LoadDiffCal::loadGroupingFromAlternateFile() {
     // get the workspace
     wksp = alg->getProperty("OutputWorkspace");
   }
-  setGroupWSProperty(this, m_workspaceName, wksp);
+  setProperty("OutputGroupingWorkspace", wksp);
 }
 
 void LoadDiffCal::runLoadCalFile() {
@@ -437,14 +448,13 @@ void LoadDiffCal::runLoadCalFile() {
 
   if (makeCalWS) {
     ITableWorkspace_sptr wksp = alg->getProperty("OutputCalWorkspace");
-    setCalWSProperty(this, m_workspaceName, wksp);
+    setProperty("OutputCalWorkspace", wksp);
   }
 
   if (makeMaskWS) {
     MatrixWorkspace_sptr wksp = alg->getProperty("OutputMaskWorkspace");
-    setMaskWSProperty(
-        this, m_workspaceName,
-        boost::dynamic_pointer_cast<DataObjects::MaskWorkspace>(wksp));
+    setProperty("OutputMaskWorkspace",
+                boost::dynamic_pointer_cast<DataObjects::MaskWorkspace>(wksp));
   }
 
   if (makeGroupWS) {
@@ -455,7 +465,7 @@ void LoadDiffCal::runLoadCalFile() {
         m_instrument = wksp->getInstrument();
       loadGroupingFromAlternateFile();
     } else {
-      setGroupWSProperty(this, m_workspaceName, wksp);
+      setProperty("OutputGroupingWorkspace", wksp);
     }
   }
 }
@@ -466,6 +476,7 @@ void LoadDiffCal::runLoadCalFile() {
 void LoadDiffCal::exec() {
   m_filename = getPropertyValue(PropertyNames::CAL_FILE);
   m_workspaceName = getPropertyValue("WorkspaceName");
+  declareOutputProperties();
 
   if (endswith(m_filename, ".cal")) {
     runLoadCalFile();
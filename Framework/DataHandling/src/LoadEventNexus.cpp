@@ -10,7 +10,9 @@
 #include "MantidAPI/RegisterFileLoader.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/Sample.h"
+#include "MantidDataHandling/CompressEvents.h"
 #include "MantidDataHandling/DefaultEventLoader.h"
+#include "MantidDataHandling/EventCacheFile.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
 #include "MantidDataHandling/LoadEventNexusIndexSetup.h"
 #include "MantidDataHandling/ParallelEventLoader.h"
@@ -29,6 +31,7 @@
 #include "MantidKernel/VisibleWhenProperty.h"
 
 #include <H5Cpp.h>
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/shared_array.hpp>
 #include <boost/shared_ptr.hpp>
 
@@ -72,7 +75,8 @@ bool exists(::NeXus::File &file, const std::string &name) {
 LoadEventNexus::LoadEventNexus()
     : filter_tof_min(0), filter_tof_max(0), m_specMin(0), m_specMax(0),
       longest_tof(0), shortest_tof(0), bad_tofs(0), discarded_events(0),
-      compressTolerance(0), m_instrument_loaded_correctly(false),
+      compressTolerance(0), compressWallClockTolerance(EMPTY_DBL()),
+      m_instrument_loaded_correctly(false),
       loadlogs(false), event_id_is_spec(false) {}
 
 //----------------------------------------------------------------------------------------------
@@ -181,6 +185,17 @@ void LoadEventNexus::init() {
                   "This specified the tolerance to use (in microseconds) when "
                   "compressing.");
 
+  auto mustBePositiveDbl = boost::make_shared<BoundedValidator<double>>();
+  mustBePositiveDbl->setLower(0.0);
+  declareProperty(
+      std::make_unique<PropertyWithValue<double>>(
+          "CompressWallClockTolerance", EMPTY_DBL(), mustBePositiveDbl,
+          Direction::Input),
+      "The tolerance (in seconds) on the wall-clock time when compressing "
+      "events while loading. Ignored if CompressTolerance is not set. Unset "
+      "means compressing all wall-clock times together, which prevents "
+      "filtering the events by time afterwards.");
+
   auto mustBePositive = boost::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
   declareProperty("ChunkNumber", EMPTY_INT(), mustBePositive,
@@ -198,6 +213,7 @@ void LoadEventNexus::init() {
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
   setPropertyGroup("CompressTolerance", grp3);
+  setPropertyGroup("CompressWallClockTolerance", grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
 
@@ -271,6 +287,17 @@ void LoadEventNexus::init() {
   declareProperty(std::make_unique<PropertyWithValue<bool>>("LoadLogs", true,
                                                             Direction::Input),
                   "Load the Sample/DAS logs from the file (default True).");
+  declareProperty(std::make_unique<ArrayProperty<std::string>>(
+                      "AllowList", Direction::Input),
+                  "If not empty, only the sample logs named here are loaded, "
+                  "along with the proton_charge and period_log logs.");
+  declareProperty(std::make_unique<ArrayProperty<std::string>>(
+                      "BlockList", Direction::Input),
+                  "Sample logs named here are not loaded.");
+  setPropertySettings("AllowList", std::make_unique<VisibleWhenProperty>(
+                                       "LoadLogs", IS_EQUAL_TO, "1"));
+  setPropertySettings("BlockList", std::make_unique<VisibleWhenProperty>(
+                                       "LoadLogs", IS_EQUAL_TO, "1"));
   std::vector<std::string> loadType{"Default"};
 
 #ifndef _WIN32
@@ -291,6 +318,49 @@ void LoadEventNexus::init() {
                       "LoadNexusInstrumentXML", true, Direction::Input),
                   "Reads the embedded Instrument XML from the NeXus file "
                   "(optional, default True). ");
+
+  auto mustBeNonNegative = boost::make_shared<BoundedValidator<int>>();
+  mustBeNonNegative->setLower(0);
+  declareProperty("ReadAheadBanks", 0, mustBeNonNegative,
+                  "The maximum number of banks that are read from the file "
+                  "ahead of converting them into event lists. Reading pauses "
+                  "when this many banks are waiting, which bounds the memory "
+                  "used for buffering. 0 (default) uses the number of cores.");
+  declareProperty("ProcessTasksPerBank", 0, mustBeNonNegative,
+                  "The number of tasks, each handling a range of pixels, that "
+                  "convert a bank into event lists once it has been read. 0 "
+                  "(default) chooses automatically from the number of banks "
+                  "and cores.");
+  declareProperty(
+      "SpectrumPartitioning", "RoundRobin",
+      boost::make_shared<StringListValidator>(
+          std::vector<std::string>{"RoundRobin", "BankEventCounts"}),
+      "How the spectra are distributed over the ranks of an MPI run. "
+      "RoundRobin (default) deals them out one by one, BankEventCounts "
+      "gives each rank a block of neighbouring banks with a similar number "
+      "of events.");
+  std::string grp5 = "Performance Tuning";
+  setPropertyGroup("ReadAheadBanks", grp5);
+  setPropertyGroup("ProcessTasksPerBank", grp5);
+  setPropertyGroup("SpectrumPartitioning", grp5);
+
+  declareProperty(
+      std::make_unique<FileProperty>("EventCacheFile", "",
+                                     FileProperty::OptionalSave, ".evcache"),
+      "Optional: A file used to cache the events of this run. If the file "
+      "exists and was created from the same, unchanged, NeXus file, the "
+      "events are read from it instead of being decoded again. Otherwise it "
+      "is created after loading. The cache is only used when all events are "
+      "loaded, i.e. without filtering, compression, chunks, bank or spectrum "
+      "selection, and for single period data.");
+  declareProperty(
+      "SharedEventCache", "",
+      "Optional: The name of a shared memory segment caching the events of "
+      "this run, for several processes on a machine loading the same run. If "
+      "another process has published the events of the same, unchanged, "
+      "NeXus file under this name they are copied from it. Otherwise the "
+      "events are published once loaded and kept until this process exits. "
+      "The same restrictions as for EventCacheFile apply.");
 }
 
 //----------------------------------------------------------------------------------------------
@@ -369,6 +439,7 @@ void LoadEventNexus::exec() {
   m_filename = getPropertyValue("Filename");
 
   compressTolerance = getProperty("CompressTolerance");
+  compressWallClockTolerance = getProperty("CompressWallClockTolerance");
 
   loadlogs = getProperty("LoadLogs");
 
@@ -392,6 +463,9 @@ void LoadEventNexus::exec() {
                                                          // relies on an
   // object-level workspace ptr
   loadEvents(&prog, false); // Do not load monitor blocks
+  if (compressTolerance >= 0)
+    CompressEvents::addCompressionLogs(m_ws->mutableRun(), compressTolerance,
+                                       compressWallClockTolerance);
 
   if (discarded_events > 0) {
     g_log.information() << discarded_events
@@ -567,6 +641,12 @@ boost::shared_ptr<BankPulseTimes> LoadEventNexus::runLoadNexusLogs(
                                  alg.getPropertyValue("NXentryName"));
     } catch (...) {
     }
+    if (alg.existsProperty("AllowList")) {
+      loadLogs->setPropertyValue("AllowList",
+                                 alg.getPropertyValue("AllowList"));
+      loadLogs->setPropertyValue("BlockList",
+                                 alg.getPropertyValue("BlockList"));
+    }
 
     loadLogs->execute();
 
@@ -853,6 +933,8 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
   }
   if (takeTimesFromEvents)
     run_start = firstPulseT;
+  // The pulse time bins of compressed events are counted from the run start
+  compressStartTime = run_start;
 
   loadSampleDataISIScompatibility(*m_file, *m_ws);
 
@@ -960,7 +1042,12 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
     }
   }
   //----------------- Pad Empty Pixels -------------------------------
-  createSpectraMapping(m_filename, monitors, someBanks);
+  if (!monitors && someBanks.empty() &&
+      getPropertyValue("SpectrumPartitioning") == "BankEventCounts")
+    createSpectraMapping(m_filename, monitors, someBanks, bankNames,
+                         bankNumEvents);
+  else
+    createSpectraMapping(m_filename, monitors, someBanks);
 
   // Set all (empty) event lists as sorted by pulse time. That way, calling
   // SortEvents will not try to sort these empty lists.
@@ -973,8 +1060,39 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
   longest_tof = 0.;
 
   bool loaded{false};
+  const std::string eventCacheFile = getPropertyValue("EventCacheFile");
+  const std::string sharedEventCache = getPropertyValue("SharedEventCache");
+  const bool canCache =
+      (!eventCacheFile.empty() || !sharedEventCache.empty()) && !monitors &&
+      canUseEventCache(is_time_filtered);
+  const bool useEventCache = canCache && !eventCacheFile.empty();
+  const bool useSharedCache = canCache && !sharedEventCache.empty();
+  if (useSharedCache) {
+    auto ws = m_ws->getSingleHeldWorkspace();
+    if (SharedEventCache::read(sharedEventCache, m_filename, *ws)) {
+      g_log.information() << "Read events from shared cache "
+                          << sharedEventCache << ".\n";
+      loaded = true;
+    }
+  }
+  const bool loadedFromSharedCache = loaded;
+  if (useEventCache && !loaded) {
+    auto ws = m_ws->getSingleHeldWorkspace();
+    if (EventCacheFile::read(eventCacheFile, m_filename, *ws)) {
+      g_log.information() << "Read events from cache " << eventCacheFile
+                          << ".\n";
+      loaded = true;
+    }
+  }
+  const bool loadedFromCache = loaded;
+  if (loaded) {
+    auto ws = m_ws->getSingleHeldWorkspace();
+    shortest_tof = ws->getTofMin();
+    longest_tof = ws->getTofMax();
+  }
+
   auto loaderType = defineLoaderType(haveWeights, oldNeXusFileNames, classType);
-  if (loaderType != LoaderType::DEFAULT) {
+  if (!loaded && loaderType != LoaderType::DEFAULT) {
     auto ws = m_ws->getSingleHeldWorkspace();
     m_file->close();
     if (loaderType == LoaderType::MPI) {
@@ -983,8 +1101,6 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
                                      bankNames, event_id_is_spec);
         g_log.information() << "Used MPI ParallelEventLoader.\n";
         loaded = true;
-        shortest_tof = 0.0;
-        longest_tof = 1e10;
       } catch (const std::runtime_error &) {
         g_log.warning()
             << "MPI event loader failed, falling back to default loader.\n";
@@ -1011,8 +1127,6 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
                                               getProperty("Precount"));
         g_log.information() << "Used Multiprocess ParallelEventLoader.\n";
         loaded = true;
-        shortest_tof = 0.0;
-        longest_tof = 1e10;
       } catch (const std::exception &e) {
         ExceptionOutput::out(g_log, e);
         g_log.warning() << "\nMultiprocess event loader failed, falling back "
@@ -1021,6 +1135,12 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
     }
 
     safeOpenFile(m_filename);
+
+    if (loaded) {
+      filterEventsAfterParallelLoad(*ws);
+      shortest_tof = ws->getTofMin();
+      longest_tof = ws->getTofMax();
+    }
   }
   if (!loaded) {
     bool precount = getProperty("Precount");
@@ -1029,7 +1149,29 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
     DefaultEventLoader::load(this, *m_ws, haveWeights, event_id_is_spec,
                              bankNames, periodLog->valuesAsVector(), classType,
                              bankNumEvents, oldNeXusFileNames, precount, chunk,
-                             totalChunks);
+                             totalChunks, getProperty("ProcessTasksPerBank"),
+                             getProperty("ReadAheadBanks"));
+  }
+
+  if (useEventCache && !loadedFromCache) {
+    try {
+      EventCacheFile::write(eventCacheFile, m_filename,
+                            *m_ws->getSingleHeldWorkspace());
+    } catch (const std::exception &e) {
+      g_log.warning() << "Could not write the event cache " << eventCacheFile
+                      << ": " << e.what() << '\n';
+    }
+  }
+  if (useSharedCache && !loadedFromSharedCache) {
+    try {
+      if (SharedEventCache::publish(sharedEventCache, m_filename,
+                                    *m_ws->getSingleHeldWorkspace()))
+        g_log.information() << "Published events to shared cache "
+                            << sharedEventCache << ".\n";
+    } catch (const std::exception &e) {
+      g_log.warning() << "Could not publish the shared event cache "
+                      << sharedEventCache << ": " << e.what() << '\n';
+    }
   }
 
   // Info reporting
@@ -1248,13 +1390,30 @@ void LoadEventNexus::deleteBanks(EventWorkspaceCollection_sptr workspace,
  * @param nxsfile :: The name of a nexus file to load the mapping from
  * @param monitorsOnly :: Load only the monitors is true
  * @param bankNames :: An optional bank name for loading specified banks
+ * @param eventBankNames :: Optional names of the NXevent_data entries in the
+ * file, to distribute the spectra by the number of events in each
+ * @param bankEventCounts :: The number of events of each entry
  */
 void LoadEventNexus::createSpectraMapping(
     const std::string &nxsfile, const bool monitorsOnly,
-    const std::vector<std::string> &bankNames) {
+    const std::vector<std::string> &bankNames,
+    const std::vector<std::string> &eventBankNames,
+    const std::vector<size_t> &bankEventCounts) {
   LoadEventNexusIndexSetup indexSetup(
       m_ws->getSingleHeldWorkspace(), getProperty("SpectrumMin"),
       getProperty("SpectrumMax"), getProperty("SpectrumList"), communicator());
+  if (!eventBankNames.empty()) {
+    // The entries are named after the banks of the instrument
+    std::vector<std::string> instrumentBankNames;
+    for (const auto &name : eventBankNames) {
+      const std::string suffix("_events");
+      instrumentBankNames.emplace_back(
+          boost::algorithm::ends_with(name, suffix)
+              ? name.substr(0, name.size() - suffix.size())
+              : name);
+    }
+    indexSetup.setBankEventCounts(instrumentBankNames, bankEventCounts);
+  }
   if (!monitorsOnly && !bankNames.empty()) {
     if (!isDefault("SpectrumMin") || !isDefault("SpectrumMax") ||
         !isDefault("SpectrumList"))
@@ -1466,6 +1625,76 @@ void LoadEventNexus::setTimeFilters(const bool monitors) {
   }
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * Apply the time-of-flight and pulse time filters, and compression, to events
+ * loaded by ParallelEventLoader, which always loads every event. The events
+ * kept are the same as those kept by DefaultEventLoader.
+ * @param ws :: the workspace holding the loaded events
+ */
+void LoadEventNexus::filterEventsAfterParallelLoad(
+    DataObjects::EventWorkspace &ws) {
+  const bool tofFiltered = filter_tof_min != -1e20 || filter_tof_max != 1e20;
+  const bool timeFiltered =
+      filter_time_start != Types::Core::DateAndTime::minimum() ||
+      filter_time_stop != Types::Core::DateAndTime::maximum();
+  const bool compress = compressTolerance >= 0;
+  if (!tofFiltered && !timeFiltered && !compress)
+    return;
+
+  const auto numHistograms = static_cast<int64_t>(ws.getNumberHistograms());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numHistograms; ++i) {
+    auto &eventList = ws.getSpectrum(i);
+    if (tofFiltered || timeFiltered) {
+      auto &events = eventList.getEvents();
+      events.erase(std::remove_if(events.begin(), events.end(),
+                                  [this](const Types::Event::TofEvent &event) {
+                                    const double tof = event.tof();
+                                    const auto pulse = event.pulseTime();
+                                    return tof < filter_tof_min ||
+                                           tof > filter_tof_max ||
+                                           pulse < filter_time_start ||
+                                           pulse > filter_time_stop;
+                                  }),
+                   events.end());
+    }
+    if (compress) {
+      if (isEmpty(compressWallClockTolerance))
+        eventList.compressEvents(compressTolerance, &eventList);
+      else
+        eventList.compressFatEvents(compressTolerance, compressStartTime,
+                                    compressWallClockTolerance, &eventList);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * Check whether the requested load includes every event of the file, so that
+ * its events can be read from, or written to, an event cache file.
+ * @param isTimeFiltered :: true if the events are filtered by pulse time
+ * @return true if an event cache can be used
+ */
+bool LoadEventNexus::canUseEventCache(const bool isTimeFiltered) {
+  const std::vector<std::string> banks = getProperty("BankName");
+  const std::vector<int32_t> spectrumList = getProperty("SpectrumList");
+  const int spectrumMin = getProperty("SpectrumMin");
+  const int spectrumMax = getProperty("SpectrumMax");
+  const int chunk = getProperty("ChunkNumber");
+  const double tofMin = getProperty("FilterByTofMin");
+  const double tofMax = getProperty("FilterByTofMax");
+  const bool canUse = m_ws->nPeriods() == 1 && !isTimeFiltered &&
+                      tofMin == EMPTY_DBL() && tofMax == EMPTY_DBL() &&
+                      compressTolerance < 0 && chunk == EMPTY_INT() &&
+                      banks.empty() && spectrumList.empty() &&
+                      spectrumMin == EMPTY_INT() && spectrumMax == EMPTY_INT();
+  if (!canUse)
+    g_log.warning() << "The event cache is ignored as only part of the "
+                       "events are being loaded.\n";
+  return canUse;
+}
+
 //-----------------------------------------------------------------------------
 
 /**
@@ -1545,23 +1774,28 @@ LoadEventNexus::defineLoaderType(const bool haveWeights,
   if (propVal == "Default")
     return LoaderType::DEFAULT;
 
-  bool noParallelConstrictions = true;
-  noParallelConstrictions &= !(m_ws->nPeriods() != 1);
-  noParallelConstrictions &= !haveWeights;
-  noParallelConstrictions &= !oldNeXusFileNames;
-  noParallelConstrictions &=
-      !(filter_tof_min != -1e20 || filter_tof_max != 1e20);
-  noParallelConstrictions &=
-      !((filter_time_start != Types::Core::DateAndTime::minimum() ||
-         filter_time_stop != Types::Core::DateAndTime::maximum()));
-  noParallelConstrictions &=
-      !((!isDefault("CompressTolerance") || !isDefault("SpectrumMin") ||
-         !isDefault("SpectrumMax") || !isDefault("SpectrumList") ||
-         !isDefault("ChunkNumber")));
-  noParallelConstrictions &= !(classType != "NXevent_data");
-
-  if (!noParallelConstrictions)
+  // Filtering by time-of-flight or pulse time and compression are applied
+  // after loading, see filterEventsAfterParallelLoad()
+  std::string constriction;
+  if (m_ws->nPeriods() != 1)
+    constriction = "multi-period data";
+  else if (haveWeights)
+    constriction = "weighted events";
+  else if (oldNeXusFileNames)
+    constriction = "old NeXus field names";
+  else if (!isDefault("SpectrumMin") || !isDefault("SpectrumMax") ||
+           !isDefault("SpectrumList"))
+    constriction = "a spectrum selection";
+  else if (!isDefault("ChunkNumber"))
+    constriction = "loading by chunks";
+  else if (classType != "NXevent_data")
+    constriction = classType + " entries";
+
+  if (!constriction.empty()) {
+    g_log.warning() << "LoadType " << propVal << " does not support "
+                    << constriction << ", using the default loader.\n";
     return LoaderType::DEFAULT;
+  }
 #ifndef MPI_EXPERIMENTAL
   return LoaderType::MULTIPROCESS;
 #else
@@ -9,6 +9,7 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidIndexing/EventCountPartitioner.h"
 #include "MantidIndexing/Extract.h"
 #include "MantidIndexing/Scatter.h"
 #include "MantidIndexing/SpectrumIndexSet.h"
@@ -51,6 +52,24 @@ std::pair<int32_t, int32_t> LoadEventNexusIndexSetup::eventIDLimits() const {
   return {m_min, m_max};
 }
 
+/** Set the number of events in each bank, to distribute the spectra in MPI
+ * runs such that each rank gets a similar number of events, instead of
+ * round-robin. Each rank then holds the spectra of one or a few neighbouring
+ * banks.
+ *
+ * @param bankNames :: The names of the banks in the instrument
+ * @param eventCounts :: The number of events of each bank
+ */
+void LoadEventNexusIndexSetup::setBankEventCounts(
+    const std::vector<std::string> &bankNames,
+    const std::vector<size_t> &eventCounts) {
+  if (bankNames.size() != eventCounts.size())
+    throw std::invalid_argument(
+        "LoadEventNexusIndexSetup: bank names and event counts do not match");
+  m_bankNames = bankNames;
+  m_bankEventCounts = eventCounts;
+}
+
 IndexInfo LoadEventNexusIndexSetup::makeIndexInfo() {
   // The default 1:1 will suffice but exclude the monitors as they are always in
   // a separate workspace
@@ -201,5 +220,59 @@ LoadEventNexusIndexSetup::filterIndexInfo(const IndexInfo &indexInfo) {
   return indexInfo;
 }
 
+/** Returns a scattered copy of `indexInfo`.
+ *
+ * If bank event counts are set, the spectra are split into runs of
+ * consecutive spectra in the same bank, and the events of a bank are shared
+ * out to its runs in proportion to their number of spectra. The runs are then
+ * partitioned by EventCountPartitioner. */
+IndexInfo
+LoadEventNexusIndexSetup::scatter(const IndexInfo &indexInfo) const {
+  if (m_bankNames.empty() || m_communicator.size() == 1)
+    return Indexing::scatter(indexInfo);
+  const auto &componentInfo = m_instrumentWorkspace->componentInfo();
+  const auto &instrument = m_instrumentWorkspace->getInstrument();
+  // Bank of each detector, by detector index
+  std::vector<size_t> detectorBanks(componentInfo.size(), m_bankNames.size());
+  for (size_t bank = 0; bank < m_bankNames.size(); ++bank) {
+    const auto &component = instrument->getComponentByName(m_bankNames[bank]);
+    if (!component)
+      continue;
+    const auto bankIndex = componentInfo.indexOf(component->getComponentID());
+    for (const auto detIndex : componentInfo.detectorsInSubtree(bankIndex))
+      detectorBanks[detIndex] = bank;
+  }
+
+  const auto &spectrumDefinitions = *indexInfo.spectrumDefinitions();
+  std::vector<size_t> spectrumBanks;
+  std::vector<size_t> bankSpectra(m_bankNames.size() + 1, 0);
+  for (const auto &spectrumDefinition : spectrumDefinitions) {
+    const auto bank = spectrumDefinition.size() == 0
+                          ? m_bankNames.size()
+                          : detectorBanks[spectrumDefinition[0].first];
+    spectrumBanks.push_back(bank);
+    ++bankSpectra[bank];
+  }
+
+  std::vector<size_t> rangeSizes;
+  std::vector<size_t> eventCounts;
+  for (size_t i = 0; i < spectrumBanks.size(); ++i) {
+    const auto bank = spectrumBanks[i];
+    if (i == 0 || bank != spectrumBanks[i - 1]) {
+      rangeSizes.push_back(0);
+      eventCounts.push_back(0);
+    }
+    ++rangeSizes.back();
+    if (bank < m_bankNames.size())
+      eventCounts.back() = m_bankEventCounts[bank] * rangeSizes.back() /
+                           bankSpectra[bank];
+  }
+  const EventCountPartitioner partitioner(
+      m_communicator.size(), PartitionIndex(m_communicator.rank()),
+      Partitioner::MonitorStrategy::TreatAsNormalSpectrum, rangeSizes,
+      eventCounts);
+  return Indexing::scatter(indexInfo, partitioner);
+}
+
 } // namespace DataHandling
 } // namespace Mantid
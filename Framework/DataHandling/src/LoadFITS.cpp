@@ -14,6 +14,7 @@
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
 
@@ -23,6 +24,8 @@
 #include <Poco/BinaryReader.h>
 #include <Poco/Path.h>
 
+#include <cstring>
+
 using namespace Mantid::DataHandling;
 using namespace Mantid::DataObjects;
 using namespace Mantid::API;
@@ -31,12 +34,33 @@ using namespace Mantid::Kernel;
 namespace {
 
 /**
- * Reinterpret a byte sequence as InterpretType and cast to double
- * @param Pointer to byte src
+ * Convert big-endian values of a FITS data array to Y values, and their
+ * square root as E values. The bytes are assembled with shifts rather than
+ * copied and reversed one value at a time, which compilers turn into byte
+ * swaps and can vectorise.
+ * @param src :: The first byte of the values
+ * @param count :: The number of values to convert
+ * @param scale :: The scale to apply to the values (BSCALE)
+ * @param offset :: The offset to subtract from the scaled values (BZERO)
+ * @param y :: Where to put the Y values
+ * @param e :: Where to put the E values
  */
-template <typename InterpretType> double toDouble(uint8_t *src) {
-  // cppcheck-suppress invalidPointerCast
-  return static_cast<double>(*reinterpret_cast<InterpretType *>(src));
+template <typename InterpretType, typename UIntType>
+void convertValues(const uint8_t *src, const size_t count, const double scale,
+                   const double offset, double *y, double *e) {
+  static_assert(sizeof(InterpretType) == sizeof(UIntType),
+                "The values must be read into an integer of the same size");
+  for (size_t i = 0; i < count; ++i) {
+    const uint8_t *bytes = src + i * sizeof(UIntType);
+    UIntType bits = 0;
+    for (size_t b = 0; b < sizeof(UIntType); ++b)
+      bits = static_cast<UIntType>((bits << 8) | bytes[b]);
+    InterpretType value;
+    std::memcpy(&value, &bits, sizeof(value));
+    const double val = scale * static_cast<double>(value) - offset;
+    y[i] = val;
+    e[i] = std::sqrt(val);
+  }
 }
 } // namespace
 
@@ -61,6 +85,35 @@ struct FITSInfo {
   bool isFloat;
 };
 
+namespace {
+/**
+ * Convert values of the data array of a FITS file to Y and E values,
+ * according to the type of pixel of the file
+ * @param fileInfo :: Information on the FITS file
+ * @param src :: The first byte of the values
+ * @param count :: The number of values to convert
+ * @param y :: Where to put the Y values
+ * @param e :: Where to put the E values
+ */
+void convertToYAndE(const FITSInfo &fileInfo, const uint8_t *src,
+                    const size_t count, double *y, double *e) {
+  const double scale = fileInfo.scale;
+  const double offset = fileInfo.offset;
+  if (fileInfo.bitsPerPixel == 8)
+    convertValues<uint8_t, uint8_t>(src, count, scale, offset, y, e);
+  else if (fileInfo.bitsPerPixel == 16)
+    convertValues<uint16_t, uint16_t>(src, count, scale, offset, y, e);
+  else if (fileInfo.bitsPerPixel == 32 && !fileInfo.isFloat)
+    convertValues<uint32_t, uint32_t>(src, count, scale, offset, y, e);
+  else if (fileInfo.bitsPerPixel == 64 && !fileInfo.isFloat)
+    convertValues<uint64_t, uint64_t>(src, count, scale, offset, y, e);
+  else if (fileInfo.bitsPerPixel == 32 && fileInfo.isFloat)
+    convertValues<float, uint32_t>(src, count, scale, offset, y, e);
+  else if (fileInfo.bitsPerPixel == 64 && fileInfo.isFloat)
+    convertValues<double, uint64_t>(src, count, scale, offset, y, e);
+}
+} // namespace
+
 // Static class constants
 const std::string LoadFITS::g_END_KEYNAME = "END";
 const std::string LoadFITS::g_COMMENT_KEYNAME = "COMMENT";
@@ -527,19 +580,60 @@ void LoadFITS::doLoadFiles(const std::vector<std::string> &paths,
     }
   }
 
-  // don't feel tempted to parallelize this loop as it is - it uses the same
-  // imageY and imageE buffers for all the workspaces
-  for (int64_t i = 1; i < static_cast<int64_t>(totalWS); ++i) {
-    loadHeader(paths[i], headers[i]);
-    // Check each header is valid/supported: standard (no extension to
-    // FITS), has two axis, and it is consistent with the first header
-    headerSanityCheck(headers[i], headers[0]);
-
-    imgWS = makeWorkspace(headers[i], fileNumberInGroup, buffer, imageY, imageE,
-                          imgWS, loadAsRectImg, binSize, noiseThresh);
-    progress.report("Loaded file " + std::to_string(i + 1) + " of " +
-                    std::to_string(totalWS));
-    wsGroup->addWorkspace(imgWS);
+  // The remaining files are read, converted and filtered in parallel, in
+  // batches of one file per thread, so that only a batch of buffers and
+  // images is held at once. Each file of a batch has its own buffer and
+  // images.
+  const size_t batchSize =
+      std::max(static_cast<size_t>(PARALLEL_GET_MAX_THREADS), size_t(1));
+  std::vector<std::vector<char>> buffers(std::min(batchSize, totalWS));
+  std::vector<MantidImage> imagesY(buffers.size()), imagesE(buffers.size());
+  buffers[0] = std::move(buffer);
+  imagesY[0] = std::move(imageY);
+  imagesE[0] = std::move(imageE);
+  try {
+    const bool useImages = !loadAsRectImg || 1 != binSize;
+    for (size_t slot = 1; slot < buffers.size(); ++slot) {
+      buffers[slot].resize(bytes);
+      if (useImages) {
+        imagesY[slot] = imagesY[0];
+        imagesE[slot] = imagesE[0];
+      }
+    }
+  } catch (std::exception &) {
+    throw std::runtime_error(
+        "Could not allocate enough memory to load " +
+        std::to_string(buffers.size()) + " files at once, " +
+        std::to_string(bytes) + " bytes each.");
+  }
+
+  const Workspace2D_sptr templateWS = imgWS;
+  for (size_t first = 1; first < totalWS; first += batchSize) {
+    const size_t last = std::min(first + batchSize, totalWS);
+    std::vector<Workspace2D_sptr> batch(last - first);
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = static_cast<int64_t>(first);
+         i < static_cast<int64_t>(last); ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      const size_t slot = static_cast<size_t>(i) - first;
+      loadHeader(paths[i], headers[i]);
+      // Check each header is valid/supported: standard (no extension to
+      // FITS), has two axis, and it is consistent with the first header
+      headerSanityCheck(headers[i], headers[0]);
+
+      batch[slot] = makeWorkspace(
+          headers[i], fileNumberInGroup + i, buffers[slot], imagesY[slot],
+          imagesE[slot], templateWS, loadAsRectImg, binSize, noiseThresh);
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+
+    for (size_t i = first; i < last; ++i) {
+      progress.report("Loaded file " + std::to_string(i + 1) + " of " +
+                      std::to_string(totalWS));
+      wsGroup->addWorkspace(batch[i - first]);
+    }
   }
 
   setProperty("OutputWorkspace", wsGroup);
@@ -655,7 +749,7 @@ void LoadFITS::parseHeader(FITSInfo &headerInfo) {
  *
  * @param fileInfo information for the current file
  *
- * @param newFileNumber sequence number for the new file when added
+ * @param fileNumber sequence number for the new file when added
  * into ws group
  *
  * @param buffer pre-allocated buffer to contain data values
@@ -676,13 +770,15 @@ void LoadFITS::parseHeader(FITSInfo &headerInfo) {
  * @returns A newly created Workspace2D, as a shared pointer
  */
 Workspace2D_sptr
-LoadFITS::makeWorkspace(const FITSInfo &fileInfo, size_t &newFileNumber,
+LoadFITS::makeWorkspace(const FITSInfo &fileInfo, const size_t fileNumber,
                         std::vector<char> &buffer, MantidImage &imageY,
                         MantidImage &imageE, const Workspace2D_sptr parent,
                         bool loadAsRectImg, int binSize, double noiseThresh) {
   // Create workspace (taking into account already here if rebinning is
   // going to happen)
   Workspace2D_sptr ws;
+  // The files after the first are loaded in parallel
+  PARALLEL_CRITICAL(LoadFITS_createWorkspace)
   if (!parent) {
     if (!loadAsRectImg) {
       size_t finalPixelCount = m_pixelCount / binSize * binSize;
@@ -738,9 +834,8 @@ LoadFITS::makeWorkspace(const FITSInfo &fileInfo, size_t &newFileNumber,
   try {
     ws->setTitle(Poco::Path(fileInfo.filePath).getFileName());
   } catch (std::runtime_error &) {
-    ws->setTitle(padZeros(newFileNumber, g_DIGIT_SIZE_APPEND));
+    ws->setTitle(padZeros(fileNumber, g_DIGIT_SIZE_APPEND));
   }
-  ++newFileNumber;
 
   addAxesInfoAndLogs(ws, loadAsRectImg, fileInfo, binSize, cmpp);
 
@@ -857,7 +952,7 @@ void LoadFITS::readDataToWorkspace(const FITSInfo &fileInfo, double cmpp,
   const size_t nrows(fileInfo.axisPixelLengths[1]),
       ncols(fileInfo.axisPixelLengths[0]);
   // Treat buffer as a series of bytes
-  auto *buffer8 = reinterpret_cast<uint8_t *>(buffer.data());
+  const auto *buffer8 = reinterpret_cast<const uint8_t *>(buffer.data());
 
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int i = 0; i < static_cast<int>(nrows); ++i) {
@@ -865,35 +960,8 @@ void LoadFITS::readDataToWorkspace(const FITSInfo &fileInfo, double cmpp,
     auto &yVals = ws->mutableY(i);
     auto &eVals = ws->mutableE(i);
     xVals = static_cast<double>(i) * cmpp;
-
-    for (size_t j = 0; j < ncols; ++j) {
-      // Map from 2D->1D index
-      const size_t start = ((i * (bytespp)) * nrows) + (j * (bytespp));
-      uint8_t const *const buffer8Start = buffer8 + start;
-      // Reverse byte order of current value. Make sure we allocate enough
-      // enough space to hold the size
-      uint8_t byteValue[g_maxBytesPP];
-      std::reverse_copy(buffer8Start, buffer8Start + bytespp, byteValue);
-
-      double val = 0;
-      if (fileInfo.bitsPerPixel == 8) {
-        val = toDouble<uint8_t>(byteValue);
-      } else if (fileInfo.bitsPerPixel == 16) {
-        val = toDouble<uint16_t>(byteValue);
-      } else if (fileInfo.bitsPerPixel == 32 && !fileInfo.isFloat) {
-        val = toDouble<uint32_t>(byteValue);
-      } else if (fileInfo.bitsPerPixel == 64 && !fileInfo.isFloat) {
-        val = toDouble<uint32_t>(byteValue);
-      } else if (fileInfo.bitsPerPixel == 32 && fileInfo.isFloat) {
-        val = toDouble<float>(byteValue);
-      } else if (fileInfo.bitsPerPixel == 64 && fileInfo.isFloat) {
-        val = toDouble<double>(byteValue);
-      }
-
-      val = fileInfo.scale * val - fileInfo.offset;
-      yVals[j] = val;
-      eVals[j] = sqrt(val);
-    }
+    convertToYAndE(fileInfo, buffer8 + i * ncols * bytespp, ncols, &yVals[0],
+                   &eVals[0]);
   }
 }
 
@@ -915,48 +983,11 @@ void LoadFITS::readDataToImgs(const FITSInfo &fileInfo, MantidImage &imageY,
   size_t len = m_pixelCount * bytespp;
   readInBuffer(fileInfo, buffer, len);
 
-  // create pointer of correct data type to void pointer of the buffer:
-  auto *buffer8 = reinterpret_cast<uint8_t *>(&buffer[0]);
-  std::vector<char> buf(bytespp);
-  char *tmp = buf.data();
-  size_t start = 0;
-
-  for (size_t i = 0; i < fileInfo.axisPixelLengths[1]; ++i) {   // width
-    for (size_t j = 0; j < fileInfo.axisPixelLengths[0]; ++j) { // height
-      // If you wanted to PARALLEL_...ize these loops (which doesn't
-      // seem to provide any speed up when loading images one at a
-      // time, you cannot use the start+=bytespp at the end of this
-      // loop. You'd need something like this:
-      //
-      // size_t start =
-      // ((i * (bytespp)) * fileInfo.axisPixelLengths[1]) +
-      // (j * (bytespp));
-      // Reverse byte order of current value
-      std::reverse_copy(buffer8 + start, buffer8 + start + bytespp, tmp);
-      double val = 0;
-      if (fileInfo.bitsPerPixel == 8)
-        val = static_cast<double>(*reinterpret_cast<uint8_t *>(tmp));
-      if (fileInfo.bitsPerPixel == 16)
-        val = static_cast<double>(*reinterpret_cast<uint16_t *>(tmp));
-      if (fileInfo.bitsPerPixel == 32 && !fileInfo.isFloat)
-        val = static_cast<double>(*reinterpret_cast<uint32_t *>(tmp));
-      if (fileInfo.bitsPerPixel == 64 && !fileInfo.isFloat)
-        val = static_cast<double>(*reinterpret_cast<uint64_t *>(tmp));
-      // cppcheck doesn't realise that these are safe casts
-      if (fileInfo.bitsPerPixel == 32 && fileInfo.isFloat) {
-        // cppcheck-suppress invalidPointerCast
-        val = static_cast<double>(*reinterpret_cast<float *>(tmp));
-      }
-      if (fileInfo.bitsPerPixel == 64 && fileInfo.isFloat) {
-        // cppcheck-suppress invalidPointerCast
-        val = *reinterpret_cast<double *>(tmp);
-      }
-      val = fileInfo.scale * val - fileInfo.offset;
-      imageY[i][j] = val;
-      imageE[i][j] = sqrt(val);
-      start += bytespp;
-    }
-  }
+  const auto *buffer8 = reinterpret_cast<const uint8_t *>(buffer.data());
+  const size_t ncols = fileInfo.axisPixelLengths[0];
+  for (size_t i = 0; i < fileInfo.axisPixelLengths[1]; ++i)
+    convertToYAndE(fileInfo, buffer8 + i * ncols * bytespp, ncols,
+                   imageY[i].data(), imageE[i].data());
 }
 
 /**
@@ -22,6 +22,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 //#include "MantidKernel/LogParser.h"
 #include "MantidKernel/LogFilter.h"
 #include "MantidKernel/TimeSeriesProperty.h"
@@ -32,6 +33,8 @@
 #include <nexus/NeXusException.hpp>
 // clang-format on
 
+#include <H5Cpp.h>
+
 #include <Poco/Path.h>
 #include <Poco/DateTimeFormatter.h>
 #include <Poco/DateTimeParser.h>
@@ -46,6 +49,9 @@
 #include <vector>
 
 namespace {
+/// The number of counts to read from the file at once with HDF5
+constexpr size_t COUNTS_PER_READ = 1 << 24;
+
 Mantid::DataHandling::DataBlockComposite
 getMonitorsFromComposite(Mantid::DataHandling::DataBlockComposite &composite,
                          Mantid::DataHandling::DataBlockComposite &monitors) {
@@ -799,6 +805,10 @@ void LoadISISNexus2::loadPeriodData(
   int64_t hist_index = 0;
   int64_t period_index(period - 1);
   // int64_t first_monitor_spectrum = 0;
+  // The detector counts are read straight through HDF5 when the file allows
+  std::unique_ptr<H5::DataSet> counts;
+  if (m_have_detector)
+    counts = openCountsDataSet(entry);
 
   for (auto &spectraBlock : m_spectraBlocks) {
     if (spectraBlock.isMonitor) {
@@ -840,6 +850,11 @@ void LoadISISNexus2::loadPeriodData(
       // monotonically
       int64_t filestart =
           std::lower_bound(spec_begin, m_spec_end, spectra_no) - spec_begin;
+      if (counts) {
+        loadSpectraRange(*counts, rangesize, period_index, filestart,
+                         hist_index, spectra_no, local_workspace);
+        continue;
+      }
       if (fullblocks > 0) {
         for (int64_t i = 0; i < fullblocks; ++i) {
           loadBlock(data, blocksize, period_index, filestart, hist_index,
@@ -919,6 +934,89 @@ void LoadISISNexus2::loadBlock(NXDataSetTyped<int> &data, int64_t blocksize,
   }
 }
 
+/**
+ * Open the detector counts of an entry with HDF5
+ * @param entry :: The opened root entry node
+ * @return the counts dataset, or null if the file is not HDF5 or it has no
+ * detector counts by period, spectrum and time channel
+ */
+std::unique_ptr<H5::DataSet>
+LoadISISNexus2::openCountsDataSet(const NXEntry &entry) const {
+  try {
+    if (!H5::H5File::isHdf5(m_filename))
+      return nullptr;
+    H5::H5File file(m_filename, H5F_ACC_RDONLY);
+    // The dataset keeps the file open once the file object is closed
+    auto counts = std::make_unique<H5::DataSet>(
+        file.openDataSet(entry.path() + "/detector_1/counts"));
+    if (counts->getSpace().getSimpleExtentNdims() != 3)
+      return nullptr;
+    return counts;
+  } catch (H5::Exception &e) {
+    g_log.debug() << "Cannot read the counts with HDF5, reading them with "
+                     "NeXus instead: "
+                  << e.getDetailMsg() << '\n';
+    return nullptr;
+  }
+}
+
+/**
+ * Read the counts of a range of spectra with HDF5 in blocks of many spectra,
+ * filling the histograms of each block in parallel, where the errors are
+ * calculated from the counts
+ * @param data :: The counts dataset, with dimensions of period, spectrum and
+ * time channel
+ * @param nSpectra :: The number of spectra to read
+ * @param period :: The period number
+ * @param start :: The index within the file to start reading from (zero based)
+ * @param hist :: The workspace index to start reading into
+ * @param spec_num :: The spectrum number that matches the hist variable
+ * @param local_workspace :: The workspace to fill the data with
+ */
+void LoadISISNexus2::loadSpectraRange(
+    H5::DataSet &data, int64_t nSpectra, int64_t period, int64_t start,
+    int64_t &hist, int64_t &spec_num,
+    DataObjects::Workspace2D_sptr &local_workspace) {
+  const size_t nFileChannels = m_detBlockInfo.getNumberOfChannels();
+  const size_t nChannels = m_loadBlockInfo.getNumberOfChannels();
+  const auto blocksize = static_cast<int64_t>(
+      std::max(COUNTS_PER_READ / std::max(nFileChannels, size_t(1)),
+               size_t(1)));
+  H5::DataSpace fileSpace = data.getSpace();
+  std::vector<int> counts;
+  for (int64_t first = 0; first < nSpectra; first += blocksize) {
+    const int64_t size = std::min(blocksize, nSpectra - first);
+    const hsize_t offset[3] = {static_cast<hsize_t>(period),
+                               static_cast<hsize_t>(start + first), 0};
+    const hsize_t count[3] = {1, static_cast<hsize_t>(size), nFileChannels};
+    fileSpace.selectHyperslab(H5S_SELECT_SET, count, offset);
+    H5::DataSpace memSpace(3, count);
+    counts.resize(size * nFileChannels);
+    data.read(counts.data(), H5::PredType::NATIVE_INT, memSpace, fileSpace);
+
+    PARALLEL_FOR_IF(Kernel::threadSafe(*local_workspace))
+    for (int64_t i = 0; i < size; ++i) {
+      const int *spectrumCounts = counts.data() + i * nFileChannels;
+      local_workspace->setHistogram(
+          hist + i, BinEdges(m_tof_data),
+          Counts(spectrumCounts, spectrumCounts + nChannels));
+    }
+
+    m_progress->reportIncrement(static_cast<size_t>(size), "Loading data");
+    if (m_load_selected_spectra) {
+      for (int64_t i = hist; i < hist + size; ++i) {
+        auto &spec = local_workspace->getSpectrum(i);
+        specnum_t specNum = m_wsInd2specNum_map.at(i);
+        spec.setDetectorIDs(
+            m_spec2det_map.getDetectorIDsForSpectrumNo(specNum));
+        spec.setSpectrumNo(specNum);
+      }
+    }
+    hist += size;
+    spec_num += size;
+  }
+}
+
 /// Run the Child Algorithm LoadInstrument (or LoadInstrumentFromNexus)
 void LoadISISNexus2::runLoadInstrument(
     DataObjects::Workspace2D_sptr &localWorkspace) {
@@ -183,6 +183,10 @@ void readStartAndEndTime(::NeXus::File &file, API::Run &run) {
   }
 }
 
+/// Logs read even when not in the AllowList, as the loaders need them
+const std::set<std::string> REQUIRED_LOGS{"proton_charge", "proton_log",
+                                          "period_log"};
+
 } // End of anonymous namespace
 
 /// Empty default constructor
@@ -207,6 +211,15 @@ void LoadNexusLogs::init() {
   declareProperty(std::make_unique<PropertyWithValue<std::string>>(
                       "NXentryName", "", Direction::Input),
                   "Entry in the nexus file from which to read the logs");
+  declareProperty(std::make_unique<ArrayProperty<std::string>>(
+                      "AllowList", Direction::Input),
+                  "If not empty, only the logs named here are read from the "
+                  "file, along with the proton_charge, proton_log and "
+                  "period_log logs that the loaders rely on. The other logs "
+                  "are skipped without reading their values.");
+  declareProperty(std::make_unique<ArrayProperty<std::string>>(
+                      "BlockList", Direction::Input),
+                  "Logs named here are not read from the file.");
 }
 
 /** Executes the algorithm. Reading in the file and creating and populating
@@ -220,6 +233,13 @@ void LoadNexusLogs::exec() {
   std::string filename = getPropertyValue("Filename");
   MatrixWorkspace_sptr workspace = getProperty("Workspace");
 
+  const std::vector<std::string> allowList = getProperty("AllowList");
+  const std::vector<std::string> blockList = getProperty("BlockList");
+  m_allowList = std::set<std::string>(allowList.cbegin(), allowList.cend());
+  if (!m_allowList.empty())
+    m_allowList.insert(REQUIRED_LOGS.cbegin(), REQUIRED_LOGS.cend());
+  m_blockList = std::set<std::string>(blockList.cbegin(), blockList.cend());
+
   std::string entry_name = getPropertyValue("NXentryName");
   // Find the entry name to use (normally "entry" for SNS, "raw_data_1" for
   // ISIS) if entry name is empty
@@ -505,17 +525,34 @@ void LoadNexusLogs::loadLogs(
   for (std::map<std::string, std::string>::const_iterator itr = entries.begin();
        itr != iend; ++itr) {
     std::string log_class = itr->second;
+    if (!isLogWanted(itr->first)) {
+      g_log.debug() << "Skipping log " << itr->first << "\n";
+      continue;
+    }
     if (log_class == "NXlog" || log_class == "NXpositioner") {
       loadNXLog(file, itr->first, log_class, workspace);
     } else if (log_class == "IXseblock") {
       loadSELog(file, itr->first, workspace);
     }
   }
-  loadVetoPulses(file, workspace);
+  if (isLogWanted("veto_pulse_time"))
+    loadVetoPulses(file, workspace);
 
   file.closeGroup();
 }
 
+/**
+ * Whether a log should be read, according to the AllowList and BlockList
+ * properties
+ * @param name :: The name of the log entry in the file
+ * @returns True if the log should be loaded
+ */
+bool LoadNexusLogs::isLogWanted(const std::string &name) const {
+  if (m_blockList.count(name) > 0)
+    return false;
+  return m_allowList.empty() || m_allowList.count(name) > 0;
+}
+
 /**
  * Load an NX log entry a group type that has value and time entries.
  * @param file :: A reference to the NeXus file handle opened at the parent
@@ -747,15 +784,13 @@ LoadNexusLogs::createTimeSeries(::NeXus::File &file,
         values.begin(), values.end(),
         [&](const char &c) { return isControlValue(c, prop_name, g_log); },
         ' ');
-    auto tsp = new TimeSeriesProperty<std::string>(prop_name);
-    std::vector<DateAndTime> times;
-    DateAndTime::createVector(start_time, time_double, times);
-    const size_t ntimes = times.size();
-    for (size_t i = 0; i < ntimes; ++i) {
-      std::string value_i =
-          std::string(values.data() + i * item_length, item_length);
-      tsp->addValue(times[i], value_i);
+    std::vector<std::string> value_strings;
+    value_strings.reserve(time_double.size());
+    for (size_t i = 0; i < time_double.size(); ++i) {
+      value_strings.emplace_back(values.data() + i * item_length, item_length);
     }
+    auto tsp = new TimeSeriesProperty<std::string>(prop_name);
+    tsp->create(start_time, time_double, value_strings);
     tsp->setUnits(value_units);
     g_log.debug() << "   done reading \"value\" array\n";
     return tsp;
@@ -62,6 +62,9 @@ namespace {
 // Helper typedef
 using IntArray_shared = boost::shared_array<int>;
 
+// The number of values of a histogram dataset to read at once
+constexpr int VALUES_PER_BLOCK = 1 << 20;
+
 // Struct to contain spectrum information.
 struct SpectraInfo {
   // Number of spectra
@@ -1315,7 +1318,8 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
                          "last value will be dropped.\n";
   }
 
-  int blocksize = 8;
+  // Read blocks of many spectra at once, filling each in parallel
+  int blocksize = std::max(1, VALUES_PER_BLOCK / std::max(nchannels, 1));
   // const int fullblocks = nspectra / blocksize;
   // size of the workspace
   // have to cast down to int as later functions require ints
@@ -1338,7 +1342,7 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
         read_stop = (fullblocks * blocksize) + m_spec_min - 1;
 
         if (interval_specs < blocksize) {
-          blocksize = static_cast<int>(total_specs);
+          blocksize = interval_specs;
           read_stop = m_spec_max - 1;
         }
         hist_index = m_spec_min - 1;
@@ -1921,33 +1925,27 @@ void LoadNexusProcessed::loadBlock(NXDataSetTyped<double> &data,
     xErrors_end = xErrors_start + dx_increment;
   }
 
-  int final(hist + blocksize);
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(hist);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(hist);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
+  PARALLEL_FOR_IF(Kernel::threadSafe(*local_workspace))
+  for (int i = 0; i < blocksize; ++i) {
+    const int index = hist + i;
+    auto &Y = local_workspace->mutableY(index);
+    Y.assign(data_start + i * nchannels, data_end + i * nchannels);
+    auto &E = local_workspace->mutableE(index);
+    E.assign(err_start + i * nchannels, err_end + i * nchannels);
     if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(hist);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
+      MantidVec &F = rb_workspace->dataF(index);
+      F.assign(farea_start + i * nchannels, farea_end + i * nchannels);
     }
     if (hasXErrors) {
       local_workspace->setSharedDx(
-          hist, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start,
-                                                             xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
+          index, Kernel::make_cow<HistogramData::HistogramDx>(
+                     xErrors_start + i * dx_input_increment,
+                     xErrors_end + i * dx_input_increment));
     }
 
-    local_workspace->setSharedX(hist, m_xbins.cowData());
-    ++hist;
+    local_workspace->setSharedX(index, m_xbins.cowData());
   }
+  hist += blocksize;
 }
 
 /**
@@ -2004,33 +2002,27 @@ void LoadNexusProcessed::loadBlock(NXDataSetTyped<double> &data,
     xErrors_end = xErrors_start + dx_increment;
   }
 
-  int final(hist + blocksize);
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(wsIndex);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(wsIndex);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
+  PARALLEL_FOR_IF(Kernel::threadSafe(*local_workspace))
+  for (int i = 0; i < blocksize; ++i) {
+    const int index = wsIndex + i;
+    auto &Y = local_workspace->mutableY(index);
+    Y.assign(data_start + i * nchannels, data_end + i * nchannels);
+    auto &E = local_workspace->mutableE(index);
+    E.assign(err_start + i * nchannels, err_end + i * nchannels);
     if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(wsIndex);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
+      MantidVec &F = rb_workspace->dataF(index);
+      F.assign(farea_start + i * nchannels, farea_end + i * nchannels);
     }
     if (hasXErrors) {
       local_workspace->setSharedDx(
-          wsIndex, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start,
-                                                                xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
+          index, Kernel::make_cow<HistogramData::HistogramDx>(
+                     xErrors_start + i * dx_input_increment,
+                     xErrors_end + i * dx_input_increment));
     }
-    local_workspace->setSharedX(wsIndex, m_xbins.cowData());
-    ++hist;
-    ++wsIndex;
+    local_workspace->setSharedX(index, m_xbins.cowData());
   }
+  hist += blocksize;
+  wsIndex += blocksize;
 }
 
 /**
@@ -2085,7 +2077,6 @@ void LoadNexusProcessed::loadBlock(NXDataSetTyped<double> &data,
   const int nxbins(xbins.dim1());
   double *xbin_start = xbins();
   double *xbin_end = xbin_start + nxbins;
-  int final(hist + blocksize);
 
   if (hasXErrors) {
     xErrors.load(blocksize, hist);
@@ -2093,35 +2084,28 @@ void LoadNexusProcessed::loadBlock(NXDataSetTyped<double> &data,
     xErrors_end = xErrors_start + dx_increment;
   }
 
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(wsIndex);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(wsIndex);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
+  PARALLEL_FOR_IF(Kernel::threadSafe(*local_workspace))
+  for (int i = 0; i < blocksize; ++i) {
+    const int index = wsIndex + i;
+    auto &Y = local_workspace->mutableY(index);
+    Y.assign(data_start + i * nchannels, data_end + i * nchannels);
+    auto &E = local_workspace->mutableE(index);
+    E.assign(err_start + i * nchannels, err_end + i * nchannels);
     if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(wsIndex);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
+      MantidVec &F = rb_workspace->dataF(index);
+      F.assign(farea_start + i * nchannels, farea_end + i * nchannels);
     }
     if (hasXErrors) {
       local_workspace->setSharedDx(
-          wsIndex, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start,
-                                                                xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
+          index, Kernel::make_cow<HistogramData::HistogramDx>(
+                     xErrors_start + i * dx_input_increment,
+                     xErrors_end + i * dx_input_increment));
     }
-    auto &X = local_workspace->mutableX(wsIndex);
-    X.assign(xbin_start, xbin_end);
-    xbin_start += nxbins;
-    xbin_end += nxbins;
-    ++hist;
-    ++wsIndex;
+    auto &X = local_workspace->mutableX(index);
+    X.assign(xbin_start + i * nxbins, xbin_end + i * nxbins);
   }
+  hist += blocksize;
+  wsIndex += blocksize;
 }
 
 /**
@@ -6,6 +6,8 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "isisraw2.h"
 #include "byte_rel_comp.h"
+#include <algorithm>
+#include <climits>
 #include <cstdio>
 #include <exception>
 
@@ -20,7 +22,8 @@ Mantid::Kernel::Logger g_log("ISISRAW2");
 
 /// No arg Constructor
 ISISRAW2::ISISRAW2()
-    : ISISRAW(nullptr, false), ndes(0), outbuff(nullptr), m_bufferSize(0) {
+    : ISISRAW(nullptr, false), ndes(0), outbuff(nullptr), m_bufferSize(0),
+      m_nextData(0) {
   // Determine the size of the output buffer to create from the config service.
   g_log.debug("Determining ioRaw buffer size\n");
   auto bufferSizeConfigVal =
@@ -124,6 +127,12 @@ int ISISRAW2::ioRAW(FILE *file, bool from_file, bool read_data) {
   outbuff = new char[m_bufferSize];
   ndes = t_nper * (t_nsp1 + 1);
   ISISRAW::ioRAW(file, &ddes, ndes, true);
+  // The compressed spectra follow each other from here
+  m_dataOffsets.assign(1, 0);
+  m_dataOffsets.reserve(ndes + 1);
+  for (int i = 0; i < ndes; ++i)
+    m_dataOffsets.push_back(m_dataOffsets.back() + 4 * int64_t(ddes[i].nwords));
+  m_nextData = 0;
   dat1 = new uint32_t[t_ntc1 + 1]; //  space for just one spectrum
   memset(outbuff, 0,
          m_bufferSize); // so when we round up words we get a zero written
@@ -141,6 +150,7 @@ void ISISRAW2::skipData(FILE *file, int i) {
       g_log.warning() << "Failed to skip data from file, with value: " << i
                       << "\n";
     }
+    m_nextData = i + 1;
   }
 }
 
@@ -160,12 +170,60 @@ bool ISISRAW2::readData(FILE *file, int i) {
                               "\"loadraw.readbuffer.size\" user property.");
   }
   int res = ISISRAW::ioRAW(file, outbuff, nwords, true);
+  m_nextData = i + 1;
   if (res != 0)
     return false;
   byte_rel_expn(outbuff, nwords, 0, reinterpret_cast<int *>(dat1), t_ntc1 + 1);
   return true;
 }
 
+/// Read the compressed data of a spectrum, seeking to it from wherever the
+/// file is within the data, so that the spectra in between are not read
+/// @param file :: The file pointer
+/// @param i :: The spectrum to read
+/// @param buffer :: Set to the compressed data
+/// @return true on success
+bool ISISRAW2::readCompressedData(FILE *file, int i,
+                                  std::vector<char> &buffer) {
+  if (i >= ndes || !seekData(file, i))
+    return false;
+  const int nbytes = 4 * ddes[i].nwords;
+  buffer.resize(nbytes);
+  const int res = ISISRAW::ioRAW(file, buffer.data(), nbytes, true);
+  m_nextData = i + 1;
+  return res == 0;
+}
+
+/// Decompress the data of a spectrum read by readCompressedData. This does not
+/// use the buffers of the reader, so spectra can be expanded in parallel.
+/// @param buffer :: The compressed data
+/// @param data :: Space for the t_ntc1 + 1 counts of the spectrum
+void ISISRAW2::expandData(std::vector<char> &buffer, uint32_t *data) const {
+  byte_rel_expn(buffer.data(), static_cast<int>(buffer.size()), 0,
+                reinterpret_cast<int *>(data), t_ntc1 + 1);
+}
+
+/// Move the file from the spectrum it is at to the start of another one
+/// @param file :: The file pointer
+/// @param i :: The spectrum to move to
+/// @return true on success
+bool ISISRAW2::seekData(FILE *file, int i) {
+  auto distance = m_dataOffsets[i] - m_dataOffsets[m_nextData];
+  // Seek in steps that fit a long everywhere
+  while (distance != 0) {
+    const auto step = std::max<int64_t>(std::min<int64_t>(distance, INT_MAX),
+                                        -int64_t(INT_MAX));
+    if (fseek(file, static_cast<long>(step), SEEK_CUR) != 0) {
+      g_log.warning() << "Failed to seek to data in file, with value: " << i
+                      << "\n";
+      return false;
+    }
+    distance -= step;
+  }
+  m_nextData = i;
+  return true;
+}
+
 ISISRAW2::~ISISRAW2() {
   // fclose(m_file);
   if (outbuff)
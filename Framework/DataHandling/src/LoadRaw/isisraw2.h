@@ -9,6 +9,9 @@
 
 #include "isisraw.h"
 
+#include <cstdint>
+#include <vector>
+
 /// isis raw file.
 //  isis raw
 class ISISRAW2 : public ISISRAW {
@@ -20,12 +23,20 @@ public:
 
   void skipData(FILE *file, int i);
   bool readData(FILE *file, int i);
+  bool readCompressedData(FILE *file, int i, std::vector<char> &buffer);
+  void expandData(std::vector<char> &buffer, uint32_t *data) const;
   void clear();
 
   int ndes; ///< ndes
 private:
+  bool seekData(FILE *file, int i);
+
   char *outbuff; ///< output buffer
   int m_bufferSize;
+  /// The offsets in bytes of the compressed spectra from the first one
+  std::vector<int64_t> m_dataOffsets;
+  /// The spectrum at the file position
+  int m_nextData;
 };
 
 #endif /* ISISRAW2_H */
@@ -17,6 +17,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/UnitFactory.h"
 
 #include <Poco/Path.h>
@@ -209,12 +210,8 @@ void LoadRaw3::exec() {
   // separate workspace
 
   for (int period = 0; period < m_numberOfPeriods; ++period) {
-    // skipping the first spectra in each period
-    skipData(file, static_cast<int>(period * (m_numberOfSpectra + 1)));
-
-    // check for excluded periods
+    // check for excluded periods, which are never read
     if (!isPeriodIncluded(period)) {
-      skipPeriod(file, period);
       continue;
     }
 
@@ -312,44 +309,24 @@ void LoadRaw3::exec() {
 void LoadRaw3::excludeMonitors(FILE *file, const int &period,
                                const std::vector<specnum_t> &monitorList,
                                DataObjects::Workspace2D_sptr ws_sptr) {
-  int64_t histCurrent = -1;
+  std::vector<SpectrumToLoad> spectra;
   int64_t wsIndex = 0;
-  auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
   // loop through the spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
     specnum_t histToRead = i + period * (m_numberOfSpectra + 1);
     if ((i >= m_spec_min && i < m_spec_max) ||
         (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
                        m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
       // skip monitor spectrum
       if (isMonitor(monitorList, i)) {
-        skipData(file, histToRead);
         continue;
       }
-
-      // read spectrum
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // set the workspace data
-      setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes,
-                       m_lengthIn, 1);
+      spectra.push_back({histToRead, i, ws_sptr, wsIndex});
       // increment workspace index
       ++wsIndex;
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(static_cast<double>(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
-    } // end of if loop for spec min,max check
-    else {
-      skipData(file, histToRead);
     }
-  } // end of for loop
+  }
+  loadSpectra(file, spectra);
 }
 
 /**This method creates outputworkspace including monitors
@@ -359,39 +336,19 @@ void LoadRaw3::excludeMonitors(FILE *file, const int &period,
  */
 void LoadRaw3::includeMonitors(FILE *file, const int64_t &period,
                                DataObjects::Workspace2D_sptr ws_sptr) {
-
-  int64_t histCurrent = -1;
+  std::vector<SpectrumToLoad> spectra;
   int64_t wsIndex = 0;
-  auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
   // loop through spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
     int64_t histToRead = i + period * (m_numberOfSpectra + 1);
     if ((i >= m_spec_min && i < m_spec_max) ||
         (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
                        m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-
-      // read spectrum from raw file
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // set workspace data
-      setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes,
-                       m_lengthIn, 1);
+      spectra.push_back({histToRead, i, ws_sptr, wsIndex});
       ++wsIndex;
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(double(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
-    } else {
-      skipData(file, histToRead);
     }
   }
-  // loadSpectra(file,period,m_total_specs,ws_sptr,m_timeChannelsVec);
+  loadSpectra(file, spectra);
 }
 
 /** This method separates monitors and creates two outputworkspaces
@@ -406,56 +363,71 @@ void LoadRaw3::separateMonitors(FILE *file, const int64_t &period,
                                 const std::vector<specnum_t> &monitorList,
                                 DataObjects::Workspace2D_sptr ws_sptr,
                                 DataObjects::Workspace2D_sptr mws_sptr) {
-  int64_t histCurrent = -1;
+  std::vector<SpectrumToLoad> spectra;
   int64_t wsIndex = 0;
   int64_t mwsIndex = 0;
-  auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
   // loop through spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
     int64_t histToRead = i + period * (m_numberOfSpectra + 1);
     if ((i >= m_spec_min && i < m_spec_max) ||
         (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
                        m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-
-      // read spectrum from raw file
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
       // if this a monitor  store that spectrum to monitor workspace
       if (isMonitor(monitorList, i)) {
-        setWorkspaceData(mws_sptr, m_timeChannelsVec, mwsIndex, i,
-                         m_noTimeRegimes, m_lengthIn, 1);
+        spectra.push_back({histToRead, i, mws_sptr, mwsIndex});
         ++mwsIndex;
       } else {
         // not a monitor,store the spectrum to normal output workspace
-        setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i,
-                         m_noTimeRegimes, m_lengthIn, 1);
+        spectra.push_back({histToRead, i, ws_sptr, wsIndex});
         ++wsIndex;
       }
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(static_cast<double>(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
-    } else {
-      skipData(file, histToRead);
     }
   }
+  loadSpectra(file, spectra);
 }
 
 /**
- * Skip all spectra in a period.
+ * Read the spectra of a period in blocks. The compressed data of a block is
+ * read in file order, skipping the spectra which are not loaded, and is then
+ * decompressed into the workspaces in parallel.
  * @param file :: -pointer to file
- * @param period :: period number
+ * @param spectra :: the spectra to load, in file order
  */
-void LoadRaw3::skipPeriod(FILE *file, const int64_t &period) {
-  for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    int64_t histToRead = i + period * (m_numberOfSpectra + 1);
-    skipData(file, histToRead);
+void LoadRaw3::loadSpectra(FILE *file,
+                           const std::vector<SpectrumToLoad> &spectra) {
+  const size_t blockSize = 1024;
+  const auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
+  const auto nCounts = static_cast<size_t>(isisRaw().t_ntc1 + 1);
+  std::vector<std::vector<char>> compressed(
+      std::min(blockSize, spectra.size()));
+  for (size_t first = 0; first < spectra.size(); first += blockSize) {
+    const auto size = std::min(blockSize, spectra.size() - first);
+    progress(m_prog, "Reading raw file data...");
+    for (size_t i = 0; i < size; ++i) {
+      const auto hist = static_cast<int>(spectra[first + i].hist);
+      if (!isisRaw().readCompressedData(file, hist, compressed[i])) {
+        throw std::runtime_error("Error reading raw file");
+      }
+    }
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(size); ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      const auto &spectrum = spectra[first + i];
+      std::vector<uint32_t> counts(nCounts);
+      isisRaw().expandData(compressed[i], counts.data());
+      // set the workspace data
+      setWorkspaceData(spectrum.workspace, m_timeChannelsVec,
+                       spectrum.wsIndex, spectrum.specNum, m_noTimeRegimes,
+                       m_lengthIn, 1, counts.data());
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+
+    if (m_numberOfPeriods == 1) {
+      setProg(static_cast<double>(first + size) / histTotal);
+      interruption_point();
+    }
   }
 }
 
@@ -406,12 +406,33 @@ void LoadRawHelper::setWorkspaceData(
         &timeChannelsVec,
     int64_t wsIndex, specnum_t nspecNum, int64_t noTimeRegimes,
     int64_t lengthIn, int64_t binStart) {
+  setWorkspaceData(newWorkspace, timeChannelsVec, wsIndex, nspecNum,
+                   noTimeRegimes, lengthIn, binStart, isisRaw().dat1);
+}
+
+/** This method sets decompressed spectrum data to workspace vectors. It may be
+ *  called in parallel for different workspace indices.
+ *  @param newWorkspace ::  shared pointer to the  workspace
+ *  @param timeChannelsVec ::  vector holding the X data
+ *  @param  wsIndex  variable used for indexing the output workspace
+ *  @param  nspecNum  spectrum number
+ *  @param noTimeRegimes ::   regime no.
+ *  @param lengthIn :: length of the workspace
+ *  @param binStart :: start of bin
+ *  @param counts :: the decompressed counts of the spectrum
+ */
+void LoadRawHelper::setWorkspaceData(
+    DataObjects::Workspace2D_sptr newWorkspace,
+    const std::vector<boost::shared_ptr<HistogramData::HistogramX>>
+        &timeChannelsVec,
+    int64_t wsIndex, specnum_t nspecNum, int64_t noTimeRegimes,
+    int64_t lengthIn, int64_t binStart, const uint32_t *counts) {
   if (!newWorkspace)
     return;
 
   // But note that the last (overflow) bin is kept
   auto &Y = newWorkspace->mutableY(wsIndex);
-  Y.assign(isisRaw().dat1 + binStart, isisRaw().dat1 + lengthIn);
+  Y.assign(counts + binStart, counts + lengthIn);
   // Fill the vector for the errors, containing sqrt(count)
   newWorkspace->setCountVariances(wsIndex, Y.rawData());
 
@@ -433,7 +454,7 @@ void LoadRawHelper::setWorkspaceData(
 
     // Use std::vector::at just incase spectrum missing from spec array
     newWorkspace->setX(wsIndex,
-                       timeChannelsVec.at(m_specTimeRegimes[nspecNum] - 1));
+                       timeChannelsVec.at(m_specTimeRegimes.at(nspecNum) - 1));
   }
 }
 
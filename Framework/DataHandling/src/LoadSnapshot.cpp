@@ -0,0 +1,353 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataHandling/LoadSnapshot.h"
+#include "MantidAPI/BinEdgeAxis.h"
+#include "MantidAPI/FileProperty.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/NumericAxis.h"
+#include "MantidAPI/Progress.h"
+#include "MantidAPI/RegisterFileLoader.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/TextAxis.h"
+#include "MantidDataHandling/SnapshotFormat.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/OptionalBool.h"
+#include "MantidKernel/PropertyWithValue.h"
+#include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidKernel/UnitFactory.h"
+
+#include <fstream>
+
+namespace Mantid {
+namespace DataHandling {
+
+using namespace Kernel;
+using namespace API;
+using namespace DataObjects;
+using namespace HistogramData;
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+
+DECLARE_FILELOADER_ALGORITHM(LoadSnapshot)
+
+namespace {
+std::vector<DateAndTime> readTimes(std::istream &in) {
+  const auto nanoseconds = Snapshot::readArray<int64_t>(in);
+  return std::vector<DateAndTime>(nanoseconds.begin(), nanoseconds.end());
+}
+
+std::vector<std::string> readStrings(std::istream &in) {
+  std::vector<std::string> values(Snapshot::read<uint64_t>(in));
+  for (auto &value : values)
+    value = Snapshot::readString(in);
+  return values;
+}
+
+template <typename T>
+std::unique_ptr<Property> makeSeries(const std::string &name,
+                                     const std::vector<DateAndTime> &times,
+                                     const std::vector<T> &values) {
+  auto series = std::make_unique<TimeSeriesProperty<T>>(name);
+  series->addValues(times, values);
+  return std::move(series);
+}
+
+void readEvents(std::istream &in, EventList &eventList) {
+  const auto type = static_cast<EventType>(Snapshot::read<uint8_t>(in));
+  eventList.switchTo(type);
+  switch (type) {
+  case EventType::WEIGHTED:
+    Snapshot::readArray(in, eventList.getWeightedEvents());
+    break;
+  case EventType::WEIGHTED_NOTIME:
+    Snapshot::readArray(in, eventList.getWeightedEventsNoTime());
+    break;
+  default:
+    Snapshot::readArray(in, eventList.getEvents());
+  }
+}
+} // namespace
+
+/**
+ * Return the confidence with with this algorithm can load the file
+ * @param descriptor A descriptor for the file
+ * @returns 90 for snapshot files, otherwise 0
+ */
+int LoadSnapshot::confidence(Kernel::FileDescriptor &descriptor) const {
+  char magic[sizeof(Snapshot::MAGIC)] = {};
+  descriptor.data().read(magic, sizeof(magic));
+  const bool isSnapshot = descriptor.data() &&
+                          std::memcmp(magic, Snapshot::MAGIC, sizeof(magic)) ==
+                              0;
+  descriptor.resetStreamToStart();
+  return isSnapshot ? 90 : 0;
+}
+
+void LoadSnapshot::init() {
+  declareProperty(std::make_unique<FileProperty>("Filename", "",
+                                                 FileProperty::Load, ".snap"),
+                  "The name of the snapshot file to read.");
+  declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "OutputWorkspace", "", Direction::Output),
+                  "The workspace loaded from the file.");
+}
+
+void LoadSnapshot::exec() {
+  const std::string filename = getPropertyValue("Filename");
+  std::ifstream in(filename, std::ios::binary);
+  char magic[sizeof(Snapshot::MAGIC)] = {};
+  in.read(magic, sizeof(magic));
+  if (!in || std::memcmp(magic, Snapshot::MAGIC, sizeof(magic)) != 0)
+    throw std::invalid_argument(filename + " is not a snapshot file");
+  const auto version = Snapshot::read<uint32_t>(in);
+  if (version > Snapshot::VERSION)
+    throw std::invalid_argument(
+        filename + " was written by a newer version of SaveSnapshot");
+  if (Snapshot::read<uint32_t>(in) != Snapshot::BYTE_ORDER_MARK)
+    throw std::invalid_argument(filename +
+                                " was written with another byte order");
+  const auto kind = Snapshot::read<Snapshot::Kind>(in);
+  const auto tofEventSize = Snapshot::read<uint32_t>(in);
+  const auto weightedEventSize = Snapshot::read<uint32_t>(in);
+  const auto weightedNoTimeEventSize = Snapshot::read<uint32_t>(in);
+  if (tofEventSize != sizeof(TofEvent) ||
+      weightedEventSize != sizeof(WeightedEvent) ||
+      weightedNoTimeEventSize != sizeof(WeightedEventNoTime))
+    throw std::invalid_argument(filename +
+                                " was written with other event layouts");
+  const auto numberHistograms =
+      static_cast<size_t>(Snapshot::read<uint64_t>(in));
+  Snapshot::check(in, filename);
+
+  MatrixWorkspace_sptr ws;
+  EventWorkspace_sptr eventWS;
+  if (kind == Snapshot::Kind::EventWorkspace) {
+    eventWS = boost::make_shared<EventWorkspace>();
+    ws = eventWS;
+  } else {
+    ws = boost::make_shared<Workspace2D>();
+  }
+  ws->initialize(numberHistograms, 2, 1);
+  readMetadata(in, ws);
+
+  Kernel::cow_ptr<HistogramX> commonX(nullptr);
+  if (Snapshot::read<uint8_t>(in))
+    commonX = make_cow<HistogramX>(Snapshot::readArray<double>(in));
+  const auto offsets = Snapshot::readArray<uint64_t>(in);
+  Snapshot::check(in, filename);
+  if (offsets.size() != numberHistograms + 1)
+    throw std::runtime_error(filename + " is corrupt");
+  const std::streamoff dataStart = in.tellg();
+  in.close();
+
+  const auto yMode = ws->isDistribution() ? Histogram::YMode::Frequencies
+                                          : Histogram::YMode::Counts;
+  // Each thread reads the blocks of a contiguous range of spectra through its
+  // own stream
+  const int numberChunks = static_cast<int>(std::max<size_t>(
+      std::min<size_t>(PARALLEL_GET_MAX_THREADS, numberHistograms), 1));
+  Progress progress(this, 0.0, 1.0, numberHistograms);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int chunk = 0; chunk < numberChunks; ++chunk) {
+    PARALLEL_START_INTERUPT_REGION
+    const size_t first = numberHistograms * chunk / numberChunks;
+    const size_t last = numberHistograms * (chunk + 1) / numberChunks;
+    std::ifstream chunkIn(filename, std::ios::binary);
+    chunkIn.seekg(dataStart + static_cast<std::streamoff>(offsets[first]));
+    for (size_t i = first; i < last; ++i) {
+      const auto flags = Snapshot::read<uint8_t>(chunkIn);
+      auto x = commonX;
+      if (!(flags & Snapshot::SharedX) || !x)
+        x = make_cow<HistogramX>(Snapshot::readArray<double>(chunkIn));
+      if (eventWS) {
+        auto &eventList = *eventWS->getSpectrumUnsafe(i);
+        readEvents(chunkIn, eventList);
+        eventList.setX(x);
+      } else {
+        auto y = Snapshot::readArray<double>(chunkIn);
+        const auto xMode = x->size() == y.size() + 1
+                               ? Histogram::XMode::BinEdges
+                               : Histogram::XMode::Points;
+        Histogram histogram(xMode, yMode);
+        histogram.setX(x);
+        histogram.setSharedY(make_cow<HistogramY>(std::move(y)));
+        histogram.setSharedE(
+            make_cow<HistogramE>(Snapshot::readArray<double>(chunkIn)));
+        if (flags & Snapshot::HasDx)
+          histogram.setSharedDx(
+              make_cow<HistogramDx>(Snapshot::readArray<double>(chunkIn)));
+        ws->setHistogram(i, std::move(histogram));
+      }
+      Snapshot::check(chunkIn, filename);
+      progress.report();
+    }
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  setProperty("OutputWorkspace", ws);
+}
+
+/// Read everything but the data of the spectra into the workspace
+void LoadSnapshot::readMetadata(std::istream &in,
+                                const MatrixWorkspace_sptr &ws) {
+  ws->setTitle(Snapshot::readString(in));
+  ws->setYUnit(Snapshot::readString(in));
+  ws->setYUnitLabel(Snapshot::readString(in));
+  ws->setDistribution(Snapshot::read<uint8_t>(in) != 0);
+  const auto xUnit = Snapshot::readString(in);
+  if (!xUnit.empty())
+    ws->getAxis(0)->unit() = UnitFactory::Instance().create(xUnit);
+
+  readLogs(in, *ws);
+
+  const auto instrumentName = Snapshot::readString(in);
+  const auto instrumentXml = Snapshot::readString(in);
+  const auto parameters = Snapshot::readString(in);
+  loadInstrument(ws, instrumentName, instrumentXml);
+  ws->readParameterMap(parameters);
+
+  const auto positions = Snapshot::readArray<double>(in);
+  const auto rotations = Snapshot::readArray<double>(in);
+  const auto masks = Snapshot::readArray<uint8_t>(in);
+  auto &detectorInfo = ws->mutableDetectorInfo();
+  if (masks.size() == detectorInfo.size()) {
+    for (size_t i = 0; i < masks.size(); ++i) {
+      detectorInfo.setPosition(i, V3D(positions[3 * i], positions[3 * i + 1],
+                                      positions[3 * i + 2]));
+      detectorInfo.setRotation(i, Quat(rotations[4 * i], rotations[4 * i + 1],
+                                       rotations[4 * i + 2],
+                                       rotations[4 * i + 3]));
+      detectorInfo.setMasked(i, masks[i] != 0);
+    }
+  } else if (!masks.empty()) {
+    g_log.warning("The instrument does not match the detectors saved in the "
+                  "snapshot. Their positions and masks are not restored.\n");
+  }
+
+  const size_t numberHistograms = ws->getNumberHistograms();
+  const auto axisKind = Snapshot::read<Snapshot::AxisKind>(in);
+  if (axisKind == Snapshot::AxisKind::Numeric ||
+      axisKind == Snapshot::AxisKind::BinEdge) {
+    const auto unit = Snapshot::readString(in);
+    const auto values = Snapshot::readArray<double>(in);
+    std::unique_ptr<Axis> axis;
+    if (axisKind == Snapshot::AxisKind::BinEdge)
+      axis = std::make_unique<BinEdgeAxis>(values);
+    else
+      axis = std::make_unique<NumericAxis>(values);
+    if (!unit.empty())
+      axis->unit() = UnitFactory::Instance().create(unit);
+    ws->replaceAxis(1, std::move(axis));
+  } else if (axisKind == Snapshot::AxisKind::Text) {
+    const auto labels = readStrings(in);
+    auto axis = std::make_unique<TextAxis>(labels.size());
+    for (size_t i = 0; i < labels.size(); ++i)
+      axis->setLabel(i, labels[i]);
+    ws->replaceAxis(1, std::move(axis));
+  }
+
+  const auto spectrumNumbers = Snapshot::readArray<int32_t>(in);
+  const auto detectorCounts = Snapshot::readArray<uint64_t>(in);
+  const auto detectorIDs = Snapshot::readArray<int32_t>(in);
+  if (spectrumNumbers.size() != numberHistograms ||
+      detectorCounts.size() != numberHistograms)
+    throw std::runtime_error("The spectra of the snapshot are corrupt");
+  auto nextID = detectorIDs.cbegin();
+  for (size_t i = 0; i < numberHistograms; ++i) {
+    auto &spectrum = ws->getSpectrum(i);
+    spectrum.setSpectrumNo(spectrumNumbers[i]);
+    const auto endID = nextID + static_cast<std::ptrdiff_t>(detectorCounts[i]);
+    spectrum.setDetectorIDs(std::set<detid_t>(nextID, endID));
+    nextID = endID;
+  }
+
+  const auto maskedIndices = Snapshot::readArray<uint64_t>(in);
+  const auto maskedBins = Snapshot::readArray<uint64_t>(in);
+  const auto maskWeights = Snapshot::readArray<double>(in);
+  for (size_t i = 0; i < maskedIndices.size(); ++i)
+    ws->flagMasked(maskedIndices[i], maskedBins[i], maskWeights[i]);
+}
+
+/// Read the logs of the run
+void LoadSnapshot::readLogs(std::istream &in, MatrixWorkspace &ws) const {
+  auto &run = ws.mutableRun();
+  const auto numberLogs = Snapshot::read<uint64_t>(in);
+  for (uint64_t i = 0; i < numberLogs; ++i) {
+    const auto kind = Snapshot::read<Snapshot::LogKind>(in);
+    const auto name = Snapshot::readString(in);
+    const auto units = Snapshot::readString(in);
+    std::unique_ptr<Property> log;
+    switch (kind) {
+    case Snapshot::LogKind::DoubleSeries: {
+      const auto times = readTimes(in);
+      log = makeSeries(name, times, Snapshot::readArray<double>(in));
+      break;
+    }
+    case Snapshot::LogKind::IntSeries: {
+      const auto times = readTimes(in);
+      const auto values = Snapshot::readArray<int32_t>(in);
+      log = makeSeries(name, times,
+                       std::vector<int>(values.begin(), values.end()));
+      break;
+    }
+    case Snapshot::LogKind::BoolSeries: {
+      const auto times = readTimes(in);
+      const auto values = Snapshot::readArray<uint8_t>(in);
+      log = makeSeries(name, times,
+                       std::vector<bool>(values.begin(), values.end()));
+      break;
+    }
+    case Snapshot::LogKind::StringSeries: {
+      const auto times = readTimes(in);
+      log = makeSeries(name, times, readStrings(in));
+      break;
+    }
+    case Snapshot::LogKind::Double:
+      log = std::make_unique<PropertyWithValue<double>>(
+          name, Snapshot::read<double>(in));
+      break;
+    case Snapshot::LogKind::Int:
+      log = std::make_unique<PropertyWithValue<int>>(
+          name, Snapshot::read<int32_t>(in));
+      break;
+    default:
+      log = std::make_unique<PropertyWithValue<std::string>>(
+          name, Snapshot::readString(in));
+    }
+    log->setUnits(units);
+    run.addProperty(std::move(log), true);
+  }
+}
+
+/// Load the instrument from the definition saved in the snapshot, or from
+/// the instrument definition file if none was saved
+void LoadSnapshot::loadInstrument(const MatrixWorkspace_sptr &ws,
+                                  const std::string &instrumentName,
+                                  const std::string &instrumentXml) {
+  if (instrumentName.empty())
+    return;
+  auto loadInstrument = createChildAlgorithm("LoadInstrument");
+  try {
+    loadInstrument->setProperty("Workspace", ws);
+    loadInstrument->setPropertyValue("InstrumentName", instrumentName);
+    if (!instrumentXml.empty())
+      loadInstrument->setPropertyValue("InstrumentXML", instrumentXml);
+    loadInstrument->setProperty("RewriteSpectraMap", OptionalBool(false));
+    loadInstrument->execute();
+  } catch (std::exception &e) {
+    g_log.warning() << "Cannot load the instrument " << instrumentName << ": "
+                    << e.what() << '\n';
+  }
+}
+
+} // namespace DataHandling
+} // namespace Mantid
@@ -38,6 +38,7 @@
 #include <Poco/SAX/InputSource.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -337,11 +338,15 @@ std::vector<int> LoadSpice2D::getData(const std::string &dataXpath = "//Data") {
     g_log.debug() << "The size of detector contents (xpath = " << detectorXpath
                   << ") is " << data_str.size() << " bytes." << '\n';
 
-    // convert string data into a vector<int>
-    std::stringstream iss(data_str);
-    double number;
-    while (iss >> number) {
+    // convert string data into a vector<int>, up to the first value that is
+    // not a number
+    data.reserve(totalDataSize);
+    const char *next = data_str.c_str();
+    char *end = nullptr;
+    for (double number = std::strtod(next, &end); end != next;
+         number = std::strtod(next, &end)) {
       data.push_back(static_cast<int>(number));
+      next = end;
     }
     g_log.debug() << "Detector XPath: " << detectorXpath
                   << " parsed. Total size of data processed up to now = "
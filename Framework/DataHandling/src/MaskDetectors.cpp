@@ -17,6 +17,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/MultiThreaded.h"
 #include <algorithm>
 #include <numeric>
 #include <set>
@@ -201,18 +202,26 @@ void MaskDetectors::exec() {
     return;
   }
 
-  // Get a reference to the spectra-detector map to get hold of detector ID's
+  // Each spectrum only needs masking once
+  std::sort(indexList.begin(), indexList.end());
+  indexList.erase(std::unique(indexList.begin(), indexList.end()),
+                  indexList.end());
+
+  // Clearing the data of the spectra is independent for each of them
+  const auto numIndices = static_cast<int64_t>(indexList.size());
+  PARALLEL_FOR_IF(Kernel::threadSafe(*WS))
+  for (int64_t i = 0; i < numIndices; ++i) {
+    WS->getSpectrum(indexList[i]).clearData();
+  }
+  progress(0.5);
+
+  // Setting the mask flags of the detectors is not thread-safe
   auto &spectrumInfo = WS->mutableSpectrumInfo();
-  double prog = 0.0;
   for (const auto i : indexList) {
-    WS->getSpectrum(i).clearData();
     if (spectrumInfo.hasDetectors(i))
       spectrumInfo.setMasked(i, true);
-
-    // Progress
-    prog += (1.0 / static_cast<int>(indexList.size()));
-    progress(prog);
   }
+  progress(1.0);
 
   if (eventWS) {
     // Also clear the MRU for event workspaces.
@@ -7,7 +7,9 @@
 #include "MantidDataHandling/ParallelEventLoader.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidIndexing/GlobalSpectrumIndex.h"
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidParallel/Communicator.h"
 #include "MantidParallel/IO/EventLoader.h"
 #include "MantidTypes/Event/TofEvent.h"
 #include "MantidTypes/SpectrumDefinition.h"
@@ -102,6 +104,23 @@ std::vector<int32_t> getOffsets(const DataObjects::EventWorkspace &ws,
   return offsets;
 }
 
+/// Return the rank of each global spectrum index, or an empty vector if the
+/// spectra of the workspace are partitioned round-robin.
+std::vector<int> spectrumPartitions(const Indexing::IndexInfo &indexInfo) {
+  const auto ranks = indexInfo.communicator().size();
+  const auto size = indexInfo.globalSize();
+  std::vector<int> partitions(size);
+  bool isRoundRobin = true;
+  for (size_t i = 0; i < size; ++i) {
+    partitions[i] = static_cast<int>(
+        indexInfo.partitionOf(Indexing::GlobalSpectrumIndex(i)));
+    isRoundRobin &= partitions[i] == static_cast<int>(i % ranks);
+  }
+  if (isRoundRobin)
+    partitions.clear();
+  return partitions;
+}
+
 /// Load events from given banks into given EventWorkspace using MPI.
 void ParallelEventLoader::loadMPI(DataObjects::EventWorkspace &ws,
                                   const std::string &filename,
@@ -114,7 +133,8 @@ void ParallelEventLoader::loadMPI(DataObjects::EventWorkspace &ws,
       getOffsets(ws, filename, groupName, bankNames, eventIDIsSpectrumNumber);
   Parallel::IO::EventLoader::load(ws.indexInfo().communicator(), filename,
                                   groupName, bankNames, offsets,
-                                  std::move(eventLists));
+                                  std::move(eventLists),
+                                  spectrumPartitions(ws.indexInfo()));
 }
 
 /// Load events from given banks into given EventWorkspace using
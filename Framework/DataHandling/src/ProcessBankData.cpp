@@ -73,32 +73,69 @@ void ProcessBankData::run() { // override {
   size_t my_discarded_events(0);
 
   prog->report(entry_name + ": precount");
-  // ---- Pre-counting events per pixel ID ----
   auto &outputWS = m_loader.m_ws;
   auto *alg = m_loader.alg;
-  if (m_loader.precount) {
 
-    std::vector<size_t> counts(m_max_id - m_min_id + 1, 0);
-    for (size_t i = 0; i < numEvents; i++) {
-      const auto thisId = detid_t(event_id[i]);
-      if (thisId >= m_min_id && thisId <= m_max_id)
-        counts[thisId - m_min_id]++;
+  // Default pulse time (if none are found)
+  const bool pulsetimesincreasing = std::is_sorted(
+      thisBankPulseTimes->pulseTimes,
+      thisBankPulseTimes->pulseTimes + thisBankPulseTimes->numPulses);
+  if (!std::is_sorted(event_index->cbegin(), event_index->cend()))
+    throw std::runtime_error("Event index is not sorted");
+
+  // And there are this many pulses
+  const auto NUM_PULSES = thisBankPulseTimes->numPulses;
+
+  const double TOF_MIN = alg->filter_tof_min;
+  const double TOF_MAX = alg->filter_tof_max;
+
+  // ---- Pre-counting events per pixel ID ----
+  if (m_loader.precount) {
+    // Count the events that will go into each pixel for each period, using
+    // the same selection as the filling loop below, so that each event vector
+    // is allocated once at its final size rather than grown while filling.
+    const size_t numPixels = m_max_id - m_min_id + 1;
+    std::vector<size_t> counts(outputWS.nPeriods() * numPixels, 0);
+    for (std::size_t pulseIndex = getPulseIndex(startAt, 0, event_index);
+         pulseIndex < NUM_PULSES; pulseIndex++) {
+      const auto firstEventIndex = getFirstEventIndex(pulseIndex);
+      if (firstEventIndex > numEvents)
+        break;
+      const auto lastEventIndex = getLastEventIndex(pulseIndex, NUM_PULSES);
+      const int periodIndex =
+          thisBankPulseTimes->periodNumbers[pulseIndex] - 1;
+      auto *periodCounts = counts.data() + periodIndex * numPixels;
+      for (std::size_t eventIndex = firstEventIndex;
+           eventIndex < lastEventIndex; ++eventIndex) {
+        const auto thisId = detid_t(event_id[eventIndex]);
+        const auto tof = static_cast<double>(event_time_of_flight[eventIndex]);
+        if (thisId >= m_min_id && thisId <= m_max_id &&
+            (tof - TOF_MIN) * (tof - TOF_MAX) <= 0.)
+          periodCounts[thisId - m_min_id]++;
+      }
     }
 
     // Now we pre-allocate (reserve) the vectors of events in each pixel
-    // counted
-    const size_t numEventLists = outputWS.getNumberHistograms();
-    for (detid_t pixID = m_min_id; pixID <= m_max_id; pixID++) {
-      if (counts[pixID - m_min_id] > 0) {
-        size_t wi = getWorkspaceIndexFromPixelID(pixID);
-        // Find the the workspace index corresponding to that pixel ID
-        // Allocate it
-        if (wi < numEventLists) {
-          outputWS.reserveEventListAt(wi, counts[pixID - m_min_id]);
+    // counted, on top of any events already loaded from other banks
+    for (size_t period = 0; period < outputWS.nPeriods(); ++period) {
+      const auto *periodCounts = counts.data() + period * numPixels;
+      for (detid_t pixID = m_min_id; pixID <= m_max_id; pixID++) {
+        const size_t count = periodCounts[pixID - m_min_id];
+        if (count == 0)
+          continue;
+        // NULL event vectors indicate a bad spectrum lookup
+        if (have_weight) {
+          auto *eventVector = m_loader.weightedEventVectors[period][pixID];
+          if (eventVector)
+            eventVector->reserve(eventVector->size() + count);
+        } else {
+          auto *eventVector = m_loader.eventVectors[period][pixID];
+          if (eventVector)
+            eventVector->reserve(eventVector->size() + count);
         }
-        if (alg->getCancel())
-          break; // User cancellation
       }
+      if (alg->getCancel())
+        break; // User cancellation
     }
   }
 
@@ -107,28 +144,18 @@ void ProcessBankData::run() { // override {
     return;
   }
 
-  // Default pulse time (if none are found)
-  const bool pulsetimesincreasing = std::is_sorted(
-      thisBankPulseTimes->pulseTimes,
-      thisBankPulseTimes->pulseTimes + thisBankPulseTimes->numPulses);
-  if (!std::is_sorted(event_index->cbegin(), event_index->cend()))
-    throw std::runtime_error("Event index is not sorted");
-
-  // And there are this many pulses
-  const auto NUM_PULSES = thisBankPulseTimes->numPulses;
   prog->report(entry_name + ": filling events");
 
   // Will we need to compress?
   const bool compress = (alg->compressTolerance >= 0);
 
-  // Which detector IDs were touched? - only matters if compress is on
+  // Which detector IDs were touched? - only matters if compress is on, or if
+  // the sort order of the lists has to be reset
+  const bool trackDetIds = compress || !pulsetimesincreasing;
   std::vector<bool> usedDetIds;
-  if (compress)
+  if (trackDetIds)
     usedDetIds.assign(m_max_id - m_min_id + 1, false);
 
-  const double TOF_MIN = alg->filter_tof_min;
-  const double TOF_MAX = alg->filter_tof_max;
-
   for (std::size_t pulseIndex = getPulseIndex(startAt, 0, event_index);
        pulseIndex < NUM_PULSES; pulseIndex++) {
     // Save the pulse time at this index for creating those events
@@ -201,7 +228,7 @@ void ProcessBankData::run() { // override {
 
           // Track all the touched wi (only necessary when compressing events,
           // for thread safety)
-          if (compress)
+          if (trackDetIds)
             usedDetIds[detId - m_min_id] = true;
         } // valid time-of-flight
 
@@ -218,21 +245,23 @@ void ProcessBankData::run() { // override {
   }
 
   //------------ Compress Events (or set sort order) ------------------
-  // Do it on all the detector IDs we touched
-  if (compress) {
+  // Do it on all the detector IDs we touched. The event lists start out
+  // flagged as sorted by pulse time, which holds as long as the pulse times
+  // of the bank are increasing; FilterEvents relies on it to avoid a full
+  // sort.
+  if (trackDetIds) {
     for (detid_t pixID = m_min_id; pixID <= m_max_id; pixID++) {
       if (usedDetIds[pixID - m_min_id]) {
         // Find the the workspace index corresponding to that pixel ID
         size_t wi = getWorkspaceIndexFromPixelID(pixID);
         auto &el = outputWS.getSpectrum(wi);
-        if (compress)
+        if (compress && alg->compressWallClockTolerance == EMPTY_DBL())
           el.compressEvents(alg->compressTolerance, &el);
-        else {
-          if (pulsetimesincreasing)
-            el.setSortOrder(DataObjects::PULSETIME_SORT);
-          else
-            el.setSortOrder(DataObjects::UNSORTED);
-        }
+        else if (compress)
+          el.compressFatEvents(alg->compressTolerance, alg->compressStartTime,
+                               alg->compressWallClockTolerance, &el);
+        else
+          el.setSortOrder(DataObjects::UNSORTED);
       }
     }
   }
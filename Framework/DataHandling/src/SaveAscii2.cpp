@@ -5,6 +5,7 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include <fstream>
+#include <numeric>
 #include <set>
 
 #include "MantidAPI/FileProperty.h"
@@ -15,6 +16,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/TextFormat.h"
 #include "MantidKernel/UnitConversion.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VectorHelper.h"
@@ -247,13 +249,13 @@ void SaveAscii2::exec() {
   }
   // Set the number precision
   int prec = getProperty("Precision");
-  if (prec != EMPTY_INT()) {
-    file.precision(prec);
+  if (prec == EMPTY_INT()) {
+    prec = static_cast<int>(file.precision());
   }
   bool scientific = getProperty("ScientificFormat");
-  if (scientific) {
-    file << std::scientific;
-  }
+  const NumberFormat format(prec, scientific
+                                      ? NumberFormat::Notation::Scientific
+                                      : NumberFormat::Notation::General);
   if (writeHeader) {
     file << comment << " X " << m_sep << " Y " << m_sep << " E";
     if (m_writeDX) {
@@ -265,60 +267,62 @@ void SaveAscii2::exec() {
   if (!m_metaData.empty()) {
     populateAllMetaData();
   }
+  // The spectra are formatted in parallel and written in order
+  std::vector<int> indices(idx.begin(), idx.end());
   if (idx.empty()) {
-    Progress progress(this, 0.0, 1.0, nSpectra);
-    for (int i = 0; i < nSpectra; i++) {
-      writeSpectrum(i, file);
-      progress.report();
-    }
-  } else {
-    Progress progress(this, 0.0, 1.0, idx.size());
-    for (int i : idx) {
-      writeSpectrum(i, file);
-      progress.report();
-    }
+    indices.resize(nSpectra);
+    std::iota(indices.begin(), indices.end(), 0);
   }
+  Progress progress(this, 0.0, 1.0, indices.size());
+  writeInParallel(
+      file, indices.size(),
+      [this, &format, &indices](const size_t i, std::string &text) {
+        formatSpectrum(indices[i], format, text);
+      },
+      [&progress](const size_t) { progress.report(); });
 
-  file.unsetf(std::ios_base::floatfield);
   file.close();
 }
 
-/** Writes a spectrum to the file using a workspace index
+/** Appends the text of a spectrum to a string using a workspace index. This
+ * is called by several threads at once.
  *
  * @param wsIndex :: an integer relating to a workspace index
- * @param file :: the file writer object
+ * @param format :: the format of the values
+ * @param text :: the string to append to
  */
-void SaveAscii2::writeSpectrum(const int &wsIndex, std::ofstream &file) {
+void SaveAscii2::formatSpectrum(const size_t wsIndex,
+                                const NumberFormat &format,
+                                std::string &text) const {
 
   for (auto iter = m_metaData.begin(); iter != m_metaData.end(); ++iter) {
-    auto value = m_metaDataMap[*iter][wsIndex];
-    file << value;
+    text += m_metaDataMap.at(*iter)[wsIndex];
     if (iter != m_metaData.end() - 1) {
-      file << " " << m_sep << " ";
+      text += " " + m_sep + " ";
     }
   }
-  file << '\n';
-
-  auto pointDeltas = m_ws->pointStandardDeviations(0);
-  auto points0 = m_ws->points(0);
-  auto pointsSpec = m_ws->points(wsIndex);
+  text += '\n';
+
+  // checking for ragged workspace
+  const auto points = m_ws->points(m_isCommonBins ? 0 : wsIndex);
+  const auto &y = m_ws->y(wsIndex);
+  const auto &e = m_ws->e(wsIndex);
+  HistogramData::PointStandardDeviations pointDeltas;
+  if (m_writeDX) {
+    pointDeltas = m_ws->pointStandardDeviations(0);
+  }
   for (int bin = 0; bin < m_nBins; bin++) {
-    if (m_isCommonBins) {
-      file << points0[bin];
-    } else // checking for ragged workspace
-    {
-      file << pointsSpec[bin];
-    }
-    file << m_sep;
-    file << m_ws->y(wsIndex)[bin];
+    format.append(text, points[bin]);
+    text += m_sep;
+    format.append(text, y[bin]);
 
-    file << m_sep;
-    file << m_ws->e(wsIndex)[bin];
+    text += m_sep;
+    format.append(text, e[bin]);
     if (m_writeDX) {
-      file << m_sep;
-      file << pointDeltas[bin];
+      text += m_sep;
+      format.append(text, pointDeltas[bin]);
     }
-    file << '\n';
+    text += '\n';
   }
 }
 
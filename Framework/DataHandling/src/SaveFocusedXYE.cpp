@@ -12,6 +12,7 @@
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/TextFormat.h"
 #include "MantidKernel/Unit.h"
 #include <Poco/File.h>
 #include <Poco/Path.h>
@@ -21,6 +22,11 @@
 
 using namespace Mantid::DataHandling;
 
+namespace {
+/// The number of data lines formatted together by a thread
+constexpr size_t LINES_PER_BLOCK = 256;
+} // namespace
+
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(SaveFocusedXYE)
 
@@ -114,6 +120,10 @@ void SaveFocusedXYE::exec() {
   }
 
   const auto &detectorInfo = inputWS->detectorInfo();
+  const Kernel::NumberFormat xFormat(5, Kernel::NumberFormat::Notation::Fixed,
+                                     15);
+  const Kernel::NumberFormat yeFormat(8, Kernel::NumberFormat::Notation::Fixed,
+                                      18);
 
   Progress progress(this, 0.0, 1.0, nHist);
   for (size_t i = 0; i < nHist; i++) {
@@ -175,17 +185,30 @@ void SaveFocusedXYE::exec() {
                          inputWS->getAxis(1)->getValue(i));
     }
     const size_t datasize = Y.size();
-    for (size_t j = 0; j < datasize; j++) {
-      double xvalue(0.0);
-      if (isHistogram) {
-        xvalue = (X[j] + X[j + 1]) / 2.0;
-      } else {
-        xvalue = X[j];
-      }
-      out << std::fixed << std::setprecision(5) << std::setw(15) << xvalue
-          << std::fixed << std::setprecision(8) << std::setw(18) << Y[j]
-          << std::fixed << std::setprecision(8) << std::setw(18) << E[j]
-          << "\n";
+    // The data lines are formatted in parallel, in blocks of lines
+    const size_t nBlocks = (datasize + LINES_PER_BLOCK - 1) / LINES_PER_BLOCK;
+    Kernel::writeInParallel(
+        out, nBlocks,
+        [&](const size_t block, std::string &text) {
+          const size_t end = std::min(datasize, (block + 1) * LINES_PER_BLOCK);
+          for (size_t j = block * LINES_PER_BLOCK; j < end; j++) {
+            double xvalue(0.0);
+            if (isHistogram) {
+              xvalue = (X[j] + X[j + 1]) / 2.0;
+            } else {
+              xvalue = X[j];
+            }
+            xFormat.append(text, xvalue);
+            yeFormat.append(text, Y[j]);
+            yeFormat.append(text, E[j]);
+            text += '\n';
+          }
+        },
+        [](const size_t) {});
+    if (datasize > 0) {
+      // The headers of the following spectra are written with the notation
+      // and precision the data used to leave on the stream
+      out << std::fixed << std::setprecision(8);
     }
     // Close at each iteration
     if (split) {
@@ -18,6 +18,7 @@
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/PhysicalConstants.h"
+#include "MantidKernel/TextFormat.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
@@ -84,6 +85,30 @@ bool isConstantDelta(const HistogramData::BinEdges &xAxis) {
   return true;
 }
 
+/// The number of data lines formatted together by a thread
+constexpr size_t LINES_PER_BLOCK = 256;
+
+/**
+ * Write lines of data to a stream, formatting blocks of lines in parallel
+ * @param out :: The stream to write to
+ * @param nLines :: The number of lines
+ * @param formatLine :: Called with the index of a line and the text to
+ * append the line to
+ */
+template <typename FormatLine>
+void writeLines(std::stringstream &out, const size_t nLines,
+                const FormatLine &formatLine) {
+  const size_t nBlocks = (nLines + LINES_PER_BLOCK - 1) / LINES_PER_BLOCK;
+  Kernel::writeInParallel(
+      out, nBlocks,
+      [&](const size_t block, std::string &text) {
+        const size_t end = std::min(nLines, (block + 1) * LINES_PER_BLOCK);
+        for (size_t i = block * LINES_PER_BLOCK; i < end; ++i)
+          formatLine(i, text);
+      },
+      [](const size_t) {});
+}
+
 std::unique_ptr<std::stringstream> makeStringStream() {
   // This and all unique_ptrs wrapping streams is a workaround
   // for GCC 4.x. The standard allowing streams to be moved was
@@ -825,16 +850,16 @@ void SaveGSS::writeRALF_ALTdata(std::stringstream &out, const int bank,
   // This method calculates the minimum number of lines
   // we need to write to capture all the data for example
   // if we have 6 data entries it will calculate 2 output lines (4 + 2)
-  const int64_t numberOfOutLines =
+  const size_t numberOfOutLines =
       (datasize + dataEntriesPerLine - 1) / dataEntriesPerLine;
 
-  std::vector<std::unique_ptr<std::stringstream>> outLines;
-  outLines.resize(numberOfOutLines);
-
-  for (int64_t i = 0; i < numberOfOutLines; i++) {
-    outLines[i] = makeStringStream();
-    auto &outLine = *outLines[i];
-
+  const Kernel::NumberFormat xFormat(0, Kernel::NumberFormat::Notation::Fixed,
+                                     8);
+  const Kernel::NumberFormat yFormat(0, Kernel::NumberFormat::Notation::Fixed,
+                                     7);
+  const Kernel::NumberFormat eFormat(0, Kernel::NumberFormat::Notation::Fixed,
+                                     5);
+  writeLines(out, numberOfOutLines, [&](const size_t i, std::string &outLine) {
     size_t dataPosition = i * dataEntriesPerLine;
     const size_t endPosition = dataPosition + dataEntriesPerLine;
 
@@ -843,24 +868,19 @@ void SaveGSS::writeRALF_ALTdata(std::stringstream &out, const int bank,
       if (dataPosition < datasize) {
         // We have data to append
 
+        const auto xpos = static_cast<int>(xPointVals[dataPosition] * 32);
+        const auto ypos = static_cast<int>(yVals[dataPosition] * 1000);
         const auto epos =
             static_cast<int>(fixErrorValue(eVals[dataPosition] * 1000));
 
-        outLine << std::fixed << std::setw(8)
-                << static_cast<int>(xPointVals[dataPosition] * 32);
-        outLine << std::fixed << std::setw(7)
-                << static_cast<int>(yVals[dataPosition] * 1000);
-        outLine << std::fixed << std::setw(5) << epos;
+        xFormat.append(outLine, static_cast<int64_t>(xpos));
+        yFormat.append(outLine, static_cast<int64_t>(ypos));
+        eFormat.append(outLine, static_cast<int64_t>(epos));
       }
     }
     // Append a newline character at the end of each data block
-    outLine << "\n";
-  }
-
-  for (const auto &outLine : outLines) {
-    // Ensure the output order is preserved
-    out << outLine->rdbuf();
-  }
+    outLine += '\n';
+  });
 }
 
 void SaveGSS::writeRALF_XYEdata(const int bank, const bool MultiplyByBinWidth,
@@ -874,30 +894,22 @@ void SaveGSS::writeRALF_XYEdata(const int bank, const bool MultiplyByBinWidth,
 
   writeRALFHeader(out, bank, histo);
 
-  std::vector<std::unique_ptr<std::stringstream>> outLines;
-  outLines.resize(datasize);
-
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int64_t i = 0; i < static_cast<int64_t>(datasize); i++) {
-    outLines[i] = makeStringStream();
-    auto &outLine = *outLines[i];
+  const Kernel::NumberFormat xFormat(5, Kernel::NumberFormat::Notation::Fixed,
+                                     15);
+  const Kernel::NumberFormat yeFormat(8, Kernel::NumberFormat::Notation::Fixed,
+                                      18);
+  writeLines(out, datasize, [&](const size_t i, std::string &outLine) {
     const double binWidth = xVals[i + 1] - xVals[i];
     const double outYVal{MultiplyByBinWidth ? yVals[i] * binWidth : yVals[i]};
     const double epos =
         fixErrorValue(MultiplyByBinWidth ? eVals[i] * binWidth : eVals[i]);
 
     // The center of the X bin.
-    outLine << std::fixed << std::setprecision(5) << std::setw(15)
-            << xPointVals[i];
-    outLine << std::fixed << std::setprecision(8) << std::setw(18) << outYVal;
-    outLine << std::fixed << std::setprecision(8) << std::setw(18) << epos
-            << "\n";
-  }
-
-  for (const auto &outLine : outLines) {
-    // Ensure the output order is preserved
-    out << outLine->rdbuf();
-  }
+    xFormat.append(outLine, xPointVals[i]);
+    yeFormat.append(outLine, outYVal);
+    yeFormat.append(outLine, epos);
+    outLine += '\n';
+  });
 }
 
 //----------------------------------------------------------------------------
@@ -961,13 +973,13 @@ void SaveGSS::writeSLOGdata(const size_t ws_index, const int bank,
         << std::fixed << " 0 FXYE\n";
   }
 
-  std::vector<std::unique_ptr<std::stringstream>> outLines;
-  outLines.resize(datasize);
-
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int64_t i = 0; i < static_cast<int64_t>(datasize); i++) {
-    outLines[i] = makeStringStream();
-    auto &outLine = *outLines[i];
+  const Kernel::NumberFormat xFormat(
+      xye_precision[0], Kernel::NumberFormat::Notation::Fixed, 20);
+  const Kernel::NumberFormat yFormat(
+      xye_precision[1], Kernel::NumberFormat::Notation::Fixed, 20);
+  const Kernel::NumberFormat eFormat(
+      xye_precision[2], Kernel::NumberFormat::Notation::Fixed, 20);
+  writeLines(out, datasize, [&](const size_t i, std::string &outLine) {
     const double binWidth = xVals[i + 1] - xVals[i];
     const double yValue{MultiplyByBinWidth ? yVals[i] * binWidth : yVals[i]};
     const double eValue{
@@ -975,17 +987,15 @@ void SaveGSS::writeSLOGdata(const size_t ws_index, const int bank,
 
     // FIXME - Next step is to make the precision to be flexible from user
     // inputs
-    outLine << "  " << std::fixed << std::setprecision(xye_precision[0])
-            << std::setw(20) << xPoints[i] << "  " << std::fixed
-            << std::setprecision(xye_precision[1]) << std::setw(20) << yValue
-            << "  " << std::fixed << std::setprecision(xye_precision[2])
-            << std::setw(20) << eValue << std::setw(12) << " "
-            << "\n"; // let it flush its own buffer
-  }
-
-  for (const auto &outLine : outLines) {
-    out << outLine->rdbuf();
-  }
+    outLine += "  ";
+    xFormat.append(outLine, xPoints[i]);
+    outLine += "  ";
+    yFormat.append(outLine, yValue);
+    outLine += "  ";
+    eFormat.append(outLine, eValue);
+    outLine.append(12, ' ');
+    outLine += '\n';
+  });
 }
 
 } // namespace DataHandling
@@ -23,6 +23,9 @@
 #include <Poco/File.h>
 #include <boost/shared_ptr.hpp>
 
+#include <array>
+#include <future>
+
 using namespace Mantid::API;
 
 namespace Mantid {
@@ -107,6 +110,33 @@ bool makeMappings(const MatrixWorkspace &ws, const std::vector<int> &ws_indices,
   return true;
 }
 
+/// Number of events encoded and written per block by execEvent
+constexpr int64_t EVENT_BLOCK_SIZE = 4 * 1024 * 1024;
+
+/// Holds the combined event arrays of one block of spectra
+struct EventBlockBuffer {
+  std::vector<double> tofs;
+  std::vector<float> weights;
+  std::vector<float> errorSquareds;
+  std::vector<int64_t> pulsetimes;
+
+  double *resizeTofs(size_t size) {
+    tofs.resize(size);
+    return tofs.data();
+  }
+  float *resizeWeights(size_t size) {
+    weights.resize(size);
+    return weights.data();
+  }
+  float *resizeErrorSquareds(size_t size) {
+    errorSquareds.resize(size);
+    return errorSquareds.data();
+  }
+  int64_t *resizePulsetimes(size_t size) {
+    pulsetimes.resize(size);
+    return pulsetimes.data();
+  }
+};
 } // namespace
 
 /** Initialisation method.
@@ -161,6 +191,12 @@ void SaveNexusProcessed::init() {
       "CompressNexus",
       std::make_unique<EnabledWhenWorkspaceIsType<EventWorkspace>>(
           "InputWorkspace", true));
+
+  declareProperty(
+      "SinglePrecision", false,
+      "Save the signal and error values of histogram data in single "
+      "precision (default False).\n"
+      "This halves their size in the file, at the cost of precision.");
 }
 
 /** Get the list of workspace indices to use
@@ -334,9 +370,10 @@ void SaveNexusProcessed::doExec(
       else
         workspaceTypeGroupName = "workspace";
 
+      const bool singlePrecision = getProperty("SinglePrecision");
       nexusFile->writeNexusProcessedData2D(
           matrixWorkspace, uniformSpectra, indices,
-          workspaceTypeGroupName.c_str(), true);
+          workspaceTypeGroupName.c_str(), true, singlePrecision);
     }
 
     if (saveLegacyInstrument()) {
@@ -445,7 +482,9 @@ void SaveNexusProcessed::appendEventListData(const std::vector<T> &events,
 
 //-----------------------------------------------------------------------------------------------
 /** Execute the saving of event data.
- * This will make one long event list for all events contained.
+ * This will make one long event list for all events contained. The events are
+ * encoded in parallel one block of spectra at a time, and each block is
+ * written to the file while the next one is being encoded.
  * */
 void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
                                    const bool uniformSpectra,
@@ -470,13 +509,6 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
   }
   indices.push_back(index);
 
-  // Initialize all the arrays
-  int64_t num = index;
-  double *tofs = nullptr;
-  float *weights = nullptr;
-  float *errorSquareds = nullptr;
-  int64_t *pulsetimes = nullptr;
-
   // overall event type.
   EventType type = m_eventWorkspace->getEventType();
   bool writeTOF = true;
@@ -499,60 +531,88 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
     break;
   }
 
-  // --- Initialize the combined event arrays ----
-  if (writeTOF)
-    tofs = new double[num];
-  if (writeWeight)
-    weights = new float[num];
-  if (writeError)
-    errorSquareds = new float[num];
-  if (writePulsetime)
-    pulsetimes = new int64_t[num];
-
-  // --- Fill in the combined event arrays ----
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int wi = 0;
-       wi < static_cast<int>(m_eventWorkspace->getNumberHistograms()); wi++) {
-    PARALLEL_START_INTERUPT_REGION
-    const DataObjects::EventList &el = m_eventWorkspace->getSpectrum(wi);
-
-    // This is where it will land in the output array.
-    // It is okay to write in parallel since none should step on each other.
-    size_t offset = indices[wi];
-
-    switch (el.getEventType()) {
-    case TOF:
-      appendEventListData(el.getEvents(), offset, tofs, weights, errorSquareds,
-                          pulsetimes);
-      break;
-    case WEIGHTED:
-      appendEventListData(el.getWeightedEvents(), offset, tofs, weights,
-                          errorSquareds, pulsetimes);
-      break;
-    case WEIGHTED_NOTIME:
-      appendEventListData(el.getWeightedEventsNoTime(), offset, tofs, weights,
-                          errorSquareds, pulsetimes);
-      break;
-    }
-    m_progress->reportIncrement(el.getNumberEvents(), "Copying EventList");
-
-    PARALLEL_END_INTERUPT_REGION
-  }
-  PARALLEL_CHECK_INTERUPT_REGION
-
   /*Default = DONT compress - much faster*/
   bool CompressNexus = getProperty("CompressNexus");
 
-  // Write out to the NXS file.
-  nexusFile->writeNexusProcessedDataEventCombined(m_eventWorkspace, indices,
-                                                  tofs, weights, errorSquareds,
-                                                  pulsetimes, CompressNexus);
+  // Create the (empty) combined event data sets in the file
+  nexusFile->makeNexusProcessedDataEventCombined(
+      m_eventWorkspace, indices, writeTOF, writePulsetime, writeWeight,
+      writeError, CompressNexus);
+
+  // Split the spectra into blocks of roughly EVENT_BLOCK_SIZE events. A
+  // spectrum is never split, so a block may be larger for a big spectrum.
+  const auto numHist = static_cast<int>(indices.size()) - 1;
+  std::vector<int> blockStarts{0};
+  for (int wi = 0; wi < numHist; ++wi) {
+    if (indices[wi + 1] - indices[blockStarts.back()] >= EVENT_BLOCK_SIZE)
+      blockStarts.push_back(wi + 1);
+  }
+  if (blockStarts.back() != numHist)
+    blockStarts.push_back(numHist);
+
+  // Two sets of buffers: one block is encoded while the previous one is
+  // written to the file in the background.
+  std::array<EventBlockBuffer, 2> buffers;
+  std::future<void> pendingWrite;
+
+  for (size_t block = 0; block + 1 < blockStarts.size(); ++block) {
+    const int firstWi = blockStarts[block];
+    const int lastWi = blockStarts[block + 1];
+    const int64_t blockStart = indices[firstWi];
+    const auto blockSize = static_cast<size_t>(indices[lastWi] - blockStart);
+
+    // This buffer was written out two blocks ago, which has been waited for
+    // before the previous block was handed to the writer.
+    auto &buffer = buffers[block % 2];
+    double *tofs = writeTOF ? buffer.resizeTofs(blockSize) : nullptr;
+    float *weights = writeWeight ? buffer.resizeWeights(blockSize) : nullptr;
+    float *errorSquareds =
+        writeError ? buffer.resizeErrorSquareds(blockSize) : nullptr;
+    int64_t *pulsetimes =
+        writePulsetime ? buffer.resizePulsetimes(blockSize) : nullptr;
+
+    // --- Fill in the combined event arrays of this block ----
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int wi = firstWi; wi < lastWi; wi++) {
+      PARALLEL_START_INTERUPT_REGION
+      const DataObjects::EventList &el = m_eventWorkspace->getSpectrum(wi);
+
+      // This is where it will land in the output array.
+      // It is okay to write in parallel since none should step on each other.
+      size_t offset = indices[wi] - blockStart;
+
+      switch (el.getEventType()) {
+      case TOF:
+        appendEventListData(el.getEvents(), offset, tofs, weights,
+                            errorSquareds, pulsetimes);
+        break;
+      case WEIGHTED:
+        appendEventListData(el.getWeightedEvents(), offset, tofs, weights,
+                            errorSquareds, pulsetimes);
+        break;
+      case WEIGHTED_NOTIME:
+        appendEventListData(el.getWeightedEventsNoTime(), offset, tofs,
+                            weights, errorSquareds, pulsetimes);
+        break;
+      }
+      m_progress->reportIncrement(el.getNumberEvents(), "Copying EventList");
 
-  // Free mem.
-  delete[] tofs;
-  delete[] weights;
-  delete[] errorSquareds;
-  delete[] pulsetimes;
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+
+    // Only one thread may talk to the file at any time
+    if (pendingWrite.valid())
+      pendingWrite.get();
+    pendingWrite = std::async(std::launch::async, [=]() {
+      nexusFile->writeNexusProcessedDataEventBlock(
+          blockStart, static_cast<int64_t>(blockSize), tofs, weights,
+          errorSquareds, pulsetimes);
+      m_progress->reportIncrement(blockSize, "Writing events");
+    });
+  }
+  if (pendingWrite.valid())
+    pendingWrite.get();
 }
 
 //-----------------------------------------------------------------------------------------------
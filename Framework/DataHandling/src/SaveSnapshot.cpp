@@ -0,0 +1,343 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataHandling/SaveSnapshot.h"
+#include "MantidAPI/BinEdgeAxis.h"
+#include "MantidAPI/FileProperty.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/NumericAxis.h"
+#include "MantidAPI/Progress.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/TextAxis.h"
+#include "MantidDataHandling/SnapshotFormat.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/PropertyWithValue.h"
+#include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidKernel/Unit.h"
+
+#include <fstream>
+
+namespace Mantid {
+namespace DataHandling {
+
+using namespace Kernel;
+using namespace API;
+using namespace DataObjects;
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+
+// Register the algorithm into the AlgorithmFactory
+DECLARE_ALGORITHM(SaveSnapshot)
+
+namespace {
+/// Write the times of a time series as nanoseconds
+template <typename T>
+void writeTimes(std::ostream &out, const TimeSeriesProperty<T> &series) {
+  const auto times = series.timesAsVector();
+  std::vector<int64_t> nanoseconds;
+  nanoseconds.reserve(times.size());
+  for (const auto &time : times)
+    nanoseconds.emplace_back(time.totalNanoseconds());
+  Snapshot::writeArray(out, nanoseconds);
+}
+
+void writeStrings(std::ostream &out, const std::vector<std::string> &values) {
+  Snapshot::write<uint64_t>(out, values.size());
+  for (const auto &value : values)
+    Snapshot::write(out, value);
+}
+
+/// @return the number of bytes of the events of a spectrum
+size_t eventBytes(const EventList &eventList) {
+  switch (eventList.getEventType()) {
+  case EventType::WEIGHTED:
+    return Snapshot::arrayBytes<WeightedEvent>(eventList.getNumberEvents());
+  case EventType::WEIGHTED_NOTIME:
+    return Snapshot::arrayBytes<WeightedEventNoTime>(
+        eventList.getNumberEvents());
+  default:
+    return Snapshot::arrayBytes<TofEvent>(eventList.getNumberEvents());
+  }
+}
+
+void writeEvents(std::ostream &out, const EventList &eventList) {
+  const auto type = eventList.getEventType();
+  Snapshot::write<uint8_t>(out, static_cast<uint8_t>(type));
+  switch (type) {
+  case EventType::WEIGHTED:
+    Snapshot::writeArray(out, eventList.getWeightedEvents());
+    break;
+  case EventType::WEIGHTED_NOTIME:
+    Snapshot::writeArray(out, eventList.getWeightedEventsNoTime());
+    break;
+  default:
+    Snapshot::writeArray(out, eventList.getEvents());
+  }
+}
+} // namespace
+
+void SaveSnapshot::init() {
+  declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "InputWorkspace", "", Direction::Input),
+                  "The Workspace2D or EventWorkspace to save.");
+  declareProperty(std::make_unique<FileProperty>("Filename", "",
+                                                 FileProperty::Save, ".snap"),
+                  "The name of the snapshot file to write.");
+}
+
+std::map<std::string, std::string> SaveSnapshot::validateInputs() {
+  std::map<std::string, std::string> issues;
+  MatrixWorkspace_const_sptr ws = getProperty("InputWorkspace");
+  if (ws && ws->id() != "Workspace2D" && ws->id() != "EventWorkspace")
+    issues["InputWorkspace"] =
+        "Only Workspace2Ds and EventWorkspaces can be saved, not " + ws->id();
+  return issues;
+}
+
+void SaveSnapshot::exec() {
+  MatrixWorkspace_const_sptr ws = getProperty("InputWorkspace");
+  const std::string filename = getPropertyValue("Filename");
+  const auto eventWS = boost::dynamic_pointer_cast<const EventWorkspace>(ws);
+  const size_t numberHistograms = ws->getNumberHistograms();
+
+  // The X values are written once if all the spectra share them
+  bool commonX = numberHistograms > 0;
+  for (size_t i = 1; i < numberHistograms && commonX; ++i)
+    commonX = &ws->x(i) == &ws->x(0);
+
+  // The size of the block of each spectrum gives its offset in the file
+  std::vector<uint64_t> offsets(numberHistograms + 1, 0);
+  for (size_t i = 0; i < numberHistograms; ++i) {
+    size_t bytes = sizeof(uint8_t);
+    if (!commonX)
+      bytes += Snapshot::arrayBytes<double>(ws->x(i).size());
+    if (eventWS) {
+      bytes += sizeof(uint8_t) + eventBytes(eventWS->getSpectrum(i));
+    } else {
+      bytes += Snapshot::arrayBytes<double>(ws->y(i).size()) +
+               Snapshot::arrayBytes<double>(ws->e(i).size());
+      if (ws->hasDx(i))
+        bytes += Snapshot::arrayBytes<double>(ws->dx(i).size());
+    }
+    offsets[i + 1] = offsets[i] + bytes;
+  }
+
+  std::streamoff dataStart;
+  {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    out.write(Snapshot::MAGIC, sizeof(Snapshot::MAGIC));
+    Snapshot::write(out, Snapshot::VERSION);
+    Snapshot::write(out, Snapshot::BYTE_ORDER_MARK);
+    Snapshot::write(out, eventWS ? Snapshot::Kind::EventWorkspace
+                                 : Snapshot::Kind::Workspace2D);
+    Snapshot::write<uint32_t>(out, sizeof(TofEvent));
+    Snapshot::write<uint32_t>(out, sizeof(WeightedEvent));
+    Snapshot::write<uint32_t>(out, sizeof(WeightedEventNoTime));
+    Snapshot::write<uint64_t>(out, numberHistograms);
+
+    writeMetadata(out, *ws);
+    Snapshot::write<uint8_t>(out, commonX);
+    if (commonX)
+      Snapshot::writeArray(out, ws->x(0).rawData());
+    Snapshot::writeArray(out, offsets);
+    dataStart = out.tellp();
+    Snapshot::check(out, filename);
+  }
+
+  // Each thread writes the blocks of a contiguous range of spectra through
+  // its own stream
+  const int numberChunks = static_cast<int>(std::max<size_t>(
+      std::min<size_t>(PARALLEL_GET_MAX_THREADS, numberHistograms), 1));
+  Progress progress(this, 0.0, 1.0, numberHistograms);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int chunk = 0; chunk < numberChunks; ++chunk) {
+    PARALLEL_START_INTERUPT_REGION
+    const size_t first = numberHistograms * chunk / numberChunks;
+    const size_t last = numberHistograms * (chunk + 1) / numberChunks;
+    std::fstream out(filename,
+                     std::ios::binary | std::ios::in | std::ios::out);
+    out.seekp(dataStart + static_cast<std::streamoff>(offsets[first]));
+    for (size_t i = first; i < last; ++i) {
+      const bool hasDx = !eventWS && ws->hasDx(i);
+      Snapshot::write<uint8_t>(
+          out, static_cast<uint8_t>((commonX ? Snapshot::SharedX : 0) |
+                                    (hasDx ? Snapshot::HasDx : 0)));
+      if (!commonX)
+        Snapshot::writeArray(out, ws->x(i).rawData());
+      if (eventWS) {
+        writeEvents(out, eventWS->getSpectrum(i));
+      } else {
+        Snapshot::writeArray(out, ws->y(i).rawData());
+        Snapshot::writeArray(out, ws->e(i).rawData());
+        if (hasDx)
+          Snapshot::writeArray(out, ws->dx(i).rawData());
+      }
+      progress.report();
+    }
+    out.close();
+    Snapshot::check(out, filename);
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+}
+
+/// Write everything but the data of the spectra
+void SaveSnapshot::writeMetadata(std::ostream &out,
+                                 const MatrixWorkspace &ws) const {
+  Snapshot::write(out, ws.getTitle());
+  Snapshot::write(out, ws.YUnit());
+  Snapshot::write(out, ws.YUnitLabel());
+  Snapshot::write<uint8_t>(out, ws.isDistribution());
+  const auto xUnit = ws.getAxis(0)->unit();
+  Snapshot::write(out, xUnit ? xUnit->unitID() : std::string());
+
+  writeLogs(out, ws);
+
+  const auto instrument = ws.getInstrument();
+  Snapshot::write(out, instrument->getName());
+  Snapshot::write(out, instrument->getXmlText());
+  Snapshot::write(out, ws.constInstrumentParameters().asString());
+
+  const auto &detectorInfo = ws.detectorInfo();
+  const size_t numberDetectors =
+      detectorInfo.isScanning() ? 0 : detectorInfo.size();
+  if (detectorInfo.isScanning())
+    g_log.warning("The positions of scanning detectors are not saved.\n");
+  std::vector<double> positions, rotations;
+  std::vector<uint8_t> masks;
+  positions.reserve(3 * numberDetectors);
+  rotations.reserve(4 * numberDetectors);
+  masks.reserve(numberDetectors);
+  for (size_t i = 0; i < numberDetectors; ++i) {
+    const auto position = detectorInfo.position(i);
+    positions.insert(positions.end(), {position.X(), position.Y(),
+                                       position.Z()});
+    const auto rotation = detectorInfo.rotation(i);
+    rotations.insert(rotations.end(), {rotation.real(), rotation.imagI(),
+                                       rotation.imagJ(), rotation.imagK()});
+    masks.emplace_back(detectorInfo.isMasked(i));
+  }
+  Snapshot::writeArray(out, positions);
+  Snapshot::writeArray(out, rotations);
+  Snapshot::writeArray(out, masks);
+
+  // The vertical axis
+  const Axis *axis = ws.axes() > 1 ? ws.getAxis(1) : nullptr;
+  const auto unit = axis ? axis->unit() : Unit_sptr();
+  if (const auto *binEdgeAxis = dynamic_cast<const BinEdgeAxis *>(axis)) {
+    Snapshot::write(out, Snapshot::AxisKind::BinEdge);
+    Snapshot::write(out, unit ? unit->unitID() : std::string());
+    Snapshot::writeArray(out, binEdgeAxis->getValues());
+  } else if (const auto *numericAxis =
+                 dynamic_cast<const NumericAxis *>(axis)) {
+    Snapshot::write(out, Snapshot::AxisKind::Numeric);
+    Snapshot::write(out, unit ? unit->unitID() : std::string());
+    Snapshot::writeArray(out, numericAxis->getValues());
+  } else if (const auto *textAxis = dynamic_cast<const TextAxis *>(axis)) {
+    Snapshot::write(out, Snapshot::AxisKind::Text);
+    std::vector<std::string> labels;
+    for (size_t i = 0; i < textAxis->length(); ++i)
+      labels.emplace_back(textAxis->label(i));
+    writeStrings(out, labels);
+  } else {
+    Snapshot::write(out, Snapshot::AxisKind::Spectra);
+  }
+
+  // The spectrum numbers and detector IDs, then the masked bins
+  const size_t numberHistograms = ws.getNumberHistograms();
+  std::vector<int32_t> spectrumNumbers(numberHistograms);
+  std::vector<uint64_t> detectorCounts(numberHistograms);
+  std::vector<int32_t> detectorIDs;
+  std::vector<uint64_t> maskedIndices, maskedBins;
+  std::vector<double> maskWeights;
+  for (size_t i = 0; i < numberHistograms; ++i) {
+    const auto &spectrum = ws.getSpectrum(i);
+    spectrumNumbers[i] = spectrum.getSpectrumNo();
+    const auto &ids = spectrum.getDetectorIDs();
+    detectorCounts[i] = ids.size();
+    detectorIDs.insert(detectorIDs.end(), ids.begin(), ids.end());
+    if (ws.hasMaskedBins(i)) {
+      for (const auto &bin : ws.maskedBins(i)) {
+        maskedIndices.emplace_back(i);
+        maskedBins.emplace_back(bin.first);
+        maskWeights.emplace_back(bin.second);
+      }
+    }
+  }
+  Snapshot::writeArray(out, spectrumNumbers);
+  Snapshot::writeArray(out, detectorCounts);
+  Snapshot::writeArray(out, detectorIDs);
+  Snapshot::writeArray(out, maskedIndices);
+  Snapshot::writeArray(out, maskedBins);
+  Snapshot::writeArray(out, maskWeights);
+}
+
+/// Write the logs of the run, keeping the types of the common ones
+void SaveSnapshot::writeLogs(std::ostream &out,
+                             const MatrixWorkspace &ws) const {
+  const auto &logs = ws.run().getProperties();
+  Snapshot::write<uint64_t>(out, logs.size());
+  for (const auto *log : logs) {
+    if (const auto *series =
+            dynamic_cast<const TimeSeriesProperty<double> *>(log)) {
+      Snapshot::write(out, Snapshot::LogKind::DoubleSeries);
+      Snapshot::write(out, log->name());
+      Snapshot::write(out, log->units());
+      writeTimes(out, *series);
+      Snapshot::writeArray(out, series->valuesAsVector());
+    } else if (const auto *series =
+                   dynamic_cast<const TimeSeriesProperty<int> *>(log)) {
+      Snapshot::write(out, Snapshot::LogKind::IntSeries);
+      Snapshot::write(out, log->name());
+      Snapshot::write(out, log->units());
+      writeTimes(out, *series);
+      const auto values = series->valuesAsVector();
+      Snapshot::writeArray(out, std::vector<int32_t>(values.begin(),
+                                                     values.end()));
+    } else if (const auto *series =
+                   dynamic_cast<const TimeSeriesProperty<bool> *>(log)) {
+      Snapshot::write(out, Snapshot::LogKind::BoolSeries);
+      Snapshot::write(out, log->name());
+      Snapshot::write(out, log->units());
+      writeTimes(out, *series);
+      const auto values = series->valuesAsVector();
+      Snapshot::writeArray(out, std::vector<uint8_t>(values.begin(),
+                                                     values.end()));
+    } else if (const auto *series =
+                   dynamic_cast<const TimeSeriesProperty<std::string> *>(
+                       log)) {
+      Snapshot::write(out, Snapshot::LogKind::StringSeries);
+      Snapshot::write(out, log->name());
+      Snapshot::write(out, log->units());
+      writeTimes(out, *series);
+      writeStrings(out, series->valuesAsVector());
+    } else if (const auto *value =
+                   dynamic_cast<const PropertyWithValue<double> *>(log)) {
+      Snapshot::write(out, Snapshot::LogKind::Double);
+      Snapshot::write(out, log->name());
+      Snapshot::write(out, log->units());
+      Snapshot::write<double>(out, *value);
+    } else if (const auto *value =
+                   dynamic_cast<const PropertyWithValue<int> *>(log)) {
+      Snapshot::write(out, Snapshot::LogKind::Int);
+      Snapshot::write(out, log->name());
+      Snapshot::write(out, log->units());
+      Snapshot::write<int32_t>(out, *value);
+    } else {
+      Snapshot::write(out, Snapshot::LogKind::String);
+      Snapshot::write(out, log->name());
+      Snapshot::write(out, log->units());
+      Snapshot::write(out, log->value());
+    }
+  }
+}
+
+} // namespace DataHandling
+} // namespace Mantid
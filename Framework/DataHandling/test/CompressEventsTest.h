@@ -10,6 +10,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "MantidAPI/Axis.h"
+#include "MantidAPI/Run.h"
 #include "MantidDataHandling/CompressEvents.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidKernel/Unit.h"
@@ -154,6 +155,42 @@ public:
   void test_InPlace_ZeroTolerance_WithPulseTime() {
     doTest("CompressEvents_input", "CompressEvents_input", 0.0, 50, .001);
   }
+
+  void test_tolerances_are_recorded_in_logs() {
+    auto input =
+        WorkspaceCreationHelper::createEventWorkspace(2, 100, 100, 0.0, 1.0, 2);
+    CompressEvents alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", input);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    alg.setProperty("Tolerance", 0.5);
+    alg.setProperty("WallClockTolerance", 2.);
+    alg.setProperty("StartTime", "2010-01-01T00:00:00");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    EventWorkspace_sptr output = alg.getProperty("OutputWorkspace");
+    const auto &run = output->run();
+    TS_ASSERT_EQUALS(run.getPropertyValueAsType<double>("compress_tolerance"),
+                     0.5);
+    TS_ASSERT_EQUALS(
+        run.getPropertyValueAsType<double>("compress_wall_clock_tolerance"),
+        2.);
+
+    // Compressing again keeps the coarsest tolerance, and dropping the pulse
+    // times removes the wall-clock tolerance
+    CompressEvents again;
+    again.initialize();
+    again.setChild(true);
+    again.setProperty("InputWorkspace", output);
+    again.setPropertyValue("OutputWorkspace", "unused");
+    again.setProperty("Tolerance", 0.1);
+    TS_ASSERT_THROWS_NOTHING(again.execute());
+    output = again.getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(
+        output->run().getPropertyValueAsType<double>("compress_tolerance"),
+        0.5);
+    TS_ASSERT(!output->run().hasProperty("compress_wall_clock_tolerance"));
+  }
 };
 
 #endif
@@ -0,0 +1,164 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAHANDLING_EVENTCACHEFILETEST_H_
+#define MANTID_DATAHANDLING_EVENTCACHEFILETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataHandling/EventCacheFile.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include "Poco/File.h"
+#include "Poco/Path.h"
+
+#include <fstream>
+
+using namespace Mantid::DataHandling;
+using namespace Mantid::DataObjects;
+using Mantid::Types::Core::DateAndTime;
+
+class EventCacheFileTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventCacheFileTest *createSuite() { return new EventCacheFileTest(); }
+  static void destroySuite(EventCacheFileTest *suite) { delete suite; }
+
+  EventCacheFileTest()
+      : m_source(Poco::Path(Poco::Path::temp(), "EventCacheFileTest.nxs")
+                     .toString()),
+        m_cache(Poco::Path(Poco::Path::temp(), "EventCacheFileTest.evcache")
+                    .toString()),
+        m_segment("EventCacheFileTest") {}
+
+  void setUp() override { writeSource("some event data"); }
+
+  void tearDown() override {
+    SharedEventCache::release(m_segment);
+    for (const auto &name : {m_source, m_cache}) {
+      Poco::File file(name);
+      if (file.exists())
+        file.remove();
+    }
+  }
+
+  void test_read_without_cache_returns_false() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(3, 10, 10);
+    TS_ASSERT(!EventCacheFile::read(m_cache, m_source, *ws));
+  }
+
+  void test_write_then_read_gives_same_events() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(4, 10, 10);
+    ws->getSpectrum(1).clear(false);
+    ws->getSpectrum(2).switchTo(Mantid::API::WEIGHTED);
+    ws->getSpectrum(2).getWeightedEvents()[0] =
+        WeightedEvent(1.5, DateAndTime(1000), 2.0, 4.0);
+    ws->getSpectrum(3).switchTo(Mantid::API::WEIGHTED_NOTIME);
+    ws->getSpectrum(0).sortTof();
+    TS_ASSERT_THROWS_NOTHING(EventCacheFile::write(m_cache, m_source, *ws));
+    TS_ASSERT(!Poco::File(m_cache + ".part").exists());
+
+    auto loaded = WorkspaceCreationHelper::createEventWorkspace(4, 10, 0);
+    TS_ASSERT(EventCacheFile::read(m_cache, m_source, *loaded));
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      const auto &expected = ws->getSpectrum(i);
+      const auto &actual = loaded->getSpectrum(i);
+      TS_ASSERT_EQUALS(actual.getEventType(), expected.getEventType());
+      TS_ASSERT_EQUALS(actual.getSortType(), expected.getSortType());
+      TS_ASSERT(actual.equals(expected, 0., 0., 0));
+    }
+    TS_ASSERT_EQUALS(loaded->getSpectrum(2).getWeightedEvents()[0].weight(),
+                     2.0);
+  }
+
+  void test_read_rejects_changed_source() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(3, 10, 10);
+    EventCacheFile::write(m_cache, m_source, *ws);
+    writeSource("a longer piece of event data");
+    auto loaded = WorkspaceCreationHelper::createEventWorkspace(3, 10, 0);
+    TS_ASSERT(!EventCacheFile::read(m_cache, m_source, *loaded));
+    TS_ASSERT_EQUALS(loaded->getNumberEvents(), 0);
+  }
+
+  void test_read_rejects_different_number_of_spectra() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(3, 10, 10);
+    EventCacheFile::write(m_cache, m_source, *ws);
+    auto loaded = WorkspaceCreationHelper::createEventWorkspace(5, 10, 0);
+    TS_ASSERT(!EventCacheFile::read(m_cache, m_source, *loaded));
+  }
+
+  void test_read_rejects_truncated_cache() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(3, 10, 10);
+    EventCacheFile::write(m_cache, m_source, *ws);
+    Poco::File(m_cache).setSize(Poco::File(m_cache).getSize() / 2);
+    auto loaded = WorkspaceCreationHelper::createEventWorkspace(3, 10, 0);
+    TS_ASSERT(!EventCacheFile::read(m_cache, m_source, *loaded));
+    TS_ASSERT_EQUALS(loaded->getNumberEvents(), 0);
+  }
+
+  void test_shared_read_without_segment_returns_false() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(3, 10, 10);
+    TS_ASSERT(!SharedEventCache::read(m_segment, m_source, *ws));
+  }
+
+  void test_shared_publish_then_read_gives_same_events() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(4, 10, 10);
+    ws->getSpectrum(1).clear(false);
+    ws->getSpectrum(2).switchTo(Mantid::API::WEIGHTED);
+    ws->getSpectrum(3).switchTo(Mantid::API::WEIGHTED_NOTIME);
+    ws->getSpectrum(0).sortTof();
+    TS_ASSERT(SharedEventCache::publish(m_segment, m_source, *ws));
+    // A second publisher finds the segment and leaves it alone
+    TS_ASSERT(!SharedEventCache::publish(m_segment, m_source, *ws));
+
+    auto loaded = WorkspaceCreationHelper::createEventWorkspace(4, 10, 0);
+    TS_ASSERT(SharedEventCache::read(m_segment, m_source, *loaded));
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      const auto &expected = ws->getSpectrum(i);
+      const auto &actual = loaded->getSpectrum(i);
+      TS_ASSERT_EQUALS(actual.getEventType(), expected.getEventType());
+      TS_ASSERT_EQUALS(actual.getSortType(), expected.getSortType());
+      TS_ASSERT(actual.equals(expected, 0., 0., 0));
+    }
+    // The events are copied, the segment is still there for others
+    loaded->getSpectrum(0).clear(false);
+    auto other = WorkspaceCreationHelper::createEventWorkspace(4, 10, 0);
+    TS_ASSERT(SharedEventCache::read(m_segment, m_source, *other));
+    TS_ASSERT_EQUALS(other->getNumberEvents(), ws->getNumberEvents());
+  }
+
+  void test_shared_segment_is_removed_on_release() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(3, 10, 10);
+    TS_ASSERT(SharedEventCache::publish(m_segment, m_source, *ws));
+    SharedEventCache::release(m_segment);
+    auto loaded = WorkspaceCreationHelper::createEventWorkspace(3, 10, 0);
+    TS_ASSERT(!SharedEventCache::read(m_segment, m_source, *loaded));
+    TS_ASSERT(SharedEventCache::publish(m_segment, m_source, *ws));
+  }
+
+  void test_shared_read_rejects_changed_source() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(3, 10, 10);
+    TS_ASSERT(SharedEventCache::publish(m_segment, m_source, *ws));
+    writeSource("a longer piece of event data");
+    auto loaded = WorkspaceCreationHelper::createEventWorkspace(3, 10, 0);
+    TS_ASSERT(!SharedEventCache::read(m_segment, m_source, *loaded));
+    TS_ASSERT_EQUALS(loaded->getNumberEvents(), 0);
+  }
+
+private:
+  void writeSource(const std::string &contents) {
+    std::ofstream out(m_source, std::ios::trunc);
+    out << contents;
+  }
+
+  const std::string m_source;
+  const std::string m_cache;
+  const std::string m_segment;
+};
+
+#endif /* MANTID_DATAHANDLING_EVENTCACHEFILETEST_H_ */
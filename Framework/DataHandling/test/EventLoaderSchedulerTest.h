@@ -0,0 +1,118 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAHANDLING_EVENTLOADERSCHEDULERTEST_H_
+#define MANTID_DATAHANDLING_EVENTLOADERSCHEDULERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataHandling/EventLoaderScheduler.h"
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPool.h"
+
+#include <boost/make_shared.hpp>
+
+#include <atomic>
+
+using namespace Mantid::DataHandling;
+using namespace Mantid::Kernel;
+
+namespace {
+std::shared_ptr<Task> makeTask(boost::shared_ptr<std::mutex> mutex =
+                                   boost::shared_ptr<std::mutex>()) {
+  auto task = std::make_shared<FunctionTask>(boost::function<void()>([] {}));
+  if (mutex)
+    task->setMutex(mutex);
+  return task;
+}
+} // namespace
+
+class EventLoaderSchedulerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventLoaderSchedulerTest *createSuite() {
+    return new EventLoaderSchedulerTest();
+  }
+  static void destroySuite(EventLoaderSchedulerTest *suite) { delete suite; }
+
+  void test_processing_is_handed_out_before_reading() {
+    EventLoaderScheduler scheduler(10, 1);
+    auto read = makeTask(boost::make_shared<std::mutex>());
+    auto process = makeTask();
+    scheduler.push(read);
+    scheduler.push(process);
+    TS_ASSERT_EQUALS(scheduler.pop(0), process);
+    TS_ASSERT_EQUALS(scheduler.pop(0), read);
+  }
+
+  void test_task_with_busy_mutex_is_not_handed_out() {
+    EventLoaderScheduler scheduler(10, 1);
+    auto mutex = boost::make_shared<std::mutex>();
+    auto first = makeTask(mutex);
+    auto second = makeTask(mutex);
+    scheduler.push(first);
+    scheduler.push(second);
+    auto popped = scheduler.pop(0);
+    TS_ASSERT(popped);
+    TS_ASSERT(!scheduler.pop(0));
+    scheduler.finished(popped.get(), 0);
+    TS_ASSERT(scheduler.pop(0));
+  }
+
+  void test_reads_wait_for_space_in_processing_queue() {
+    EventLoaderScheduler scheduler(2, 1);
+    std::vector<std::shared_ptr<Task>> reads;
+    for (int i = 0; i < 3; ++i) {
+      reads.push_back(makeTask(boost::make_shared<std::mutex>()));
+      scheduler.push(reads.back());
+    }
+    auto first = scheduler.pop(0);
+    auto second = scheduler.pop(0);
+    TS_ASSERT(first);
+    TS_ASSERT(second);
+    // Two reads in flight fill the queue
+    TS_ASSERT(!scheduler.pop(0));
+    scheduler.finished(first.get(), 0);
+    scheduler.push(makeTask());
+    // The processing task created by the first read still takes its place
+    auto process = scheduler.pop(0);
+    TS_ASSERT(process);
+    TS_ASSERT(!process->getMutex());
+    TS_ASSERT(!scheduler.pop(0));
+    scheduler.finished(process.get(), 0);
+    TS_ASSERT(scheduler.pop(0));
+  }
+
+  void test_not_empty_while_task_running() {
+    EventLoaderScheduler scheduler(2, 1);
+    scheduler.push(makeTask());
+    auto task = scheduler.pop(0);
+    TS_ASSERT(!scheduler.empty());
+    scheduler.finished(task.get(), 0);
+    TS_ASSERT(scheduler.empty());
+  }
+
+  void test_thread_pool_runs_all_tasks() {
+    auto scheduler = new EventLoaderScheduler(2, 3);
+    ThreadPool pool(scheduler, 4);
+    auto mutex = boost::make_shared<std::mutex>();
+    std::atomic<int> processed{0};
+    for (int i = 0; i < 20; ++i) {
+      auto read = std::make_shared<FunctionTask>([scheduler, &processed] {
+        for (int j = 0; j < 3; ++j)
+          scheduler->push(std::make_shared<FunctionTask>(
+              [&processed] { ++processed; }));
+      });
+      read->setMutex(mutex);
+      pool.schedule(read);
+    }
+    TS_ASSERT_THROWS_NOTHING(pool.joinAll());
+    TS_ASSERT_EQUALS(processed, 60);
+  }
+};
+
+#endif /* MANTID_DATAHANDLING_EVENTLOADERSCHEDULERTEST_H_ */
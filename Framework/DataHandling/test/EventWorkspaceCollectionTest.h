@@ -176,6 +176,30 @@ public:
       TS_ASSERT_EQUALS(eventWS->sample().getThickness(), thickness);
     }
   }
+
+  void test_shrinkEventListsToFit() {
+    EventWorkspaceCollection collection;
+    auto periodLog =
+        std::make_unique<const TimeSeriesProperty<int>>("period_log");
+    const size_t periods = 2;
+    collection.setNPeriods(periods, periodLog);
+    collection.setIndexInfo(Indexing::IndexInfo({1, 2}));
+    for (size_t period = 0; period < periods; ++period) {
+      auto &events = collection.getSpectrum(1, period).getEvents();
+      events.reserve(100);
+      events.emplace_back(1.0);
+      events.emplace_back(2.0);
+    }
+
+    collection.shrinkEventListsToFit();
+
+    for (size_t period = 0; period < periods; ++period) {
+      const auto &events = collection.getSpectrum(1, period).getEvents();
+      TS_ASSERT_EQUALS(events.size(), 2);
+      TS_ASSERT_EQUALS(events.capacity(), 2);
+      TS_ASSERT_EQUALS(events[1].tof(), 2.0);
+    }
+  }
 };
 
 #endif /* MANTID_DATAHANDLING_EventWorkspaceCollectionTEST_H_ */
@@ -700,6 +700,31 @@ public:
                     output->y(0)[0], 0.00001);
   }
 
+  void testEventsSortedByTofStaySorted() {
+    EventWorkspace_sptr input =
+        WorkspaceCreationHelper::createEventWorkspace(5, 5, 200, 0, 1, 4);
+    input->sortAll(TOF_SORT, nullptr);
+    GroupDetectors2 alg;
+    alg.setChild(true);
+    TS_ASSERT_THROWS_NOTHING(alg.initialize());
+    alg.setProperty("InputWorkspace", input);
+    alg.setPropertyValue("OutputWorkspace", "unused_for_child");
+    alg.setPropertyValue("WorkspaceIndexList", "0-4");
+    alg.setProperty("PreserveEvents", true);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    MatrixWorkspace_sptr output = alg.getProperty("OutputWorkspace");
+    auto outputEvents = boost::dynamic_pointer_cast<EventWorkspace>(output);
+    TS_ASSERT(outputEvents);
+    TS_ASSERT_EQUALS(outputEvents->getNumberHistograms(), 1);
+    TS_ASSERT_EQUALS(outputEvents->getNumberEvents(), input->getNumberEvents());
+    const auto &grouped = outputEvents->getSpectrum(0);
+    TS_ASSERT_EQUALS(grouped.getSortType(), TOF_SORT);
+    const auto tofs = grouped.getTofs();
+    TS_ASSERT(std::is_sorted(tofs.begin(), tofs.end()));
+  }
+
   void
   test_GroupingWorkspace_ThreeGroup_NoUngrouped_dontPreserveEvents_inplace() {
     dotestGroupingWorkspace(3, false, false, true, false);
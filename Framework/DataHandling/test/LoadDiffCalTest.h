@@ -10,6 +10,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/AlgorithmResultCache.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidDataHandling/LoadDiffCal.h"
@@ -91,6 +92,85 @@ public:
       Poco::File(filename).remove();
   }
 
+  void test_outputs_are_declared_before_exec() {
+    LoadDiffCal alg;
+    alg.initialize();
+    alg.setProperty("MakeMaskWorkspace", false);
+    TS_ASSERT(!alg.existsProperty("OutputCalWorkspace"));
+    alg.setPropertyValue("WorkspaceName", "LoadDiffCalTest");
+    TS_ASSERT(alg.existsProperty("OutputGroupingWorkspace"));
+    TS_ASSERT(alg.existsProperty("OutputCalWorkspace"));
+    TS_ASSERT(!alg.existsProperty("OutputMaskWorkspace"));
+    alg.setProperty("MakeCalWorkspace", false);
+    TS_ASSERT(!alg.existsProperty("OutputCalWorkspace"));
+    TS_ASSERT_EQUALS(alg.getPropertyValue("OutputGroupingWorkspace"),
+                     "LoadDiffCalTest_group");
+  }
+
+  void test_output_names_set_by_the_caller_are_kept() {
+    LoadDiffCal alg;
+    alg.initialize();
+    alg.setPropertyValue("WorkspaceName", "LoadDiffCalTest");
+    alg.setPropertyValue("OutputGroupingWorkspace", "customGrouping");
+    alg.setProperty("MakeMaskWorkspace", false);
+    alg.setProperty("MakeMaskWorkspace", true);
+    alg.setPropertyValue("WorkspaceName", "LoadDiffCalTestRenamed");
+    TS_ASSERT_EQUALS(alg.getPropertyValue("OutputGroupingWorkspace"),
+                     "customGrouping");
+    TS_ASSERT_EQUALS(alg.getPropertyValue("OutputMaskWorkspace"),
+                     "LoadDiffCalTestRenamed_mask");
+  }
+
+  void test_repeated_load_is_restored_from_cache() {
+    std::string outWSName("LoadDiffCalTest");
+    std::string filename("LoadDiffCalTest.h5");
+
+    SaveDiffCalTest saveDiffCal;
+    auto inst = saveDiffCal.createInstrument();
+    auto groupWSIn = saveDiffCal.createGrouping(inst);
+    auto maskWSIn = saveDiffCal.createMasking(inst);
+    auto calWSIn = saveDiffCal.createCalibration(5 * 9);
+    SaveDiffCal saveAlg;
+    saveAlg.initialize();
+    saveAlg.setProperty("GroupingWorkspace", groupWSIn);
+    saveAlg.setProperty("MaskWorkspace", maskWSIn);
+    saveAlg.setProperty("Filename", filename);
+    saveAlg.setProperty("CalibrationWorkspace", calWSIn);
+    TS_ASSERT_THROWS_NOTHING(saveAlg.execute(););
+    filename = saveAlg.getPropertyValue("Filename");
+
+    auto &cache = AlgorithmResultCache::Instance();
+    cache.setAlgorithms({"LoadDiffCal"});
+    cache.clear();
+    for (int i = 0; i < 2; ++i) {
+      LoadDiffCal loadAlg;
+      loadAlg.initialize();
+      loadAlg.setProperty("InputWorkspace", groupWSIn);
+      loadAlg.setPropertyValue("Filename", filename);
+      loadAlg.setPropertyValue("WorkspaceName", outWSName);
+      TS_ASSERT_THROWS_NOTHING(loadAlg.execute(););
+      TS_ASSERT(loadAlg.isExecuted());
+      TS_ASSERT_EQUALS(cache.size(), 1);
+
+      auto &ads = AnalysisDataService::Instance();
+      TS_ASSERT(ads.doesExist(outWSName + "_group"));
+      TS_ASSERT(ads.doesExist(outWSName + "_mask"));
+      auto ws = ads.retrieveWS<ITableWorkspace>(outWSName + "_cal");
+      auto checkAlg = AlgorithmManager::Instance().create("CompareWorkspaces");
+      checkAlg->setProperty("Workspace1", calWSIn);
+      checkAlg->setProperty("Workspace2", ws);
+      checkAlg->execute();
+      TS_ASSERT(checkAlg->getProperty("Result"));
+      for (const auto suffix : {"_group", "_mask", "_cal"})
+        ads.remove(outWSName + suffix);
+    }
+    cache.setAlgorithms({});
+    cache.clear();
+
+    if (Poco::File(filename).exists())
+      Poco::File(filename).remove();
+  }
+
   void test_override_grouping() {
     // this is a round-trip test
     std::string outWSName("LoadDiffCalTest");
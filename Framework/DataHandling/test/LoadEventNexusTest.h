@@ -29,6 +29,8 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include <map>
+
 using namespace Mantid;
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
@@ -38,7 +40,9 @@ using namespace Mantid::DataHandling;
 using Mantid::Types::Core::DateAndTime;
 using Mantid::Types::Event::TofEvent;
 
-void run_multiprocess_load(const std::string &file, bool precount) {
+void run_multiprocess_load(
+    const std::string &file, bool precount,
+    const std::map<std::string, std::string> &filters = {}) {
   Mantid::API::FrameworkManager::Instance();
   LoadEventNexus ld;
   ld.initialize();
@@ -48,6 +52,8 @@ void run_multiprocess_load(const std::string &file, bool precount) {
   ld.setPropertyValue("OutputWorkspace", outws_name);
   ld.setPropertyValue("Precount", std::to_string(precount));
   ld.setProperty<bool>("LoadLogs", false); // Time-saver
+  for (const auto &filter : filters)
+    ld.setPropertyValue(filter.first, filter.second);
   TS_ASSERT_THROWS_NOTHING(ld.execute());
   TS_ASSERT(ld.isExecuted())
 
@@ -63,6 +69,8 @@ void run_multiprocess_load(const std::string &file, bool precount) {
   ldRef.setPropertyValue("OutputWorkspace", outws_name);
   ldRef.setPropertyValue("Precount", "1");
   ldRef.setProperty<bool>("LoadLogs", false); // Time-saver
+  for (const auto &filter : filters)
+    ldRef.setPropertyValue(filter.first, filter.second);
   TS_ASSERT_THROWS_NOTHING(ldRef.execute());
   TS_ASSERT(ldRef.isExecuted())
 
@@ -288,6 +296,16 @@ public:
     }
   }
 
+  void test_multiprocess_loader_with_filters() {
+    if (!windows) {
+      run_multiprocess_load("SANS2D00022048.nxs", true,
+                            {{"FilterByTofMin", "10000"},
+                             {"FilterByTofMax", "50000"},
+                             {"FilterByTimeStart", "10"},
+                             {"FilterByTimeStop", "100"}});
+    }
+  }
+
   void test_SingleBank_PixelsOnlyInThatBank() { doTestSingleBank(true, false); }
 
   void test_load_event_nexus_ornl_eqsans() {
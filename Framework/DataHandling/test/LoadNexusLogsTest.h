@@ -77,6 +77,26 @@ public:
     // Now the stats
   }
 
+  void test_AllowList_and_BlockList_select_the_logs() {
+    LoadNexusLogs ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "REF_L_32035.nxs");
+    ld.setPropertyValue("AllowList", "Speed3,Phase1,PhaseRequest1");
+    ld.setPropertyValue("BlockList", "Phase1");
+    MatrixWorkspace_sptr ws = createTestWorkspace();
+    ld.setProperty("Workspace", ws);
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    const auto &run = ws->run();
+    TS_ASSERT(run.hasProperty("Speed3"));
+    TS_ASSERT(run.hasProperty("PhaseRequest1"));
+    TS_ASSERT(!run.hasProperty("Phase1"));
+    TS_ASSERT(!run.hasProperty("Speed1"));
+    // needed by the loaders so always read
+    TS_ASSERT(run.hasProperty("proton_charge"));
+  }
+
   void test_File_With_Runlog_And_Selog() {
     LoadNexusLogs loader;
     loader.initialize();
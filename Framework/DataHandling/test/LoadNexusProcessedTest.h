@@ -937,6 +937,50 @@ public:
     doTestLoadAndSavePointWS(true);
   }
 
+  void test_SaveAndLoadOnHistogramWSInSinglePrecision() {
+    MatrixWorkspace_sptr inputWs =
+        WorkspaceFactory::Instance().create("Workspace2D", 2, 3, 2);
+    inputWs->mutableX(0) = {1., 2., 3.};
+    inputWs->mutableX(1) = {1., 2., 3.};
+    inputWs->mutableY(0) = {1.1, 22.2};
+    inputWs->mutableY(1) = {333.3, 4444.4};
+    inputWs->mutableE(0) = {0.1, 0.2};
+    inputWs->mutableE(1) = {0.3, 0.4};
+
+    IAlgorithm_sptr save =
+        AlgorithmManager::Instance().create("SaveNexusProcessed");
+    save->initialize();
+    TS_ASSERT_THROWS_NOTHING(save->setProperty("InputWorkspace", inputWs));
+    TS_ASSERT_THROWS_NOTHING(save->setPropertyValue(
+        "Filename", "TestSaveAndLoadNexusProcessed.nxs"));
+    TS_ASSERT_THROWS_NOTHING(save->setProperty("SinglePrecision", true));
+    TS_ASSERT_THROWS_NOTHING(save->execute());
+
+    IAlgorithm_sptr load =
+        AlgorithmManager::Instance().create("LoadNexusProcessed");
+    load->initialize();
+    TS_ASSERT_THROWS_NOTHING(load->setPropertyValue(
+        "Filename", "TestSaveAndLoadNexusProcessed.nxs"));
+    TS_ASSERT_THROWS_NOTHING(
+        load->setPropertyValue("OutputWorkspace", "output"));
+    TS_ASSERT_THROWS_NOTHING(load->execute());
+
+    MatrixWorkspace_sptr outputWs =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>("output");
+    for (size_t i = 0; i < 2; ++i) {
+      TS_ASSERT_EQUALS(inputWs->x(i), outputWs->x(i));
+      for (size_t j = 0; j < 2; ++j) {
+        TS_ASSERT_EQUALS(static_cast<float>(inputWs->y(i)[j]),
+                         outputWs->y(i)[j]);
+        TS_ASSERT_EQUALS(static_cast<float>(inputWs->e(i)[j]),
+                         outputWs->e(i)[j]);
+      }
+    }
+
+    AnalysisDataService::Instance().remove("output");
+    Poco::File("TestSaveAndLoadNexusProcessed.nxs").remove();
+  }
+
   void test_that_workspace_name_is_loaded() {
     // Arrange
     LoadNexusProcessed loader;
@@ -0,0 +1,76 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAHANDLING_LOADSNAPSHOTTEST_H_
+#define MANTID_DATAHANDLING_LOADSNAPSHOTTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataHandling/LoadSnapshot.h"
+#include "MantidDataHandling/SaveSnapshot.h"
+#include "MantidKernel/FileDescriptor.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <Poco/File.h>
+#include <Poco/TemporaryFile.h>
+#include <fstream>
+
+using namespace Mantid::API;
+using namespace Mantid::DataHandling;
+using Mantid::Kernel::FileDescriptor;
+
+class LoadSnapshotTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created
+  // statically This means the constructor isn't called when running other
+  // tests
+  static LoadSnapshotTest *createSuite() { return new LoadSnapshotTest(); }
+  static void destroySuite(LoadSnapshotTest *suite) { delete suite; }
+
+  void test_init() {
+    LoadSnapshot alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_confidence_of_a_snapshot() {
+    SaveSnapshot save;
+    save.initialize();
+    save.setChild(true);
+    save.setProperty("InputWorkspace",
+                     WorkspaceCreationHelper::create2DWorkspaceBinned(2, 3));
+    save.setPropertyValue("Filename", "LoadSnapshotTest.snap");
+    save.execute();
+    const std::string filename = save.getPropertyValue("Filename");
+
+    LoadSnapshot alg;
+    FileDescriptor descriptor(filename);
+    TS_ASSERT_EQUALS(alg.confidence(descriptor), 90);
+    Poco::File(filename).remove();
+  }
+
+  void test_other_files_are_rejected() {
+    Poco::TemporaryFile file;
+    const std::string filename = file.path() + ".snap";
+    {
+      std::ofstream out(filename);
+      out << "not a snapshot\n";
+    }
+    LoadSnapshot alg;
+    {
+      FileDescriptor descriptor(filename);
+      TS_ASSERT_EQUALS(alg.confidence(descriptor), 0);
+    }
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setPropertyValue("Filename", filename);
+    alg.setPropertyValue("OutputWorkspace", "out");
+    TS_ASSERT_THROWS(alg.execute(), const std::invalid_argument &)
+    Poco::File(filename).remove();
+  }
+};
+
+#endif /* MANTID_DATAHANDLING_LOADSNAPSHOTTEST_H_ */
@@ -16,6 +16,7 @@
 #include "MantidKernel/ConfigService.h"
 #include <cxxtest/TestSuite.h>
 
+#include <algorithm>
 #include <boost/algorithm/string/predicate.hpp> //for ends_with
 
 using namespace Mantid::API;
@@ -236,6 +237,44 @@ public:
     // LoadTest.py system test
   }
 
+  void test_Concurrent_Loads_Sum_As_Serial_Loads() {
+    auto &config = ConfigService::Instance();
+    const std::string concurrency =
+        config.getString("loading.multifile.concurrency");
+    const std::string filename = "MUSR15189-15192.nxs";
+
+    config.setString("loading.multifile.concurrency", "1");
+    Load serial;
+    serial.initialize();
+    serial.setPropertyValue("Filename", filename);
+    serial.setPropertyValue("OutputWorkspace", "serial");
+    TS_ASSERT_THROWS_NOTHING(serial.execute())
+
+    config.setString("loading.multifile.concurrency", "3");
+    Load concurrent;
+    concurrent.initialize();
+    concurrent.setPropertyValue("Filename", filename);
+    concurrent.setPropertyValue("OutputWorkspace", "concurrent");
+    TS_ASSERT_THROWS_NOTHING(concurrent.execute())
+    config.setString("loading.multifile.concurrency", concurrency);
+
+    auto compare = AlgorithmManager::Instance().create("CompareWorkspaces");
+    compare->setPropertyValue("Workspace1", "serial");
+    compare->setPropertyValue("Workspace2", "concurrent");
+    compare->setPropertyValue("CheckAllData", "1");
+    compare->execute();
+    const bool match = compare->getProperty("Result");
+    TS_ASSERT(match)
+
+    const auto &ads = AnalysisDataService::Instance();
+    const auto names = ads.getObjectNames(DataServiceSort::Unsorted,
+                                          DataServiceHidden::Include);
+    TS_ASSERT(std::none_of(
+        names.cbegin(), names.cend(), [](const std::string &name) {
+          return name.find("__@loadsum_temp@") != std::string::npos;
+        }))
+  }
+
   void test_Comma_Separated_List_Of_Different_Intruments_Finds_Correct_Files() {
     Load loader;
     loader.initialize();
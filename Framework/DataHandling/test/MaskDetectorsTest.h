@@ -788,7 +788,7 @@ public:
   }
 
   void test_MaskingMaskWorkspace() {
-    const auto &ads = AnalysisDataService::Instance();
+    auto &ads = AnalysisDataService::Instance();
     const std::string inputWSName("inputWS");
     constexpr int numInputSpec(5);
     constexpr int maskedIndex{numInputSpec / 2};
@@ -0,0 +1,155 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAHANDLING_SAVESNAPSHOTTEST_H_
+#define MANTID_DATAHANDLING_SAVESNAPSHOTTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Run.h"
+#include "MantidAPI/TextAxis.h"
+#include "MantidDataHandling/LoadSnapshot.h"
+#include "MantidDataHandling/SaveSnapshot.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <Poco/File.h>
+
+using namespace Mantid::API;
+using namespace Mantid::DataHandling;
+using namespace Mantid::DataObjects;
+using namespace Mantid::Kernel;
+using Mantid::HistogramData::HistogramDx;
+
+class SaveSnapshotTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created
+  // statically This means the constructor isn't called when running other
+  // tests
+  static SaveSnapshotTest *createSuite() { return new SaveSnapshotTest(); }
+  static void destroySuite(SaveSnapshotTest *suite) { delete suite; }
+
+  void test_init() {
+    SaveSnapshot alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_workspace2D_round_trip() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(5, 10, 1.0, 2.0);
+    ws->setTitle("snapshot");
+    ws->setYUnit("Counts");
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      ws->mutableY(i)[3] = static_cast<double>(i);
+      ws->mutableE(i)[4] = 0.5 * static_cast<double>(i);
+    }
+    ws->mutableX(2)[0] = -1.0;
+    ws->setSharedDx(1, Mantid::Kernel::make_cow<HistogramDx>(10, 0.25));
+    ws->flagMasked(3, 2, 0.5);
+    ws->getSpectrum(4).setSpectrumNo(42);
+    ws->getSpectrum(4).setDetectorIDs({7, 8});
+    auto &run = ws->mutableRun();
+    run.addProperty("run_title", std::string("title"));
+    run.addProperty("temperature", 300.0);
+    auto series = std::make_unique<TimeSeriesProperty<double>>("proton_charge");
+    series->addValue("2019-01-01T00:00:00", 1.5);
+    series->addValue("2019-01-01T00:00:10", 2.5);
+    run.addProperty(std::move(series));
+
+    MatrixWorkspace_sptr loaded = roundTrip(ws);
+    TS_ASSERT(boost::dynamic_pointer_cast<Workspace2D>(loaded))
+    TS_ASSERT_EQUALS(loaded->getTitle(), "snapshot");
+    TS_ASSERT_EQUALS(loaded->YUnit(), "Counts");
+    TS_ASSERT_EQUALS(loaded->getNumberHistograms(), 5);
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(loaded->x(i).rawData(), ws->x(i).rawData());
+      TS_ASSERT_EQUALS(loaded->y(i).rawData(), ws->y(i).rawData());
+      TS_ASSERT_EQUALS(loaded->e(i).rawData(), ws->e(i).rawData());
+      TS_ASSERT_EQUALS(loaded->hasDx(i), ws->hasDx(i));
+    }
+    TS_ASSERT_EQUALS(loaded->dx(1)[3], 0.25);
+    TS_ASSERT(loaded->hasMaskedBins(3))
+    TS_ASSERT_EQUALS(loaded->maskedBins(3).at(2), 0.5);
+    TS_ASSERT_EQUALS(loaded->getSpectrum(4).getSpectrumNo(), 42);
+    TS_ASSERT_EQUALS(loaded->getSpectrum(4).getDetectorIDs(),
+                     std::set<Mantid::detid_t>({7, 8}));
+    const auto &loadedRun = loaded->run();
+    TS_ASSERT_EQUALS(loadedRun.getPropertyValueAsType<std::string>("run_title"),
+                     "title");
+    TS_ASSERT_EQUALS(loadedRun.getPropertyValueAsType<double>("temperature"),
+                     300.0);
+    auto loadedSeries = dynamic_cast<TimeSeriesProperty<double> *>(
+        loadedRun.getProperty("proton_charge"));
+    TS_ASSERT(loadedSeries)
+    if (loadedSeries) {
+      TS_ASSERT_EQUALS(loadedSeries->size(), 2);
+      TS_ASSERT_EQUALS(loadedSeries->lastValue(), 2.5);
+    }
+  }
+
+  void test_text_axis_round_trip() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(2, 3);
+    auto axis = std::make_unique<TextAxis>(2);
+    axis->setLabel(0, "first");
+    axis->setLabel(1, "second");
+    ws->replaceAxis(1, std::move(axis));
+    MatrixWorkspace_sptr loaded = roundTrip(ws);
+    auto loadedAxis = dynamic_cast<TextAxis *>(loaded->getAxis(1));
+    TS_ASSERT(loadedAxis)
+    if (loadedAxis)
+      TS_ASSERT_EQUALS(loadedAxis->label(1), "second");
+  }
+
+  void test_event_workspace_round_trip() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(4, 10, 20);
+    ws->getSpectrum(1).switchTo(Mantid::API::WEIGHTED);
+    MatrixWorkspace_sptr loaded = roundTrip(ws);
+    auto loadedEvents = boost::dynamic_pointer_cast<EventWorkspace>(loaded);
+    TS_ASSERT(loadedEvents)
+    if (!loadedEvents)
+      return;
+    TS_ASSERT_EQUALS(loadedEvents->getNumberEvents(), ws->getNumberEvents());
+    TS_ASSERT_EQUALS(loadedEvents->getSpectrum(1).getEventType(),
+                     Mantid::API::WEIGHTED);
+    TS_ASSERT_EQUALS(loadedEvents->getSpectrum(0).getEvents(),
+                     ws->getSpectrum(0).getEvents());
+    TS_ASSERT_EQUALS(loadedEvents->y(2).rawData(), ws->y(2).rawData());
+  }
+
+  void test_other_workspaces_are_rejected() {
+    SaveSnapshot alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setProperty("InputWorkspace",
+                    WorkspaceCreationHelper::createWorkspaceSingleValue(1.0));
+    alg.setPropertyValue("Filename", "SaveSnapshotTest.snap");
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &)
+  }
+
+private:
+  MatrixWorkspace_sptr roundTrip(const MatrixWorkspace_sptr &ws) {
+    SaveSnapshot save;
+    save.initialize();
+    save.setChild(true);
+    save.setProperty("InputWorkspace", ws);
+    save.setPropertyValue("Filename", "SaveSnapshotTest.snap");
+    TS_ASSERT_THROWS_NOTHING(save.execute())
+    const std::string filename = save.getPropertyValue("Filename");
+
+    LoadSnapshot load;
+    load.initialize();
+    load.setChild(true);
+    load.setPropertyValue("Filename", filename);
+    load.setPropertyValue("OutputWorkspace", "loaded");
+    TS_ASSERT_THROWS_NOTHING(load.execute())
+    Poco::File(filename).remove();
+    return load.getProperty("OutputWorkspace");
+  }
+};
+
+#endif /* MANTID_DATAHANDLING_SAVESNAPSHOTTEST_H_ */
@@ -57,6 +57,12 @@ public:
   void setDataType(const size_t blockSize,
                    const std::string &typeName) override;
   void getDataType(size_t &CoordSize, std::string &typeName) const override;
+  /// Compress the event data with deflate when the file is opened and its
+  /// event data array created, i.e. only for new files. HDF5 decompresses
+  /// the data transparently when it is read.
+  void setCompression(const bool compress) { m_compress = compress; }
+  /// @return true if new event data arrays are compressed
+  bool getCompression() const { return m_compress; }
   //------------------------------------------------------------------------------------------------------------------------
   // Auxiliary functions (non-virtual, used for testing)
   int64_t getNDataColums() const { return m_BlockSize[1]; }
@@ -88,6 +94,8 @@ private:
   /// the vector, which describes the event specific data size, namely how many
   /// column an event is composed into and this class reads/writres
   std::vector<int64_t> m_BlockSize;
+  /// create the event data array compressed
+  bool m_compress{false};
   /// lock Nexus file operations as Nexus is not thread safe
   mutable std::mutex m_fileMutex;
 
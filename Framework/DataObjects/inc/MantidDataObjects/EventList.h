@@ -12,6 +12,7 @@
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/cow_ptr.h"
+#include <atomic>
 #include <iosfwd>
 #include <vector>
 
@@ -21,9 +22,13 @@ namespace Core {
 class DateAndTime;
 }
 } // namespace Types
+namespace HistogramData {
+class BinIndexer;
+}
 namespace Kernel {
 class SplittingInterval;
 using TimeSplitterType = std::vector<SplittingInterval>;
+class TimeSplitterIndex;
 class Unit;
 } // namespace Kernel
 namespace DataObjects {
@@ -90,6 +95,12 @@ public:
 
   EventList &operator+=(const EventList &more_events);
 
+  EventList &mergeSorted(const EventList &more_events);
+
+  EventList &mergeSorted(const std::vector<const EventList *> &more_lists);
+
+  void swapEvents(EventList &other);
+
   EventList &operator-=(const EventList &more_events);
 
   bool operator==(const EventList &rhs) const;
@@ -153,6 +164,8 @@ public:
 
   void reserve(size_t num) override;
 
+  void shrinkToFit();
+
   void sort(const EventSortType order) const;
 
   void setSortOrder(const EventSortType order) const;
@@ -210,13 +223,17 @@ public:
 
   virtual size_t histogram_size() const;
 
-  void compressEvents(double tolerance, EventList *destination);
+  void compressEvents(double tolerance, EventList *destination,
+                      bool parallel = false);
   void compressFatEvents(const double tolerance,
                          const Types::Core::DateAndTime &timeStart,
                          const double seconds, EventList *destination);
   // get EventType declaration
   void generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E,
                          bool skipError = false) const override;
+  void generateHistogram(const HistogramData::BinIndexer &indexer,
+                         const MantidVec &X, MantidVec &Y, MantidVec &E,
+                         bool skipError = false) const;
   void generateHistogramPulseTime(const MantidVec &X, MantidVec &Y,
                                   MantidVec &E,
                                   bool skipError = false) const override;
@@ -287,9 +304,12 @@ public:
                             double tofOffset, EventList &output) const;
 
   void filterInPlace(Kernel::TimeSplitterType &splitter);
+  void filterInPlace(const Kernel::TimeSplitterIndex &splitter);
 
   void splitByTime(Kernel::TimeSplitterType &splitter,
                    std::vector<EventList *> outputs) const;
+  void splitByTime(const Kernel::TimeSplitterIndex &splitter,
+                   std::vector<EventList *> outputs) const;
 
   void splitByFullTime(Kernel::TimeSplitterType &splitter,
                        std::map<int, EventList *> outputs, bool docorrection,
@@ -388,6 +408,16 @@ private:
   /// Mutex that is locked while sorting an event list
   mutable std::mutex m_sortMutex;
 
+  /// Number of events in the list when its histogram was last put in the MRU
+  mutable std::atomic<size_t> m_numberOfEventsInMRU{
+      std::numeric_limits<size_t>::max()};
+
+  template <class T>
+  bool histogramAppendedEvents(const std::vector<T> &appended, MantidVec &Y,
+                               MantidVec &E);
+  void addToHistogramInMRU(const MantidVec &appendedY,
+                           const MantidVec &appendedE);
+
   template <class T>
   static typename std::vector<T>::const_iterator
   findFirstPulseEvent(const std::vector<T> &events,
@@ -399,6 +429,8 @@ private:
                              const double seek_time, const double &tofFactor,
                              const double &tofOffset) const;
 
+  void generateHistogramSorted(const MantidVec &X, MantidVec &Y, MantidVec &E,
+                               bool skipError) const;
   void generateCountsHistogram(const MantidVec &X, MantidVec &Y) const;
 
   void generateCountsHistogramPulseTime(const MantidVec &X, MantidVec &Y) const;
@@ -423,10 +455,15 @@ private:
   static void compressEventsHelper(const std::vector<T> &events,
                                    std::vector<WeightedEventNoTime> &out,
                                    double tolerance);
+  template <class ConstIterator>
+  static void compressEventsHelper(ConstIterator first, ConstIterator last,
+                                   std::vector<WeightedEventNoTime> &out,
+                                   double tolerance);
   template <class T>
-  void compressEventsParallelHelper(const std::vector<T> &events,
-                                    std::vector<WeightedEventNoTime> &out,
-                                    double tolerance);
+  static void
+  compressEventsParallelHelper(const std::vector<T> &events,
+                               std::vector<WeightedEventNoTime> &out,
+                               double tolerance);
   template <class T>
   static void compressFatEventsHelper(
       const std::vector<T> &events, std::vector<WeightedEvent> &out,
@@ -438,6 +475,10 @@ private:
                                         const MantidVec &X, MantidVec &Y,
                                         MantidVec &E);
   template <class T>
+  static void histogramUnsortedHelper(const std::vector<T> &events,
+                                      const HistogramData::BinIndexer &indexer,
+                                      MantidVec &Y, MantidVec *E);
+  template <class T>
   static void integrateHelper(std::vector<T> &events, const double minX,
                               const double maxX, const bool entireRange,
                               double &sum, double &error);
@@ -491,10 +532,17 @@ private:
   void filterInPlaceHelper(Kernel::TimeSplitterType &splitter,
                            typename std::vector<T> &events);
   template <class T>
+  static void filterInPlaceHelper(const Kernel::TimeSplitterIndex &splitter,
+                                  typename std::vector<T> &events);
+  template <class T>
   void splitByTimeHelper(Kernel::TimeSplitterType &splitter,
                          std::vector<EventList *> outputs,
                          typename std::vector<T> &events) const;
   template <class T>
+  static void splitByTimeHelper(const Kernel::TimeSplitterIndex &splitter,
+                                std::vector<EventList *> &outputs,
+                                const typename std::vector<T> &events);
+  template <class T>
   void splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
                              std::map<int, EventList *> outputs,
                              typename std::vector<T> &events, bool docorrection,
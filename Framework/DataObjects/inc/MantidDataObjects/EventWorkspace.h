@@ -21,6 +21,7 @@ class Progress;
 
 namespace DataObjects {
 class EventWorkspaceMRU;
+class Workspace2D;
 
 /** \class EventWorkspace
 
@@ -116,6 +117,10 @@ public:
                          MantidVec &Y, MantidVec &E,
                          bool skipError = false) const override;
 
+  /// Generate the histograms of all the event lists into a Workspace2D.
+  void generateHistograms(Workspace2D &output, bool skipError = false,
+                          Mantid::API::Progress *prog = nullptr) const;
+
   /// Generate a new histogram from specified event list at the given index.
   void generateHistogramPulseTime(const std::size_t index, const MantidVec &X,
                                   MantidVec &Y, MantidVec &E,
@@ -9,14 +9,16 @@
 
 #include "MantidHistogramData/HistogramE.h"
 #include "MantidHistogramData/HistogramY.h"
-#include "MantidKernel/Exception.h"
-#include "MantidKernel/MRUList.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/cow_ptr.h"
 
-#include "Poco/RWLock.h"
-
+#include <atomic>
 #include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace Mantid {
@@ -27,52 +29,53 @@ class EventList;
 //============================================================================
 //============================================================================
 /**
- * This little class holds data and an index marker that is used for uniqueness.
- * This is used in the MRUList.
+ * One shard of the MRU: a most-recently-used list of histograms, keyed by the
+ * address of the EventList they were generated from. Each shard has its own
+ * mutex, which is normally only taken by a single thread.
  */
-template <class T> class TypeWithMarker {
-public:
-  /**
-   * Constructor.
-   * @param the_index :: unique index into the workspace of this data
-   */
-  TypeWithMarker(const uintptr_t the_index) : m_index(the_index) {}
-  TypeWithMarker(const TypeWithMarker &other) = delete;
-  TypeWithMarker &operator=(const TypeWithMarker &other) = delete;
-
+template <class T> class MRUSegment {
 public:
-  /// Unique index value.
-  uintptr_t m_index;
-
-  /// Pointer to a vector of data
-  T m_data;
-
-  /// Function returns a unique index, used for hashing for MRU list
-  uintptr_t hashIndexFunction() const { return m_index; }
-
-  /// Set the unique index value.
-  void setIndex(const uintptr_t the_index) { m_index = the_index; }
+  T find(const std::uintptr_t index) const;
+  void insert(const std::uintptr_t index, T data, const size_t maxEntries,
+              const size_t maxBytes);
+  void replace(const std::uintptr_t index, T data);
+  void deleteIndex(const std::uintptr_t index);
+  void clear();
+  size_t size() const;
+
+private:
+  using Item = std::pair<std::uintptr_t, T>;
+  /// Items, most recently inserted first
+  std::list<Item> m_items;
+  /// Lookup of the items by index
+  std::unordered_map<std::uintptr_t, typename std::list<Item>::iterator>
+      m_lookup;
+  /// Bytes held by the histograms of the items
+  size_t m_bytes{0};
+  /// Mutex protecting the list
+  mutable std::mutex m_mutex;
 };
 
 //============================================================================
 //============================================================================
 /** This is a container for the MRU (most-recently-used) list
  * of generated histograms.
+ *
+ * The lists are split in a fixed number of shards, one per OpenMP thread, so
+ * that threads looking up the histograms of different spectra never wait on
+ * each other. By default each shard keeps the 50 most recent histograms. If a
+ * memory budget is set, with setMemoryBudget() or the
+ * "EventWorkspace.MRUMemory" configuration key (in bytes), the oldest
+ * histograms of a shard are dropped instead once the shard holds more than
+ * its share of the budget. The most recent histogram of a shard is always
+ * kept.
  */
 class DLLExport EventWorkspaceMRU {
 public:
   using YType = Kernel::cow_ptr<HistogramData::HistogramY>;
   using EType = Kernel::cow_ptr<HistogramData::HistogramE>;
-  using YWithMarker = TypeWithMarker<YType>;
-  using EWithMarker = TypeWithMarker<EType>;
-  // Typedef for a Most-Recently-Used list of Data objects.
-  using mru_listY = Kernel::MRUList<YWithMarker>;
-  using mru_listE = Kernel::MRUList<EWithMarker>;
-
-  ~EventWorkspaceMRU();
 
-  void ensureEnoughBuffersY(size_t thread_num) const;
-  void ensureEnoughBuffersE(size_t thread_num) const;
+  EventWorkspaceMRU();
 
   void clear();
 
@@ -82,6 +85,12 @@ public:
   void insertE(size_t thread_num, EType data, const EventList *index);
 
   void deleteIndex(const EventList *index);
+  void updateIndex(const EventList *index,
+                   const std::function<bool(YType &, EType &)> &update);
+
+  void setMemoryBudget(const size_t bytes);
+  /// @return the memory budget in bytes, 0 if the number of entries is limited
+  size_t memoryBudget() const { return m_memoryBudget; }
 
   /** Return how many entries in the Y MRU list are used.
    * Only used in tests. It only returns the 0-th MRU list size.
@@ -89,15 +98,17 @@ public:
   size_t MRUSize() const;
 
 protected:
-  /// The most-recently-used list of dataY histograms
-  mutable std::vector<std::unique_ptr<mru_listY>> m_bufferedDataY;
+  size_t maxEntries() const;
+  size_t maxBytesPerShard() const;
+
+  /// The most-recently-used lists of dataY histograms, one per shard
+  std::vector<std::unique_ptr<MRUSegment<YType>>> m_bufferedDataY;
 
-  /// The most-recently-used list of dataE histograms
-  mutable std::vector<std::unique_ptr<mru_listE>> m_bufferedDataE;
+  /// The most-recently-used lists of dataE histograms, one per shard
+  std::vector<std::unique_ptr<MRUSegment<EType>>> m_bufferedDataE;
 
-  /// Mutex when adding entries in the MRU list
-  mutable Poco::RWLock m_changeMruListsMutexE;
-  mutable Poco::RWLock m_changeMruListsMutexY;
+  /// Memory budget in bytes, shared by Y and E. 0 for no budget.
+  std::atomic<size_t> m_memoryBudget{0};
 };
 
 } // namespace DataObjects
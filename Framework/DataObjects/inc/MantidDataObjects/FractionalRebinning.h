@@ -34,6 +34,20 @@ namespace DataObjects {
 
 namespace FractionalRebinning {
 
+/// The overlap of an input bin with a bin of the output grid
+struct BinOverlap {
+  /// Workspace index of the input spectrum
+  size_t inputIndex;
+  /// Index of the bin in the input spectrum
+  size_t inputBin;
+  /// Workspace index of the output spectrum
+  size_t outputIndex;
+  /// Index of the bin in the output spectrum
+  size_t outputBin;
+  /// Area of the overlap as a fraction of the area of the input bin
+  double weight;
+};
+
 /// Find the intersect region on the output grid
 MANTID_DATAOBJECTS_DLL bool
 getIntersectionRegion(const std::vector<double> &xAxis,
@@ -62,6 +76,20 @@ MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(
     const std::vector<double> &verticalAxis,
     const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
 
+/// Find the overlaps of the input quadrilateral with the output grid
+MANTID_DATAOBJECTS_DLL void
+calculateOverlaps(const Geometry::Quadrilateral &inputQ, const size_t i,
+                  const size_t j, const std::vector<double> &xAxis,
+                  const std::vector<double> &verticalAxis,
+                  std::vector<BinOverlap> &overlaps);
+
+/// Rebin the input bins to the output grid using precomputed overlaps
+MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(
+    const std::vector<std::vector<BinOverlap>> &overlaps,
+    const API::MatrixWorkspace_const_sptr &inputWS,
+    DataObjects::RebinnedOutput &outputWS,
+    const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
+
 } // namespace FractionalRebinning
 
 } // namespace DataObjects
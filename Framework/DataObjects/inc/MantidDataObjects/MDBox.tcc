@@ -151,9 +151,16 @@ TMDE(MDBox)::MDBox(const MDBox<MDE, nd> &other,
       this->setFileBacked();
   }
 }
-// unhide MDBoxBase method
+/** Add all the events, in a NON-THREAD-SAFE manner. No bounds checking is
+ * made!
+ *
+ * @param events :: vector of events to be copied.
+ *
+ * @return always returns 0
+ */
 TMDE(size_t MDBox)::addEventsUnsafe(const std::vector<MDE> &events) {
-  return MDBoxBase<MDE, nd>::addEventsUnsafe(events);
+  this->data.insert(this->data.end(), events.cbegin(), events.cend());
+  return 0;
 }
 
 //-----------------------------------------------------------------------------------------------
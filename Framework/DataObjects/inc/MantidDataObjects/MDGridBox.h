@@ -139,6 +139,7 @@ public:
   //----------------------------------------------------------------------------------------------------------------------
   size_t addEvent(const MDE &event) override;
   size_t addEventUnsafe(const MDE &event) override;
+  size_t addEventsUnsafe(const std::vector<MDE> &events) override;
 
   /*--------------->  EVENTS from event data
    * <-------------------------------------------------------------*/
@@ -166,6 +167,11 @@ public:
       const coord_t innerRadiusSquared = 0.0,
       const bool useOnePercentBackgroundCorrection = true) const override;
 
+  void integrateSpheres(
+      std::vector<API::IMDNode::SphereIntegral> &spheres,
+      const std::vector<size_t> &indices,
+      const bool useOnePercentBackgroundCorrection = true) const override;
+
   void centroidSphere(Mantid::API::CoordTransform &radiusTransform,
                       const coord_t radiusSquared, coord_t *centroid,
                       signal_t &signal) const override;
@@ -16,8 +16,10 @@
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/WarningSuppressions.h"
+#include <algorithm>
 #include <boost/math/special_functions/round.hpp>
 #include <boost/optional.hpp>
+#include <cmath>
 #include <ostream>
 
 // These pragmas ignores the warning in the ctor where "d<nd-1" for nd=1.
@@ -1294,6 +1296,173 @@ TMDE(void MDGridBox)::integrateSphere(
   delete[] boxMightTouch;
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Integrate several spheres in one traversal of the boxes. For each sphere,
+ * the boxes are classified as in integrateSphere, but only those near its
+ * center are looked at. The boxes touched by several spheres are then visited
+ * once for all of them, in the order of the boxes, so that the signals are
+ * summed in the same order as by integrateSphere.
+ *
+ * @param spheres :: the spheres; the signals and errors are added to
+ * @param indices :: indices of the spheres to integrate in this box
+ * @param useOnePercentBackgroundCorrection :: if one percent correction
+ *should be applied to background.
+ */
+TMDE(void MDGridBox)::integrateSpheres(
+    std::vector<API::IMDNode::SphereIntegral> &spheres,
+    const std::vector<size_t> &indices,
+    const bool useOnePercentBackgroundCorrection) const {
+  // How many vertices does one box have? 2^nd, or bitwise shift left 1 by nd
+  // bits
+  const size_t maxVertices = 1 << nd;
+
+  // set up caches for box sizes and min box values
+  coord_t boxSize[nd];
+  coord_t minBoxVal[nd];
+  size_t indexMaker[nd];
+  Kernel::Utils::NestedForLoop::SetUpIndexMaker(nd, indexMaker, split);
+  for (size_t d = 0; d < nd; ++d) {
+    boxSize[d] = static_cast<coord_t>(m_SubBoxSize[d]);
+    minBoxVal[d] = static_cast<coord_t>(this->extents[d].getMin());
+  }
+
+  /// A box touched by a sphere
+  struct Touch {
+    size_t box;
+    size_t sphere;
+    bool fullyContained;
+  };
+  std::vector<Touch> touches;
+  std::vector<size_t> verticesContained;
+
+  for (const auto sphereIndex : indices) {
+    const auto &sphere = spheres[sphereIndex];
+    // Boxes beyond this distance from the center contain no vertex in the
+    // sphere and fail the "might touch" test of integrateSphere. One more box
+    // on each side allows for rounding.
+    const double searchRadius = std::sqrt(
+        diagonalSquared * 0.72 +
+        std::max(sphere.radiusSquared, sphere.innerRadiusSquared));
+    size_t boxMin[nd], boxMax[nd], numInWindow[nd];
+    bool outside = false;
+    for (size_t d = 0; d < nd; ++d) {
+      const double first =
+          std::floor((sphere.center[d] - searchRadius - minBoxVal[d]) /
+                     m_SubBoxSize[d]) -
+          1.;
+      const double last =
+          std::floor((sphere.center[d] + searchRadius - minBoxVal[d]) /
+                     m_SubBoxSize[d]) +
+          1.;
+      if (last < 0. || first >= static_cast<double>(split[d])) {
+        outside = true;
+        break;
+      }
+      boxMin[d] = first < 0. ? 0 : static_cast<size_t>(first);
+      boxMax[d] = std::min(split[d] - 1, static_cast<size_t>(last));
+      numInWindow[d] = boxMax[d] - boxMin[d] + 1;
+    }
+    if (outside)
+      continue;
+
+    // Count the vertices contained in each box of the window
+    size_t windowIndexMaker[nd];
+    Kernel::Utils::NestedForLoop::SetUpIndexMaker(nd, windowIndexMaker,
+                                                  numInWindow);
+    verticesContained.assign(windowIndexMaker[nd - 1] * numInWindow[nd - 1],
+                             0);
+    size_t vertexMin[nd], vertexMax[nd], vertexIndex[nd];
+    for (size_t d = 0; d < nd; ++d) {
+      vertexMin[d] = vertexIndex[d] = boxMin[d];
+      vertexMax[d] = boxMax[d] + 2;
+    }
+    bool allDone = false;
+    while (!allDone) {
+      coord_t vertexCoord[nd];
+      for (size_t d = 0; d < nd; ++d)
+        vertexCoord[d] =
+            static_cast<coord_t>(vertexIndex[d]) * boxSize[d] + minBoxVal[d];
+      coord_t out[nd];
+      sphere.radiusTransform->apply(vertexCoord, out);
+      if (out[0] < sphere.radiusSquared &&
+          out[0] > sphere.innerRadiusSquared) {
+        // This vertex is shared by up to 2^nd adjacent boxes
+        for (size_t neighb = 0; neighb < maxVertices; ++neighb) {
+          bool badIndex = false;
+          size_t windowIndex = 0;
+          for (size_t d = 0; d < nd; d++) {
+            const size_t boxIndex =
+                vertexIndex[d] - ((neighb & ((size_t)1 << d)) >> d);
+            if (boxIndex < boxMin[d] || boxIndex > boxMax[d]) {
+              badIndex = true;
+              break;
+            }
+            windowIndex += (boxIndex - boxMin[d]) * windowIndexMaker[d];
+          }
+          if (!badIndex)
+            verticesContained[windowIndex]++;
+        }
+      }
+      allDone = Kernel::Utils::NestedForLoop::Increment(nd, vertexIndex,
+                                                        vertexMax, vertexMin);
+    }
+
+    // Classify the boxes of the window, in increasing linear index
+    size_t boxIndex[nd];
+    for (size_t d = 0; d < nd; ++d)
+      boxIndex[d] = boxMin[d];
+    size_t nextBox[nd];
+    for (size_t d = 0; d < nd; ++d)
+      nextBox[d] = boxMax[d] + 1;
+    size_t windowIndex = 0;
+    allDone = false;
+    while (!allDone) {
+      const size_t i = Kernel::Utils::NestedForLoop::GetLinearIndex(
+          nd, boxIndex, indexMaker);
+      const size_t contained = verticesContained[windowIndex++];
+      if (contained >= maxVertices) {
+        touches.push_back({i, sphereIndex, true});
+      } else if (contained > 0) {
+        touches.push_back({i, sphereIndex, false});
+      } else {
+        coord_t boxCenter[nd];
+        m_Children[i]->getCenter(boxCenter);
+        coord_t out[nd];
+        sphere.radiusTransform->apply(boxCenter, out);
+        if (out[0] < diagonalSquared * 0.72 + sphere.radiusSquared ||
+            out[0] < diagonalSquared * 0.72 + sphere.innerRadiusSquared)
+          touches.push_back({i, sphereIndex, false});
+      }
+      allDone = Kernel::Utils::NestedForLoop::Increment(nd, boxIndex, nextBox,
+                                                        boxMin);
+    }
+  }
+
+  // Visit each touched box once, for all its spheres
+  std::stable_sort(
+      touches.begin(), touches.end(),
+      [](const Touch &a, const Touch &b) { return a.box < b.box; });
+  std::vector<size_t> partialSpheres;
+  for (auto touch = touches.begin(); touch != touches.end();) {
+    const API::IMDNode *box = m_Children[touch->box];
+    partialSpheres.clear();
+    for (const size_t boxIndex = touch->box;
+         touch != touches.end() && touch->box == boxIndex; ++touch) {
+      auto &sphere = spheres[touch->sphere];
+      if (touch->fullyContained) {
+        // Use the integrated sum of signal in the box
+        sphere.signal += box->getSignal();
+        sphere.errorSquared += box->getErrorSquared();
+      } else {
+        partialSpheres.push_back(touch->sphere);
+      }
+    }
+    if (!partialSpheres.empty())
+      box->integrateSpheres(spheres, partialSpheres,
+                            useOnePercentBackgroundCorrection);
+  }
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Find the centroid of all events contained within by doing a weighted average
  * of their coordinates.
@@ -1723,6 +1892,50 @@ TMDE(inline size_t MDGridBox)::addEventUnsafe(const MDE &event) {
     return 0;
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Add several events to the grid box, in a NON-THREAD-SAFE manner. The events
+ * are grouped by child box first, so that each child receives all of its
+ * events at once and each leaf box appends them in one go, instead of the
+ * events travelling down the tree one at a time.
+ *
+ * Warning! No bounds checking is done (for performance), as in
+ * addEventUnsafe(). Only 1 thread should be writing to this box (or any child
+ * boxes) at a time.
+ *
+ * Note! nPoints, signal and error must be re-calculated using refreshCache()
+ * after all events have been added.
+ *
+ * @param events :: the events to add
+ * @return 0, as nothing is rejected here
+ * */
+TMDE(size_t MDGridBox)::addEventsUnsafe(const std::vector<MDE> &events) {
+  std::vector<size_t> childIndices;
+  childIndices.reserve(events.size());
+  std::vector<size_t> counts(numBoxes, 0);
+  for (const auto &event : events) {
+    size_t cindex = calculateChildIndex(event);
+    // Events on the upper boundary of the last child box go to that box, as
+    // in addEventUnsafe()
+    if (cindex == numBoxes)
+      cindex = numBoxes - 1;
+    if (cindex < numBoxes)
+      ++counts[cindex];
+    childIndices.push_back(cindex);
+  }
+
+  std::vector<std::vector<MDE>> groups(numBoxes);
+  for (size_t i = 0; i < numBoxes; ++i)
+    groups[i].reserve(counts[i]);
+  for (size_t i = 0; i < events.size(); ++i)
+    if (childIndices[i] < numBoxes)
+      groups[childIndices[i]].push_back(events[i]);
+
+  for (size_t i = 0; i < numBoxes; ++i)
+    if (!groups[i].empty())
+      m_Children[i]->addEventsUnsafe(groups[i]);
+  return 0;
+}
+
 /**Sets particular child MDgridBox at the index, specified by the input
  *parameters
  *@param index     -- the position of the new child in the list of GridBox
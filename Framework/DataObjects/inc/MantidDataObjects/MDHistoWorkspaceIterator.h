@@ -120,6 +120,9 @@ public:
   std::vector<size_t>
   findNeighbourIndexesByWidth(const std::vector<int> &widths) const;
 
+  void findNeighbourIndexesByWidth(const std::vector<int> &widths,
+                                   std::vector<size_t> &neighbourIndexes) const;
+
   bool isWithinBounds(size_t index) const override;
 
   size_t permutationCacheSize() const;
@@ -174,7 +177,11 @@ protected:
   SkippingPolicy_scptr m_skippingPolicy;
 
   /// Create or fetch permutations relating to a given neighbour width.
-  std::vector<int64_t> createPermutations(const std::vector<int> &widths) const;
+  const std::vector<int64_t> &
+  createPermutations(const std::vector<int> &widths) const;
+
+  /// Are all the neighbours within the given widths inside the workspace?
+  bool neighboursAreInside(const std::vector<int> &widths) const;
 };
 
 } // namespace DataObjects
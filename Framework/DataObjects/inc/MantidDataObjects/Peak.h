@@ -188,6 +188,14 @@ public:
   Kernel::V3D getVirtualDetectorPosition(const Kernel::V3D &detectorDir) const;
 
 private:
+  struct GoniometerMatrices;
+  using GoniometerMatrices_const_sptr =
+      boost::shared_ptr<const GoniometerMatrices>;
+
+  static GoniometerMatrices_const_sptr identityGoniometer();
+  static GoniometerMatrices_const_sptr
+  makeGoniometer(const Mantid::Kernel::Matrix<double> &goniometer);
+
   bool findDetector(const Mantid::Kernel::V3D &beam,
                     const Geometry::InstrumentRayTracer &tracer);
 
@@ -227,12 +235,9 @@ private:
   /// Final energy of the neutrons at peak (normally same as m_InitialEnergy)
   double m_finalEnergy;
 
-  /// Orientation matrix of the goniometer angles.
-  Mantid::Kernel::Matrix<double> m_GoniometerMatrix;
-
-  /// Inverse of the goniometer rotation matrix; used to go from Q in lab frame
-  /// to Q in sample frame
-  Mantid::Kernel::Matrix<double> m_InverseGoniometerMatrix;
+  /// Orientation matrix of the goniometer angles and its inverse, used to go
+  /// from Q in lab frame to Q in sample frame. Shared by the peaks of a run.
+  GoniometerMatrices_const_sptr m_goniometer;
 
   /// Originating run number for this peak
   int m_runNumber;
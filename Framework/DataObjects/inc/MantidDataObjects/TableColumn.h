@@ -232,6 +232,8 @@ protected:
   }
   /// Removes an item at index.
   void remove(size_t index) override { m_data.erase(m_data.begin() + index); }
+  /// Removes the items at several indices.
+  void removeRows(const std::vector<size_t> &indices) override;
   /// Returns a pointer to the data element.
   void *void_pointer(size_t index) override { return &m_data.at(index); }
   /// Returns a pointer to the data element.
@@ -449,18 +451,36 @@ void TableColumn<Type>::read(size_t index, std::istringstream &in) {
   m_data[index] = t;
 }
 
+/// Remove the items at the given indices, moving each of the remaining
+/// items at most once. @see Column::removeRows
+template <typename Type>
+void TableColumn<Type>::removeRows(const std::vector<size_t> &indices) {
+  if (indices.empty())
+    return;
+  auto nextRemoved = indices.cbegin();
+  size_t kept = indices.front();
+  for (size_t i = kept; i < m_data.size(); ++i) {
+    if (nextRemoved != indices.cend() && *nextRemoved == i) {
+      ++nextRemoved;
+      continue;
+    }
+    m_data[kept++] = std::move(m_data[i]);
+  }
+  m_data.resize(kept);
+}
+
 namespace {
-/// Comparison object to compare column values given their indices.
-template <typename Type> class CompareValues {
+/// Comparison object to compare column values given their indices. The order
+/// is a template parameter so that it is not tested on every comparison.
+template <typename Type, bool Ascending> class CompareValues {
   const std::vector<Type> &m_data;
-  const bool m_ascending;
 
 public:
-  CompareValues(const TableColumn<Type> &column, bool ascending)
-      : m_data(column.data()), m_ascending(ascending) {}
-  bool operator()(size_t i, size_t j) {
-    return m_ascending ? m_data[i] < m_data[j]
-                       : !(m_data[i] < m_data[j] || m_data[i] == m_data[j]);
+  explicit CompareValues(const TableColumn<Type> &column)
+      : m_data(column.data()) {}
+  bool operator()(size_t i, size_t j) const {
+    return Ascending ? m_data[i] < m_data[j]
+                     : !(m_data[i] < m_data[j] || m_data[i] == m_data[j]);
   }
 };
 } // namespace
@@ -481,7 +501,11 @@ void TableColumn<Type>::sortIndex(
   auto iBegin = indexVec.begin() + start;
   auto iEnd = indexVec.begin() + end;
 
-  std::stable_sort(iBegin, iEnd, CompareValues<Type>(*this, ascending));
+  if (ascending) {
+    std::stable_sort(iBegin, iEnd, CompareValues<Type, true>(*this));
+  } else {
+    std::stable_sort(iBegin, iEnd, CompareValues<Type, false>(*this));
+  }
 
   bool same = false;
   size_t eqStart = 0;
@@ -513,11 +537,10 @@ void TableColumn<Type>::sortIndex(
 template <typename Type>
 void TableColumn<Type>::sortValues(const std::vector<size_t> &indexVec) {
   assert(m_data.size() == indexVec.size());
-  std::vector<Type> sortedData(m_data.size());
-
-  auto sortedIt = sortedData.begin();
-  for (auto idx = indexVec.begin(); idx != indexVec.end(); ++idx, ++sortedIt) {
-    *sortedIt = m_data[*idx];
+  std::vector<Type> sortedData;
+  sortedData.reserve(m_data.size());
+  for (const auto idx : indexVec) {
+    sortedData.push_back(std::move(m_data[idx]));
   }
 
   std::swap(m_data, sortedData);
@@ -210,6 +210,8 @@ public:
   size_t insertRow(size_t index) override;
   /// Delets a row if it exists.
   void removeRow(size_t index) override;
+  /// Deletes several rows at once.
+  void removeRows(const std::vector<size_t> &indices) override;
 
   /** This method finds the row and column index of an integer cell value in a
    * table workspace
@@ -95,8 +95,8 @@ protected:
   /// a vector holding workspace index of monitors in the workspace
   std::vector<specnum_t> m_monitorList;
 
-  /// A vector that holds the 1D histograms
-  std::vector<std::unique_ptr<Histogram1D>> data;
+  /// A vector that holds the 1D histograms in one contiguous block
+  std::vector<Histogram1D> data;
 
 private:
   Workspace2D *doClone() const override;
@@ -224,12 +224,13 @@ void BoxControllerNeXusIO::prepareNxSToWrite_CurVersion() {
     chunk[0] = static_cast<int64_t>(m_dataChunk);
 
     // Make and open the data
+    const auto compression = m_compress ? ::NeXus::LZW : ::NeXus::NONE;
     if (m_CoordSize == 4)
       m_File->makeCompData("event_data", ::NeXus::FLOAT32, m_BlockSize,
-                           ::NeXus::NONE, chunk, true);
+                           compression, chunk, true);
     else
       m_File->makeCompData("event_data", ::NeXus::FLOAT64, m_BlockSize,
-                           ::NeXus::NONE, chunk, true);
+                           compression, chunk, true);
 
     // A little bit of description for humans to read later
     m_File->putAttr("description", m_EventsTypeHeaders[m_EventType]);
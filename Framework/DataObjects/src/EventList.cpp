@@ -8,10 +8,13 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidDataObjects/Histogram1D.h"
+#include "MantidHistogramData/BinIndexer.h"
 #include "MantidKernel/DateAndTime.h"
 #include "MantidKernel/DateAndTimeHelpers.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/RadixSort.h"
+#include "MantidKernel/RuntimeCounters.h"
 #include "MantidKernel/Unit.h"
 
 #ifdef _MSC_VER
@@ -23,6 +26,7 @@
 #pragma warning(default : 4180)
 #endif
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -44,6 +48,10 @@ namespace {
 
 const double SEC_TO_NANO = 1.e9;
 
+/// Event lists longer than this are histogrammed in parallel, if the
+/// histogramming is not already called from a parallel region
+const size_t PARALLEL_HISTOGRAM_MIN_EVENTS = 1000000;
+
 /**
  * Calculate the corrected full time in nanoseconds
  * @param event : The event with pulse time and time-of-flight
@@ -91,6 +99,32 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/**
+ * Merge consecutive runs of events sorted by TOF, in place, pairwise until
+ * the whole vector is sorted.
+ * @param events : the events, made of the sorted runs
+ * @param runEnds : the position of the end of each run
+ */
+template <class T>
+void mergeSortedRuns(std::vector<T> &events, std::vector<size_t> runEnds) {
+  while (runEnds.size() > 1) {
+    std::vector<size_t> merged;
+    merged.reserve(runEnds.size() / 2 + 1);
+    size_t begin = 0;
+    for (size_t i = 0; i < runEnds.size(); i += 2) {
+      if (i + 1 < runEnds.size()) {
+        std::inplace_merge(events.begin() + begin, events.begin() + runEnds[i],
+                           events.begin() + runEnds[i + 1]);
+        merged.push_back(runEnds[i + 1]);
+      } else {
+        merged.push_back(runEnds[i]);
+      }
+      begin = merged.back();
+    }
+    runEnds.swap(merged);
+  }
+}
 } // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -379,6 +413,10 @@ EventList &EventList::operator+=(const TofEvent &event) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
+  MantidVec appendedY, appendedE;
+  const bool updateMRU =
+      histogramAppendedEvents(more_events, appendedY, appendedE);
+
   switch (this->eventType) {
   case TOF:
     // Simply push the events
@@ -407,6 +445,8 @@ EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
   }
 
   this->order = UNSORTED;
+  if (updateMRU)
+    addToHistogramInMRU(appendedY, appendedE);
   return *this;
 }
 
@@ -435,6 +475,10 @@ EventList &EventList::operator+=(const WeightedEvent &event) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEvent> &more_events) {
+  MantidVec appendedY, appendedE;
+  const bool updateMRU =
+      histogramAppendedEvents(more_events, appendedY, appendedE);
+
   switch (this->eventType) {
   case TOF:
     // Need to switch to weighted
@@ -459,6 +503,8 @@ operator+=(const std::vector<WeightedEvent> &more_events) {
   }
 
   this->order = UNSORTED;
+  if (updateMRU)
+    addToHistogramInMRU(appendedY, appendedE);
   return *this;
 }
 
@@ -472,6 +518,10 @@ operator+=(const std::vector<WeightedEvent> &more_events) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEventNoTime> &more_events) {
+  MantidVec appendedY, appendedE;
+  const bool updateMRU =
+      histogramAppendedEvents(more_events, appendedY, appendedE);
+
   switch (this->eventType) {
   case TOF:
   case WEIGHTED:
@@ -487,9 +537,64 @@ operator+=(const std::vector<WeightedEventNoTime> &more_events) {
   }
 
   this->order = UNSORTED;
+  if (updateMRU)
+    addToHistogramInMRU(appendedY, appendedE);
   return *this;
 }
 
+// --------------------------------------------------------------------------
+/** Histogram events that are about to be appended, if the histogram of this
+ * list is in the MRU and can be updated with them rather than regenerated.
+ * A histogram in the MRU that no longer matches the number of events is
+ * dropped.
+ *
+ * @param appended :: the events that will be appended
+ * @param Y :: returns the counts of the appended events
+ * @param E :: returns the errors of the appended events
+ * @return true if the histogram in the MRU is to be updated with Y and E
+ */
+template <class T>
+bool EventList::histogramAppendedEvents(const std::vector<T> &appended,
+                                        MantidVec &Y, MantidVec &E) {
+  const size_t numberOfEventsInMRU = m_numberOfEventsInMRU;
+  if (!mru || appended.empty() ||
+      numberOfEventsInMRU == std::numeric_limits<size_t>::max())
+    return false;
+  if (numberOfEventsInMRU != getNumberEvents()) {
+    mru->deleteIndex(this);
+    m_numberOfEventsInMRU = std::numeric_limits<size_t>::max();
+    return false;
+  }
+  // Histogram a copy, the appended events may be those of this list
+  const EventList appendedList(appended);
+  appendedList.generateHistogram(readX(), Y, E);
+  return true;
+}
+
+/** Add the histogram of events just appended to the histogram of this list in
+ * the MRU, so that reading it does not histogram all the events again.
+ *
+ * @param appendedY :: counts of the appended events
+ * @param appendedE :: errors of the appended events
+ */
+void EventList::addToHistogramInMRU(const MantidVec &appendedY,
+                                    const MantidVec &appendedE) {
+  mru->updateIndex(this, [&](EventWorkspaceMRU::YType &y,
+                             EventWorkspaceMRU::EType &e) {
+    if (y->size() != appendedY.size() || e->size() != appendedE.size())
+      return false;
+    auto &newY = y.access();
+    std::transform(newY.begin(), newY.end(), appendedY.begin(), newY.begin(),
+                   std::plus<double>());
+    auto &newE = e.access();
+    std::transform(
+        newE.begin(), newE.end(), appendedE.begin(), newE.begin(),
+        [](const double e1, const double e2) { return std::hypot(e1, e2); });
+    return true;
+  });
+  m_numberOfEventsInMRU = getNumberEvents();
+}
+
 // --------------------------------------------------------------------------
 /** Append another EventList to this event list.
  * The event lists are concatenated, and a union of the sets of detector ID's is
@@ -523,6 +628,112 @@ EventList &EventList::operator+=(const EventList &more_events) {
   return *this;
 }
 
+// --------------------------------------------------------------------------
+/** Append another EventList to this event list, like operator+=. If both
+ * lists are sorted by TOF (or empty), the events are merged so that the
+ * result is sorted by TOF as well, without sorting it again.
+ *
+ * @param more_events :: Another EventList.
+ * @return reference to this
+ * */
+EventList &EventList::mergeSorted(const EventList &more_events) {
+  const size_t numberOfEvents = getNumberEvents();
+  const bool sorted =
+      (this->order == TOF_SORT || numberOfEvents == 0) &&
+      (more_events.order == TOF_SORT || more_events.empty());
+  *this += more_events;
+  if (!sorted)
+    return *this;
+
+  switch (eventType) {
+  case TOF:
+    std::inplace_merge(events.begin(), events.begin() + numberOfEvents,
+                       events.end());
+    break;
+  case WEIGHTED:
+    std::inplace_merge(weightedEvents.begin(),
+                       weightedEvents.begin() + numberOfEvents,
+                       weightedEvents.end());
+    break;
+  case WEIGHTED_NOTIME:
+    std::inplace_merge(weightedEventsNoTime.begin(),
+                       weightedEventsNoTime.begin() + numberOfEvents,
+                       weightedEventsNoTime.end());
+    break;
+  }
+  this->order = TOF_SORT;
+  return *this;
+}
+
+// --------------------------------------------------------------------------
+/** Append the events of several other lists to this event list, like
+ * operator+=, reserving the space for all of them at once. If this list and
+ * all the others are sorted by TOF (or empty), the sorted runs of events are
+ * merged pairwise, in log2 of the number of lists passes, so that the result
+ * is sorted by TOF as well.
+ *
+ * @param more_lists :: the lists to append.
+ * @return reference to this
+ * */
+EventList &
+EventList::mergeSorted(const std::vector<const EventList *> &more_lists) {
+  size_t numberOfEvents = getNumberEvents();
+  bool sorted = this->order == TOF_SORT || numberOfEvents == 0;
+  EventType type = eventType;
+  for (const auto list : more_lists) {
+    numberOfEvents += list->getNumberEvents();
+    sorted = sorted && (list->order == TOF_SORT || list->empty());
+    type = std::max(type, list->getEventType());
+  }
+  this->switchTo(type);
+  this->reserve(numberOfEvents);
+
+  std::vector<size_t> runEnds;
+  runEnds.reserve(more_lists.size() + 1);
+  runEnds.push_back(getNumberEvents());
+  for (const auto list : more_lists) {
+    *this += *list;
+    runEnds.push_back(getNumberEvents());
+  }
+  if (!sorted)
+    return *this;
+
+  switch (eventType) {
+  case TOF:
+    mergeSortedRuns(events, std::move(runEnds));
+    break;
+  case WEIGHTED:
+    mergeSortedRuns(weightedEvents, std::move(runEnds));
+    break;
+  case WEIGHTED_NOTIME:
+    mergeSortedRuns(weightedEventsNoTime, std::move(runEnds));
+    break;
+  }
+  this->order = TOF_SORT;
+  return *this;
+}
+
+// --------------------------------------------------------------------------
+/** Swap the events of this list with those of another list, without copying
+ * them. The event types and sort orders are swapped as well, the detector IDs
+ * and spectrum numbers are not.
+ *
+ * @param other :: the list to swap the events with
+ * */
+void EventList::swapEvents(EventList &other) {
+  if (mru)
+    mru->deleteIndex(this);
+  if (other.mru)
+    other.mru->deleteIndex(&other);
+  m_numberOfEventsInMRU = std::numeric_limits<size_t>::max();
+  other.m_numberOfEventsInMRU = std::numeric_limits<size_t>::max();
+  std::swap(this->eventType, other.eventType);
+  std::swap(this->order, other.order);
+  this->events.swap(other.events);
+  this->weightedEvents.swap(other.weightedEvents);
+  this->weightedEventsNoTime.swap(other.weightedEventsNoTime);
+}
+
 // --------------------------------------------------------------------------
 /** SUBTRACT another EventList from this event list.
  * The event lists are concatenated, but the weights of the incoming
@@ -934,21 +1145,128 @@ void EventList::clearData() { this->clear(false); }
  */
 void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
 
-/** Reserve a certain number of entries in the (NOT-WEIGHTED) event list. Do NOT
- *call
- * on weighted events!
+/** Reserve a certain number of entries in the event list of the current
+ * event type.
  *
  * Calls std::vector<>::reserve() in order to pre-allocate the length of the
  *event list vector.
  *
  * @param num :: number of events that will be in this EventList
  */
-void EventList::reserve(size_t num) { this->events.reserve(num); }
+void EventList::reserve(size_t num) {
+  switch (eventType) {
+  case TOF:
+    this->events.reserve(num);
+    break;
+  case WEIGHTED:
+    this->weightedEvents.reserve(num);
+    break;
+  case WEIGHTED_NOTIME:
+    this->weightedEventsNoTime.reserve(num);
+    break;
+  }
+}
+
+/** Release any capacity beyond the events currently held, so that the events
+ * occupy a single block of exactly the right size. The vectors of the unused
+ * event types are released as well.
+ *
+ * This reallocates the event vector if it has spare capacity, so it is
+ * intended to be called once, after all events have been added.
+ */
+void EventList::shrinkToFit() {
+  this->clearUnused();
+  switch (eventType) {
+  case TOF:
+    if (this->events.capacity() > this->events.size())
+      this->events.shrink_to_fit();
+    break;
+  case WEIGHTED:
+    if (this->weightedEvents.capacity() > this->weightedEvents.size())
+      this->weightedEvents.shrink_to_fit();
+    break;
+  case WEIGHTED_NOTIME:
+    if (this->weightedEventsNoTime.capacity() >
+        this->weightedEventsNoTime.size())
+      this->weightedEventsNoTime.shrink_to_fit();
+    break;
+  }
+}
 
 // ==============================================================================================
 // --- Sorting functions -----------------------------------------------------
 // ==============================================================================================
 
+namespace {
+/// Event lists shorter than this are sorted by comparison rather than radix
+const size_t RADIX_SORT_MIN_EVENTS = 512;
+
+template <class T> uint64_t tofKey(const T &event) {
+  return Kernel::RadixSort::doubleKey(event.tof());
+}
+
+template <class T> uint64_t pulseTimeKey(const T &event) {
+  return Kernel::RadixSort::int64Key(event.pulseTime().totalNanoseconds());
+}
+
+/// Sort a vector of events by TOF
+template <class T> void sortEventsByTof(std::vector<T> &events) {
+  if (events.size() < RADIX_SORT_MIN_EVENTS)
+    tbb::parallel_sort(events.begin(), events.end());
+  else
+    Kernel::RadixSort::sort(events, tofKey<T>);
+}
+
+/// Sort a vector of events by pulse time. Events with equal pulse times keep
+/// their relative order.
+template <class T> void sortEventsByPulseTime(std::vector<T> &events) {
+  if (events.size() < RADIX_SORT_MIN_EVENTS)
+    std::stable_sort(events.begin(), events.end(), compareEventPulseTime);
+  else
+    Kernel::RadixSort::sort(events, pulseTimeKey<T>);
+}
+
+/// Sort a vector of events that is already sorted by pulse time by TOF
+/// within each pulse. Each pulse is a contiguous run of events, so only
+/// these runs need sorting.
+template <class T> void sortEventsByTofWithinPulses(std::vector<T> &events) {
+  auto first = events.begin();
+  while (first != events.end()) {
+    auto last =
+        std::upper_bound(first, events.end(), *first, compareEventPulseTime);
+    if (std::distance(first, last) > 1)
+      std::sort(first, last);
+    first = last;
+  }
+}
+
+/// Sort a vector of events by pulse time, then TOF
+template <class T>
+void sortEventsByPulseTimeTof(std::vector<T> &events,
+                              const bool sortedByPulseTime) {
+  if (sortedByPulseTime) {
+    sortEventsByTofWithinPulses(events);
+  } else if (events.size() < RADIX_SORT_MIN_EVENTS) {
+    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+  } else {
+    // The radix sort is stable, so sorting by the least significant key
+    // first yields the composite order
+    Kernel::RadixSort::sort(events, tofKey<T>);
+    Kernel::RadixSort::sort(events, pulseTimeKey<T>);
+  }
+}
+
+/// Count a sort of an event list in the runtime counters
+void countSort(const size_t numberOfEvents) {
+  static auto &sorts =
+      Kernel::RuntimeCounters::Instance().counter("eventlist_sorts");
+  static auto &sortedEvents =
+      Kernel::RuntimeCounters::Instance().counter("eventlist_sorted_events");
+  sorts.fetch_add(1, std::memory_order_relaxed);
+  sortedEvents.fetch_add(numberOfEvents, std::memory_order_relaxed);
+}
+} // namespace
+
 // --------------------------------------------------------------------------
 /** Sort events by TOF or Frame
  * @param order :: Order by which to sort.
@@ -997,16 +1315,16 @@ void EventList::sortTof() const {
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end());
+    sortEventsByTof(events);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end());
+    sortEventsByTof(weightedEvents);
     break;
   case WEIGHTED_NOTIME:
-    tbb::parallel_sort(weightedEventsNoTime.begin(),
-                       weightedEventsNoTime.end());
+    sortEventsByTof(weightedEventsNoTime);
     break;
   }
+  countSort(getNumberEvents());
   // Save the order to avoid unnecessary re-sorting.
   this->order = TOF_SORT;
 }
@@ -1069,16 +1387,16 @@ void EventList::sortPulseTime() const {
   // Perform sort.
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTime);
+    sortEventsByPulseTime(events);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTime);
+    sortEventsByPulseTime(weightedEvents);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
     break;
   }
+  countSort(getNumberEvents());
   // Save the order to avoid unnecessary re-sorting.
   this->order = PULSETIME_SORT;
 }
@@ -1097,19 +1415,22 @@ void EventList::sortPulseTimeTOF() const {
   if (this->order == PULSETIMETOF_SORT)
     return;
 
+  // Lists that are already in pulse time order, as loaded from file, only
+  // need sorting by TOF within each pulse
+  const bool sortedByPulseTime = (this->order == PULSETIME_SORT);
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+    sortEventsByPulseTimeTof(events, sortedByPulseTime);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTimeTOF);
+    sortEventsByPulseTimeTof(weightedEvents, sortedByPulseTime);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
     break;
   }
 
+  countSort(getNumberEvents());
   // Save
   this->order = PULSETIMETOF_SORT;
 }
@@ -1376,7 +1697,6 @@ Kernel::cow_ptr<HistogramData::HistogramY> EventList::sharedY() const {
 
   // Is the data in the mrulist?
   if (mru) {
-    mru->ensureEnoughBuffersY(thread);
     yData = mru->findY(thread, this);
   }
 
@@ -1390,9 +1710,9 @@ Kernel::cow_ptr<HistogramData::HistogramY> EventList::sharedY() const {
 
     // Lets save it in the MRU
     if (mru) {
+      m_numberOfEventsInMRU = getNumberEvents();
       mru->insertY(thread, yData, this);
       auto eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
-      mru->ensureEnoughBuffersE(thread);
       mru->insertE(thread, eData, this);
     }
   }
@@ -1406,7 +1726,6 @@ Kernel::cow_ptr<HistogramData::HistogramE> EventList::sharedE() const {
 
   // Is the data in the mrulist?
   if (mru) {
-    mru->ensureEnoughBuffersE(thread);
     eData = mru->findE(thread, this);
   }
 
@@ -1418,8 +1737,10 @@ Kernel::cow_ptr<HistogramData::HistogramE> EventList::sharedE() const {
     eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
 
     // Lets save it in the MRU
-    if (mru)
+    if (mru) {
+      m_numberOfEventsInMRU = getNumberEvents();
       mru->insertE(thread, eData, this);
+    }
   }
   return eData;
 }
@@ -1483,6 +1804,30 @@ EventList::compressEventsHelper(const std::vector<T> &events,
   // We will make a starting guess of 1/20th of the number of input events.
   out.reserve(events.size() / 20);
 
+  compressEventsHelper(events.cbegin(), events.cend(), out, tolerance);
+
+  // If you have over-allocated by more than 5%, reduce the size.
+  size_t excess_limit = out.size() / 20;
+  if ((out.capacity() - out.size()) > excess_limit) {
+    out.shrink_to_fit();
+  }
+}
+
+// --------------------------------------------------------------------------
+/** Compress a range of TOF-sorted events by grouping events with the same
+ * TOF, appending the compressed events to the output.
+ *
+ * @param first :: start of the range of events.
+ * @param last :: end of the range of events.
+ * @param out :: output WeightedEventNoTime vector.
+ * @param tolerance :: how close do two event's TOF have to be to be considered
+ *the same.
+ */
+template <class ConstIterator>
+inline void
+EventList::compressEventsHelper(ConstIterator first, ConstIterator last,
+                                std::vector<WeightedEventNoTime> &out,
+                                double tolerance) {
   // The last TOF to which we are comparing.
   double lastTof = std::numeric_limits<double>::lowest();
   // For getting an accurate average TOF
@@ -1493,7 +1838,7 @@ EventList::compressEventsHelper(const std::vector<T> &events,
   double errorSquared = 0;
   double normalization = 0.;
 
-  for (auto it = events.cbegin(); it != events.cend(); it++) {
+  for (auto it = first; it != last; it++) {
     if ((it->m_tof - lastTof) <= tolerance) {
       // Carry the error and weight
       weight += it->weight();
@@ -1532,19 +1877,18 @@ EventList::compressEventsHelper(const std::vector<T> &events,
   } else if (num > 1) {
     out.emplace_back(totalTof / normalization, weight, errorSquared);
   }
-
-  // If you have over-allocated by more than 5%, reduce the size.
-  size_t excess_limit = out.size() / 20;
-  if ((out.capacity() - out.size()) > excess_limit) {
-    out.shrink_to_fit();
-  }
 }
 
 // --------------------------------------------------------------------------
 /** Compress the event list by grouping events with the same TOF.
  * Performs the compression in parallel.
  *
- * @param events :: input event list.
+ * The events are split in TOF ranges, one per thread, which are compressed
+ * independently and then concatenated. A range only starts at an event more
+ * than the tolerance away from the previous one: such an event always starts
+ * a new compressed event, so the result is the same as compressing serially.
+ *
+ * @param events :: input event list, sorted by TOF.
  * @param out :: output WeightedEventNoTime vector.
  * @param tolerance :: how close do two event's TOF have to be to be considered
  *the same.
@@ -1554,84 +1898,46 @@ template <class T>
 void EventList::compressEventsParallelHelper(
     const std::vector<T> &events, std::vector<WeightedEventNoTime> &out,
     double tolerance) {
-  // Create a local output vector for each thread
-  int numThreads = PARALLEL_GET_MAX_THREADS;
-  std::vector<std::vector<WeightedEventNoTime>> outputs(numThreads);
-  // This is how many events to process in each thread.
-  size_t numPerBlock = events.size() / numThreads;
+  const auto numThreads =
+      static_cast<size_t>(std::max(PARALLEL_GET_MAX_THREADS, 1));
+  const size_t numEvents = events.size();
+
+  // Find where each range starts
+  std::vector<size_t> starts{0};
+  for (size_t range = 1; range < numThreads; ++range) {
+    size_t start = std::max(range * numEvents / numThreads, starts.back() + 1);
+    while (start < numEvents &&
+           (events[start].m_tof - events[start - 1].m_tof) <= tolerance)
+      ++start;
+    if (start >= numEvents)
+      break;
+    starts.push_back(start);
+  }
+  starts.push_back(numEvents);
 
-  // Do each block in parallel
+  // Compress each range in parallel, to a local output vector
+  const auto numRanges = static_cast<int>(starts.size() - 1);
+  std::vector<std::vector<WeightedEventNoTime>> outputs(numRanges);
   PARALLEL_FOR_NO_WSP_CHECK()
-  for (int thread = 0; thread < numThreads; thread++) {
-    // The local output vector
-    std::vector<WeightedEventNoTime> &localOut = outputs[thread];
+  for (int range = 0; range < numRanges; range++) {
+    auto &localOut = outputs[range];
     // Reserve a bit of space to avoid excess copying
-    localOut.clear();
-    localOut.reserve(numPerBlock / 20);
-
-    // The last TOF to which we are comparing.
-    double lastTof = std::numeric_limits<double>::lowest();
-    // For getting an accurate average TOF
-    double totalTof = 0;
-    int num = 0;
-    // Carrying weight, error, and normalization
-    double weight = 0;
-    double errorSquared = 0;
-    double normalization = 0.;
-
-    // Separate the
-    typename std::vector<T>::const_iterator it =
-        events.begin() + thread * numPerBlock;
-    typename std::vector<T>::const_iterator it_end =
-        events.begin() + (thread + 1) * numPerBlock; // cache for speed
-    if (thread == numThreads - 1)
-      it_end = events.end();
-    for (; it != it_end; ++it) {
-      if ((it->m_tof - lastTof) <= tolerance) {
-        // Carry the error and weight
-        weight += it->weight();
-        errorSquared += it->errorSquared();
-        // Track the average tof
-        num++;
-        const double norm = calcNorm(it->errorSquared());
-        normalization += norm;
-        totalTof += it->m_tof * norm;
-      } else {
-        // We exceeded the tolerance
-        if (num > 0) {
-          // Create a new event with the average TOF and summed weights and
-          // squared errors.
-          localOut.emplace_back(totalTof / normalization, weight, errorSquared);
-        }
-        // Start a new combined object
-        num = 1;
-        const double norm = calcNorm(it->errorSquared());
-        normalization = norm;
-        totalTof = it->m_tof * norm;
-        weight = it->weight();
-        errorSquared = it->errorSquared();
-        lastTof = it->m_tof;
-      }
-    }
-
-    // Put the last event in there too.
-    if (num > 0) {
-      // Create a new event with the average TOF and summed weights and squared
-      // errors.
-      localOut.emplace_back(totalTof / normalization, weight, errorSquared);
-    }
+    localOut.reserve((starts[range + 1] - starts[range]) / 20);
+    compressEventsHelper(events.cbegin() + starts[range],
+                         events.cbegin() + starts[range + 1], localOut,
+                         tolerance);
   }
 
   // Clear the output. Reserve the required size
   out.clear();
-  size_t numEvents = 0;
-  for (int thread = 0; thread < numThreads; thread++)
-    numEvents += outputs[thread].size();
-  out.reserve(numEvents);
+  size_t numOutput = 0;
+  for (const auto &localOut : outputs)
+    numOutput += localOut.size();
+  out.reserve(numOutput);
 
   // Re-join all the outputs
-  for (int thread = 0; thread < numThreads; thread++)
-    out.insert(out.end(), outputs[thread].begin(), outputs[thread].end());
+  for (const auto &localOut : outputs)
+    out.insert(out.end(), localOut.begin(), localOut.end());
 }
 
 template <class T>
@@ -1751,27 +2057,32 @@ inline void EventList::compressFatEventsHelper(
  *the same.
  * @param destination :: EventList that will receive the compressed events. Can
  *be == this.
+ * @param parallel :: compress TOF ranges of the list in parallel. Only worth
+ *it for lists with many events, such as monitors or summed banks.
  */
-void EventList::compressEvents(double tolerance, EventList *destination) {
+void EventList::compressEvents(double tolerance, EventList *destination,
+                               bool parallel) {
   if (!this->empty()) {
     this->sortTof();
     switch (eventType) {
     case TOF:
-      //      if (parallel)
-      //        compressEventsParallelHelper(this->events,
-      //        destination->weightedEventsNoTime, tolerance);
-      //      else
-      compressEventsHelper(this->events, destination->weightedEventsNoTime,
-                           tolerance);
+      if (parallel)
+        compressEventsParallelHelper(this->events,
+                                     destination->weightedEventsNoTime,
+                                     tolerance);
+      else
+        compressEventsHelper(this->events, destination->weightedEventsNoTime,
+                             tolerance);
       break;
 
     case WEIGHTED:
-      //      if (parallel)
-      //        compressEventsParallelHelper(this->weightedEvents,
-      //        destination->weightedEventsNoTime, tolerance);
-      //      else
-      compressEventsHelper(this->weightedEvents,
-                           destination->weightedEventsNoTime, tolerance);
+      if (parallel)
+        compressEventsParallelHelper(this->weightedEvents,
+                                     destination->weightedEventsNoTime,
+                                     tolerance);
+      else
+        compressEventsHelper(this->weightedEvents,
+                             destination->weightedEventsNoTime, tolerance);
 
       break;
 
@@ -1779,21 +2090,21 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
       if (destination == this) {
         // Put results in a temp output
         std::vector<WeightedEventNoTime> out;
-        //        if (parallel)
-        //          compressEventsParallelHelper(this->weightedEventsNoTime,
-        //          out,
-        //          tolerance);
-        //        else
-        compressEventsHelper(this->weightedEventsNoTime, out, tolerance);
+        if (parallel)
+          compressEventsParallelHelper(this->weightedEventsNoTime, out,
+                                       tolerance);
+        else
+          compressEventsHelper(this->weightedEventsNoTime, out, tolerance);
         // Put it back
         this->weightedEventsNoTime.swap(out);
       } else {
-        //        if (parallel)
-        //          compressEventsParallelHelper(this->weightedEventsNoTime,
-        //          destination->weightedEventsNoTime, tolerance);
-        //        else
-        compressEventsHelper(this->weightedEventsNoTime,
-                             destination->weightedEventsNoTime, tolerance);
+        if (parallel)
+          compressEventsParallelHelper(this->weightedEventsNoTime,
+                                       destination->weightedEventsNoTime,
+                                       tolerance);
+        else
+          compressEventsHelper(this->weightedEventsNoTime,
+                               destination->weightedEventsNoTime, tolerance);
       }
       break;
     }
@@ -2113,8 +2424,62 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
  */
 void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
                                   MantidVec &E, bool skipError) const {
-  // All types of weights need to be sorted by TOF
+  if (this->order == TOF_SORT || this->empty()) {
+    this->generateHistogramSorted(X, Y, E, skipError);
+    return;
+  }
+  const HistogramData::BinIndexer indexer(X);
+  this->generateHistogram(indexer, X, Y, E, skipError);
+}
+
+// --------------------------------------------------------------------------
+/** Generates both the Y and E (error) histograms w.r.t TOF, using a bin lookup
+ * that has already been prepared for X. This avoids preparing the lookup again
+ * when many event lists are histogrammed with the same bins.
+ *
+ * @param indexer: bin lookup created from X
+ * @param X: x-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error. This has no effect for weighted
+ *        events; you can just ignore the returned E vector.
+ */
+void EventList::generateHistogram(const HistogramData::BinIndexer &indexer,
+                                  const MantidVec &X, MantidVec &Y,
+                                  MantidVec &E, bool skipError) const {
+  // Linear and logarithmic bins can be filled directly, without sorting
+  if (this->order != TOF_SORT && !this->empty() &&
+      indexer.spacing() != HistogramData::BinIndexer::Spacing::Arbitrary) {
+    switch (eventType) {
+    case TOF:
+      histogramUnsortedHelper(this->events, indexer, Y, nullptr);
+      if (!skipError)
+        this->generateErrorsHistogram(Y, E);
+      break;
+    case WEIGHTED:
+      histogramUnsortedHelper(this->weightedEvents, indexer, Y, &E);
+      break;
+    case WEIGHTED_NOTIME:
+      histogramUnsortedHelper(this->weightedEventsNoTime, indexer, Y, &E);
+      break;
+    }
+    return;
+  }
+  this->generateHistogramSorted(X, Y, E, skipError);
+}
 
+// --------------------------------------------------------------------------
+/** Generates both the Y and E (error) histograms w.r.t TOF after sorting the
+ * events by TOF.
+ *
+ * @param X: x-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error.
+ */
+void EventList::generateHistogramSorted(const MantidVec &X, MantidVec &Y,
+                                        MantidVec &E, bool skipError) const {
+  // All types of weights need to be sorted by TOF
   this->sortTof();
 
   switch (eventType) {
@@ -2135,6 +2500,80 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
   }
 }
 
+// --------------------------------------------------------------------------
+/** Fill a histogram with events that need not be sorted, using the closed-form
+ * bin lookup of a BinIndexer. The bin indices are computed in blocks so that
+ * the lookup vectorizes. Long lists are split between threads, each of which
+ * fills its own partial histogram; the partial histograms are then summed.
+ *
+ * @param events :: vector of events, in any order
+ * @param indexer :: bin lookup for the X bins
+ * @param Y :: counts (or summed weights) returned
+ * @param E :: if not null, errors are returned here, computed from the
+ *        squared errors of the events
+ */
+template <class T>
+void EventList::histogramUnsortedHelper(
+    const std::vector<T> &events, const HistogramData::BinIndexer &indexer,
+    MantidVec &Y, MantidVec *E) {
+  const size_t numBins = indexer.numberOfBins();
+  const size_t numEvents = events.size();
+  Y.assign(numBins, 0.0);
+  if (E)
+    E->assign(numBins, 0.0);
+
+  int numChunks = 1;
+  if (numEvents >= PARALLEL_HISTOGRAM_MIN_EVENTS &&
+      PARALLEL_NUMBER_OF_THREADS == 1)
+    numChunks = PARALLEL_GET_MAX_THREADS;
+  const size_t chunkSize = numEvents / numChunks;
+  // The first chunk fills the output directly
+  std::vector<MantidVec> partialY(numChunks - 1, MantidVec(numBins, 0.0));
+  std::vector<MantidVec> partialE(E ? numChunks - 1 : 0,
+                                  MantidVec(numBins, 0.0));
+
+  PARALLEL_FOR_IF(numChunks > 1)
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    double *y = chunk == 0 ? Y.data() : partialY[chunk - 1].data();
+    double *e = nullptr;
+    if (E)
+      e = chunk == 0 ? E->data() : partialE[chunk - 1].data();
+    const size_t begin = chunk * chunkSize;
+    const size_t end = chunk == numChunks - 1 ? numEvents : begin + chunkSize;
+
+    constexpr size_t blockSize = 256;
+    double tofs[blockSize];
+    size_t bins[blockSize];
+    for (size_t start = begin; start < end; start += blockSize) {
+      const size_t n = std::min(blockSize, end - start);
+      for (size_t i = 0; i < n; ++i)
+        tofs[i] = events[start + i].tof();
+      indexer.indices(tofs, n, bins);
+      for (size_t i = 0; i < n; ++i) {
+        const size_t bin = bins[i];
+        if (bin == numBins)
+          continue;
+        const T &event = events[start + i];
+        y[bin] += event.weight();
+        if (e)
+          e[bin] += event.errorSquared();
+      }
+    }
+  }
+
+  for (int chunk = 1; chunk < numChunks; ++chunk) {
+    std::transform(Y.begin(), Y.end(), partialY[chunk - 1].begin(), Y.begin(),
+                   std::plus<double>());
+    if (E)
+      std::transform(E->begin(), E->end(), partialE[chunk - 1].begin(),
+                     E->begin(), std::plus<double>());
+  }
+
+  if (E)
+    std::transform(E->begin(), E->end(), E->begin(),
+                   static_cast<double (*)(double)>(sqrt));
+}
+
 // --------------------------------------------------------------------------
 /** With respect to PulseTime Fill a histogram given specified histogram bounds.
  * Does not modify
@@ -4008,6 +4447,50 @@ void EventList::filterInPlace(Kernel::TimeSplitterType &splitter) {
   }
 }
 
+//------------------------------------------------------------------------------------------------
+/** Filter a vector of either TofEvent's or WeightedEvent's in place, keeping
+ * the events whose pulse time is in one of the intervals of the splitter.
+ *
+ * @param splitter :: the index of the splitter
+ * @param events :: either this->events or this->weightedEvents.
+ */
+template <class T>
+void EventList::filterInPlaceHelper(const Kernel::TimeSplitterIndex &splitter,
+                                    typename std::vector<T> &events) {
+  events.erase(std::remove_if(events.begin(), events.end(),
+                              [&splitter](const T &event) {
+                                return splitter.destination(
+                                           event.m_pulsetime) < 0;
+                              }),
+               events.end());
+}
+
+//------------------------------------------------------------------------------------------------
+/** Use the index of a splitter to filter the event list in place. Each event
+ * is looked up in the index, so this is much faster than the TimeSplitterType
+ * version for splitters with many more intervals than the list has events.
+ *
+ * @param splitter :: the index of a splitter where all the intervals
+ *indicate events that will be kept. Any other events will be deleted.
+ */
+void EventList::filterInPlace(const Kernel::TimeSplitterIndex &splitter) {
+  // Sort by pulse time, as the TimeSplitterType version leaves the list
+  this->sortPulseTime();
+
+  switch (eventType) {
+  case TOF:
+    filterInPlaceHelper(splitter, this->events);
+    break;
+  case WEIGHTED:
+    filterInPlaceHelper(splitter, this->weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    throw std::runtime_error("EventList::filterInPlace() called on an "
+                             "EventList that no longer has time information.");
+    break;
+  }
+}
+
 //------------------------------------------------------------------------------------------------
 /** Split the event list into n outputs, operating on a vector of either
  *TofEvent's or WeightedEvent's
@@ -4114,6 +4597,71 @@ void EventList::splitByTime(Kernel::TimeSplitterType &splitter,
   }
 }
 
+//------------------------------------------------------------------------------------------------
+/** Split a vector of either TofEvent's or WeightedEvent's into n outputs by
+ * looking up the pulse time of each event in the index of a splitter.
+ *
+ * @param splitter :: the index of the splitter
+ * @param outputs :: a vector of where the split events will end up.
+ * @param events :: either this->events or this->weightedEvents.
+ */
+template <class T>
+void EventList::splitByTimeHelper(const Kernel::TimeSplitterIndex &splitter,
+                                  std::vector<EventList *> &outputs,
+                                  const typename std::vector<T> &events) {
+  const size_t numOutputs = outputs.size();
+  for (const auto &event : events) {
+    const int index = splitter.destination(event.m_pulsetime);
+    if (index >= 0 && static_cast<size_t>(index) < numOutputs)
+      outputs[index]->addEventQuickly(event);
+  }
+}
+
+//------------------------------------------------------------------------------------------------
+/** Split the event list into n outputs using the index of a splitter. The
+ * outputs are the same as for the TimeSplitterType version, but each event is
+ * looked up in the index rather than walking through every interval.
+ *
+ * @param splitter :: the index of the splitter
+ * @param outputs :: a vector of where the split events will end up. The # of
+ *entries in there should
+ *        be big enough to accommodate the indices.
+ */
+void EventList::splitByTime(const Kernel::TimeSplitterIndex &splitter,
+                            std::vector<EventList *> outputs) const {
+  if (eventType == WEIGHTED_NOTIME)
+    throw std::runtime_error("EventList::splitByTime() called on an EventList "
+                             "that no longer has time information.");
+
+  // Sort by pulse time so the outputs are in the same order as for the
+  // TimeSplitterType version
+  this->sortPulseTime();
+
+  // Initialize all the outputs
+  for (auto output : outputs) {
+    output->clear();
+    output->setDetectorIDs(this->getDetectorIDs());
+    output->setHistogram(m_histogram);
+    // Match the output event type.
+    output->switchTo(eventType);
+  }
+
+  // Do nothing if there are no entries
+  if (splitter.empty())
+    return;
+
+  switch (eventType) {
+  case TOF:
+    splitByTimeHelper(splitter, outputs, this->events);
+    break;
+  case WEIGHTED:
+    splitByTimeHelper(splitter, outputs, this->weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    break;
+  }
+}
+
 //------------------------------------------------------------------------------------------------
 /** Split the event list into n outputs, operating on a vector of either
  *TofEvent's or WeightedEvent's
@@ -4514,67 +5062,63 @@ std::string EventList::splitByFullTimeMatrixSplitter(
   return debugmessage;
 }
 
+namespace {
+/// Find the first event at or after a pulse time in a range of events
+/// sorted by pulse time
+template <class T>
+typename std::vector<T>::const_iterator
+lowerBoundPulseTime(typename std::vector<T>::const_iterator first,
+                    typename std::vector<T>::const_iterator last,
+                    const int64_t pulseTime) {
+  return std::lower_bound(first, last, pulseTime,
+                          [](const T &event, const int64_t time) {
+                            return event.pulseTime().totalNanoseconds() < time;
+                          });
+}
+
+/// Copy a contiguous slice of events to the end of an event list
+template <class T>
+void appendEvents(EventList *output,
+                  typename std::vector<T>::const_iterator first,
+                  typename std::vector<T>::const_iterator last) {
+  if (first == last)
+    return;
+  std::vector<T> *outputEvents;
+  getEventsFrom(*output, outputEvents);
+  outputEvents->insert(outputEvents->end(), first, last);
+  output->setSortOrder(UNSORTED);
+}
+} // namespace
+
 //-------------------------------------------
 //--------------------------------------------------
-/** Split the event list into n outputs by each event's pulse time only
+/** Split the event list into n outputs by each event's pulse time only.
+ * The events must be sorted by pulse time, so that the events of each
+ * splitting interval form a contiguous slice: its ends are found by binary
+ * search and the slice is copied as a block.
  */
 template <class T>
 void EventList::splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
                                        std::map<int, EventList *> outputs,
                                        typename std::vector<T> &events) const {
-  // Prepare to TimeSplitter Iterate through the splitter at the same time
-  auto itspl = splitter.begin();
-  auto itspl_end = splitter.end();
-  Types::Core::DateAndTime start, stop;
-
-  // Prepare to Events Iterate through all events (sorted by tof)
-  auto itev = events.begin();
-  auto itev_end = events.end();
-
-  // Iterate (loop) on all splitters
-  while (itspl != itspl_end) {
-    // Get the splitting interval times and destination group
-    start = itspl->start().totalNanoseconds();
-    stop = itspl->stop().totalNanoseconds();
-    const int index = itspl->index();
-
-    // Skip the events before the start of the time and put to 'unfiltered'
-    // EventList
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      if (itev->m_pulsetime < start) {
-        // Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
-        // Event within a splitter interval
-        break;
-      }
-    }
-
-    // Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
-
-      if (itev->m_pulsetime < stop) {
-        outputs[index]->addEventQuickly(*itev);
-        ++itev;
-      } else {
-        // Out of interval
-        break;
-      }
-    }
-
-    // Go to the next interval
-    ++itspl;
-    // But if we reached the end, then we are done.
-    if (itspl == itspl_end)
-      break;
+  auto itev = events.cbegin();
+  const auto itev_end = events.cend();
+  EventList *unfiltered = outputs[-1];
 
+  for (const auto &interval : splitter) {
     // No need to keep looping through the filter if we are out of events
     if (itev == itev_end)
       break;
-  } // END-WHILE Splitter
+    const int64_t start = interval.start().totalNanoseconds();
+    const int64_t stop = interval.stop().totalNanoseconds();
+
+    // The events before the start of the interval go to 'unfiltered'
+    const auto first = lowerBoundPulseTime<T>(itev, itev_end, start);
+    appendEvents<T>(unfiltered, itev, first);
+    const auto last = lowerBoundPulseTime<T>(first, itev_end, stop);
+    appendEvents<T>(outputs[interval.index()], first, last);
+    itev = last;
+  }
 }
 
 //----------------------------------------------------------------------------------------------
@@ -4587,8 +5131,10 @@ void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
 
-  // Start by sorting the event list by pulse time.
-  this->sortPulseTimeTOF();
+  // Start by sorting the event list by pulse time. The order within a pulse
+  // does not matter for splitting by pulse time.
+  if (this->order != PULSETIMETOF_SORT)
+    this->sortPulseTime();
 
   // Initialize all the output event lists
   std::map<int, EventList *>::iterator outiter;
@@ -4632,8 +5178,10 @@ void EventList::splitByPulseTimeWithMatrix(
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
 
-  // Start by sorting the event list by pulse time.
-  this->sortPulseTimeTOF();
+  // Start by sorting the event list by pulse time. The order within a pulse
+  // does not matter for splitting by pulse time.
+  if (this->order != PULSETIMETOF_SORT)
+    this->sortPulseTime();
 
   // Initialize all the output event lists
   std::map<int, EventList *>::iterator outiter;
@@ -4677,48 +5225,22 @@ void EventList::splitByPulseTimeWithMatrixHelper(
     throw std::runtime_error("Splitter time vector size and splitter target "
                              "vector size are not correct.");
 
-  // Prepare to Events Iterate through all events (sorted by tof)
-  auto itev = events.begin();
-  auto itev_end = events.end();
+  // Events are sorted by pulse time: each splitter is a contiguous slice
+  auto itev = events.cbegin();
+  const auto itev_end = events.cend();
+  EventList *unfiltered = outputs[-1];
 
-  // Iterate (loop) on all splitters
   for (size_t i_target = 0; i_target < vec_split_target.size(); ++i_target) {
-    // Get the splitting interval times and destination group
-    int64_t start = vec_split_times[i_target];
-    int64_t stop = vec_split_times[i_target + 1];
-    const int index = vec_split_target[i_target];
-
-    // Skip the events before the start of the time and put to 'unfiltered'
-    // EventList
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      if (itev->m_pulsetime < start) {
-        // Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
-        // Event within a splitter interval
-        break;
-      }
-    }
-
-    // Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
-
-      if (itev->m_pulsetime < stop) {
-        outputs[index]->addEventQuickly(*itev);
-        ++itev;
-      } else {
-        // Out of interval
-        break;
-      }
-    }
-
-    // No need to keep looping through the filter if we are out of events
     if (itev == itev_end)
       break;
-  } // END-WHILE Splitter
+    const auto first =
+        lowerBoundPulseTime<T>(itev, itev_end, vec_split_times[i_target]);
+    appendEvents<T>(unfiltered, itev, first);
+    const auto last =
+        lowerBoundPulseTime<T>(first, itev_end, vec_split_times[i_target + 1]);
+    appendEvents<T>(outputs[vec_split_target[i_target]], first, last);
+    itev = last;
+  }
 }
 
 //--------------------------------------------------------------------------
@@ -4786,13 +5308,21 @@ template <class T>
 void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events,
                                          Mantid::Kernel::Unit *fromUnit,
                                          Mantid::Kernel::Unit *toUnit) {
-  auto itev = events.begin();
-  auto itev_end = events.end();
-  for (; itev != itev_end; itev++) {
-    // Conver to TOF
-    double tof = fromUnit->singleToTOF(itev->m_tof);
+  // Convert blocks of values at a time, so that the units convert whole
+  // arrays rather than making two virtual calls per event
+  constexpr size_t blockSize = 1024;
+  double block[blockSize];
+  for (size_t start = 0; start < events.size(); start += blockSize) {
+    const size_t count = std::min(blockSize, events.size() - start);
+    auto first = events.begin() + start;
+    for (size_t i = 0; i < count; ++i)
+      block[i] = first[i].m_tof;
+    // Convert to TOF
+    fromUnit->toTOFRange(block, block + count);
     // And back from TOF to whatever
-    itev->m_tof = toUnit->singleFromTOF(tof);
+    toUnit->fromTOFRange(block, block + count);
+    for (size_t i = 0; i < count; ++i)
+      first[i].m_tof = block[i];
   }
 }
 
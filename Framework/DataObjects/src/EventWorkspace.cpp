@@ -14,8 +14,10 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidDataObjects/Workspace2D.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidHistogramData/BinIndexer.h"
 #include "MantidKernel/CPUTimer.h"
 #include "MantidKernel/DateAndTime.h"
 #include "MantidKernel/Exception.h"
@@ -569,6 +571,63 @@ void EventWorkspace::generateHistogram(const std::size_t index,
   this->data[index]->generateHistogram(X, Y, E, skipError);
 }
 
+/** Using the event data in the event lists, generate the histograms of all
+ * the spectra w.r.t TOF in one parallel pass. Unlike reading the Y data
+ * spectrum by spectrum, this does not go through the MRU. When all spectra
+ * have the same bin edges, the bin lookup is prepared once and the output
+ * shares a single X vector. Spectra are handed to the threads in contiguous
+ * blocks, so that each thread writes to neighbouring output spectra.
+ *
+ * @param output :: workspace with the same number of spectra. The X, Y, E and
+ * Dx of each of its spectra are replaced.
+ * @param skipError :: if true, the errors of unweighted events are NOT
+ * calculated and are set to zero.
+ * @param prog :: an optional progress report, reported once per spectrum.
+ */
+void EventWorkspace::generateHistograms(Workspace2D &output, bool skipError,
+                                        Mantid::API::Progress *prog) const {
+  const size_t numSpectra = data.size();
+  if (output.getNumberHistograms() != numSpectra)
+    throw std::invalid_argument("EventWorkspace::generateHistograms, output "
+                                "has a different number of spectra");
+  if (numSpectra == 0)
+    return;
+
+  std::unique_ptr<HistogramData::BinIndexer> commonIndexer;
+  const auto commonX = data[0]->ptrX();
+  if (isCommonBins())
+    commonIndexer =
+        std::make_unique<HistogramData::BinIndexer>(commonX->rawData());
+
+  // Blocks of spectra big enough to amortize the task overhead
+  const size_t grainSize = 16;
+  tbb::parallel_for(
+      tbb::blocked_range<size_t>(0, numSpectra, grainSize),
+      [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+          const auto &eventList = *data[i];
+          const auto x = commonIndexer ? commonX : eventList.ptrX();
+          MantidVec y;
+          MantidVec e;
+          if (commonIndexer) {
+            eventList.generateHistogram(*commonIndexer, x->rawData(), y, e,
+                                        skipError);
+          } else {
+            eventList.generateHistogram(x->rawData(), y, e, skipError);
+          }
+          if (e.size() != y.size())
+            e.assign(y.size(), 0.0);
+          HistogramData::Histogram histogram(
+              HistogramData::BinEdges(x), HistogramData::Counts(std::move(y)),
+              HistogramData::CountStandardDeviations(std::move(e)));
+          histogram.setSharedDx(eventList.sharedDx());
+          output.setHistogram(i, std::move(histogram));
+          if (prog)
+            prog->report("Binning");
+        }
+      });
+}
+
 /** Using the event data in the event list, generate a histogram of it w.r.t
  *PULSE TIME.
  *
@@ -5,81 +5,147 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/RuntimeCounters.h"
 #include "MantidKernel/System.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace Mantid {
 namespace DataObjects {
 
-EventWorkspaceMRU::~EventWorkspaceMRU() {
-  // Make sure you free up the memory in the MRUs
-  {
-    Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-    for (auto &data : m_bufferedDataY) {
-      if (data) {
-        data->clear();
-      }
-    }
-  }
-  Poco::ScopedWriteRWLock _lock2(m_changeMruListsMutexE);
-  for (auto &data : m_bufferedDataE) {
-    if (data) {
-      data->clear();
-    }
-  }
+namespace {
+/// Number of histograms kept by each shard when there is no memory budget
+const size_t DEFAULT_ENTRIES_PER_SHARD = 50;
+
+/// @return the memory held by a histogram, in bytes
+template <class T> size_t bytesOf(const T &data) {
+  return data ? data->size() * sizeof(double) : 0;
 }
 
+/// Count a lookup of a histogram in the runtime counters
+template <class T> T countLookup(T data) {
+  static auto &hits =
+      Kernel::RuntimeCounters::Instance().counter("eventworkspace_mru_hits");
+  static auto &misses =
+      Kernel::RuntimeCounters::Instance().counter("eventworkspace_mru_misses");
+  (data ? hits : misses).fetch_add(1, std::memory_order_relaxed);
+  return data;
+}
+} // namespace
+
 //---------------------------------------------------------------------------
-/** This function makes sure that there are enough data
- * buffers (MRU's) for E for the number of threads requested.
- * @param thread_num :: thread number that wants a MRU buffer
+/** Find a histogram in the shard
+ * @param index :: key of the histogram
+ * @return the histogram, NULL if not found.
  */
-void EventWorkspaceMRU::ensureEnoughBuffersE(size_t thread_num) const {
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexE);
-  if (m_bufferedDataE.size() <= thread_num) {
-    m_bufferedDataE.resize(thread_num + 1);
-    for (auto &data : m_bufferedDataE) {
-      if (!data)
-        data = std::make_unique<mru_listE>(
-            50); // Create a MRU list with this many entries.
-    }
+template <class T> T MRUSegment<T>::find(const std::uintptr_t index) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_lookup.find(index);
+  if (it == m_lookup.end())
+    return T(nullptr);
+  return it->second->second;
+}
+
+/** Insert a histogram at the front of the shard and drop the oldest ones
+ * that no longer fit. If there already is a histogram for the index it is
+ * moved to the front and kept, as references to it may still be in use.
+ * @param index :: key of the histogram
+ * @param data :: the histogram
+ * @param maxEntries :: number of histograms the shard may hold
+ * @param maxBytes :: memory the histograms of the shard may use
+ */
+template <class T>
+void MRUSegment<T>::insert(const std::uintptr_t index, T data,
+                           const size_t maxEntries, const size_t maxBytes) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto existing = m_lookup.find(index);
+  if (existing != m_lookup.end()) {
+    m_items.splice(m_items.begin(), m_items, existing->second);
+    return;
+  }
+  m_bytes += bytesOf(data);
+  m_items.emplace_front(index, std::move(data));
+  m_lookup.emplace(index, m_items.begin());
+  while (m_items.size() > 1 &&
+         (m_items.size() > maxEntries || m_bytes > maxBytes)) {
+    const auto &oldest = m_items.back();
+    m_bytes -= bytesOf(oldest.second);
+    m_lookup.erase(oldest.first);
+    m_items.pop_back();
   }
 }
+
+/** Replace the histogram with the given key, if present, without changing
+ * its position in the list.
+ * @param index :: key of the histogram
+ * @param data :: the new histogram
+ */
+template <class T>
+void MRUSegment<T>::replace(const std::uintptr_t index, T data) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_lookup.find(index);
+  if (it == m_lookup.end())
+    return;
+  auto &cached = it->second->second;
+  m_bytes = m_bytes - bytesOf(cached) + bytesOf(data);
+  cached = std::move(data);
+}
+
+/// Remove the histogram with the given key, if present
+template <class T>
+void MRUSegment<T>::deleteIndex(const std::uintptr_t index) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_lookup.find(index);
+  if (it == m_lookup.end())
+    return;
+  m_bytes -= bytesOf(it->second->second);
+  m_items.erase(it->second);
+  m_lookup.erase(it);
+}
+
+/// Remove all the histograms
+template <class T> void MRUSegment<T>::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_lookup.clear();
+  m_items.clear();
+  m_bytes = 0;
+}
+
+/// @return the number of histograms in the shard
+template <class T> size_t MRUSegment<T>::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_items.size();
+}
+
 //---------------------------------------------------------------------------
-/** This function makes sure that there are enough data
- * buffers (MRU's) for Y for the number of threads requested.
- * @param thread_num :: thread number that wants a MRU buffer
+/** Constructor. Creates one shard per OpenMP thread and reads the memory
+ * budget from the configuration.
  */
-void EventWorkspaceMRU::ensureEnoughBuffersY(size_t thread_num) const {
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-  if (m_bufferedDataY.size() <= thread_num) {
-    m_bufferedDataY.resize(thread_num + 1);
-    for (auto &data : m_bufferedDataY) {
-      if (!data)
-        data = std::make_unique<mru_listY>(
-            50); // Create a MRU list with this many entries.
-    }
+EventWorkspaceMRU::EventWorkspaceMRU() {
+  const auto numShards =
+      static_cast<size_t>(std::max(PARALLEL_GET_MAX_THREADS, 1));
+  m_bufferedDataY.reserve(numShards);
+  m_bufferedDataE.reserve(numShards);
+  for (size_t i = 0; i < numShards; ++i) {
+    m_bufferedDataY.emplace_back(std::make_unique<MRUSegment<YType>>());
+    m_bufferedDataE.emplace_back(std::make_unique<MRUSegment<EType>>());
   }
+  auto budget = Kernel::ConfigService::Instance().getValue<size_t>(
+      "EventWorkspace.MRUMemory");
+  if (budget)
+    m_memoryBudget = *budget;
 }
 
 //---------------------------------------------------------------------------
 /// Clear all the data in the MRU buffers
 void EventWorkspaceMRU::clear() {
-  {
-    // Make sure you free up the memory in the MRUs
-    Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-    for (auto &data : m_bufferedDataY) {
-      if (data) {
-        data->clear();
-      }
-    }
-  }
-
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexE);
-  for (auto &data : m_bufferedDataE) {
-    if (data) {
-      data->clear();
-    }
-  }
+  for (auto &data : m_bufferedDataY)
+    data->clear();
+  for (auto &data : m_bufferedDataE)
+    data->clear();
 }
 
 //---------------------------------------------------------------------------
@@ -87,32 +153,24 @@ void EventWorkspaceMRU::clear() {
  *
  * @param thread_num :: number of the thread in which this is run
  * @param index :: index of the data to return
- * @return pointer to the TypeWithMarker that has the data; NULL if not found.
+ * @return the histogram; NULL if not found.
  */
 Kernel::cow_ptr<HistogramData::HistogramY>
 EventWorkspaceMRU::findY(size_t thread_num, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
-  auto result = m_bufferedDataY[thread_num]->find(
-      reinterpret_cast<std::uintptr_t>(index));
-  if (result)
-    return result->m_data;
-  return YType(nullptr);
+  return countLookup(m_bufferedDataY[thread_num % m_bufferedDataY.size()]->find(
+      reinterpret_cast<std::uintptr_t>(index)));
 }
 
-/** Find a Y histogram in the MRU
+/** Find a E histogram in the MRU
  *
  * @param thread_num :: number of the thread in which this is run
  * @param index :: index of the data to return
- * @return pointer to the TypeWithMarker that has the data; NULL if not found.
+ * @return the histogram; NULL if not found.
  */
 Kernel::cow_ptr<HistogramData::HistogramE>
 EventWorkspaceMRU::findE(size_t thread_num, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
-  auto result = m_bufferedDataE[thread_num]->find(
-      reinterpret_cast<std::uintptr_t>(index));
-  if (result)
-    return result->m_data;
-  return EType(nullptr);
+  return countLookup(m_bufferedDataE[thread_num % m_bufferedDataE.size()]->find(
+      reinterpret_cast<std::uintptr_t>(index)));
 }
 
 /** Insert a new histogram into the MRU
@@ -123,12 +181,9 @@ EventWorkspaceMRU::findE(size_t thread_num, const EventList *index) {
  */
 void EventWorkspaceMRU::insertY(size_t thread_num, YType data,
                                 const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
-  auto yWithMarker = std::make_shared<TypeWithMarker<YType>>(
-      reinterpret_cast<std::uintptr_t>(index));
-  yWithMarker->m_data = std::move(data);
-  m_bufferedDataY[thread_num]->insert(yWithMarker);
-  // the memory is cleared automatically due to being a smart_ptr
+  m_bufferedDataY[thread_num % m_bufferedDataY.size()]->insert(
+      reinterpret_cast<std::uintptr_t>(index), std::move(data), maxEntries(),
+      maxBytesPerShard());
 }
 
 /** Insert a new histogram into the MRU
@@ -139,12 +194,9 @@ void EventWorkspaceMRU::insertY(size_t thread_num, YType data,
  */
 void EventWorkspaceMRU::insertE(size_t thread_num, EType data,
                                 const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
-  auto eWithMarker = std::make_shared<TypeWithMarker<EType>>(
-      reinterpret_cast<std::uintptr_t>(index));
-  eWithMarker->m_data = std::move(data);
-  auto oldData = m_bufferedDataE[thread_num]->insert(eWithMarker);
-  // And clear up the memory of the old one, if it is dropping out.
+  m_bufferedDataE[thread_num % m_bufferedDataE.size()]->insert(
+      reinterpret_cast<std::uintptr_t>(index), std::move(data), maxEntries(),
+      maxBytesPerShard());
 }
 
 /** Delete any entries in the MRU at the given index
@@ -152,28 +204,66 @@ void EventWorkspaceMRU::insertE(size_t thread_num, EType data,
  * @param index :: index to delete.
  */
 void EventWorkspaceMRU::deleteIndex(const EventList *index) {
-  {
-    Poco::ScopedReadRWLock _lock1(m_changeMruListsMutexE);
-    for (auto &data : m_bufferedDataE) {
-      if (data) {
-        data->deleteIndex(reinterpret_cast<std::uintptr_t>(index));
-      }
-    }
-  }
-  Poco::ScopedReadRWLock _lock2(m_changeMruListsMutexY);
-  for (auto &data : m_bufferedDataY) {
-    if (data) {
-      data->deleteIndex(reinterpret_cast<std::uintptr_t>(index));
+  for (auto &data : m_bufferedDataE)
+    data->deleteIndex(reinterpret_cast<std::uintptr_t>(index));
+  for (auto &data : m_bufferedDataY)
+    data->deleteIndex(reinterpret_cast<std::uintptr_t>(index));
+}
+
+/** Update the cached histograms of an event list instead of dropping them,
+ * in every shard that holds both its Y and E. A shard holding only one of
+ * them drops it.
+ *
+ * @param index :: the event list whose histograms are updated
+ * @param update :: called with the cached Y and E, which it replaces by the
+ * updated histograms. If it returns false the histograms are dropped.
+ */
+void EventWorkspaceMRU::updateIndex(
+    const EventList *index,
+    const std::function<bool(YType &, EType &)> &update) {
+  const auto key = reinterpret_cast<std::uintptr_t>(index);
+  for (size_t i = 0; i < m_bufferedDataY.size(); ++i) {
+    auto y = m_bufferedDataY[i]->find(key);
+    auto e = m_bufferedDataE[i]->find(key);
+    if (!y && !e)
+      continue;
+    if (y && e && update(y, e)) {
+      m_bufferedDataY[i]->replace(key, std::move(y));
+      m_bufferedDataE[i]->replace(key, std::move(e));
+    } else {
+      m_bufferedDataY[i]->deleteIndex(key);
+      m_bufferedDataE[i]->deleteIndex(key);
     }
   }
 }
 
+/** Set the memory the cached histograms may use. The budget is shared evenly
+ * between Y and E and between the shards. Histograms already cached are only
+ * dropped when new ones are inserted.
+ * @param bytes :: the budget in bytes. 0 limits the number of histograms
+ * instead.
+ */
+void EventWorkspaceMRU::setMemoryBudget(const size_t bytes) {
+  m_memoryBudget = bytes;
+}
+
+/// @return the number of histograms each shard may hold
+size_t EventWorkspaceMRU::maxEntries() const {
+  if (m_memoryBudget > 0)
+    return std::numeric_limits<size_t>::max();
+  return DEFAULT_ENTRIES_PER_SHARD;
+}
+
+/// @return the memory the histograms of each shard may use
+size_t EventWorkspaceMRU::maxBytesPerShard() const {
+  const size_t budget = m_memoryBudget;
+  if (budget == 0)
+    return std::numeric_limits<size_t>::max();
+  return budget / (2 * m_bufferedDataY.size());
+}
+
 size_t EventWorkspaceMRU::MRUSize() const {
-  if (m_bufferedDataY.empty()) {
-    return 0;
-  } else {
-    return this->m_bufferedDataY.front()->size();
-  }
+  return this->m_bufferedDataY.front()->size();
 }
 
 } // namespace DataObjects
@@ -12,6 +12,7 @@
 #include "MantidGeometry/Math/Quadrilateral.h"
 #include "MantidKernel/V2D.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -586,73 +587,39 @@ void rebinToOutput(const Quadrilateral &inputQ,
 }
 
 /**
- * Rebin the input quadrilateral to the output grid
- * The quadrilateral must have a CLOCKWISE winding.
- * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * Find the signal, error and weight that an input bin contributes to the
+ * output grid, before splitting it between the overlapping output bins.
  * @param inputWS The input workspace containing the input intensity values
- * @param i The indexiin the vertical axis direction that inputQ references
- * @param j The index in the horizontal axis direction that inputQ references
- * @param outputWS A pointer to the output workspace that accumulates the data
- *        Note that the error array of the output workspace contains the
- *        **variance** and not the errors (standard deviations).
- * @param verticalAxis A vector containing the output vertical axis bin
- * boundaries
- * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
- * It is used to take into account the input area fractions when calcuting
- * the final output fractions.
- * This can be null to indicate that the input was a standard 2D workspace.
+ * @param i The workspace index of the input bin
+ * @param j The index of the input bin in its spectrum
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace,
+ * or null if the input is a standard 2D workspace.
+ * @param signal Output signal of the input bin
+ * @param error Output error of the input bin
+ * @param inputWeight Output weight of the input bin
+ * @return false if the signal is NaN and the bin should be skipped
  */
-void rebinToFractionalOutput(const Quadrilateral &inputQ,
-                             const MatrixWorkspace_const_sptr &inputWS,
-                             const size_t i, const size_t j,
-                             RebinnedOutput &outputWS,
-                             const std::vector<double> &verticalAxis,
-                             const RebinnedOutput_const_sptr &inputRB) {
-  const auto &inX = inputWS->x(i);
-  const auto &inY = inputWS->y(i);
-  const auto &inE = inputWS->e(i);
-  double signal = inY[j];
+bool getInputContribution(const MatrixWorkspace &inputWS, const size_t i,
+                          const size_t j, const RebinnedOutput *inputRB,
+                          double &signal, double &error, double &inputWeight) {
+  signal = inputWS.y(i)[j];
   if (std::isnan(signal))
-    return;
-
-  const auto &X = outputWS.x(0).rawData();
-  size_t qstart(0), qend(verticalAxis.size() - 1), x_start(0),
-      x_end(X.size() - 1);
-  if (!getIntersectionRegion(X, verticalAxis, inputQ, qstart, qend, x_start,
-                             x_end))
-    return;
+    return false;
 
   // If the input workspace was normalized by the bin width, we need to
   // recover the original Y value, we do it by 'removing' the bin width
   // Don't do the overlap removal if already RebinnedOutput.
   // This wreaks havoc on the data.
-  double error = inE[j];
-  double inputWeight = 1.;
-  if (inputWS->isDistribution() && !inputRB) {
+  error = inputWS.e(i)[j];
+  inputWeight = 1.;
+  if (inputWS.isDistribution() && !inputRB) {
+    const auto &inX = inputWS.x(i);
     const double overlapWidth = inX[j + 1] - inX[j];
     signal *= overlapWidth;
     error *= overlapWidth;
     inputWeight = overlapWidth;
   }
 
-  // The intersection overlap algorithm is relatively costly. The outputQ is
-  // defined as rectangular. If the inputQ is is also rectangular or
-  // trapezoidal, a simpler/faster way of calculating the intersection area
-  // of all or some bins can be used.
-  std::vector<AreaInfo> areaInfos;
-  const double inputQArea = inputQ.area();
-  const QuadrilateralType inputQType = getQuadrilateralType(inputQ);
-  if (inputQType == QuadrilateralType::Rectangle) {
-    calcRectangleIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
-                               x_end, areaInfos);
-  } else if (inputQType == QuadrilateralType::TrapezoidY) {
-    calcTrapezoidYIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
-                                x_end, areaInfos);
-  } else {
-    calcGeneralIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
-                             x_end, areaInfos);
-  }
-
   // If the input is a RebinnedOutput workspace with frac. area we need
   // to account for the weight of the input bin in the output bin weights
   if (inputRB) {
@@ -665,20 +632,140 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
       error *= inF[j];
     }
   }
+  return true;
+}
+
+/**
+ * Find the overlaps of the input quadrilateral with the output grid.
+ * The quadrilateral must have a CLOCKWISE winding. The overlaps depend only
+ * on the geometry, so they can be reused for any data with the same bins.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param i The workspace index of the input bin
+ * @param j The index of the input bin in its spectrum
+ * @param xAxis A vector containing the output horizontal axis edges
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param overlaps Output vector, to which the non-zero overlaps are appended
+ */
+void calculateOverlaps(const Quadrilateral &inputQ, const size_t i,
+                       const size_t j, const std::vector<double> &xAxis,
+                       const std::vector<double> &verticalAxis,
+                       std::vector<BinOverlap> &overlaps) {
+  size_t qstart(0), qend(verticalAxis.size() - 1), x_start(0),
+      x_end(xAxis.size() - 1);
+  if (!getIntersectionRegion(xAxis, verticalAxis, inputQ, qstart, qend,
+                             x_start, x_end))
+    return;
+
+  // The intersection overlap algorithm is relatively costly. The outputQ is
+  // defined as rectangular. If the inputQ is is also rectangular or
+  // trapezoidal, a simpler/faster way of calculating the intersection area
+  // of all or some bins can be used.
+  std::vector<AreaInfo> areaInfos;
+  const double inputQArea = inputQ.area();
+  const QuadrilateralType inputQType = getQuadrilateralType(inputQ);
+  if (inputQType == QuadrilateralType::Rectangle) {
+    calcRectangleIntersections(xAxis, verticalAxis, inputQ, qstart, qend,
+                               x_start, x_end, areaInfos);
+  } else if (inputQType == QuadrilateralType::TrapezoidY) {
+    calcTrapezoidYIntersections(xAxis, verticalAxis, inputQ, qstart, qend,
+                                x_start, x_end, areaInfos);
+  } else {
+    calcGeneralIntersections(xAxis, verticalAxis, inputQ, qstart, qend,
+                             x_start, x_end, areaInfos);
+  }
 
-  const double variance = error * error;
   for (const auto &ai : areaInfos) {
     if (ai.weight == 0.) {
       continue;
     }
-    const double weight = ai.weight / inputQArea;
+    overlaps.push_back(
+        {i, j, ai.wsIndex, ai.binIndex, ai.weight / inputQArea});
+  }
+}
+
+/**
+ * Rebin the input quadrilateral to the output grid
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The indexiin the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputWS A pointer to the output workspace that accumulates the data
+ *        Note that the error array of the output workspace contains the
+ *        **variance** and not the errors (standard deviations).
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
+ * It is used to take into account the input area fractions when calcuting
+ * the final output fractions.
+ * This can be null to indicate that the input was a standard 2D workspace.
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ,
+                             const MatrixWorkspace_const_sptr &inputWS,
+                             const size_t i, const size_t j,
+                             RebinnedOutput &outputWS,
+                             const std::vector<double> &verticalAxis,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  double signal, error, inputWeight;
+  if (!getInputContribution(*inputWS, i, j, inputRB.get(), signal, error,
+                            inputWeight))
+    return;
+
+  std::vector<BinOverlap> overlaps;
+  calculateOverlaps(inputQ, i, j, outputWS.x(0).rawData(), verticalAxis,
+                    overlaps);
+
+  const double variance = error * error;
+  for (const auto &overlap : overlaps) {
     PARALLEL_CRITICAL(overlap) {
       // The mutable calls must be in the critical section
       // so that any calls from omp sections can write to the
       // output workspace safely
-      outputWS.mutableY(ai.wsIndex)[ai.binIndex] += signal * weight;
-      outputWS.mutableE(ai.wsIndex)[ai.binIndex] += variance * weight;
-      outputWS.dataF(ai.wsIndex)[ai.binIndex] += weight * inputWeight;
+      outputWS.mutableY(overlap.outputIndex)[overlap.outputBin] +=
+          signal * overlap.weight;
+      outputWS.mutableE(overlap.outputIndex)[overlap.outputBin] +=
+          variance * overlap.weight;
+      outputWS.dataF(overlap.outputIndex)[overlap.outputBin] +=
+          overlap.weight * inputWeight;
+    }
+  }
+}
+
+/**
+ * Rebin the input bins to the output grid using their precomputed overlaps.
+ * The output spectra are filled in parallel, each one by a single thread.
+ * @param overlaps The overlaps of the input bins with the output grid,
+ *        calculated by calculateOverlaps and grouped by output workspace index
+ * @param inputWS The input workspace containing the input intensity values
+ * @param outputWS The output workspace that accumulates the data
+ *        Note that the error array of the output workspace contains the
+ *        **variance** and not the errors (standard deviations).
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace,
+ * or null to indicate that the input was a standard 2D workspace.
+ */
+void rebinToFractionalOutput(
+    const std::vector<std::vector<BinOverlap>> &overlaps,
+    const MatrixWorkspace_const_sptr &inputWS, RebinnedOutput &outputWS,
+    const RebinnedOutput_const_sptr &inputRB) {
+  const auto numOutput = static_cast<int64_t>(
+      std::min(overlaps.size(), outputWS.getNumberHistograms()));
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, outputWS))
+  for (int64_t k = 0; k < numOutput; ++k) {
+    const auto &spectrumOverlaps = overlaps[k];
+    if (spectrumOverlaps.empty())
+      continue;
+    auto &outY = outputWS.mutableY(k);
+    auto &outE = outputWS.mutableE(k);
+    auto &outF = outputWS.dataF(k);
+    for (const auto &overlap : spectrumOverlaps) {
+      double signal, error, inputWeight;
+      if (!getInputContribution(*inputWS, overlap.inputIndex, overlap.inputBin,
+                                inputRB.get(), signal, error, inputWeight))
+        continue;
+      outY[overlap.outputBin] += signal * overlap.weight;
+      outE[overlap.outputBin] += error * error * overlap.weight;
+      outF[overlap.outputBin] += overlap.weight * inputWeight;
     }
   }
 }
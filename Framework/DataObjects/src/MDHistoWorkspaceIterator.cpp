@@ -531,8 +531,15 @@ MDHistoWorkspaceIterator::findNeighbourIndexesFaceTouching() const {
                                                   m_indexMax, m_index);
 
   std::vector<size_t> neighbourIndexes; // Accumulate neighbour indexes.
+  neighbourIndexes.reserve(m_permutationsFaceTouching.size());
   std::vector<int> widths(
       m_nd, 3); // Face touching width is always 3 in each dimension
+  if (neighboursAreInside(widths)) {
+    // Away from the edges every permutation is a neighbour
+    for (auto permutation : m_permutationsFaceTouching)
+      neighbourIndexes.push_back(m_pos + permutation);
+    return neighbourIndexes;
+  }
   for (auto permutation : m_permutationsFaceTouching) {
     if (permutation == 0) {
       continue;
@@ -557,6 +564,24 @@ bool MDHistoWorkspaceIterator::isWithinBounds(size_t index) const {
   return index >= m_begin && index < m_max;
 }
 
+/**
+ * Check whether the neighbours of the current position within the given
+ * widths are all inside the workspace, in which case every permutation gives
+ * a neighbour and none need to be checked. m_index must be up to date.
+ * @param widths : vector of odd integer widths, one per dimension.
+ * @return True if the current position is at least widths/2 away from the
+ * edges in every dimension.
+ */
+bool MDHistoWorkspaceIterator::neighboursAreInside(
+    const std::vector<int> &widths) const {
+  for (size_t d = 0; d < m_nd; ++d) {
+    const auto halfWidth = static_cast<size_t>(widths[d] / 2);
+    if (m_index[d] < halfWidth || m_index[d] + halfWidth >= m_indexMax[d])
+      return false;
+  }
+  return true;
+}
+
 /**
  * This is to create the permutations needed to operate find neighbours in the
  *vertex-touching schenarios
@@ -564,10 +589,12 @@ bool MDHistoWorkspaceIterator::isWithinBounds(size_t index) const {
  *the iterator is moved and the method is called,
  * we can cache the results, and re-use them as the only factors are the and the
  *dimensionality, the width (n-neighbours).
+ * The permutations are sorted, and are unique where the widths do not exceed
+ * the number of bins.
  * @param widths : vector of integer widths.
  * @return index permutations
  */
-std::vector<int64_t> MDHistoWorkspaceIterator::createPermutations(
+const std::vector<int64_t> &MDHistoWorkspaceIterator::createPermutations(
     const std::vector<int> &widths) const {
   // look-up
   auto it = m_permutationsVertexTouchingMap.find(widths);
@@ -620,12 +647,15 @@ std::vector<int64_t> MDHistoWorkspaceIterator::createPermutations(
       }
     }
 
-    m_permutationsVertexTouchingMap.insert(
-        std::make_pair(widths, permutationsVertexTouching));
+    std::sort(permutationsVertexTouching.begin(),
+              permutationsVertexTouching.end());
+    it = m_permutationsVertexTouchingMap
+             .emplace(widths, std::move(permutationsVertexTouching))
+             .first;
   }
 
   // In either case, get the result.
-  return m_permutationsVertexTouchingMap[widths];
+  return it->second;
 }
 
 /**
@@ -651,16 +681,42 @@ MDHistoWorkspaceIterator::findNeighbourIndexesByWidth(const int &width) const {
  */
 std::vector<size_t> MDHistoWorkspaceIterator::findNeighbourIndexesByWidth(
     const std::vector<int> &widths) const {
+  std::vector<size_t> neighbourIndexes;
+  findNeighbourIndexesByWidth(widths, neighbourIndexes);
+  return neighbourIndexes;
+}
+
+/**
+ * Find vertex-touching neighbours, without allocating once the output vector
+ * has grown to the number of neighbours.
+ * @param widths : Vector containing odd number of pixels per dimension. Entries
+ * match dimensions of iterator.
+ * @param neighbourIndexes : set to the sorted indexes of the neighbours.
+ */
+void MDHistoWorkspaceIterator::findNeighbourIndexesByWidth(
+    const std::vector<int> &widths,
+    std::vector<size_t> &neighbourIndexes) const {
 
   // Find existing or create required index permutations.
-  std::vector<int64_t> permutationsVertexTouching = createPermutations(widths);
+  const auto &permutationsVertexTouching = createPermutations(widths);
 
   Utils::NestedForLoop::GetIndicesFromLinearIndex(m_nd, m_pos, m_indexMaker,
                                                   m_indexMax, m_index);
 
+  neighbourIndexes.clear();
+  if (neighboursAreInside(widths)) {
+    // Away from the edges every permutation is a neighbour, and as the
+    // permutations are sorted and unique so are the indexes.
+    for (auto permutation : permutationsVertexTouching) {
+      if (permutation != 0)
+        neighbourIndexes.push_back(m_pos + permutation);
+    }
+    return;
+  }
+
   // Filter out indexes that are are not actually neighbours.
   // Accumulate neighbour indexes.
-  std::vector<size_t> neighbourIndexes(permutationsVertexTouching.size());
+  neighbourIndexes.resize(permutationsVertexTouching.size());
   size_t nextFree = 0;
   for (auto permutation : permutationsVertexTouching) {
     if (permutation == 0) {
@@ -681,7 +737,6 @@ std::vector<size_t> MDHistoWorkspaceIterator::findNeighbourIndexesByWidth(
   neighbourIndexes.erase(
       std::unique(neighbourIndexes.begin(), neighbourIndexes.end()),
       neighbourIndexes.end());
-  return neighbourIndexes;
 }
 
 /**
@@ -709,16 +764,23 @@ MDHistoWorkspaceIterator::findNeighbourIndexesByWidth1D(
     }
   }
 
-  // Find existing or create required index permutations.
-  std::vector<int64_t> permutationsVertexTouching = createPermutations(widths);
-
-  std::vector<bool> indexValidity(permutationsVertexTouching.size(), false);
+  // Find existing or create required index permutations. They are sorted.
+  const auto &permutationsVertexTouching = createPermutations(widths);
 
   Utils::NestedForLoop::GetIndicesFromLinearIndex(m_nd, m_pos, m_indexMaker,
                                                   m_indexMax, m_index);
 
-  std::sort(permutationsVertexTouching.begin(),
-            permutationsVertexTouching.end());
+  const bool allInside = neighboursAreInside(widths);
+  std::vector<bool> indexValidity(permutationsVertexTouching.size(),
+                                  allInside);
+  if (allInside) {
+    std::vector<size_t> neighbourIndexes;
+    neighbourIndexes.reserve(permutationsVertexTouching.size());
+    for (auto permutation : permutationsVertexTouching)
+      neighbourIndexes.push_back(m_pos + permutation);
+    return std::make_pair(std::move(neighbourIndexes),
+                          std::move(indexValidity));
+  }
 
   // Accumulate neighbour indexes.
   // Record indexes as valid only if they are actually neighbours.
@@ -27,17 +27,72 @@ using namespace Mantid::Geometry;
 
 namespace Mantid {
 namespace DataObjects {
+namespace {
+/// The shape of the peaks that have not been integrated. Shapes are
+/// immutable, so it is shared by all of them.
+PeakShape_const_sptr noShape() {
+  static const PeakShape_const_sptr shape = boost::make_shared<NoShape>();
+  return shape;
+}
+} // namespace
+
+/// The goniometer rotation matrix of a peak and its inverse. Peaks copied
+/// from each other or measured at the same orientation share one instance,
+/// rather than holding and inverting a copy each.
+struct Peak::GoniometerMatrices {
+  Kernel::Matrix<double> matrix;
+  Kernel::Matrix<double> inverse;
+  /// Whether the matrix could not be inverted
+  bool singular;
+};
+
+/// @return the shared identity goniometer
+Peak::GoniometerMatrices_const_sptr Peak::identityGoniometer() {
+  static const GoniometerMatrices_const_sptr identity =
+      boost::make_shared<const GoniometerMatrices>(GoniometerMatrices{
+          Matrix<double>(3, 3, true), Matrix<double>(3, 3, true), false});
+  return identity;
+}
+
+/**
+ * Make the goniometer of a peak, reusing the last one made on this thread if
+ * the matrix is the same, as it is for all the peaks of a run.
+ * @param goniometer :: The goniometer rotation matrix
+ * @return the matrix and its inverse
+ */
+Peak::GoniometerMatrices_const_sptr
+Peak::makeGoniometer(const Kernel::Matrix<double> &goniometer) {
+  const auto sameAs = [&goniometer](const Kernel::Matrix<double> &other) {
+    if (other.numRows() != goniometer.numRows() ||
+        other.numCols() != goniometer.numCols())
+      return false;
+    // Matrix::operator== has a tolerance, the inverse must be exact
+    for (size_t i = 0; i < goniometer.numRows(); ++i)
+      for (size_t j = 0; j < goniometer.numCols(); ++j)
+        if (other[i][j] != goniometer[i][j])
+          return false;
+    return true;
+  };
+  thread_local GoniometerMatrices_const_sptr last = identityGoniometer();
+  if (sameAs(last->matrix))
+    return last;
+
+  Kernel::Matrix<double> inverse(goniometer);
+  const bool singular = fabs(inverse.Invert()) < 1e-8;
+  last = boost::make_shared<const GoniometerMatrices>(
+      GoniometerMatrices{goniometer, std::move(inverse), singular});
+  return last;
+}
 
 //----------------------------------------------------------------------------------------------
 /** Default constructor */
 Peak::Peak()
     : m_detectorID(-1), m_H(0), m_K(0), m_L(0), m_intensity(0),
       m_sigmaIntensity(0), m_binCount(0), m_initialEnergy(0.),
-      m_finalEnergy(0.), m_GoniometerMatrix(3, 3, true),
-      m_InverseGoniometerMatrix(3, 3, true), m_runNumber(0), m_monitorCount(0),
-      m_row(-1), m_col(-1), m_orig_H(0), m_orig_K(0), m_orig_L(0),
-      m_peakNumber(0), m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
-      m_peakShape(boost::make_shared<NoShape>()) {
+      m_finalEnergy(0.), m_goniometer(identityGoniometer()), m_runNumber(0),
+      m_monitorCount(0), m_row(-1), m_col(-1), m_orig_H(0), m_orig_K(0),
+      m_orig_L(0), m_peakNumber(0), m_IntHKL(V3D(0, 0, 0)),
+      m_IntMNP(V3D(0, 0, 0)), m_peakShape(noShape()) {
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
 }
 
@@ -55,11 +110,10 @@ Peak::Peak(const Geometry::Instrument_const_sptr &m_inst,
            const Mantid::Kernel::V3D &QLabFrame,
            boost::optional<double> detectorDistance)
     : m_H(0), m_K(0), m_L(0), m_intensity(0), m_sigmaIntensity(0),
-      m_binCount(0), m_GoniometerMatrix(3, 3, true),
-      m_InverseGoniometerMatrix(3, 3, true), m_runNumber(0), m_monitorCount(0),
-      m_orig_H(0), m_orig_K(0), m_orig_L(0), m_peakNumber(0),
-      m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
-      m_peakShape(boost::make_shared<NoShape>()) {
+      m_binCount(0), m_goniometer(identityGoniometer()), m_runNumber(0),
+      m_monitorCount(0), m_orig_H(0), m_orig_K(0), m_orig_L(0),
+      m_peakNumber(0), m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
+      m_peakShape(noShape()) {
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
   this->setInstrument(m_inst);
   this->setQLabFrame(QLabFrame, detectorDistance);
@@ -83,13 +137,12 @@ Peak::Peak(const Geometry::Instrument_const_sptr &m_inst,
            const Mantid::Kernel::Matrix<double> &goniometer,
            boost::optional<double> detectorDistance)
     : m_H(0), m_K(0), m_L(0), m_intensity(0), m_sigmaIntensity(0),
-      m_binCount(0), m_GoniometerMatrix(goniometer),
-      m_InverseGoniometerMatrix(goniometer), m_runNumber(0), m_monitorCount(0),
-      m_orig_H(0), m_orig_K(0), m_orig_L(0), m_peakNumber(0),
-      m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
-      m_peakShape(boost::make_shared<NoShape>()) {
+      m_binCount(0), m_goniometer(makeGoniometer(goniometer)),
+      m_runNumber(0), m_monitorCount(0), m_orig_H(0), m_orig_K(0),
+      m_orig_L(0), m_peakNumber(0), m_IntHKL(V3D(0, 0, 0)),
+      m_IntMNP(V3D(0, 0, 0)), m_peakShape(noShape()) {
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
-  if (fabs(m_InverseGoniometerMatrix.Invert()) < 1e-8)
+  if (m_goniometer->singular)
     throw std::invalid_argument(
         "Peak::ctor(): Goniometer matrix must non-singular.");
   this->setInstrument(m_inst);
@@ -107,11 +160,10 @@ Peak::Peak(const Geometry::Instrument_const_sptr &m_inst,
 Peak::Peak(const Geometry::Instrument_const_sptr &m_inst, int m_detectorID,
            double m_Wavelength)
     : m_H(0), m_K(0), m_L(0), m_intensity(0), m_sigmaIntensity(0),
-      m_binCount(0), m_GoniometerMatrix(3, 3, true),
-      m_InverseGoniometerMatrix(3, 3, true), m_runNumber(0), m_monitorCount(0),
-      m_orig_H(0), m_orig_K(0), m_orig_L(0), m_peakNumber(0),
-      m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
-      m_peakShape(boost::make_shared<NoShape>()) {
+      m_binCount(0), m_goniometer(identityGoniometer()), m_runNumber(0),
+      m_monitorCount(0), m_orig_H(0), m_orig_K(0), m_orig_L(0),
+      m_peakNumber(0), m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
+      m_peakShape(noShape()) {
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
   this->setInstrument(m_inst);
   this->setDetectorID(m_detectorID);
@@ -130,11 +182,11 @@ Peak::Peak(const Geometry::Instrument_const_sptr &m_inst, int m_detectorID,
 Peak::Peak(const Geometry::Instrument_const_sptr &m_inst, int m_detectorID,
            double m_Wavelength, const Mantid::Kernel::V3D &HKL)
     : m_H(HKL[0]), m_K(HKL[1]), m_L(HKL[2]), m_intensity(0),
-      m_sigmaIntensity(0), m_binCount(0), m_GoniometerMatrix(3, 3, true),
-      m_InverseGoniometerMatrix(3, 3, true), m_runNumber(0), m_monitorCount(0),
+      m_sigmaIntensity(0), m_binCount(0),
+      m_goniometer(identityGoniometer()), m_runNumber(0), m_monitorCount(0),
       m_orig_H(0), m_orig_K(0), m_orig_L(0), m_peakNumber(0),
       m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
-      m_peakShape(boost::make_shared<NoShape>()) {
+      m_peakShape(noShape()) {
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
   this->setInstrument(m_inst);
   this->setDetectorID(m_detectorID);
@@ -155,13 +207,13 @@ Peak::Peak(const Geometry::Instrument_const_sptr &m_inst, int m_detectorID,
            double m_Wavelength, const Mantid::Kernel::V3D &HKL,
            const Mantid::Kernel::Matrix<double> &goniometer)
     : m_H(HKL[0]), m_K(HKL[1]), m_L(HKL[2]), m_intensity(0),
-      m_sigmaIntensity(0), m_binCount(0), m_GoniometerMatrix(goniometer),
-      m_InverseGoniometerMatrix(goniometer), m_runNumber(0), m_monitorCount(0),
-      m_orig_H(0), m_orig_K(0), m_orig_L(0), m_peakNumber(0),
-      m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
-      m_peakShape(boost::make_shared<NoShape>()) {
+      m_sigmaIntensity(0), m_binCount(0),
+      m_goniometer(makeGoniometer(goniometer)), m_runNumber(0),
+      m_monitorCount(0), m_orig_H(0), m_orig_K(0), m_orig_L(0),
+      m_peakNumber(0), m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
+      m_peakShape(noShape()) {
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
-  if (fabs(m_InverseGoniometerMatrix.Invert()) < 1e-8)
+  if (m_goniometer->singular)
     throw std::invalid_argument(
         "Peak::ctor(): Goniometer matrix must non-singular.");
   this->setInstrument(m_inst);
@@ -179,11 +231,10 @@ Peak::Peak(const Geometry::Instrument_const_sptr &m_inst, int m_detectorID,
 Peak::Peak(const Geometry::Instrument_const_sptr &m_inst, double scattering,
            double m_Wavelength)
     : m_H(0), m_K(0), m_L(0), m_intensity(0), m_sigmaIntensity(0),
-      m_binCount(0), m_GoniometerMatrix(3, 3, true),
-      m_InverseGoniometerMatrix(3, 3, true), m_runNumber(0), m_monitorCount(0),
-      m_row(-1), m_col(-1), m_orig_H(0), m_orig_K(0), m_orig_L(0),
-      m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
-      m_peakShape(boost::make_shared<NoShape>()) {
+      m_binCount(0), m_goniometer(identityGoniometer()), m_runNumber(0),
+      m_monitorCount(0), m_row(-1), m_col(-1), m_orig_H(0), m_orig_K(0),
+      m_orig_L(0), m_IntHKL(V3D(0, 0, 0)), m_IntMNP(V3D(0, 0, 0)),
+      m_peakShape(noShape()) {
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
   this->setInstrument(m_inst);
   this->setWavelength(m_Wavelength);
@@ -205,15 +256,14 @@ Peak::Peak(const Peak &other)
       m_sigmaIntensity(other.m_sigmaIntensity), m_binCount(other.m_binCount),
       m_initialEnergy(other.m_initialEnergy),
       m_finalEnergy(other.m_finalEnergy),
-      m_GoniometerMatrix(other.m_GoniometerMatrix),
-      m_InverseGoniometerMatrix(other.m_InverseGoniometerMatrix),
+      m_goniometer(other.m_goniometer),
       m_runNumber(other.m_runNumber), m_monitorCount(other.m_monitorCount),
       m_row(other.m_row), m_col(other.m_col), sourcePos(other.sourcePos),
       samplePos(other.samplePos), detPos(other.detPos),
       m_orig_H(other.m_orig_H), m_orig_K(other.m_orig_K),
       m_orig_L(other.m_orig_L), m_peakNumber(other.m_peakNumber),
       m_IntHKL(other.m_IntHKL), m_IntMNP(other.m_IntMNP),
-      m_detIDs(other.m_detIDs), m_peakShape(other.m_peakShape->clone()),
+      m_detIDs(other.m_detIDs), m_peakShape(other.m_peakShape),
       convention(other.convention) {}
 
 //----------------------------------------------------------------------------------------------
@@ -229,15 +279,14 @@ Peak::Peak(const Geometry::IPeak &ipeak)
       m_binCount(ipeak.getBinCount()),
       m_initialEnergy(ipeak.getInitialEnergy()),
       m_finalEnergy(ipeak.getFinalEnergy()),
-      m_GoniometerMatrix(ipeak.getGoniometerMatrix()),
-      m_InverseGoniometerMatrix(ipeak.getGoniometerMatrix()),
+      m_goniometer(makeGoniometer(ipeak.getGoniometerMatrix())),
       m_runNumber(ipeak.getRunNumber()),
       m_monitorCount(ipeak.getMonitorCount()), m_row(ipeak.getRow()),
       m_col(ipeak.getCol()), m_orig_H(0.), m_orig_K(0.), m_orig_L(0.),
       m_peakNumber(ipeak.getPeakNumber()), m_IntHKL(ipeak.getIntHKL()),
-      m_IntMNP(ipeak.getIntMNP()), m_peakShape(boost::make_shared<NoShape>()) {
+      m_IntMNP(ipeak.getIntMNP()), m_peakShape(noShape()) {
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
-  if (fabs(m_InverseGoniometerMatrix.Invert()) < 1e-8)
+  if (m_goniometer->singular)
     throw std::invalid_argument(
         "Peak::ctor(): Goniometer matrix must non-singular.");
   setInstrument(ipeak.getInstrument());
@@ -510,7 +559,7 @@ Mantid::Kernel::V3D Peak::getQLabFrame() const {
 Mantid::Kernel::V3D Peak::getQSampleFrame() const {
   V3D Qlab = this->getQLabFrame();
   // Multiply by the inverse of the goniometer matrix to get the sample frame
-  V3D Qsample = m_InverseGoniometerMatrix * Qlab;
+  V3D Qsample = m_goniometer->inverse * Qlab;
   return Qsample;
 }
 
@@ -529,7 +578,7 @@ Mantid::Kernel::V3D Peak::getQSampleFrame() const {
  */
 void Peak::setQSampleFrame(const Mantid::Kernel::V3D &QSampleFrame,
                            boost::optional<double> detectorDistance) {
-  V3D Qlab = m_GoniometerMatrix * QSampleFrame;
+  V3D Qlab = m_goniometer->matrix * QSampleFrame;
   this->setQLabFrame(Qlab, detectorDistance);
 }
 
@@ -902,7 +951,7 @@ void Peak::setInitialEnergy(double m_initialEnergy) {
 // -------------------------------------------------------------------------------------
 /** Get the goniometer rotation matrix at which this peak was measured. */
 Mantid::Kernel::Matrix<double> Peak::getGoniometerMatrix() const {
-  return this->m_GoniometerMatrix;
+  return m_goniometer->matrix;
 }
 
 /** Set the goniometer rotation matrix at which this peak was measured.
@@ -914,10 +963,8 @@ void Peak::setGoniometerMatrix(
   if ((goniometerMatrix.numCols() != 3) || (goniometerMatrix.numRows() != 3))
     throw std::invalid_argument(
         "Peak::setGoniometerMatrix(): Goniometer matrix must be 3x3.");
-  this->m_GoniometerMatrix = goniometerMatrix;
-  // Calc the inverse rotation matrix
-  m_InverseGoniometerMatrix = m_GoniometerMatrix;
-  if (fabs(m_InverseGoniometerMatrix.Invert()) < 1e-8)
+  m_goniometer = makeGoniometer(goniometerMatrix);
+  if (m_goniometer->singular)
     throw std::invalid_argument(
         "Peak::setGoniometerMatrix(): Goniometer matrix must be non-singular.");
 }
@@ -1082,8 +1129,7 @@ Peak &Peak::operator=(const Peak &other) {
     m_binCount = other.m_binCount;
     m_initialEnergy = other.m_initialEnergy;
     m_finalEnergy = other.m_finalEnergy;
-    m_GoniometerMatrix = other.m_GoniometerMatrix;
-    m_InverseGoniometerMatrix = other.m_InverseGoniometerMatrix;
+    m_goniometer = other.m_goniometer;
     m_runNumber = other.m_runNumber;
     m_monitorCount = other.m_monitorCount;
     m_row = other.m_row;
@@ -1098,7 +1144,7 @@ Peak &Peak::operator=(const Peak &other) {
     m_IntHKL = other.m_IntHKL;
     m_IntMNP = other.m_IntMNP;
     convention = other.convention;
-    m_peakShape.reset(other.m_peakShape->clone());
+    m_peakShape = other.m_peakShape;
   }
   return *this;
 }
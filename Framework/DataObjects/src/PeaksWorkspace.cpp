@@ -32,6 +32,7 @@
 #include <cstdlib>
 #include <exception>
 #include <fstream>
+#include <numeric>
 // clang-format off
 #include <nexus/NeXusFile.hpp>
 #include <nexus/NeXusException.hpp>
@@ -79,44 +80,54 @@ PeaksWorkspace::PeaksWorkspace(const PeaksWorkspace &other)
 
 //=====================================================================================
 //=====================================================================================
-/** Comparator class for sorting peaks by one or more criteria
+/** Comparator class for sorting peaks by one or more criteria. The values of
+ * each criterion are read from the peaks once, into a column, and the
+ * comparator orders the indices of the peaks by those columns.
  */
-class PeakComparator : public std::binary_function<Peak, Peak, bool> {
+class PeakComparator {
 public:
-  std::vector<std::pair<std::string, bool>> &criteria;
-
   /** Constructor for the comparator for sorting peaks
+   * @param peaks : the peaks to sort
    * @param criteria : a vector with a list of pairs: column name, bool;
    *        where bool = true for ascending, false for descending sort.
    */
-  explicit PeakComparator(std::vector<std::pair<std::string, bool>> &criteria)
-      : criteria(criteria) {}
-
-  /** Compare two peaks using the stored criteria */
-  inline bool operator()(const Peak &a, const Peak &b) {
-    for (auto &name : criteria) {
-      std::string &col = name.first;
-      bool ascending = name.second;
+  PeakComparator(const std::vector<Peak> &peaks,
+                 const std::vector<std::pair<std::string, bool>> &criteria) {
+    m_keys.reserve(criteria.size());
+    for (const auto &criterion : criteria) {
+      SortKey key;
+      key.ascending = criterion.second;
+      key.isBankName = (criterion.first == "BankName");
+      if (key.isBankName) {
+        key.names.reserve(peaks.size());
+        for (const auto &peak : peaks)
+          key.names.emplace_back(peak.getBankName());
+      } else {
+        key.values.reserve(peaks.size());
+        for (const auto &peak : peaks)
+          key.values.emplace_back(peak.getValueByColName(criterion.first));
+      }
+      m_keys.emplace_back(std::move(key));
+    }
+  }
+
+  /** Compare two peaks, by index, using the stored criteria */
+  inline bool operator()(const size_t a, const size_t b) const {
+    for (const auto &key : m_keys) {
       bool lessThan = false;
-      if (col == "BankName") {
-        // If this criterion is equal, move on to the next one
-        std::string valA = a.getBankName();
-        std::string valB = b.getBankName();
+      if (key.isBankName) {
         // Move on to lesser criterion if equal
-        if (valA == valB)
+        if (key.names[a] == key.names[b])
           continue;
-        lessThan = (valA < valB);
+        lessThan = (key.names[a] < key.names[b]);
       } else {
-        // General double comparison
-        double valA = a.getValueByColName(col);
-        double valB = b.getValueByColName(col);
         // Move on to lesser criterion if equal
-        if (valA == valB)
+        if (key.values[a] == key.values[b])
           continue;
-        lessThan = (valA < valB);
+        lessThan = (key.values[a] < key.values[b]);
       }
       // Flip the sign of comparison if descending.
-      if (ascending)
+      if (key.ascending)
         return lessThan;
       else
         return !lessThan;
@@ -124,6 +135,16 @@ public:
     // If you reach here, all criteria were ==; so not <, so return false
     return false;
   }
+
+private:
+  /// The values of one criterion for all the peaks
+  struct SortKey {
+    bool ascending;
+    bool isBankName;
+    std::vector<std::string> names;
+    std::vector<double> values;
+  };
+  std::vector<SortKey> m_keys;
 };
 
 //---------------------------------------------------------------------------------------------
@@ -135,8 +156,19 @@ public:
  *equal, etc.
  */
 void PeaksWorkspace::sort(std::vector<std::pair<std::string, bool>> &criteria) {
-  PeakComparator comparator(criteria);
-  std::stable_sort(peaks.begin(), peaks.end(), comparator);
+  if (peaks.size() < 2)
+    return;
+  const PeakComparator comparator(peaks, criteria);
+  std::vector<size_t> order(peaks.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), comparator);
+
+  // Move the peaks into their new order rather than swapping them around
+  std::vector<Peak> sorted;
+  sorted.reserve(peaks.size());
+  for (const auto index : order)
+    sorted.emplace_back(std::move(peaks[index]));
+  peaks.swap(sorted);
 }
 
 //---------------------------------------------------------------------------------------------
@@ -167,15 +199,15 @@ void PeaksWorkspace::removePeak(const int peakNum) {
 void PeaksWorkspace::removePeaks(std::vector<int> badPeaks) {
   if (badPeaks.empty())
     return;
-  // if index of peak is in badPeaks remove
-  int ip = -1;
-  auto it =
-      std::remove_if(peaks.begin(), peaks.end(), [&ip, badPeaks](Peak &pk) {
-        (void)pk;
-        ip++;
-        return std::any_of(badPeaks.cbegin(), badPeaks.cend(),
-                           [ip](int badPeak) { return badPeak == ip; });
-      });
+  // flag the peaks to remove so each one is checked in constant time
+  std::vector<bool> isBad(peaks.size(), false);
+  for (const auto badPeak : badPeaks) {
+    if (badPeak >= 0 && static_cast<size_t>(badPeak) < peaks.size())
+      isBad[badPeak] = true;
+  }
+  size_t ip = 0;
+  auto it = std::remove_if(peaks.begin(), peaks.end(),
+                           [&ip, &isBad](const Peak &) { return isBad[ip++]; });
   peaks.erase(it, peaks.end());
 }
 
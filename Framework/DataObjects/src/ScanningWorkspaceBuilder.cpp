@@ -263,12 +263,20 @@ void ScanningWorkspaceBuilder::buildPositions(
 
 void ScanningWorkspaceBuilder::buildRelativeRotationsForScans(
     Geometry::DetectorInfo &outputDetectorInfo) const {
+  // The rotation is the same for every detector at a given time index, so it
+  // is only built once per time index
+  std::vector<Kernel::Quat> rotations;
+  rotations.reserve(outputDetectorInfo.scanCount());
+  for (size_t j = 0; j < outputDetectorInfo.scanCount(); ++j)
+    rotations.emplace_back(m_instrumentAngles[j], m_rotationAxis);
+
   for (size_t i = 0; i < outputDetectorInfo.size(); ++i) {
+    // Monitor flags do not depend on time
+    if (outputDetectorInfo.isMonitor(i))
+      continue;
     for (size_t j = 0; j < outputDetectorInfo.scanCount(); ++j) {
-      if (outputDetectorInfo.isMonitor({i, j}))
-        continue;
+      const auto &rotation = rotations[j];
       auto position = outputDetectorInfo.position({i, j});
-      const auto rotation = Kernel::Quat(m_instrumentAngles[j], m_rotationAxis);
       position -= m_rotationPosition;
       rotation.rotate(position);
       position += m_rotationPosition;
@@ -8,7 +8,9 @@
 #include "MantidAPI/ColumnFactory.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 
+#include <algorithm>
 #include <queue>
 
 namespace Mantid {
@@ -191,6 +193,30 @@ void TableWorkspace::removeRow(size_t index) {
   modified();
 }
 
+/** Deletes several rows, moving the remaining values of each column only
+ * once rather than once per deleted row.
+ * @param indices :: Rows to delete, in any order. Duplicates are ignored.
+ * @throw std::range_error if any of the rows does not exist
+ */
+void TableWorkspace::removeRows(const std::vector<size_t> &indices) {
+  if (indices.empty())
+    return;
+  std::vector<size_t> sortedRows(indices);
+  std::sort(sortedRows.begin(), sortedRows.end());
+  sortedRows.erase(std::unique(sortedRows.begin(), sortedRows.end()),
+                   sortedRows.end());
+  if (sortedRows.back() >= rowCount()) {
+    std::stringstream ss;
+    ss << "Attempt to delete a non-existing row (" << sortedRows.back()
+       << ")\n";
+    throw std::range_error(ss.str());
+  }
+  for (auto &column : m_columns)
+    removeFromColumn(column.get(), sortedRows);
+  m_rowCount -= sortedRows.size();
+  modified();
+}
+
 std::vector<std::string> TableWorkspace::getColumnNames() const {
   std::vector<std::string> nameList;
   nameList.reserve(m_columns.size());
@@ -280,10 +306,11 @@ void TableWorkspace::sort(std::vector<std::pair<std::string, bool>> &criteria) {
     }
   }
 
-  // finally sort the rows
-  const size_t nCols = columnCount();
-  for (size_t i = 0; i < nCols; ++i) {
-    getColumn(i)->sortValues(indexVec);
+  // finally sort the rows, the columns are independent of each other
+  const auto nCols = static_cast<int>(columnCount());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < nCols; ++i) {
+    m_columns[i]->sortValues(indexVec);
   }
   modified();
 }
@@ -12,6 +12,7 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/TimeSplitter.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/Unit.h"
 
@@ -229,6 +230,32 @@ public:
     do_test_memory_handling(el2, el2.getWeightedEventsNoTime());
   }
 
+  template <class T>
+  void do_test_reserve_and_shrinkToFit(EventList &el2,
+                                       std::vector<T> &events) {
+    el2.reserve(100);
+    TS_ASSERT_EQUALS(events.capacity(), 100);
+    std::vector<T> mylist{{45}, {89}, {34}};
+    el2 += mylist;
+    el2.shrinkToFit();
+    TS_ASSERT_EQUALS(events.size(), 3);
+    TS_ASSERT_EQUALS(events.capacity(), 3);
+    TS_ASSERT_DELTA(events[1].tof(), 89, 1e-10);
+  }
+
+  void test_reserve_and_shrinkToFit_all_types() {
+    EventList el2;
+    do_test_reserve_and_shrinkToFit(el2, el2.getEvents());
+
+    el2 = EventList();
+    el2.switchTo(WEIGHTED);
+    do_test_reserve_and_shrinkToFit(el2, el2.getWeightedEvents());
+
+    el2 = EventList();
+    el2.switchTo(WEIGHTED_NOTIME);
+    do_test_reserve_and_shrinkToFit(el2, el2.getWeightedEventsNoTime());
+  }
+
   //
   //  template<class T>
   //  void do_test_clearUnused(EventList & el2, typename std::vector<T> &
@@ -263,6 +290,83 @@ public:
     TS_ASSERT_EQUALS(rel[5].tof(), 50);
   }
 
+  void test_mergeSorted_all_types() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      EventList first, second;
+      for (int i = 0; i < 50; i++) {
+        first += TofEvent((rand() % 1000) * 0.1, rand() % 1000);
+        second += TofEvent((rand() % 1000) * 0.1, rand() % 1000);
+      }
+      first.switchTo(static_cast<EventType>(this_type));
+      first.addDetectorID(1);
+      second.addDetectorID(2);
+      std::vector<double> expected = first.getTofs();
+      const std::vector<double> secondTofs = second.getTofs();
+      expected.insert(expected.end(), secondTofs.begin(), secondTofs.end());
+      std::sort(expected.begin(), expected.end());
+
+      first.sortTof();
+      second.sortTof();
+      first.mergeSorted(second);
+      TS_ASSERT_EQUALS(first.getEventType(), static_cast<EventType>(this_type));
+      TS_ASSERT_EQUALS(first.getSortType(), TOF_SORT);
+      TS_ASSERT_EQUALS(first.getTofs(), expected);
+      TS_ASSERT_EQUALS(first.getDetectorIDs(), std::set<detid_t>({1, 2}));
+    }
+  }
+
+  void test_mergeSorted_several_lists() {
+    std::vector<EventList> lists(5);
+    std::vector<double> expected;
+    for (auto &list : lists) {
+      for (int i = 0; i < 20; i++)
+        list += TofEvent((rand() % 1000) * 0.1, rand() % 1000);
+      list.sortTof();
+      const auto tofs = list.getTofs();
+      expected.insert(expected.end(), tofs.begin(), tofs.end());
+    }
+    lists[3].switchTo(WEIGHTED);
+    std::sort(expected.begin(), expected.end());
+
+    EventList merged;
+    merged.mergeSorted({&lists[0], &lists[1], &lists[2], &lists[3], &lists[4]});
+    TS_ASSERT_EQUALS(merged.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(merged.getSortType(), TOF_SORT);
+    TS_ASSERT_EQUALS(merged.getTofs(), expected);
+  }
+
+  void test_mergeSorted_appends_unsorted_lists() {
+    EventList sorted;
+    sorted += TofEvent(1.0);
+    sorted += TofEvent(2.0);
+    sorted.sortTof();
+    EventList more;
+    more += TofEvent(0.5);
+    more += TofEvent(0.1);
+    sorted.mergeSorted(more);
+    TS_ASSERT_EQUALS(sorted.getSortType(), UNSORTED);
+    TS_ASSERT_EQUALS(sorted.getTofs(),
+                     std::vector<double>({1.0, 2.0, 0.5, 0.1}));
+  }
+
+  void test_swapEvents() {
+    EventList weighted;
+    weighted += WeightedEvent(2.0, 0, 3.0, 4.0);
+    weighted.sortTof();
+    weighted.addDetectorID(7);
+    el.addDetectorID(8);
+    el.swapEvents(weighted);
+
+    TS_ASSERT_EQUALS(el.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(el.getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(el.getSortType(), TOF_SORT);
+    TS_ASSERT_EQUALS(el.getDetectorIDs(), std::set<detid_t>({8}));
+    TS_ASSERT_EQUALS(weighted.getEventType(), TOF);
+    TS_ASSERT_EQUALS(weighted.getNumberEvents(), 3);
+    TS_ASSERT_EQUALS(weighted.getEvents()[0].tof(), 100);
+    TS_ASSERT_EQUALS(weighted.getDetectorIDs(), std::set<detid_t>({7}));
+  }
+
   void test_DetectorIDs() {
     EventList el1;
     el1.addDetectorID(14);
@@ -787,6 +891,38 @@ public:
     }
   }
 
+  void test_SortTOF_long_list_all_types() {
+    // Long enough to use the radix sort
+    for (int this_type = 0; this_type < 3; this_type++) {
+      EventList longList;
+      for (int i = 0; i < 5000; i++)
+        longList += TofEvent((rand() % 100000) * 0.01 - 100., rand() % 1000);
+      longList.switchTo(static_cast<EventType>(this_type));
+      std::vector<double> expected = longList.getTofs();
+      std::sort(expected.begin(), expected.end());
+      longList.sortTof();
+      TS_ASSERT_EQUALS(longList.getTofs(), expected);
+    }
+  }
+
+  void test_SortPulseTimeTOF_long_list() {
+    for (int this_type = 0; this_type < 2; this_type++) {
+      EventList longList;
+      for (int i = 0; i < 5000; i++)
+        longList += TofEvent((rand() % 1000) * 0.5, rand() % 50);
+      longList.switchTo(static_cast<EventType>(this_type));
+      longList.sortPulseTimeTOF();
+      TS_ASSERT_EQUALS(longList.getSortType(), PULSETIMETOF_SORT);
+      for (size_t i = 1; i < longList.getNumberEvents(); i++) {
+        const auto previous = longList.getEvent(i - 1);
+        const auto current = longList.getEvent(i);
+        TS_ASSERT_LESS_THAN_EQUALS(previous.pulseTime(), current.pulseTime());
+        if (previous.pulseTime() == current.pulseTime())
+          TS_ASSERT_LESS_THAN_EQUALS(previous.tof(), current.tof());
+      }
+    }
+  }
+
   void test_SortPulseTime_weights() {
     this->fake_data();
     el.switchTo(WEIGHTED);
@@ -1239,6 +1375,65 @@ public:
     TS_ASSERT_EQUALS(this->el.ptrX()->size(), NUMBINS + 1);
   }
 
+  void test_histogram_unsorted_with_linear_bins_does_not_sort() {
+    EventList unsorted;
+    for (int i = 99; i >= 0; --i)
+      unsorted += TofEvent(static_cast<double>(i) + 0.5, i);
+    // Also put some events exactly on and outside the bin edges
+    unsorted += TofEvent(0.0, 0);
+    unsorted += TofEvent(-1.0, 0);
+    unsorted += TofEvent(100.0, 0);
+    EventList sorted(unsorted);
+    sorted.sortTof();
+
+    MantidVec X;
+    for (double x = 0.; x <= 100.; x += 10.)
+      X.push_back(x);
+    MantidVec Y, E, sortedY, sortedE;
+    unsorted.generateHistogram(X, Y, E);
+    sorted.generateHistogram(X, sortedY, sortedE);
+
+    TS_ASSERT_EQUALS(unsorted.getSortType(), UNSORTED);
+    TS_ASSERT_EQUALS(Y, sortedY);
+    TS_ASSERT_EQUALS(E, sortedE);
+    TS_ASSERT_EQUALS(Y[0], 11.0);
+    TS_ASSERT_EQUALS(Y[9], 10.0);
+  }
+
+  void test_histogram_unsorted_weighted_with_log_bins() {
+    EventList unsorted;
+    for (int i = 0; i < 100; ++i)
+      unsorted += WeightedEvent(static_cast<double>((i * 37) % 100) + 1.0, i,
+                                2.0, 3.0);
+    EventList sorted(unsorted);
+    sorted.sortTof();
+
+    MantidVec X{1.0};
+    while (X.back() < 100.)
+      X.push_back(X.back() * 1.5);
+    MantidVec Y, E, sortedY, sortedE;
+    unsorted.generateHistogram(X, Y, E);
+    sorted.generateHistogram(X, sortedY, sortedE);
+
+    TS_ASSERT_EQUALS(unsorted.getSortType(), UNSORTED);
+    TS_ASSERT_EQUALS(Y.size(), sortedY.size());
+    for (size_t i = 0; i < Y.size(); ++i) {
+      TS_ASSERT_DELTA(Y[i], sortedY[i], 1e-10);
+      TS_ASSERT_DELTA(E[i], sortedE[i], 1e-10);
+    }
+  }
+
+  void test_histogram_unsorted_with_arbitrary_bins_sorts() {
+    EventList unsorted;
+    unsorted += TofEvent(3.5, 0);
+    unsorted += TofEvent(0.5, 0);
+    unsorted += TofEvent(1.5, 0);
+    MantidVec Y, E;
+    unsorted.generateHistogram({0., 1., 3., 4.}, Y, E);
+    TS_ASSERT_EQUALS(unsorted.getSortType(), TOF_SORT);
+    TS_ASSERT_EQUALS(Y, MantidVec({1., 1., 1.}));
+  }
+
   //  void test_histogram_static_function()
   //  {
   //    std::vector<WeightedEvent> events;
@@ -1645,6 +1840,70 @@ public:
     }
   }
 
+  void test_sortByPulseTimeTOF_of_list_sorted_by_pulse_time() {
+    for (int this_type = 0; this_type < 2; this_type++) {
+      EventType curType = static_cast<EventType>(this_type);
+      EventList expected = this->fake_data();
+      expected.switchTo(curType);
+      expected.sortPulseTimeTOF();
+
+      EventList el = this->fake_data();
+      el.switchTo(curType);
+      el.sortPulseTime();
+      TS_ASSERT_THROWS_NOTHING(el.sortPulseTimeTOF());
+      TS_ASSERT_EQUALS(el.getSortType(), PULSETIMETOF_SORT);
+      TS_ASSERT_EQUALS(el.getNumberEvents(), expected.getNumberEvents());
+      for (size_t i = 0; i < el.getNumberEvents(); i++) {
+        TS_ASSERT_EQUALS(el.getEvent(i).pulseTime(),
+                         expected.getEvent(i).pulseTime());
+        TS_ASSERT_EQUALS(el.getEvent(i).tof(), expected.getEvent(i).tof());
+      }
+    }
+  }
+
+  void test_splitByPulseTime_copies_each_interval() {
+    for (int this_type = 0; this_type < 2; this_type++) {
+      EventType curType = static_cast<EventType>(this_type);
+      EventList el = this->fake_data();
+      el.switchTo(curType);
+
+      std::map<int, EventList *> outputs;
+      for (int i = -1; i < 4; i++)
+        outputs[i] = new EventList();
+
+      // Intervals with gaps between them, the last one ending before the
+      // last pulse
+      TimeSplitterType split;
+      for (int i = 0; i < 4; i++)
+        split.push_back(SplittingInterval(i * 200 + 100, i * 200 + 200, i));
+
+      TS_ASSERT_THROWS_NOTHING(el.splitByPulseTime(split, outputs));
+
+      std::map<int, size_t> expected;
+      auto original = this->fake_data();
+      for (size_t i = 0; i < original.getNumberEvents(); i++) {
+        const auto pulse = original.getEvent(i).pulseTime().totalNanoseconds();
+        if (pulse >= 800)
+          continue;
+        const int64_t slot = pulse / 100;
+        ++expected[slot % 2 == 1 ? static_cast<int>(slot / 2) : -1];
+      }
+      for (const auto &output : outputs) {
+        TS_ASSERT_EQUALS(output.second->getNumberEvents(),
+                         expected[output.first]);
+        TS_ASSERT_EQUALS(output.second->getEventType(), curType);
+        for (size_t i = 0; i < output.second->getNumberEvents(); i++) {
+          const auto pulse = output.second->getEvent(i).pulseTime();
+          if (output.first >= 0) {
+            TS_ASSERT_LESS_THAN_EQUALS(split[output.first].start(), pulse);
+            TS_ASSERT_LESS_THAN(pulse, split[output.first].stop());
+          }
+        }
+        delete output.second;
+      }
+    }
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_filterByPulseTime() {
     // Go through each possible EventType (except the no-time one) as the input
@@ -2071,6 +2330,52 @@ public:
     TS_ASSERT_THROWS(el.filterInPlace(split), const std::runtime_error &)
   }
 
+  void test_splitByTime_with_index_matches_splitByTime() {
+    for (const auto curType : {TOF, WEIGHTED}) {
+      this->fake_uniform_time_data();
+      el.switchTo(curType);
+
+      TimeSplitterType split;
+      for (int i = 0; i < 10; i++)
+        split.push_back(SplittingInterval(i * 100 + 10, (i + 1) * 100, i % 3));
+      const TimeSplitterIndex index(split);
+
+      std::vector<EventList> expected(3), actual(3);
+      std::vector<EventList *> expectedOutputs, actualOutputs;
+      for (size_t i = 0; i < 3; i++) {
+        expectedOutputs.push_back(&expected[i]);
+        actualOutputs.push_back(&actual[i]);
+      }
+      el.splitByTime(split, expectedOutputs);
+      el.splitByTime(index, actualOutputs);
+
+      for (size_t i = 0; i < 3; i++) {
+        TS_ASSERT_EQUALS(actual[i].getEventType(), curType);
+        TS_ASSERT_EQUALS(actual[i].getNumberEvents(),
+                         expected[i].getNumberEvents());
+        for (size_t j = 0; j < expected[i].getNumberEvents(); ++j) {
+          TS_ASSERT_EQUALS(actual[i].getEvent(j).pulseTime(),
+                           expected[i].getEvent(j).pulseTime());
+        }
+      }
+    }
+  }
+
+  void test_filterInPlace_with_index() {
+    this->fake_uniform_time_data();
+    TimeSplitterType split;
+    split.push_back(SplittingInterval(300, 350, 0));
+    split.push_back(SplittingInterval(100, 200, 0));
+    el.filterInPlace(TimeSplitterIndex(split));
+
+    // 100-199 and 300-349 are in the output, everything else is gone.
+    TS_ASSERT_EQUALS(el.getNumberEvents(), 150);
+    TS_ASSERT_EQUALS(el.getEvent(0).pulseTime(), 100);
+    TS_ASSERT_EQUALS(el.getEvent(99).pulseTime(), 199);
+    TS_ASSERT_EQUALS(el.getEvent(100).pulseTime(), 300);
+    TS_ASSERT_EQUALS(el.getEvent(149).pulseTime(), 349);
+  }
+
   //----------------------------------------------------------------------------------------------
   void test_ParallelizedSorting() {
     for (int this_type = 0; this_type < 3; this_type++) {
@@ -2228,6 +2533,30 @@ public:
     TS_ASSERT_EQUALS(varyingOut, varyingOut2);
   }
 
+  void test_compressEvents_parallel_matches_serial() {
+    el = EventList();
+    for (double tof = 100; tof < MAX_TOF; tof += 10.)
+      for (int i = 0; i < 3; ++i)
+        el += TofEvent(tof + 0.1 * i, 0);
+
+    for (const double tolerance : {0., 0.15, 0.5, 20.}) {
+      EventList serial, parallel;
+      el.compressEvents(tolerance, &serial);
+      el.compressEvents(tolerance, &parallel, true);
+      TS_ASSERT_EQUALS(parallel.getEventType(), WEIGHTED_NOTIME);
+      const auto &expected = serial.getWeightedEventsNoTime();
+      const auto &actual = parallel.getWeightedEventsNoTime();
+      TS_ASSERT_EQUALS(actual.size(), expected.size());
+      if (actual.size() != expected.size())
+        continue;
+      for (size_t i = 0; i < actual.size(); ++i) {
+        TS_ASSERT_EQUALS(actual[i].tof(), expected[i].tof());
+        TS_ASSERT_EQUALS(actual[i].weight(), expected[i].weight());
+        TS_ASSERT_EQUALS(actual[i].errorSquared(), expected[i].errorSquared());
+      }
+    }
+  }
+
   void test_compressWeightedFatEvents() {
     this->fake_uniform_data_weights(WEIGHTED);
     EventList uniformOut;
@@ -2904,6 +3233,8 @@ public:
 
   void test_sort_tof() { el_random.sortTof(); }
 
+  void test_sort_pulsetime_tof() { el_random.sortPulseTimeTOF(); }
+
   void test_compressEvents() {
     EventList out_el;
     el_sorted.compressEvents(10.0, &out_el);
@@ -2911,7 +3242,7 @@ public:
 
   void test_compressEvents_Parallel() {
     EventList out_el;
-    el_sorted.compressEvents(10.0, &out_el);
+    el_sorted.compressEvents(10.0, &out_el, true);
   }
 
   void test_multiply() { el_random *= 2.345; }
@@ -2937,6 +3268,16 @@ public:
     el_sorted_weighted.generateHistogram(coarseX, Y, E);
   }
 
+  void test_histogram_fine_unsorted() {
+    MantidVec Y, E;
+    el_random.generateHistogram(fineX, Y, E);
+  }
+
+  void test_histogram_coarse_unsorted() {
+    MantidVec Y, E;
+    el_random.generateHistogram(coarseX, Y, E);
+  }
+
   void test_maskTof() {
     TS_ASSERT_EQUALS(el_sorted.getNumberEvents(), 10000000);
     el_sorted.maskTof(25e3, 75e3);
@@ -11,9 +11,16 @@
 #include "MantidKernel/Timer.h"
 #include <cxxtest/TestSuite.h>
 
+#include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <vector>
 
 using namespace Mantid::DataObjects;
+using Mantid::HistogramData::HistogramE;
+using Mantid::HistogramData::HistogramY;
+using Mantid::Kernel::make_cow;
 
 class EventWorkspaceMRUTest : public CxxTest::TestSuite {
 public:
@@ -22,6 +29,103 @@ public:
     TS_ASSERT_THROWS_NOTHING(mru.MRUSize());
     TS_ASSERT_EQUALS(mru.MRUSize(), 0);
   }
+
+  void test_insert_and_find() {
+    EventWorkspaceMRU mru;
+    std::vector<EventList> lists(2);
+    auto y = make_cow<HistogramY>(10, 1.0);
+    auto e = make_cow<HistogramE>(10, 2.0);
+    mru.insertY(0, y, &lists[0]);
+    mru.insertE(0, e, &lists[0]);
+    TS_ASSERT_EQUALS(mru.findY(0, &lists[0]), y);
+    TS_ASSERT_EQUALS(mru.findE(0, &lists[0]), e);
+    TS_ASSERT(!mru.findY(0, &lists[1]));
+    TS_ASSERT_EQUALS(mru.MRUSize(), 1);
+
+    mru.deleteIndex(&lists[0]);
+    TS_ASSERT(!mru.findY(0, &lists[0]));
+    TS_ASSERT(!mru.findE(0, &lists[0]));
+  }
+
+  void test_insert_existing_index_keeps_cached_data() {
+    EventWorkspaceMRU mru;
+    EventList list;
+    auto first = make_cow<HistogramY>(10, 1.0);
+    mru.insertY(0, first, &list);
+    mru.insertY(0, make_cow<HistogramY>(10, 2.0), &list);
+    TS_ASSERT_EQUALS(mru.findY(0, &list), first);
+    TS_ASSERT_EQUALS(mru.MRUSize(), 1);
+  }
+
+  void test_updateIndex() {
+    EventWorkspaceMRU mru;
+    std::vector<EventList> lists(2);
+    auto y = make_cow<HistogramY>(10, 1.0);
+    mru.insertY(0, y, &lists[0]);
+    mru.insertE(0, make_cow<HistogramE>(10, 1.0), &lists[0]);
+    mru.insertE(0, make_cow<HistogramE>(10, 1.0), &lists[1]);
+    mru.updateIndex(&lists[0], [](EventWorkspaceMRU::YType &y,
+                                  EventWorkspaceMRU::EType &e) {
+      y = make_cow<HistogramY>(10, 3.0);
+      e = make_cow<HistogramE>(10, 4.0);
+      return true;
+    });
+    TS_ASSERT_EQUALS((*mru.findY(0, &lists[0]))[0], 3.0);
+    TS_ASSERT_EQUALS((*mru.findE(0, &lists[0]))[0], 4.0);
+    // Data obtained before the update is not modified
+    TS_ASSERT_EQUALS((*y)[0], 1.0);
+
+    // Without its Y, the E of an event list is dropped
+    mru.updateIndex(&lists[1], [](EventWorkspaceMRU::YType &,
+                                  EventWorkspaceMRU::EType &) { return true; });
+    TS_ASSERT(!mru.findE(0, &lists[1]));
+
+    mru.updateIndex(&lists[0], [](EventWorkspaceMRU::YType &,
+                                  EventWorkspaceMRU::EType &) { return false; });
+    TS_ASSERT(!mru.findY(0, &lists[0]));
+    TS_ASSERT(!mru.findE(0, &lists[0]));
+  }
+
+  void test_thread_numbers_beyond_shards_are_supported() {
+    EventWorkspaceMRU mru;
+    EventList list;
+    const size_t thread = PARALLEL_GET_MAX_THREADS + 3;
+    auto y = make_cow<HistogramY>(10, 1.0);
+    mru.insertY(thread, y, &list);
+    TS_ASSERT_EQUALS(mru.findY(thread, &list), y);
+  }
+
+  void test_number_of_entries_is_limited_without_budget() {
+    EventWorkspaceMRU mru;
+    mru.setMemoryBudget(0);
+    std::vector<EventList> lists(60);
+    for (auto &list : lists)
+      mru.insertY(0, make_cow<HistogramY>(10, 1.0), &list);
+    TS_ASSERT_EQUALS(mru.MRUSize(), 50);
+    TS_ASSERT(!mru.findY(0, &lists[9]));
+    TS_ASSERT(mru.findY(0, &lists[10]));
+  }
+
+  void test_memory_budget_drops_oldest_histograms() {
+    EventWorkspaceMRU mru;
+    const size_t numShards = PARALLEL_GET_MAX_THREADS;
+    // Room for two histograms of 100 values in each shard
+    mru.setMemoryBudget(2 * numShards * 250 * sizeof(double));
+    TS_ASSERT_EQUALS(mru.memoryBudget(),
+                     2 * numShards * 250 * sizeof(double));
+    std::vector<EventList> lists(100);
+    for (auto &list : lists)
+      mru.insertY(0, make_cow<HistogramY>(100, 1.0), &list);
+    TS_ASSERT_EQUALS(mru.MRUSize(), 2);
+    TS_ASSERT(mru.findY(0, &lists[98]));
+    TS_ASSERT(mru.findY(0, &lists[99]));
+
+    // The most recent histogram is kept even if it exceeds the budget
+    EventList big;
+    mru.insertY(0, make_cow<HistogramY>(1000, 1.0), &big);
+    TS_ASSERT_EQUALS(mru.MRUSize(), 1);
+    TS_ASSERT(mru.findY(0, &big));
+  }
 };
 
 #endif /* MANTID_DATAOBJECTS_EVENTWORKSPACEMRUTEST_H_ */
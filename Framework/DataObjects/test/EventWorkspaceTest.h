@@ -25,6 +25,7 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
 #include "MantidHistogramData/LinearGenerator.h"
 #include "MantidKernel/Memory.h"
 #include "MantidKernel/Timer.h"
@@ -799,6 +800,75 @@ public:
     TS_ASSERT_EQUALS(hist1.sharedE(), hist2.sharedE());
   }
 
+  void test_generateHistograms_with_common_bins() {
+    Workspace2D output;
+    output.initialize(NUMPIXELS, 2, 1);
+    TS_ASSERT_THROWS_NOTHING(ew->generateHistograms(output));
+    TS_ASSERT_EQUALS(output.sharedX(0), output.sharedX(NUMPIXELS - 1));
+    for (size_t i = 0; i < static_cast<size_t>(NUMPIXELS); i += 50) {
+      TS_ASSERT_EQUALS(output.x(i), ew->x(i));
+      TS_ASSERT_EQUALS(output.y(i), ew->y(i));
+      TS_ASSERT_EQUALS(output.e(i), ew->e(i));
+    }
+  }
+
+  void test_generateHistograms_with_different_bins() {
+    ew->getSpectrum(0).setHistogram(BinEdges({0., 10000., 20000.}));
+    Workspace2D output;
+    output.initialize(NUMPIXELS, 2, 1);
+    TS_ASSERT_THROWS_NOTHING(ew->generateHistograms(output));
+    TS_ASSERT_EQUALS(output.y(0).size(), 2);
+    TS_ASSERT_EQUALS(output.y(0), ew->y(0));
+    TS_ASSERT_EQUALS(output.e(0), ew->e(0));
+    TS_ASSERT_EQUALS(output.y(1).size(), NUMBINS - 1);
+    TS_ASSERT_EQUALS(output.y(1), ew->y(1));
+  }
+
+  void test_generateHistograms_skipError() {
+    Workspace2D output;
+    output.initialize(NUMPIXELS, 2, 1);
+    TS_ASSERT_THROWS_NOTHING(ew->generateHistograms(output, true));
+    TS_ASSERT_EQUALS(output.y(1), ew->y(1));
+    TS_ASSERT_DELTA(ew->e(1)[1], std::sqrt(2.0), 1e-12);
+    TS_ASSERT_EQUALS(output.e(1)[1], 0.0);
+  }
+
+  void test_generateHistograms_throws_for_wrong_number_of_spectra() {
+    Workspace2D output;
+    output.initialize(NUMPIXELS - 1, 2, 1);
+    TS_ASSERT_THROWS(ew->generateHistograms(output),
+                     const std::invalid_argument &);
+  }
+
+  void test_appending_events_updates_histogram_in_MRU() {
+    auto &eventList = ew->getSpectrum(1);
+    const auto &cached = ew->y(1);
+    TS_ASSERT_EQUALS(ew->MRUSize(), 1);
+    const double countsBefore = cached[2];
+
+    eventList += std::vector<TofEvent>{TofEvent(1500.), TofEvent(2500.),
+                                       TofEvent(2600.)};
+    TS_ASSERT_EQUALS(ew->MRUSize(), 1);
+    const auto updatedY = ew->y(1);
+    const auto updatedE = ew->e(1);
+    TS_ASSERT_EQUALS(updatedY[2], countsBefore + 2.);
+
+    ew->clearMRU();
+    TS_ASSERT_EQUALS(updatedY, ew->y(1));
+    for (size_t i = 0; i < updatedE.size(); ++i)
+      TS_ASSERT_DELTA(updatedE[i], ew->e(1)[i], 1e-12);
+  }
+
+  void test_appending_single_event_leaves_MRU_to_be_cleared() {
+    auto &eventList = ew->getSpectrum(1);
+    ew->y(1);
+    eventList += TofEvent(1500.);
+    // The histogram in the MRU no longer matches the number of events, it is
+    // dropped at the next append
+    eventList += std::vector<TofEvent>{TofEvent(2500.)};
+    TS_ASSERT_EQUALS(ew->MRUSize(), 0);
+  }
+
   void test_clearing_EventList_clears_MRU() {
     auto ws = WorkspaceCreationHelper::createRandomEventWorkspace(2, 1);
     auto y = ws->sharedY(0);
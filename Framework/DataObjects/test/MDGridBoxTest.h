@@ -897,6 +897,62 @@ public:
     delete bcc;
   }
 
+  //-------------------------------------------------------------------------------------
+  /** Adding events in bulk puts them in the same boxes, in the same order, as
+   * adding them one by one
+   */
+  void test_addEventsUnsafe_matches_addEventUnsafe() {
+    auto bulk = MDEventsTestHelper::makeMDGridBox<2>();
+    auto single = MDEventsTestHelper::makeMDGridBox<2>();
+    // The 0-th box is further split
+    bulk->splitContents(0);
+    single->splitContents(0);
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<coord_t> position(0.f, 9.999f);
+    std::uniform_real_distribution<coord_t> nearOrigin(0.f, 0.999f);
+    std::vector<MDLeanEvent<2>> events;
+    for (size_t i = 0; i < 1000; ++i) {
+      auto &distribution = i % 4 == 0 ? nearOrigin : position;
+      coord_t centers[2] = {distribution(generator), distribution(generator)};
+      events.emplace_back(static_cast<float>(i), 1.f, centers);
+    }
+
+    TS_ASSERT_EQUALS(bulk->addEventsUnsafe(events), 0);
+    for (const auto &event : events)
+      single->addEventUnsafe(event);
+    bulk->refreshCache(nullptr);
+    single->refreshCache(nullptr);
+    TS_ASSERT_EQUALS(bulk->getNPoints(), 1000);
+    TS_ASSERT_EQUALS(bulk->getSignal(), single->getSignal());
+
+    std::vector<API::IMDNode *> bulkBoxes, singleBoxes;
+    bulk->getBoxes(bulkBoxes, 1000, true);
+    single->getBoxes(singleBoxes, 1000, true);
+    TS_ASSERT_EQUALS(bulkBoxes.size(), 199);
+    TS_ASSERT_EQUALS(bulkBoxes.size(), singleBoxes.size());
+    for (size_t i = 0; i < bulkBoxes.size(); ++i) {
+      auto bulkBox = dynamic_cast<MDBox<MDLeanEvent<2>, 2> *>(bulkBoxes[i]);
+      auto singleBox = dynamic_cast<MDBox<MDLeanEvent<2>, 2> *>(singleBoxes[i]);
+      const auto &bulkEvents = bulkBox->getConstEvents();
+      const auto &singleEvents = singleBox->getConstEvents();
+      TS_ASSERT_EQUALS(bulkEvents.size(), singleEvents.size());
+      for (size_t j = 0; j < std::min(bulkEvents.size(), singleEvents.size());
+           ++j)
+        TS_ASSERT_EQUALS(bulkEvents[j].getSignal(),
+                         singleEvents[j].getSignal());
+      bulkBox->releaseEvents();
+      singleBox->releaseEvents();
+    }
+
+    BoxController *const bulkBC = bulk->getBoxController();
+    delete bulk;
+    delete bulkBC;
+    BoxController *const singleBC = single->getBoxController();
+    delete single;
+    delete singleBC;
+  }
+
   ////-------------------------------------------------------------------------------------
   ///** Tests add_events with limits into the vectorthat bad events are thrown
   /// out when using addEvents.
@@ -1305,6 +1361,55 @@ public:
     delete bcc;
   }
 
+  void test_integrateSpheres_matches_integrateSphere() {
+    auto box = MDEventsTestHelper::makeMDGridBox<2>();
+    // Some boxes are further split
+    box->splitContents(0);
+    box->splitContents(45);
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<coord_t> position(0.f, 9.999f);
+    for (size_t i = 0; i < 2000; ++i) {
+      coord_t centers[2] = {position(generator), position(generator)};
+      box->addEventUnsafe(
+          MDLeanEvent<2>(static_cast<float>(1 + i % 3), 1.f, centers));
+    }
+    box->refreshCache(nullptr);
+
+    // Spheres and shells, some off the edges or outside the box
+    std::uniform_real_distribution<double> centre(-2., 12.);
+    std::uniform_real_distribution<double> radius(0.05, 3.);
+    bool dimensionsUsed[2] = {true, true};
+    std::vector<std::unique_ptr<CoordTransformDistance>> transforms;
+    std::vector<API::IMDNode::SphereIntegral> spheres;
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < 100; ++i) {
+      coord_t center[2] = {static_cast<coord_t>(centre(generator)),
+                           static_cast<coord_t>(centre(generator))};
+      transforms.emplace_back(
+          std::make_unique<CoordTransformDistance>(2, center, dimensionsUsed));
+      const auto outer = static_cast<coord_t>(std::pow(radius(generator), 2));
+      const coord_t inner = i % 2 == 0 ? 0.f : outer / 4;
+      auto transform = transforms.back().get();
+      spheres.push_back(
+          {transform, transform->getCenter(), outer, inner, 0., 0.});
+      indices.push_back(i);
+    }
+    box->integrateSpheres(spheres, indices);
+
+    for (const auto &sphere : spheres) {
+      signal_t signal = 0;
+      signal_t errorSquared = 0;
+      box->integrateSphere(*sphere.radiusTransform, sphere.radiusSquared,
+                           signal, errorSquared, sphere.innerRadiusSquared);
+      TS_ASSERT_EQUALS(sphere.signal, signal);
+      TS_ASSERT_EQUALS(sphere.errorSquared, errorSquared);
+    }
+
+    BoxController *const bc = box->getBoxController();
+    delete box;
+    delete bc;
+  }
+
   /** Had a really-hard to find bug where the tests worked only
    * if the extents started at 0.0.
    * This test has a box from -10.0 to +10.0 to check for that
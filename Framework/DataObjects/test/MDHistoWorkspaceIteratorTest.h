@@ -1408,6 +1408,54 @@ public:
     TSM_ASSERT("Neighbour at index is 23",
                doesContainIndex(neighbourIndexes, 23)); // Invalid
   }
+
+  void test_neighbours_3d_vertex_touching_width_away_from_edges() {
+    const size_t nd = 3;
+    const size_t nBins = 5;
+    MDHistoWorkspace_sptr ws =
+        MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, nd, nBins);
+    MDHistoWorkspaceIterator it(ws);
+    // Index 62 is the centre (2, 2, 2), so all 26 neighbours are inside
+    it.jumpTo(62);
+    std::vector<size_t> expected;
+    for (int k = -1; k <= 1; ++k)
+      for (int j = -1; j <= 1; ++j)
+        for (int i = -1; i <= 1; ++i)
+          if (i != 0 || j != 0 || k != 0)
+            expected.push_back(62 + i + 5 * j + 25 * k);
+    TS_ASSERT_EQUALS(expected, it.findNeighbourIndexesByWidth(3));
+    TS_ASSERT_EQUALS(expected, it.findNeighbourIndexes());
+
+    const auto faceTouching = it.findNeighbourIndexesFaceTouching();
+    TS_ASSERT_EQUALS(6, faceTouching.size());
+    TS_ASSERT(doesContainIndex(faceTouching, 61));
+    TS_ASSERT(doesContainIndex(faceTouching, 63));
+    TS_ASSERT(doesContainIndex(faceTouching, 57));
+    TS_ASSERT(doesContainIndex(faceTouching, 67));
+    TS_ASSERT(doesContainIndex(faceTouching, 37));
+    TS_ASSERT(doesContainIndex(faceTouching, 87));
+
+    // One step in from the centre only width 3 neighbours are all inside
+    it.jumpTo(61);
+    const auto byWidth = it.findNeighbourIndexesByWidth(5);
+    TS_ASSERT_EQUALS(99, byWidth.size());
+    TS_ASSERT(std::is_sorted(byWidth.begin(), byWidth.end()));
+  }
+
+  void test_neighbours_into_existing_vector_matches_returned() {
+    const std::vector<int> widths{3, 5};
+    MDHistoWorkspace_sptr ws =
+        MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 2, 6);
+    MDHistoWorkspaceIterator it(ws);
+    std::vector<size_t> neighbourIndexes;
+    do {
+      it.findNeighbourIndexesByWidth(widths, neighbourIndexes);
+      TS_ASSERT_EQUALS(it.findNeighbourIndexesByWidth(widths),
+                       neighbourIndexes);
+      const auto withValidity = it.findNeighbourIndexesByWidth1D(3, 0);
+      TS_ASSERT_EQUALS(withValidity.first.size(), 3);
+    } while (it.next());
+  }
 };
 
 class MDHistoWorkspaceIteratorTestPerformance : public CxxTest::TestSuite {
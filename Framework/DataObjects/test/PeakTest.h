@@ -19,7 +19,9 @@
 #include <cxxtest/TestSuite.h>
 #include <gmock/gmock.h>
 
+#include "MantidDataObjects/NoShape.h"
 #include "MantidDataObjects/Peak.h"
+#include "MantidDataObjects/PeakShapeSpherical.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
 
 using namespace Mantid::DataObjects;
@@ -144,6 +146,29 @@ public:
     check_Contributing_Detectors(p2, std::vector<int>(1, 10102));
   }
 
+  void test_copies_are_independent() {
+    Matrix<double> gonio(3, 3);
+    gonio[0][0] = 1.0;
+    gonio[1][2] = 1.0;
+    gonio[2][1] = 1.0;
+    Peak p(inst, 10102, 2.0, V3D(1, 2, 3), gonio);
+    Peak copy(p);
+    Peak assigned;
+    assigned = p;
+    TS_ASSERT_EQUALS(copy.getQSampleFrame(), p.getQSampleFrame());
+    TS_ASSERT_EQUALS(assigned.getQSampleFrame(), p.getQSampleFrame());
+
+    copy.setGoniometerMatrix(Matrix<double>(3, 3, true));
+    assigned.setPeakShape(new PeakShapeSpherical(
+        1.0, Mantid::Kernel::SpecialCoordinateSystem::QLab, "test", 1));
+    TS_ASSERT_EQUALS(p.getGoniometerMatrix(), gonio);
+    TS_ASSERT_EQUALS(copy.getGoniometerMatrix(), Matrix<double>(3, 3, true));
+    TS_ASSERT_EQUALS(copy.getQSampleFrame(), p.getQLabFrame());
+    TS_ASSERT_EQUALS(p.getPeakShape().shapeName(), NoShape::noShapeName());
+    TS_ASSERT_EQUALS(assigned.getPeakShape().shapeName(),
+                     PeakShapeSpherical::sphereShapeName());
+  }
+
   void test_getValueByColName() {
     Peak p(inst, 10102, 2.0);
     p.setHKL(1, 2, 3);
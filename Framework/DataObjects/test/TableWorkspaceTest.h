@@ -685,6 +685,32 @@ public:
     TS_ASSERT_EQUALS(data3[0], 5);
   }
 
+  void test_removeRows_keeps_the_other_rows_in_order() {
+    TableWorkspace ws(6);
+    ws.addColumn("int", "col1");
+    ws.addColumn("str", "col2");
+    auto &data1 = static_cast<TableColumn<int> &>(*ws.getColumn("col1")).data();
+    auto &data2 =
+        static_cast<TableColumn<std::string> &>(*ws.getColumn("col2")).data();
+    for (int i = 0; i < 6; ++i) {
+      data1[i] = i;
+      data2[i] = std::to_string(i);
+    }
+
+    TS_ASSERT_THROWS_NOTHING(ws.removeRows({4, 0, 2, 4}));
+
+    TS_ASSERT_EQUALS(ws.rowCount(), 3);
+    TS_ASSERT_EQUALS(data1, std::vector<int>({1, 3, 5}));
+    TS_ASSERT_EQUALS(data2, std::vector<std::string>({"1", "3", "5"}));
+  }
+
+  void test_removeRows_throws_for_a_row_that_does_not_exist() {
+    TableWorkspace ws(3);
+    ws.addColumn("int", "col1");
+    TS_ASSERT_THROWS(ws.removeRows({1, 3}), const std::range_error &);
+    TS_ASSERT_EQUALS(ws.rowCount(), 3);
+  }
+
   /**
    * Test declaring an input TableWorkspace and retrieving it as const_sptr
    * or sptr
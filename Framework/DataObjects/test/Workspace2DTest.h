@@ -7,10 +7,13 @@
 #ifndef WORKSPACE2DTEST_H_
 #define WORKSPACE2DTEST_H_
 
+#include "MantidAPI/AlgorithmHistory.h"
+#include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/ISpectrum.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/SpectraAxis.h"
 #include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/WorkspaceHistory.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidHistogramData/LinearGenerator.h"
@@ -272,6 +275,114 @@ public:
     TS_ASSERT(wsCastNonConst != nullptr);
     TS_ASSERT_EQUALS(wsCastConst, wsCastNonConst);
   }
+
+  void test_spilled_by_the_ADS_and_reloaded() {
+    auto &ads = AnalysisDataService::Instance();
+    ads.clear();
+    const auto limit = ads.memoryLimit();
+    ads.setMemoryLimit(size_t(1) << 30);
+    size_t memorySize;
+    {
+      auto first = create2DWorkspaceBinned(5, 100);
+      first->mutableY(3)[7] = 42.;
+      first->setMaskedBins(2, {{4, 0.5}});
+      first->setTitle("first");
+      first->history().addHistory(boost::make_shared<AlgorithmHistory>(
+          "CreateWorkspace", 1, "b5b65a94-e656-468e-987c-644288fac655"));
+      first->history().addHistory(boost::make_shared<AlgorithmHistory>(
+          "Rebin", 1, "0c1d2f6e-7a58-4f1b-9f35-2a1e9c7d6b41"));
+      ads.add("spilledFirst", first);
+      auto second = create2DWorkspaceBinned(5, 100);
+      ads.add("spilledSecond", second);
+      memorySize = second->getMemorySize();
+    }
+    ads.setMemoryLimit(memorySize + 1000);
+    // The least recently used workspace goes to disk
+    TS_ASSERT(ads.isSpilled("spilledFirst"));
+    TS_ASSERT(!ads.isSpilled("spilledSecond"));
+    TS_ASSERT_LESS_THAN_EQUALS(ads.memoryUsage(), ads.memoryLimit());
+
+    auto reloaded = ads.retrieveWS<Workspace2D>("spilledFirst");
+    TS_ASSERT(reloaded);
+    TS_ASSERT(!ads.isSpilled("spilledFirst"));
+    TS_ASSERT(ads.isSpilled("spilledSecond"));
+    TS_ASSERT_EQUALS(reloaded->getName(), "spilledFirst");
+    TS_ASSERT_EQUALS(reloaded->getTitle(), "first");
+    TS_ASSERT_EQUALS(reloaded->getNumberHistograms(), 5);
+    TS_ASSERT_EQUALS(reloaded->blocksize(), 100);
+    TS_ASSERT_EQUALS(reloaded->y(3)[7], 42.);
+    TS_ASSERT_EQUALS(reloaded->y(0)[0], 2.);
+    TS_ASSERT_EQUALS(reloaded->x(0).size(), 101);
+    TS_ASSERT_EQUALS(&reloaded->x(0), &reloaded->x(4));
+    TS_ASSERT(reloaded->hasMaskedBins(2));
+    TS_ASSERT_EQUALS(reloaded->getHistory().size(), 2);
+    TS_ASSERT_EQUALS(
+        reloaded->getHistory().getAlgorithmHistory(1)->name(), "Rebin");
+
+    ads.setMemoryLimit(limit);
+    ads.clear();
+  }
+
+  void test_spilled_workspaces_are_reloaded_when_listed() {
+    auto &ads = AnalysisDataService::Instance();
+    ads.clear();
+    const auto limit = ads.memoryLimit();
+    ads.setMemoryLimit(size_t(1) << 30);
+    size_t memorySize;
+    {
+      auto first = create2DWorkspaceBinned(5, 100);
+      ads.add("spilledFirst", first);
+      auto second = create2DWorkspaceBinned(5, 100);
+      ads.add("spilledSecond", second);
+      memorySize = second->getMemorySize();
+    }
+    ads.setMemoryLimit(memorySize + 1000);
+    TS_ASSERT(ads.isSpilled("spilledFirst"));
+
+    // Lists filtered by type hold the spilled workspace too
+    size_t matrixWorkspaces(0);
+    for (const auto &workspace : ads.getObjects()) {
+      if (boost::dynamic_pointer_cast<MatrixWorkspace>(workspace))
+        ++matrixWorkspaces;
+    }
+    TS_ASSERT_EQUALS(matrixWorkspaces, 2);
+    TS_ASSERT(!ads.isSpilled("spilledFirst"));
+
+    ads.setMemoryLimit(limit);
+    ads.clear();
+  }
+
+  void test_spilled_workspace_retrieved_concurrently_is_reloaded_once() {
+    auto &ads = AnalysisDataService::Instance();
+    ads.clear();
+    const auto limit = ads.memoryLimit();
+    ads.setMemoryLimit(size_t(1) << 30);
+    size_t memorySize;
+    {
+      auto first = create2DWorkspaceBinned(5, 100);
+      ads.add("spilledFirst", first);
+      auto second = create2DWorkspaceBinned(5, 100);
+      ads.add("spilledSecond", second);
+      memorySize = second->getMemorySize();
+    }
+    ads.setMemoryLimit(memorySize + 1000);
+    TS_ASSERT(ads.isSpilled("spilledFirst"));
+
+    // Each reload reads the file with the service unlocked, but all the
+    // threads must end up with the workspace stored in the service
+    std::vector<Workspace2D_sptr> retrieved(8);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(retrieved.size()); ++i)
+      retrieved[i] = ads.retrieveWS<Workspace2D>("spilledFirst");
+    const auto stored = ads.retrieveWS<Workspace2D>("spilledFirst");
+    for (const auto &workspace : retrieved) {
+      TS_ASSERT_EQUALS(workspace, stored);
+    }
+    TS_ASSERT_EQUALS(stored->y(0)[0], 2.);
+
+    ads.setMemoryLimit(limit);
+    ads.clear();
+  }
 };
 
 class Workspace2DTestPerformance : public CxxTest::TestSuite {
@@ -9,6 +9,9 @@
 
 #include "MantidGeometry/Crystal/StructureFactorCalculator.h"
 #include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/Matrix.h"
+
+#include <vector>
 
 namespace Mantid {
 namespace Geometry {
@@ -20,6 +23,13 @@ namespace Geometry {
   the unit cell by combining the space group and the scatterers located in the
   asymmetric unit (both taken from CrystalStructure) and stores them.
 
+  When all the scatterers are isotropic atoms, their parameters are also
+  stored once, with the equivalent positions of each atom in the asymmetric
+  unit in separate arrays of coordinates. The structure factors are then
+  summed from those arrays without going through the scatterers' properties,
+  and the Debye-Waller factor is calculated once for each atom in the
+  asymmetric unit. getFs and getFsSquared calculate the HKLs in parallel.
+
       @author Michael Wedel, ESS
       @date 05/09/2015
 */
@@ -29,6 +39,11 @@ public:
   StructureFactorCalculatorSummation();
   StructureFactor getF(const Kernel::V3D &hkl) const override;
 
+  std::vector<StructureFactor>
+  getFs(const std::vector<Kernel::V3D> &hkls) const override;
+  std::vector<double>
+  getFsSquared(const std::vector<Kernel::V3D> &hkls) const override;
+
 protected:
   void
   crystalStructureSetHook(const CrystalStructure &crystalStructure) override;
@@ -37,6 +52,24 @@ protected:
   std::string getV3DasString(const Kernel::V3D &point) const;
 
   CompositeBraggScatterer_sptr m_unitCellScatterers;
+
+  /// An isotropic atom of the asymmetric unit and its equivalent positions
+  struct EquivalentAtoms {
+    /// Occupancy times scattering length
+    double amplitude;
+    /// Isotropic atomic displacement parameter
+    double u;
+    /// B matrix of the unit cell
+    Kernel::DblMatrix b;
+    /// Fractional coordinates of the equivalent positions
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+  };
+  /// The atoms of the unit cell, used when all scatterers are isotropic atoms
+  std::vector<EquivalentAtoms> m_equivalentAtoms;
+  /// Whether m_equivalentAtoms holds all the scatterers
+  bool m_useEquivalentAtoms;
 };
 
 using StructureFactorSummation_sptr =
@@ -92,6 +92,7 @@ public:
   void setRotation(const size_t index, const Kernel::Quat &rotation);
   void setRotation(const std::pair<size_t, size_t> &index,
                    const Kernel::Quat &rotation);
+  size_t positionsVersion() const;
 
   const Geometry::IDetector &detector(const size_t index) const;
 
@@ -32,6 +32,7 @@ namespace Geometry {
 class CompGrp;
 class GeometryHandler;
 class Track;
+class TriangleBVH;
 class vtkGeometryCacheReader;
 class vtkGeometryCacheWriter;
 
@@ -156,9 +157,16 @@ private:
   /// Search object for valid point
   bool searchForObject(Kernel::V3D &point) const;
 
+  /// Get the hierarchy of the triangles, built on first use
+  const TriangleBVH *getBVH() const;
+
   /// Cache for object's bounding box
   mutable BoundingBox m_boundingBox;
 
+  /// Cache for the bounding volume hierarchy of large meshes. Accessed with
+  /// the atomic functions of shared_ptr as it is built from const methods.
+  mutable std::shared_ptr<const TriangleBVH> m_bvh;
+
   /// Tolerence distance
   const double M_TOLERANCE = 0.000001;
 
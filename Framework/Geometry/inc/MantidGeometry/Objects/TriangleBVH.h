@@ -0,0 +1,67 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_GEOMETRY_TRIANGLEBVH_H_
+#define MANTID_GEOMETRY_TRIANGLEBVH_H_
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+
+/** TriangleBVH : a bounding volume hierarchy over the triangles of a mesh,
+  used to find the few triangles a ray may cross without testing all of them.
+
+  The triangles are split in two halves along the longest axis of the box of
+  their centres until at most a few are left in each leaf. Every node keeps
+  the axis-aligned box of its triangles, padded by Kernel::Tolerance, so that
+  a ray missing the box of a node misses all its triangles. The nodes are
+  stored depth first in a single array: the first child of a node follows
+  it.
+*/
+class MANTID_GEOMETRY_DLL TriangleBVH {
+public:
+  TriangleBVH(const std::vector<uint32_t> &triangles,
+              const std::vector<Kernel::V3D> &vertices);
+
+  void candidates(const Kernel::V3D &start, const Kernel::V3D &direction,
+                  std::vector<uint32_t> &triangles) const;
+
+  /// @return the number of nodes of the tree
+  size_t numberOfNodes() const { return m_nodes.size(); }
+
+private:
+  struct Node {
+    /// Bounds of the triangles of the node
+    double min[3];
+    double max[3];
+    /// Leaf: first of its triangles in m_order. Inner node: second child.
+    uint32_t index;
+    /// Number of triangles of a leaf, 0 for an inner node
+    uint32_t count;
+  };
+
+  uint32_t build(uint32_t first, uint32_t last,
+                 const std::vector<uint32_t> &triangles,
+                 const std::vector<Kernel::V3D> &vertices,
+                 const std::vector<Kernel::V3D> &centres);
+  static bool rayHitsBox(const Node &node, const Kernel::V3D &start,
+                         const Kernel::V3D &direction,
+                         const Kernel::V3D &inverse);
+
+  std::vector<Node> m_nodes;
+  /// Triangle indices, grouped by leaf
+  std::vector<uint32_t> m_order;
+};
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_TRIANGLEBVH_H_ */
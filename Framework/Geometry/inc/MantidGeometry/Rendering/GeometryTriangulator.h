@@ -30,6 +30,7 @@ private:
   size_t m_nPoints = 0;
   std::vector<double> m_points;        ///< double array or points
   std::vector<uint32_t> m_faces;       ///< Integer array of faces
+  std::vector<double> m_normals;       ///< Unit normals of the faces
   const CSGObject *m_csgObj = nullptr; ///< Input Object
   std::unique_ptr<RenderingMesh> m_meshObj;
   void checkTriangulated();
@@ -55,6 +56,8 @@ public:
   /// get a pointer to the 3x(NumberOFaces) integers describing points forming
   /// faces (p1,p2,p3)(p4,p5,p6).
   const std::vector<uint32_t> &getTriangleFaces();
+  /// get the 3x(NumberOfFaces) unit normals of the faces (n1x,n1y,n1z,n2x..)
+  const std::vector<double> &getTriangleNormals();
 #ifdef ENABLE_OPENCASCADE
 private:
   std::unique_ptr<TopoDS_Shape>
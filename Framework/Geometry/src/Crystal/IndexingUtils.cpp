@@ -7,6 +7,7 @@
 #include "MantidGeometry/Crystal/IndexingUtils.h"
 #include "MantidGeometry/Crystal/NiggliCell.h"
 #include "MantidKernel/EigenConversionHelpers.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Quat.h"
 
 #include <boost/math/special_functions/round.hpp>
@@ -1493,7 +1494,6 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
   constexpr size_t N_FFT_STEPS = 512;
   constexpr size_t HALF_FFT_STEPS = 256;
 
-  double fit_error;
   int max_indexed = 0;
 
   // first, make hemisphere of possible directions
@@ -1513,22 +1513,23 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
   max_mag_Q *= 1.1f; // allow for a little "headroom" for FFT range
 
   // apply the FFT to each of the directions, and
-  // keep track of their maximum magnitude past DC
+  // keep track of their maximum magnitude past DC.
+  // The directions are independent, so they are scanned in parallel, each
+  // thread using its own buffers for the FFT.
   double max_mag_fft;
   std::vector<double> max_fft_val;
   max_fft_val.resize(full_list.size());
 
-  double projections[N_FFT_STEPS];
-  double magnitude_fft[HALF_FFT_STEPS];
-
   double index_factor = N_FFT_STEPS / max_mag_Q; // maps |proj Q| to index
 
-  for (size_t dir_num = 0; dir_num < full_list.size(); dir_num++) {
-    V3D current_dir = full_list[dir_num];
-    max_mag_fft = GetMagFFT(q_vectors, current_dir, N_FFT_STEPS, projections,
-                            index_factor, magnitude_fft);
-
-    max_fft_val[dir_num] = max_mag_fft;
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int dir_num = 0; dir_num < static_cast<int>(full_list.size());
+       dir_num++) {
+    double projections[N_FFT_STEPS];
+    double magnitude_fft[HALF_FFT_STEPS];
+    max_fft_val[dir_num] =
+        GetMagFFT(q_vectors, full_list[dir_num], N_FFT_STEPS, projections,
+                  index_factor, magnitude_fft);
   }
   // find the directions with the 500 largest
   // fft values, and place them in temp_dirs vector
@@ -1562,65 +1563,69 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
   // FFT to find the cell edge length that
   // corresponds to the max_mag_fft.  Only keep
   // directions with length nearly in bounds
-  V3D temp;
-  std::vector<V3D> temp_dirs_2;
-
-  for (auto &temp_dir : temp_dirs) {
-    GetMagFFT(q_vectors, temp_dir, N_FFT_STEPS, projections, index_factor,
+  std::vector<double> d_vals(temp_dirs.size(), 0.0);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(temp_dirs.size()); i++) {
+    double projections[N_FFT_STEPS];
+    double magnitude_fft[HALF_FFT_STEPS];
+    GetMagFFT(q_vectors, temp_dirs[i], N_FFT_STEPS, projections, index_factor,
               magnitude_fft);
 
     double position =
         GetFirstMaxIndex(magnitude_fft, HALF_FFT_STEPS, threshold);
     if (position > 0) {
       double q_val = max_mag_Q / position;
-      double d_val = 1 / q_val;
-      if (d_val >= 0.8 * min_d && d_val <= 1.2 * max_d) {
-        temp = temp_dir * d_val;
-        temp_dirs_2.push_back(temp);
-      }
+      d_vals[i] = 1 / q_val;
     }
   }
+  std::vector<V3D> temp_dirs_2;
+  for (size_t i = 0; i < temp_dirs.size(); i++) {
+    if (d_vals[i] > 0 && d_vals[i] >= 0.8 * min_d &&
+        d_vals[i] <= 1.2 * max_d)
+      temp_dirs_2.push_back(temp_dirs[i] * d_vals[i]);
+  }
   // look at how many peaks were indexed
   // for each of the initial directions
-  max_indexed = 0;
-  int num_indexed;
-  V3D current_dir;
-  for (auto &dir_num : temp_dirs_2) {
-    current_dir = dir_num;
-    num_indexed = NumberIndexed_1D(current_dir, q_vectors, required_tolerance);
-    if (num_indexed > max_indexed)
-      max_indexed = num_indexed;
+  std::vector<int> num_indexed(temp_dirs_2.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(temp_dirs_2.size()); i++) {
+    num_indexed[i] =
+        NumberIndexed_1D(temp_dirs_2[i], q_vectors, required_tolerance);
   }
+  max_indexed = 0;
+  for (const auto count : num_indexed)
+    max_indexed = std::max(max_indexed, count);
 
   // only keep original directions that index
   // at least 50% of max num indexed
   temp_dirs.clear();
-  for (auto &dir_num : temp_dirs_2) {
-    current_dir = dir_num;
-    num_indexed = NumberIndexed_1D(current_dir, q_vectors, required_tolerance);
-    if (num_indexed >= 0.50 * max_indexed)
-      temp_dirs.push_back(current_dir);
+  for (size_t i = 0; i < temp_dirs_2.size(); i++) {
+    if (num_indexed[i] >= 0.50 * max_indexed)
+      temp_dirs.push_back(temp_dirs_2[i]);
   }
   // refine directions and again find the
   // max number indexed, for the optimized
   // directions
-  max_indexed = 0;
-  std::vector<int> index_vals;
-  std::vector<V3D> indexed_qs;
-  for (auto &temp_dir : temp_dirs) {
-    num_indexed = GetIndexedPeaks_1D(temp_dir, q_vectors, required_tolerance,
-                                     index_vals, indexed_qs, fit_error);
+  std::vector<int> max_refined(temp_dirs.size(), 0);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(temp_dirs.size()); i++) {
+    auto &temp_dir = temp_dirs[i];
+    double fit_error;
+    std::vector<int> index_vals;
+    std::vector<V3D> indexed_qs;
+    GetIndexedPeaks_1D(temp_dir, q_vectors, required_tolerance, index_vals,
+                       indexed_qs, fit_error);
     try {
       int count = 0;
       while (count < 5) // 5 iterations should be enough for
       {                 // the optimization to stabilize
         Optimize_Direction(temp_dir, index_vals, indexed_qs);
 
-        num_indexed =
+        const int refined_indexed =
             GetIndexedPeaks_1D(temp_dir, q_vectors, required_tolerance,
                                index_vals, indexed_qs, fit_error);
-        if (num_indexed > max_indexed)
-          max_indexed = num_indexed;
+        if (refined_indexed > max_refined[i])
+          max_refined[i] = refined_indexed;
 
         count++;
       }
@@ -1628,22 +1633,29 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
       // don't continue to refine if the direction fails to optimize properly
     }
   }
+  max_indexed = 0;
+  for (const auto count : max_refined)
+    max_indexed = std::max(max_indexed, count);
+
   // discard those with length out of bounds
   temp_dirs_2.clear();
   for (auto &temp_dir : temp_dirs) {
-    current_dir = temp_dir;
-    double length = current_dir.norm();
+    double length = temp_dir.norm();
     if (length >= 0.8 * min_d && length <= 1.2 * max_d)
-      temp_dirs_2.push_back(current_dir);
+      temp_dirs_2.push_back(temp_dir);
   }
   // only keep directions that index at
   // least 75% of the max number of peaks
+  num_indexed.resize(temp_dirs_2.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(temp_dirs_2.size()); i++) {
+    num_indexed[i] =
+        NumberIndexed_1D(temp_dirs_2[i], q_vectors, required_tolerance);
+  }
   temp_dirs.clear();
-  for (auto &dir_num : temp_dirs_2) {
-    current_dir = dir_num;
-    num_indexed = NumberIndexed_1D(current_dir, q_vectors, required_tolerance);
-    if (num_indexed > max_indexed * 0.75)
-      temp_dirs.push_back(current_dir);
+  for (size_t i = 0; i < temp_dirs_2.size(); i++) {
+    if (num_indexed[i] > max_indexed * 0.75)
+      temp_dirs.push_back(temp_dirs_2[i]);
   }
 
   std::sort(temp_dirs.begin(), temp_dirs.end(), V3D::compareMagnitude);
@@ -6,7 +6,10 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidGeometry/Crystal/StructureFactorCalculatorSummation.h"
 #include "MantidGeometry/Crystal/BraggScattererInCrystalStructure.h"
+#include "MantidGeometry/Crystal/IsotropicAtomBraggScatterer.h"
+#include "MantidKernel/MultiThreaded.h"
 
+#include <cmath>
 #include <iomanip>
 
 namespace Mantid {
@@ -16,12 +19,63 @@ using namespace Kernel;
 
 StructureFactorCalculatorSummation::StructureFactorCalculatorSummation()
     : StructureFactorCalculator(),
-      m_unitCellScatterers(CompositeBraggScatterer::create()) {}
+      m_unitCellScatterers(CompositeBraggScatterer::create()),
+      m_equivalentAtoms(), m_useEquivalentAtoms(false) {}
 
 /// Returns the structure factor obtained from the stored scatterers.
 StructureFactor
 StructureFactorCalculatorSummation::getF(const Kernel::V3D &hkl) const {
-  return m_unitCellScatterers->calculateStructureFactor(hkl);
+  if (!m_useEquivalentAtoms)
+    return m_unitCellScatterers->calculateStructureFactor(hkl);
+
+  StructureFactor structureFactor(0.0, 0.0);
+  for (const auto &atoms : m_equivalentAtoms) {
+    const V3D dstar = atoms.b * hkl;
+    const double debyeWallerFactor =
+        exp(-2.0 * M_PI * M_PI * atoms.u * dstar.norm2());
+
+    double sumCos = 0.0;
+    double sumSin = 0.0;
+    const size_t nPositions = atoms.x.size();
+    for (size_t i = 0; i < nPositions; ++i) {
+      const double phase = 2.0 * M_PI *
+                           (atoms.x[i] * hkl.X() + atoms.y[i] * hkl.Y() +
+                            atoms.z[i] * hkl.Z());
+      sumCos += cos(phase);
+      sumSin += sin(phase);
+    }
+
+    structureFactor += atoms.amplitude * debyeWallerFactor *
+                       StructureFactor(sumCos, sumSin);
+  }
+
+  return structureFactor;
+}
+
+/// Returns the structure factors of the HKLs, calculated in parallel if the
+/// scatterers are all isotropic atoms.
+std::vector<StructureFactor> StructureFactorCalculatorSummation::getFs(
+    const std::vector<Kernel::V3D> &hkls) const {
+  std::vector<StructureFactor> structureFactors(hkls.size());
+
+  PARALLEL_FOR_IF(m_useEquivalentAtoms)
+  for (int i = 0; i < static_cast<int>(hkls.size()); ++i)
+    structureFactors[i] = getF(hkls[i]);
+
+  return structureFactors;
+}
+
+/// Returns the squared structure factors of the HKLs, calculated in parallel
+/// if the scatterers are all isotropic atoms.
+std::vector<double> StructureFactorCalculatorSummation::getFsSquared(
+    const std::vector<Kernel::V3D> &hkls) const {
+  std::vector<double> fSquareds(hkls.size());
+
+  PARALLEL_FOR_IF(m_useEquivalentAtoms)
+  for (int i = 0; i < static_cast<int>(hkls.size()); ++i)
+    fSquareds[i] = getFSquared(hkls[i]);
+
+  return fSquareds;
 }
 
 /// Calls updateUnitCellScatterers() to rebuild the complete list of scatterers.
@@ -42,6 +96,8 @@ void StructureFactorCalculatorSummation::crystalStructureSetHook(
 void StructureFactorCalculatorSummation::updateUnitCellScatterers(
     const CrystalStructure &crystalStructure) {
   m_unitCellScatterers->removeAllScatterers();
+  m_equivalentAtoms.clear();
+  m_useEquivalentAtoms = false;
 
   CompositeBraggScatterer_sptr scatterersInAsymmetricUnit =
       crystalStructure.getScatterers();
@@ -51,6 +107,7 @@ void StructureFactorCalculatorSummation::updateUnitCellScatterers(
     std::vector<BraggScatterer_sptr> braggScatterers;
     braggScatterers.reserve(scatterersInAsymmetricUnit->nScatterers() *
                             spaceGroup->order());
+    bool allIsotropicAtoms = true;
 
     for (size_t i = 0; i < scatterersInAsymmetricUnit->nScatterers(); ++i) {
       BraggScattererInCrystalStructure_sptr current =
@@ -61,16 +118,41 @@ void StructureFactorCalculatorSummation::updateUnitCellScatterers(
         std::vector<V3D> positions =
             spaceGroup->getEquivalentPositions(current->getPosition());
 
+        EquivalentAtoms atoms;
         for (auto &position : positions) {
           BraggScatterer_sptr clone = current->clone();
           clone->setProperty("Position", getV3DasString(position));
 
+          // The parameters are read back from the clones, as calculating
+          // their structure factors would.
+          auto atom =
+              boost::dynamic_pointer_cast<IsotropicAtomBraggScatterer>(clone);
+          if (atom) {
+            if (atoms.x.empty()) {
+              atoms.amplitude = atom->getOccupancy() *
+                                atom->getNeutronAtom().coh_scatt_length_real;
+              atoms.u = atom->getU();
+              atoms.b = atom->getCell().getB();
+            }
+            const V3D atomPosition = atom->getPosition();
+            atoms.x.push_back(atomPosition.X());
+            atoms.y.push_back(atomPosition.Y());
+            atoms.z.push_back(atomPosition.Z());
+          } else {
+            allIsotropicAtoms = false;
+          }
+
           braggScatterers.push_back(clone);
         }
+        if (!atoms.x.empty())
+          m_equivalentAtoms.push_back(std::move(atoms));
       }
     }
 
     m_unitCellScatterers->setScatterers(braggScatterers);
+    m_useEquivalentAtoms = allIsotropicAtoms;
+    if (!m_useEquivalentAtoms)
+      m_equivalentAtoms.clear();
   }
 }
 
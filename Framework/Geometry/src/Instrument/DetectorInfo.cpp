@@ -371,6 +371,11 @@ void DetectorInfo::setRotation(const std::pair<size_t, size_t> &index,
   m_detectorInfo->setRotation(index, Kernel::toQuaterniond(rotation));
 }
 
+/// Returns a number that changes whenever the position of a detector is set.
+size_t DetectorInfo::positionsVersion() const {
+  return m_detectorInfo->positionsVersion();
+}
+
 /// Return a const reference to the detector with given index.
 const Geometry::IDetector &DetectorInfo::detector(const size_t index) const {
   return getDetector(index);
@@ -829,16 +829,13 @@ component_map_it ParameterMap::positionOf(const IComponent *comp,
   const bool anytype = (strlen(type) == 0);
   if (!m_map.empty()) {
     const ComponentID id = comp->getComponentID();
-    auto it_found = m_map.find(id);
-    if (it_found != m_map.end()) {
-      auto itrs = m_map.equal_range(id);
-      for (auto itr = itrs.first; itr != itrs.second; ++itr) {
-        const auto &param = itr->second;
-        if (strcasecmp(param->nameAsCString(), name) == 0 &&
-            (anytype || param->type() == type)) {
-          result = itr;
-          break;
-        }
+    auto itrs = m_map.equal_range(id);
+    for (auto itr = itrs.first; itr != itrs.second; ++itr) {
+      const auto &param = itr->second;
+      if (strcasecmp(param->nameAsCString(), name) == 0 &&
+          (anytype || param->type() == type)) {
+        result = itr;
+        break;
       }
     }
   }
@@ -861,16 +858,13 @@ component_map_cit ParameterMap::positionOf(const IComponent *comp,
   const bool anytype = (strlen(type) == 0);
   if (!m_map.empty()) {
     const ComponentID id = comp->getComponentID();
-    auto it_found = m_map.find(id);
-    if (it_found != m_map.end()) {
-      auto itrs = m_map.equal_range(id);
-      for (auto itr = itrs.first; itr != itrs.second; ++itr) {
-        const auto &param = itr->second;
-        if (strcasecmp(param->nameAsCString(), name) == 0 &&
-            (anytype || param->type() == type)) {
-          result = itr;
-          break;
-        }
+    auto itrs = m_map.equal_range(id);
+    for (auto itr = itrs.first; itr != itrs.second; ++itr) {
+      const auto &param = itr->second;
+      if (strcasecmp(param->nameAsCString(), name) == 0 &&
+          (anytype || param->type() == type)) {
+        result = itr;
+        break;
       }
     }
   }
@@ -887,8 +881,7 @@ Parameter_sptr ParameterMap::getByType(const IComponent *comp,
   Parameter_sptr result;
   if (!m_map.empty()) {
     const ComponentID id = comp->getComponentID();
-    auto it_found = m_map.find(id);
-    if (it_found != m_map.end() && it_found->first) {
+    if (id) {
       auto itrs = m_map.equal_range(id);
       for (auto itr = itrs.first; itr != itrs.second; ++itr) {
         const auto &param = itr->second;
@@ -896,9 +889,9 @@ Parameter_sptr ParameterMap::getByType(const IComponent *comp,
           result = boost::atomic_load(&param);
           break;
         }
-      } // found->firdst
-    }   // it_found != m_map.end()
-  }     //! m_map.empty()
+      }
+    }
+  } //! m_map.empty()
   return result;
 }
 
@@ -910,13 +903,15 @@ Parameter_sptr ParameterMap::getByType(const IComponent *comp,
  */
 Parameter_sptr ParameterMap::getRecursiveByType(const IComponent *comp,
                                                 const std::string &type) const {
-  boost::shared_ptr<const IComponent> compInFocus(comp, NoDeleting());
-  while (compInFocus != nullptr) {
-    Parameter_sptr param = getByType(compInFocus.get(), type);
+  // Walk the unparametrized components, the map is keyed by their IDs, to
+  // avoid creating a parametrized parent at every level
+  const IComponent *compInFocus = comp->getComponentID();
+  while (compInFocus) {
+    Parameter_sptr param = getByType(compInFocus, type);
     if (param) {
       return param;
     }
-    compInFocus = compInFocus->getParent();
+    compInFocus = compInFocus->getBareParent();
   }
   // Nothing was found!
   return Parameter_sptr();
@@ -948,18 +943,16 @@ Parameter_sptr ParameterMap::getRecursive(const IComponent *comp,
                                           const char *name,
                                           const char *type) const {
   checkIsNotMaskingParameter(name);
-  Parameter_sptr result = this->get(comp->getComponentID(), name, type);
-  if (result)
-    return result;
-
-  auto parent = comp->getParent();
-  while (parent) {
-    result = this->get(parent->getComponentID(), name, type);
-    if (result)
-      return result;
-    parent = parent->getParent();
+  // Walk the unparametrized components, the map is keyed by their IDs, to
+  // avoid creating a parametrized parent at every level
+  const IComponent *compInFocus = comp->getComponentID();
+  while (compInFocus) {
+    auto itr = positionOf(compInFocus, name, type);
+    if (itr != m_map.end())
+      return boost::atomic_load(&itr->second);
+    compInFocus = compInFocus->getBareParent();
   }
-  return result;
+  return Parameter_sptr();
 }
 
 /**
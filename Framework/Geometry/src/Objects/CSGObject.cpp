@@ -1406,6 +1406,18 @@ double CSGObject::triangulatedSolidAngle(const V3D &observer,
     }
   }
 
+  double height = 0.0, radius(0.0), innerRadius;
+  detail::ShapeInfo::GeometryShape type;
+  std::vector<Kernel::V3D> vectors;
+  this->GetObjectGeom(type, vectors, innerRadius, radius, height);
+  // A scaled cuboid is still a cuboid, use the exact method. This is the
+  // usual shape of pixels.
+  if (type == detail::ShapeInfo::GeometryShape::CUBOID) {
+    for (auto &vector : vectors)
+      vector *= scaleFactor;
+    return cuboidSolidAngle(observer, vectors);
+  }
+
   auto nTri = this->numberOfTriangles();
   //
   // If triangulation is not available fall back to ray tracing method, unless
@@ -1413,22 +1425,8 @@ double CSGObject::triangulatedSolidAngle(const V3D &observer,
   // and Cone cases as well.
   //
   if (nTri == 0) {
-    double height = 0.0, radius(0.0), innerRadius;
-    detail::ShapeInfo::GeometryShape type;
-    std::vector<Kernel::V3D> vectors;
-    this->GetObjectGeom(type, vectors, innerRadius, radius, height);
-    switch (type) {
-    case detail::ShapeInfo::GeometryShape::CUBOID:
-      for (auto &vector : vectors)
-        vector *= scaleFactor;
-      return cuboidSolidAngle(observer, vectors);
-      break;
-    case detail::ShapeInfo::GeometryShape::SPHERE:
+    if (type == detail::ShapeInfo::GeometryShape::SPHERE)
       return sphereSolidAngle(observer, vectors, radius);
-      break;
-    default:
-      break;
-    }
 
     //
     // No special case, do the ray trace.
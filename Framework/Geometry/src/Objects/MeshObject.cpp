@@ -7,6 +7,7 @@
 #include "MantidGeometry/Objects/MeshObject.h"
 #include "MantidGeometry/Objects/MeshObjectCommon.h"
 #include "MantidGeometry/Objects/Track.h"
+#include "MantidGeometry/Objects/TriangleBVH.h"
 #include "MantidGeometry/RandomPoint.h"
 #include "MantidGeometry/Rendering/GeometryHandler.h"
 #include "MantidGeometry/Rendering/vtkGeometryCacheReader.h"
@@ -19,6 +20,11 @@
 namespace Mantid {
 namespace Geometry {
 
+namespace {
+/// Meshes with fewer triangles are traced without a bounding volume hierarchy
+const size_t MIN_TRIANGLES_FOR_BVH = 32;
+} // namespace
+
 MeshObject::MeshObject(const std::vector<uint32_t> &faces,
                        const std::vector<Kernel::V3D> &vertices,
                        const Kernel::Material material)
@@ -181,17 +187,47 @@ void MeshObject::getIntersections(
 
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection entryExit;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  const auto testTriangle = [&](const size_t i) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertex1,
                                                 vertex2, vertex3, intersection,
                                                 entryExit)) {
       intersectionPoints.push_back(intersection);
       entryExitFlags.push_back(entryExit);
     }
+  };
+  if (const auto *bvh = getBVH()) {
+    // Only test the triangles in the boxes the ray crosses
+    std::vector<uint32_t> candidates;
+    bvh->candidates(start, direction, candidates);
+    for (const auto i : candidates)
+      testTriangle(i);
+  } else {
+    for (size_t i = 0; i < numberOfTriangles(); ++i)
+      testTriangle(i);
   }
   // still need to deal with edge cases
 }
 
+/**
+ * Get the bounding volume hierarchy of the triangles, building it on first
+ * use. Several threads may build it at the same time: the first one built is
+ * kept.
+ * @returns the hierarchy, NULL for meshes small enough to test every triangle
+ */
+const TriangleBVH *MeshObject::getBVH() const {
+  if (numberOfTriangles() < MIN_TRIANGLES_FOR_BVH)
+    return nullptr;
+  auto bvh = std::atomic_load(&m_bvh);
+  if (!bvh) {
+    std::shared_ptr<const TriangleBVH> built =
+        std::make_shared<TriangleBVH>(m_triangles, m_vertices);
+    if (std::atomic_compare_exchange_strong(&m_bvh, &bvh, built))
+      bvh = std::move(built);
+  }
+  return bvh.get();
+}
+
 /*
  * Get a triangle - useful for iterating over triangles
  * @param index :: Index of triangle in MeshObject
@@ -471,12 +507,14 @@ void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
   for (Kernel::V3D &vertex : m_vertices) {
     vertex.rotate(rotationMatrix);
   }
+  std::atomic_store(&m_bvh, std::shared_ptr<const TriangleBVH>());
 }
 
 void MeshObject::translate(const Kernel::V3D &translationVector) {
   for (Kernel::V3D &vertex : m_vertices) {
     vertex += translationVector;
   }
+  std::atomic_store(&m_bvh, std::shared_ptr<const TriangleBVH>());
 }
 
 /**
@@ -0,0 +1,169 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/TriangleBVH.h"
+#include "MantidKernel/Tolerance.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace Mantid {
+namespace Geometry {
+
+namespace {
+/// Maximum number of triangles in a leaf
+const uint32_t LEAF_SIZE = 4;
+/// Maximum depth of the tree when traversing it, well above that of a
+/// balanced tree of 2^32 triangles
+const size_t MAX_DEPTH = 64;
+} // namespace
+
+/** Build the hierarchy of a mesh
+ * @param triangles :: the vertex indices of the triangles, three per triangle
+ * @param vertices :: the vertices of the mesh
+ */
+TriangleBVH::TriangleBVH(const std::vector<uint32_t> &triangles,
+                         const std::vector<Kernel::V3D> &vertices) {
+  const auto numTriangles = static_cast<uint32_t>(triangles.size() / 3);
+  if (numTriangles == 0)
+    return;
+  m_order.resize(numTriangles);
+  std::iota(m_order.begin(), m_order.end(), 0);
+  std::vector<Kernel::V3D> centres;
+  centres.reserve(numTriangles);
+  for (uint32_t i = 0; i < numTriangles; ++i)
+    centres.emplace_back((vertices[triangles[3 * i]] +
+                          vertices[triangles[3 * i + 1]] +
+                          vertices[triangles[3 * i + 2]]) /
+                         3.);
+  m_nodes.reserve(2 * (numTriangles / LEAF_SIZE + 1));
+  build(0, numTriangles, triangles, vertices, centres);
+}
+
+/** Find the triangles a ray may cross: those in the leaves whose boxes the
+ * ray crosses. Triangles the ray misses may be included.
+ * @param start :: start point of the ray
+ * @param direction :: unit direction of the ray
+ * @param triangles :: the indices of the triangles are appended to it
+ */
+void TriangleBVH::candidates(const Kernel::V3D &start,
+                             const Kernel::V3D &direction,
+                             std::vector<uint32_t> &triangles) const {
+  if (m_nodes.empty())
+    return;
+  const Kernel::V3D inverse(1. / direction.X(), 1. / direction.Y(),
+                            1. / direction.Z());
+  uint32_t stack[MAX_DEPTH];
+  size_t top = 0;
+  stack[top++] = 0;
+  while (top > 0) {
+    const auto index = stack[--top];
+    const auto &node = m_nodes[index];
+    if (!rayHitsBox(node, start, direction, inverse))
+      continue;
+    if (node.count > 0) {
+      triangles.insert(triangles.end(), m_order.begin() + node.index,
+                       m_order.begin() + node.index + node.count);
+    } else {
+      stack[top++] = node.index;
+      stack[top++] = index + 1;
+    }
+  }
+}
+
+/** Build the node of a range of triangles and, recursively, its children
+ * @param first :: first of the triangles in m_order
+ * @param last :: end of the triangles in m_order
+ * @param triangles :: vertex indices of the triangles
+ * @param vertices :: vertices of the mesh
+ * @param centres :: centres of the triangles
+ * @return the index of the node
+ */
+uint32_t TriangleBVH::build(const uint32_t first, const uint32_t last,
+                            const std::vector<uint32_t> &triangles,
+                            const std::vector<Kernel::V3D> &vertices,
+                            const std::vector<Kernel::V3D> &centres) {
+  Node node;
+  double centreMin[3], centreMax[3];
+  for (size_t axis = 0; axis < 3; ++axis) {
+    node.min[axis] = centreMin[axis] = std::numeric_limits<double>::max();
+    node.max[axis] = centreMax[axis] = std::numeric_limits<double>::lowest();
+  }
+  for (auto i = first; i < last; ++i) {
+    const auto triangle = m_order[i];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const double value = vertices[triangles[3 * triangle + corner]][axis];
+        node.min[axis] = std::min(node.min[axis], value);
+        node.max[axis] = std::max(node.max[axis], value);
+      }
+      centreMin[axis] = std::min(centreMin[axis], centres[triangle][axis]);
+      centreMax[axis] = std::max(centreMax[axis], centres[triangle][axis]);
+    }
+  }
+  for (size_t axis = 0; axis < 3; ++axis) {
+    node.min[axis] -= Kernel::Tolerance;
+    node.max[axis] += Kernel::Tolerance;
+  }
+  const auto index = static_cast<uint32_t>(m_nodes.size());
+  if (last - first <= LEAF_SIZE) {
+    node.index = first;
+    node.count = last - first;
+    m_nodes.push_back(node);
+    return index;
+  }
+  node.count = 0;
+  m_nodes.push_back(node);
+
+  // Split at the median centre along the longest axis
+  size_t axis = 0;
+  for (size_t i = 1; i < 3; ++i)
+    if (centreMax[i] - centreMin[i] > centreMax[axis] - centreMin[axis])
+      axis = i;
+  const uint32_t middle = first + (last - first) / 2;
+  std::nth_element(m_order.begin() + first, m_order.begin() + middle,
+                   m_order.begin() + last,
+                   [&centres, axis](const uint32_t a, const uint32_t b) {
+                     return centres[a][axis] < centres[b][axis];
+                   });
+  build(first, middle, triangles, vertices, centres);
+  m_nodes[index].index = build(middle, last, triangles, vertices, centres);
+  return index;
+}
+
+/** Check if a ray crosses the box of a node, with the slab method
+ * @param node :: the node
+ * @param start :: start point of the ray
+ * @param direction :: direction of the ray
+ * @param inverse :: inverse of each component of the direction
+ * @return true if the ray, from slightly behind its start, crosses the box
+ */
+bool TriangleBVH::rayHitsBox(const Node &node, const Kernel::V3D &start,
+                             const Kernel::V3D &direction,
+                             const Kernel::V3D &inverse) {
+  double tMin = -Kernel::Tolerance;
+  double tMax = std::numeric_limits<double>::max();
+  for (size_t axis = 0; axis < 3; ++axis) {
+    if (direction[axis] == 0.) {
+      if (start[axis] < node.min[axis] || start[axis] > node.max[axis])
+        return false;
+      continue;
+    }
+    double t1 = (node.min[axis] - start[axis]) * inverse[axis];
+    double t2 = (node.max[axis] - start[axis]) * inverse[axis];
+    if (t1 > t2)
+      std::swap(t1, t2);
+    tMin = std::max(tMin, t1);
+    tMax = std::min(tMax, t2);
+    if (tMin > tMax)
+      return false;
+  }
+  return true;
+}
+
+} // namespace Geometry
+} // namespace Mantid
@@ -10,6 +10,7 @@
 #include "MantidGeometry/Objects/Rules.h"
 #include "MantidGeometry/Rendering/RenderingMesh.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/V3D.h"
 #include "MantidKernel/WarningSuppressions.h"
 #include <climits>
 
@@ -86,6 +87,7 @@ void GeometryTriangulator::triangulate() {
     m_points = m_meshObj->getVertices();
     m_faces = m_meshObj->getTriangles();
   }
+  m_normals.clear();
   m_isTriangulated = true;
 }
 
@@ -134,6 +136,32 @@ const std::vector<uint32_t> &GeometryTriangulator::getTriangleFaces() {
   return m_faces;
 }
 
+/// get the 3x(NumberOfFaces) unit normals of the faces (n1x,n1y,n1z,n2x..).
+/// They are worked out once, the first time they are requested, so that
+/// every component sharing this shape can be drawn without recomputing them.
+const std::vector<double> &GeometryTriangulator::getTriangleNormals() {
+  checkTriangulated();
+  if (m_normals.size() != 3 * m_nFaces) {
+    m_normals.resize(3 * m_nFaces);
+    for (size_t i = 0; i < m_nFaces; ++i) {
+      const auto index1 = static_cast<size_t>(m_faces[i * 3] * 3);
+      const auto index2 = static_cast<size_t>(m_faces[i * 3 + 1] * 3);
+      const auto index3 = static_cast<size_t>(m_faces[i * 3 + 2] * 3);
+      const Kernel::V3D v1(m_points[index1], m_points[index1 + 1],
+                           m_points[index1 + 2]);
+      const Kernel::V3D v2(m_points[index2], m_points[index2 + 1],
+                           m_points[index2 + 2]);
+      const Kernel::V3D v3(m_points[index3], m_points[index3 + 1],
+                           m_points[index3 + 2]);
+      const auto normal = Kernel::normalize((v1 - v2).cross_prod(v2 - v3));
+      m_normals[i * 3] = normal.X();
+      m_normals[i * 3 + 1] = normal.Y();
+      m_normals[i * 3 + 2] = normal.Z();
+    }
+  }
+  return m_normals;
+}
+
 #ifdef ENABLE_OPENCASCADE
 void GeometryTriangulator::OCAnalyzeObject() {
   if (m_csgObj != nullptr) // If object exists
@@ -247,6 +275,7 @@ void GeometryTriangulator::setGeometryCache(size_t nPoints, size_t nFaces,
   m_nFaces = nFaces;
   m_points = std::move(points);
   m_faces = std::move(faces);
+  m_normals.clear();
   m_isTriangulated = true;
 }
 } // namespace detail
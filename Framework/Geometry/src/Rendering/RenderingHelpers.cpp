@@ -79,17 +79,15 @@ void render(const IObjComponent &ObjComp) {
 void render(detail::GeometryTriangulator &triangulator) {
   const auto &faces = triangulator.getTriangleFaces();
   const auto &points = triangulator.getTriangleVertices();
+  // The normals are cached by the triangulator, which is shared by every
+  // component with this shape
+  const auto &normals = triangulator.getTriangleNormals();
   glBegin(GL_TRIANGLES);
   for (size_t i = 0; i < triangulator.numTriangleFaces(); i++) {
     auto index2 = static_cast<size_t>(faces[i * 3 + 1] * 3);
     auto index3 = static_cast<size_t>(faces[i * 3 + 2] * 3);
     auto index1 = static_cast<size_t>(faces[i * 3] * 3);
-    // Calculate normal and normalize
-    const V3D v1(points[index1], points[index1 + 1], points[index1 + 2]);
-    const V3D v2(points[index2], points[index2 + 1], points[index2 + 2]);
-    const V3D v3(points[index3], points[index3 + 1], points[index3 + 2]);
-    const auto normal = normalize((v1 - v2).cross_prod(v2 - v3));
-    glNormal3d(normal[0], normal[1], normal[2]);
+    glNormal3dv(&normals[i * 3]);
     glVertex3dv(&points[index1]);
     glVertex3dv(&points[index2]);
     glVertex3dv(&points[index3]);
@@ -1013,6 +1013,22 @@ public:
         satol);
   }
 
+  void testSolidAngleCuboid_WithScaleFactor() {
+    // A cube of side 0.5 scaled to a unit cube
+    auto shape = ComponentCreationHelper::createCuboid(0.25);
+    const V3D scaleFactor(2.0, 2.0, 2.0);
+    const double expected = M_PI * 2.0 / 3.0;
+    TS_ASSERT_DELTA(shape->solidAngle(V3D(1.0, 0, 0), scaleFactor), expected,
+                    1e-10);
+    TS_ASSERT_DELTA(shape->solidAngle(V3D(0, 0, -1.0), scaleFactor), expected,
+                    1e-10);
+    // Non-uniform scaling gives the solid angle of the stretched cuboid
+    auto stretched = ComponentCreationHelper::createCuboid(0.5, 0.25, 0.25);
+    const V3D observer(0.3, 0.8, -1.7);
+    TS_ASSERT_DELTA(shape->solidAngle(observer, V3D(2.0, 1.0, 1.0)),
+                    stretched->solidAngle(observer), 1e-10);
+  }
+
   void testExactVolumeCuboid() {
     using namespace Poco::XML;
     const double width = 1.23;
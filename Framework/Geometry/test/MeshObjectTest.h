@@ -23,6 +23,8 @@
 #include <Poco/DOM/AutoPtr.h>
 #include <Poco/DOM/Document.h>
 
+#include <array>
+
 using namespace Mantid;
 using namespace Geometry;
 using Mantid::Kernel::V3D;
@@ -79,6 +81,39 @@ std::unique_ptr<MeshObject> createCube(const double size) {
   return createCube(size, V3D(0.5 * size, 0.5 * size, 0.5 * size));
 }
 
+std::unique_ptr<MeshObject> createSubdividedCube(const double size,
+                                                 const size_t divisions) {
+  /**
+   * Create cube of side length size with vertex at origin, each face split
+   * into divisions x divisions squares of two triangles.
+   */
+  const V3D x(size, 0, 0), y(0, size, 0), z(0, 0, size);
+  // Origin and axes of each face, with u x v pointing out of the cube
+  const std::vector<std::array<V3D, 3>> faces{
+      {{V3D(), z, y}}, {{x, y, z}},     {{V3D(), x, z}},
+      {{y, z, x}},     {{V3D(), y, x}}, {{z, x, y}}};
+  std::vector<V3D> vertices;
+  std::vector<uint32_t> triangles;
+  const double step = 1.0 / static_cast<double>(divisions);
+  for (const auto &face : faces) {
+    for (size_t i = 0; i < divisions; ++i) {
+      for (size_t j = 0; j < divisions; ++j) {
+        const auto first = static_cast<uint32_t>(vertices.size());
+        for (const auto &corner : {std::make_pair(0, 0), std::make_pair(1, 0),
+                                   std::make_pair(1, 1), std::make_pair(0, 1)})
+          vertices.emplace_back(
+              face[0] +
+              face[1] * (step * static_cast<double>(i + corner.first)) +
+              face[2] * (step * static_cast<double>(j + corner.second)));
+        triangles.insert(triangles.end(), {first, first + 1, first + 2});
+        triangles.insert(triangles.end(), {first, first + 2, first + 3});
+      }
+    }
+  }
+  return std::make_unique<MeshObject>(std::move(triangles), std::move(vertices),
+                                      Mantid::Kernel::Material());
+}
+
 std::unique_ptr<MeshObject> createOctahedron() {
   /**
    * Create octahedron with vertices on the axes at -1 & +1.
@@ -326,6 +361,36 @@ public:
     checkTrackIntercept(std::move(geom_obj), track, expectedResults);
   }
 
+  void testInterceptSubdividedCube() {
+    std::vector<Link> expectedResults;
+    // Enough triangles to be traced through a bounding volume hierarchy
+    auto geom_obj = createSubdividedCube(4.0, 10);
+    TS_ASSERT_EQUALS(geom_obj->numberOfTriangles(), 1200);
+    Track track(V3D(-10, 1.3, 1.84), V3D(1, 0, 0));
+
+    // format = startPoint, endPoint, total distance so far
+    expectedResults.emplace_back(
+        Link(V3D(0, 1.3, 1.84), V3D(4, 1.3, 1.84), 14.0, *geom_obj));
+    checkTrackIntercept(std::move(geom_obj), track, expectedResults);
+  }
+
+  void testIsValidSubdividedCube() {
+    auto geom_obj = createSubdividedCube(4.0, 10);
+    TS_ASSERT(geom_obj->isValid(V3D(2.1, 2.3, 2.2)));
+    TS_ASSERT(!geom_obj->isValid(V3D(2.1, 2.3, 4.2)));
+    TS_ASSERT(!geom_obj->isValid(V3D(-0.1, 2.3, 2.2)));
+  }
+
+  void testInterceptSubdividedCubeAfterTranslation() {
+    auto geom_obj = createSubdividedCube(4.0, 10);
+    Track track(V3D(-10, 1.3, 1.84), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(geom_obj->interceptSurface(track), 1);
+    // The triangles are looked up again at their new positions
+    geom_obj->translate(V3D(0, 0, 10));
+    Track missed(V3D(-10, 1.3, 1.84), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(geom_obj->interceptSurface(missed), 0);
+  }
+
   void testInterceptOctahedronX() {
     std::vector<Link> expectedResults;
     auto geom_obj = createOctahedron();
@@ -10,6 +10,7 @@
 #include "MantidBeamline/ComponentInfo.h"
 #include "MantidBeamline/DetectorInfo.h"
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/ParComponentFactory.h"
 #include "MantidGeometry/Instrument/Parameter.h"
 #include "MantidGeometry/Instrument/ParameterFactory.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
@@ -23,6 +24,7 @@
 using Mantid::Geometry::IComponent;
 using Mantid::Geometry::IComponent_sptr;
 using Mantid::Geometry::Instrument_sptr;
+using Mantid::Geometry::ParComponentFactory;
 using Mantid::Geometry::ParameterMap;
 using Mantid::Geometry::ParameterMap_sptr;
 using Mantid::Geometry::Parameter_sptr;
@@ -473,6 +475,24 @@ public:
     TS_ASSERT_EQUALS(fetched->value<int>(), value2);
   }
 
+  void testRecursiveGet_From_Parametrized_Detector() {
+    auto pmap = boost::make_shared<ParameterMap>();
+    pmap->addDouble(m_testInstrument.get(), "Efixed", 3.5);
+    // The detectors are grandchildren of the instrument, within a bank
+    auto bareDet = m_testInstrument->getBaseDetector(1);
+    auto bank = bareDet->getBareParent();
+    pmap->addBool(bank, "bankFlag", true);
+    const auto det = ParComponentFactory::createDetector(bareDet, pmap.get());
+
+    auto fetched = pmap->getRecursive(det.get(), "Efixed");
+    TS_ASSERT(fetched);
+    TS_ASSERT_EQUALS(fetched->value<double>(), 3.5);
+    fetched = pmap->getRecursiveByType(det.get(), ParameterMap::pBool());
+    TS_ASSERT(fetched);
+    TS_ASSERT_EQUALS(fetched->name(), "bankFlag");
+    TS_ASSERT(!pmap->getRecursive(det.get(), "missing"));
+  }
+
   void testClearByName_Only_Removes_Named_Parameter() {
     ParameterMap pmap;
     pmap.addDouble(m_testInstrument.get(), "first", 5.4);
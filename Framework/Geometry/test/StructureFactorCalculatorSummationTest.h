@@ -17,6 +17,16 @@
 using namespace Mantid::Geometry;
 using namespace Mantid::Kernel;
 
+namespace {
+class TestableStructureFactorCalculatorSummation
+    : public StructureFactorCalculatorSummation {
+public:
+  StructureFactor getFOfScatterers(const V3D &hkl) const {
+    return m_unitCellScatterers->calculateStructureFactor(hkl);
+  }
+};
+} // namespace
+
 class StructureFactorCalculatorSummationTest : public CxxTest::TestSuite {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -64,6 +74,41 @@ public:
     TS_ASSERT_LESS_THAN(calculator->getFSquared(V3D(2, 2, 2)), 1e-9);
   }
 
+  void testSummedAtomsMatchScatterers() {
+    CompositeBraggScatterer_sptr scatterers = CompositeBraggScatterer::create();
+    scatterers->addScatterer(BraggScattererFactory::Instance().createScatterer(
+        "IsotropicAtomBraggScatterer",
+        R"({"Element":"Si","Position":"0,0,0","U":"0.05"})"));
+    scatterers->addScatterer(BraggScattererFactory::Instance().createScatterer(
+        "IsotropicAtomBraggScatterer",
+        R"({"Element":"O","Position":"0.1,0.2,0.3","U":"0.01",)"
+        R"("Occupancy":"0.5"})"));
+    CrystalStructure structure(
+        UnitCell(5.43, 6.2, 7.1, 90, 105, 90),
+        SpaceGroupFactory::Instance().createSpaceGroup("P 1 21/c 1"),
+        scatterers);
+
+    TestableStructureFactorCalculatorSummation calculator;
+    calculator.setCrystalStructure(structure);
+
+    std::vector<V3D> hkls;
+    for (int h = -3; h <= 3; ++h)
+      for (int k = 0; k <= 3; ++k)
+        for (int l = 1; l <= 3; ++l)
+          hkls.emplace_back(h, k, l);
+
+    const auto fs = calculator.getFs(hkls);
+    const auto fSquareds = calculator.getFsSquared(hkls);
+    for (size_t i = 0; i < hkls.size(); ++i) {
+      const StructureFactor expected = calculator.getFOfScatterers(hkls[i]);
+      const StructureFactor f = calculator.getF(hkls[i]);
+      TS_ASSERT_DELTA(f.real(), expected.real(), 1e-12);
+      TS_ASSERT_DELTA(f.imag(), expected.imag(), 1e-12);
+      TS_ASSERT_EQUALS(fs[i], f);
+      TS_ASSERT_EQUALS(fSquareds[i], calculator.getFSquared(hkls[i]));
+    }
+  }
+
 private:
   CrystalStructure getCrystalStructure() {
     CompositeBraggScatterer_sptr scatterers = CompositeBraggScatterer::create();
@@ -0,0 +1,120 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_GEOMETRY_TRIANGLEBVHTEST_H_
+#define MANTID_GEOMETRY_TRIANGLEBVHTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/Objects/MeshObjectCommon.h"
+#include "MantidGeometry/Objects/TriangleBVH.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+namespace {
+/// Small triangles scattered in a 10x10x10 box
+void createTriangleSoup(const size_t numTriangles,
+                        std::vector<uint32_t> &triangles,
+                        std::vector<V3D> &vertices) {
+  std::mt19937 generator(2019);
+  std::uniform_real_distribution<double> position(-5., 5.);
+  std::uniform_real_distribution<double> offset(-0.3, 0.3);
+  for (size_t i = 0; i < numTriangles; ++i) {
+    const V3D centre(position(generator), position(generator),
+                     position(generator));
+    for (uint32_t corner = 0; corner < 3; ++corner) {
+      triangles.push_back(static_cast<uint32_t>(vertices.size()));
+      vertices.emplace_back(centre + V3D(offset(generator), offset(generator),
+                                         offset(generator)));
+    }
+  }
+}
+
+/// Random rays starting outside and inside the soup
+std::vector<std::pair<V3D, V3D>> createRays(const size_t numRays) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> position(-8., 8.);
+  std::normal_distribution<double> direction;
+  std::vector<std::pair<V3D, V3D>> rays;
+  for (size_t i = 0; i < numRays; ++i) {
+    V3D dir(direction(generator), direction(generator), direction(generator));
+    dir.normalize();
+    rays.emplace_back(V3D(position(generator), position(generator),
+                          position(generator)),
+                      dir);
+  }
+  // Rays along the axes, with zero components in their directions
+  rays.emplace_back(V3D(-10., 0.1, 0.2), V3D(1., 0., 0.));
+  rays.emplace_back(V3D(0.3, -10., -0.4), V3D(0., 1., 0.));
+  rays.emplace_back(V3D(1.5, 2.5, 10.), V3D(0., 0., -1.));
+  return rays;
+}
+} // namespace
+
+class TriangleBVHTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static TriangleBVHTest *createSuite() { return new TriangleBVHTest(); }
+  static void destroySuite(TriangleBVHTest *suite) { delete suite; }
+
+  void test_empty_mesh_has_no_candidates() {
+    TriangleBVH bvh({}, {});
+    TS_ASSERT_EQUALS(bvh.numberOfNodes(), 0);
+    std::vector<uint32_t> candidates;
+    bvh.candidates(V3D(0, 0, 0), V3D(1, 0, 0), candidates);
+    TS_ASSERT(candidates.empty());
+  }
+
+  void test_small_mesh_is_a_single_leaf() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    createTriangleSoup(3, triangles, vertices);
+    TriangleBVH bvh(triangles, vertices);
+    TS_ASSERT_EQUALS(bvh.numberOfNodes(), 1);
+  }
+
+  void test_candidates_include_every_triangle_hit() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    const size_t numTriangles = 5000;
+    createTriangleSoup(numTriangles, triangles, vertices);
+    TriangleBVH bvh(triangles, vertices);
+    TS_ASSERT_LESS_THAN(1, bvh.numberOfNodes());
+
+    size_t totalCandidates = 0;
+    size_t totalHits = 0;
+    for (const auto &ray : createRays(200)) {
+      std::vector<uint32_t> candidates;
+      bvh.candidates(ray.first, ray.second, candidates);
+      std::sort(candidates.begin(), candidates.end());
+      TS_ASSERT(std::adjacent_find(candidates.begin(), candidates.end()) ==
+                candidates.end());
+      totalCandidates += candidates.size();
+      for (uint32_t i = 0; i < numTriangles; ++i) {
+        V3D intersection;
+        TrackDirection entryExit;
+        if (MeshObjectCommon::rayIntersectsTriangle(
+                ray.first, ray.second, vertices[triangles[3 * i]],
+                vertices[triangles[3 * i + 1]], vertices[triangles[3 * i + 2]],
+                intersection, entryExit)) {
+          ++totalHits;
+          TS_ASSERT(
+              std::binary_search(candidates.begin(), candidates.end(), i));
+        }
+      }
+    }
+    TS_ASSERT_LESS_THAN(0, totalHits);
+    // Only a small fraction of the triangles are tested
+    TS_ASSERT_LESS_THAN(totalCandidates, 200 * numTriangles / 10);
+  }
+};
+
+#endif /* MANTID_GEOMETRY_TRIANGLEBVHTEST_H_ */
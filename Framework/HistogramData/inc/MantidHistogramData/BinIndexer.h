@@ -0,0 +1,66 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_HISTOGRAMDATA_BININDEXER_H_
+#define MANTID_HISTOGRAMDATA_BININDEXER_H_
+
+#include "MantidHistogramData/DllConfig.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace Mantid {
+namespace HistogramData {
+
+/** BinIndexer : finds the bin containing a value for a fixed set of bin edges.
+
+  For linear and logarithmic bin edges the index is computed in closed form
+  and then corrected against the actual edges, so the result is always exactly
+  what a binary search over the edges would give. A final bin that is shorter
+  than the others, as produced by Rebin parameters that do not divide the
+  range exactly, is supported. Arbitrary bin edges fall back to a binary
+  search.
+
+  Bins are half-open, [x_i, x_{i+1}), including the last one, which matches
+  the convention of EventList::generateHistogram.
+
+  The indexer keeps a reference to the edges, which must outlive it and must
+  not be modified while it is in use.
+*/
+class MANTID_HISTOGRAMDATA_DLL BinIndexer {
+public:
+  /// How the bin edges are spaced
+  enum class Spacing { Linear, Logarithmic, Arbitrary };
+
+  explicit BinIndexer(const std::vector<double> &binEdges);
+
+  /// The detected spacing of the bin edges
+  Spacing spacing() const { return m_spacing; }
+  /// Number of bins, also the value returned for out-of-range values
+  size_t numberOfBins() const { return m_numBins; }
+
+  size_t index(const double x) const;
+  void indices(const double *x, const size_t count, size_t *out) const;
+
+private:
+  size_t correct(const double x, size_t guess) const;
+
+  /// The bin edges
+  const std::vector<double> &m_edges;
+  /// Number of bins
+  size_t m_numBins;
+  /// Detected spacing
+  Spacing m_spacing;
+  /// First edge, or log of the first edge for logarithmic spacing
+  double m_origin;
+  /// Inverse of the step, or of the log of the ratio for logarithmic spacing
+  double m_inverseStep;
+};
+
+} // namespace HistogramData
+} // namespace Mantid
+
+#endif /* MANTID_HISTOGRAMDATA_BININDEXER_H_ */
@@ -7,14 +7,46 @@
 #ifndef MANTID_HISTOGRAMDATA_HISTOGRAMREBIN_H_
 #define MANTID_HISTOGRAMDATA_HISTOGRAMREBIN_H_
 
+#include "MantidHistogramData/BinEdges.h"
 #include "MantidHistogramData/DllConfig.h"
+
+#include <vector>
+
 namespace Mantid {
 namespace HistogramData {
 class Histogram;
-class BinEdges;
 
 MANTID_HISTOGRAMDATA_DLL Histogram rebin(const Histogram &input,
                                          const BinEdges &binEdges);
+
+/** Rebinner : rebins histograms sharing the same input bin edges onto a new
+  set of bin edges. The overlaps of the input and output bins, a banded
+  matrix of weights, are found once at construction. Rebinning each histogram
+  then only applies them, giving the same result as rebin().
+ */
+class MANTID_HISTOGRAMDATA_DLL Rebinner {
+public:
+  Rebinner(const BinEdges &inputBinEdges, const BinEdges &binEdges);
+  Histogram rebin(const Histogram &input) const;
+
+  /// Overlap of an input bin with an output bin
+  struct Overlap {
+    size_t iold;
+    size_t inew;
+    /// Width of the overlap
+    double delta;
+    /// Width of the input bin
+    double owidth;
+  };
+
+private:
+  Histogram rebinCounts(const Histogram &input) const;
+  Histogram rebinFrequencies(const Histogram &input) const;
+
+  BinEdges m_inputBinEdges;
+  BinEdges m_binEdges;
+  std::vector<Overlap> m_overlaps;
+};
 } // namespace HistogramData
 } // namespace Mantid
 
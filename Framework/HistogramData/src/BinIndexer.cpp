@@ -0,0 +1,151 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidHistogramData/BinIndexer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Mantid {
+namespace HistogramData {
+
+namespace {
+/// Relative tolerance, in units of the step, used to detect regular spacing
+constexpr double SPACING_TOLERANCE = 1e-6;
+
+/** Check whether values follow origin + i * step. The last value may be
+ * smaller than predicted, to allow for a truncated final bin.
+ * @param values :: the values to check, at least two
+ * @param transform :: function applied to each value before checking
+ * @return true if the spacing is regular
+ */
+template <class Transform>
+bool isRegular(const std::vector<double> &values, Transform transform) {
+  const double origin = transform(values[0]);
+  const double step = transform(values[1]) - origin;
+  if (!(step > 0.) || !std::isfinite(step))
+    return false;
+  const double tolerance = SPACING_TOLERANCE * step;
+  const size_t last = values.size() - 1;
+  for (size_t i = 2; i < last; ++i) {
+    const double expected = origin + static_cast<double>(i) * step;
+    if (std::abs(transform(values[i]) - expected) > tolerance)
+      return false;
+  }
+  const double lastValue = transform(values[last]);
+  return lastValue > transform(values[last - 1]) &&
+         lastValue <= origin + static_cast<double>(last) * step + tolerance;
+}
+
+double identity(const double x) { return x; }
+double logarithm(const double x) { return std::log(x); }
+} // namespace
+
+/** Constructor. Detects the spacing of the bin edges.
+ * @param binEdges :: the bin edges, sorted in ascending order
+ */
+BinIndexer::BinIndexer(const std::vector<double> &binEdges)
+    : m_edges(binEdges), m_numBins(binEdges.size() > 1 ? binEdges.size() - 1
+                                                       : 0),
+      m_spacing(Spacing::Arbitrary), m_origin(0.), m_inverseStep(0.) {
+  if (m_numBins == 0)
+    return;
+  if (isRegular(binEdges, identity)) {
+    m_spacing = Spacing::Linear;
+    m_origin = binEdges[0];
+    m_inverseStep = 1. / (binEdges[1] - binEdges[0]);
+  } else if (binEdges[0] > 0. && isRegular(binEdges, logarithm)) {
+    m_spacing = Spacing::Logarithmic;
+    m_origin = std::log(binEdges[0]);
+    m_inverseStep = 1. / (std::log(binEdges[1]) - m_origin);
+  }
+}
+
+/** Return the index of the bin containing x
+ * @param x :: the value to look up
+ * @return the bin index, or numberOfBins() if x is outside the edges
+ */
+size_t BinIndexer::index(const double x) const {
+  if (m_numBins == 0 || !(x >= m_edges.front() && x < m_edges.back()))
+    return m_numBins;
+  switch (m_spacing) {
+  case Spacing::Linear:
+    return correct(x, static_cast<size_t>((x - m_origin) * m_inverseStep));
+  case Spacing::Logarithmic:
+    return correct(x,
+                   static_cast<size_t>((std::log(x) - m_origin) * m_inverseStep));
+  case Spacing::Arbitrary:
+  default:
+    return static_cast<size_t>(
+        std::distance(m_edges.begin(),
+                      std::upper_bound(m_edges.begin(), m_edges.end(), x)) -
+        1);
+  }
+}
+
+/** Return the bin indices of many values at once. The closed-form estimates
+ * are computed in blocks, in a loop free of branches so that the compiler can
+ * vectorize it, and are then corrected against the edges.
+ * @param x :: pointer to the values to look up
+ * @param count :: number of values
+ * @param out :: pointer to storage for count indices. Values outside the edges
+ * are given the index numberOfBins().
+ */
+void BinIndexer::indices(const double *x, const size_t count,
+                         size_t *out) const {
+  if (m_spacing == Spacing::Arbitrary || m_numBins == 0) {
+    for (size_t i = 0; i < count; ++i)
+      out[i] = index(x[i]);
+    return;
+  }
+
+  constexpr size_t blockSize = 256;
+  double estimate[blockSize];
+  const double xMin = m_edges.front();
+  const double xMax = m_edges.back();
+  const double maxEstimate = static_cast<double>(m_numBins - 1);
+  const bool logarithmic = m_spacing == Spacing::Logarithmic;
+  for (size_t start = 0; start < count; start += blockSize) {
+    const size_t n = std::min(blockSize, count - start);
+    const double *values = x + start;
+    if (logarithmic) {
+      for (size_t i = 0; i < n; ++i) {
+        const double clamped = std::min(std::max(values[i], xMin), xMax);
+        estimate[i] = (std::log(clamped) - m_origin) * m_inverseStep;
+      }
+    } else {
+      for (size_t i = 0; i < n; ++i)
+        estimate[i] = (values[i] - m_origin) * m_inverseStep;
+    }
+    for (size_t i = 0; i < n; ++i)
+      estimate[i] = std::min(std::max(estimate[i], 0.), maxEstimate);
+    for (size_t i = 0; i < n; ++i) {
+      const double value = values[i];
+      if (value >= xMin && value < xMax)
+        out[start + i] = correct(value, static_cast<size_t>(estimate[i]));
+      else
+        out[start + i] = m_numBins;
+    }
+  }
+}
+
+/** Move a closed-form estimate of the bin index to the exact bin. For regular
+ * edges this takes at most a step or two to account for rounding.
+ * @param x :: value inside the range of the edges
+ * @param guess :: estimated bin index
+ * @return the index of the bin containing x
+ */
+size_t BinIndexer::correct(const double x, size_t guess) const {
+  guess = std::min(guess, m_numBins - 1);
+  while (guess > 0 && x < m_edges[guess])
+    --guess;
+  while (guess + 1 < m_numBins && x >= m_edges[guess + 1])
+    ++guess;
+  return guess;
+}
+
+} // namespace HistogramData
+} // namespace Mantid
@@ -19,21 +19,24 @@ using Mantid::HistogramData::Exception::InvalidBinEdgesError;
 using Mantid::HistogramData::Frequencies;
 using Mantid::HistogramData::FrequencyStandardDeviations;
 using Mantid::HistogramData::Histogram;
+using Mantid::HistogramData::HistogramE;
+using Mantid::HistogramData::HistogramY;
 
 namespace {
-Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
-  auto &xold = input.x();
-  auto &yold = input.y();
-  auto &eold = input.e();
-
-  auto &xnew = binEdges.rawData();
-  Counts newCounts(xnew.size() - 1);
-  CountVariances newCountVariances(xnew.size() - 1);
-  auto &ynew = newCounts.mutableData();
-  auto &enew = newCountVariances.mutableData();
-
-  auto size_yold = yold.size();
-  auto size_ynew = ynew.size();
+/** Walk through the overlapping bins of two sets of bin edges.
+ * @param xold :: input bin edges
+ * @param yoldSize :: number of input bins to look at
+ * @param xnew :: output bin edges
+ * @param addOverlap :: called with the indexes of the input and output bins,
+ * the width of their overlap and the width of the input bin, for every
+ * overlap in turn
+ * @throws InvalidBinEdgesError for non-positive bin widths
+ */
+template <class AddOverlap>
+void forEachOverlap(const std::vector<double> &xold, const size_t yoldSize,
+                    const std::vector<double> &xnew, AddOverlap &&addOverlap) {
+  auto size_yold = yoldSize;
+  auto size_ynew = xnew.size() - 1;
   size_t iold = 0;
   size_t inew = 0;
 
@@ -66,8 +69,7 @@ Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
       auto delta = xo_high < xn_high ? xo_high : xn_high;
       delta -= xo_low > xn_low ? xo_low : xn_low;
 
-      ynew[inew] += yold[iold] * delta / owidth;
-      enew[inew] += eold[iold] * eold[iold] * delta / owidth;
+      addOverlap(iold, inew, delta, owidth);
 
       if (xn_high > xo_high) {
         iold++;
@@ -76,13 +78,41 @@ Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
       }
     }
   }
+}
+
+Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
+  auto &yold = input.y();
+  auto &eold = input.e();
+
+  auto &xnew = binEdges.rawData();
+  Counts newCounts(xnew.size() - 1);
+  CountVariances newCountVariances(xnew.size() - 1);
+  auto &ynew = newCounts.mutableData();
+  auto &enew = newCountVariances.mutableData();
+
+  forEachOverlap(input.x().rawData(), yold.size(), xnew,
+                 [&](const size_t iold, const size_t inew, const double delta,
+                     const double owidth) {
+                   ynew[inew] += yold[iold] * delta / owidth;
+                   enew[inew] += eold[iold] * eold[iold] * delta / owidth;
+                 });
 
   return Histogram(binEdges, newCounts,
                    CountStandardDeviations(std::move(newCountVariances)));
 }
 
+/// Divide summed frequencies and variances by the widths of the new bins
+void scaleFrequencies(const std::vector<double> &xnew, HistogramY &ynew,
+                      HistogramE &enew) {
+  for (size_t i = 0; i < ynew.size(); ++i) {
+    auto width = xnew[i + 1] - xnew[i];
+    auto factor = 1 / width;
+    ynew[i] *= factor;
+    enew[i] = sqrt(enew[i]) * factor;
+  }
+}
+
 Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
-  auto &xold = input.x();
   auto &yold = input.y();
   auto &eold = input.e();
 
@@ -92,49 +122,13 @@ Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
   auto &ynew = newFrequencies.mutableData();
   auto &enew = newFrequencyStdDev.mutableData();
 
-  auto size_yold = yold.size();
-  auto size_ynew = ynew.size();
-  size_t iold = 0;
-  size_t inew = 0;
-
-  while ((inew < size_ynew) && (iold < size_yold)) {
-    auto xo_low = xold[iold];
-    auto xo_high = xold[iold + 1];
-    auto xn_low = xnew[inew];
-    auto xn_high = xnew[inew + 1];
-
-    auto owidth = xo_high - xo_low;
-    auto nwidth = xn_high - xn_low;
-
-    if (owidth <= 0.0 || nwidth <= 0.0)
-      throw InvalidBinEdgesError("Negative or zero bin widths not allowed.");
-
-    if (xn_high <= xo_low)
-      inew++; /* old and new bins do not overlap */
-    else if (xo_high <= xn_low)
-      iold++; /* old and new bins do not overlap */
-    else {
-      //        delta is the overlap of the bins on the x axis
-      auto delta = xo_high < xn_high ? xo_high : xn_high;
-      delta -= xo_low > xn_low ? xo_low : xn_low;
-
-      ynew[inew] += yold[iold] * delta;
-      enew[inew] += eold[iold] * eold[iold] * delta * owidth;
-
-      if (xn_high > xo_high) {
-        iold++;
-      } else {
-        inew++;
-      }
-    }
-  }
-
-  for (size_t i = 0; i < size_ynew; ++i) {
-    auto width = xnew[i + 1] - xnew[i];
-    auto factor = 1 / width;
-    ynew[i] *= factor;
-    enew[i] = sqrt(enew[i]) * factor;
-  }
+  forEachOverlap(input.x().rawData(), yold.size(), xnew,
+                 [&](const size_t iold, const size_t inew, const double delta,
+                     const double owidth) {
+                   ynew[inew] += yold[iold] * delta;
+                   enew[inew] += eold[iold] * eold[iold] * delta * owidth;
+                 });
+  scaleFrequencies(xnew, ynew, enew);
 
   return Histogram(binEdges, newFrequencies, newFrequencyStdDev);
 }
@@ -162,5 +156,85 @@ Histogram rebin(const Histogram &input, const BinEdges &binEdges) {
     throw std::runtime_error("YMode must be defined for input histogram.");
 }
 
+/** Find the overlaps of the bins of two sets of bin edges.
+ * @param inputBinEdges :: bin edges of the histograms to rebin
+ * @param binEdges :: the histograms will be rebinned onto these bin edges.
+ * @throws InvalidBinEdgesError for non-positive input/output bin widths
+ */
+Rebinner::Rebinner(const BinEdges &inputBinEdges, const BinEdges &binEdges)
+    : m_inputBinEdges(inputBinEdges), m_binEdges(binEdges) {
+  const auto &xold = inputBinEdges.rawData();
+  if (xold.size() < 2 || binEdges.size() < 2)
+    return;
+  m_overlaps.reserve(xold.size() + binEdges.size());
+  forEachOverlap(xold, xold.size() - 1, binEdges.rawData(),
+                 [this](const size_t iold, const size_t inew,
+                        const double delta, const double owidth) {
+                   m_overlaps.push_back({iold, inew, delta, owidth});
+                 });
+}
+
+/** Rebins a histogram, as rebin() would.
+ * @param input :: input histogram, with the input bin edges of the Rebinner.
+ * @returns The rebinned histogram.
+ * @throws std::runtime_error if the input histogram xmode is not BinEdges,
+ * the input yMode is undefined, or the input has different bin edges.
+ */
+Histogram Rebinner::rebin(const Histogram &input) const {
+  if (input.xMode() != Histogram::XMode::BinEdges)
+    throw std::runtime_error(
+        "XMode must be Histogram::XMode::BinEdges for input histogram");
+  if (input.sharedX() != m_inputBinEdges.cowData() &&
+      input.x().rawData() != m_inputBinEdges.rawData())
+    throw std::runtime_error("Rebinner: input histogram has different "
+                             "bin edges.");
+  if (input.yMode() == Histogram::YMode::Counts)
+    return rebinCounts(input);
+  else if (input.yMode() == Histogram::YMode::Frequencies)
+    return rebinFrequencies(input);
+  else
+    throw std::runtime_error("YMode must be defined for input histogram.");
+}
+
+Histogram Rebinner::rebinCounts(const Histogram &input) const {
+  auto &yold = input.y();
+  auto &eold = input.e();
+
+  const size_t size = m_binEdges.size() < 2 ? 0 : m_binEdges.size() - 1;
+  Counts newCounts(size);
+  CountVariances newCountVariances(size);
+  auto &ynew = newCounts.mutableData();
+  auto &enew = newCountVariances.mutableData();
+
+  for (const auto &overlap : m_overlaps) {
+    ynew[overlap.inew] += yold[overlap.iold] * overlap.delta / overlap.owidth;
+    enew[overlap.inew] += eold[overlap.iold] * eold[overlap.iold] *
+                          overlap.delta / overlap.owidth;
+  }
+
+  return Histogram(m_binEdges, newCounts,
+                   CountStandardDeviations(std::move(newCountVariances)));
+}
+
+Histogram Rebinner::rebinFrequencies(const Histogram &input) const {
+  auto &yold = input.y();
+  auto &eold = input.e();
+
+  const size_t size = m_binEdges.size() < 2 ? 0 : m_binEdges.size() - 1;
+  Frequencies newFrequencies(size);
+  FrequencyStandardDeviations newFrequencyStdDev(size);
+  auto &ynew = newFrequencies.mutableData();
+  auto &enew = newFrequencyStdDev.mutableData();
+
+  for (const auto &overlap : m_overlaps) {
+    ynew[overlap.inew] += yold[overlap.iold] * overlap.delta;
+    enew[overlap.inew] += eold[overlap.iold] * eold[overlap.iold] *
+                          overlap.delta * overlap.owidth;
+  }
+  scaleFrequencies(m_binEdges.rawData(), ynew, enew);
+
+  return Histogram(m_binEdges, newFrequencies, newFrequencyStdDev);
+}
+
 } // namespace HistogramData
 } // namespace Mantid
@@ -21,22 +21,25 @@ Histogram slice(const Histogram &histogram, const size_t begin,
   auto sliced(histogram);
   if (begin == 0 && end == histogram.size())
     return sliced;
-  sliced.resize(end - begin);
-  if (end - begin == 0)
+  if (end - begin == 0) {
+    sliced.resize(0);
     return sliced;
+  }
 
+  // The sliced data are copied straight into new arrays, the data shared with
+  // histogram are not copied in full first.
   auto xEnd = histogram.xMode() == Histogram::XMode::Points ? end : end + 1;
-  sliced.mutableX().assign(histogram.x().begin() + begin,
-                           histogram.x().begin() + xEnd);
+  sliced.setX(Kernel::make_cow<HistogramX>(histogram.x().begin() + begin,
+                                           histogram.x().begin() + xEnd));
   if (sliced.sharedY())
-    sliced.mutableY().assign(histogram.y().begin() + begin,
-                             histogram.y().begin() + end);
+    sliced.setSharedY(Kernel::make_cow<HistogramY>(
+        histogram.y().begin() + begin, histogram.y().begin() + end));
   if (sliced.sharedE())
-    sliced.mutableE().assign(histogram.e().begin() + begin,
-                             histogram.e().begin() + end);
+    sliced.setSharedE(Kernel::make_cow<HistogramE>(
+        histogram.e().begin() + begin, histogram.e().begin() + end));
   if (sliced.sharedDx())
-    sliced.mutableDx().assign(histogram.dx().begin() + begin,
-                              histogram.dx().begin() + end);
+    sliced.setSharedDx(Kernel::make_cow<HistogramDx>(
+        histogram.dx().begin() + begin, histogram.dx().begin() + end));
   return sliced;
 }
 
@@ -0,0 +1,114 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_HISTOGRAMDATA_BININDEXERTEST_H_
+#define MANTID_HISTOGRAMDATA_BININDEXERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidHistogramData/BinIndexer.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Mantid::HistogramData;
+
+class BinIndexerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BinIndexerTest *createSuite() { return new BinIndexerTest(); }
+  static void destroySuite(BinIndexerTest *suite) { delete suite; }
+
+  void test_empty_edges() {
+    const std::vector<double> edges;
+    BinIndexer indexer(edges);
+    TS_ASSERT_EQUALS(indexer.numberOfBins(), 0);
+    TS_ASSERT_EQUALS(indexer.index(1.), 0);
+  }
+
+  void test_spacing_detection() {
+    const std::vector<double> linear{0., 1., 2., 3.};
+    TS_ASSERT(BinIndexer(linear).spacing() == BinIndexer::Spacing::Linear);
+    const std::vector<double> truncated{0., 3., 6., 9., 10.};
+    TS_ASSERT(BinIndexer(truncated).spacing() == BinIndexer::Spacing::Linear);
+    const std::vector<double> logarithmic{1., 2., 4., 8., 16.};
+    TS_ASSERT(BinIndexer(logarithmic).spacing() ==
+              BinIndexer::Spacing::Logarithmic);
+    const std::vector<double> arbitrary{0., 1., 3., 4.};
+    TS_ASSERT(BinIndexer(arbitrary).spacing() ==
+              BinIndexer::Spacing::Arbitrary);
+  }
+
+  void test_linear_index() {
+    const std::vector<double> edges{0., 3., 6., 9., 10.};
+    BinIndexer indexer(edges);
+    TS_ASSERT_EQUALS(indexer.index(-0.1), 4);
+    TS_ASSERT_EQUALS(indexer.index(0.), 0);
+    TS_ASSERT_EQUALS(indexer.index(2.999), 0);
+    TS_ASSERT_EQUALS(indexer.index(3.), 1);
+    TS_ASSERT_EQUALS(indexer.index(9.5), 3);
+    TS_ASSERT_EQUALS(indexer.index(10.), 4);
+    TS_ASSERT_EQUALS(indexer.index(std::nan("")), 4);
+  }
+
+  void test_logarithmic_index() {
+    const std::vector<double> edges{1., 2., 4., 8., 16.};
+    BinIndexer indexer(edges);
+    TS_ASSERT_EQUALS(indexer.index(0.5), 4);
+    TS_ASSERT_EQUALS(indexer.index(1.), 0);
+    TS_ASSERT_EQUALS(indexer.index(2.), 1);
+    TS_ASSERT_EQUALS(indexer.index(7.9), 2);
+    TS_ASSERT_EQUALS(indexer.index(15.9), 3);
+    TS_ASSERT_EQUALS(indexer.index(16.), 4);
+  }
+
+  void test_arbitrary_index() {
+    const std::vector<double> edges{0., 1., 3., 4.};
+    BinIndexer indexer(edges);
+    TS_ASSERT_EQUALS(indexer.index(0.5), 0);
+    TS_ASSERT_EQUALS(indexer.index(1.), 1);
+    TS_ASSERT_EQUALS(indexer.index(3.5), 2);
+    TS_ASSERT_EQUALS(indexer.index(4.), 3);
+  }
+
+  void test_matches_binary_search_for_rounded_edges() {
+    // Edges generated by accumulation are not exactly origin + i * step
+    std::vector<double> edges{0.};
+    for (size_t i = 0; i < 1000; ++i)
+      edges.push_back(edges.back() + 0.1);
+    BinIndexer indexer(edges);
+    TS_ASSERT(indexer.spacing() == BinIndexer::Spacing::Linear);
+    for (const auto edge : edges) {
+      for (const double x : {edge, std::nextafter(edge, 0.)})
+        TS_ASSERT_EQUALS(indexer.index(x), binarySearch(edges, x));
+    }
+  }
+
+  void test_batched_indices_match_single() {
+    std::vector<double> edges{100.};
+    for (size_t i = 0; i < 50; ++i)
+      edges.push_back(edges.back() * 1.01);
+    BinIndexer indexer(edges);
+    std::vector<double> values;
+    for (size_t i = 0; i < 1000; ++i)
+      values.push_back(99. + 0.07 * static_cast<double>(i));
+    std::vector<size_t> out(values.size());
+    indexer.indices(values.data(), values.size(), out.data());
+    for (size_t i = 0; i < values.size(); ++i)
+      TS_ASSERT_EQUALS(out[i], binarySearch(edges, values[i]));
+  }
+
+private:
+  size_t binarySearch(const std::vector<double> &edges, const double x) {
+    if (!(x >= edges.front() && x < edges.back()))
+      return edges.size() - 1;
+    return static_cast<size_t>(
+        std::upper_bound(edges.begin(), edges.end(), x) - edges.begin() - 1);
+  }
+};
+
+#endif /* MANTID_HISTOGRAMDATA_BININDEXERTEST_H_ */
@@ -389,6 +389,34 @@ public:
     TS_ASSERT_EQUALS(outFreq.e()[2], 0);
   }
 
+  void testRebinnerMatchesRebin() {
+    const BinEdges edges{0.25, 1.5, 1.75, 4, 8.5, 12};
+    for (const auto &hist : {getCountsHistogram(), getFrequencyHistogram()}) {
+      const Rebinner rebinner(hist.binEdges(), edges);
+      const auto expected = rebin(hist, edges);
+      const auto out = rebinner.rebin(hist);
+      TS_ASSERT_EQUALS(out.yMode(), expected.yMode());
+      TS_ASSERT_EQUALS(out.x().rawData(), expected.x().rawData());
+      TS_ASSERT_EQUALS(out.y().rawData(), expected.y().rawData());
+      TS_ASSERT_EQUALS(out.e().rawData(), expected.e().rawData());
+      // The output bin edges are shared
+      TS_ASSERT_EQUALS(out.sharedX(), edges.cowData());
+    }
+  }
+
+  void testRebinnerFailsForInvalidBinEdges() {
+    const auto hist = getCountsHistogram();
+    TS_ASSERT_THROWS(Rebinner(hist.binEdges(), BinEdges{1, 2, 2, 3}),
+                     const InvalidBinEdgesError &);
+  }
+
+  void testRebinnerFailsForOtherInputBinEdges() {
+    const Rebinner rebinner(getCountsHistogram().binEdges(),
+                            BinEdges{0, 2, 4});
+    Histogram other(BinEdges(10, LinearGenerator(1, 1)), Counts(9, 1.0));
+    TS_ASSERT_THROWS(rebinner.rebin(other), const std::runtime_error &);
+  }
+
 private:
   Histogram getCountsHistogram() {
     return Histogram(BinEdges(10, LinearGenerator(0, 1)),
@@ -444,6 +472,12 @@ public:
       rebin(histFreq, lgBins);
   }
 
+  void testRebinnerCountsSmallerBins() {
+    const Rebinner rebinner(hist.binEdges(), smBins);
+    for (size_t i = 0; i < nIters; i++)
+      rebinner.rebin(hist);
+  }
+
 private:
   const size_t binSize = 10000;
   const size_t nIters = 10000;
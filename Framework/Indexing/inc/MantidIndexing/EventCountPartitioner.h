@@ -0,0 +1,46 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_INDEXING_EVENTCOUNTPARTITIONER_H_
+#define MANTID_INDEXING_EVENTCOUNTPARTITIONER_H_
+
+#include "MantidIndexing/DllConfig.h"
+#include "MantidIndexing/Partitioner.h"
+
+namespace Mantid {
+namespace Indexing {
+
+/** A partitioning into contiguous blocks of indices with a similar number of
+  events, e.g., for event data where the number of events per detector bank
+  varies a lot.
+
+  The indices are made up of consecutive ranges, typically the spectra of a
+  detector bank, with a given number of events each. Every spectrum is
+  counted as one event on top of those, for the work done per spectrum. The
+  blocks end at the boundary of a range if that leaves the number of events
+  in the block within a tenth of the ideal, otherwise a range is split.
+  Indices beyond the last range are assigned to the last block.
+*/
+class MANTID_INDEXING_DLL EventCountPartitioner : public Partitioner {
+public:
+  EventCountPartitioner(const int numberOfPartitions,
+                        const PartitionIndex partition,
+                        const MonitorStrategy monitorStrategy,
+                        const std::vector<size_t> &rangeSizes,
+                        const std::vector<size_t> &eventCounts,
+                        std::vector<GlobalSpectrumIndex> monitors = {});
+
+private:
+  PartitionIndex doIndexOf(const GlobalSpectrumIndex index) const override;
+
+  /// The first index of each partition that holds spectra
+  std::vector<size_t> m_starts;
+};
+
+} // namespace Indexing
+} // namespace Mantid
+
+#endif /* MANTID_INDEXING_EVENTCOUNTPARTITIONER_H_ */
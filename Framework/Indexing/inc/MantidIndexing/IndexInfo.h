@@ -8,6 +8,7 @@
 #define MANTID_INDEXING_INDEXINFO_H_
 
 #include "MantidIndexing/DllConfig.h"
+#include "MantidIndexing/PartitionIndex.h"
 #include "MantidIndexing/SpectrumNumber.h"
 #include "MantidKernel/cow_ptr.h"
 #include "MantidParallel/StorageMode.h"
@@ -23,6 +24,7 @@ class Communicator;
 }
 namespace Indexing {
 class GlobalSpectrumIndex;
+class Partitioner;
 class SpectrumIndexSet;
 class SpectrumNumberTranslator;
 
@@ -68,6 +70,10 @@ public:
   IndexInfo(std::vector<SpectrumNumber> spectrumNumbers,
             const Parallel::StorageMode storageMode,
             const Parallel::Communicator &communicator);
+  IndexInfo(std::vector<SpectrumNumber> spectrumNumbers,
+            const Parallel::StorageMode storageMode,
+            const Parallel::Communicator &communicator,
+            const Partitioner &partitioner);
   template <class IndexType>
   IndexInfo(std::vector<IndexType> indices, const IndexInfo &parent);
 
@@ -106,13 +112,15 @@ public:
       const std::vector<size_t> &detectorIndices) const;
 
   bool isOnThisPartition(GlobalSpectrumIndex globalIndex) const;
+  PartitionIndex partitionOf(GlobalSpectrumIndex globalIndex) const;
 
   Parallel::StorageMode storageMode() const;
   const Parallel::Communicator &communicator() const;
 
 private:
   void makeSpectrumNumberTranslator(
-      std::vector<SpectrumNumber> &&spectrumNumbers) const;
+      std::vector<SpectrumNumber> &&spectrumNumbers,
+      const Partitioner *partitioner = nullptr) const;
 
   Parallel::StorageMode m_storageMode;
   std::unique_ptr<Parallel::Communicator> m_communicator;
@@ -12,6 +12,7 @@
 namespace Mantid {
 namespace Indexing {
 class IndexInfo;
+class Partitioner;
 
 /** Scattering for IndexInfo, in particular changing its storage mode to
   Parallel::StorageMode::Distributed.
@@ -20,6 +21,8 @@ class IndexInfo;
   @date 2017
 */
 MANTID_INDEXING_DLL IndexInfo scatter(const IndexInfo &indexInfo);
+MANTID_INDEXING_DLL IndexInfo scatter(const IndexInfo &indexInfo,
+                                      const Partitioner &partitioner);
 
 } // namespace Indexing
 } // namespace Mantid
@@ -0,0 +1,87 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidIndexing/EventCountPartitioner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Indexing {
+
+namespace {
+/// Largest deviation from the ideal load of a partition, relative to the
+/// ideal load, for which a block is ended at a range boundary
+constexpr double RANGE_BOUNDARY_TOLERANCE = 0.1;
+} // namespace
+
+/**
+ * @param numberOfPartitions :: The number of partitions
+ * @param partition :: The partition of this process
+ * @param monitorStrategy :: How monitors are partitioned
+ * @param rangeSizes :: The number of indices of each range, in order
+ * @param eventCounts :: The number of events of each range
+ * @param monitors :: The indices of the monitors
+ */
+EventCountPartitioner::EventCountPartitioner(
+    const int numberOfPartitions, const PartitionIndex partition,
+    const MonitorStrategy monitorStrategy,
+    const std::vector<size_t> &rangeSizes,
+    const std::vector<size_t> &eventCounts,
+    std::vector<GlobalSpectrumIndex> monitors)
+    : Partitioner(numberOfPartitions, partition, monitorStrategy,
+                  std::move(monitors)) {
+  if (rangeSizes.size() != eventCounts.size())
+    throw std::invalid_argument("EventCountPartitioner: the number of range "
+                                "sizes and event counts must match.");
+  // The load of a range is its number of events plus one per spectrum
+  std::vector<size_t> rangeStarts{0};
+  std::vector<double> cumulativeLoads{0.0};
+  for (size_t range = 0; range < rangeSizes.size(); ++range) {
+    rangeStarts.push_back(rangeStarts.back() + rangeSizes[range]);
+    cumulativeLoads.push_back(
+        cumulativeLoads.back() +
+        static_cast<double>(eventCounts[range] + rangeSizes[range]));
+  }
+
+  const auto partitions = numberOfNonMonitorPartitions();
+  m_starts.push_back(0);
+  if (rangeSizes.empty())
+    return;
+  const double idealLoad = cumulativeLoads.back() / partitions;
+  for (int block = 1; block < partitions; ++block) {
+    const double load = idealLoad * block;
+    // The range in which the ideal end of the block falls
+    const auto upper = std::upper_bound(cumulativeLoads.begin() + 1,
+                                        cumulativeLoads.end() - 1, load);
+    const auto range =
+        static_cast<size_t>(upper - cumulativeLoads.begin()) - 1;
+    const double before = load - cumulativeLoads[range];
+    const double after = cumulativeLoads[range + 1] - load;
+    size_t start;
+    if (std::min(before, after) <= RANGE_BOUNDARY_TOLERANCE * idealLoad) {
+      start = before <= after ? rangeStarts[range] : rangeStarts[range + 1];
+    } else {
+      const double rangeLoad =
+          cumulativeLoads[range + 1] - cumulativeLoads[range];
+      start = rangeStarts[range] +
+              static_cast<size_t>(std::llround(
+                  before / rangeLoad * static_cast<double>(rangeSizes[range])));
+    }
+    m_starts.push_back(std::max(start, m_starts.back()));
+  }
+}
+
+PartitionIndex
+EventCountPartitioner::doIndexOf(const GlobalSpectrumIndex index) const {
+  const auto next = std::upper_bound(m_starts.begin(), m_starts.end(),
+                                     static_cast<size_t>(index));
+  return PartitionIndex(static_cast<int>(next - m_starts.begin()) - 1);
+}
+
+} // namespace Indexing
+} // namespace Mantid
@@ -56,6 +56,19 @@ IndexInfo::IndexInfo(std::vector<SpectrumNumber> spectrumNumbers,
   makeSpectrumNumberTranslator(std::move(spectrumNumbers));
 }
 
+/// Construct with given spectrum number for each index and no spectrum
+/// definitions. With StorageMode::Distributed the spectra are partitioned
+/// over the ranks of the communicator by the given partitioner, which must
+/// have a partition for each rank. It is ignored for other storage modes.
+IndexInfo::IndexInfo(std::vector<SpectrumNumber> spectrumNumbers,
+                     const Parallel::StorageMode storageMode,
+                     const Parallel::Communicator &communicator,
+                     const Partitioner &partitioner)
+    : m_storageMode(storageMode),
+      m_communicator(std::make_unique<Parallel::Communicator>(communicator)) {
+  makeSpectrumNumberTranslator(std::move(spectrumNumbers), &partitioner);
+}
+
 /** Construct with given index subset of parent.
  *
  * The template argument IndexType can be SpectrumNumber or GlobalSpectrumIndex.
@@ -380,6 +393,12 @@ bool IndexInfo::isOnThisPartition(GlobalSpectrumIndex globalIndex) const {
   return helperSet.size() == 1;
 }
 
+/// Returns the partition (MPI rank) holding the spectrum with the given global
+/// index.
+PartitionIndex IndexInfo::partitionOf(GlobalSpectrumIndex globalIndex) const {
+  return m_spectrumNumberTranslator->partitionOf(globalIndex);
+}
+
 /// Returns the storage mode used in MPI runs.
 Parallel::StorageMode IndexInfo::storageMode() const { return m_storageMode; }
 
@@ -389,7 +408,8 @@ const Parallel::Communicator &IndexInfo::communicator() const {
 }
 
 void IndexInfo::makeSpectrumNumberTranslator(
-    std::vector<SpectrumNumber> &&spectrumNumbers) const {
+    std::vector<SpectrumNumber> &&spectrumNumbers,
+    const Partitioner *partitioner) const {
   PartitionIndex partition;
   int numberOfPartitions;
   if (m_storageMode == Parallel::StorageMode::Distributed) {
@@ -409,11 +429,22 @@ void IndexInfo::makeSpectrumNumberTranslator(
     throw std::runtime_error("IndexInfo: unknown storage mode " +
                              Parallel::toString(m_storageMode));
   }
-  auto partitioner = std::make_unique<RoundRobinPartitioner>(
+  if (partitioner && m_storageMode == Parallel::StorageMode::Distributed) {
+    if (partitioner->numberOfPartitions() != numberOfPartitions)
+      throw std::runtime_error(
+          "IndexInfo: the partitioner has " +
+          std::to_string(partitioner->numberOfPartitions()) +
+          " partitions but there are " + std::to_string(numberOfPartitions) +
+          " ranks");
+    m_spectrumNumberTranslator = Kernel::make_cow<SpectrumNumberTranslator>(
+        std::move(spectrumNumbers), *partitioner, partition);
+    return;
+  }
+  RoundRobinPartitioner roundRobin(
       numberOfPartitions, partition,
       Partitioner::MonitorStrategy::TreatAsNormalSpectrum);
   m_spectrumNumberTranslator = Kernel::make_cow<SpectrumNumberTranslator>(
-      std::move(spectrumNumbers), *partitioner, partition);
+      std::move(spectrumNumbers), roundRobin, partition);
 }
 
 template MANTID_INDEXING_DLL IndexInfo::IndexInfo(std::vector<SpectrumNumber>,
@@ -14,8 +14,9 @@
 namespace Mantid {
 namespace Indexing {
 
-/// Returns a scattered copy of `indexInfo` with storage mode `Distributed`.
-IndexInfo scatter(const Indexing::IndexInfo &indexInfo) {
+namespace {
+IndexInfo scatterWith(const Indexing::IndexInfo &indexInfo,
+                      const Partitioner *partitioner) {
   using namespace Parallel;
   if (indexInfo.communicator().size() == 1 ||
       indexInfo.storageMode() == Parallel::StorageMode::Distributed)
@@ -28,7 +29,11 @@ IndexInfo scatter(const Indexing::IndexInfo &indexInfo) {
   std::vector<SpectrumNumber> spectrumNumbers;
   for (size_t i = 0; i < indexInfo.size(); ++i)
     spectrumNumbers.push_back(indexInfo.spectrumNumber(i));
-  IndexInfo scattered(spectrumNumbers, Parallel::StorageMode::Distributed,
+  IndexInfo scattered =
+      partitioner
+          ? IndexInfo(spectrumNumbers, Parallel::StorageMode::Distributed,
+                      indexInfo.communicator(), *partitioner)
+          : IndexInfo(spectrumNumbers, Parallel::StorageMode::Distributed,
                       indexInfo.communicator());
   const auto &globalSpectrumDefinitions = indexInfo.spectrumDefinitions();
   std::vector<SpectrumDefinition> spectrumDefinitions;
@@ -38,6 +43,19 @@ IndexInfo scatter(const Indexing::IndexInfo &indexInfo) {
   scattered.setSpectrumDefinitions(spectrumDefinitions);
   return scattered;
 }
+} // namespace
+
+/// Returns a scattered copy of `indexInfo` with storage mode `Distributed`.
+IndexInfo scatter(const Indexing::IndexInfo &indexInfo) {
+  return scatterWith(indexInfo, nullptr);
+}
+
+/// Returns a scattered copy of `indexInfo` with storage mode `Distributed`,
+/// with the spectra partitioned by `partitioner`.
+IndexInfo scatter(const Indexing::IndexInfo &indexInfo,
+                  const Partitioner &partitioner) {
+  return scatterWith(indexInfo, &partitioner);
+}
 
 } // namespace Indexing
 } // namespace Mantid
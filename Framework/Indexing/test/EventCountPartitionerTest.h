@@ -0,0 +1,98 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_INDEXING_EVENTCOUNTPARTITIONERTEST_H_
+#define MANTID_INDEXING_EVENTCOUNTPARTITIONERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidIndexing/EventCountPartitioner.h"
+
+#include <stdexcept>
+
+using namespace Mantid::Indexing;
+
+namespace {
+EventCountPartitioner makePartitioner(const int ranks,
+                                      const std::vector<size_t> &rangeSizes,
+                                      const std::vector<size_t> &eventCounts) {
+  return EventCountPartitioner(
+      ranks, PartitionIndex(0),
+      Partitioner::MonitorStrategy::TreatAsNormalSpectrum, rangeSizes,
+      eventCounts);
+}
+} // namespace
+
+class EventCountPartitionerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventCountPartitionerTest *createSuite() {
+    return new EventCountPartitionerTest();
+  }
+  static void destroySuite(EventCountPartitionerTest *suite) { delete suite; }
+
+  void test_throws_if_sizes_do_not_match() {
+    TS_ASSERT_THROWS((makePartitioner(2, {10, 10}, {5})),
+                     const std::invalid_argument &);
+  }
+
+  void test_1_rank() {
+    const auto partitioner = makePartitioner(1, {10, 10}, {100, 5});
+    TS_ASSERT_EQUALS(partitioner.numberOfPartitions(), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(0)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(19)), 0);
+  }
+
+  void test_equal_ranges_are_kept_whole() {
+    const auto partitioner =
+        makePartitioner(4, {100, 100, 100, 100}, {1000, 1000, 1000, 1000});
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(0)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(99)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(100)), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(199)), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(200)), 2);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(300)), 3);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(399)), 3);
+  }
+
+  void test_range_with_most_events_is_split() {
+    const auto partitioner =
+        makePartitioner(4, {100, 100, 100, 100}, {4000, 0, 0, 0});
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(26)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(27)), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(54)), 2);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(79)), 2);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(80)), 3);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(399)), 3);
+  }
+
+  void test_block_ends_at_nearby_range_boundary() {
+    // The ideal end of the first block is 105 spectra into the second range,
+    // which is within a tenth of the ideal load of its start.
+    const auto partitioner =
+        makePartitioner(2, {100, 100, 10}, {1000, 1000, 200});
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(99)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(100)), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(209)), 1);
+  }
+
+  void test_indices_beyond_ranges_are_in_last_partition() {
+    const auto partitioner = makePartitioner(3, {10}, {0});
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(0)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(3)), 1);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(7)), 2);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(100)), 2);
+  }
+
+  void test_no_ranges() {
+    const auto partitioner = makePartitioner(2, {}, {});
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(0)), 0);
+    TS_ASSERT_EQUALS(partitioner.indexOf(GlobalSpectrumIndex(5)), 0);
+  }
+};
+
+#endif /* MANTID_INDEXING_EVENTCOUNTPARTITIONERTEST_H_ */
@@ -9,6 +9,7 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidIndexing/EventCountPartitioner.h"
 #include "MantidIndexing/GlobalSpectrumIndex.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/make_cow.h"
@@ -83,6 +84,36 @@ void run_isOnThisPartition_StorageMode_Distributed(
   }
 }
 
+void run_partitioner_StorageMode_Distributed(
+    const Parallel::Communicator &comm) {
+  // All events in the first of two ranges, such that it is split
+  const EventCountPartitioner partitioner(
+      comm.size(), PartitionIndex(comm.rank()),
+      Partitioner::MonitorStrategy::TreatAsNormalSpectrum, {7, 40}, {1000, 0});
+  std::vector<SpectrumNumber> spectrumNumbers;
+  for (int32_t i = 1; i <= 47; ++i)
+    spectrumNumbers.emplace_back(i);
+  IndexInfo info(spectrumNumbers, Parallel::StorageMode::Distributed, comm,
+                 partitioner);
+  size_t expectedSize = 0;
+  for (size_t i = 0; i < info.globalSize(); ++i) {
+    const auto partition = partitioner.indexOf(GlobalSpectrumIndex(i));
+    TS_ASSERT_EQUALS(info.partitionOf(i), partition);
+    TS_ASSERT_EQUALS(info.isOnThisPartition(i),
+                     static_cast<int>(partition) == comm.rank());
+    if (static_cast<int>(partition) == comm.rank())
+      ++expectedSize;
+  }
+  TS_ASSERT_EQUALS(info.size(), expectedSize);
+  const EventCountPartitioner wrongSize(
+      comm.size() + 1, PartitionIndex(comm.rank()),
+      Partitioner::MonitorStrategy::TreatAsNormalSpectrum, {47}, {0});
+  TS_ASSERT_THROWS(IndexInfo(spectrumNumbers,
+                             Parallel::StorageMode::Distributed, comm,
+                             wrongSize),
+                   const std::runtime_error &);
+}
+
 void run_construct_from_parent_StorageMode_Distributed(
     const Parallel::Communicator &comm) {
   IndexInfo parent(47, Parallel::StorageMode::Distributed, comm);
@@ -437,6 +468,12 @@ public:
     run_isOnThisPartition_StorageMode_Distributed(Parallel::Communicator{});
   }
 
+  void test_partitioner_StorageMode_Distributed() {
+    runParallel(run_partitioner_StorageMode_Distributed);
+    // Trivial: Run with one partition.
+    run_partitioner_StorageMode_Distributed(Parallel::Communicator{});
+  }
+
   void test_construct_from_parent_StorageMode_Distributed() {
     runParallel(run_construct_from_parent_StorageMode_Distributed);
   }
@@ -9,6 +9,7 @@
 
 #include "DllConfig.h"
 #include "MantidKernel/IValidator.h"
+#include "MantidKernel/LRUCache.h"
 #include "MantidKernel/NullValidator.h"
 #include "MantidKernel/Property.h"
 #include "PropertyWithValue.h"
@@ -52,6 +53,12 @@ public:
   // element of the vector
 
 private:
+  /// The number of parsed strings cached for each type
+  static constexpr size_t CACHE_SIZE = 128;
+  /// Longer strings are parsed every time
+  static constexpr size_t MAX_CACHED_LENGTH = 65536;
+  static LRUCache<std::string, std::vector<T>> &parsedValues();
+
   // This method is a workaround for the C4661 compiler warning in visual
   // studio. This allows the template declaration and definition to be separated
   // in different files. See stack overflow article for a more detailed
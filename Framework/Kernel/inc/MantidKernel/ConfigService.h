@@ -17,6 +17,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -285,6 +286,17 @@ private:
   /// Returns a list of all keys under a given root key
   void getKeysRecursive(const std::string &root,
                         std::vector<std::string> &allKeys) const;
+  /// Searches the configuration for a property without using the snapshot
+  boost::optional<std::string> lookUpString(const std::string &keyName,
+                                            bool use_cache) const;
+  // Forward declaration of the types in the snapshot of property values
+  struct CachedValue;
+  struct Snapshot;
+  /// Returns the snapshot entry for a property, adding it if it is new
+  std::shared_ptr<const CachedValue>
+  cachedValue(const std::string &keyName) const;
+  /// Discards the snapshot once the configuration has changed
+  void clearSnapshot() const;
 
   // Forward declaration of inner class
   template <class T> class WrappedObject;
@@ -324,6 +336,13 @@ private:
   Kernel::ProxyInfo m_proxyInfo;
   /// whether the proxy has been populated yet
   bool m_isProxySet;
+
+  /// Immutable snapshot of the property values read so far. It is only read
+  /// and replaced with std::atomic_load/std::atomic_store, so reading a value
+  /// does not touch the Poco configuration.
+  mutable std::shared_ptr<const Snapshot> m_snapshot;
+  /// Serialises adding values to the snapshot
+  mutable std::mutex m_snapshotMutex;
 };
 
 EXTERN_MANTID_KERNEL template class MANTID_KERNEL_DLL
@@ -363,21 +363,24 @@ public:
   virtual void shutdown() { clear(); }
 
   //--------------------------------------------------------------------------
-  /** Get a shared pointer to a stored data object
+  /** Get a shared pointer to a stored data object. It is not const, as a
+   * derived service may replace the object in beforeRetrieve().
    * @param name :: name of the object */
-  boost::shared_ptr<T> retrieve(const std::string &name) const {
-    // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
-
-    auto it = datamap.find(name);
-    if (it != datamap.end()) {
-      return it->second;
-    } else {
-      throw Kernel::Exception::NotFoundError(
-          "Unable to find Data Object type with name '" + name +
-              "': data service ",
-          name);
+  boost::shared_ptr<T> retrieve(const std::string &name) {
+    boost::shared_ptr<T> object;
+    {
+      // Make DataService access thread-safe
+      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+      auto it = datamap.find(name);
+      if (it == datamap.end()) {
+        throw Kernel::Exception::NotFoundError(
+            "Unable to find Data Object type with name '" + name +
+                "': data service ",
+            name);
+      }
+      object = it->second;
     }
+    return beforeRetrieve(name, object);
   }
 
   /// Checks all elements within the specified vector exist in the ADS
@@ -465,11 +468,10 @@ public:
     return foundNames;
   }
 
-  /// Get a vector of the pointers to the data objects stored by the service
+  /// Get a vector of the pointers to the data objects stored by the service,
+  /// each passed through beforeRetrieve() as by retrieve()
   std::vector<boost::shared_ptr<T>>
-  getObjects(DataServiceHidden includeHidden = DataServiceHidden::Auto) const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
-
+  getObjects(DataServiceHidden includeHidden = DataServiceHidden::Auto) {
     const bool alwaysIncludeHidden =
         includeHidden == DataServiceHidden::Include;
     const bool usingAuto =
@@ -477,13 +479,20 @@ public:
 
     const bool showingHidden = alwaysIncludeHidden || usingAuto;
 
-    std::vector<boost::shared_ptr<T>> objects;
-    objects.reserve(datamap.size());
-    for (const auto &it : datamap) {
-      if (showingHidden || !isHiddenDataServiceObject(it.first)) {
-        objects.push_back(it.second);
+    std::vector<std::pair<std::string, boost::shared_ptr<T>>> stored;
+    {
+      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+      stored.reserve(datamap.size());
+      for (const auto &it : datamap) {
+        if (showingHidden || !isHiddenDataServiceObject(it.first)) {
+          stored.emplace_back(it);
+        }
       }
     }
+    std::vector<boost::shared_ptr<T>> objects;
+    objects.reserve(stored.size());
+    for (const auto &item : stored)
+      objects.push_back(beforeRetrieve(item.first, item.second));
     return objects;
   }
 
@@ -514,6 +523,67 @@ protected:
   DataService(const std::string &name) : svcName(name), g_log(svcName) {}
   virtual ~DataService() = default;
 
+  /** Called by retrieve() and getObjects() with a stored object, without the
+   * service locked. A derived service may return another object, e.g. to
+   * reload one that it has moved out of memory, and store it with
+   * replaceStored().
+   * @param name :: name of the object
+   * @param object :: the stored object
+   * @return the object to hand out */
+  virtual boost::shared_ptr<T>
+  beforeRetrieve(const std::string & /*name*/,
+                 const boost::shared_ptr<T> &object) {
+    return object;
+  }
+
+  /** Replace a stored data object, unless it has changed since it was looked
+   * up, without sending notifications
+   * @param name :: name of the object
+   * @param expected :: the object looked up
+   * @param replacement :: the object to store in its place
+   * @return the object stored under the name afterwards, or a null pointer if
+   * there is none */
+  boost::shared_ptr<T> replaceStored(const std::string &name,
+                                     const boost::shared_ptr<T> &expected,
+                                     const boost::shared_ptr<T> &replacement) {
+    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    auto it = datamap.find(name);
+    if (it == datamap.end())
+      return boost::shared_ptr<T>();
+    if (it->second == expected)
+      it->second = replacement;
+    return it->second;
+  }
+
+  /** Get a stored data object without calling beforeRetrieve()
+   * @param name :: name of the object
+   * @return the object, or a null pointer if there is none */
+  boost::shared_ptr<T> findStored(const std::string &name) const {
+    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    auto it = datamap.find(name);
+    return it != datamap.end() ? it->second : boost::shared_ptr<T>();
+  }
+
+  /** Call func(name, object) for each stored data object with the service
+   * locked. The function may replace the object, which sends no
+   * notification. */
+  template <typename Func> void forEachStored(Func &&func) {
+    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    for (auto &item : datamap)
+      func(item.first, item.second);
+  }
+
+  /** Call func(name, object) for each stored data object with the service
+   * locked */
+  template <typename Func> void forEachStored(Func &&func) const {
+    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    for (const auto &item : datamap)
+      func(item.first, item.second);
+  }
+
+  /// Recursive mutex to avoid simultaneous access or notifications
+  mutable std::recursive_mutex m_mutex;
+
 private:
   void checkForEmptyName(const std::string &name) {
     if (name.empty()) {
@@ -536,8 +606,6 @@ private:
   const std::string svcName;
   /// Map of objects in the data service
   svcmap datamap;
-  /// Recursive mutex to avoid simultaneous access or notifications
-  mutable std::recursive_mutex m_mutex;
   /// Logger for this DataService
   Logger g_log;
 }; // End Class Data service
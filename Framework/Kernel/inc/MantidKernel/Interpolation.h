@@ -56,6 +56,9 @@ public:
   /// get interpolated value at location at
   double value(const double &at) const;
 
+  /// get interpolated values at many locations
+  void value(const std::vector<double> &at, std::vector<double> &result) const;
+
   /// set interpolation method
   void setMethod(const std::string &method) { m_method = method; }
 
@@ -0,0 +1,100 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_LRUCACHE_H_
+#define MANTID_KERNEL_LRUCACHE_H_
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace Mantid {
+namespace Kernel {
+/** LRUCache : a thread-safe cache holding up to a given number of values,
+  dropping the least recently used beyond it.
+
+  The values are held by shared pointers to const so that a value found can
+  be used after it has been dropped from the cache, and by several threads at
+  once.
+*/
+template <class KEYTYPE, class VALUETYPE> class LRUCache {
+public:
+  using Value_sptr = std::shared_ptr<const VALUETYPE>;
+
+  /// @param capacity :: The number of values to keep
+  explicit LRUCache(const size_t capacity) : m_capacity(capacity) {}
+  LRUCache(const LRUCache &) = delete;
+  LRUCache &operator=(const LRUCache &) = delete;
+
+  /**
+   * @param key :: The key of the value
+   * @return the value, which becomes the most recently used, or a null
+   * pointer if the key is not in the cache
+   */
+  Value_sptr find(const KEYTYPE &key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto entry = m_index.find(key);
+    if (entry == m_index.end())
+      return nullptr;
+    m_entries.splice(m_entries.begin(), m_entries, entry->second);
+    return entry->second->second;
+  }
+
+  /**
+   * Add or replace a value as the most recently used, dropping the least
+   * recently used if the cache is full
+   * @param key :: The key of the value
+   * @param value :: The value
+   */
+  void insert(const KEYTYPE &key, Value_sptr value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto entry = m_index.find(key);
+    if (entry != m_index.end()) {
+      entry->second->second = std::move(value);
+      m_entries.splice(m_entries.begin(), m_entries, entry->second);
+      return;
+    }
+    if (m_capacity == 0)
+      return;
+    m_entries.emplace_front(key, std::move(value));
+    m_index.emplace(key, m_entries.begin());
+    if (m_entries.size() > m_capacity) {
+      m_index.erase(m_entries.back().first);
+      m_entries.pop_back();
+    }
+  }
+
+  /// Drop all the values
+  void clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+  }
+
+  /// @return the number of values in the cache
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+  }
+
+private:
+  using Entries = std::list<std::pair<KEYTYPE, Value_sptr>>;
+
+  /// The entries, most recently used first
+  Entries m_entries;
+  /// The entries by key
+  std::unordered_map<KEYTYPE, typename Entries::iterator> m_index;
+  /// The number of values to keep
+  const size_t m_capacity;
+  mutable std::mutex m_mutex;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_LRUCACHE_H_ */
@@ -10,6 +10,8 @@
 //----------------------------------------------------------------------
 // Includes
 //----------------------------------------------------------------------
+#include <map>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -36,6 +38,21 @@ public:
   enum LoadLibraries { Recursive, NonRecursive };
   int openLibraries(const std::string &libpath, LoadLibraries loadingBehaviour,
                     const std::vector<std::string> &excludes);
+  /// Find the libraries on a path that openLibraries would open
+  std::vector<std::string>
+  findLibraries(const std::string &libpath, LoadLibraries loadingBehaviour,
+                const std::vector<std::string> &excludes) const;
+  /// Open a single library
+  int openLibrary(const std::string &filepath);
+  /// Open a library only once one of the given entries is requested
+  void deferLibrary(const std::string &filepath,
+                    const std::vector<std::string> &entries);
+  /// Open the deferred library providing an entry
+  bool openLibraryProviding(const std::string &entry);
+  /// Open the deferred libraries providing entries starting with a prefix
+  int openLibrariesProviding(const std::string &prefix);
+  /// Lock the factories filled by the libraries while they are read
+  std::unique_lock<std::recursive_mutex> lockFactories() const;
   LibraryManagerImpl(const LibraryManagerImpl &) = delete;
   LibraryManagerImpl &operator=(const LibraryManagerImpl &) = delete;
 
@@ -51,19 +68,35 @@ private:
   /// Private so Poco::File doesn't leak to the public interface
   int openLibraries(const Poco::File &libpath, LoadLibraries loadingBehaviour,
                     const std::vector<std::string> &excludes);
+  /// Find libraries from the given Poco::File path
+  void findLibraries(const Poco::File &libpath, LoadLibraries loadingBehaviour,
+                     const std::vector<std::string> &excludes,
+                     std::vector<std::string> &libraries) const;
   /// Check if the library should be loaded
   bool shouldBeLoaded(const std::string &filename,
                       const std::vector<std::string> &excludes) const;
   /// Check if the library has already been loaded
   bool isLoaded(const std::string &filename) const;
+  /// Check if the library has been deferred
+  bool isDeferred(const std::string &filename) const;
   /// Returns true if the library has been requested to be excluded
   bool isExcluded(const std::string &filename,
                   const std::vector<std::string> &excludes) const;
   /// Load a given library
   int openLibrary(const Poco::File &filepath, const std::string &cacheKey);
+  /// Open a deferred library
+  int openDeferredLibrary(const std::string &filename);
 
   /// Storage for the LibraryWrappers.
   std::unordered_map<std::string, LibraryWrapper> m_openedLibs;
+  /// The paths of the deferred libraries, keyed by filename
+  std::unordered_map<std::string, std::string> m_deferredLibs;
+  /// The filename of the deferred library providing each entry, sorted to
+  /// find the entries starting with a prefix
+  std::map<std::string, std::string> m_deferredEntries;
+  /// Guards the libraries and the factories their registrations fill, which
+  /// are read and opened from any thread
+  mutable std::recursive_mutex m_mutex;
 };
 
 EXTERN_MANTID_KERNEL template class MANTID_KERNEL_DLL
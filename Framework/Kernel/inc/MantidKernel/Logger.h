@@ -46,6 +46,11 @@ namespace Kernel {
             Logger ls(someLogger);
             ls.error("Some informational message");
             ls.error() << "Some error message\n";
+            MANTID_LOG_DEBUG(ls, "Spectrum " << i << " done\n");
+
+    Streams of levels that are not logged discard what is written to them
+    without formatting it. The MANTID_LOG_ macros also skip evaluating the
+    operands of the message, such as calls building strings.
 
     @author Nicholas Draper, Tessella Support Services plc
     @date 12/10/2007
@@ -120,6 +125,8 @@ public:
 
   /// Returns true if at least the given log level is set.
   bool is(int level) const;
+  /// Returns true if a message of the given priority would be logged
+  bool willLog(const Priority priority) const;
 
   /// Sets the log level for all Loggers created so far, including the root
   /// logger.
@@ -137,7 +144,7 @@ private:
   Logger &operator=(const Logger &);
 
   /// Return a log stream set with the given priority
-  Priority applyLevelOffset(Priority proposedLevel);
+  Priority applyLevelOffset(Priority proposedLevel) const;
 
   /// Internal handle to third party logging objects
   Poco::Logger *m_log;
@@ -153,4 +160,20 @@ private:
 } // namespace Kernel
 } // namespace Mantid
 
+/// Stream a message into a Logger at the given priority, only evaluating the
+/// operands of the message if it would be logged, e.g.
+/// MANTID_LOG(g_log, Poco::Message::PRIO_DEBUG, "x = " << x << '\n');
+#define MANTID_LOG(logger, priority, message)                                  \
+  do {                                                                         \
+    if ((logger).willLog(priority))                                            \
+      (logger).getLogStream(priority) << message;                              \
+  } while (false)
+
+/// Stream a message into a Logger at debug level if it would be logged
+#define MANTID_LOG_DEBUG(logger, message)                                      \
+  MANTID_LOG(logger, Poco::Message::PRIO_DEBUG, message)
+/// Stream a message into a Logger at information level if it would be logged
+#define MANTID_LOG_INFORMATION(logger, message)                                \
+  MANTID_LOG(logger, Poco::Message::PRIO_INFORMATION, message)
+
 #endif /*MANTID_KERNEL_LOGGINGSERVICE_H_*/
@@ -13,6 +13,7 @@
 #include "MantidKernel/NeutronAtom.h"
 #include "MantidKernel/PhysicalConstants.h"
 #include <boost/shared_ptr.hpp>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -184,6 +185,9 @@ public:
 private:
   /// Update the total atom count
   void countAtoms();
+  struct XSectionCache;
+  /// The cross sections derived from the chemical formula
+  const XSectionCache &xSections() const;
 
   /// Material name
   std::string m_name;
@@ -197,6 +201,8 @@ private:
   double m_temperature;
   /// Pressure
   double m_pressure;
+  /// Cross sections derived from the formula, shared between copies
+  std::shared_ptr<XSectionCache> m_xSections;
 };
 
 /// Typedef for a shared pointer
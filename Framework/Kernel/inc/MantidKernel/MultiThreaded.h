@@ -8,6 +8,7 @@
 #define MANTID_KERNEL_MULTITHREADED_H_
 
 #include "MantidKernel/DataItem.h"
+#include "MantidKernel/DllConfig.h"
 
 #include <atomic>
 #include <mutex>
@@ -80,6 +81,13 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
   } while (!f.compare_exchange_weak(old, desired));
 }
 
+/** Check whether the calling thread is a worker of a Kernel::ThreadPool.
+ * The parallel loop macros below run serially in such threads, as the cores
+ * are already used by the other workers of the pool.
+ * @return true if called from a task run by a ThreadPool
+ */
+MANTID_KERNEL_DLL bool inThreadPoolWorker();
+
 } // namespace Kernel
 } // namespace Mantid
 
@@ -131,20 +139,30 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
 
 #include <omp.h>
 
+/* The loops below use a static schedule: with the same number of threads,
+ * every loop over the spectra of a workspace hands the same range of spectra
+ * to the same thread. The histograms of an output workspace are allocated by
+ * the thread first writing to them, so with threads bound to cores
+ * (OMP_PROC_BIND=true) later loops find their spectra in the memory of their
+ * own NUMA node.
+ */
+
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
  *   This includes an arbirary check: condition.
  *   "condition" must evaluate to TRUE in order for the
  *   code to be executed in parallel
  */
 #define PARALLEL_FOR_IF(condition)                                             \
-    PRAGMA(omp parallel for if (condition) )
+    PRAGMA(omp parallel for schedule(static) if ((condition) &&                \
+                                !Mantid::Kernel::inThreadPoolWorker()) )
 
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
  *   This includes no checks to see if workspaces are suitable
  *   and therefore should not be used in any loops that access workspaces.
  */
 #define PARALLEL_FOR_NO_WSP_CHECK()                                            \
-    PRAGMA(omp parallel for)
+    PRAGMA(omp parallel for schedule(static)                                   \
+               if (!Mantid::Kernel::inThreadPoolWorker()) )
 
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
  *  and declare the variables to be firstprivate.
@@ -152,10 +170,12 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
  *  and therefore should not be used in any loops that access workspace.
  */
 #define PARALLEL_FOR_NOWS_CHECK_FIRSTPRIVATE(variable)                         \
-  PRAGMA(omp parallel for firstprivate(variable) )
+  PRAGMA(omp parallel for schedule(static) firstprivate(variable)              \
+             if (!Mantid::Kernel::inThreadPoolWorker()) )
 
 #define PARALLEL_FOR_NO_WSP_CHECK_FIRSTPRIVATE2(variable1, variable2)          \
-  PRAGMA(omp parallel for firstprivate(variable1, variable2) )
+  PRAGMA(omp parallel for schedule(static) firstprivate(variable1, variable2)  \
+             if (!Mantid::Kernel::inThreadPoolWorker()) )
 
 /** Ensures that the next execution line or block is only executed if
  * there are multple threads execting in this region
@@ -192,7 +212,10 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
 
 #define PARALLEL_THREAD_NUMBER omp_get_thread_num()
 
-#define PARALLEL PRAGMA(omp parallel)
+#define PARALLEL PRAGMA(omp parallel if (!Mantid::Kernel::inThreadPoolWorker()))
+
+/// True inside an OpenMP parallel region running on more than one thread
+#define PARALLEL_IN_REGION (omp_in_parallel() != 0)
 
 #define PARALLEL_SECTIONS PRAGMA(omp sections nowait)
 
@@ -221,6 +244,7 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
 #define PARALLEL_NUMBER_OF_THREADS 1
 #define PARALLEL_GET_MAX_THREADS 1
 #define PARALLEL
+#define PARALLEL_IN_REGION false
 #define PARALLEL_SECTIONS
 #define PARALLEL_SECTION
 #define PRAGMA_OMP(expression)
@@ -19,7 +19,8 @@
   the k nearest neighbours.
 
   Given a vector of Eigen::Vectors this class will generate a KDTree. The tree
-  can then be interrogated to find the closest k neighbours to a given position.
+  can then be interrogated to find the closest k neighbours to a given position,
+  or all the neighbours within a radius of it.
 
   This classes is templated with a parameter N which defines the dimensionality
   of the vector type used. i.e. if N = 3 then Eigen::Vector3d is used.
@@ -145,6 +146,38 @@ public:
     return makeResults(k, std::move(nnIndexList), std::move(nnDistList));
   }
 
+  /** Find all the points within a radius of a given point
+   *
+   * This is a thin wrapper around the ANN library annkFRSearch method. Points
+   * at exactly the given position are not returned, as with findNearest.
+   *
+   * @param pos :: the position to find the neighbours of
+   * @param radius :: the radius to search within
+   * @param error :: error term for approximate searches. if zero then all
+   * 	neighbours will be found. (default = 0.0).
+   * @return vector neighbours as tuples of (position, index, distance), in
+   * order of increasing distance
+   */
+  NearestNeighbourResults findWithinRadius(const VectorType &pos,
+                                           const double radius,
+                                           const double error = 0.0) {
+    // create ANNpoint from Eigen array
+    auto point = std::unique_ptr<ANNcoord[]>(annAllocPt(N));
+    Eigen::Map<VectorType>(point.get(), N, 1) = pos;
+
+    // count the neighbours first, then find them
+    const ANNdist sqRadius = radius * radius;
+    const int numNeighbours = m_kdTree->annkFRSearch(point.get(), sqRadius, 0,
+                                                     nullptr, nullptr, error);
+    auto nnIndexList = std::unique_ptr<ANNidx[]>(new ANNidx[numNeighbours]);
+    auto nnDistList = std::unique_ptr<ANNdist[]>(new ANNdist[numNeighbours]);
+    m_kdTree->annkFRSearch(point.get(), sqRadius, numNeighbours,
+                           nnIndexList.get(), nnDistList.get(), error);
+
+    return makeResults(static_cast<size_t>(numNeighbours),
+                       std::move(nnIndexList), std::move(nnDistList));
+  }
+
 private:
   /** Helper function to create a instance of NearestNeighbourResults
    *
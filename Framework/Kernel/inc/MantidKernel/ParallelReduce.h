@@ -0,0 +1,147 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_PARALLELREDUCE_H_
+#define MANTID_KERNEL_PARALLELREDUCE_H_
+
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** Reduce groups of items, such as the workspace indices of the spectra
+  summed into each output spectrum, with a parallel tree reduction.
+
+  Each group is split into chunks of at most chunkSize consecutive items, so
+  that a few large groups still keep every thread busy. The items of each
+  chunk are accumulated into a partial result. The partial results of each
+  group are then merged pairwise, in rounds, until one is left. The chunks,
+  and the merges of a round, run in parallel. A partial result is only ever
+  merged with the one of the items directly following its own, so the order
+  of the items is kept.
+
+  @param groups :: the items of each group
+  @param chunkSize :: the largest number of items accumulated by one task
+  @param parallel :: false to run serially, e.g. if the workspaces read by
+  the callbacks are not thread-safe
+  @param makePartial :: makePartial(group) returns an empty partial result
+  @param accumulate :: accumulate(partial, group, first, last) adds the
+  items in the range [first, last) of a group to a partial result
+  @param merge :: merge(partial, next) adds the partial result next to
+  partial. next is discarded afterwards, so it may be left in any state.
+  @param finish :: finish(group, result) is called, in parallel, with the
+  result of each group. It may take the contents of result.
+ */
+template <typename MakePartial, typename Accumulate, typename Merge,
+          typename Finish>
+void reduceGroups(const std::vector<std::vector<size_t>> &groups,
+                  const size_t chunkSize, const bool parallel,
+                  MakePartial makePartial, Accumulate accumulate, Merge merge,
+                  Finish finish) {
+  using Partial = decltype(makePartial(size_t()));
+  struct Chunk {
+    size_t group;
+    size_t begin;
+    size_t end;
+  };
+
+  // Split the groups into chunks, keeping at least one chunk for each group
+  const size_t step = std::max<size_t>(chunkSize, 1);
+  std::vector<Chunk> chunks;
+  std::vector<size_t> groupChunks(groups.size() + 1, 0);
+  for (size_t group = 0; group < groups.size(); ++group) {
+    groupChunks[group] = chunks.size();
+    const size_t size = groups[group].size();
+    size_t begin = 0;
+    do {
+      chunks.push_back({group, begin, std::min(begin + step, size)});
+      begin += step;
+    } while (begin < size);
+  }
+  groupChunks.back() = chunks.size();
+
+  std::vector<Partial> partials;
+  partials.reserve(chunks.size());
+  for (const auto &chunk : chunks)
+    partials.emplace_back(makePartial(chunk.group));
+
+  // Exceptions cannot leave a parallel region, rethrow the first one after it
+  std::exception_ptr error;
+  const auto numChunks = static_cast<int64_t>(chunks.size());
+  PRAGMA_OMP(parallel for schedule(dynamic, 1)
+             if (parallel && !inThreadPoolWorker()))
+  for (int64_t i = 0; i < numChunks; ++i) {
+    try {
+      const auto &chunk = chunks[i];
+      const auto &items = groups[chunk.group];
+      accumulate(partials[i], chunk.group, items.data() + chunk.begin,
+                 items.data() + chunk.end);
+    } catch (...) {
+      PARALLEL_CRITICAL(reduceGroups_error) {
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+  }
+  if (error)
+    std::rethrow_exception(error);
+
+  size_t maxGroupChunks = 0;
+  for (size_t group = 0; group < groups.size(); ++group)
+    maxGroupChunks = std::max(maxGroupChunks,
+                              groupChunks[group + 1] - groupChunks[group]);
+  for (size_t stride = 1; stride < maxGroupChunks; stride *= 2) {
+    std::vector<std::pair<size_t, size_t>> pairs;
+    for (size_t group = 0; group < groups.size(); ++group) {
+      for (size_t first = groupChunks[group];
+           first + stride < groupChunks[group + 1]; first += 2 * stride)
+        pairs.emplace_back(first, first + stride);
+    }
+    const auto numPairs = static_cast<int64_t>(pairs.size());
+    PRAGMA_OMP(parallel for schedule(dynamic, 1)
+               if (parallel && !inThreadPoolWorker()))
+    for (int64_t i = 0; i < numPairs; ++i) {
+      try {
+        merge(partials[pairs[i].first], partials[pairs[i].second]);
+        partials[pairs[i].second] = Partial();
+      } catch (...) {
+        PARALLEL_CRITICAL(reduceGroups_error) {
+          if (!error)
+            error = std::current_exception();
+        }
+      }
+    }
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  const auto numGroups = static_cast<int64_t>(groups.size());
+  PRAGMA_OMP(parallel for schedule(dynamic, 1)
+             if (parallel && !inThreadPoolWorker()))
+  for (int64_t group = 0; group < numGroups; ++group) {
+    try {
+      finish(static_cast<size_t>(group), partials[groupChunks[group]]);
+    } catch (...) {
+      PARALLEL_CRITICAL(reduceGroups_error) {
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+  }
+  if (error)
+    std::rethrow_exception(error);
+}
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_PARALLELREDUCE_H_ */
@@ -0,0 +1,106 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_PHILOX_H_
+#define MANTID_KERNEL_PHILOX_H_
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+#include "MantidKernel/PseudoRandomNumberGenerator.h"
+
+#include <array>
+#include <cstdint>
+
+namespace Mantid {
+namespace Kernel {
+/**
+  This implements the Philox4x32-10 counter-based pseudo-random number
+  generator (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+  SC11) as a specialization of the PseudoRandomNumberGenerator interface.
+
+  The numbers are a keyed function of their position in the sequence rather
+  than the result of updating an internal state. The seed selects the key and
+  the sequence is divided into 2^64 independent streams, each with 2^64
+  values. A Monte Carlo loop can therefore give each spectrum or task its own
+  stream, for example Philox(seed, workspaceIndex), and the results for a
+  seed do not depend on the number of threads or the order of the work.
+*/
+class MANTID_KERNEL_DLL Philox final : public PseudoRandomNumberGenerator {
+
+public:
+  /// The 128 bit counter
+  using Counter = std::array<uint32_t, 4>;
+  /// The 64 bit key
+  using Key = std::array<uint32_t, 2>;
+
+  /// Construct the generator with a seed and stream. The range is [0.0, 1.0)
+  explicit Philox(const size_t seedValue, const size_t stream = 0);
+  /// Construct the generator with a seed, stream and range.
+  Philox(const size_t seedValue, const size_t stream, const double start,
+         const double end);
+
+  Philox(const Philox &) = delete;
+  Philox &operator=(const Philox &) = delete;
+
+  /// Set the random number seed, restarting the current stream
+  void setSeed(const size_t seedValue) override;
+  /// Select the stream of the sequence and go to its start
+  void setStream(const size_t stream);
+  /// Sets the range of the subsequent calls to next
+  void setRange(const double start, const double end) override;
+  /// Generate the next random number in the sequence within the default range
+  inline double nextValue() override {
+    return m_start + (m_end - m_start) * nextUnitValue();
+  }
+  /// Generate the next random number in the sequence within the given range.
+  inline double nextValue(double start, double end) override {
+    return start + (end - start) * nextUnitValue();
+  }
+  /// Return the next integer in the sequence within the given range
+  int nextInt(int start, int end) override;
+  /// Resets the generator to the start of the current stream
+  void restart() override;
+  /// Saves the current position of the generator
+  void save() override;
+  /// Restores the generator to the last saved point, or the beginning if
+  /// nothing has been saved
+  void restore() override;
+  /// Return the minimum value of the range
+  double min() const override { return m_start; }
+  /// Return the maximum value of the range
+  double max() const override { return m_end; }
+
+  /// Apply the ten Philox rounds to a counter with the given key
+  static Counter block(Counter counter, Key key);
+
+private:
+  /// Return the next value in [0, 1) with 53 random bits
+  double nextUnitValue();
+
+  /// The key, derived from the seed
+  Key m_key;
+  /// The selected stream
+  uint64_t m_stream;
+  /// The number of values taken from the stream so far
+  uint64_t m_position;
+  /// The position saved by save()
+  uint64_t m_savedPosition;
+  /// The last block generated, each block gives two values
+  Counter m_block;
+  /// The index of m_block in the stream
+  uint64_t m_blockIndex;
+  /// True if m_block holds a block of the current key and stream
+  bool m_blockIsValid;
+  /// Minimum in range
+  double m_start;
+  /// Maximum in range
+  double m_end;
+};
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_PHILOX_H_ */
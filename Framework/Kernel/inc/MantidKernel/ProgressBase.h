@@ -51,12 +51,22 @@ public:
    */
   void report() {
     // This function was put inline for highest speed.
-    if (++m_i - m_last_reported < m_notifyStep)
+    if (!claimReport(m_i.fetch_add(1, std::memory_order_relaxed) + 1))
       return;
-    m_last_reported.store(m_i.load());
     this->doReport("");
   }
 
+  /** Increments the loop counter by 1, then sends the progress notification
+   * on behalf of its algorithm. A string literal is only turned into a string
+   * when a notification is actually sent.
+   * @param msg :: message string that will be displayed in GUI
+   */
+  template <size_t N> void report(const char (&msg)[N]) {
+    if (!claimReport(m_i.fetch_add(1, std::memory_order_relaxed) + 1))
+      return;
+    this->doReport(msg);
+  }
+
   void report(const std::string &msg);
   void report(int64_t i, const std::string &msg = "");
   void reportIncrement(int inc, const std::string &msg = "");
@@ -68,6 +78,21 @@ public:
   double getEstimatedTime() const;
 
 protected:
+  /** Decides whether the loop counter, now at i, is due a report. When
+   * several threads reach the next notification step together only one of
+   * them gets to send the notification.
+   * @param i :: The value the loop counter was moved to
+   * @return true if the caller should send the notification
+   */
+  bool claimReport(const int64_t i) {
+    auto last = m_last_reported.load(std::memory_order_relaxed);
+    while (i - last >= m_notifyStep) {
+      if (m_last_reported.compare_exchange_weak(last, i))
+        return true;
+    }
+    return false;
+  }
+
   /// Starting progress
   double m_start;
   /// Ending progress
@@ -45,9 +45,9 @@ public:
   /// get name of algorithm parameter const
   const std::string &name() const { return m_name; };
   /// get value of algorithm parameter const
-  const std::string &value() const { return m_value; };
+  const std::string &value() const { return *m_value; };
   /// set value of algorithm parameter
-  void setValue(const std::string &value) { m_value = value; };
+  void setValue(const std::string &value);
   /// get type of algorithm parameter const
   const std::string &type() const { return m_type; };
   /// get isdefault flag of algorithm parameter const
@@ -70,8 +70,9 @@ public:
 private:
   /// The name of the parameter
   std::string m_name;
-  /// The value of the parameter
-  std::string m_value;
+  /// The value of the parameter. Long values are shared between the
+  /// histories holding the same value.
+  boost::shared_ptr<const std::string> m_value;
   /// The type of the parameter
   std::string m_type;
   /// flag defining if the parameter is a default or a user-defined parameter
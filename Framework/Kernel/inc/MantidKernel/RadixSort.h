@@ -0,0 +1,187 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_RADIXSORT_H_
+#define MANTID_KERNEL_RADIXSORT_H_
+
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+/** Least-significant-digit radix sort on unsigned 64-bit keys.
+
+  The sort is stable, so several calls with keys of increasing significance
+  sort by a composite key, e.g. sorting by time-of-flight and then by pulse
+  time gives a list ordered by (pulse time, time-of-flight).
+
+  Keys are processed one byte at a time. All eight byte histograms are built
+  in a single pass over the data, and a byte is skipped entirely if all keys
+  share the same value for it, which is common for the high bytes of doubles
+  spanning a limited range. Lists of at least RADIX_SORT_PARALLEL_MIN_SIZE
+  elements are counted and scattered in parallel within the list, unless the
+  sort is already being called from a parallel region.
+*/
+namespace RadixSort {
+
+/// Lists at least this long are sorted with several threads
+constexpr size_t RADIX_SORT_PARALLEL_MIN_SIZE = 1 << 20;
+
+/** Map a double onto an unsigned integer with the same ordering
+ * @param value :: the double to map. NaN is ordered after infinity.
+ * @return an unsigned key
+ */
+inline uint64_t doubleKey(const double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const uint64_t signBit = uint64_t(1) << 63;
+  return (bits & signBit) ? ~bits : (bits | signBit);
+}
+
+/** Map a signed 64-bit integer onto an unsigned integer with the same ordering
+ * @param value :: the integer to map.
+ * @return an unsigned key
+ */
+inline uint64_t int64Key(const int64_t value) {
+  return static_cast<uint64_t>(value) ^ (uint64_t(1) << 63);
+}
+
+namespace detail {
+using Histogram = std::array<size_t, 256>;
+
+inline unsigned digit(const uint64_t key, const unsigned byte) {
+  return static_cast<unsigned>((key >> (8 * byte)) & 0xff);
+}
+
+/// Scatter one pass from src to dst using the keys of src.
+template <class T>
+void scatterPass(const std::vector<T> &src, std::vector<T> &dst,
+                 const std::vector<uint64_t> &srcKeys,
+                 std::vector<uint64_t> &dstKeys, const unsigned byte,
+                 const int numChunks) {
+  const size_t size = src.size();
+  const size_t chunkSize = size / numChunks;
+  std::vector<Histogram> counts(numChunks);
+
+  PARALLEL_FOR_IF(numChunks > 1)
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    Histogram &local = counts[chunk];
+    local.fill(0);
+    const size_t begin = chunk * chunkSize;
+    const size_t end = chunk == numChunks - 1 ? size : begin + chunkSize;
+    for (size_t i = begin; i < end; ++i)
+      ++local[digit(srcKeys[i], byte)];
+  }
+
+  // Turn the counts into output offsets, bucket-major then chunk
+  size_t offset = 0;
+  for (size_t bucket = 0; bucket < 256; ++bucket) {
+    for (int chunk = 0; chunk < numChunks; ++chunk) {
+      const size_t count = counts[chunk][bucket];
+      counts[chunk][bucket] = offset;
+      offset += count;
+    }
+  }
+
+  PARALLEL_FOR_IF(numChunks > 1)
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    Histogram &position = counts[chunk];
+    const size_t begin = chunk * chunkSize;
+    const size_t end = chunk == numChunks - 1 ? size : begin + chunkSize;
+    for (size_t i = begin; i < end; ++i) {
+      const size_t target = position[digit(srcKeys[i], byte)]++;
+      dst[target] = src[i];
+      dstKeys[target] = srcKeys[i];
+    }
+  }
+}
+} // namespace detail
+
+/** Sort a vector in place by an unsigned 64-bit key.
+ * @param values :: the vector to sort
+ * @param key :: function returning the uint64_t key of an element
+ * @param scratch :: buffer used for the intermediate passes. It is resized as
+ * needed; passing the same buffer to many sorts avoids repeated allocations.
+ */
+template <class T, class KeyFunction>
+void sort(std::vector<T> &values, KeyFunction key, std::vector<T> &scratch) {
+  const size_t size = values.size();
+  if (size < 2)
+    return;
+
+  std::vector<uint64_t> keys(size);
+  for (size_t i = 0; i < size; ++i)
+    keys[i] = key(values[i]);
+
+  // One pass to find which bytes actually discriminate between the keys
+  std::array<detail::Histogram, 8> histograms;
+  for (auto &histogram : histograms)
+    histogram.fill(0);
+  for (const auto k : keys) {
+    for (unsigned byte = 0; byte < 8; ++byte)
+      ++histograms[byte][detail::digit(k, byte)];
+  }
+  std::vector<unsigned> passes;
+  for (unsigned byte = 0; byte < 8; ++byte) {
+    const auto &histogram = histograms[byte];
+    if (std::find(histogram.cbegin(), histogram.cend(), size) ==
+        histogram.cend())
+      passes.push_back(byte);
+  }
+  if (passes.empty())
+    return;
+
+  int numChunks = 1;
+  if (size >= RADIX_SORT_PARALLEL_MIN_SIZE && PARALLEL_NUMBER_OF_THREADS == 1)
+    numChunks = PARALLEL_GET_MAX_THREADS;
+
+  scratch.resize(size);
+  std::vector<uint64_t> scratchKeys(size);
+  std::vector<T> *src = &values;
+  std::vector<T> *dst = &scratch;
+  std::vector<uint64_t> *srcKeys = &keys;
+  std::vector<uint64_t> *dstKeys = &scratchKeys;
+  for (const auto byte : passes) {
+    detail::scatterPass(*src, *dst, *srcKeys, *dstKeys, byte, numChunks);
+    std::swap(src, dst);
+    std::swap(srcKeys, dstKeys);
+  }
+  // After an odd number of passes the result is in the scratch buffer. It is
+  // copied back rather than swapped, so that the capacity of a large scratch
+  // buffer is not handed to the caller's list, nor that of the list kept as
+  // the scratch buffer.
+  if (src != &values)
+    std::copy(scratch.begin(), scratch.begin() + size, values.begin());
+}
+
+/** Sort a vector in place by an unsigned 64-bit key, using a scratch buffer
+ * private to the calling thread. The buffer is kept between calls so that
+ * sorting many lists of similar size allocates only once per thread; it is
+ * released when it grows beyond maxScratchBytes.
+ * @param values :: the vector to sort
+ * @param key :: function returning the uint64_t key of an element
+ * @param maxScratchBytes :: capacity above which the scratch buffer is freed
+ * after the sort
+ */
+template <class T, class KeyFunction>
+void sort(std::vector<T> &values, KeyFunction key,
+          const size_t maxScratchBytes = 64 * 1024 * 1024) {
+  static thread_local std::vector<T> scratch;
+  sort(values, key, scratch);
+  if (scratch.capacity() * sizeof(T) > maxScratchBytes)
+    std::vector<T>().swap(scratch);
+}
+
+} // namespace RadixSort
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_RADIXSORT_H_ */
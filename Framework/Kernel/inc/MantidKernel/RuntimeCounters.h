@@ -0,0 +1,74 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_RUNTIMECOUNTERS_H_
+#define MANTID_KERNEL_RUNTIMECOUNTERS_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/SingletonHolder.h"
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Mantid {
+namespace Kernel {
+
+/** RuntimeCounters : named counters that the framework adds to as it runs,
+  such as the number of event lists sorted or of algorithms executed, to
+  monitor a session or a reduction service over time.
+
+  A counter is created the first time it is asked for and is never removed,
+  so hot code can keep a reference to it and pay a single relaxed atomic add
+  per update:
+  @code
+  static auto &sorts = RuntimeCounters::Instance().counter("eventlist_sorts");
+  sorts.fetch_add(1, std::memory_order_relaxed);
+  @endcode
+
+  Counter names may carry Prometheus labels, e.g.
+  algorithm_executions{algorithm="Rebin"}. All counters can be read with
+  values() or written in the Prometheus text format with writePrometheus().
+*/
+class MANTID_KERNEL_DLL RuntimeCountersImpl {
+public:
+  using Counter = std::atomic<uint64_t>;
+
+  RuntimeCountersImpl(const RuntimeCountersImpl &) = delete;
+  RuntimeCountersImpl &operator=(const RuntimeCountersImpl &) = delete;
+
+  Counter &counter(const std::string &name);
+  void add(const std::string &name, const uint64_t amount = 1);
+  uint64_t value(const std::string &name) const;
+  std::map<std::string, uint64_t> values() const;
+  void reset();
+  void writePrometheus(std::ostream &out) const;
+  std::string prometheus() const;
+
+private:
+  friend struct Mantid::Kernel::CreateUsingNew<RuntimeCountersImpl>;
+
+  RuntimeCountersImpl() = default;
+  ~RuntimeCountersImpl() = default;
+
+  /// The counters by name. They are held by pointer so that references to
+  /// them stay valid as counters are added.
+  std::map<std::string, std::unique_ptr<Counter>> m_counters;
+  mutable std::mutex m_mutex;
+};
+
+EXTERN_MANTID_KERNEL template class MANTID_KERNEL_DLL
+    Mantid::Kernel::SingletonHolder<RuntimeCountersImpl>;
+using RuntimeCounters = Mantid::Kernel::SingletonHolder<RuntimeCountersImpl>;
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_RUNTIMECOUNTERS_H_ */
@@ -78,10 +78,26 @@ public:
    */
   void setMutex(boost::shared_ptr<std::mutex> &mutex) { m_mutex = mutex; }
 
+  //---------------------------------------------------------------------------------------------
+  /** Get the priority of this Task. Schedulers supporting priorities run
+   * the tasks of higher priority first, whatever their cost.
+   * @return the priority, 0 by default
+   */
+  int priority() const { return m_priority; }
+
+  //---------------------------------------------------------------------------------------------
+  /** Set the priority of this Task
+   * @param priority :: the priority; higher values run first
+   */
+  void setPriority(const int priority) { m_priority = priority; }
+
 protected:
   /// Cached computational cost for the thread.
   double m_cost;
 
+  /// Priority of the task
+  int m_priority{0};
+
   /// Mutex associated with this task (can be NULL)
   boost::shared_ptr<std::mutex> m_mutex;
 };
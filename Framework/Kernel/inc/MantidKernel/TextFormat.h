@@ -0,0 +1,103 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_TEXTFORMAT_H_
+#define MANTID_KERNEL_TEXTFORMAT_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+/** NumberFormat : appends numbers to text as an std::ostream with the same
+  precision, floatfield and width would write them, without going through a
+  stream.
+
+  The numbers are formatted by the C library, which follows the numeric
+  locale set up by the FrameworkManager.
+*/
+class MANTID_KERNEL_DLL NumberFormat {
+public:
+  /// How the numbers are written, as the floatfield of a stream
+  enum class Notation { General, Fixed, Scientific };
+
+  NumberFormat(int precision = 6, Notation notation = Notation::General,
+               int width = 0);
+
+  /// Append a floating point number to the text
+  void append(std::string &text, double value) const;
+  /// Append an integer to the text, ignoring the precision and notation
+  void append(std::string &text, int64_t value) const;
+  /// @return the text of a floating point number
+  std::string format(double value) const;
+
+private:
+  /// The printf format of floating point numbers
+  const char *m_format;
+  int m_precision;
+  int m_width;
+};
+
+/// Parse the whole of a text as a floating point number
+MANTID_KERNEL_DLL bool parseNumber(const std::string &text, double &value);
+
+/**
+ * Write the text of a number of items to a stream in order. The text of a
+ * block of items is formatted in parallel, and then written as the next
+ * block is formatted, so that only a block of text is held at once.
+ * @param out :: The stream to write to
+ * @param count :: The number of items
+ * @param formatItem :: Called with the index of an item and the (empty) text
+ * to append its text to. It is called by several threads at once.
+ * @param itemWritten :: Called with the index of each item once its text has
+ * been written, in order and from the calling thread
+ * @throws the first exception thrown by formatItem
+ */
+template <typename FormatItem, typename ItemWritten>
+void writeInParallel(std::ostream &out, const size_t count,
+                     const FormatItem &formatItem,
+                     const ItemWritten &itemWritten) {
+  // Enough items for every thread to take several, few enough to keep the
+  // text of a block small
+  const size_t blockSize =
+      64 * static_cast<size_t>(std::max(PARALLEL_GET_MAX_THREADS, 1));
+  std::vector<std::string> texts(std::min(blockSize, count));
+  std::exception_ptr error;
+  for (size_t first = 0; first < count; first += blockSize) {
+    const auto last = static_cast<int64_t>(std::min(first + blockSize, count));
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = static_cast<int64_t>(first); i < last; ++i) {
+      auto &text = texts[static_cast<size_t>(i) - first];
+      text.clear();
+      try {
+        formatItem(static_cast<size_t>(i), text);
+      } catch (...) {
+        PARALLEL_CRITICAL(writeInParallel_error)
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+    if (error)
+      std::rethrow_exception(error);
+    for (size_t i = first; i < static_cast<size_t>(last); ++i) {
+      const auto &text = texts[i - first];
+      out.write(text.data(), static_cast<std::streamsize>(text.size()));
+      itemWritten(i);
+    }
+  }
+}
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_TEXTFORMAT_H_ */
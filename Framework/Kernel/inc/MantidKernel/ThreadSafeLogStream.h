@@ -32,9 +32,9 @@ namespace Kernel {
 
    This class implements a threadsafe version of the POCO buffer interface to a
    Logger's stream object. The
-   buffer uses OpenMP API calls to both protect shared memory from access by
-   multiple threads and updates
-   log messages is such a way that they are not mangled by separate threads.
+   buffer keeps the partial message of each thread in storage local to that
+   thread, so log messages are not mangled by separate threads and writing
+   to the stream takes no locks.
 
    @author Martyn Gigg, Tessella Support Services plc
    @date 13/04/2010
@@ -49,15 +49,13 @@ public:
   int overflow(char c);
   using Poco::LogStreamBuf::overflow;
 
+protected:
+  /// Write a block of characters, sending each completed line to the logger
+  std::streamsize xsputn(const char *s, std::streamsize count) override;
+
 private:
   /// Overridden fron base to write to the device in a thread-safe manner.
   int writeToDevice(char c) override;
-
-private:
-  /// Store a map of thread indices to messages
-  std::map<Poco::Thread::TID, std::string> m_messages;
-  /// mutex protecting logstream
-  std::mutex m_mutex;
 };
 
 /**
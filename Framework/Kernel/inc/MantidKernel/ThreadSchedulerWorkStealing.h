@@ -0,0 +1,113 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : a ThreadScheduler keeping one queue per
+  worker thread instead of a single locked queue.
+
+  - A task pushed from a worker thread of the pool goes to the queue of that
+    worker; tasks pushed from other threads are spread over the queues in
+    turn. Each worker pops from its own queue and only steals from the queues
+    of the others once its own is empty, so that pushing and popping many
+    small tasks from many threads does not contend on a single lock.
+  - Each queue is ordered by Task::priority() first and Task::cost() second:
+    workers, and thieves, always take the task of highest priority and then
+    largest cost, keeping the largest-cost-first ordering of
+    ThreadSchedulerLargestCost within each queue.
+  - A task can be pushed with dependencies: it is only queued once all of
+    them have finished.
+
+  The scheduler only reports empty once every task has finished, since a
+  running task may release its dependents or push new tasks.
+*/
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numWorkers = 0);
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(std::shared_ptr<Task> newTask) override;
+  void push(std::shared_ptr<Task> newTask,
+            const std::vector<std::shared_ptr<Task>> &dependencies);
+  std::shared_ptr<Task> pop(size_t threadnum) override;
+  void finished(Task *task, size_t threadnum) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override;
+  double totalCost() override;
+
+  /// @return the number of worker queues
+  size_t numWorkers() const { return m_queues.size(); }
+
+private:
+  /// Tasks waiting for their dependencies to finish
+  struct WaitingTask {
+    WaitingTask(std::shared_ptr<Task> waitingTask, const size_t count)
+        : task(std::move(waitingTask)), remaining(count) {}
+    std::shared_ptr<Task> task;
+    /// Number of dependencies left to finish, plus one while being pushed
+    std::atomic<size_t> remaining;
+  };
+
+  /// The queue of one worker
+  struct WorkerQueue {
+    /// Tasks ordered by priority and cost
+    std::multimap<std::pair<int, double>, std::shared_ptr<Task>> tasks;
+    /// Total cost of the tasks
+    double cost{0.};
+    std::mutex mutex;
+  };
+
+  /// Bookkeeping of the tasks that have not finished yet, split in shards
+  /// by task address
+  struct TaskShard {
+    /// Tasks pushed and not finished yet
+    std::unordered_set<const Task *> unfinished;
+    /// Tasks waiting on each unfinished task
+    std::unordered_map<const Task *, std::vector<std::shared_ptr<WaitingTask>>>
+        dependents;
+    std::mutex mutex;
+  };
+
+  void enqueue(std::shared_ptr<Task> task);
+  std::shared_ptr<Task> takeFrom(WorkerQueue &queue);
+  void release(WaitingTask &waiting);
+  TaskShard &shardOf(const Task *task);
+
+  /// One queue per worker
+  std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+  /// Shards of the unfinished tasks
+  std::vector<std::unique_ptr<TaskShard>> m_shards;
+  /// Queue receiving the next task pushed from outside the workers
+  std::atomic<size_t> m_nextQueue{0};
+  /// Tasks queued
+  std::atomic<size_t> m_numQueued{0};
+  /// Tasks waiting for their dependencies
+  std::atomic<size_t> m_numWaiting{0};
+  /// Tasks pushed and not finished yet: queued, waiting or running
+  std::atomic<size_t> m_numUnfinished{0};
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_ */
@@ -261,6 +261,10 @@ public:
               const std::vector<double> &time_sec,
               const std::vector<TYPE> &new_values);
   /// Clears and creates a TimeSeriesProperty from these parameters
+  void create(const Types::Core::DateAndTime &start_time,
+              const std::vector<int64_t> &time_nanoseconds,
+              const std::vector<TYPE> &new_values);
+  /// Clears and creates a TimeSeriesProperty from these parameters
   void create(const std::vector<Types::Core::DateAndTime> &new_times,
               const std::vector<TYPE> &new_values);
 
@@ -317,6 +321,9 @@ private:
   //----------------------------------------------------------------------------------------------
   /// Saves the time vector has time + start attribute
   void saveTimeVector(::NeXus::File *file);
+  /// Clears and fills the property with values at the given times
+  template <typename TimeAt>
+  void createFromTimes(TimeAt timeAt, const std::vector<TYPE> &new_values);
   /// Sort the property into increasing times, if not already sorted
   void sortIfNecessary() const;
   ///  Find the index of the entry of time t in the mP vector (sorted)
@@ -330,10 +337,12 @@ private:
   size_t findNthIndexFromQuickRef(int n) const;
   /// Set a value from another property
   std::string setValueFromProperty(const Property &right) override;
-  /// Find if time lies in a filtered region
-  bool isTimeFiltered(const Types::Core::DateAndTime &time) const;
   /// Time weighted mean and standard deviation
   std::pair<double, double> timeAverageValueAndStdDev() const;
+  /// Append a block of entries already sorted by time
+  void appendSortedRange(
+      typename std::vector<TimeValueUnit<TYPE>>::const_iterator first,
+      typename std::vector<TimeValueUnit<TYPE>>::const_iterator last);
 
   /// Holds the time series data
   mutable std::vector<TimeValueUnit<TYPE>> m_values;
@@ -9,6 +9,9 @@
 
 #include "MantidKernel/DateAndTime.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace Mantid {
 namespace Kernel {
 
@@ -70,6 +73,38 @@ MANTID_KERNEL_DLL TimeSplitterType operator|(const TimeSplitterType &a,
                                              const TimeSplitterType &b);
 MANTID_KERNEL_DLL TimeSplitterType operator~(const TimeSplitterType &a);
 
+/**
+ * An index of a splitter for finding the destination of many times, such as
+ * the pulse times of events. The splitter is stored as its sorted boundaries
+ * in nanoseconds and the destination of the time between each consecutive
+ * pair of boundaries, which is -1 in the gaps between intervals. A lookup is
+ * a binary search over the boundaries, so it takes O(log n) time for a
+ * splitter with n intervals.
+ *
+ * The intervals of the splitter must not overlap, which is the case for the
+ * splitters made by GenerateEventsFilter, FilterByLogValue and
+ * SplittersWorkspace.
+ */
+class MANTID_KERNEL_DLL TimeSplitterIndex {
+public:
+  TimeSplitterIndex() = default;
+  explicit TimeSplitterIndex(const TimeSplitterType &splitter);
+
+  /// Returns true if the index holds no intervals
+  bool empty() const { return m_times.empty(); }
+  int destination(const Types::Core::DateAndTime &time) const;
+  int destination(const int64_t time) const;
+  /// The boundaries of the intervals and gaps, in nanoseconds
+  const std::vector<int64_t> &times() const { return m_times; }
+  /// The destination between each pair of boundaries, -1 for a gap
+  const std::vector<int> &destinations() const { return m_destinations; }
+  TimeSplitterType splitter() const;
+
+private:
+  std::vector<int64_t> m_times;
+  std::vector<int> m_destinations;
+};
+
 } // Namespace Kernel
 } // Namespace Mantid
 
@@ -0,0 +1,133 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_TRACERECORDER_H_
+#define MANTID_KERNEL_TRACERECORDER_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/SingletonHolder.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** TraceRecorder : records a timeline of what the framework runs, as spans
+  with a name, a category, a start, a duration and the thread they ran in,
+  and writes it in the Chrome trace event format. The file can be opened in
+  chrome://tracing or https://ui.perfetto.dev to see nested algorithms, child
+  algorithms and ThreadPool tasks as a flame graph per thread.
+
+  Recording is off by default and costs a single atomic load per span while
+  off. It is switched on at startup by setting the "tracing.file"
+  configuration key to the file to write, which is written when the framework
+  exits, or at any time with enable().
+
+  Spans are recorded with the RAII class TraceSpan:
+  @code
+  TraceSpan span("MyLoop", "omp");
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (...)
+  @endcode
+*/
+class MANTID_KERNEL_DLL TraceRecorderImpl {
+public:
+  using Clock = std::chrono::steady_clock;
+  /// Extra information attached to a span, shown by the viewers
+  using Args = std::vector<std::pair<std::string, std::string>>;
+
+  TraceRecorderImpl(const TraceRecorderImpl &) = delete;
+  TraceRecorderImpl &operator=(const TraceRecorderImpl &) = delete;
+
+  void enable(const std::string &filename = "");
+  void disable();
+  /// @return true if spans are being recorded
+  bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+  void addSpan(std::string name, const char *category, Clock::time_point start,
+               Clock::time_point end, Args args = Args());
+  void addCounter(std::string name, double value);
+
+  size_t size() const;
+  void clear();
+  void write(std::ostream &out) const;
+  bool save() const;
+
+private:
+  friend struct Mantid::Kernel::CreateUsingNew<TraceRecorderImpl>;
+
+  TraceRecorderImpl();
+  ~TraceRecorderImpl();
+
+  /// A recorded event
+  struct Event {
+    std::string name;
+    const char *category;
+    /// 'X' for a span, 'C' for a counter
+    char phase;
+    unsigned thread;
+    /// Start in microseconds since the recorder was created
+    int64_t start;
+    /// Duration in microseconds
+    int64_t duration;
+    Args args;
+  };
+
+  unsigned threadIndex(std::thread::id id);
+
+  std::atomic<bool> m_enabled{false};
+  /// Where save() writes the trace
+  std::string m_filename;
+  /// Time of the first timestamp of the trace
+  const Clock::time_point m_origin;
+  /// The events recorded, limited to a maximum number
+  std::vector<Event> m_events;
+  /// Events not recorded since the maximum was reached
+  size_t m_dropped{0};
+  /// Small numbers for the threads seen
+  std::unordered_map<std::thread::id, unsigned> m_threads;
+  mutable std::mutex m_mutex;
+};
+
+EXTERN_MANTID_KERNEL template class MANTID_KERNEL_DLL
+    Mantid::Kernel::SingletonHolder<TraceRecorderImpl>;
+using TraceRecorder = Mantid::Kernel::SingletonHolder<TraceRecorderImpl>;
+
+/** TraceSpan : records a span of the TraceRecorder from its construction to
+  its destruction, if recording was on when it was constructed. The category
+  must be a string literal.
+*/
+class MANTID_KERNEL_DLL TraceSpan {
+public:
+  TraceSpan(std::string name, const char *category);
+  TraceSpan(const TraceSpan &) = delete;
+  TraceSpan &operator=(const TraceSpan &) = delete;
+  ~TraceSpan();
+  /// @return true if the span will be recorded
+  bool active() const { return m_active; }
+  void addArg(const std::string &key, const std::string &value);
+
+private:
+  bool m_active;
+  std::string m_name;
+  const char *m_category;
+  TraceRecorderImpl::Clock::time_point m_start;
+  TraceRecorderImpl::Args m_args;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_TRACERECORDER_H_ */
@@ -168,6 +168,22 @@ public:
    */
   virtual double singleFromTOF(const double tof) const = 0;
 
+  /** Convert an array of X values to TOF in place. The unit must have been
+   * initialized. The default calls singleToTOF() on each value; units with
+   * a simple conversion override it with a loop free of virtual calls that
+   * the compiler can vectorize.
+   * @param first :: pointer to the first value
+   * @param last :: pointer past the last value
+   */
+  virtual void toTOFRange(double *first, double *last) const;
+
+  /** Convert an array of TOF values to this unit in place. The unit must
+   * have been initialized. See toTOFRange().
+   * @param first :: pointer to the first value
+   * @param last :: pointer past the last value
+   */
+  virtual void fromTOFRange(double *first, double *last) const;
+
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
@@ -288,6 +304,8 @@ public:
   void init() override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void toTOFRange(double *first, double *last) const override;
+  void fromTOFRange(double *first, double *last) const override;
   Unit *clone() const override;
   ///@return -DBL_MAX as ToF convertible to TOF for in any time range
   double conversionTOFMin() const override;
@@ -305,6 +323,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void toTOFRange(double *first, double *last) const override;
+  void fromTOFRange(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -379,6 +399,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void toTOFRange(double *first, double *last) const override;
+  void fromTOFRange(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -429,6 +451,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void toTOFRange(double *first, double *last) const override;
+  void fromTOFRange(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -474,6 +498,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void toTOFRange(double *first, double *last) const override;
+  void fromTOFRange(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -559,6 +585,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void toTOFRange(double *first, double *last) const override;
+  void fromTOFRange(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -578,6 +606,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void toTOFRange(double *first, double *last) const override;
+  void fromTOFRange(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
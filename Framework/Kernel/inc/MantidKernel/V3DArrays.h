@@ -0,0 +1,69 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_V3DARRAYS_H_
+#define MANTID_KERNEL_V3DARRAYS_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/V3D.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+class Quat;
+template <typename T> class Matrix;
+
+/** V3DArrays : Holds many 3-vectors as three arrays of coordinates (a
+  structure of arrays) rather than as an array of V3D objects.
+
+  The batch operations on all vectors, such as rotating them or finding their
+  distances to a point, run as plain loops over the coordinate arrays that
+  the compiler can vectorise. Up to rounding, they give the same results as
+  the equivalent V3D, Quat and Matrix operations applied to each vector.
+*/
+class MANTID_KERNEL_DLL V3DArrays {
+public:
+  V3DArrays() = default;
+  explicit V3DArrays(const size_t size);
+  explicit V3DArrays(const std::vector<V3D> &vectors);
+
+  /// Returns the number of vectors
+  size_t size() const { return m_x.size(); }
+  /// Returns true if there are no vectors
+  bool empty() const { return m_x.empty(); }
+  void resize(const size_t size);
+  void reserve(const size_t size);
+  void push_back(const V3D &vector);
+
+  /// Returns the i-th vector
+  V3D operator[](const size_t i) const { return V3D(m_x[i], m_y[i], m_z[i]); }
+  void set(const size_t i, const V3D &vector);
+
+  /// The x coordinates of all vectors
+  const std::vector<double> &x() const { return m_x; }
+  /// The y coordinates of all vectors
+  const std::vector<double> &y() const { return m_y; }
+  /// The z coordinates of all vectors
+  const std::vector<double> &z() const { return m_z; }
+
+  void rotate(const Quat &rotation);
+  void multiply(const Matrix<double> &matrix);
+  void distances(const V3D &point, std::vector<double> &result) const;
+  void distancesToLines(const V3D &point, std::vector<double> &result) const;
+
+private:
+  void applyMatrix(const double (&matrix)[3][3]);
+
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_V3DARRAYS_H_ */
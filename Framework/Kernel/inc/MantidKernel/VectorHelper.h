@@ -38,6 +38,12 @@ void MANTID_KERNEL_DLL rebin(const std::vector<double> &xold,
                              std::vector<double> &enew, bool distribution,
                              bool addition = false);
 
+void MANTID_KERNEL_DLL rebin(const double *xold, const double *yold,
+                             const double *eold, const size_t size_yold,
+                             const double *xnew, double *ynew, double *enew,
+                             const size_t size_ynew, bool distribution,
+                             bool addition = false);
+
 // New method to rebin Histogram data, should be faster than previous one
 void MANTID_KERNEL_DLL rebinHistogram(const std::vector<double> &xold,
                                       const std::vector<double> &yold,
@@ -46,6 +52,46 @@ void MANTID_KERNEL_DLL rebinHistogram(const std::vector<double> &xold,
                                       std::vector<double> &ynew,
                                       std::vector<double> &enew, bool addition);
 
+void MANTID_KERNEL_DLL rebinHistogram(const double *xold, const double *yold,
+                                      const double *eold,
+                                      const size_t size_yold,
+                                      const double *xnew, double *ynew,
+                                      double *enew, const size_t size_ynew,
+                                      bool addition);
+
+/** RebinOverlaps holds how the bins of one set of bin edges overlap with
+  those of another. Finding them once lets many histograms that share the
+  same bin edges, such as the spectra of a workspace with common bins, be
+  rebinned without walking the bin edges again for each one. The rebinning
+  matches rebinHistogram.
+*/
+class MANTID_KERNEL_DLL RebinOverlaps {
+public:
+  RebinOverlaps(const std::vector<double> &xold,
+                const std::vector<double> &xnew);
+
+  void rebinHistogram(const double *yold, const double *eold, double *ynew,
+                      double *enew, bool addition = false) const;
+  void rebinHistogram(const std::vector<double> &yold,
+                      const std::vector<double> &eold,
+                      std::vector<double> &ynew, std::vector<double> &enew,
+                      bool addition = false) const;
+
+private:
+  /// The fraction of an old bin that falls in a new bin
+  struct Overlap {
+    size_t oldIndex;
+    size_t newIndex;
+    double fraction;
+  };
+  /// The number of old bins
+  size_t m_sizeYOld;
+  /// The number of new bins
+  size_t m_sizeYNew;
+  /// The overlaps, in the order of the old and new bins
+  std::vector<Overlap> m_overlaps;
+};
+
 /// Convert an array of bin boundaries to bin center values.
 void MANTID_KERNEL_DLL convertToBinCentre(const std::vector<double> &bin_edges,
                                           std::vector<double> &bin_centres);
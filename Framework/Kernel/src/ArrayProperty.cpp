@@ -9,6 +9,8 @@
 // PropertyWithValue Definition
 #include "MantidKernel/PropertyWithValue.tcc"
 
+#include <boost/algorithm/string/trim.hpp>
+
 namespace Mantid {
 namespace Kernel {
 /** Constructor
@@ -89,16 +91,49 @@ template <typename T> std::string ArrayProperty<T>::value() const {
   return PropertyWithValue<std::vector<T>>::value();
 }
 
-/** Sets the values stored in the ArrayProperty from a string representation
+/** Sets the values stored in the ArrayProperty from a string representation.
+ *  The values parsed from the most recently used strings are cached, so that
+ *  algorithms run many times with the same values, e.g. the Params of Rebin,
+ *  do not parse them again.
  *  @param value :: The values to assign to the property, given as a
  * comma-separated list
- *  @return True if the assignment was successful
+ *  @return Returns "" if the assignment was successful or a user level
+ * description of the problem
  */
 template <typename T>
 std::string ArrayProperty<T>::setValue(const std::string &value) {
-  // Implemented this method for documentation reasons. Just calls base class
-  // method.
-  return PropertyWithValue<std::vector<T>>::setValue(value);
+  auto &cache = parsedValues();
+  auto parsed = cache.find(value);
+  if (!parsed) {
+    std::string valueCopy = value;
+    if (this->autoTrim()) {
+      boost::trim(valueCopy);
+    }
+    auto result = std::make_shared<std::vector<T>>();
+    try {
+      toValue(valueCopy, *result);
+    } catch (std::exception &) {
+      // Let the base class describe the problem
+      return PropertyWithValue<std::vector<T>>::setValue(value);
+    }
+    parsed = std::move(result);
+    if (value.size() <= MAX_CACHED_LENGTH)
+      cache.insert(value, parsed);
+  }
+
+  try {
+    *this = *parsed;
+    return "";
+  } catch (std::invalid_argument &except) {
+    return except.what();
+  }
+}
+
+/// @return the cache of the values parsed from strings for this type
+template <typename T>
+LRUCache<std::string, std::vector<T>> &ArrayProperty<T>::parsedValues() {
+  static LRUCache<std::string, std::vector<T>> cache(CACHE_SIZE);
+  return cache;
 }
 
 template <typename T> void ArrayProperty<T>::visualStudioC4661Workaround() {}
@@ -59,6 +59,7 @@
 #include <functional>
 #include <iostream>
 #include <stdexcept>
+#include <unordered_map>
 #include <utility>
 
 #ifdef __APPLE__
@@ -109,8 +110,105 @@ std::vector<std::string> splitPath(const std::string &path) {
   return splitted;
 }
 
+/**
+ * Convert a configuration value as ConfigServiceImpl::getValue does.
+ * @param value The string value of the property
+ * @returns The converted value, or none if the conversion failed
+ */
+template <typename T>
+boost::optional<T> convertValue(const std::string &value) {
+  T output;
+  if (Mantid::Kernel::Strings::convert(value, output) != 1) {
+    return boost::none;
+  }
+  return output;
+}
+
+/**
+ * Convert a configuration value to a boolean. "true", "1" and "on" count as
+ * true, in any case and ignoring surrounding whitespace.
+ * @param value The string value of the property
+ * @returns The converted value, or none if the value is not a single word
+ */
+boost::optional<bool> convertToBool(const std::string &value) {
+  auto returnedValue = convertValue<std::string>(value);
+  if (!returnedValue.is_initialized()) {
+    return boost::none;
+  }
+
+  auto &configVal = returnedValue.get();
+
+  std::transform(configVal.begin(), configVal.end(), configVal.begin(),
+                 ::tolower);
+
+  boost::trim(configVal);
+
+  bool trueString = configVal == "true";
+  bool valueOne = configVal == "1";
+  bool onOffString = configVal == "on";
+
+  // A string of 1 or true both count
+  return trueString || valueOne || onOffString;
+}
+
 } // end of anonymous namespace
 
+/** A property value held in the snapshot, together with its conversions to
+ *  the types getValue is used with. They are converted once, when the
+ *  property is first read, so repeated reads only cost a hash lookup.
+ */
+struct ConfigServiceImpl::CachedValue {
+  explicit CachedValue(boost::optional<std::string> value)
+      : found(value.is_initialized()), string(value.value_or("")),
+        asString(convertValue<std::string>(string)),
+        asInt(convertValue<int>(string)), asSize(convertValue<size_t>(string)),
+        asDouble(convertValue<double>(string)),
+        asBool(convertToBool(string)) {}
+
+  template <typename T> const boost::optional<T> &as() const;
+
+  /// True if the property exists
+  const bool found;
+  /// The value returned by getString, empty if the property does not exist
+  const std::string string;
+  const boost::optional<std::string> asString;
+  const boost::optional<int> asInt;
+  const boost::optional<size_t> asSize;
+  const boost::optional<double> asDouble;
+  const boost::optional<bool> asBool;
+};
+
+/// \cond TEMPLATE
+template <>
+const boost::optional<std::string> &
+ConfigServiceImpl::CachedValue::as() const {
+  return asString;
+}
+template <>
+const boost::optional<int> &ConfigServiceImpl::CachedValue::as() const {
+  return asInt;
+}
+template <>
+const boost::optional<size_t> &ConfigServiceImpl::CachedValue::as() const {
+  return asSize;
+}
+template <>
+const boost::optional<double> &ConfigServiceImpl::CachedValue::as() const {
+  return asDouble;
+}
+template <>
+const boost::optional<bool> &ConfigServiceImpl::CachedValue::as() const {
+  return asBool;
+}
+/// \endcond TEMPLATE
+
+/** The property values read since the configuration last changed. A snapshot
+ *  is never modified once it is published: adding a value copies it.
+ */
+struct ConfigServiceImpl::Snapshot {
+  std::unordered_map<std::string, std::shared_ptr<const CachedValue>> values;
+};
+
 /** Inner templated class to wrap the poco library objects that have protected
  *  destructors and expose them as public.
  */
@@ -430,6 +528,7 @@ void ConfigServiceImpl::loadConfig(const std::string &filename,
   m_pConf =
       std::make_unique<WrappedObject<Poco::Util::PropertyFileConfiguration>>(
           istr);
+  clearSnapshot();
 }
 
 /**
@@ -492,6 +591,7 @@ void ConfigServiceImpl::convertRelativeToAbsolute() {
     value = makeAbsolute(value, key);
     m_AbsolutePaths.emplace(key, value);
   }
+  clearSnapshot();
 }
 
 /**
@@ -894,6 +994,32 @@ void ConfigServiceImpl::saveConfig(const std::string &filename) const {
  */
 std::string ConfigServiceImpl::getString(const std::string &keyName,
                                          bool use_cache) const {
+  if (use_cache) {
+    const auto value = cachedValue(keyName);
+    if (value->found) {
+      return value->string;
+    }
+  } else if (auto value = lookUpString(keyName, use_cache)) {
+    return value.get();
+  }
+
+  g_log.debug() << "Unable to find " << keyName << " in the properties file"
+                << '\n';
+  return {};
+}
+
+/** Searches for a string within the currently loaded configuration values,
+ *  without going through the snapshot.
+ *
+ *  @param keyName :: The case sensitive name of the property
+ *  @param use_cache :: If true, the local cache of directory names is queried
+ *first.
+ *  @returns The string value of the property, or none if the key cannot be
+ *found
+ */
+boost::optional<std::string>
+ConfigServiceImpl::lookUpString(const std::string &keyName,
+                                bool use_cache) const {
   if (use_cache) {
     auto mitr = m_AbsolutePaths.find(keyName);
     if (mitr != m_AbsolutePaths.end()) {
@@ -903,10 +1029,47 @@ std::string ConfigServiceImpl::getString(const std::string &keyName,
   if (m_pConf->hasProperty(keyName)) {
     return m_pConf->getString(keyName);
   }
+  return boost::none;
+}
 
-  g_log.debug() << "Unable to find " << keyName << " in the properties file"
-                << '\n';
-  return {};
+/** Returns the value of a property from the snapshot. Reading a property that
+ *  is already in the snapshot takes no lock. Otherwise, the property is looked
+ *  up in the configuration and published in a new snapshot that also holds
+ *  the values read before.
+ *
+ *  @param keyName :: The case sensitive name of the property
+ *  @returns The snapshot entry for the property
+ */
+std::shared_ptr<const ConfigServiceImpl::CachedValue>
+ConfigServiceImpl::cachedValue(const std::string &keyName) const {
+  auto snapshot = std::atomic_load(&m_snapshot);
+  if (snapshot) {
+    const auto entry = snapshot->values.find(keyName);
+    if (entry != snapshot->values.end()) {
+      return entry->second;
+    }
+  }
+
+  // The lookup is done while holding the lock so that a value read before a
+  // change to the configuration cannot be published after clearSnapshot.
+  std::lock_guard<std::mutex> lock(m_snapshotMutex);
+  snapshot = std::atomic_load(&m_snapshot);
+  auto updated = snapshot ? std::make_shared<Snapshot>(*snapshot)
+                          : std::make_shared<Snapshot>();
+  auto &value = updated->values[keyName];
+  if (!value) {
+    value = std::make_shared<const CachedValue>(lookUpString(keyName, true));
+  }
+  auto result = value;
+  std::atomic_store(&m_snapshot,
+                    std::shared_ptr<const Snapshot>(std::move(updated)));
+  return result;
+}
+
+/// Discards the snapshot, so that values are read from the configuration again
+void ConfigServiceImpl::clearSnapshot() const {
+  std::lock_guard<std::mutex> lock(m_snapshotMutex);
+  std::atomic_store(&m_snapshot, std::shared_ptr<const Snapshot>());
 }
 
 /** Searches for keys within the currently loaded configuaration values and
@@ -973,6 +1136,7 @@ std::vector<std::string> ConfigServiceImpl::keys() const {
  */
 void ConfigServiceImpl::remove(const std::string &rootName) const {
   m_pConf->remove(rootName);
+  clearSnapshot();
   m_changed_keys.insert(rootName);
 }
 
@@ -1048,6 +1212,7 @@ void ConfigServiceImpl::setString(const std::string &key,
   std::map<std::string, bool>::const_iterator itr = m_ConfigPaths.find(key);
   if (itr != m_ConfigPaths.end()) {
     m_AbsolutePaths[key] = makeAbsolute(value, key);
+    clearSnapshot();
   }
 
   if (key == "datasearch.directories") {
@@ -1061,6 +1226,7 @@ void ConfigServiceImpl::setString(const std::string &key,
   }
 
   m_pConf->setString(key, value);
+  clearSnapshot();
 
   m_notificationCenter.postNotification(new ValueChanged(key, value, old));
   m_changed_keys.insert(key);
@@ -1075,44 +1241,7 @@ void ConfigServiceImpl::setString(const std::string &key,
  */
 template <typename T>
 boost::optional<T> ConfigServiceImpl::getValue(const std::string &keyName) {
-  std::string strValue = getString(keyName);
-  T output;
-  int result = Mantid::Kernel::Strings::convert(strValue, output);
-
-  if (result != 1) {
-    return boost::none;
-  }
-
-  return boost::optional<T>(output);
-}
-
-/** Searches for a string within the currently loaded configuration values and
- *  attempts to convert the values to a boolean value
- *
- *  @param keyName :: The case sensitive name of the property that you need the
- *value of.
- *  @returns An optional container with the value if found
- */
-template <>
-boost::optional<bool> ConfigServiceImpl::getValue(const std::string &keyName) {
-  auto returnedValue = getValue<std::string>(keyName);
-  if (!returnedValue.is_initialized()) {
-    return boost::none;
-  }
-
-  auto &configVal = returnedValue.get();
-
-  std::transform(configVal.begin(), configVal.end(), configVal.begin(),
-                 ::tolower);
-
-  boost::trim(configVal);
-
-  bool trueString = configVal == "true";
-  bool valueOne = configVal == "1";
-  bool onOffString = configVal == "on";
-
-  // A string of 1 or true both count
-  return trueString || valueOne || onOffString;
+  return cachedValue(keyName)->as<T>();
 }
 
 /**
@@ -2082,10 +2211,8 @@ template DLLExport boost::optional<int>
 ConfigServiceImpl::getValue(const std::string &);
 template DLLExport boost::optional<size_t>
 ConfigServiceImpl::getValue(const std::string &);
-#ifdef _MSC_VER
 template DLLExport boost::optional<bool>
 ConfigServiceImpl::getValue(const std::string &);
-#endif
 
 /// \endcond TEMPLATE
 
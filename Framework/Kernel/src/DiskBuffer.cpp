@@ -6,14 +6,28 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidKernel/DiskBuffer.h"
 #include "MantidKernel/ISaveable.h"
+#include "MantidKernel/RuntimeCounters.h"
+#include <algorithm>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 using namespace Mantid::Kernel;
 
 namespace Mantid {
 namespace Kernel {
 
+namespace {
+/// Count an object written to the file in the runtime counters
+void countSave(const uint64_t size) {
+  static auto &saves = RuntimeCounters::Instance().counter("diskbuffer_saves");
+  static auto &savedSize =
+      RuntimeCounters::Instance().counter("diskbuffer_saved_size");
+  saves.fetch_add(1, std::memory_order_relaxed);
+  savedSize.fetch_add(size, std::memory_order_relaxed);
+}
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
@@ -116,14 +130,23 @@ void DiskBuffer::writeOldObjects() {
   size_t objectsNotWritten(0);
   size_t memoryNotWritten(0);
 
-  // Iterate through the list
-  auto it = m_toWriteBuffer.begin();
-  auto it_end = m_toWriteBuffer.end();
+  // Write the objects already on file in the order of their positions, so
+  // that neighbouring blocks are written one after the other instead of in
+  // random order. Objects not saved yet go after them, in the buffer order.
+  std::vector<ISaveable *> objects(m_toWriteBuffer.cbegin(),
+                                   m_toWriteBuffer.cend());
+  std::stable_sort(objects.begin(), objects.end(),
+                   [](const ISaveable *a, const ISaveable *b) {
+                     if (!b->wasSaved())
+                       return a->wasSaved();
+                     return a->wasSaved() &&
+                            a->getFilePosition() < b->getFilePosition();
+                   });
 
   ISaveable *obj = nullptr;
 
-  for (; it != it_end; ++it) {
-    obj = *it;
+  for (auto object : objects) {
+    obj = object;
     if (!obj->isBusy()) {
       uint64_t NumObjEvents = obj->getTotalDataSize();
       uint64_t fileIndexStart;
@@ -132,6 +155,7 @@ void DiskBuffer::writeOldObjects() {
         // Write to the disk; this will call the object specific save function;
         // Prevent simultaneous file access (e.g. write while loading)
         obj->saveAt(fileIndexStart, NumObjEvents);
+        countSave(NumObjEvents);
       } else {
         uint64_t NumFileEvents = obj->getFileSize();
         if (NumObjEvents != NumFileEvents) {
@@ -142,6 +166,7 @@ void DiskBuffer::writeOldObjects() {
           // Write to the disk; this will call the object specific save
           // function;
           obj->saveAt(fileIndexStart, NumObjEvents);
+          countSave(NumObjEvents);
         } else // despite object size have not been changed, it can be modified
                // other way. In this case, the method which changed the data
                // should set dataChanged ID
@@ -151,6 +176,7 @@ void DiskBuffer::writeOldObjects() {
             // Write to the disk; this will call the object specific save
             // function;
             obj->saveAt(fileIndexStart, NumObjEvents);
+            countSave(NumObjEvents);
             // this is questionable operation, which adjust file size in case
             // when the file postions were allocated externaly
             if (fileIndexStart + NumObjEvents > m_fileLength)
@@ -10,6 +10,7 @@
 #include "MantidKernel/UnitFactory.h"
 
 #include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <stdexcept>
 
@@ -95,6 +96,42 @@ double Interpolation::value(const double &at) const {
   }
 }
 
+/** Get interpolated values at many locations, as the single value version
+ * does for each of them. Locations in ascending order are interpolated in a
+ * single walk along the interpolation points.
+ * @param at :: Locations where to get interpolated values
+ * @param result :: [Output] The values, resized to the number of locations
+ */
+void Interpolation::value(const std::vector<double> &at,
+                          std::vector<double> &result) const {
+  const size_t N = m_x.size();
+  result.resize(at.size());
+  if (N < 2) {
+    std::transform(at.cbegin(), at.cend(), result.begin(),
+                   [this](const double x) { return value(x); });
+    return;
+  }
+
+  // Index of the upper end of the current segment
+  size_t idx = 1;
+  for (size_t i = 0; i < at.size(); ++i) {
+    const double x = at[i];
+    if (x < m_x[0] || x >= m_x[N - 1] || std::isnan(x)) {
+      result[i] = value(x);
+      continue;
+    }
+    if (x < m_x[idx - 1]) {
+      // Not in ascending order: search all of the segments again
+      idx = findIndexOfNextLargerValue(m_x, x);
+    } else {
+      while (m_x[idx] <= x)
+        ++idx;
+    }
+    result[i] = m_y[idx - 1] + (x - m_x[idx - 1]) * (m_y[idx] - m_y[idx - 1]) /
+                                   (m_x[idx] - m_x[idx - 1]);
+  }
+}
+
 /** Add point in the interpolation.
  *
  * @param xx :: x-value
@@ -40,6 +40,7 @@ int LibraryManagerImpl::openLibraries(
     const std::string &filepath, LoadLibraries loadingBehaviour,
     const std::vector<std::string> &excludes) {
   g_log.debug("Opening all libraries in " + filepath + "\n");
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
   try {
     return openLibraries(Poco::File(filepath), loadingBehaviour, excludes);
   } catch (std::exception &exc) {
@@ -52,6 +53,114 @@ int LibraryManagerImpl::openLibraries(
   }
 }
 
+/**
+ * Finds the libraries on a given path that would be opened by openLibraries.
+ *  @param filepath The filepath to the directory where the libraries are.
+ *  @param loadingBehaviour Control how libraries are searched for
+ *  @param excludes If not empty then each string is considered as a substring
+ * to search within each library to be opened. If the substring is found then
+ * the library is skipped.
+ *  @return The full paths of the libraries found.
+ */
+std::vector<std::string> LibraryManagerImpl::findLibraries(
+    const std::string &filepath, LoadLibraries loadingBehaviour,
+    const std::vector<std::string> &excludes) const {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  std::vector<std::string> libraries;
+  try {
+    findLibraries(Poco::File(filepath), loadingBehaviour, excludes, libraries);
+  } catch (std::exception &exc) {
+    g_log.debug() << "Error occurred while finding libraries: " << exc.what()
+                  << "\n";
+  }
+  return libraries;
+}
+
+/**
+ * Opens a single library, unless it has been opened already.
+ *  @param filepath The full path to the library
+ *  @return 1 if the library was opened, 0 otherwise
+ */
+int LibraryManagerImpl::openLibrary(const std::string &filepath) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  const Poco::Path path(filepath);
+  const auto filename = path.getFileName();
+  if (isLoaded(filename))
+    return 0;
+  if (isDeferred(filename))
+    return openDeferredLibrary(filename);
+  return openLibrary(Poco::File(path), filename);
+}
+
+/**
+ * Registers a library to be opened only once one of its entries, e.g. the
+ * name of an algorithm it registers, is requested through
+ * openLibraryProviding. A library that provides no entries is opened now.
+ *  @param filepath The full path to the library
+ *  @param entries The entries provided by the library
+ */
+void LibraryManagerImpl::deferLibrary(const std::string &filepath,
+                                      const std::vector<std::string> &entries) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  const auto filename = Poco::Path(filepath).getFileName();
+  if (isLoaded(filename) || isDeferred(filename))
+    return;
+  if (entries.empty()) {
+    openLibrary(Poco::File(filepath), filename);
+    return;
+  }
+  m_deferredLibs.emplace(filename, filepath);
+  for (const auto &entry : entries)
+    m_deferredEntries.emplace(entry, filename);
+}
+
+/**
+ * Opens the deferred library providing an entry.
+ *  @param entry The entry, as given to deferLibrary
+ *  @return True if a library was opened
+ */
+bool LibraryManagerImpl::openLibraryProviding(const std::string &entry) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  const auto it = m_deferredEntries.find(entry);
+  if (it == m_deferredEntries.end())
+    return false;
+  return openDeferredLibrary(it->second) == 1;
+}
+
+/**
+ * Opens the deferred libraries providing entries starting with a prefix,
+ * e.g. every library providing algorithms before listing them.
+ *  @param prefix The start of the entries
+ *  @return The number of libraries opened
+ */
+int LibraryManagerImpl::openLibrariesProviding(const std::string &prefix) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  std::vector<std::string> filenames;
+  for (auto entry = m_deferredEntries.lower_bound(prefix);
+       entry != m_deferredEntries.end() &&
+       entry->first.compare(0, prefix.size(), prefix) == 0;
+       ++entry)
+    filenames.emplace_back(entry->second);
+  int libCount(0);
+  for (const auto &filename : filenames) {
+    if (isDeferred(filename))
+      libCount += openDeferredLibrary(filename);
+  }
+  return libCount;
+}
+
+/**
+ * Locks the factories filled by the static registrations of the libraries,
+ * e.g. the AlgorithmFactory. Opening a library holds the same lock, so a
+ * factory read under it never sees a library registering its entries.
+ *  @return The lock, which is recursive so that entries found under it can be
+ * created
+ */
+std::unique_lock<std::recursive_mutex>
+LibraryManagerImpl::lockFactories() const {
+  return std::unique_lock<std::recursive_mutex>(m_mutex);
+}
+
 //-------------------------------------------------------------------------
 // Private members
 //-------------------------------------------------------------------------
@@ -69,7 +178,33 @@ int LibraryManagerImpl::openLibraries(
     const Poco::File &libpath,
     LibraryManagerImpl::LoadLibraries loadingBehaviour,
     const std::vector<std::string> &excludes) {
+  std::vector<std::string> libraries;
+  findLibraries(libpath, loadingBehaviour, excludes, libraries);
   int libCount(0);
+  for (const auto &library : libraries) {
+    // A library of the same name may have been opened from another directory
+    const Poco::Path path(library);
+    if (!isLoaded(path.getFileName()))
+      libCount += openLibrary(Poco::File(path), path.getFileName());
+  }
+  return libCount;
+}
+
+/**
+ * Finds suitable DLLs on a given path.
+ *  @param libpath A Poco::File object pointing to a directory where the
+ * libraries are.
+ *  @param loadingBehaviour Control how libraries are searched for
+ *  @param excludes If not empty then each string is considered as a substring
+ * to search within each library to be opened. If the substring is found then
+ * the library is skipped.
+ *  @param libraries The full paths of the libraries found are appended here
+ */
+void LibraryManagerImpl::findLibraries(
+    const Poco::File &libpath,
+    LibraryManagerImpl::LoadLibraries loadingBehaviour,
+    const std::vector<std::string> &excludes,
+    std::vector<std::string> &libraries) const {
   if (libpath.exists() && libpath.isDirectory()) {
     // Iterate over the available files
     Poco::DirectoryIterator end_itr;
@@ -77,19 +212,16 @@ int LibraryManagerImpl::openLibraries(
       const Poco::File &item = *itr;
       if (item.isFile()) {
         if (shouldBeLoaded(itr.path().getFileName(), excludes))
-          libCount += openLibrary(itr.path(), itr.path().getFileName());
-        else
-          continue;
+          libraries.emplace_back(itr.path().toString());
       } else if (loadingBehaviour == LoadLibraries::Recursive) {
         // it must be a directory
-        libCount += openLibraries(item, LoadLibraries::Recursive, excludes);
+        findLibraries(item, LoadLibraries::Recursive, excludes, libraries);
       }
     }
   } else {
     g_log.error("In OpenAllLibraries: " + libpath.path() +
                 " must be a directory.");
   }
-  return libCount;
 }
 
 /**
@@ -103,8 +235,8 @@ int LibraryManagerImpl::openLibraries(
 bool LibraryManagerImpl::shouldBeLoaded(
     const std::string &filename,
     const std::vector<std::string> &excludes) const {
-  return !isLoaded(filename) && DllOpen::isValidFilename(filename) &&
-         !isExcluded(filename, excludes);
+  return !isLoaded(filename) && !isDeferred(filename) &&
+         DllOpen::isValidFilename(filename) && !isExcluded(filename, excludes);
 }
 
 /**
@@ -116,6 +248,15 @@ bool LibraryManagerImpl::isLoaded(const std::string &filename) const {
   return m_openedLibs.find(filename) != m_openedLibs.cend();
 }
 
+/**
+ * Check if the library has been deferred until one of its entries is needed
+ * @param filename The filename of the library, i.e no directory
+ * @return True if the library has been deferred and not opened yet
+ */
+bool LibraryManagerImpl::isDeferred(const std::string &filename) const {
+  return m_deferredLibs.find(filename) != m_deferredLibs.cend();
+}
+
 /**
  * Returns true if the name contains one of the strings given in the
  * exclude list. Each string from the variable is
@@ -159,5 +300,27 @@ int LibraryManagerImpl::openLibrary(const Poco::File &filepath,
     return 0;
 }
 
+/**
+ * Open a deferred library, forgetting its entries whether or not it opens
+ * @param filename The filename of the library, i.e no directory
+ * @return 1 if the file loaded successfully, 0 otherwise
+ */
+int LibraryManagerImpl::openDeferredLibrary(const std::string &filename) {
+  const auto it = m_deferredLibs.find(filename);
+  if (it == m_deferredLibs.end())
+    return 0;
+  const Poco::File filepath(it->second);
+  m_deferredLibs.erase(it);
+  for (auto entry = m_deferredEntries.begin();
+       entry != m_deferredEntries.end();) {
+    if (entry->second == filename)
+      entry = m_deferredEntries.erase(entry);
+    else
+      ++entry;
+  }
+  g_log.debug("Opening deferred library " + filepath.path() + ".\n");
+  return openLibrary(filepath, filename);
+}
+
 } // namespace Kernel
 } // namespace Mantid
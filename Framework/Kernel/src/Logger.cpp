@@ -7,7 +7,6 @@
 #include "MantidKernel/Logger.h"
 
 #include <Poco/Logger.h>
-#include <Poco/NullStream.h>
 
 #include <algorithm>
 #include <exception>
@@ -17,8 +16,13 @@
 namespace Mantid {
 namespace Kernel {
 namespace {
-// We only need a single NullStream object
-Poco::NullOutputStream NULL_STREAM;
+/// A stream without a buffer, so it is always in a failed state and anything
+/// streamed into it is discarded before being formatted. Each thread has its
+/// own so that the stream state is never shared.
+std::ostream &nullStream() {
+  thread_local std::ostream stream(nullptr);
+  return stream;
+}
 } // namespace
 
 static const std::string PriorityNames_data[] = {
@@ -155,6 +159,17 @@ void Logger::dump(const std::string &msg, const void *buffer,
   }
 }
 
+/** Returns true if a message of the given priority would be logged, taking
+ * into account whether the logger is enabled and its level offset. Use it to
+ * skip building messages that would be discarded, e.g. through the
+ * MANTID_LOG_DEBUG macro.
+ *  @param priority :: The priority of the message
+ *  @return true if the message would be logged
+ */
+bool Logger::willLog(const Priority priority) const {
+  return m_enabled && m_log->is(applyLevelOffset(priority));
+}
+
 /** Returns true if at least the given log level is set.
  *  @param level :: The logging level it is best to use the Logger::Priority
  * enum (7=debug, 6=information, 4=warning, 3=error, 2=critical, 1=fatal)
@@ -331,9 +346,14 @@ void Logger::log(const std::string &message, Logger::Priority priority) {
  */
 std::ostream &Logger::getLogStream(Logger::Priority priority) {
   if (!m_enabled)
-    return NULL_STREAM;
+    return nullStream();
+
+  const auto level = applyLevelOffset(priority);
+  // Messages the logger would drop are not even formatted
+  if (!m_log->is(level))
+    return nullStream();
 
-  switch (applyLevelOffset(priority)) {
+  switch (level) {
   case Poco::Message::PRIO_FATAL:
     return m_logStream->fatal();
     break;
@@ -356,7 +376,7 @@ std::ostream &Logger::getLogStream(Logger::Priority priority) {
     return m_logStream->debug();
     break;
   default:
-    return NULL_STREAM;
+    return nullStream();
   }
 }
 
@@ -365,7 +385,8 @@ std::ostream &Logger::getLogStream(Logger::Priority priority) {
  * @param proposedLevel :: The proposed level
  * @returns The offseted level
  */
-Logger::Priority Logger::applyLevelOffset(Logger::Priority proposedLevel) {
+Logger::Priority
+Logger::applyLevelOffset(Logger::Priority proposedLevel) const {
   int retVal = proposedLevel;
   // fast exit is offset is 0
   if (m_levelOffset == 0) {
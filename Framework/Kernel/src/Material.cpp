@@ -10,6 +10,7 @@
 #include <NeXusFile.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/make_shared.hpp>
+#include <mutex>
 #include <numeric>
 
 namespace Mantid {
@@ -51,8 +52,72 @@ inline double scatteringXS(const double realLength, const double imagLength) {
     return .04 * M_PI * lengthSqrd;
   }
 }
+
+/**
+ * Get the total scattering cross section following Sears eqn 13.
+ */
+double calculateTotalScatterXSection(const Material::ChemicalFormula &formula,
+                                     const double atomTotal) {
+  if (formula.size() == 1)
+    return formula.front().atom->neutron.tot_scatt_xs;
+
+  const double weightedTotal =
+      std::accumulate(std::begin(formula), std::end(formula), 0.,
+                      [](double subtotal, const Material::FormulaUnit &right) {
+                        return subtotal + right.atom->neutron.tot_scatt_xs *
+                                              right.multiplicity;
+                      }) /
+      atomTotal;
+
+  if (!std::isnormal(weightedTotal)) {
+    return 0.;
+  } else {
+    return weightedTotal;
+  }
+}
+
+/**
+ * Get the absorption cross section at NeutronAtom::ReferenceLambda according
+ * to Sears eqn 14.
+ */
+double calculateAbsorbXSection(const Material::ChemicalFormula &formula,
+                               const double atomTotal) {
+  double weightedTotal;
+
+  if (formula.size() == 1) {
+    weightedTotal = formula.front().atom->neutron.abs_scatt_xs;
+  } else {
+    weightedTotal =
+        std::accumulate(std::begin(formula), std::end(formula), 0.,
+                        [](double subtotal,
+                           const Material::FormulaUnit &right) {
+                          return subtotal + right.atom->neutron.abs_scatt_xs *
+                                                right.multiplicity;
+                        }) /
+        atomTotal;
+  }
+
+  if (!std::isnormal(weightedTotal)) {
+    return 0.;
+  } else {
+    return weightedTotal;
+  }
+}
 } // namespace
 
+/**
+ * The cross sections needed for the attenuation, which only depend on the
+ * chemical formula. They are summed over the formula units on first use, so
+ * algorithms tracing many neutrons through a sample only pay for it once, and
+ * are shared between copies of the material.
+ */
+struct Material::XSectionCache {
+  std::once_flag computed;
+  double totalScatter = 0.;
+  /// Absorption cross section at NeutronAtom::ReferenceLambda
+  double absorbAtReference = 0.;
+};
+
 Mantid::Kernel::Material::FormulaUnit::FormulaUnit(
     const boost::shared_ptr<PhysicalConstants::Atom> &atom,
     const double multiplicity)
@@ -68,7 +133,8 @@ Mantid::Kernel::Material::FormulaUnit::FormulaUnit(
  */
 Material::Material()
     : m_name(), m_chemicalFormula(), m_atomTotal(0.0), m_numberDensity(0.0),
-      m_temperature(0.0), m_pressure(0.0) {}
+      m_temperature(0.0), m_pressure(0.0),
+      m_xSections(std::make_shared<XSectionCache>()) {}
 
 /**
  * Construct a material object
@@ -82,7 +148,8 @@ Material::Material(const std::string &name, const ChemicalFormula &formula,
                    const double numberDensity, const double temperature,
                    const double pressure)
     : m_name(name), m_atomTotal(0.0), m_numberDensity(numberDensity),
-      m_temperature(temperature), m_pressure(pressure) {
+      m_temperature(temperature), m_pressure(pressure),
+      m_xSections(std::make_shared<XSectionCache>()) {
   m_chemicalFormula.assign(formula.begin(), formula.end());
   this->countAtoms();
 }
@@ -101,7 +168,7 @@ Material::Material(const std::string &name,
                    const double pressure)
     : m_name(name), m_chemicalFormula(), m_atomTotal(1.0),
       m_numberDensity(numberDensity), m_temperature(temperature),
-      m_pressure(pressure) {
+      m_pressure(pressure), m_xSections(std::make_shared<XSectionCache>()) {
   if (atom.z_number == 0) { // user specified atom
     m_chemicalFormula.emplace_back(atom, 1.);
   } else if (atom.a_number > 0) { // single isotope
@@ -120,6 +187,20 @@ void Material::countAtoms() {
                                 });
 }
 
+/**
+ * @returns The cross sections derived from the chemical formula, computing
+ * them if this is the first time they are needed
+ */
+const Material::XSectionCache &Material::xSections() const {
+  std::call_once(m_xSections->computed, [this]() {
+    m_xSections->totalScatter =
+        calculateTotalScatterXSection(m_chemicalFormula, m_atomTotal);
+    m_xSections->absorbAtReference =
+        calculateAbsorbXSection(m_chemicalFormula, m_atomTotal);
+  });
+  return *m_xSections;
+}
+
 /**
  * Returns the name
  * @returns A string containing the name of the material
@@ -178,23 +259,7 @@ double Material::incohScatterXSection() const {
  * @returns The value of the total scattering cross section.
  */
 double Material::totalScatterXSection() const {
-  if (m_chemicalFormula.size() == 1)
-    return m_chemicalFormula.front().atom->neutron.tot_scatt_xs;
-
-  const double weightedTotal =
-      std::accumulate(std::begin(m_chemicalFormula),
-                      std::end(m_chemicalFormula), 0.,
-                      [](double subtotal, const FormulaUnit &right) {
-                        return subtotal + right.atom->neutron.tot_scatt_xs *
-                                              right.multiplicity;
-                      }) /
-      m_atomTotal;
-
-  if (!std::isnormal(weightedTotal)) {
-    return 0.;
-  } else {
-    return weightedTotal;
-  }
+  return xSections().totalScatter;
 }
 
 /**
@@ -209,26 +274,8 @@ double Material::totalScatterXSection() const {
  * the given wavelength
  */
 double Material::absorbXSection(const double lambda) const {
-  double weightedTotal;
-
-  if (m_chemicalFormula.size() == 1) {
-    weightedTotal = m_chemicalFormula.front().atom->neutron.abs_scatt_xs;
-  } else {
-    weightedTotal =
-        std::accumulate(std::begin(m_chemicalFormula),
-                        std::end(m_chemicalFormula), 0.,
-                        [](double subtotal, const FormulaUnit &right) {
-                          return subtotal + right.atom->neutron.abs_scatt_xs *
-                                                right.multiplicity;
-                        }) /
-        m_atomTotal;
-  }
-
-  if (!std::isnormal(weightedTotal)) {
-    return 0.;
-  } else {
-    return weightedTotal * (lambda / NeutronAtom::ReferenceLambda);
-  }
+  return xSections().absorbAtReference *
+         (lambda / NeutronAtom::ReferenceLambda);
 }
 
 /**
@@ -238,8 +285,11 @@ double Material::absorbXSection(const double lambda) const {
  * @return The dimensionless attenuation coefficient
  */
 double Material::attenuation(const double distance, const double lambda) const {
+  const auto &xs = xSections();
   return exp(-100 * numberDensity() *
-             (totalScatterXSection() + absorbXSection(lambda)) * distance);
+             (xs.totalScatter +
+              xs.absorbAtReference * (lambda / NeutronAtom::ReferenceLambda)) *
+             distance);
 }
 
 // NOTE: the angstrom^-2 to barns and the angstrom^-1 to cm^-1
@@ -553,6 +603,7 @@ void Material::loadNexus(::NeXus::File *file, const std::string &group) {
         "Only know how to read version 1 or 2 for Material");
   }
   this->countAtoms();
+  m_xSections = std::make_shared<XSectionCache>();
 
   file->readData("number_density", m_numberDensity);
   file->readData("temperature", m_temperature);
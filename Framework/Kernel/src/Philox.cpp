@@ -0,0 +1,160 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+#include "MantidKernel/Philox.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// Round multipliers
+constexpr uint64_t PHILOX_M0 = 0xD2511F53;
+constexpr uint64_t PHILOX_M1 = 0xCD9E8D57;
+/// Key schedule constants (golden ratio and sqrt(3) - 1)
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+/// Number of rounds
+constexpr int PHILOX_ROUNDS = 10;
+
+uint32_t low(uint64_t value) { return static_cast<uint32_t>(value); }
+uint32_t high(uint64_t value) { return static_cast<uint32_t>(value >> 32); }
+} // namespace
+
+//------------------------------------------------------------------------------
+// Public member functions
+//------------------------------------------------------------------------------
+
+/**
+ * Constructor taking a seed value and a stream. Sets the range to [0.0,1.0)
+ * @param seedValue :: The initial seed
+ * @param stream :: The stream to draw the numbers from
+ */
+Philox::Philox(const size_t seedValue, const size_t stream)
+    : Philox(seedValue, stream, 0.0, 1.0) {}
+
+/**
+ * Constructor taking a seed value, a stream and a range
+ * @param seedValue :: The initial seed
+ * @param stream :: The stream to draw the numbers from
+ * @param start :: The minimum value a generated number should take
+ * @param end :: The upper limit of the generated numbers
+ */
+Philox::Philox(const size_t seedValue, const size_t stream, const double start,
+               const double end)
+    : m_key(), m_stream(stream), m_position(0), m_savedPosition(0), m_block(),
+      m_blockIndex(0), m_blockIsValid(false), m_start(start), m_end(end) {
+  setSeed(seedValue);
+}
+
+/**
+ * (Re-)seed the generator. This goes back to the start of the current stream
+ * and resets the saved position.
+ * @param seedValue :: A seed for the generator
+ */
+void Philox::setSeed(const size_t seedValue) {
+  const auto seed = static_cast<uint64_t>(seedValue);
+  m_key = {{low(seed), high(seed)}};
+  m_blockIsValid = false;
+  restart();
+  save();
+}
+
+/**
+ * Select a stream. This goes back to the start of the stream and resets the
+ * saved position.
+ * @param stream :: The index of the stream
+ */
+void Philox::setStream(const size_t stream) {
+  m_stream = static_cast<uint64_t>(stream);
+  m_blockIsValid = false;
+  restart();
+  save();
+}
+
+/**
+ * Sets the range of the subsequent calls to nextValue()
+ * @param start :: The lowest value a call to nextValue() will produce
+ * @param end :: The upper limit of the values nextValue() will produce
+ */
+void Philox::setRange(const double start, const double end) {
+  m_start = start;
+  m_end = end;
+}
+
+/**
+ * Returns the next integer in the pseudo-random sequence.
+ * @param start Start of the requested range
+ * @param end End of the requested range, inclusive
+ * @return An integer in the defined range
+ */
+int Philox::nextInt(int start, int end) {
+  const double range = static_cast<double>(end) - static_cast<double>(start);
+  const auto offset = std::floor(nextUnitValue() * (range + 1.0));
+  return std::min(end, start + static_cast<int>(offset));
+}
+
+/// Resets the generator to the start of the current stream
+void Philox::restart() { m_position = 0; }
+
+/// Saves the current position of the generator
+void Philox::save() { m_savedPosition = m_position; }
+
+/// Restores the generator to the last saved point, or the beginning if nothing
+/// has been saved
+void Philox::restore() { m_position = m_savedPosition; }
+
+/**
+ * Apply the Philox4x32-10 bijection to a counter.
+ * @param counter :: The counter to encrypt
+ * @param key :: The key to encrypt it with
+ * @return The four random 32 bit words for this counter and key
+ */
+Philox::Counter Philox::block(Counter counter, Key key) {
+  for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+    const uint64_t product0 = PHILOX_M0 * counter[0];
+    const uint64_t product1 = PHILOX_M1 * counter[2];
+    counter = {{high(product1) ^ counter[1] ^ key[0], low(product1),
+                high(product0) ^ counter[3] ^ key[1], low(product0)}};
+    key[0] += PHILOX_W0;
+    key[1] += PHILOX_W1;
+  }
+  return counter;
+}
+
+//------------------------------------------------------------------------------
+// Private member functions
+//------------------------------------------------------------------------------
+
+/**
+ * Each block gives two values. The counter of a block is its index in the
+ * stream in the lower and the stream in the upper 64 bits.
+ * @return The next value of the stream, in [0, 1)
+ */
+double Philox::nextUnitValue() {
+  const uint64_t blockIndex = m_position / 2;
+  if (!m_blockIsValid || blockIndex != m_blockIndex) {
+    m_block = block({{low(blockIndex), high(blockIndex), low(m_stream),
+                      high(m_stream)}},
+                    m_key);
+    m_blockIndex = blockIndex;
+    m_blockIsValid = true;
+  }
+  const size_t word = 2 * static_cast<size_t>(m_position % 2);
+  ++m_position;
+  // Take 27 + 26 bits to fill the mantissa of a double
+  const auto upper = static_cast<double>(m_block[word] >> 5);
+  const auto lower = static_cast<double>(m_block[word + 1] >> 6);
+  return (upper * 67108864.0 + lower) * (1.0 / 9007199254740992.0);
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -88,9 +88,8 @@ ProgressBase::~ProgressBase() {}
  * @param msg :: message string that will be displayed in GUI, for example
  */
 void ProgressBase::report(const std::string &msg) {
-  if (++m_i - m_last_reported < m_notifyStep)
+  if (!claimReport(m_i.fetch_add(1, std::memory_order_relaxed) + 1))
     return;
-  m_last_reported.store(m_i.load());
   this->doReport(msg);
 }
 
@@ -104,9 +103,8 @@ void ProgressBase::report(const std::string &msg) {
 void ProgressBase::report(int64_t i, const std::string &msg) {
   // Set the loop coutner to the spot specified.
   m_i = i;
-  if (m_i - m_last_reported < m_notifyStep)
+  if (!claimReport(i))
     return;
-  m_last_reported.store(m_i.load());
   this->doReport(msg);
 }
 
@@ -119,10 +117,9 @@ void ProgressBase::report(int64_t i, const std::string &msg) {
 */
 void ProgressBase::reportIncrement(int inc, const std::string &msg) {
   // Increment the loop counter
-  m_i += int64_t(inc);
-  if (m_i - m_last_reported < m_notifyStep)
+  if (!claimReport(m_i.fetch_add(int64_t(inc), std::memory_order_relaxed) +
+                   int64_t(inc)))
     return;
-  m_last_reported.store(m_i.load());
   this->doReport(msg);
 }
 
@@ -134,10 +131,10 @@ void ProgressBase::reportIncrement(int inc, const std::string &msg) {
     @param msg :: Optional message string
 */
 void ProgressBase::reportIncrement(size_t inc, const std::string &msg) {
-  m_i += static_cast<int64_t>(inc);
-  if (m_i - m_last_reported < m_notifyStep)
+  const auto increment = static_cast<int64_t>(inc);
+  if (!claimReport(m_i.fetch_add(increment, std::memory_order_relaxed) +
+                   increment))
     return;
-  m_last_reported.store(m_i.load());
   this->doReport(msg);
 }
 
@@ -14,25 +14,101 @@
 
 #include <algorithm>
 #include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/weak_ptr.hpp>
 #include <cstdint>
+#include <functional>
+#include <mutex>
 #include <ostream>
+#include <unordered_map>
 
 namespace Mantid {
 namespace Kernel {
 
+namespace {
+/// Values at least this long are shared between property histories
+constexpr size_t MIN_SHARED_VALUE_LENGTH = 64;
+/// The number of new values after which expired values are forgotten
+constexpr size_t PRUNE_INTERVAL = 1024;
+
+/**
+ * Keeps track of the long property values held by property histories, so
+ * that repeated values such as arrays or function strings, e.g. from the
+ * same algorithm being run many times in a loop, are stored only once.
+ */
+class SharedValues {
+public:
+  boost::shared_ptr<const std::string> share(const std::string &value) {
+    const auto hash = std::hash<std::string>()(value);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto &bucket = m_values[hash];
+    for (auto it = bucket.begin(); it != bucket.end();) {
+      if (auto shared = it->lock()) {
+        if (*shared == value)
+          return shared;
+        ++it;
+      } else {
+        it = bucket.erase(it);
+      }
+    }
+    auto shared = boost::make_shared<const std::string>(value);
+    bucket.emplace_back(shared);
+    if (++m_additions % PRUNE_INTERVAL == 0)
+      prune();
+    return shared;
+  }
+
+private:
+  /// Forget the values that are no longer held by any history
+  void prune() {
+    for (auto it = m_values.begin(); it != m_values.end();) {
+      auto &bucket = it->second;
+      bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                                  [](const boost::weak_ptr<const std::string>
+                                         &value) { return value.expired(); }),
+                   bucket.end());
+      if (bucket.empty())
+        it = m_values.erase(it);
+      else
+        ++it;
+    }
+  }
+
+  std::mutex m_mutex;
+  std::unordered_map<size_t, std::vector<boost::weak_ptr<const std::string>>>
+      m_values;
+  size_t m_additions = 0;
+};
+
+/// @return a value to hold in a property history
+boost::shared_ptr<const std::string> makeValue(const std::string &value) {
+  if (value.size() < MIN_SHARED_VALUE_LENGTH)
+    return boost::make_shared<const std::string>(value);
+  static SharedValues sharedValues;
+  return sharedValues.share(value);
+}
+} // namespace
+
 /// Constructor
 PropertyHistory::PropertyHistory(const std::string &name,
                                  const std::string &value,
                                  const std::string &type, const bool isdefault,
                                  const unsigned int direction)
-    : m_name(name), m_value(value), m_type(type), m_isDefault(isdefault),
-      m_direction(direction) {}
+    : m_name(name), m_value(makeValue(value)), m_type(type),
+      m_isDefault(isdefault), m_direction(direction) {}
 
 PropertyHistory::PropertyHistory(Property const *const prop)
-    : m_name(prop->name()), m_value(prop->valueAsPrettyStr(0, true)),
+    : m_name(prop->name()), m_value(makeValue(prop->valueAsPrettyStr(0, true))),
       m_type(prop->type()), m_isDefault(prop->isDefault()),
       m_direction(prop->direction()) {}
 
+/** Set the value of the algorithm parameter
+ * @param value :: The new value
+ */
+void PropertyHistory::setValue(const std::string &value) {
+  m_value = makeValue(value);
+}
+
 /** Prints a text representation of itself
  *  @param os :: The output stream to write to
  *  @param indent :: an indentation value to make pretty printing of object and
@@ -43,10 +119,11 @@ PropertyHistory::PropertyHistory(Property const *const prop)
 void PropertyHistory::printSelf(std::ostream &os, const int indent,
                                 const size_t maxPropertyLength) const {
   os << std::string(indent, ' ') << "Name: " << m_name;
-  if ((maxPropertyLength > 0) && (m_value.size() > maxPropertyLength)) {
-    os << ", Value: " << Strings::shorten(m_value, maxPropertyLength);
+  const auto &value = *m_value;
+  if ((maxPropertyLength > 0) && (value.size() > maxPropertyLength)) {
+    os << ", Value: " << Strings::shorten(value, maxPropertyLength);
   } else {
-    os << ", Value: " << m_value;
+    os << ", Value: " << value;
   }
   os << ", Default?: " << (m_isDefault ? "Yes" : "No");
   os << ", Direction: " << Kernel::Direction::asText(m_direction) << '\n';
@@ -87,7 +164,7 @@ bool PropertyHistory::isEmptyDefault() const {
   if (m_isDefault && m_direction != Direction::Output) {
     if (std::find(numberTypes.begin(), numberTypes.end(), m_type) !=
         numberTypes.end()) {
-      if (std::find(emptyValues.begin(), emptyValues.end(), m_value) !=
+      if (std::find(emptyValues.begin(), emptyValues.end(), *m_value) !=
           emptyValues.end()) {
         emptyDefault = true;
       }
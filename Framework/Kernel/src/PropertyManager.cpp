@@ -175,14 +175,18 @@ void PropertyManager::filterByProperty(
     const Kernel::TimeSeriesProperty<bool> &filter) {
   for (auto &orderedProperty : m_orderedProperties) {
     Property *currentProp = orderedProperty;
-    if (auto doubleSeries =
-            dynamic_cast<TimeSeriesProperty<double> *>(currentProp)) {
+    if (dynamic_cast<TimeSeriesProperty<double> *>(currentProp)) {
+      // Hand the original over to the filtered property as its unfiltered
+      // copy rather than cloning it and then deleting it
+      auto &stored = this->m_properties[createKey(currentProp->name())];
+      std::unique_ptr<const TimeSeriesProperty<double>> unfiltered(
+          static_cast<TimeSeriesProperty<double> *>(stored.release()));
       std::unique_ptr<Property> filtered =
-          std::make_unique<FilteredTimeSeriesProperty<double>>(doubleSeries,
-                                                               filter);
+          std::make_unique<FilteredTimeSeriesProperty<double>>(
+              std::move(unfiltered), filter);
       orderedProperty = filtered.get();
       // Now replace in the map
-      this->m_properties[createKey(currentProp->name())] = std::move(filtered);
+      stored = std::move(filtered);
     }
   }
 }
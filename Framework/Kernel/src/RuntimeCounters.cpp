@@ -0,0 +1,100 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/RuntimeCounters.h"
+
+#include <ostream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// Prefix of the metric names in the Prometheus output
+const std::string PROMETHEUS_PREFIX("mantid_");
+} // namespace
+
+/** Get a counter, creating it at zero if it does not exist yet. The reference
+ * stays valid for the lifetime of the service.
+ * @param name :: the name of the counter, optionally with Prometheus labels
+ * @return the counter
+ */
+RuntimeCountersImpl::Counter &
+RuntimeCountersImpl::counter(const std::string &name) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto &counter = m_counters[name];
+  if (!counter)
+    counter = std::make_unique<Counter>(0);
+  return *counter;
+}
+
+/** Add to a counter, creating it if necessary. Code that updates a counter
+ * often should keep the reference returned by counter() instead, which avoids
+ * looking the name up.
+ * @param name :: the name of the counter
+ * @param amount :: the amount to add
+ */
+void RuntimeCountersImpl::add(const std::string &name, const uint64_t amount) {
+  counter(name).fetch_add(amount, std::memory_order_relaxed);
+}
+
+/**
+ * @param name :: the name of a counter
+ * @return the value of the counter, or 0 if it does not exist
+ */
+uint64_t RuntimeCountersImpl::value(const std::string &name) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto it = m_counters.find(name);
+  if (it == m_counters.end())
+    return 0;
+  return it->second->load(std::memory_order_relaxed);
+}
+
+/// @return the values of all counters by name
+std::map<std::string, uint64_t> RuntimeCountersImpl::values() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::map<std::string, uint64_t> result;
+  for (const auto &item : m_counters)
+    result.emplace(item.first, item.second->load(std::memory_order_relaxed));
+  return result;
+}
+
+/// Set all counters back to zero. The counters themselves are kept.
+void RuntimeCountersImpl::reset() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto &item : m_counters)
+    item.second->store(0, std::memory_order_relaxed);
+}
+
+/** Write all counters in the Prometheus text exposition format. Counters that
+ * differ only in their labels are written together as one metric.
+ * @param out :: the stream to write to
+ */
+void RuntimeCountersImpl::writePrometheus(std::ostream &out) const {
+  std::map<std::string, std::vector<std::pair<std::string, uint64_t>>>
+      families;
+  for (const auto &item : values()) {
+    const auto &name = item.first;
+    families[name.substr(0, name.find('{'))].emplace_back(name, item.second);
+  }
+  for (const auto &family : families) {
+    out << "# TYPE " << PROMETHEUS_PREFIX << family.first << " counter\n";
+    for (const auto &sample : family.second)
+      out << PROMETHEUS_PREFIX << sample.first << ' ' << sample.second << '\n';
+  }
+}
+
+/// @return all counters in the Prometheus text exposition format
+std::string RuntimeCountersImpl::prometheus() const {
+  std::ostringstream out;
+  writePrometheus(out);
+  return out.str();
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -8,15 +8,10 @@
 #include "MantidKernel/Statistics.h"
 #include "MantidKernel/Logger.h"
 
-#include <boost/accumulators/accumulators.hpp>
-#include <boost/accumulators/statistics/max.hpp>
-#include <boost/accumulators/statistics/min.hpp>
-#include <boost/accumulators/statistics/stats.hpp>
-#include <boost/accumulators/statistics/variance.hpp>
-
 #include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <limits>
 #include <sstream>
 
 namespace Mantid {
@@ -67,12 +62,12 @@ double getMedian(const vector<TYPE> &data, const size_t num_data,
     } else {
       // If the data is not sorted, make a copy we can mess with
       vector<TYPE> temp(data.begin(), data.end());
-      // Get what the centre two elements should be...
-      std::nth_element(temp.begin(), temp.begin() + num_data / 2 - 1,
-                       temp.end());
-      left = static_cast<double>(*(temp.begin() + num_data / 2 - 1));
+      // Put the upper centre element in place. The lower one is then the
+      // largest of the elements before it.
       std::nth_element(temp.begin(), temp.begin() + num_data / 2, temp.end());
       right = static_cast<double>(*(temp.begin() + num_data / 2));
+      left = static_cast<double>(
+          *std::max_element(temp.begin(), temp.begin() + num_data / 2));
     }
     // return the average
     return (left + right) / 2.;
@@ -104,11 +99,12 @@ std::vector<double> getZscore(const vector<TYPE> &data) {
     Zscore.resize(data.size(), 0.);
     return Zscore;
   }
-  Statistics stats = getStatistics(data);
+  Statistics stats = getStatistics(data, StatOptions::UncorrectedStdDev);
   if (stats.standard_deviation == 0.) {
     Zscore.resize(data.size(), 0.);
     return Zscore;
   }
+  Zscore.reserve(data.size());
   for (auto it = data.cbegin(); it != data.cend(); ++it) {
     auto tmp = static_cast<double>(*it);
     Zscore.push_back(fabs((stats.mean - tmp) / stats.standard_deviation));
@@ -127,7 +123,7 @@ std::vector<double> getWeightedZscore(const vector<TYPE> &data,
     Zscore.resize(data.size(), 0.);
     return Zscore;
   }
-  Statistics stats = getStatistics(data);
+  Statistics stats = getStatistics(data, StatOptions::UncorrectedStdDev);
   if (stats.standard_deviation == 0.) {
     Zscore.resize(data.size(), 0.);
     return Zscore;
@@ -202,15 +198,29 @@ Statistics getStatistics(const vector<TYPE> &data, const unsigned int flags) {
   const bool stddev = ((flags & StatOptions::UncorrectedStdDev) ||
                        (flags & StatOptions::CorrectedStdDev));
   if (stddev) {
-    using namespace boost::accumulators;
-    accumulator_set<double, stats<tag::min, tag::max, tag::variance>> acc;
-    for (auto &value : data) {
-      acc(static_cast<double>(value));
+    // Single pass. The sums for the variance are taken about the first value
+    // rather than zero, which avoids the cancellation of the textbook formula
+    // for data far from zero without a division per value.
+    const auto shift = static_cast<double>(data.front());
+    double minimum = std::numeric_limits<double>::max();
+    double maximum = std::numeric_limits<double>::lowest();
+    double sum = 0.;
+    double shiftedSum = 0.;
+    double shiftedSumSq = 0.;
+    for (const auto &value : data) {
+      const auto x = static_cast<double>(value);
+      minimum = std::min(minimum, x);
+      maximum = std::max(maximum, x);
+      sum += x;
+      const double dx = x - shift;
+      shiftedSum += dx;
+      shiftedSumSq += dx * dx;
     }
-    statistics.minimum = min(acc);
-    statistics.maximum = max(acc);
-    statistics.mean = mean(acc);
-    double var = variance(acc);
+    const auto n = static_cast<double>(num_data);
+    statistics.minimum = minimum;
+    statistics.maximum = maximum;
+    statistics.mean = sum / n;
+    double var = std::max(0., (shiftedSumSq - shiftedSum * shiftedSum / n) / n);
 
     if (flags & StatOptions::CorrectedStdDev) {
       auto ndofs = static_cast<double>(data.size());
@@ -219,12 +229,11 @@ Statistics getStatistics(const vector<TYPE> &data, const unsigned int flags) {
     statistics.standard_deviation = std::sqrt(var);
 
   } else if (flags & StatOptions::Mean) {
-    using namespace boost::accumulators;
-    accumulator_set<double, stats<tag::mean>> acc;
-    for (auto &value : data) {
-      acc(static_cast<double>(value));
+    double sum = 0.;
+    for (const auto &value : data) {
+      sum += static_cast<double>(value);
     }
-    statistics.mean = mean(acc);
+    statistics.mean = sum / static_cast<double>(num_data);
   }
 
   // calculate the median if requested
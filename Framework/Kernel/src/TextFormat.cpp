@@ -0,0 +1,113 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/TextFormat.h"
+
+#include <cctype>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+namespace Mantid {
+namespace Kernel {
+namespace {
+/// Large enough for any number of the default precision and width
+constexpr size_t BUFFER_SIZE = 64;
+
+/**
+ * Append the output of snprintf to a text, formatting it a second time
+ * straight into the text if it does not fit in the buffer
+ */
+template <typename... Args>
+void appendFormatted(std::string &text, const char *format, Args... args) {
+  char buffer[BUFFER_SIZE];
+  const int length = std::snprintf(buffer, BUFFER_SIZE, format, args...);
+  if (length <= 0)
+    return;
+  const auto size = static_cast<size_t>(length);
+  if (size < BUFFER_SIZE) {
+    text.append(buffer, size);
+    return;
+  }
+  const size_t start = text.size();
+  text.resize(start + size + 1);
+  std::snprintf(&text[start], size + 1, format, args...);
+  text.resize(start + size);
+}
+} // namespace
+
+/**
+ * @param precision :: The precision, as set by std::setprecision
+ * @param notation :: The notation, as the floatfield of a stream
+ * @param width :: The minimum width of a number, which is padded with spaces
+ * on the left as by std::setw
+ */
+NumberFormat::NumberFormat(const int precision, const Notation notation,
+                           const int width)
+    : m_precision(precision), m_width(width) {
+  switch (notation) {
+  case Notation::Fixed:
+    m_format = "%*.*f";
+    break;
+  case Notation::Scientific:
+    m_format = "%*.*e";
+    break;
+  default:
+    m_format = "%*.*g";
+  }
+}
+
+/**
+ * @param text :: The text to append to
+ * @param value :: The number to append
+ */
+void NumberFormat::append(std::string &text, const double value) const {
+  appendFormatted(text, m_format, m_width, m_precision, value);
+}
+
+/**
+ * @param text :: The text to append to
+ * @param value :: The number to append
+ */
+void NumberFormat::append(std::string &text, const int64_t value) const {
+  appendFormatted(text, "%*" PRId64, m_width, value);
+}
+
+/**
+ * @param value :: The number to format
+ * @return the text of the number
+ */
+std::string NumberFormat::format(const double value) const {
+  std::string text;
+  append(text, value);
+  return text;
+}
+
+/**
+ * Parse a floating point number, which must make up the whole text, as
+ * boost::lexical_cast would but without going through a stream
+ * @param text :: The text of the number, without any surrounding space
+ * @param value :: Set to the number if the text is one
+ * @return true if the text is a number
+ */
+bool parseNumber(const std::string &text, double &value) {
+  // strtod would also skip leading space and take hexadecimal numbers
+  if (text.empty() || std::isspace(static_cast<unsigned char>(text[0])) ||
+      text.find_first_of("xX") != std::string::npos)
+    return false;
+  const char *begin = text.c_str();
+  char *end = nullptr;
+  errno = 0;
+  const double number = std::strtod(begin, &end);
+  if (end != begin + text.size() || errno == ERANGE)
+    return false;
+  value = number;
+  return true;
+}
+
+} // namespace Kernel
+} // namespace Mantid
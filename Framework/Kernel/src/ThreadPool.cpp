@@ -35,7 +35,8 @@ namespace Kernel {
  *        NOTE: The ThreadPool destructor will delete this ThreadScheduler.
  * @param numThreads :: number of cores to use; default = 0, meaning auto-detect
  *all
- *        available physical cores.
+ *        available physical cores. Nested in another ThreadPool or in an
+ *        OpenMP parallel region, 0 means a single thread.
  * @param prog :: optional pointer to a Progress reporter object. If passed,
  *then
  *        automatic progress reporting will be handled by the thread pool.
@@ -50,8 +51,13 @@ ThreadPool::ThreadPool(ThreadScheduler *scheduler, size_t numThreads,
         "NULL ThreadScheduler passed to ThreadPool constructor.");
 
   if (numThreads == 0) {
-    // Uses Poco to find how many cores there are.
-    m_numThreads = getNumPhysicalCores();
+    // A pool created by a task of another pool, or inside an OpenMP parallel
+    // region, would oversubscribe the cores already busy with the outer one.
+    if (inThreadPoolWorker() || PARALLEL_IN_REGION)
+      m_numThreads = 1;
+    else
+      // Uses Poco to find how many cores there are.
+      m_numThreads = getNumPhysicalCores();
   } else
     m_numThreads = numThreads;
   // std::cout << m_numThreads << " m_numThreads \n";
@@ -78,10 +84,9 @@ size_t ThreadPool::getNumPhysicalCores() {
   auto maxCores =
       Kernel::ConfigService::Instance().getValue<int>("MultiThreaded.MaxCores");
 
-  if (!maxCores.is_initialized())
-    return std::min(maxCores.get_value_or(0), physicalCores);
-  else
-    return physicalCores;
+  if (maxCores.get_value_or(0) > 0)
+    return static_cast<size_t>(std::min(maxCores.get(), physicalCores));
+  return static_cast<size_t>(std::max(physicalCores, 1));
 }
 
 //--------------------------------------------------------------------------------
@@ -5,15 +5,32 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidKernel/ThreadPoolRunnable.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ProgressBase.h"
+#include "MantidKernel/RuntimeCounters.h"
 #include "MantidKernel/Task.h"
 #include "MantidKernel/ThreadScheduler.h"
+#include "MantidKernel/TraceRecorder.h"
 
 #include <Poco/Thread.h>
 
 namespace Mantid {
 namespace Kernel {
 
+namespace {
+/// Set in the threads running a ThreadPoolRunnable
+thread_local bool isThreadPoolWorker = false;
+
+/// Count a task run in the runtime counters
+void countTask() {
+  static auto &tasks = RuntimeCounters::Instance().counter("threadpool_tasks");
+  tasks.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace
+
+/// @return true if called from a worker thread of a ThreadPool
+bool inThreadPoolWorker() { return isThreadPoolWorker; }
+
 //-----------------------------------------------------------------------------------
 /** Constructor
  *
@@ -44,6 +61,7 @@ void ThreadPoolRunnable::clearWait() { m_waitSec = 0.0; }
  * as scheduled to it.
  */
 void ThreadPoolRunnable::run() {
+  isThreadPoolWorker = true;
   std::shared_ptr<Task> task;
 
   // If there are no tasks yet, wait up to m_waitSec for them to come up
@@ -65,7 +83,11 @@ void ThreadPoolRunnable::run() {
 
       try {
         // Run the task (synchronously within this thread)
+        TraceSpan span("Task", "task");
+        if (span.active())
+          span.addArg("cost", std::to_string(task->cost()));
         task->run();
+        countTask();
       } catch (std::exception &e) {
         // The task threw an exception!
         // This will clear out the list of tasks, allowing all threads to
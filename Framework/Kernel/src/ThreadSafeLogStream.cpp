@@ -13,6 +13,9 @@
 #include <Poco/StreamUtil.h>
 #include <Poco/UnbufferedStreamBuf.h>
 
+#include <algorithm>
+#include <unordered_map>
+
 using namespace Mantid::Kernel;
 
 //************************************************************
@@ -24,7 +27,7 @@ using namespace Mantid::Kernel;
  */
 ThreadSafeLogStreamBuf::ThreadSafeLogStreamBuf(Poco::Logger &logger,
                                                Poco::Message::Priority priority)
-    : Poco::LogStreamBuf(logger, priority), m_messages() {}
+    : Poco::LogStreamBuf(logger, priority) {}
 
 int ThreadSafeLogStreamBuf::overflow(char c) {
   return Poco::UnbufferedStreamBuf::overflow(c);
@@ -38,18 +41,44 @@ int ThreadSafeLogStreamBuf::overflow(char c) {
  * @returns The ASCII code of the input character
  */
 int ThreadSafeLogStreamBuf::writeToDevice(char c) {
-  if (c == '\n' || c == '\r') {
-    Poco::Message msg(logger().name(), m_messages[Poco::Thread::currentTid()],
-                      getPriority());
-    m_messages[Poco::Thread::currentTid()] = "";
-    logger().log(msg);
-  } else {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_messages[Poco::Thread::currentTid()] += c;
-  }
+  xsputn(&c, 1);
   return static_cast<int>(c);
 }
 
+/**
+ * Append a block of characters to the message of the calling thread. Each
+ * time an EOL character is reached the message is sent to the logger. The
+ * unfinished messages are kept per thread, for each buffer the thread writes
+ * to, and only until they are finished, so no lock is needed.
+ * @param s :: The characters to write
+ * @param count :: The number of characters
+ * @returns The number of characters written
+ */
+std::streamsize ThreadSafeLogStreamBuf::xsputn(const char *s,
+                                               std::streamsize count) {
+  thread_local std::unordered_map<const ThreadSafeLogStreamBuf *, std::string>
+      messages;
+  const auto isEOL = [](const char c) { return c == '\n' || c == '\r'; };
+  const char *end = s + count;
+  while (s != end) {
+    const char *eol = std::find_if(s, end, isEOL);
+    if (eol == end) {
+      messages[this].append(s, end);
+      break;
+    }
+    std::string text;
+    auto message = messages.find(this);
+    if (message != messages.end()) {
+      text = std::move(message->second);
+      messages.erase(message);
+    }
+    text.append(s, eol);
+    logger().log(Poco::Message(logger().name(), text, getPriority()));
+    s = eol + 1;
+  }
+  return count;
+}
+
 //************************************************************
 // ThreadSafeLogIOS
 //************************************************************
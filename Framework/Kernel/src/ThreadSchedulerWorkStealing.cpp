@@ -0,0 +1,259 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// Number of shards of the unfinished tasks per worker
+const size_t SHARDS_PER_WORKER = 4;
+
+/// The scheduler and queue of the worker running in this thread, if any
+struct CurrentWorker {
+  const ThreadSchedulerWorkStealing *scheduler = nullptr;
+  size_t queue = 0;
+};
+thread_local CurrentWorker currentWorker;
+} // namespace
+
+/** Constructor
+ * @param numWorkers :: number of worker queues, normally the number of threads
+ * of the ThreadPool. 0 uses the number of physical cores.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(
+    const size_t numWorkers)
+    : ThreadScheduler() {
+  const size_t workers =
+      std::max(numWorkers > 0 ? numWorkers : ThreadPool::getNumPhysicalCores(),
+               size_t(1));
+  m_queues.reserve(workers);
+  for (size_t i = 0; i < workers; ++i)
+    m_queues.emplace_back(std::make_unique<WorkerQueue>());
+  m_shards.reserve(workers * SHARDS_PER_WORKER);
+  for (size_t i = 0; i < workers * SHARDS_PER_WORKER; ++i)
+    m_shards.emplace_back(std::make_unique<TaskShard>());
+}
+
+/// Destructor
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() { clear(); }
+
+//-------------------------------------------------------------------------------
+/** Add a Task to the queue of the calling worker, or to the next queue if
+ * called from outside the workers.
+ * @param newTask :: Task to add to queue
+ */
+void ThreadSchedulerWorkStealing::push(std::shared_ptr<Task> newTask) {
+  {
+    auto &shard = shardOf(newTask.get());
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.unfinished.insert(newTask.get());
+  }
+  ++m_numUnfinished;
+  enqueue(std::move(newTask));
+}
+
+/** Add a Task which may only run once other tasks have finished. Tasks that
+ * were never pushed to this scheduler, or have already finished, are not
+ * waited for.
+ * @param newTask :: Task to add to queue
+ * @param dependencies :: tasks that must finish before newTask runs
+ */
+void ThreadSchedulerWorkStealing::push(
+    std::shared_ptr<Task> newTask,
+    const std::vector<std::shared_ptr<Task>> &dependencies) {
+  {
+    auto &shard = shardOf(newTask.get());
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.unfinished.insert(newTask.get());
+  }
+  ++m_numUnfinished;
+  ++m_numWaiting;
+  // The extra count keeps the task waiting until all dependencies are seen
+  auto waiting = std::make_shared<WaitingTask>(std::move(newTask),
+                                               dependencies.size() + 1);
+  for (const auto &dependency : dependencies) {
+    bool wait = false;
+    if (dependency) {
+      auto &shard = shardOf(dependency.get());
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      if (shard.unfinished.count(dependency.get()) > 0) {
+        shard.dependents[dependency.get()].push_back(waiting);
+        wait = true;
+      }
+    }
+    if (!wait)
+      --waiting->remaining;
+  }
+  release(*waiting);
+}
+
+//-------------------------------------------------------------------------------
+/** Retrieves the next Task to execute: the first of the queue of the worker,
+ * or else the first of the queue of another worker.
+ * @param threadnum :: ID of the calling thread.
+ * @return a Task pointer to execute, NULL if there is none queued.
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  const size_t own = threadnum % m_queues.size();
+  currentWorker.scheduler = this;
+  currentWorker.queue = own;
+  std::shared_ptr<Task> task = takeFrom(*m_queues[own]);
+  for (size_t i = 1; !task && i < m_queues.size(); ++i)
+    task = takeFrom(*m_queues[(own + i) % m_queues.size()]);
+  return task;
+}
+
+//-------------------------------------------------------------------------------
+/** Signal to the scheduler that a task is complete. Queues the tasks that
+ * were only waiting for it.
+ * @param task :: the Task that was completed.
+ * @param threadnum :: unused argument
+ */
+void ThreadSchedulerWorkStealing::finished(Task *task, size_t threadnum) {
+  UNUSED_ARG(threadnum);
+  std::vector<std::shared_ptr<WaitingTask>> dependents;
+  {
+    auto &shard = shardOf(task);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.unfinished.erase(task);
+    auto it = shard.dependents.find(task);
+    if (it != shard.dependents.end()) {
+      dependents.swap(it->second);
+      shard.dependents.erase(it);
+    }
+  }
+  for (const auto &waiting : dependents)
+    release(*waiting);
+  --m_numUnfinished;
+}
+
+//-------------------------------------------------------------------------------
+/// @return the number of tasks queued or waiting for their dependencies
+size_t ThreadSchedulerWorkStealing::size() {
+  return m_numQueued + m_numWaiting;
+}
+
+/// @return true once no tasks are queued, waiting or running
+bool ThreadSchedulerWorkStealing::empty() { return m_numUnfinished == 0; }
+
+//-------------------------------------------------------------------------------
+/// Remove all queued and waiting tasks. Running tasks still report finished().
+void ThreadSchedulerWorkStealing::clear() {
+  size_t removed = 0;
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    for (const auto &item : queue->tasks) {
+      auto &shard = shardOf(item.second.get());
+      std::lock_guard<std::mutex> shardLock(shard.mutex);
+      shard.unfinished.erase(item.second.get());
+    }
+    removed += queue->tasks.size();
+    m_numQueued -= queue->tasks.size();
+    queue->tasks.clear();
+    queue->cost = 0.;
+  }
+  // Waiting tasks are only referenced by the tasks they wait on
+  std::unordered_set<const Task *> waiting;
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    for (const auto &dependents : shard->dependents)
+      for (const auto &dependent : dependents.second)
+        waiting.insert(dependent->task.get());
+    shard->dependents.clear();
+  }
+  for (const auto *task : waiting) {
+    auto &shard = shardOf(task);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.unfinished.erase(task);
+  }
+  removed += waiting.size();
+  m_numWaiting -= waiting.size();
+  m_numUnfinished -= removed;
+
+  std::lock_guard<std::mutex> lock(m_queueLock);
+  m_cost = 0;
+  m_costExecuted = 0;
+}
+
+//-------------------------------------------------------------------------------
+/// @return the total cost of the tasks queued
+double ThreadSchedulerWorkStealing::totalCost() {
+  double cost = 0.;
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    cost += queue->cost;
+  }
+  return cost;
+}
+
+//-------------------------------------------------------------------------------
+/** Put a task in the queue of the calling worker, or in the next queue if
+ * called from outside the workers of this scheduler.
+ * @param task :: the task to queue
+ */
+void ThreadSchedulerWorkStealing::enqueue(std::shared_ptr<Task> task) {
+  size_t index;
+  if (currentWorker.scheduler == this)
+    index = currentWorker.queue % m_queues.size();
+  else
+    index = m_nextQueue++ % m_queues.size();
+  auto &queue = *m_queues[index];
+  const double cost = task->cost();
+  const int priority = task->priority();
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.emplace(std::make_pair(priority, cost), std::move(task));
+    queue.cost += cost;
+  }
+  ++m_numQueued;
+}
+
+/** Take the task of highest priority and cost from a queue
+ * @param queue :: the queue to take from
+ * @return the task, NULL if the queue is empty
+ */
+std::shared_ptr<Task>
+ThreadSchedulerWorkStealing::takeFrom(WorkerQueue &queue) {
+  if (m_numQueued == 0)
+    return nullptr;
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty())
+    return nullptr;
+  auto largest = std::prev(queue.tasks.end());
+  auto task = std::move(largest->second);
+  queue.cost -= largest->first.second;
+  queue.tasks.erase(largest);
+  --m_numQueued;
+  return task;
+}
+
+/** Count one finished dependency of a waiting task, and queue the task once
+ * none is left.
+ * @param waiting :: the waiting task
+ */
+void ThreadSchedulerWorkStealing::release(WaitingTask &waiting) {
+  if (--waiting.remaining == 0) {
+    enqueue(std::move(waiting.task));
+    --m_numWaiting;
+  }
+}
+
+/// @return the shard holding the bookkeeping of a task
+ThreadSchedulerWorkStealing::TaskShard &
+ThreadSchedulerWorkStealing::shardOf(const Task *task) {
+  // Tasks are allocated on aligned addresses: drop the low bits
+  const auto key = reinterpret_cast<std::uintptr_t>(task) >> 4;
+  return *m_shards[key % m_shards.size()];
+}
+
+} // namespace Kernel
+} // namespace Mantid
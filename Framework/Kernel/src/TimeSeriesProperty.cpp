@@ -474,8 +474,11 @@ void TimeSeriesProperty<TYPE>::splitByTime(
 
     int output_index = itspl->index();
     // output workspace index is out of range. go to the next splitter
-    if (output_index < 0 || output_index >= static_cast<int>(numOutputs))
+    if (output_index < 0 || output_index >= static_cast<int>(numOutputs)) {
+      ++itspl;
+      ++counter;
       continue;
+    }
 
     TimeSeriesProperty<TYPE> *myOutput = outputs_tsp[output_index];
     // skip if the input property is of wrong type
@@ -509,14 +512,15 @@ void TimeSeriesProperty<TYPE>::splitByTime(
         myOutput->addValue(m_values[i_prev].time(), m_values[i_prev].value());
     }
 
-    // Loop through all the entries until out.
-    while (i_property < m_values.size() && m_values[i_property].time() < stop) {
-
-      // Copy the log out to the output
-      myOutput->addValue(m_values[i_property].time(),
-                         m_values[i_property].value());
-      ++i_property;
-    }
+    // Find all the entries until out and copy them to the output as one block
+    const auto first = m_values.cbegin() + i_property;
+    const auto last = std::lower_bound(
+        first, m_values.cend(), stop,
+        [](const TimeValueUnit<TYPE> &entry, const DateAndTime &t) {
+          return entry.time() < t;
+        });
+    myOutput->appendSortedRange(first, last);
+    i_property = static_cast<size_t>(std::distance(m_values.cbegin(), last));
 
     // Go to the next interval
     ++itspl;
@@ -571,15 +575,36 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
   // sort if necessary
   sortIfNecessary();
 
-  // work on m_values, m_size, and m_time
-  std::vector<Types::Core::DateAndTime> tsp_time_vec = this->timesAsVector();
+  // the entries are searched and copied in place: no copy of the times
+  const auto entryBefore = [](const TimeValueUnit<TYPE> &entry,
+                              const DateAndTime &t) {
+    return entry.time() < t;
+  };
+  const auto timeBefore = [](const DateAndTime &t,
+                             const TimeValueUnit<TYPE> &entry) {
+    return t < entry.time();
+  };
+  // append entries [first, last) to an output, skipping any that are not
+  // later than its last entry
+  const auto appendEntries = [this](TimeSeriesProperty *output, size_t first,
+                                    size_t last) {
+    auto &outValues = output->m_values;
+    if (outValues.empty())
+      output->m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
+    for (size_t i = first; i < last; ++i) {
+      if (outValues.empty() || outValues.back().time() < m_values[i].time())
+        outValues.push_back(m_values[i]);
+    }
+    output->m_filterApplied = false;
+  };
 
   // go over both filter time vector and time series property time vector
   size_t index_splitter = 0;
   size_t index_tsp_time = 0;
+  const size_t numEntries = m_values.size();
 
   // tsp_time is start time of time series property
-  DateAndTime tsp_time = tsp_time_vec[index_tsp_time];
+  DateAndTime tsp_time = m_values[index_tsp_time].time();
   DateAndTime split_start_time = splitter_time_vec[index_splitter];
   DateAndTime split_stop_time = splitter_time_vec[index_splitter + 1];
 
@@ -609,10 +634,9 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
   // move along the entries to find the entry inside the current splitter
   bool first_splitter_after_last_entry(false);
   if (!no_entry_in_range) {
-    std::vector<DateAndTime>::iterator tsp_time_iter;
-    tsp_time_iter = std::lower_bound(tsp_time_vec.begin(), tsp_time_vec.end(),
-                                     split_start_time);
-    if (tsp_time_iter == tsp_time_vec.end()) {
+    auto tsp_time_iter = std::lower_bound(m_values.cbegin(), m_values.cend(),
+                                          split_start_time, entryBefore);
+    if (tsp_time_iter == m_values.cend()) {
       // the first splitter's start time is LATER than the last TSP entry, then
       // there won't be any
       // TSP entry to be split into any target splitter.
@@ -622,15 +646,8 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
       // first splitter start time is between tsp_time_iter and the one before
       // it.
       // so the index for tsp_time_iter is the first TSP entry in the splitter
-      index_tsp_time = tsp_time_iter - tsp_time_vec.begin();
-      tsp_time = *tsp_time_iter;
+      index_tsp_time = tsp_time_iter - m_values.cbegin();
     }
-  } else {
-    // no entry in range is true, which corresponding to the previous case
-    // "already search to the last splitter which is still earlier than first
-    // TSP
-    // entry"
-    ;
   }
 
   if (no_entry_in_range && first_splitter_after_last_entry) {
@@ -643,7 +660,6 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
 
   // now it is the time to put TSP's entries to corresponding
   continue_search = !no_entry_in_range;
-  size_t outer_while_counter = 0;
   bool partial_target_filled(false);
   while (continue_search) {
     // get next target
@@ -653,48 +669,22 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
     if (index_tsp_time > 0)
       --index_tsp_time;
 
-    // add the continous entries to same target time series property
-    const size_t tspTimeVecSize = tsp_time_vec.size();
-    bool continue_add = true;
-    while (continue_add) {
-      size_t inner_while_counter = 0;
-      if (index_tsp_time == tspTimeVecSize) {
-        // last entry. quit all loops
-        continue_add = false;
-        continue_search = false;
-        partial_target_filled = true;
-        break;
-      }
-
-      // add current entry
-      if (outputs[target]->size() == 0 ||
-          outputs[target]->lastTime() < tsp_time_vec[index_tsp_time]) {
-        // avoid to add duplicate entry
-        outputs[target]->addValue(m_values[index_tsp_time].time(),
-                                  m_values[index_tsp_time].value());
-      }
-
-      const size_t nextTspIndex = index_tsp_time + 1;
-      if (nextTspIndex < tspTimeVecSize) {
-        if (tsp_time_vec[nextTspIndex] > split_stop_time) {
-          // next entry is out of this splitter: add the next one and quit
-          if (outputs[target]->lastTime() < m_values[nextTspIndex].time()) {
-            // avoid the duplicate cases occurred in fast frequency issue
-            outputs[target]->addValue(m_values[nextTspIndex].time(),
-                                      m_values[nextTspIndex].value());
-          }
-          // FIXME - in future, need to find out WHETHER there is way to
-          // skip the
-          // rest without going through the whole sequence
-          continue_add = false;
-        }
-      }
-
-      // advance to next entry
-      ++index_tsp_time;
-
-      ++inner_while_counter;
-    } // END-WHILE continue add
+    // the entries up to and including the first one after the end of this
+    // splitter go to the same target
+    const auto next = std::upper_bound(m_values.cbegin() + index_tsp_time + 1,
+                                       m_values.cend(), split_stop_time,
+                                       timeBefore);
+    if (next == m_values.cend()) {
+      // last entry. quit all loops
+      appendEntries(outputs[target], index_tsp_time, numEntries);
+      index_tsp_time = numEntries;
+      continue_search = false;
+      partial_target_filled = true;
+    } else {
+      const size_t index_next = next - m_values.cbegin();
+      appendEntries(outputs[target], index_tsp_time, index_next + 1);
+      index_tsp_time = index_next;
+    }
 
     // make splitters to advance to next
     ++index_splitter;
@@ -705,8 +695,6 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
       split_start_time = split_stop_time;
       split_stop_time = splitter_time_vec[index_splitter + 1];
     }
-
-    ++outer_while_counter;
   } // END-OF-WHILE
 
   // Still in 'continue search'-while-loop.  But the TSP runs over before
@@ -719,10 +707,9 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
          isplitter < splitter_time_vec.size() - 1; ++isplitter) {
       int target_i = target_vec[isplitter];
       if (fill_target_set.find(target_i) == fill_target_set.end()) {
-        if (outputs[target_i]->size() == 0 ||
-            outputs[target_i]->lastTime() != m_values.back().time())
-          outputs[target_i]->addValue(m_values.back().time(),
-                                      m_values.back().value());
+        if (outputs[target_i]->m_values.empty() ||
+            outputs[target_i]->m_values.back().time() != m_values.back().time())
+          appendEntries(outputs[target_i], numEntries - 1, numEntries);
         fill_target_set.insert(target_i);
         // quit loop if it goes over all the targets
         if (fill_target_set.size() == target_set.size())
@@ -731,6 +718,10 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
     }
   }
 
+  // the entries were appended directly: bring the sizes up to date
+  for (auto output : outputs)
+    output->m_size = output->realSize();
+
   // Add a debugging check such that there won't be any time entry with zero log
   for (size_t i = 0; i < outputs.size(); ++i) {
     if (outputs[i]->size() == 0) {
@@ -1266,6 +1257,28 @@ void TimeSeriesProperty<TYPE>::addValues(
     m_propSortedFlag = TimeSeriesSortStatus::TSUNKNOWN;
 }
 
+/** Append a block of entries, that are already sorted by time, to the end of
+ * the series. Used when copying contiguous runs of entries out of another
+ * series without going through addValue for each of them.
+ *  @param first :: Iterator to the first entry to append
+ *  @param last :: Iterator one past the last entry to append
+ */
+template <typename TYPE>
+void TimeSeriesProperty<TYPE>::appendSortedRange(
+    typename std::vector<TimeValueUnit<TYPE>>::const_iterator first,
+    typename std::vector<TimeValueUnit<TYPE>>::const_iterator last) {
+  if (first == last)
+    return;
+  if (m_values.empty()) {
+    m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
+  } else if (first->time() < m_values.back().time()) {
+    m_propSortedFlag = TimeSeriesSortStatus::TSUNSORTED;
+  }
+  m_values.insert(m_values.end(), first, last);
+  m_size = static_cast<int>(m_values.size());
+  m_filterApplied = false;
+}
+
 /** replace vectors of values to the map. First we clear the vectors
  * and then we run addValues
  *  @param times :: The time as a boost::posix_time::ptime value
@@ -1527,11 +1540,41 @@ void TimeSeriesProperty<TYPE>::create(
     throw std::invalid_argument("TimeSeriesProperty::create: mismatched size "
                                 "for the time and values vectors.");
 
-  // Make the times(as seconds) into a vector of DateAndTime in one go.
-  std::vector<DateAndTime> times;
-  DateAndTime::createVector(start_time, time_sec, times);
+  // Convert the seconds as DateAndTime::createVector does, but straight into
+  // the entries.
+  const int64_t start = start_time.totalNanoseconds();
+  createFromTimes(
+      [start, &time_sec](const size_t i) {
+        return DateAndTime(start +
+                           static_cast<int64_t>(time_sec[i] * 1000000000.0));
+      },
+      new_values);
+}
+
+//--------------------------------------------------------------------------------------------
+/**
+ * Clears and creates a TimeSeriesProperty from these parameters:
+ *  @param start_time :: The reference time
+ *  @param time_nanoseconds :: A vector of time offset (from start_time) in
+ * nanoseconds.
+ *  @param new_values :: A vector of values, each corresponding to the time
+ * offset in time_nanoseconds.
+ *    Vector sizes must match.
+ */
+template <typename TYPE>
+void TimeSeriesProperty<TYPE>::create(
+    const Types::Core::DateAndTime &start_time,
+    const std::vector<int64_t> &time_nanoseconds,
+    const std::vector<TYPE> &new_values) {
+  if (time_nanoseconds.size() != new_values.size())
+    throw std::invalid_argument("TimeSeriesProperty::create: mismatched size "
+                                "for the time and values vectors.");
 
-  this->create(times, new_values);
+  createFromTimes(
+      [&start_time, &time_nanoseconds](const size_t i) {
+        return start_time + time_nanoseconds[i];
+      },
+      new_values);
 }
 
 //--------------------------------------------------------------------------------------------
@@ -1550,17 +1593,30 @@ void TimeSeriesProperty<TYPE>::create(
     throw std::invalid_argument("TimeSeriesProperty::create: mismatched size "
                                 "for the time and values vectors.");
 
-  clear();
-  m_values.reserve(new_times.size());
+  createFromTimes([&new_times](const size_t i) { return new_times[i]; },
+                  new_values);
+}
 
-  std::size_t num = new_values.size();
+/** Clears the property and fills it with the values at the times given by a
+ * function of their index, in a single pass that also finds if the times are
+ * sorted. No temporary vector of times is needed.
+ *
+ * @param timeAt :: Returns the DateAndTime of the value with the given index
+ * @param new_values :: The values
+ */
+template <typename TYPE>
+template <typename TimeAt>
+void TimeSeriesProperty<TYPE>::createFromTimes(
+    TimeAt timeAt, const std::vector<TYPE> &new_values) {
+  clear();
+  const std::size_t num = new_values.size();
+  m_values.reserve(num);
 
   m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   for (std::size_t i = 0; i < num; i++) {
-    TimeValueUnit<TYPE> newentry(new_times[i], new_values[i]);
-    m_values.push_back(newentry);
+    m_values.emplace_back(timeAt(i), new_values[i]);
     if (m_propSortedFlag == TimeSeriesSortStatus::TSSORTED && i > 0 &&
-        new_times[i - 1] > new_times[i]) {
+        m_values[i - 1].time() > m_values[i].time()) {
       // Status gets to unsorted
       m_propSortedFlag = TimeSeriesSortStatus::TSUNSORTED;
     }
@@ -2549,9 +2605,19 @@ std::vector<TYPE> TimeSeriesProperty<TYPE>::filteredValuesAsVector() const {
   }
   sortIfNecessary();
 
+  // The values and the filter are both sorted by time so walk them together
+  // rather than searching the filter for every value
   std::vector<TYPE> filteredValues;
+  filteredValues.reserve(m_values.size());
+  auto filterEntry = m_filter.cbegin();
+  bool included = !m_filter.front().second;
   for (const auto &value : m_values) {
-    if (isTimeFiltered(value.time())) {
+    while (filterEntry != m_filter.cend() &&
+           filterEntry->first <= value.time()) {
+      included = filterEntry->second;
+      ++filterEntry;
+    }
+    if (included) {
       filteredValues.emplace_back(value.value());
     }
   }
@@ -2559,43 +2625,6 @@ std::vector<TYPE> TimeSeriesProperty<TYPE>::filteredValuesAsVector() const {
   return filteredValues;
 }
 
-/**
- * Find out if the given time is included in the filtered data
- * i.e. it does not lie in an excluded region. This function assumes
- * the filter is not empty, it has been applied and the values are
- * sorted by time.
- * @param time :: [input] Time to check
- * @returns :: True if time is in an included region, false if the filter
- * excludes it.
- */
-template <typename TYPE>
-bool TimeSeriesProperty<TYPE>::isTimeFiltered(
-    const Types::Core::DateAndTime &time) const {
-  // Each time/value pair in the filter defines a point where the region defined
-  // after that time is either included/excluded depending on the boolean value.
-  // By definition of the filter construction the region before a given filter
-  // time must have the opposite value. For times outside the filter region:
-  //   1. time < first filter time: inverse of the first filter value
-  //   2. time > last filter time: value of the last filter value
-  // If time == a filter time then the value is taken to belong to that filter
-  // region and not the previous
-
-  // Find first fitler time strictly greater than time
-  auto filterEntry = std::lower_bound(
-      m_filter.begin(), m_filter.end(), time,
-      [](const std::pair<Types::Core::DateAndTime, bool> &filterEntry,
-         const Types::Core::DateAndTime &t) { return filterEntry.first <= t; });
-
-  if (filterEntry == m_filter.begin()) {
-    return !filterEntry->second;
-  } else {
-    // iterator points to filter greater than time and but we want the previous
-    // region
-    --filterEntry;
-    return filterEntry->second;
-  }
-}
-
 /**
  * Get a list of the splitting intervals, if filtering is enabled.
  * Otherwise the interval is just first time - last time.
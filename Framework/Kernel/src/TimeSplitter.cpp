@@ -6,6 +6,11 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidKernel/TimeSplitter.h"
 
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
 namespace Mantid {
 
 using namespace Types::Core;
@@ -99,6 +104,23 @@ bool isFilter(const TimeSplitterType &a) {
   return (max <= 0);
 }
 
+namespace {
+//------------------------------------------------------------------------------------------------
+/** Return true if the intervals of the TimeSplitterType are valid, sorted by
+ * start time and do not overlap each other, so that their stop times are
+ * sorted as well.
+ */
+bool isSortedWithoutOverlap(const TimeSplitterType &a) {
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].stop() < a[i].start())
+      return false;
+    if (i > 0 && a[i].start() < a[i - 1].stop())
+      return false;
+  }
+  return true;
+}
+} // namespace
+
 //------------------------------------------------------------------------------------------------
 /** Plus operator for TimeSplitterType.
  * Combines a filter and a splitter by removing entries that are filtered out
@@ -153,8 +175,33 @@ TimeSplitterType operator&(const TimeSplitterType &a,
   TimeSplitterType::const_iterator ait;
   TimeSplitterType::const_iterator bit;
 
-  // For now, a simple double iteration. Can be made smarter if a and b are
-  // sorted.
+  if (isSortedWithoutOverlap(b)) {
+    // Only the intervals of b from the first one that stops at or after the
+    // start of ait up to the last one that starts at or before the stop of
+    // ait can overlap with it, and they can be found by binary search.
+    for (ait = a.begin(); ait != a.end(); ++ait) {
+      if (ait->stop() < ait->start()) {
+        // Not a valid interval, so check it against every interval of b
+        for (bit = b.begin(); bit != b.end(); ++bit)
+          if (ait->overlaps(*bit))
+            out.push_back(*ait & *bit);
+        continue;
+      }
+      const DateAndTime start = ait->start();
+      bit = std::lower_bound(b.begin(), b.end(), start,
+                             [](const SplittingInterval &interval,
+                                const DateAndTime &time) {
+                               return interval.stop() < time;
+                             });
+      for (; bit != b.end() && bit->start() <= ait->stop(); ++bit) {
+        if (ait->overlaps(*bit))
+          out.push_back(*ait & *bit);
+      }
+    }
+    return out;
+  }
+
+  // Otherwise a simple double iteration
   for (ait = a.begin(); ait != a.end(); ++ait) {
     for (bit = b.begin(); bit != b.end(); ++bit) {
       if (ait->overlaps(*bit)) {
@@ -275,5 +322,80 @@ TimeSplitterType operator~(const TimeSplitterType &a) {
   }
   return out;
 }
+
+//------------------------------------------------------------------------------------------------
+/** Build the index of a splitter
+ *
+ * @param splitter :: The splitter, in any order. Empty intervals are ignored.
+ * @throw std::invalid_argument if any of the intervals overlap.
+ */
+TimeSplitterIndex::TimeSplitterIndex(const TimeSplitterType &splitter) {
+  TimeSplitterType sorted;
+  sorted.reserve(splitter.size());
+  std::copy_if(splitter.cbegin(), splitter.cend(), std::back_inserter(sorted),
+               [](const SplittingInterval &interval) {
+                 return interval.stop() > interval.start();
+               });
+  if (!std::is_sorted(sorted.cbegin(), sorted.cend()))
+    std::stable_sort(sorted.begin(), sorted.end());
+
+  m_times.reserve(2 * sorted.size());
+  m_destinations.reserve(2 * sorted.size());
+  for (const auto &interval : sorted) {
+    const int64_t start = interval.start().totalNanoseconds();
+    if (m_times.empty()) {
+      m_times.push_back(start);
+    } else if (start > m_times.back()) {
+      // A gap since the previous interval
+      m_destinations.push_back(-1);
+      m_times.push_back(start);
+    } else if (start < m_times.back()) {
+      std::ostringstream msg;
+      msg << "TimeSplitterIndex: the interval starting at " << interval.start()
+          << " overlaps with the previous one.";
+      throw std::invalid_argument(msg.str());
+    }
+    m_destinations.push_back(interval.index());
+    m_times.push_back(interval.stop().totalNanoseconds());
+  }
+}
+
+/** Find the destination of a time
+ *
+ * @param time :: The time to look up
+ * @return The index of the interval holding the time, or -1 if no interval
+ * holds it.
+ */
+int TimeSplitterIndex::destination(const DateAndTime &time) const {
+  return destination(time.totalNanoseconds());
+}
+
+/** Find the destination of a time
+ *
+ * @param time :: The time to look up, in nanoseconds
+ * @return The index of the interval holding the time, or -1 if no interval
+ * holds it.
+ */
+int TimeSplitterIndex::destination(const int64_t time) const {
+  // The first boundary after the time ends the interval holding it
+  const auto upper = std::upper_bound(m_times.cbegin(), m_times.cend(), time);
+  if (upper == m_times.cbegin() || upper == m_times.cend())
+    return -1;
+  return m_destinations[std::distance(m_times.cbegin(), upper) - 1];
+}
+
+/** Return the intervals held in the index as a sorted splitter, without the
+ * gaps.
+ */
+TimeSplitterType TimeSplitterIndex::splitter() const {
+  TimeSplitterType out;
+  for (size_t i = 0; i < m_destinations.size(); ++i) {
+    if (m_destinations[i] >= 0)
+      out.emplace_back(DateAndTime(m_times[i]), DateAndTime(m_times[i + 1]),
+                       m_destinations[i]);
+  }
+  return out;
+}
+
 } // namespace Kernel
 } // namespace Mantid
@@ -0,0 +1,236 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/TraceRecorder.h"
+#include "MantidKernel/ConfigService.h"
+
+#include <Poco/Process.h>
+
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// Maximum number of events kept, to bound the memory used by long sessions
+const size_t MAX_EVENTS = 1000000;
+
+/// Write a string as a JSON string
+void writeString(std::ostream &out, const std::string &value) {
+  out << '"';
+  for (const char c : value) {
+    switch (c) {
+    case '"':
+      out << "\\\"";
+      break;
+    case '\\':
+      out << "\\\\";
+      break;
+    case '\n':
+      out << "\\n";
+      break;
+    case '\t':
+      out << "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20)
+        out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+            << static_cast<int>(c) << std::dec << std::setfill(' ');
+      else
+        out << c;
+    }
+  }
+  out << '"';
+}
+} // namespace
+
+/// Constructor. Starts recording if "tracing.file" is set.
+TraceRecorderImpl::TraceRecorderImpl() : m_origin(Clock::now()) {
+  const auto filename = ConfigService::Instance().getString("tracing.file");
+  if (!filename.empty())
+    enable(filename);
+}
+
+/// Destructor. Writes the trace if a file was given.
+TraceRecorderImpl::~TraceRecorderImpl() {
+  if (!m_filename.empty())
+    save();
+}
+
+/** Start recording
+ * @param filename :: the file save() writes the trace to. If empty the file
+ * given before, if any, is kept.
+ */
+void TraceRecorderImpl::enable(const std::string &filename) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!filename.empty())
+    m_filename = filename;
+  m_enabled = true;
+}
+
+/// Stop recording. The events recorded so far are kept.
+void TraceRecorderImpl::disable() { m_enabled = false; }
+
+/** Record a span. Spans are shown nested in the viewers when they run in the
+ * same thread and one contains the other.
+ * @param name :: name of the span
+ * @param category :: category of the span, a string literal
+ * @param start :: start of the span
+ * @param end :: end of the span
+ * @param args :: extra information about the span
+ */
+void TraceRecorderImpl::addSpan(std::string name, const char *category,
+                                const Clock::time_point start,
+                                const Clock::time_point end, Args args) {
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+  const auto begin = duration_cast<microseconds>(start - m_origin).count();
+  const auto duration = duration_cast<microseconds>(end - start).count();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_events.size() >= MAX_EVENTS) {
+    ++m_dropped;
+    return;
+  }
+  m_events.push_back(Event{std::move(name), category, 'X',
+                           threadIndex(std::this_thread::get_id()), begin,
+                           duration, std::move(args)});
+}
+
+/** Record the value of a counter at the current time, such as memory in use.
+ * The viewers plot each counter as a graph.
+ * @param name :: name of the counter
+ * @param value :: its value
+ */
+void TraceRecorderImpl::addCounter(std::string name, const double value) {
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+  const auto now =
+      duration_cast<microseconds>(Clock::now() - m_origin).count();
+  std::ostringstream valueStr;
+  valueStr << value;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_events.size() >= MAX_EVENTS) {
+    ++m_dropped;
+    return;
+  }
+  m_events.push_back(Event{std::move(name), "counter", 'C',
+                           threadIndex(std::this_thread::get_id()), now, 0,
+                           Args{{"value", valueStr.str()}}});
+}
+
+/// @return the number of events recorded
+size_t TraceRecorderImpl::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_events.size();
+}
+
+/// Remove the events recorded
+void TraceRecorderImpl::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.clear();
+  m_dropped = 0;
+}
+
+/** Write the events in the JSON object format of Chrome traces
+ * @param out :: the stream to write to
+ */
+void TraceRecorderImpl::write(std::ostream &out) const {
+  const auto pid = Poco::Process::id();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  out << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":"
+      << m_dropped << "},\"traceEvents\":[";
+  bool first = true;
+  for (const auto &thread : m_threads) {
+    out << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\","
+        << "\"pid\":" << pid << ",\"tid\":" << thread.second
+        << ",\"args\":{\"name\":\"Thread " << thread.second << "\"}}";
+    first = false;
+  }
+  for (const auto &event : m_events) {
+    out << (first ? "\n" : ",\n") << "{\"name\":";
+    writeString(out, event.name);
+    out << ",\"cat\":\"" << event.category << "\",\"ph\":\"" << event.phase
+        << "\",\"pid\":" << pid << ",\"tid\":" << event.thread
+        << ",\"ts\":" << event.start;
+    if (event.phase == 'X')
+      out << ",\"dur\":" << event.duration;
+    if (!event.args.empty()) {
+      out << ",\"args\":{";
+      for (auto arg = event.args.cbegin(); arg != event.args.cend(); ++arg) {
+        if (arg != event.args.cbegin())
+          out << ',';
+        writeString(out, arg->first);
+        out << ':';
+        // Counters must be numbers to be plotted
+        if (event.phase == 'C')
+          out << arg->second;
+        else
+          writeString(out, arg->second);
+      }
+      out << '}';
+    }
+    out << '}';
+    first = false;
+  }
+  out << "\n]}\n";
+}
+
+/** Write the trace to the file given to enable() or in "tracing.file"
+ * @return true if the file was written
+ */
+bool TraceRecorderImpl::save() const {
+  if (m_filename.empty())
+    return false;
+  std::ofstream out(m_filename);
+  if (!out)
+    return false;
+  write(out);
+  return static_cast<bool>(out);
+}
+
+/// @return a small number for a thread, in the order the threads were seen.
+/// Must be called with the mutex locked.
+unsigned TraceRecorderImpl::threadIndex(const std::thread::id id) {
+  const auto next = static_cast<unsigned>(m_threads.size());
+  return m_threads.emplace(id, next).first->second;
+}
+
+//-------------------------------------------------------------------------------
+/** Start a span
+ * @param name :: name of the span
+ * @param category :: category of the span, a string literal
+ */
+TraceSpan::TraceSpan(std::string name, const char *category)
+    : m_active(TraceRecorder::Instance().isEnabled()), m_category(category) {
+  if (m_active) {
+    m_name = std::move(name);
+    m_start = TraceRecorderImpl::Clock::now();
+  }
+}
+
+/// Record the span, if recording was on when it started
+TraceSpan::~TraceSpan() {
+  if (m_active)
+    TraceRecorder::Instance().addSpan(std::move(m_name), m_category, m_start,
+                                      TraceRecorderImpl::Clock::now(),
+                                      std::move(m_args));
+}
+
+/** Attach extra information to the span. Does nothing if the span is not
+ * recorded.
+ * @param key :: name of the information
+ * @param value :: its value
+ */
+void TraceSpan::addArg(const std::string &key, const std::string &value) {
+  if (m_active)
+    m_args.emplace_back(key, value);
+}
+
+} // namespace Kernel
+} // namespace Mantid
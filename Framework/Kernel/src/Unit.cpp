@@ -11,6 +11,7 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/UnitLabelTypes.h"
+#include <algorithm>
 #include <cfloat>
 
 namespace Mantid {
@@ -144,9 +145,12 @@ void Unit::toTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                  const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleToTOF(xdata[i]);
+  this->toTOFRange(xdata.data(), xdata.data() + xdata.size());
+}
+
+void Unit::toTOFRange(double *first, double *last) const {
+  std::transform(first, last, first,
+                 [this](const double x) { return this->singleToTOF(x); });
 }
 
 /** Convert a single value to TOF
@@ -175,9 +179,12 @@ void Unit::fromTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                    const double &_efixed, const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleFromTOF(xdata[i]);
+  this->fromTOFRange(xdata.data(), xdata.data() + xdata.size());
+}
+
+void Unit::fromTOFRange(double *first, double *last) const {
+  std::transform(first, last, first,
+                 [this](const double tof) { return this->singleFromTOF(tof); });
 }
 
 /** Convert a single value from TOF
@@ -293,6 +300,18 @@ double TOF::singleFromTOF(const double tof) const {
   return tof;
 }
 
+void TOF::toTOFRange(double *first, double *last) const {
+  // Nothing to do
+  UNUSED_ARG(first);
+  UNUSED_ARG(last);
+}
+
+void TOF::fromTOFRange(double *first, double *last) const {
+  // Nothing to do
+  UNUSED_ARG(first);
+  UNUSED_ARG(last);
+}
+
 Unit *TOF::clone() const { return new TOF(*this); }
 double TOF::conversionTOFMin() const { return -DBL_MAX; }
 ///@return DBL_MAX as ToF convetanble to TOF for in any time range
@@ -394,6 +413,30 @@ double Wavelength::singleFromTOF(const double tof) const {
   x *= factorFrom;
   return x;
 }
+
+void Wavelength::toTOFRange(double *first, double *last) const {
+  const double factor = factorTo;
+  if (emode == 1 || emode == 2) {
+    const double sfp = sfpTo;
+    for (auto x = first; x != last; ++x)
+      *x = *x * factor + sfp;
+  } else {
+    for (auto x = first; x != last; ++x)
+      *x *= factor;
+  }
+}
+
+void Wavelength::fromTOFRange(double *first, double *last) const {
+  const double factor = factorFrom;
+  if (do_sfpFrom) {
+    const double sfp = sfpFrom;
+    for (auto x = first; x != last; ++x)
+      *x = (*x - sfp) * factor;
+  } else {
+    for (auto x = first; x != last; ++x)
+      *x *= factor;
+  }
+}
 ///@return  Minimal time of flight, which can be reversively converted into
 /// wavelength
 double Wavelength::conversionTOFMin() const {
@@ -576,6 +619,18 @@ double dSpacing::singleToTOF(const double x) const { return x * factorTo; }
 double dSpacing::singleFromTOF(const double tof) const {
   return tof / factorFrom;
 }
+
+void dSpacing::toTOFRange(double *first, double *last) const {
+  const double factor = factorTo;
+  for (auto x = first; x != last; ++x)
+    *x *= factor;
+}
+
+void dSpacing::fromTOFRange(double *first, double *last) const {
+  const double factor = factorFrom;
+  for (auto x = first; x != last; ++x)
+    *x /= factor;
+}
 double dSpacing::conversionTOFMin() const { return 0; }
 double dSpacing::conversionTOFMax() const { return DBL_MAX / factorTo; }
 
@@ -687,6 +742,18 @@ double MomentumTransfer::singleFromTOF(const double tof) const {
   return factorFrom / temp;
 }
 
+void MomentumTransfer::toTOFRange(double *first, double *last) const {
+  const double factor = factorTo;
+  for (auto x = first; x != last; ++x)
+    *x = factor / (*x == 0.0 ? DBL_MIN : *x);
+}
+
+void MomentumTransfer::fromTOFRange(double *first, double *last) const {
+  const double factor = factorFrom;
+  for (auto x = first; x != last; ++x)
+    *x = factor / (*x == 0.0 ? DBL_MIN : *x);
+}
+
 double MomentumTransfer::conversionTOFMin() const {
   return factorFrom / DBL_MAX;
 }
@@ -860,6 +927,46 @@ double DeltaE::singleFromTOF(const double tof) const {
     return DBL_MAX;
 }
 
+void DeltaE::toTOFRange(double *first, double *last) const {
+  // The sign of the energy transfer depends on the energy mode
+  const double sign = (emode == 1) ? -1.0 : 1.0;
+  const double tofMax = DeltaE::conversionTOFMax();
+  if (emode != 1 && emode != 2) {
+    std::fill(first, last, tofMax);
+    return;
+  }
+  const double factor = factorTo;
+  const double scaling = unitScaling;
+  const double offset = t_other;
+  const double energy = efixed;
+  for (auto x = first; x != last; ++x) {
+    const double e = energy + sign * (*x / scaling);
+    *x = (e <= 0.0) ? tofMax : factor / std::sqrt(e) + offset;
+  }
+}
+
+void DeltaE::fromTOFRange(double *first, double *last) const {
+  if (emode != 1 && emode != 2) {
+    std::fill(first, last, DBL_MAX);
+    return;
+  }
+  const double factor = factorFrom;
+  const double scaling = unitScaling;
+  const double offset = t_otherFrom;
+  const double energy = efixed;
+  if (emode == 1) {
+    for (auto x = first; x != last; ++x) {
+      const double t = *x - offset;
+      *x = (t <= 0.0) ? -DBL_MAX : (energy - factor / (t * t)) * scaling;
+    }
+  } else {
+    for (auto x = first; x != last; ++x) {
+      const double t = *x - offset;
+      *x = (t <= 0.0) ? DBL_MAX : (factor / (t * t) - energy) * scaling;
+    }
+  }
+}
+
 double DeltaE::conversionTOFMin() const {
   double time(
       DBL_MAX); // impossible for elastic, this units do not work for elastic
@@ -1107,6 +1214,15 @@ double SpinEchoLength::singleFromTOF(const double tof) const {
   return x;
 }
 
+// The conversions of Wavelength do not apply
+void SpinEchoLength::toTOFRange(double *first, double *last) const {
+  Unit::toTOFRange(first, last);
+}
+
+void SpinEchoLength::fromTOFRange(double *first, double *last) const {
+  Unit::fromTOFRange(first, last);
+}
+
 Unit *SpinEchoLength::clone() const { return new SpinEchoLength(*this); }
 
 // ============================================================================================
@@ -1152,6 +1268,15 @@ double SpinEchoTime::singleFromTOF(const double tof) const {
   return x;
 }
 
+// The conversions of Wavelength do not apply
+void SpinEchoTime::toTOFRange(double *first, double *last) const {
+  Unit::toTOFRange(first, last);
+}
+
+void SpinEchoTime::fromTOFRange(double *first, double *last) const {
+  Unit::fromTOFRange(first, last);
+}
+
 Unit *SpinEchoTime::clone() const { return new SpinEchoTime(*this); }
 
 // ================================================================================
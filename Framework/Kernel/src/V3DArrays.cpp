@@ -0,0 +1,169 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/V3DArrays.h"
+#include "MantidKernel/Matrix.h"
+#include "MantidKernel/Quat.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Kernel {
+
+/** Constructor
+ * @param size :: The number of vectors, which are all zero
+ */
+V3DArrays::V3DArrays(const size_t size)
+    : m_x(size, 0.0), m_y(size, 0.0), m_z(size, 0.0) {}
+
+/** Constructor
+ * @param vectors :: The vectors to hold
+ */
+V3DArrays::V3DArrays(const std::vector<V3D> &vectors) {
+  reserve(vectors.size());
+  for (const auto &vector : vectors) {
+    push_back(vector);
+  }
+}
+
+/** Change the number of vectors. New vectors are zero.
+ * @param size :: The new number of vectors
+ */
+void V3DArrays::resize(const size_t size) {
+  m_x.resize(size, 0.0);
+  m_y.resize(size, 0.0);
+  m_z.resize(size, 0.0);
+}
+
+/** Reserve storage for a number of vectors
+ * @param size :: The number of vectors to reserve storage for
+ */
+void V3DArrays::reserve(const size_t size) {
+  m_x.reserve(size);
+  m_y.reserve(size);
+  m_z.reserve(size);
+}
+
+/** Append a vector
+ * @param vector :: The vector to append
+ */
+void V3DArrays::push_back(const V3D &vector) {
+  m_x.push_back(vector.X());
+  m_y.push_back(vector.Y());
+  m_z.push_back(vector.Z());
+}
+
+/** Set the i-th vector
+ * @param i :: The index of the vector
+ * @param vector :: The new value of the vector
+ */
+void V3DArrays::set(const size_t i, const V3D &vector) {
+  m_x[i] = vector.X();
+  m_y[i] = vector.Y();
+  m_z[i] = vector.Z();
+}
+
+/** Rotate all vectors, as Quat::rotate does for a single one. The quaternion
+ * is turned into a rotation matrix once, so each vector only takes a matrix
+ * product.
+ * @param rotation :: The rotation to apply
+ */
+void V3DArrays::rotate(const Quat &rotation) {
+  Quat unitRotation(rotation);
+  unitRotation.normalize();
+  const auto elements = unitRotation.getRotation();
+  const double matrix[3][3] = {{elements[0], elements[1], elements[2]},
+                               {elements[3], elements[4], elements[5]},
+                               {elements[6], elements[7], elements[8]}};
+  applyMatrix(matrix);
+}
+
+/** Replace each vector v by the product matrix * v, as for a single V3D, e.g.
+ * to apply a UB matrix to many vectors.
+ * @param matrix :: A 3x3 matrix
+ * @throw std::invalid_argument if the matrix is not 3x3
+ */
+void V3DArrays::multiply(const Matrix<double> &matrix) {
+  if (matrix.numRows() != 3 || matrix.numCols() != 3) {
+    throw std::invalid_argument(
+        "V3DArrays::multiply requires a 3x3 matrix.");
+  }
+  const double elements[3][3] = {{matrix[0][0], matrix[0][1], matrix[0][2]},
+                                 {matrix[1][0], matrix[1][1], matrix[1][2]},
+                                 {matrix[2][0], matrix[2][1], matrix[2][2]}};
+  applyMatrix(elements);
+}
+
+/** Calculate the distance of each vector from a point
+ * @param point :: The point to measure the distances from
+ * @param result :: [Output] The distances, resized to the number of vectors
+ */
+void V3DArrays::distances(const V3D &point,
+                          std::vector<double> &result) const {
+  const size_t n = size();
+  result.resize(n);
+  const double px = point.X();
+  const double py = point.Y();
+  const double pz = point.Z();
+  const double *x = m_x.data();
+  const double *y = m_y.data();
+  const double *z = m_z.data();
+  double *out = result.data();
+  for (size_t i = 0; i < n; ++i) {
+    const double dx = x[i] - px;
+    const double dy = y[i] - py;
+    const double dz = z[i] - pz;
+    out[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+}
+
+/** Calculate the distance of a point from each of the lines through the
+ * origin along these vectors, which must be unit vectors. This is the norm of
+ * point - v * (point . v) for each vector v.
+ * @param point :: The point to measure the distances from
+ * @param result :: [Output] The distances, resized to the number of vectors
+ */
+void V3DArrays::distancesToLines(const V3D &point,
+                                 std::vector<double> &result) const {
+  const size_t n = size();
+  result.resize(n);
+  const double px = point.X();
+  const double py = point.Y();
+  const double pz = point.Z();
+  const double *x = m_x.data();
+  const double *y = m_y.data();
+  const double *z = m_z.data();
+  double *out = result.data();
+  for (size_t i = 0; i < n; ++i) {
+    const double projection = px * x[i] + py * y[i] + pz * z[i];
+    const double dx = px - x[i] * projection;
+    const double dy = py - y[i] * projection;
+    const double dz = pz - z[i] * projection;
+    out[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+}
+
+/** Replace each vector v by matrix * v
+ * @param matrix :: The 3x3 matrix, row by row
+ */
+void V3DArrays::applyMatrix(const double (&matrix)[3][3]) {
+  const size_t n = size();
+  double *x = m_x.data();
+  double *y = m_y.data();
+  double *z = m_z.data();
+  for (size_t i = 0; i < n; ++i) {
+    const double vx = x[i];
+    const double vy = y[i];
+    const double vz = z[i];
+    x[i] = matrix[0][0] * vx + matrix[0][1] * vy + matrix[0][2] * vz;
+    y[i] = matrix[1][0] * vx + matrix[1][1] * vy + matrix[1][2] * vz;
+    z[i] = matrix[2][0] * vx + matrix[2][1] * vy + matrix[2][2] * vz;
+  }
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -151,13 +151,35 @@ void rebin(const std::vector<double> &xold, const std::vector<double> &yold,
     throw std::runtime_error("rebin: new y and error vectors should be of same "
                              "size & 1 shorter than x");
 
-  size_t size_yold = yold.size();
-  size_t size_ynew = ynew.size();
+  rebin(xold.data(), yold.data(), eold.data(), yold.size(), xnew.data(),
+        ynew.data(), enew.data(), ynew.size(), distribution, addition);
+}
 
+/** Rebins data according to a new output X array, reading and writing arrays
+ *  owned by the caller so that no memory is allocated.
+ *
+ *  @param[in] xold Old X array of data, of length size_yold + 1.
+ *  @param[in] yold Old Y array of data, of length size_yold.
+ *  @param[in] eold Old error array of data, of length size_yold.
+ *  @param[in] size_yold The number of old bins.
+ *  @param[in] xnew X array of data to rebin to, of length size_ynew + 1.
+ *  @param[out] ynew Rebinned data, of length size_ynew.
+ *  @param[out] enew Rebinned errors, of length size_ynew.
+ *  @param[in] size_ynew The number of new bins.
+ *  @param[in] distribution Flag defining if distribution data (true) or not
+ *(false).
+ *  @param[in] addition If true, rebinned values are added to the existing
+ *ynew/enew values, as for the std::vector overload.
+ *  @throw invalid_argument Thrown if input to function is incorrect.
+ **/
+void rebin(const double *xold, const double *yold, const double *eold,
+           const size_t size_yold, const double *xnew, double *ynew,
+           double *enew, const size_t size_ynew, bool distribution,
+           bool addition) {
   if (!addition) {
     // Make sure ynew & enew contain zeroes
-    std::fill(ynew.begin(), ynew.end(), 0.0);
-    std::fill(enew.begin(), enew.end(), 0.0);
+    std::fill(ynew, ynew + size_ynew, 0.0);
+    std::fill(enew, enew + size_ynew, 0.0);
   }
 
   size_t iold = 0, inew = 0;
@@ -234,11 +256,44 @@ void rebin(const std::vector<double> &xold, const std::vector<double> &yold,
       // non-distribution, just square root final error value
       using pf = double (*)(double);
       pf uf = std::sqrt;
-      std::transform(enew.begin(), enew.end(), enew.begin(), uf);
+      std::transform(enew, enew + size_ynew, enew, uf);
     }
   }
 }
 
+namespace {
+/** Find the first old and new bins that can overlap, skipping the bins at the
+ *  start of either X array that lie below the start of the other.
+ *  @param[in] xold Old X array, of length size_yold + 1.
+ *  @param[in] size_yold The number of old bins.
+ *  @param[in] xnew New X array, of length size_ynew + 1.
+ *  @param[in] size_ynew The number of new bins.
+ *  @param[out] iold The index of the first old bin to consider.
+ *  @param[out] inew The index of the first new bin to consider.
+ *  @return false if the X arrays do not overlap at all
+ */
+bool findFirstOverlap(const double *xold, const size_t size_yold,
+                      const double *xnew, const size_t size_ynew, size_t &iold,
+                      size_t &inew) {
+  if (xnew[0] > xold[0]) {
+    const auto xoldEnd = xold + size_yold + 1;
+    const auto it = std::upper_bound(xold, xoldEnd, xnew[0]);
+    if (it == xoldEnd)
+      return false;
+    // Old bin to start at (counting from 0)
+    iold = std::distance(xold, it) - 1;
+  } else {
+    const auto xnewEnd = xnew + size_ynew + 1;
+    const auto it = std::upper_bound(xnew, xnewEnd, xold[0]);
+    if (it == xnewEnd)
+      return false;
+    // New bin to start at (counting from 0)
+    inew = std::distance(xnew, it) - 1;
+  }
+  return true;
+}
+} // namespace
+
 //-------------------------------------------------------------------------------------------------
 /** Rebins histogram data according to a new output X array. Should be faster
  *than previous one.
@@ -271,30 +326,39 @@ void rebinHistogram(const std::vector<double> &xold,
     throw std::runtime_error(
         "rebin: y and error vectors should be of same size & 1 shorter than x");
 
+  rebinHistogram(xold.data(), yold.data(), eold.data(), size_yold, xnew.data(),
+                 ynew.data(), enew.data(), size_ynew, addition);
+}
+
+/** Rebins histogram data according to a new output X array, reading and
+ *  writing arrays owned by the caller so that no memory is allocated.
+ *
+ *  @param[in] xold Old X array of data, of length size_yold + 1.
+ *  @param[in] yold Old Y array of data, of length size_yold.
+ *  @param[in] eold Old error array of data, of length size_yold.
+ *  @param[in] size_yold The number of old bins.
+ *  @param[in] xnew X array of data to rebin to, of length size_ynew + 1.
+ *  @param[out] ynew Rebinned data, of length size_ynew.
+ *  @param[out] enew Rebinned errors, of length size_ynew.
+ *  @param[in] size_ynew The number of new bins.
+ *  @param[in] addition If true, rebinned values are added to the existing
+ *ynew/enew values and enew holds the squared errors.
+ **/
+void rebinHistogram(const double *xold, const double *yold,
+                    const double *eold, const size_t size_yold,
+                    const double *xnew, double *ynew, double *enew,
+                    const size_t size_ynew, bool addition) {
   // If not adding to existing vectors, make sure ynew & enew contain zeroes
   if (!addition) {
-    ynew.assign(size_ynew, 0.0);
-    enew.assign(size_ynew, 0.0);
+    std::fill(ynew, ynew + size_ynew, 0.0);
+    std::fill(enew, enew + size_ynew, 0.0);
   }
 
   // Find the starting points to avoid wasting time processing irrelevant bins
   size_t iold = 0, inew = 0; // iold/inew is the bin number under consideration
                              // (counting from 1, so index+1)
-  if (xnew.front() > xold.front()) {
-    auto it = std::upper_bound(xold.cbegin(), xold.cend(), xnew.front());
-    if (it == xold.end())
-      return;
-    //      throw std::runtime_error("No overlap: max of X-old < min of X-new");
-    iold = std::distance(xold.begin(), it) -
-           1; // Old bin to start at (counting from 0)
-  } else {
-    auto it = std::upper_bound(xnew.cbegin(), xnew.cend(), xold.front());
-    if (it == xnew.cend())
-      return;
-    //      throw std::runtime_error("No overlap: max of X-new < min of X-old");
-    inew = std::distance(xnew.cbegin(), it) -
-           1; // New bin to start at (counting from 0)
-  }
+  if (!findFirstOverlap(xold, size_yold, xnew, size_ynew, iold, inew))
+    return;
 
   double frac, fracE;
   double oneOverWidth, overlap;
@@ -309,8 +373,8 @@ void rebinHistogram(const std::vector<double> &xold,
       temp = eold[iold];
       enew[inew] += temp * temp;
       // If the upper bin boundaries were equal, then increment inew
-      if (xold_of_iold_p_1 == xnew[inew + 1])
-        inew++;
+      if (xold_of_iold_p_1 == xnew[inew + 1] && ++inew == size_ynew)
+        break;
     } else {
       double xold_of_iold = xold[iold]; // cache for speed
       // This is the counts per unit X in current old bin
@@ -345,10 +409,101 @@ void rebinHistogram(const std::vector<double> &xold,
     // Now take the root-square of the errors
     using pf = double (*)(double);
     pf uf = std::sqrt;
-    std::transform(enew.begin(), enew.end(), enew.begin(), uf);
+    std::transform(enew, enew + size_ynew, enew, uf);
   }
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Find the overlaps of the bins of one X array with those of another.
+ *  @param[in] xold The bin edges of the histograms to rebin.
+ *  @param[in] xnew The bin edges to rebin to.
+ */
+RebinOverlaps::RebinOverlaps(const std::vector<double> &xold,
+                             const std::vector<double> &xnew)
+    : m_sizeYOld(xold.empty() ? 0 : xold.size() - 1),
+      m_sizeYNew(xnew.empty() ? 0 : xnew.size() - 1) {
+  size_t iold = 0, inew = 0;
+  if (m_sizeYOld == 0 || m_sizeYNew == 0 ||
+      !findFirstOverlap(xold.data(), m_sizeYOld, xnew.data(), m_sizeYNew,
+                        iold, inew))
+    return;
+
+  // The same walk over the bins as in rebinHistogram
+  for (; iold < m_sizeYOld; ++iold) {
+    const double xoldHigh = xold[iold + 1];
+    if (xoldHigh <= xnew[inew + 1]) {
+      m_overlaps.push_back({iold, inew, 1.});
+      if (xoldHigh == xnew[inew + 1] && ++inew == m_sizeYNew)
+        break;
+    } else {
+      const double xoldLow = xold[iold];
+      const double oneOverWidth = 1. / (xoldHigh - xoldLow);
+      while (inew < m_sizeYNew && xnew[inew + 1] <= xoldHigh) {
+        const double overlap = xnew[inew + 1] - std::max(xnew[inew], xoldLow);
+        m_overlaps.push_back({iold, inew, overlap * oneOverWidth});
+        ++inew;
+      }
+      if (inew == m_sizeYNew)
+        break;
+      const double overlap = xoldHigh - xnew[inew];
+      m_overlaps.push_back({iold, inew, overlap * oneOverWidth});
+    }
+  }
+}
+
+/** Rebin a histogram with the old bin edges to the new ones, as
+ *  VectorHelper::rebinHistogram does.
+ *  @param[in] yold Old Y array of data, one shorter than the old X array.
+ *  @param[in] eold Old error array of data, of the same length as yold.
+ *  @param[out] ynew Rebinned data, one shorter than the new X array.
+ *  @param[out] enew Rebinned errors, of the same length as ynew.
+ *  @param[in] addition If true, rebinned values are added to the existing
+ *ynew/enew values and enew holds the squared errors.
+ */
+void RebinOverlaps::rebinHistogram(const double *yold, const double *eold,
+                                   double *ynew, double *enew,
+                                   bool addition) const {
+  if (!addition) {
+    std::fill(ynew, ynew + m_sizeYNew, 0.0);
+    std::fill(enew, enew + m_sizeYNew, 0.0);
+  }
+
+  for (const auto &overlap : m_overlaps) {
+    const double error = eold[overlap.oldIndex];
+    ynew[overlap.newIndex] += yold[overlap.oldIndex] * overlap.fraction;
+    enew[overlap.newIndex] += error * error * overlap.fraction;
+  }
+
+  if (!addition) {
+    using pf = double (*)(double);
+    pf uf = std::sqrt;
+    std::transform(enew, enew + m_sizeYNew, enew, uf);
+  }
+}
+
+/** Rebin a histogram with the old bin edges to the new ones.
+ *  @param[in] yold Old Y array of data, one shorter than the old X array.
+ *  @param[in] eold Old error array of data, of the same length as yold.
+ *  @param[out] ynew Rebinned data, one shorter than the new X array.
+ *  @param[out] enew Rebinned errors, of the same length as ynew.
+ *  @param[in] addition If true, rebinned values are added to the existing
+ *ynew/enew values and enew holds the squared errors.
+ *  @throw runtime_error Thrown if vector sizes are inconsistent
+ */
+void RebinOverlaps::rebinHistogram(const std::vector<double> &yold,
+                                   const std::vector<double> &eold,
+                                   std::vector<double> &ynew,
+                                   std::vector<double> &enew,
+                                   bool addition) const {
+  if (yold.size() != m_sizeYOld || eold.size() != m_sizeYOld)
+    throw std::runtime_error("rebin: old y and error vectors should be 1 "
+                             "shorter than the old x");
+  if (ynew.size() != m_sizeYNew || enew.size() != m_sizeYNew)
+    throw std::runtime_error("rebin: new y and error vectors should be 1 "
+                             "shorter than the new x");
+  rebinHistogram(yold.data(), eold.data(), ynew.data(), enew.data(), addition);
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * Convert the given set of bin boundaries into bin centre values
@@ -7,6 +7,7 @@
 #ifndef ARRAYPROPERTYTEST_H_
 #define ARRAYPROPERTYTEST_H_
 
+#include "MantidKernel/ArrayBoundedValidator.h"
 #include "MantidKernel/ArrayProperty.h"
 #include <array>
 #include <cxxtest/TestSuite.h>
@@ -266,6 +267,20 @@ public:
     TS_ASSERT(sProp->isDefault())
   }
 
+  void test_setValue_with_a_cached_string_still_validates() {
+    ArrayProperty<int> unbounded("unbounded");
+    ArrayProperty<int> bounded(
+        "bounded", boost::make_shared<ArrayBoundedValidator<int>>(0, 5));
+    TS_ASSERT_EQUALS(unbounded.setValue("1,10"), "")
+    TS_ASSERT_EQUALS(unbounded(), std::vector<int>({1, 10}))
+    TS_ASSERT(!bounded.setValue("1,10").empty())
+    TS_ASSERT(bounded.isDefault())
+    TS_ASSERT_EQUALS(bounded.setValue("1-3"), "")
+    TS_ASSERT_EQUALS(unbounded.setValue("1-3"), "")
+    TS_ASSERT_EQUALS(unbounded(), std::vector<int>({1, 2, 3}))
+    TS_ASSERT_EQUALS(bounded(), unbounded())
+  }
+
   void test_SetValueFromJson_Accepts_ArrayValues() {
     const std::array<int, 3> testValues{{1, 2, 3}};
     Json::Value arrayValue{Json::arrayValue};
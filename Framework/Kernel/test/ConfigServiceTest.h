@@ -13,6 +13,7 @@
 #include "MantidKernel/FacilityInfo.h"
 #include "MantidKernel/InstrumentInfo.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TestChannel.h"
 
 #include <Poco/File.h>
@@ -668,6 +669,48 @@ public:
     TS_ASSERT_EQUALS(mantidLegs, false);
   }
 
+  void testValuesReadAfterChangesAreCurrent() {
+    ConfigServiceImpl &settings = ConfigService::Instance();
+    settings.updateConfig(settings.getDirectoryOfExecutable() +
+                          "MantidTest.properties");
+    const std::string key("mantid.legs");
+    TS_ASSERT_EQUALS(settings.getValue<int>(key).get_value_or(0), 6);
+
+    settings.setString(key, "8");
+    TS_ASSERT_EQUALS(settings.getString(key), "8");
+    TS_ASSERT_EQUALS(settings.getValue<int>(key).get_value_or(0), 8);
+    TS_ASSERT_EQUALS(settings.getValue<double>(key).get_value_or(0.), 8.);
+
+    settings.setString(key, "on");
+    TS_ASSERT(!settings.getValue<int>(key));
+    TS_ASSERT(settings.getValue<bool>(key).get_value_or(false));
+
+    settings.remove(key);
+    TS_ASSERT_EQUALS(settings.getString(key), "");
+    TS_ASSERT(!settings.getValue<int>(key));
+
+    settings.updateConfig(settings.getDirectoryOfExecutable() +
+                          "MantidTest.properties");
+    TS_ASSERT_EQUALS(settings.getValue<int>(key).get_value_or(0), 6);
+  }
+
+  void testConcurrentReadsSeeConsistentValues() {
+    ConfigServiceImpl &settings = ConfigService::Instance();
+    settings.updateConfig(settings.getDirectoryOfExecutable() +
+                          "MantidTest.properties");
+    const std::vector<std::string> keys{"mantid.legs", "mantid.thorax",
+                                        "mantid.noses"};
+    std::vector<int> values(300, -1);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+      values[i] = settings.getValue<int>(keys[i % keys.size()]).get_value_or(0);
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+      const int expected[] = {6, 1, 0};
+      TS_ASSERT_EQUALS(values[i], expected[i % keys.size()]);
+    }
+  }
+
 protected:
   bool m_valueChangedSent;
   std::string m_key;
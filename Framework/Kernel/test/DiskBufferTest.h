@@ -79,6 +79,7 @@ public:
 
     for (size_t i = mPos; i < mPos + mMem; i++)
       fakeFile[i] = m_ch;
+    savedPositions.push_back(mPos);
 
     streamMutex.unlock();
     // this is important function call which has to be implemented by any save
@@ -97,11 +98,14 @@ public:
   void flushData() const override {}
 
   static std::string fakeFile;
+  /// The file positions of the blocks, in the order they were written
+  static std::vector<uint64_t> savedPositions;
   static std::mutex streamMutex;
 };
 
 // Declare the static members here.
 std::string SaveableTesterWithFile::fakeFile;
+std::vector<uint64_t> SaveableTesterWithFile::savedPositions;
 std::mutex SaveableTesterWithFile::streamMutex;
 
 //====================================================================================
@@ -114,6 +118,7 @@ public:
     // Create the ISaveables
     num = 10;
     SaveableTesterWithFile::fakeFile = "";
+    SaveableTesterWithFile::savedPositions.clear();
     data.clear();
     for (size_t i = 0; i < num; i++)
       data.push_back(
@@ -203,6 +208,22 @@ public:
     TS_ASSERT_EQUALS(SaveableTesterWithFile::fakeFile, "  BBCCDDEEFF      JJ");
   }
 
+  /** Blocks already on file are written in the order of their positions,
+   * before the new ones */
+  void test_writesInFilePositionOrder() {
+    DiskBuffer dbuf(100);
+    dbuf.setFileLength(20);
+    data[0]->setSaved(false);
+    for (const size_t i : {7, 0, 2, 9, 5}) {
+      data[i]->setDataChanged();
+      dbuf.toWrite(data[i]);
+    }
+    dbuf.flushCache();
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::savedPositions,
+                     std::vector<uint64_t>({4, 10, 14, 18, 20}));
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 0);
+  }
+
   //--------------------------------------------------------------------------------
   /** If a block will get deleted it needs to be taken
    * out of the caches */
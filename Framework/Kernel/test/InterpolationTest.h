@@ -124,6 +124,31 @@ public:
     checkInterpolationResults(interpolation);
   }
 
+  void testValuesAtManyLocationsMatchSingleValues() {
+    Interpolation interpolation =
+        getInitializedInterpolation("Wavelength", "dSpacing");
+
+    // Ascending, then out of order and outside of the interpolation range
+    std::vector<double> at{100.0, 200.0, 200.5, 201.0, 201.25, 203.5,
+                           204.0, 3000.0, 201.5, 200.25, 202.0};
+    std::vector<double> result;
+    interpolation.value(at, result);
+
+    TS_ASSERT_EQUALS(result.size(), at.size());
+    for (size_t i = 0; i < at.size(); ++i) {
+      TS_ASSERT_EQUALS(result[i], interpolation.value(at[i]));
+    }
+  }
+
+  void testValuesAtManyLocationsWithTooFewValues() {
+    Interpolation interpolationOne;
+    interpolationOne.addPoint(200, 2.0);
+
+    std::vector<double> result;
+    interpolationOne.value(m_tableXValues, result);
+    TS_ASSERT_EQUALS(result, std::vector<double>(m_tableXValues.size(), 2.0));
+  }
+
   void testEmpty() {
     Interpolation interpolation;
 
@@ -0,0 +1,58 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_LRUCACHETEST_H_
+#define MANTID_KERNEL_LRUCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/LRUCache.h"
+
+#include <string>
+
+using Mantid::Kernel::LRUCache;
+
+class LRUCacheTest : public CxxTest::TestSuite {
+public:
+  void test_find_returns_inserted_values() {
+    LRUCache<std::string, int> cache(2);
+    TS_ASSERT(!cache.find("a"))
+    cache.insert("a", std::make_shared<int>(1));
+    TS_ASSERT_EQUALS(*cache.find("a"), 1);
+    cache.insert("a", std::make_shared<int>(2));
+    TS_ASSERT_EQUALS(*cache.find("a"), 2);
+    TS_ASSERT_EQUALS(cache.size(), 1);
+  }
+
+  void test_least_recently_used_is_dropped() {
+    LRUCache<std::string, int> cache(2);
+    cache.insert("a", std::make_shared<int>(1));
+    cache.insert("b", std::make_shared<int>(2));
+    cache.find("a");
+    cache.insert("c", std::make_shared<int>(3));
+    TS_ASSERT_EQUALS(cache.size(), 2);
+    TS_ASSERT(cache.find("a"))
+    TS_ASSERT(!cache.find("b"))
+    TS_ASSERT(cache.find("c"))
+  }
+
+  void test_values_found_outlive_the_cache_entries() {
+    LRUCache<std::string, int> cache(1);
+    cache.insert("a", std::make_shared<int>(1));
+    const auto value = cache.find("a");
+    cache.clear();
+    TS_ASSERT_EQUALS(cache.size(), 0);
+    TS_ASSERT_EQUALS(*value, 1);
+  }
+
+  void test_zero_capacity_keeps_nothing() {
+    LRUCache<std::string, int> cache(0);
+    cache.insert("a", std::make_shared<int>(1));
+    TS_ASSERT(!cache.find("a"))
+  }
+};
+
+#endif /* MANTID_KERNEL_LRUCACHETEST_H_ */
@@ -0,0 +1,71 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_LIBRARYMANAGERTEST_H_
+#define MANTID_KERNEL_LIBRARYMANAGERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/LibraryManager.h"
+
+#include <algorithm>
+
+using Mantid::Kernel::ConfigService;
+using Mantid::Kernel::LibraryManager;
+using Mantid::Kernel::LibraryManagerImpl;
+
+class LibraryManagerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static LibraryManagerTest *createSuite() { return new LibraryManagerTest(); }
+  static void destroySuite(LibraryManagerTest *suite) { delete suite; }
+
+  void test_unknown_entries_open_nothing() {
+    auto &libraryManager = LibraryManager::Instance();
+    TS_ASSERT(!libraryManager.openLibraryProviding("Test:NotDeferred|1"))
+    TS_ASSERT_EQUALS(libraryManager.openLibrariesProviding("Test:NotDef"), 0)
+  }
+
+  void test_deferred_library_is_opened_when_an_entry_is_requested() {
+    // The kernel library is already loaded by this test, so opening it again
+    // has no side effects
+    const auto library = findKernelLibrary();
+    TS_ASSERT(!library.empty())
+    if (library.empty())
+      return;
+    auto &libraryManager = LibraryManager::Instance();
+    libraryManager.deferLibrary(library, {"Test:Kernel|1", "Test:Kernel|2"});
+    // Deferred libraries are not found again, nor opened by other entries
+    TS_ASSERT(findKernelLibrary().empty())
+    TS_ASSERT(!libraryManager.openLibraryProviding("Test:Kernel|3"))
+    TS_ASSERT_EQUALS(libraryManager.openLibrariesProviding("Test:Kernel|3"), 0)
+
+    // Asking for every version opens the library once
+    TS_ASSERT_EQUALS(libraryManager.openLibrariesProviding("Test:Kernel|"), 1)
+    TS_ASSERT(!libraryManager.openLibraryProviding("Test:Kernel|1"))
+    TS_ASSERT(!libraryManager.openLibraryProviding("Test:Kernel|2"))
+    TS_ASSERT_EQUALS(libraryManager.openLibrary(library), 0)
+    TS_ASSERT(findKernelLibrary().empty())
+  }
+
+private:
+  /// @returns The path to the kernel library if it has not been opened or
+  /// deferred by the LibraryManager, empty otherwise
+  std::string findKernelLibrary() const {
+    const auto libraries = LibraryManager::Instance().findLibraries(
+        ConfigService::Instance().getDirectoryOfExecutable(),
+        LibraryManagerImpl::NonRecursive, {});
+    const auto kernel = std::find_if(
+        libraries.cbegin(), libraries.cend(), [](const std::string &library) {
+          return library.find("MantidKernel") != std::string::npos;
+        });
+    return kernel != libraries.cend() ? *kernel : "";
+  }
+};
+
+#endif /* MANTID_KERNEL_LIBRARYMANAGERTEST_H_ */
@@ -13,17 +13,43 @@
 #include "MantidKernel/ThreadPool.h"
 
 #include <Poco/AutoPtr.h>
+#include <Poco/Channel.h>
 #include <Poco/File.h>
 #include <Poco/Logger.h>
+#include <Poco/Message.h>
 #include <Poco/SimpleFileChannel.h>
 
 #include <cxxtest/TestSuite.h>
+#include <algorithm>
 #include <fstream>
+#include <mutex>
+#include <vector>
 
 using namespace Mantid::Kernel;
 using Poco::AutoPtr;
 using Poco::SimpleFileChannel;
 
+namespace {
+/// A channel keeping the text of all messages it receives
+class CollectingChannel : public Poco::Channel {
+public:
+  void log(const Poco::Message &msg) override {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    messages.push_back(msg.getText());
+  }
+  std::vector<std::string> messages;
+
+private:
+  std::mutex m_mutex;
+};
+
+/// Counts its calls, to see if a message was built
+std::string countedMessage(int &count) {
+  ++count;
+  return "Counted Message";
+}
+} // namespace
+
 class LoggerTest : public CxxTest::TestSuite {
   std::string m_logFile;
   Logger log;
@@ -87,6 +113,56 @@ public:
     log.information() << "Information Message " << num << '\n';
   }
 
+  void test_willLog_follows_level_offset_and_enabled() {
+    Logger logger("LoggerTestWillLog");
+    logger.setLevel(Logger::Priority::PRIO_INFORMATION);
+    TS_ASSERT(logger.willLog(Logger::Priority::PRIO_INFORMATION));
+    TS_ASSERT(!logger.willLog(Logger::Priority::PRIO_DEBUG));
+    logger.setLevelOffset(-1);
+    TS_ASSERT(logger.willLog(Logger::Priority::PRIO_DEBUG));
+    logger.setLevelOffset(0);
+    logger.setEnabled(false);
+    TS_ASSERT(!logger.willLog(Logger::Priority::PRIO_ERROR));
+  }
+
+  void test_macros_only_build_messages_that_are_logged() {
+    Logger logger("LoggerTestMacros");
+    AutoPtr<CollectingChannel> channel(new CollectingChannel);
+    Poco::Logger::get("LoggerTestMacros").setChannel(channel);
+    logger.setLevel(Logger::Priority::PRIO_INFORMATION);
+    int count(0);
+    MANTID_LOG_DEBUG(logger, countedMessage(count) << '\n');
+    TS_ASSERT_EQUALS(count, 0);
+    MANTID_LOG_INFORMATION(logger, countedMessage(count) << '\n');
+    TS_ASSERT_EQUALS(count, 1);
+    logger.debug() << "Debug Message\n";
+    TS_ASSERT_EQUALS(channel->messages,
+                     std::vector<std::string>{"Counted Message"});
+    Poco::Logger::get("LoggerTestMacros").setChannel(nullptr);
+  }
+
+  void test_messages_from_many_threads_are_not_mangled() {
+    Logger logger("LoggerTestThreads");
+    AutoPtr<CollectingChannel> channel(new CollectingChannel);
+    Poco::Logger::get("LoggerTestThreads").setChannel(channel);
+    logger.setLevel(Logger::Priority::PRIO_INFORMATION);
+    const int nmessages(1000);
+    PRAGMA_OMP(parallel for)
+    for (int i = 0; i < nmessages; i++) {
+      logger.information() << "Information ";
+      logger.information() << "Message " << i << '\n';
+    }
+    std::vector<std::string> expected;
+    for (int i = 0; i < nmessages; i++) {
+      expected.push_back("Information Message " + std::to_string(i));
+    }
+    auto received = channel->messages;
+    std::sort(received.begin(), received.end());
+    std::sort(expected.begin(), expected.end());
+    TS_ASSERT_EQUALS(received, expected);
+    Poco::Logger::get("LoggerTestThreads").setChannel(nullptr);
+  }
+
   //---------------------------------------------------------------------------
   /** Log very quickly from a lot of Poco Threads.
    * The test passes if it does not segfault. */
@@ -124,6 +124,32 @@ public:
     TS_ASSERT_DELTA(TiZr.attenuation(distance), 0., 1e-4);
   }
 
+  void test_attenuation_matches_cross_sections() {
+    Material TiZr("TiZr", Material::parseChemicalFormula("Ti2.082605 Zr"),
+                  0.0542);
+    const double distance(0.05);
+    for (const double lambda : {0.5, 1.798, 4.2}) {
+      const double expected =
+          std::exp(-100. * TiZr.numberDensity() *
+                   (TiZr.totalScatterXSection() + TiZr.absorbXSection(lambda)) *
+                   distance);
+      TS_ASSERT_DELTA(TiZr.attenuation(distance, lambda), expected, 1e-12);
+    }
+  }
+
+  void test_copies_give_the_same_cross_sections() {
+    Material TiZr("TiZr", Material::parseChemicalFormula("Ti2.082605 Zr"),
+                  0.0542);
+    const Material copy(TiZr);
+    TS_ASSERT_EQUALS(copy.totalScatterXSection(), TiZr.totalScatterXSection());
+    TS_ASSERT_EQUALS(copy.absorbXSection(2.1), TiZr.absorbXSection(2.1));
+    Material assigned;
+    TS_ASSERT_EQUALS(assigned.totalScatterXSection(), 0.);
+    assigned = TiZr;
+    TS_ASSERT_EQUALS(assigned.totalScatterXSection(),
+                     TiZr.totalScatterXSection());
+  }
+
   /** Save then re-load from a NXS file */
   void test_nexus() {
     Material testA("testMaterial",
@@ -135,6 +161,8 @@ public:
     TS_ASSERT_THROWS_NOTHING(testA.saveNexus(th.file.get(), "material"););
 
     Material testB;
+    // The cross sections of the empty material must not be kept
+    TS_ASSERT_EQUALS(testB.absorbXSection(), 0.);
     th.reopenFile();
     TS_ASSERT_THROWS_NOTHING(testB.loadNexus(th.file.get(), "material"););
 
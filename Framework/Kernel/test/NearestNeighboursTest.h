@@ -72,6 +72,33 @@ public:
     TS_ASSERT_EQUALS(index, 1)
     TS_ASSERT_DELTA(dist, 2.21, 0.01)
   }
+
+  void test_find_within_radius() {
+    std::vector<Eigen::Vector3d> pts = {Vector3d(0, 0, 0), Vector3d(1, 0, 0),
+                                        Vector3d(0, 2, 0), Vector3d(0, 0, 3)};
+    NearestNeighbours<3> nn(pts);
+
+    auto results = nn.findWithinRadius(Vector3d(0.1, 0, 0), 2.1);
+    TS_ASSERT_EQUALS(results.size(), 3)
+    // In order of distance, as squared distances
+    TS_ASSERT_EQUALS(std::get<1>(results[0]), 0)
+    TS_ASSERT_DELTA(std::get<2>(results[0]), 0.01, 1e-10)
+    TS_ASSERT_EQUALS(std::get<1>(results[1]), 1)
+    TS_ASSERT_DELTA(std::get<2>(results[1]), 0.81, 1e-10)
+    TS_ASSERT_EQUALS(std::get<1>(results[2]), 2)
+    Eigen::Vector3d pos = std::get<0>(results[2]);
+    TS_ASSERT_EQUALS(pos[1], 2)
+  }
+
+  void test_find_within_radius_excludes_point_at_position() {
+    std::vector<Eigen::Vector2d> pts = {Vector2d(1, 1), Vector2d(2, 2)};
+    NearestNeighbours<2> nn(pts);
+
+    TS_ASSERT(nn.findWithinRadius(Vector2d(1, 1), 1.).empty())
+    auto results = nn.findWithinRadius(Vector2d(1, 1), 1.5);
+    TS_ASSERT_EQUALS(results.size(), 1)
+    TS_ASSERT_EQUALS(std::get<1>(results[0]), 1)
+  }
 };
 
 #endif
@@ -0,0 +1,79 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_PARALLELREDUCETEST_H_
+#define MANTID_KERNEL_PARALLELREDUCETEST_H_
+
+#include "MantidKernel/ParallelReduce.h"
+
+#include <cxxtest/TestSuite.h>
+#include <numeric>
+#include <stdexcept>
+
+using namespace Mantid::Kernel;
+
+class ParallelReduceTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ParallelReduceTest *createSuite() { return new ParallelReduceTest(); }
+  static void destroySuite(ParallelReduceTest *suite) { delete suite; }
+
+  void test_items_are_reduced_in_order() {
+    std::vector<std::vector<size_t>> groups(4);
+    groups[0].resize(1000);
+    std::iota(groups[0].begin(), groups[0].end(), 0);
+    groups[1] = {7};
+    // groups[2] is empty
+    groups[3].resize(33);
+    std::iota(groups[3].begin(), groups[3].end(), 2000);
+
+    std::vector<std::vector<size_t>> results(groups.size());
+    reduceGroups(
+        groups, 10, true, [](size_t) { return std::vector<size_t>(); },
+        [](std::vector<size_t> &partial, size_t, const size_t *first,
+           const size_t *last) { partial.insert(partial.end(), first, last); },
+        [](std::vector<size_t> &partial, std::vector<size_t> &next) {
+          partial.insert(partial.end(), next.begin(), next.end());
+        },
+        [&results](size_t group, std::vector<size_t> &result) {
+          results[group].swap(result);
+        });
+
+    TS_ASSERT_EQUALS(results, groups);
+  }
+
+  void test_partials_are_made_for_their_group() {
+    const std::vector<std::vector<size_t>> groups{{1, 2, 3}, {4, 5}};
+    std::vector<size_t> sums(groups.size(), 0);
+    reduceGroups(
+        groups, 1, false, [](size_t group) { return (group + 1) * 100; },
+        [](size_t &partial, size_t, const size_t *first, const size_t *last) {
+          partial = std::accumulate(first, last, partial);
+        },
+        [](size_t &partial, size_t &next) { partial += next; },
+        [&sums](size_t group, size_t &sum) { sums[group] = sum; });
+
+    // Each chunk of one item starts from the value made for its group
+    TS_ASSERT_EQUALS(sums[0], 306);
+    TS_ASSERT_EQUALS(sums[1], 409);
+  }
+
+  void test_exceptions_are_rethrown() {
+    const std::vector<std::vector<size_t>> groups{{1, 2, 3, 4, 5, 6}};
+    TS_ASSERT_THROWS(
+        reduceGroups(
+            groups, 2, true, [](size_t) { return 0; },
+            [](int &, size_t, const size_t *first, const size_t *) {
+              if (*first == 3)
+                throw std::runtime_error("Failed to accumulate");
+            },
+            [](int &, int &) {}, [](size_t, int &) {}),
+        const std::runtime_error &);
+  }
+};
+
+#endif /* MANTID_KERNEL_PARALLELREDUCETEST_H_ */
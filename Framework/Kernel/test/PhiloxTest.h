@@ -0,0 +1,142 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_PHILOXTEST_H_
+#define MANTID_KERNEL_PHILOXTEST_H_
+
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Philox.h"
+#include <cxxtest/TestSuite.h>
+
+#include <vector>
+
+using Mantid::Kernel::Philox;
+
+class PhiloxTest : public CxxTest::TestSuite {
+
+public:
+  void test_block_matches_known_answers() {
+    // Known answer tests from the Random123 distribution
+    assertBlock({{0, 0, 0, 0}}, {{0, 0}},
+                {{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}});
+    assertBlock({{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+                {{0xffffffff, 0xffffffff}},
+                {{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}});
+    assertBlock({{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}},
+                {{0xa4093822, 0x299f31d0}},
+                {{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}});
+  }
+
+  void test_same_seed_and_stream_give_the_same_sequence() {
+    Philox gen_1(212437999, 3), gen_2(212437999, 3);
+    TS_ASSERT_EQUALS(doNextValueCalls(20, gen_1),
+                     doNextValueCalls(20, gen_2));
+  }
+
+  void test_different_seeds_give_different_sequences() {
+    Philox gen_1(212437999), gen_2(247021340);
+    TS_ASSERT_DIFFERS(gen_1.nextValue(), gen_2.nextValue());
+  }
+
+  void test_different_streams_give_different_sequences() {
+    Philox gen_1(212437999, 0), gen_2(212437999, 1);
+    TS_ASSERT_DIFFERS(gen_1.nextValue(), gen_2.nextValue());
+  }
+
+  void test_setStream_goes_to_the_start_of_the_stream() {
+    Philox gen_1(39857239, 5), gen_2(39857239);
+    doNextValueCalls(7, gen_2);
+    gen_2.setStream(5);
+    TS_ASSERT_EQUALS(doNextValueCalls(20, gen_1),
+                     doNextValueCalls(20, gen_2));
+  }
+
+  void test_restart_gives_same_sequence_again_from_start() {
+    Philox randGen(39857239);
+    const auto firstValues = doNextValueCalls(15, randGen);
+    randGen.restart();
+    TS_ASSERT_EQUALS(firstValues, doNextValueCalls(15, randGen));
+  }
+
+  void test_save_then_restore_gives_sequence_from_saved_point() {
+    Philox randGen(1);
+    doNextValueCalls(11, randGen);
+    randGen.save();
+    const auto firstValues = doNextValueCalls(50, randGen);
+    randGen.restore();
+    doNextValueCalls(3, randGen);
+    randGen.restore();
+    TS_ASSERT_EQUALS(firstValues, doNextValueCalls(50, randGen));
+  }
+
+  void test_streams_do_not_depend_on_the_thread_drawing_them() {
+    const int nstreams(64);
+    std::vector<std::vector<double>> serial(nstreams), parallel(nstreams);
+    for (int i = 0; i < nstreams; ++i) {
+      Philox randGen(12345, i);
+      serial[i] = doNextValueCalls(25, randGen);
+    }
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < nstreams; ++i) {
+      Philox randGen(12345, i);
+      parallel[i] = doNextValueCalls(25, randGen);
+    }
+    TS_ASSERT_EQUALS(serial, parallel);
+  }
+
+  void test_default_range_produces_numbers_between_zero_and_one() {
+    Philox randGen(12345);
+    for (std::size_t i = 0; i < 100; ++i) {
+      double r = randGen.nextValue();
+      TS_ASSERT(r >= 0.0 && r < 1.0);
+    }
+  }
+
+  void test_range_is_respected() {
+    const double start(2.1), end(3.4);
+    Philox randGen(12345, 0, start, end);
+    TS_ASSERT_EQUALS(randGen.min(), start);
+    TS_ASSERT_EQUALS(randGen.max(), end);
+    for (std::size_t i = 0; i < 100; ++i) {
+      double r = randGen.nextValue();
+      TS_ASSERT(r >= start && r < end);
+    }
+  }
+
+  void test_nextInt_covers_the_inclusive_range() {
+    Philox randGen(12345);
+    std::vector<int> counts(4, 0);
+    for (std::size_t i = 0; i < 1000; ++i) {
+      const int value = randGen.nextInt(1, 4);
+      TS_ASSERT(value >= 1 && value <= 4);
+      if (value >= 1 && value <= 4)
+        ++counts[value - 1];
+    }
+    for (const auto count : counts) {
+      TS_ASSERT_DELTA(count, 250, 75);
+    }
+  }
+
+private:
+  void assertBlock(const Philox::Counter &counter, const Philox::Key &key,
+                   const Philox::Counter &expected) {
+    const auto result = Philox::block(counter, key);
+    for (size_t i = 0; i < expected.size(); ++i) {
+      TS_ASSERT_EQUALS(result[i], expected[i]);
+    }
+  }
+
+  std::vector<double> doNextValueCalls(const unsigned int ncalls,
+                                       Philox &randGen) {
+    std::vector<double> values(ncalls);
+    for (unsigned int i = 0; i < ncalls; ++i) {
+      values[i] = randGen.nextValue();
+    }
+    return values;
+  }
+};
+
+#endif /* MANTID_KERNEL_PHILOXTEST_H_ */
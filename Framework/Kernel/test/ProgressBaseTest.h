@@ -7,12 +7,15 @@
 #ifndef MANTID_KERNEL_PROGRESSBASETEST_H_
 #define MANTID_KERNEL_PROGRESSBASETEST_H_
 
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/Timer.h"
 #include <cxxtest/TestSuite.h>
 
 #include "MantidKernel/ProgressBase.h"
 
+#include <atomic>
+
 using namespace Mantid::Kernel;
 
 class ProgressBaseTest : public CxxTest::TestSuite {
@@ -37,6 +40,18 @@ public:
     std::string last_report_message;
   };
 
+  /** Class counting the notifications, which may come from any thread */
+  class CountingProgress : public ProgressBase {
+  public:
+    CountingProgress(double start, double end, int64_t numSteps)
+        : ProgressBase(start, end, numSteps) {}
+
+    void doReport(const std::string &) override { ++numberOfReports; }
+    int64_t counter() const { return m_i; }
+
+    std::atomic<int> numberOfReports{0};
+  };
+
   void test_copy_and_assign() {
     MyTestProgress prog1(0.1, 0.5, 10);
     prog1.report("Hello");
@@ -129,6 +144,19 @@ public:
     TS_ASSERT_EQUALS(p.last_report_counter, 4);
   }
 
+  void test_reports_from_many_threads_notify_once_per_step() {
+    // 1000 steps, default = only notify every 1 % = 10 calls
+    CountingProgress p(0.0, 1.0, 1000);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 1000; ++i) {
+      p.report("Counting");
+    }
+    TS_ASSERT_EQUALS(p.counter(), 1000);
+    const int numberOfReports = p.numberOfReports;
+    TS_ASSERT_LESS_THAN_EQUALS(numberOfReports, 100);
+    TS_ASSERT_LESS_THAN(0, numberOfReports);
+  }
+
   /** Progress report would work incorrectly for ridiculously large integer # of
    * steps. */
   void test_setNumSteps_forRidiculouslyLargeNumbers() {
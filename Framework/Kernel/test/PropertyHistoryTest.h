@@ -50,6 +50,20 @@ public:
     TS_ASSERT_EQUALS(output.str(), correctOutput);
   }
 
+  void testLongValuesAreSharedBetweenHistories() {
+    const std::string longValue(200, '1');
+    PropertyHistory first("Values", longValue, "dbl list", false,
+                          Direction::Input);
+    PropertyHistory second("OtherValues", longValue, "dbl list", true,
+                           Direction::Input);
+    TS_ASSERT_EQUALS(second.value(), longValue);
+    TS_ASSERT_EQUALS(&first.value(), &second.value());
+
+    second.setValue("1,2");
+    TS_ASSERT_EQUALS(first.value(), longValue);
+    TS_ASSERT_EQUALS(second.value(), "1,2");
+  }
+
   /**
    * Test the isEmptyDefault method returns true for unset default-value
    * properties
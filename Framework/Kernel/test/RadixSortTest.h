@@ -0,0 +1,143 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_RADIXSORTTEST_H_
+#define MANTID_KERNEL_RADIXSORTTEST_H_
+
+#include "MantidKernel/RadixSort.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <utility>
+
+using namespace Mantid::Kernel;
+
+class RadixSortTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static RadixSortTest *createSuite() { return new RadixSortTest(); }
+  static void destroySuite(RadixSortTest *suite) { delete suite; }
+
+  void test_doubleKey_preserves_ordering() {
+    const std::vector<double> values{
+        -std::numeric_limits<double>::infinity(), -1e300, -2.5, -1e-300, 0.,
+        1e-300, 1., 2.5, 1e300, std::numeric_limits<double>::infinity()};
+    for (size_t i = 1; i < values.size(); ++i)
+      TS_ASSERT_LESS_THAN(RadixSort::doubleKey(values[i - 1]),
+                          RadixSort::doubleKey(values[i]));
+  }
+
+  void test_int64Key_preserves_ordering() {
+    const std::vector<int64_t> values{std::numeric_limits<int64_t>::lowest(),
+                                      -10, -1, 0, 1, 10,
+                                      std::numeric_limits<int64_t>::max()};
+    for (size_t i = 1; i < values.size(); ++i)
+      TS_ASSERT_LESS_THAN(RadixSort::int64Key(values[i - 1]),
+                          RadixSort::int64Key(values[i]));
+  }
+
+  void test_sort_empty_and_single() {
+    std::vector<double> empty;
+    RadixSort::sort(empty, RadixSort::doubleKey);
+    TS_ASSERT(empty.empty());
+    std::vector<double> single{3.};
+    RadixSort::sort(single, RadixSort::doubleKey);
+    TS_ASSERT_EQUALS(single, std::vector<double>{3.});
+  }
+
+  void test_sort_doubles_matches_std_sort() {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1e4, 1e5);
+    std::vector<double> values(10000);
+    for (auto &value : values)
+      value = distribution(generator);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    RadixSort::sort(values, RadixSort::doubleKey);
+    TS_ASSERT_EQUALS(values, expected);
+  }
+
+  void test_sort_with_identical_keys_is_noop() {
+    std::vector<std::pair<double, int>> values{{1., 2}, {1., 1}, {1., 0}};
+    RadixSort::sort(values, [](const std::pair<double, int> &value) {
+      return RadixSort::doubleKey(value.first);
+    });
+    TS_ASSERT_EQUALS(values[0].second, 2);
+    TS_ASSERT_EQUALS(values[2].second, 0);
+  }
+
+  void test_sort_is_stable_giving_composite_order() {
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int64_t> pulses(0, 20);
+    std::uniform_real_distribution<double> tofs(0., 100.);
+    using Event = std::pair<int64_t, double>;
+    std::vector<Event> values(5000);
+    for (auto &value : values)
+      value = Event(pulses(generator), tofs(generator));
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    RadixSort::sort(values, [](const Event &event) {
+      return RadixSort::doubleKey(event.second);
+    });
+    RadixSort::sort(values, [](const Event &event) {
+      return RadixSort::int64Key(event.first);
+    });
+    TS_ASSERT_EQUALS(values, expected);
+  }
+
+  void test_sort_with_explicit_scratch_buffer() {
+    std::vector<int64_t> scratch;
+    std::vector<int64_t> values{5, -3, 1 << 30, 0, -(1 << 20)};
+    RadixSort::sort(values, RadixSort::int64Key, scratch);
+    TS_ASSERT_EQUALS(values,
+                     std::vector<int64_t>({-(1 << 20), -3, 0, 5, 1 << 30}));
+  }
+
+  void test_sort_keeps_capacity_of_list_and_scratch_buffer() {
+    std::vector<uint64_t> scratch;
+    scratch.reserve(100000);
+    std::vector<uint64_t> values{3, 1, 2};
+    values.shrink_to_fit();
+    const auto capacity = values.capacity();
+    // Only the lowest byte differs, so the result ends in the scratch buffer
+    RadixSort::sort(values, [](const uint64_t value) { return value; },
+                    scratch);
+    TS_ASSERT_EQUALS(values, std::vector<uint64_t>({1, 2, 3}));
+    TS_ASSERT_EQUALS(values.capacity(), capacity);
+    TS_ASSERT_LESS_THAN_EQUALS(100000, scratch.capacity());
+  }
+};
+
+class RadixSortTestPerformance : public CxxTest::TestSuite {
+public:
+  static RadixSortTestPerformance *createSuite() {
+    return new RadixSortTestPerformance();
+  }
+  static void destroySuite(RadixSortTestPerformance *suite) { delete suite; }
+
+  RadixSortTestPerformance() : m_values(5000000) {
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> distribution(0., 2e4);
+    for (auto &value : m_values)
+      value = distribution(generator);
+  }
+
+  void test_sort_large_list() {
+    auto values = m_values;
+    RadixSort::sort(values, RadixSort::doubleKey);
+    TS_ASSERT(std::is_sorted(values.begin(), values.end()));
+  }
+
+private:
+  std::vector<double> m_values;
+};
+
+#endif /* MANTID_KERNEL_RADIXSORTTEST_H_ */
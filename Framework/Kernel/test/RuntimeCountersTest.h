@@ -0,0 +1,69 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_RUNTIMECOUNTERSTEST_H_
+#define MANTID_KERNEL_RUNTIMECOUNTERSTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/RuntimeCounters.h"
+
+using namespace Mantid::Kernel;
+
+class RuntimeCountersTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static RuntimeCountersTest *createSuite() {
+    return new RuntimeCountersTest();
+  }
+  static void destroySuite(RuntimeCountersTest *suite) { delete suite; }
+
+  void setUp() override { RuntimeCounters::Instance().reset(); }
+
+  void test_unknown_counter_is_zero() {
+    TS_ASSERT_EQUALS(RuntimeCounters::Instance().value("test_unknown"), 0);
+  }
+
+  void test_add_from_many_threads() {
+    auto &counters = RuntimeCounters::Instance();
+    auto &counter = counters.counter("test_parallel");
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 1000; ++i) {
+      counter.fetch_add(1, std::memory_order_relaxed);
+      counters.add("test_parallel", 2);
+    }
+    TS_ASSERT_EQUALS(counters.value("test_parallel"), 3000);
+  }
+
+  void test_reset_keeps_references_valid() {
+    auto &counters = RuntimeCounters::Instance();
+    auto &counter = counters.counter("test_reset");
+    counter += 5;
+    counters.reset();
+    TS_ASSERT_EQUALS(counters.value("test_reset"), 0);
+    counter += 2;
+    TS_ASSERT_EQUALS(counters.values().at("test_reset"), 2);
+  }
+
+  void test_prometheus_groups_labelled_counters() {
+    auto &counters = RuntimeCounters::Instance();
+    counters.add("test_runs{algorithm=\"Rebin\"}", 3);
+    counters.add("test_runs_seconds", 1);
+    counters.add("test_runs{algorithm=\"Load\"}", 4);
+    const auto text = counters.prometheus();
+    const auto type = text.find("# TYPE mantid_test_runs counter\n"
+                                "mantid_test_runs{algorithm=\"Load\"} 4\n"
+                                "mantid_test_runs{algorithm=\"Rebin\"} 3\n");
+    TS_ASSERT_DIFFERS(type, std::string::npos);
+    TS_ASSERT_DIFFERS(text.find("# TYPE mantid_test_runs_seconds counter\n"
+                                "mantid_test_runs_seconds 1\n"),
+                      std::string::npos);
+  }
+};
+
+#endif /* MANTID_KERNEL_RUNTIMECOUNTERSTEST_H_ */
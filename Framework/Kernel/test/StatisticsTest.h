@@ -140,6 +140,28 @@ public:
     TS_ASSERT_DELTA(ZModscore[6], 0.3372, 0.0001);
   }
 
+  void test_StdDev_Of_Data_Far_From_Zero() {
+    // The variance must not be lost to cancellation against the large mean
+    vector<double> data{1.0E9 + 4., 1.0E9 + 7., 1.0E9 + 13., 1.0E9 + 16.};
+
+    Statistics stats = getStatistics(data, StatOptions::UncorrectedStdDev);
+
+    TS_ASSERT_DELTA(stats.mean, 1.0E9 + 10., 1.0E-6);
+    TS_ASSERT_DELTA(stats.standard_deviation, std::sqrt(22.5), 1.0E-6);
+    TS_ASSERT_EQUALS(stats.minimum, 1.0E9 + 4.);
+    TS_ASSERT_EQUALS(stats.maximum, 1.0E9 + 16.);
+  }
+
+  void test_Median_Of_Unsorted_Even_Data() {
+    vector<double> data{9., 2., 7., 4., 3., 8.};
+
+    Statistics stats = getStatistics(data, StatOptions::Median);
+
+    TS_ASSERT_EQUALS(stats.median, 5.5);
+    // The input is left as it was
+    TS_ASSERT_EQUALS(data, vector<double>({9., 2., 7., 4., 3., 8.}));
+  }
+
   void testDoubleSingle() {
     vector<double> data;
     data.push_back(42.);
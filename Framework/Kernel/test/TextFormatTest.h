@@ -0,0 +1,113 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_TEXTFORMATTEST_H_
+#define MANTID_KERNEL_TEXTFORMATTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/TextFormat.h"
+
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+using Mantid::Kernel::NumberFormat;
+using Mantid::Kernel::parseNumber;
+using Mantid::Kernel::writeInParallel;
+
+class TextFormatTest : public CxxTest::TestSuite {
+public:
+  void test_numbers_are_formatted_as_by_a_stream() {
+    const std::vector<double> values{0.,     -1.5,   1. / 3.,  123456789.,
+                                     1e-12,  -2e300, 1e5 + 0.5, 42.};
+    for (const auto notation :
+         {NumberFormat::Notation::General, NumberFormat::Notation::Fixed,
+          NumberFormat::Notation::Scientific}) {
+      for (const int precision : {0, 3, 6, 15}) {
+        for (const int width : {0, 20}) {
+          const NumberFormat format(precision, notation, width);
+          for (const double value : values) {
+            std::ostringstream stream;
+            if (notation == NumberFormat::Notation::Fixed)
+              stream << std::fixed;
+            else if (notation == NumberFormat::Notation::Scientific)
+              stream << std::scientific;
+            stream << std::setprecision(precision) << std::setw(width)
+                   << value;
+            TS_ASSERT_EQUALS(format.format(value), stream.str());
+          }
+        }
+      }
+    }
+  }
+
+  void test_large_fixed_numbers_are_not_truncated() {
+    const NumberFormat format(2, NumberFormat::Notation::Fixed);
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(2) << 1e100;
+    TS_ASSERT_EQUALS(format.format(1e100), stream.str());
+  }
+
+  void test_integers_are_padded_to_the_width() {
+    const NumberFormat format(6, NumberFormat::Notation::Fixed, 8);
+    std::string text("x");
+    format.append(text, int64_t(-1234));
+    TS_ASSERT_EQUALS(text, "x   -1234");
+  }
+
+  void test_parseNumber_takes_whole_numbers_only() {
+    double value = 0.;
+    TS_ASSERT(parseNumber("1.5e3", value));
+    TS_ASSERT_EQUALS(value, 1500.);
+    TS_ASSERT(parseNumber("-7", value));
+    TS_ASSERT_EQUALS(value, -7.);
+    TS_ASSERT(parseNumber("nan", value));
+    TS_ASSERT(std::isnan(value));
+    value = 3.;
+    TS_ASSERT(!parseNumber("", value));
+    TS_ASSERT(!parseNumber("1.5 2", value));
+    TS_ASSERT(!parseNumber(" 1.5", value));
+    TS_ASSERT(!parseNumber("0x10", value));
+    TS_ASSERT(!parseNumber("abc", value));
+    TS_ASSERT_EQUALS(value, 3.);
+  }
+
+  void test_writeInParallel_writes_items_in_order() {
+    std::ostringstream out;
+    std::vector<size_t> written;
+    const size_t count = 1000;
+    writeInParallel(
+        out, count,
+        [](const size_t i, std::string &text) {
+          text = std::to_string(i) + '\n';
+        },
+        [&written](const size_t i) { written.push_back(i); });
+    std::ostringstream expected;
+    for (size_t i = 0; i < count; ++i)
+      expected << i << '\n';
+    TS_ASSERT_EQUALS(out.str(), expected.str());
+    TS_ASSERT_EQUALS(written.size(), count);
+    TS_ASSERT_EQUALS(written.back(), count - 1);
+  }
+
+  void test_writeInParallel_rethrows_formatting_errors() {
+    std::ostringstream out;
+    TS_ASSERT_THROWS(writeInParallel(
+                         out, 10,
+                         [](const size_t i, std::string &) {
+                           if (i == 5)
+                             throw std::runtime_error("bad item");
+                         },
+                         [](const size_t) {}),
+                     const std::runtime_error &);
+    TS_ASSERT(out.str().empty());
+  }
+};
+
+#endif /* MANTID_KERNEL_TEXTFORMATTEST_H_ */
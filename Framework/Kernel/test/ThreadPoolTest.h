@@ -9,7 +9,9 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadScheduler.h"
@@ -20,6 +22,7 @@
 
 #include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
+#include <atomic>
 #include <cstdlib>
 
 using namespace Mantid::Kernel;
@@ -154,6 +157,35 @@ public:
     TS_ASSERT_EQUALS(threadpooltest_check, 12);
   }
 
+  void test_getNumPhysicalCores_respects_MaxCores() {
+    auto &config = ConfigService::Instance();
+    const std::string previous = config.getString("MultiThreaded.MaxCores");
+    config.setString("MultiThreaded.MaxCores", "1");
+    TS_ASSERT_EQUALS(ThreadPool::getNumPhysicalCores(), 1);
+    config.setString("MultiThreaded.MaxCores", "0");
+    TS_ASSERT_LESS_THAN_EQUALS(1, ThreadPool::getNumPhysicalCores());
+    config.setString("MultiThreaded.MaxCores", previous);
+  }
+
+  void test_parallel_loops_in_tasks_run_serially() {
+    TS_ASSERT(!inThreadPoolWorker());
+    std::atomic<bool> inWorker{false};
+    std::atomic<int> maxThreadsInLoop{0};
+    ThreadPool p;
+    p.schedule(std::make_shared<FunctionTask>([&inWorker, &maxThreadsInLoop] {
+      inWorker = inThreadPoolWorker();
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int i = 0; i < 100; ++i) {
+        const int numThreads = PARALLEL_NUMBER_OF_THREADS;
+        if (numThreads > maxThreadsInLoop)
+          maxThreadsInLoop = numThreads;
+      }
+    }));
+    TS_ASSERT_THROWS_NOTHING(p.joinAll());
+    TS_ASSERT(inWorker);
+    TS_ASSERT_EQUALS(maxThreadsInLoop, 1);
+  }
+
   //=======================================================================================
   //=======================================================================================
   /** Class for debugging progress reporting */
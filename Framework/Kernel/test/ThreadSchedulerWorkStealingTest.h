@@ -0,0 +1,171 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+
+#include <atomic>
+
+using namespace Mantid::Kernel;
+
+namespace {
+std::shared_ptr<Task> makeTask(double cost = 1.0, int priority = 0) {
+  auto task =
+      std::make_shared<FunctionTask>(boost::function<void()>([] {}), cost);
+  task->setPriority(priority);
+  return task;
+}
+} // namespace
+
+class ThreadSchedulerWorkStealingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ThreadSchedulerWorkStealingTest *createSuite() {
+    return new ThreadSchedulerWorkStealingTest();
+  }
+  static void destroySuite(ThreadSchedulerWorkStealingTest *suite) {
+    delete suite;
+  }
+
+  void test_push_and_clear() {
+    ThreadSchedulerWorkStealing scheduler(2);
+    TS_ASSERT_EQUALS(scheduler.numWorkers(), 2);
+    TS_ASSERT(scheduler.empty());
+    scheduler.push(makeTask(1.0));
+    scheduler.push(makeTask(2.0));
+    TS_ASSERT_EQUALS(scheduler.size(), 2);
+    TS_ASSERT_DELTA(scheduler.totalCost(), 3.0, 1e-12);
+    TS_ASSERT(!scheduler.empty());
+    scheduler.clear();
+    TS_ASSERT_EQUALS(scheduler.size(), 0);
+    TS_ASSERT_DELTA(scheduler.totalCost(), 0.0, 1e-12);
+    TS_ASSERT(scheduler.empty());
+  }
+
+  void test_tasks_are_popped_by_priority_then_cost() {
+    ThreadSchedulerWorkStealing scheduler(1);
+    auto cheap = makeTask(1.0);
+    auto expensive = makeTask(10.0);
+    auto urgent = makeTask(0.5, 1);
+    scheduler.push(cheap);
+    scheduler.push(expensive);
+    scheduler.push(urgent);
+    TS_ASSERT_EQUALS(scheduler.pop(0), urgent);
+    TS_ASSERT_EQUALS(scheduler.pop(0), expensive);
+    TS_ASSERT_EQUALS(scheduler.pop(0), cheap);
+    TS_ASSERT(!scheduler.pop(0));
+  }
+
+  void test_idle_worker_steals_tasks() {
+    ThreadSchedulerWorkStealing scheduler(2);
+    // Pushed from outside the workers, the tasks go to each queue in turn
+    auto first = makeTask();
+    auto second = makeTask();
+    scheduler.push(first);
+    scheduler.push(second);
+    auto popped = scheduler.pop(0);
+    auto stolen = scheduler.pop(0);
+    TS_ASSERT(popped);
+    TS_ASSERT(stolen);
+    TS_ASSERT_DIFFERS(popped, stolen);
+    TS_ASSERT(!scheduler.pop(1));
+  }
+
+  void test_task_waits_for_its_dependencies() {
+    ThreadSchedulerWorkStealing scheduler(1);
+    auto first = makeTask();
+    auto second = makeTask();
+    auto dependent = makeTask(100.0);
+    scheduler.push(first);
+    scheduler.push(second);
+    scheduler.push(dependent, {first, second});
+    TS_ASSERT_EQUALS(scheduler.size(), 3);
+
+    auto task = scheduler.pop(0);
+    TS_ASSERT_DIFFERS(task, dependent);
+    scheduler.finished(task.get(), 0);
+    task = scheduler.pop(0);
+    TS_ASSERT_DIFFERS(task, dependent);
+    // Still waiting for the second dependency to finish
+    TS_ASSERT(!scheduler.pop(0));
+    TS_ASSERT(!scheduler.empty());
+    scheduler.finished(task.get(), 0);
+    TS_ASSERT_EQUALS(scheduler.pop(0), dependent);
+    scheduler.finished(dependent.get(), 0);
+    TS_ASSERT(scheduler.empty());
+  }
+
+  void test_finished_dependencies_are_not_waited_for() {
+    ThreadSchedulerWorkStealing scheduler(1);
+    auto first = makeTask();
+    scheduler.push(first);
+    auto task = scheduler.pop(0);
+    scheduler.finished(task.get(), 0);
+    auto dependent = makeTask();
+    scheduler.push(dependent, {first, makeTask()});
+    TS_ASSERT_EQUALS(scheduler.pop(0), dependent);
+  }
+
+  void test_not_empty_while_task_running() {
+    ThreadSchedulerWorkStealing scheduler(1);
+    scheduler.push(makeTask());
+    auto task = scheduler.pop(0);
+    TS_ASSERT_EQUALS(scheduler.size(), 0);
+    TS_ASSERT(!scheduler.empty());
+    scheduler.finished(task.get(), 0);
+    TS_ASSERT(scheduler.empty());
+  }
+
+  void test_thread_pool_runs_tasks_pushed_by_tasks() {
+    auto scheduler = new ThreadSchedulerWorkStealing(4);
+    ThreadPool pool(scheduler, 4);
+    std::atomic<int> processed{0};
+    std::atomic<int> parentsDone{0};
+    std::vector<std::shared_ptr<Task>> parents;
+    for (int i = 0; i < 50; ++i) {
+      auto parent = std::make_shared<FunctionTask>(
+          [scheduler, &processed, &parentsDone] {
+            for (int j = 0; j < 20; ++j)
+              scheduler->push(std::make_shared<FunctionTask>(
+                  [&processed] { ++processed; }));
+            ++parentsDone;
+          });
+      parents.push_back(parent);
+      pool.schedule(parent);
+    }
+    // Only runs once every parent has finished
+    int parentsDoneBeforeLast = -1;
+    scheduler->push(std::make_shared<FunctionTask>([&parentsDone,
+                                                    &parentsDoneBeforeLast] {
+                      parentsDoneBeforeLast = parentsDone;
+                    }),
+                    parents);
+    TS_ASSERT_THROWS_NOTHING(pool.joinAll());
+    TS_ASSERT_EQUALS(processed, 1000);
+    TS_ASSERT_EQUALS(parentsDoneBeforeLast, 50);
+    TS_ASSERT(scheduler->empty());
+  }
+
+  void test_abort_clears_waiting_tasks() {
+    ThreadSchedulerWorkStealing scheduler(1);
+    auto first = makeTask();
+    scheduler.push(first);
+    scheduler.push(makeTask(), {first});
+    scheduler.abort(std::runtime_error("stop"));
+    TS_ASSERT(scheduler.getAborted());
+    TS_ASSERT_EQUALS(scheduler.size(), 0);
+    TS_ASSERT(scheduler.empty());
+  }
+};
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_ */
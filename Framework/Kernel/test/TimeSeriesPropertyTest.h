@@ -795,6 +795,34 @@ public:
     delete outputs[0];
   }
 
+  //----------------------------------------------------------------------------
+  void test_splitByTime_skips_splitter_with_unknown_output() {
+    TimeSeriesProperty<int> *log = createIntegerTSP(12);
+
+    std::vector<Property *> outputs;
+    outputs.push_back(new TimeSeriesProperty<int>("MyIntLog"));
+
+    DateAndTime start, stop;
+    TimeSplitterType splitter;
+    start = DateAndTime("2007-11-30T16:17:10");
+    stop = DateAndTime("2007-11-30T16:17:40");
+    splitter.push_back(SplittingInterval(start, stop, 5));
+
+    start = DateAndTime("2007-11-30T16:17:55");
+    stop = DateAndTime("2007-11-30T16:18:01");
+    splitter.push_back(SplittingInterval(start, stop, 0));
+
+    log->splitByTime(splitter, outputs, false);
+
+    auto output = dynamic_cast<TimeSeriesProperty<int> *>(outputs[0]);
+    TS_ASSERT_EQUALS(output->realSize(), 2);
+    TS_ASSERT_EQUALS(output->size(), 2);
+    TS_ASSERT_EQUALS(output->firstTime(), DateAndTime("2007-11-30T16:17:50"));
+
+    delete log;
+    delete outputs[0];
+  }
+
   //----------------------------------------------------------------------------
   /**
    * otuput 0 has entries: 3
@@ -1606,6 +1634,27 @@ public:
     return;
   }
 
+  void test_create_from_nanosecond_offsets() {
+    const Mantid::Types::Core::DateAndTime tStart("2007-11-30T16:17:00");
+    const std::vector<int64_t> offsets{0, 20000000000, 10000000000,
+                                       30000000000};
+    const std::vector<double> values{1.0, 3.0, 2.0, 4.0};
+
+    TimeSeriesProperty<double> seconds("fromSeconds");
+    seconds.create(tStart, std::vector<double>{0.0, 20.0, 10.0, 30.0}, values);
+    TimeSeriesProperty<double> nanoseconds("fromNanoseconds");
+    nanoseconds.create(tStart, offsets, values);
+
+    TS_ASSERT_EQUALS(nanoseconds.size(), 4);
+    TS_ASSERT_EQUALS(nanoseconds.timesAsVector(), seconds.timesAsVector());
+    TS_ASSERT_EQUALS(nanoseconds.valuesAsVector(), seconds.valuesAsVector());
+    TS_ASSERT_EQUALS(nanoseconds.firstTime(), tStart);
+    TS_ASSERT_EQUALS(nanoseconds.lastValue(), 4.0);
+
+    TS_ASSERT_THROWS(nanoseconds.create(tStart, offsets, {1.0}),
+                     const std::invalid_argument &);
+  }
+
   /*
    * Test time_tValue()
    */
@@ -217,6 +217,83 @@ public:
     TS_ASSERT_EQUALS(i.stop(), DateAndTime("2007-11-30T16:18:10"));
   }
 
+  //----------------------------------------------------------------------------
+  void test_AND_with_unsorted_splitter_matches_sorted_splitter() {
+    TimeSplitterType a, b;
+    a.push_back(SplittingInterval(DateAndTime("2007-11-30T16:17:00"),
+                                  DateAndTime("2007-11-30T16:17:10"), 0));
+    a.push_back(SplittingInterval(DateAndTime("2007-11-30T16:17:20"),
+                                  DateAndTime("2007-11-30T16:17:30"), 0));
+    b.push_back(SplittingInterval(DateAndTime("2007-11-30T16:17:26"),
+                                  DateAndTime("2007-11-30T16:17:27"), 0));
+    b.push_back(SplittingInterval(DateAndTime("2007-11-30T16:17:01"),
+                                  DateAndTime("2007-11-30T16:17:25"), 0));
+
+    TimeSplitterType unsortedResult = a & b;
+    std::sort(b.begin(), b.end());
+    TimeSplitterType sortedResult = a & b;
+    std::sort(unsortedResult.begin(), unsortedResult.end());
+
+    TS_ASSERT_EQUALS(unsortedResult.size(), 3);
+    TS_ASSERT_EQUALS(sortedResult.size(), unsortedResult.size());
+    for (size_t i = 0; i < std::min(sortedResult.size(), unsortedResult.size());
+         ++i) {
+      TS_ASSERT_EQUALS(sortedResult[i].start(), unsortedResult[i].start());
+      TS_ASSERT_EQUALS(sortedResult[i].stop(), unsortedResult[i].stop());
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  void test_index_finds_destinations() {
+    TimeSplitterType splitter;
+    splitter.push_back(SplittingInterval(300, 400, 2));
+    splitter.push_back(SplittingInterval(100, 200, 0));
+    splitter.push_back(SplittingInterval(200, 250, 1));
+    const TimeSplitterIndex index(splitter);
+
+    TS_ASSERT(!index.empty());
+    TS_ASSERT_EQUALS(index.destination(int64_t(50)), -1);
+    TS_ASSERT_EQUALS(index.destination(int64_t(100)), 0);
+    TS_ASSERT_EQUALS(index.destination(int64_t(199)), 0);
+    TS_ASSERT_EQUALS(index.destination(int64_t(200)), 1);
+    TS_ASSERT_EQUALS(index.destination(int64_t(260)), -1);
+    TS_ASSERT_EQUALS(index.destination(DateAndTime(int64_t(300))), 2);
+    TS_ASSERT_EQUALS(index.destination(int64_t(400)), -1);
+    TS_ASSERT_EQUALS(index.destination(int64_t(500)), -1);
+  }
+
+  void test_index_of_empty_splitter_has_no_destinations() {
+    const TimeSplitterIndex index{TimeSplitterType()};
+    TS_ASSERT(index.empty());
+    TS_ASSERT_EQUALS(index.destination(int64_t(0)), -1);
+  }
+
+  void test_index_throws_for_overlapping_intervals() {
+    TimeSplitterType splitter;
+    splitter.push_back(SplittingInterval(100, 200, 0));
+    splitter.push_back(SplittingInterval(150, 250, 1));
+    TS_ASSERT_THROWS(TimeSplitterIndex index(splitter),
+                     const std::invalid_argument &);
+  }
+
+  void test_index_splitter_gives_back_the_sorted_intervals() {
+    TimeSplitterType splitter;
+    splitter.push_back(SplittingInterval(300, 400, 2));
+    splitter.push_back(SplittingInterval(100, 200, 0));
+    splitter.push_back(SplittingInterval(500, 500, 1));
+    const auto result = TimeSplitterIndex(splitter).splitter();
+
+    TS_ASSERT_EQUALS(result.size(), 2);
+    if (result.size() != 2)
+      return;
+    TS_ASSERT_EQUALS(result[0].start(), DateAndTime(int64_t(100)));
+    TS_ASSERT_EQUALS(result[0].stop(), DateAndTime(int64_t(200)));
+    TS_ASSERT_EQUALS(result[0].index(), 0);
+    TS_ASSERT_EQUALS(result[1].start(), DateAndTime(int64_t(300)));
+    TS_ASSERT_EQUALS(result[1].stop(), DateAndTime(int64_t(400)));
+    TS_ASSERT_EQUALS(result[1].index(), 2);
+  }
+
   //----------------------------------------------------------------------------
   void test_OR() {
     // Make a splitter
@@ -0,0 +1,91 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_TRACERECORDERTEST_H_
+#define MANTID_KERNEL_TRACERECORDERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/TraceRecorder.h"
+
+#include <sstream>
+
+using namespace Mantid::Kernel;
+
+class TraceRecorderTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static TraceRecorderTest *createSuite() { return new TraceRecorderTest(); }
+  static void destroySuite(TraceRecorderTest *suite) { delete suite; }
+
+  void setUp() override {
+    TraceRecorder::Instance().disable();
+    TraceRecorder::Instance().clear();
+  }
+
+  void tearDown() override {
+    TraceRecorder::Instance().disable();
+    TraceRecorder::Instance().clear();
+  }
+
+  void test_nothing_recorded_when_disabled() {
+    { TraceSpan span("Disabled", "test"); }
+    TS_ASSERT_EQUALS(TraceRecorder::Instance().size(), 0);
+  }
+
+  void test_spans_are_written_as_chrome_trace_events() {
+    auto &recorder = TraceRecorder::Instance();
+    recorder.enable();
+    {
+      TraceSpan outer("Outer", "test");
+      TraceSpan inner("Inner \"quoted\"", "test");
+      inner.addArg("bytes", "42");
+    }
+    recorder.addCounter("Memory", 1.5);
+    TS_ASSERT_EQUALS(recorder.size(), 3);
+
+    std::ostringstream out;
+    recorder.write(out);
+    const auto json = out.str();
+    TS_ASSERT_DIFFERS(json.find("\"traceEvents\":["), std::string::npos);
+    TS_ASSERT_DIFFERS(json.find("{\"name\":\"Outer\",\"cat\":\"test\","
+                                "\"ph\":\"X\""),
+                      std::string::npos);
+    TS_ASSERT_DIFFERS(json.find("\"name\":\"Inner \\\"quoted\\\"\""),
+                      std::string::npos);
+    TS_ASSERT_DIFFERS(json.find("\"args\":{\"bytes\":\"42\"}"),
+                      std::string::npos);
+    TS_ASSERT_DIFFERS(json.find("\"ph\":\"C\""), std::string::npos);
+    TS_ASSERT_DIFFERS(json.find("\"args\":{\"value\":1.5}"),
+                      std::string::npos);
+    TS_ASSERT_DIFFERS(json.find("\"thread_name\""), std::string::npos);
+  }
+
+  void test_span_started_while_disabled_is_not_recorded() {
+    auto &recorder = TraceRecorder::Instance();
+    {
+      TraceSpan span("Started before", "test");
+      recorder.enable();
+    }
+    TS_ASSERT_EQUALS(recorder.size(), 0);
+  }
+
+  void test_thread_pool_tasks_are_recorded() {
+    auto &recorder = TraceRecorder::Instance();
+    recorder.enable();
+    ThreadPool pool(new ThreadSchedulerFIFO(), 2);
+    for (int i = 0; i < 10; ++i)
+      pool.schedule(
+          std::make_shared<FunctionTask>(boost::function<void()>([] {})));
+    pool.joinAll();
+    TS_ASSERT_EQUALS(recorder.size(), 10);
+  }
+};
+
+#endif /* MANTID_KERNEL_TRACERECORDERTEST_H_ */
@@ -15,6 +15,7 @@
 #include <boost/lexical_cast.hpp>
 #include <cfloat>
 #include <limits>
+#include <memory>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::Kernel::Units;
@@ -246,6 +247,42 @@ public:
     delete unit;
   }
 
+  void test_range_conversions_match_single_value_conversions() {
+    const std::vector<double> values{0., 1.5, 100., 1234.5, 20000.};
+    auto close = [](const double actual, const double expected) {
+      return actual == expected ||
+             std::abs(actual - expected) <= 1e-14 * std::abs(expected);
+    };
+    std::vector<std::unique_ptr<Unit>> units;
+    units.emplace_back(new TOF());
+    units.emplace_back(new Wavelength());
+    units.emplace_back(new dSpacing());
+    units.emplace_back(new MomentumTransfer());
+    units.emplace_back(new DeltaE());
+    units.emplace_back(new DeltaE_inWavenumber());
+    units.emplace_back(new SpinEchoLength());
+    units.emplace_back(new Energy());
+    for (auto &unit : units) {
+      for (const int emode : {0, 1, 2}) {
+        try {
+          unit->initialize(10.0, 2.0, 0.7, emode, 25.0, 0.0);
+        } catch (std::invalid_argument &) {
+          continue;
+        }
+        auto tofs = values;
+        unit->toTOFRange(tofs.data(), tofs.data() + tofs.size());
+        auto converted = values;
+        unit->fromTOFRange(converted.data(), converted.data() + tofs.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+          TSM_ASSERT(unit->unitID(),
+                     close(tofs[i], unit->singleToTOF(values[i])));
+          TSM_ASSERT(unit->unitID(),
+                     close(converted[i], unit->singleFromTOF(values[i])));
+        }
+      }
+    }
+  }
+
   //----------------------------------------------------------------------
   // TOF tests
   //----------------------------------------------------------------------
@@ -0,0 +1,124 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_V3DARRAYSTEST_H_
+#define MANTID_KERNEL_V3DARRAYSTEST_H_
+
+#include "MantidKernel/Matrix.h"
+#include "MantidKernel/Quat.h"
+#include "MantidKernel/V3DArrays.h"
+#include <cxxtest/TestSuite.h>
+
+#include <vector>
+
+using Mantid::Kernel::DblMatrix;
+using Mantid::Kernel::Quat;
+using Mantid::Kernel::V3D;
+using Mantid::Kernel::V3DArrays;
+
+class V3DArraysTest : public CxxTest::TestSuite {
+public:
+  void test_construction_from_vectors_keeps_the_vectors() {
+    const auto vectors = testVectors();
+    const V3DArrays arrays(vectors);
+    TS_ASSERT_EQUALS(arrays.size(), vectors.size());
+    for (size_t i = 0; i < vectors.size(); ++i) {
+      TS_ASSERT_EQUALS(arrays[i], vectors[i]);
+    }
+  }
+
+  void test_resize_pads_with_zero_vectors() {
+    V3DArrays arrays;
+    TS_ASSERT(arrays.empty());
+    arrays.push_back(V3D(1., 2., 3.));
+    arrays.resize(3);
+    TS_ASSERT_EQUALS(arrays.size(), 3);
+    TS_ASSERT_EQUALS(arrays[0], V3D(1., 2., 3.));
+    TS_ASSERT_EQUALS(arrays[2], V3D(0., 0., 0.));
+    arrays.set(2, V3D(4., 5., 6.));
+    TS_ASSERT_EQUALS(arrays[2], V3D(4., 5., 6.));
+    TS_ASSERT_EQUALS(arrays.z()[2], 6.);
+  }
+
+  void test_rotate_matches_Quat_rotate() {
+    auto vectors = testVectors();
+    V3DArrays arrays(vectors);
+    const Quat rotation(37., V3D(1., -2., 0.5));
+    arrays.rotate(rotation);
+    for (size_t i = 0; i < vectors.size(); ++i) {
+      rotation.rotate(vectors[i]);
+      assertSameVector(arrays[i], vectors[i]);
+    }
+  }
+
+  void test_multiply_matches_Matrix_product() {
+    auto vectors = testVectors();
+    V3DArrays arrays(vectors);
+    DblMatrix ub(3, 3);
+    ub[0][0] = 0.1;
+    ub[0][1] = -0.3;
+    ub[0][2] = 0.02;
+    ub[1][0] = 0.5;
+    ub[1][1] = 0.04;
+    ub[1][2] = -0.7;
+    ub[2][0] = 0.2;
+    ub[2][1] = 0.9;
+    ub[2][2] = 0.15;
+    arrays.multiply(ub);
+    for (size_t i = 0; i < vectors.size(); ++i) {
+      assertSameVector(arrays[i], ub * vectors[i]);
+    }
+  }
+
+  void test_multiply_throws_for_a_matrix_that_is_not_3x3() {
+    V3DArrays arrays(testVectors());
+    TS_ASSERT_THROWS(arrays.multiply(DblMatrix(3, 4)),
+                     const std::invalid_argument &);
+  }
+
+  void test_distances_match_V3D_distance() {
+    const auto vectors = testVectors();
+    const V3DArrays arrays(vectors);
+    const V3D point(0.3, -4., 2.5);
+    std::vector<double> result;
+    arrays.distances(point, result);
+    TS_ASSERT_EQUALS(result.size(), vectors.size());
+    for (size_t i = 0; i < vectors.size(); ++i) {
+      TS_ASSERT_DELTA(result[i], vectors[i].distance(point), 1e-12);
+    }
+  }
+
+  void test_distancesToLines_match_V3D_arithmetic() {
+    auto vectors = testVectors();
+    for (auto &vector : vectors) {
+      vector.normalize();
+    }
+    const V3DArrays arrays(vectors);
+    const V3D point(0.3, -4., 2.5);
+    std::vector<double> result;
+    arrays.distancesToLines(point, result);
+    TS_ASSERT_EQUALS(result.size(), vectors.size());
+    for (size_t i = 0; i < vectors.size(); ++i) {
+      const V3D distance = point - vectors[i] * point.scalar_prod(vectors[i]);
+      TS_ASSERT_DELTA(result[i], distance.norm(), 1e-12);
+    }
+  }
+
+private:
+  std::vector<V3D> testVectors() const {
+    return {V3D(1., 0., 0.),   V3D(0., 1., 0.),    V3D(0., 0., 1.),
+            V3D(1., 2., 3.),   V3D(-4., 0.5, 2.2), V3D(0.1, -7., 3.),
+            V3D(9., 8., -0.3), V3D(-1., -1., -1.)};
+  }
+
+  void assertSameVector(const V3D &actual, const V3D &expected) const {
+    TS_ASSERT_DELTA(actual.X(), expected.X(), 1e-12);
+    TS_ASSERT_DELTA(actual.Y(), expected.Y(), 1e-12);
+    TS_ASSERT_DELTA(actual.Z(), expected.Z(), 1e-12);
+  }
+};
+
+#endif /* MANTID_KERNEL_V3DARRAYSTEST_H_ */
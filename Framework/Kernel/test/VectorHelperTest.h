@@ -504,6 +504,91 @@ public:
     TS_ASSERT(inputData[indOfMax + 1] < output[indOfMax]);
   }
 
+  void test_rebin_of_arrays_matches_rebin_of_vectors() {
+    const std::vector<double> xold{0., 1., 2.5, 3., 4.5, 6.};
+    const std::vector<double> yold{3., 5., 1., 7., 2.};
+    const std::vector<double> eold{1., 2., 1.5, 0.5, 3.};
+    const std::vector<double> xnew{0.5, 2., 2.2, 4., 7.};
+    for (const bool distribution : {false, true}) {
+      std::vector<double> yexpected(4), eexpected(4);
+      VectorHelper::rebin(xold, yold, eold, xnew, yexpected, eexpected,
+                          distribution);
+      std::vector<double> ynew(4, -1.), enew(4, -1.);
+      VectorHelper::rebin(xold.data(), yold.data(), eold.data(), yold.size(),
+                          xnew.data(), ynew.data(), enew.data(), ynew.size(),
+                          distribution);
+      TS_ASSERT_EQUALS(ynew, yexpected);
+      TS_ASSERT_EQUALS(enew, eexpected);
+    }
+  }
+
+  void test_rebinHistogram_of_arrays_matches_rebinHistogram_of_vectors() {
+    const std::vector<double> xold{0., 1., 2.5, 3., 4.5, 6.};
+    const std::vector<double> yold{3., 5., 1., 7., 2.};
+    const std::vector<double> eold{1., 2., 1.5, 0.5, 3.};
+    const std::vector<double> xnew{0.5, 2., 2.2, 4., 7.};
+    std::vector<double> yexpected(4), eexpected(4);
+    VectorHelper::rebinHistogram(xold, yold, eold, xnew, yexpected, eexpected,
+                                 false);
+    std::vector<double> ynew(4, -1.), enew(4, -1.);
+    VectorHelper::rebinHistogram(xold.data(), yold.data(), eold.data(),
+                                 yold.size(), xnew.data(), ynew.data(),
+                                 enew.data(), ynew.size(), false);
+    TS_ASSERT_EQUALS(ynew, yexpected);
+    TS_ASSERT_EQUALS(enew, eexpected);
+  }
+
+  void test_rebinHistogram_stops_at_the_last_new_bin_edge() {
+    const std::vector<double> xold{0., 1., 2., 3.};
+    const std::vector<double> yold{1., 2., 4.};
+    const std::vector<double> eold{1., 1., 1.};
+    const std::vector<double> xnew{0., 2.};
+    std::vector<double> ynew(1), enew(1);
+    VectorHelper::rebinHistogram(xold, yold, eold, xnew, ynew, enew, false);
+    TS_ASSERT_EQUALS(ynew[0], 3.);
+    TS_ASSERT_DELTA(enew[0], std::sqrt(2.), 1e-12);
+  }
+
+  void test_RebinOverlaps_matches_rebinHistogram() {
+    const std::vector<double> xold{0., 1., 2.5, 3., 4.5, 6.};
+    const std::vector<double> eold{1., 2., 1.5, 0.5, 3.};
+    const std::vector<std::vector<double>> xnews{{0.5, 2., 2.2, 4., 7.},
+                                                 {-1., 0., 1., 2.5, 6.},
+                                                 {1., 1.5, 2., 2.5},
+                                                 {-3., -2.},
+                                                 {0., 6.}};
+    for (const auto &xnew : xnews) {
+      const VectorHelper::RebinOverlaps overlaps(xold, xnew);
+      for (int spectrum = 0; spectrum < 3; ++spectrum) {
+        std::vector<double> yold{3., 5., 1., 7., 2.};
+        for (auto &y : yold)
+          y *= spectrum + 1;
+        const size_t size = xnew.size() - 1;
+        std::vector<double> yexpected(size), eexpected(size);
+        VectorHelper::rebinHistogram(xold, yold, eold, xnew, yexpected,
+                                     eexpected, false);
+        std::vector<double> ynew(size, -1.), enew(size, -1.);
+        overlaps.rebinHistogram(yold, eold, ynew, enew);
+        for (size_t i = 0; i < size; ++i) {
+          TS_ASSERT_DELTA(ynew[i], yexpected[i], 1e-12);
+          TS_ASSERT_DELTA(enew[i], eexpected[i], 1e-12);
+        }
+      }
+    }
+  }
+
+  void test_RebinOverlaps_throws_for_wrong_sizes() {
+    const VectorHelper::RebinOverlaps overlaps({0., 1., 2.}, {0., 2.});
+    std::vector<double> ynew(1), enew(1);
+    TS_ASSERT_THROWS(
+        overlaps.rebinHistogram({1., 2., 3.}, {1., 2., 3.}, ynew, enew),
+        const std::runtime_error &);
+    std::vector<double> tooLong(2);
+    TS_ASSERT_THROWS(
+        overlaps.rebinHistogram({1., 2.}, {1., 2.}, tooLong, enew),
+        const std::runtime_error &);
+  }
+
 private:
   /// Testing bins
   std::vector<double> m_test_bins;
@@ -561,6 +646,17 @@ public:
     }
   }
 
+  void testRebinHistogramLargerWithOverlaps() {
+    auto size = largerBinEdges.size() - 1;
+    const VectorHelper::RebinOverlaps overlaps(binEdges, largerBinEdges);
+    std::vector<double> yout(size);
+    std::vector<double> eout(size);
+    for (size_t i = 0; i < nIters; i++) {
+      overlaps.rebinHistogram(counts.data(), errors.data(), yout.data(),
+                              eout.data());
+    }
+  }
+
 private:
   const size_t binSize = 10000;
   const size_t nIters = 10000;
@@ -134,9 +134,19 @@ public:
 protected:
   // Initialize the event buffer
   void initEventBuffer(const TCPStreamEventDataSetup &setup);
-  // Save received event data in the buffer workspace
-  void saveEvents(const std::vector<TCPStreamEventNeutron> &data,
+  /// Events of a packet, waiting to be added to the buffer workspaces
+  struct EventPacket {
+    Types::Core::DateAndTime pulseTime;
+    size_t period;
+    std::vector<TCPStreamEventNeutron> events;
+  };
+
+  // Save received event data until the next call to extractData()
+  void saveEvents(std::vector<TCPStreamEventNeutron> &&data,
                   const Types::Core::DateAndTime &pulseTime, size_t period);
+  // Add the events of received packets to the workspaces of each period
+  void addEvents(const std::vector<EventPacket> &packets,
+                 const std::vector<DataObjects::EventWorkspace_sptr> &outputs);
   // Set the spectra-detector map
   void loadSpectraMap();
   // Load the instrument
@@ -188,7 +198,10 @@ protected:
 
   /// Used to buffer events between calls to extractData()
   std::vector<DataObjects::EventWorkspace_sptr> m_eventBuffer;
-  /// Protects m_eventBuffer
+  /// Packets received since the last call to extractData(). They are decoded
+  /// by extractData() so that the background thread only reads the socket.
+  std::vector<EventPacket> m_packets;
+  /// Protects m_eventBuffer, m_packets and m_warnings
   std::mutex m_mutex;
   /// Run start time
   Types::Core::DateAndTime m_startTime;
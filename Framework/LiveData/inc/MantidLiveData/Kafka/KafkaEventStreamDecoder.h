@@ -13,6 +13,7 @@
 #include "MantidLiveData/Kafka/IKafkaStreamDecoder.h"
 #include "MantidLiveData/Kafka/IKafkaStreamSubscriber.h"
 
+#include <atomic>
 #include <vector>
 
 namespace Mantid {
@@ -37,6 +38,15 @@ public:
     size_t pulseIndex;
   };
 
+  /// What to do with new messages when the buffers hold the most events
+  /// allowed between extractions
+  enum class BufferOverflowPolicy {
+    /// Stop consuming until LoadLiveData extracts the buffered events
+    Block,
+    /// Discard the buffered events to make room for new ones
+    DropOldest
+  };
+
 public:
   KafkaEventStreamDecoder(std::shared_ptr<IKafkaBroker> broker,
                           const std::string &eventTopic,
@@ -56,6 +66,12 @@ public:
   bool hasReachedEndOfRun() noexcept override;
   ///@}
 
+  ///@name Modifying
+  ///@{
+  void setBufferLimit(const std::size_t maxEvents,
+                      const BufferOverflowPolicy policy);
+  ///@}
+
 private:
   void captureImplExcept() override;
 
@@ -64,6 +80,9 @@ private:
 
   void flushIntermediateBuffer();
 
+  bool localBuffersFull() const;
+  void dropLocalEvents();
+
   /// Create the cache workspaces, LoadLiveData extracts data from these
   void initLocalCaches(const std::string &rawMsgBuffer,
                        const RunStartStruct &runStartData) override;
@@ -80,15 +99,26 @@ private:
   /// m_localEvents
   std::vector<BufferedEvent> m_receivedEventBuffer;
   std::vector<BufferedPulse> m_receivedPulseBuffer;
+  /// The events each thread inserts into m_localEvents, kept between flushes
+  /// to reuse their storage
+  std::vector<std::vector<BufferedEvent>> m_eventGroups;
   /// Mutex protecting intermediate buffers
   mutable std::mutex m_intermediateBufferMutex;
   /// The number of events above which the intermediate buffer will be flushed
   const std::size_t m_intermediateBufferFlushThreshold;
+  /// The number of events in m_localEvents
+  std::atomic<std::size_t> m_localEventCount{0};
+  /// The most events m_localEvents may hold between extractions, 0 for no
+  /// limit
+  std::atomic<std::size_t> m_maxLocalEvents{0};
+  std::atomic<BufferOverflowPolicy> m_bufferOverflowPolicy{
+      BufferOverflowPolicy::Block};
 };
 
-DLLExport std::vector<size_t> computeGroupBoundaries(
+DLLExport void groupEventsByWorkspaceIndex(
     const std::vector<KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
-    const size_t numberOfGroups);
+    const size_t numberOfSpectra,
+    std::vector<std::vector<KafkaEventStreamDecoder::BufferedEvent>> &groups);
 
 } // namespace LiveData
 } // namespace Mantid
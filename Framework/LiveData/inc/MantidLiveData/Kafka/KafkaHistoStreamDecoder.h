@@ -50,6 +50,9 @@ private:
 private:
   std::string m_buffer;
   DataObjects::Workspace2D_sptr m_workspace;
+  /// The histograms of the last extraction. Extractions return copies that
+  /// share its data, which is only replaced, never modified, by the next one.
+  DataObjects::Workspace2D_sptr m_histograms;
 };
 
 } // namespace LiveData
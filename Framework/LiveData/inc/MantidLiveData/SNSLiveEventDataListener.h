@@ -101,15 +101,23 @@ private:
   // Returns true if we've got a value for every log listed in m_requiredLogs
   bool haveRequiredLogs();
 
-  void appendEvent(const uint32_t pixelId, const double tof,
-                   const Mantid::Types::Core::DateAndTime pulseTime);
+  void bufferEvent(const uint32_t pixelId, const double tof);
   // tof is "Time Of Flight" and is in units of microsecondss relative to the
   // start of the pulse
   // (There's some documentation that says nanoseconds, but Russell Taylor
   // assures me it's really is microseconds!)
-  // pulseTime is the start of the pulse relative to Jan 1, 1990.
-  // Both values are designed to be passed straight into the TofEvent
-  // constructor.
+  // The value is designed to be passed straight into the TofEvent
+  // constructor, together with the pulse time of the packet.
+
+  // An event of the packet being parsed, whose workspace index has already
+  // been looked up
+  struct PacketEvent {
+    size_t workspaceIndex;
+    double tof;
+  };
+  // The events of the banked event packet being parsed. Kept between packets
+  // to reuse the storage.
+  std::vector<PacketEvent> m_packetEvents;
 
   ILiveListener::RunStatus m_status{RunStatus::NoRun};
   int m_runNumber{0};
@@ -118,7 +126,8 @@ private:
 
   bool m_workspaceInitialized{false};
   std::string m_wsName;
-  detid2index_map m_indexMap;        // maps pixel id's to workspace indexes
+  std::vector<size_t> m_indexMap; // maps pixel id's to workspace indexes
+  detid_t m_indexMapOffset{0};    // pixel id + offset = index in m_indexMap
   detid2index_map m_monitorIndexMap; // Same as above for the monitor workspace
 
   // We need these 2 strings to initialize m_buffer
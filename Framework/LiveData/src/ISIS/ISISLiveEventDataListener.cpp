@@ -17,7 +17,9 @@
 #include "MantidAPI/WorkspaceGroup.h"
 
 #include "MantidKernel/DateAndTime.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/OptionalBool.h"
+#include "MantidKernel/RuntimeCounters.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/WarningSuppressions.h"
@@ -29,6 +31,11 @@ GNU_DIAG_OFF("unused-variable")
 #endif
 #include "DAE/idc.h"
 
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <numeric>
+
 const char *PROTON_CHARGE_PROPERTY = "proton_charge";
 const char *RUN_NUMBER_PROPERTY = "run_number";
 
@@ -49,6 +56,8 @@ ISISLiveEventDataListener::ISISLiveEventDataListener()
     : LiveListener(), m_isConnected(false), m_stopThread(false), m_runNumber(0),
       m_daeHandle(), m_numberOfPeriods(0), m_numberOfSpectra(0) {
   m_warnings["period"] = "Period number is outside the range. Changed to 0.";
+  m_warnings["spectrum"] =
+      "Spectrum number is outside the range. Events were dropped.";
 }
 
 /**
@@ -173,7 +182,7 @@ boost::shared_ptr<API::Workspace> ISISLiveEventDataListener::extractData() {
     throw std::runtime_error("Background thread stopped.");
   }
 
-  std::lock_guard<std::mutex> scopedLock(m_mutex);
+  std::unique_lock<std::mutex> lock(m_mutex);
 
   std::vector<DataObjects::EventWorkspace_sptr> outWorkspaces(
       m_numberOfPeriods);
@@ -198,6 +207,24 @@ boost::shared_ptr<API::Workspace> ISISLiveEventDataListener::extractData() {
 
     outWorkspaces[i] = temp;
   }
+  std::vector<EventPacket> packets;
+  packets.swap(m_packets);
+  lock.unlock();
+
+  // The background thread carries on receiving while the events are added
+  const auto start = std::chrono::steady_clock::now();
+  addEvents(packets, outWorkspaces);
+  const std::chrono::duration<double> dur =
+      std::chrono::steady_clock::now() - start;
+  if (!packets.empty()) {
+    const auto nEvents = std::accumulate(
+        packets.cbegin(), packets.cend(), size_t(0),
+        [](size_t n, const EventPacket &packet) {
+          return n + packet.events.size();
+        });
+    g_log.debug() << "Added " << nEvents << " events from " << packets.size()
+                  << " packets in " << dur.count() << " seconds\n";
+  }
 
   if (m_numberOfPeriods > 1) {
     // create a workspace group in case the data are multiperiod
@@ -287,7 +314,7 @@ void ISISLiveEventDataListener::run() {
       }
 
       // store the events
-      saveEvents(events.data, pulseTime, events.head_n.period);
+      saveEvents(std::move(events.data), pulseTime, events.head_n.period);
     }
 
   } catch (std::runtime_error &e) {
@@ -377,12 +404,21 @@ void ISISLiveEventDataListener::initEventBuffer(
 }
 
 /**
- * Save received event data in the buffer workspace.
+ * Save received event data until the next call to extractData().
  * @param data :: A vector with events.
+ * @param pulseTime :: The pulse time of the events.
+ * @param period :: The period of the events.
  */
 void ISISLiveEventDataListener::saveEvents(
-    const std::vector<TCPStreamEventNeutron> &data,
+    std::vector<TCPStreamEventNeutron> &&data,
     const Types::Core::DateAndTime &pulseTime, size_t period) {
+  static auto &packetsReceived =
+      Kernel::RuntimeCounters::Instance().counter("isis_live_packets_received");
+  static auto &eventsReceived =
+      Kernel::RuntimeCounters::Instance().counter("isis_live_events_received");
+  packetsReceived.fetch_add(1, std::memory_order_relaxed);
+  eventsReceived.fetch_add(data.size(), std::memory_order_relaxed);
+
   std::lock_guard<std::mutex> scopedLock(m_mutex);
 
   if (period >= static_cast<size_t>(m_numberOfPeriods)) {
@@ -394,11 +430,78 @@ void ISISLiveEventDataListener::saveEvents(
     period = 0;
   }
 
-  for (const auto &streamEvent : data) {
-    Types::Event::TofEvent event(streamEvent.time_of_flight, pulseTime);
-    m_eventBuffer[period]
-        ->getSpectrum(streamEvent.spectrum)
-        .addEventQuickly(event);
+  m_packets.push_back(EventPacket{pulseTime, period, std::move(data)});
+}
+
+/**
+ * Add the events of received packets to the workspaces of each period. The
+ * events of a period are first grouped by spectrum into a single staging
+ * block, keeping the order they were received in, so that each event list
+ * can be reserved and filled in one go, in parallel over the spectra.
+ * @param packets :: The packets received.
+ * @param outputs :: The workspaces to add the events to, one per period.
+ */
+void ISISLiveEventDataListener::addEvents(
+    const std::vector<EventPacket> &packets,
+    const std::vector<DataObjects::EventWorkspace_sptr> &outputs) {
+  static auto &eventsDropped =
+      Kernel::RuntimeCounters::Instance().counter("isis_live_events_dropped");
+  const size_t nSpectra = outputs[0]->getNumberHistograms();
+  size_t dropped = 0;
+
+  for (size_t period = 0; period < outputs.size(); ++period) {
+    // Count the events of each spectrum to find where they go in the block
+    std::vector<size_t> offsets(nSpectra + 1, 0);
+    for (const auto &packet : packets) {
+      if (packet.period != period)
+        continue;
+      for (const auto &streamEvent : packet.events) {
+        if (streamEvent.spectrum < nSpectra)
+          ++offsets[streamEvent.spectrum + 1];
+        else
+          ++dropped;
+      }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    if (offsets.back() == 0)
+      continue;
+
+    std::vector<Types::Event::TofEvent> staged(offsets.back());
+    auto next = offsets;
+    for (const auto &packet : packets) {
+      if (packet.period != period)
+        continue;
+      for (const auto &streamEvent : packet.events) {
+        if (streamEvent.spectrum < nSpectra)
+          staged[next[streamEvent.spectrum]++] = Types::Event::TofEvent(
+              streamEvent.time_of_flight, packet.pulseTime);
+      }
+    }
+
+    auto &workspace = *outputs[period];
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < static_cast<int64_t>(nSpectra); ++i) {
+      const auto first = staged.cbegin() + offsets[i];
+      const auto last = staged.cbegin() + offsets[i + 1];
+      if (first == last)
+        continue;
+      auto &eventList = workspace.getSpectrum(i);
+      eventList.reserve(eventList.getNumberEvents() +
+                        static_cast<size_t>(std::distance(first, last)));
+      std::for_each(first, last, [&eventList](const auto &event) {
+        eventList.addEventQuickly(event);
+      });
+    }
+  }
+
+  if (dropped > 0) {
+    eventsDropped.fetch_add(dropped, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> scopedLock(m_mutex);
+    auto warn = m_warnings.find("spectrum");
+    if (warn != m_warnings.end()) {
+      g_log.warning() << warn->second << '\n';
+      m_warnings.erase(warn);
+    }
   }
 }
 
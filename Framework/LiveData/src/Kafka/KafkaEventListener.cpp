@@ -7,6 +7,7 @@
 #include "MantidLiveData/Kafka/KafkaEventListener.h"
 #include "MantidAPI/IAlgorithm.h"
 #include "MantidAPI/LiveListenerFactory.h"
+#include "MantidKernel/ListValidator.h"
 #include "MantidLiveData/Kafka/KafkaBroker.h"
 #include "MantidLiveData/Kafka/KafkaEventStreamDecoder.h"
 #include "MantidLiveData/Kafka/KafkaTopicSubscriber.h"
@@ -23,7 +24,20 @@ DECLARE_LISTENER(KafkaEventListener)
 KafkaEventListener::KafkaEventListener() : API::LiveListener() {
   declareProperty("BufferThreshold", static_cast<uint64_t>(1000000),
                   "Threshold number of events at which the intermediate event "
-                  "buffer will be flushed to the buffered EventWorkspace.");
+                  "buffer will be flushed to the buffered EventWorkspace. If "
+                  "0 the events of each message are added to the "
+                  "EventWorkspace directly.");
+  declareProperty("MaxBufferedEvents", static_cast<uint64_t>(0),
+                  "The most events to hold between updates, bounding the "
+                  "memory used when the processing does not keep up with the "
+                  "stream. 0 means there is no limit.");
+  const std::vector<std::string> overflowPolicies{"Block", "DropOldest"};
+  declareProperty(
+      "BufferOverflowPolicy", "Block",
+      boost::make_shared<Kernel::StringListValidator>(overflowPolicies),
+      "What to do once MaxBufferedEvents events are held. Block stops "
+      "reading the stream until the next update, leaving the messages with "
+      "the broker; DropOldest discards the events held so far.");
 }
 
 void KafkaEventListener::setAlgorithm(
@@ -60,6 +74,13 @@ bool KafkaEventListener::connect(const Poco::Net::SocketAddress &address) {
     m_decoder = std::make_unique<KafkaEventStreamDecoder>(
         broker, eventTopic, runInfoTopic, spDetInfoTopic, sampleEnvTopic,
         chopperTopic, bufferThreshold);
+    const std::size_t maxBufferedEvents = getProperty("MaxBufferedEvents");
+    const std::string overflowPolicy = getProperty("BufferOverflowPolicy");
+    m_decoder->setBufferLimit(
+        maxBufferedEvents,
+        overflowPolicy == "DropOldest"
+            ? KafkaEventStreamDecoder::BufferOverflowPolicy::DropOldest
+            : KafkaEventStreamDecoder::BufferOverflowPolicy::Block);
   } catch (std::exception &exc) {
     g_log.error() << "KafkaEventListener::connect - Connection Error: "
                   << exc.what() << "\n";
@@ -30,7 +30,6 @@ GNU_DIAG_ON("conversion")
 #include <chrono>
 #include <json/json.h>
 #include <numeric>
-#include <tbb/parallel_sort.h>
 
 using namespace Mantid::Types;
 using namespace LogSchema;
@@ -77,26 +76,11 @@ void appendToLog(Mantid::API::Run &mutableRunInfo, const std::string &name,
   }
 }
 
-void sortIntermediateEventBuffer(
-    std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
-        &eventBuffer,
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedPulse>
-        &pulseBuffer) {
-  tbb::parallel_sort(
-      eventBuffer.begin(), eventBuffer.end(),
-      [&](const Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent &lhs,
-          const Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent &rhs)
-          -> bool {
-        const auto &lhsPulse = pulseBuffer[lhs.pulseIndex];
-        const auto &rhsPulse = pulseBuffer[rhs.pulseIndex];
-
-        /* If events are from different periods compare the period
-         * numbers, otherwise compare the workspace index */
-        return (lhsPulse.periodNumber != rhsPulse.periodNumber)
-                   ? lhsPulse.periodNumber < rhsPulse.periodNumber
-                   : lhs.wsIdx < rhs.wsIdx;
-      });
-}
+/// Messages with fewer events are decoded on a single thread
+const size_t MIN_EVENTS_FOR_PARALLEL_DECODE = 10000;
+/// The number of ranges of workspace indices per group that are balanced
+/// between the groups in groupEventsByWorkspaceIndex
+const size_t RANGES_PER_GROUP = 64;
 } // namespace
 
 namespace Mantid {
@@ -163,12 +147,25 @@ bool KafkaEventStreamDecoder::hasReachedEndOfRun() noexcept {
   return false;
 }
 
+/**
+ * Bound the memory held by the decoder when LoadLiveData does not keep up
+ * @param maxEvents The most events to hold between extractions, 0 for no
+ * limit
+ * @param policy What to do with new messages once the limit is reached
+ */
+void KafkaEventStreamDecoder::setBufferLimit(
+    const std::size_t maxEvents, const BufferOverflowPolicy policy) {
+  m_maxLocalEvents = maxEvents;
+  m_bufferOverflowPolicy = policy;
+}
+
 // -----------------------------------------------------------------------------
 // Private members
 // -----------------------------------------------------------------------------
 
 API::Workspace_sptr KafkaEventStreamDecoder::extractDataImpl() {
   std::lock_guard<std::mutex> workspaceLock(m_mutex);
+  m_localEventCount = 0;
   g_log.debug() << "Events since last timeout "
                 << totalNumEventsSinceStart - totalNumEventsBeforeLastTimeout
                 << std::endl;
@@ -232,6 +229,7 @@ void KafkaEventStreamDecoder::captureImplExcept() {
   size_t messagesPerPulse = 0;
   size_t numMessagesForSinglePulse = 0;
   size_t pulseTimeCount = 0;
+  size_t nEventsAtLastReport = 0;
   auto globstart = std::chrono::system_clock::now();
   auto start = std::chrono::system_clock::now();
 
@@ -247,6 +245,21 @@ void KafkaEventStreamDecoder::captureImplExcept() {
       waitForDataExtraction();
     }
 
+    if (localBuffersFull()) {
+      if (m_bufferOverflowPolicy == BufferOverflowPolicy::Block) {
+        /* Leave the messages with the broker until LoadLiveData extracts the
+         * buffered events, checking regularly for an interruption */
+        {
+          std::unique_lock<std::mutex> readyLock(m_waitMutex);
+          m_cv.wait_for(readyLock, std::chrono::milliseconds(100),
+                        [&] { return !localBuffersFull(); });
+        }
+        m_cbIterationEnd();
+        continue;
+      }
+      dropLocalEvents();
+    }
+
     // Pull in events
     m_dataStream->consumeMessage(&buffer, offset, partition, topicName);
     // No events, wait for some to come along...
@@ -272,6 +285,20 @@ void KafkaEventStreamDecoder::captureImplExcept() {
                        static_cast<double>(pulseTimeCount);
       g_log.debug() << mpp << " event messages per pulse\n";
       g_log.debug() << "Achievable pulse rate is " << rate / mpp << "Hz\n";
+      g_log.debug() << "Decoding "
+                    << static_cast<double>(nEvents - nEventsAtLastReport) /
+                           dur.count()
+                    << " events per second\n";
+      nEventsAtLastReport = nEvents;
+      if (lastPulseTime != 0) {
+        // Pulse times are in nanoseconds since 1 Jan 1970
+        const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             end.time_since_epoch())
+                             .count();
+        const auto lag = now - static_cast<int64_t>(lastPulseTime);
+        g_log.debug() << "Lagging " << static_cast<double>(lag) * 1e-9
+                      << " seconds behind the last pulse\n";
+      }
       g_log.debug() << "Average time taken to convert event messages "
                     << totalEventFromMessageDuration / numEventFromMessageCalls
                     << " seconds\n";
@@ -392,25 +419,41 @@ void KafkaEventStreamDecoder::eventDataFromMessage(const std::string &buffer,
 
   const auto starttime = std::chrono::system_clock::now();
 
-  {
+  if (m_intermediateBufferFlushThreshold == 0) {
+    /* Without an intermediate buffer the events go straight from the message
+     * into the EventWorkspace in a single pass */
+    std::lock_guard<std::mutex> workspaceLock(m_mutex);
+    auto &periodWs = *m_localEvents[pulse.periodNumber];
+    periodWs.invalidateCommonBinsFlag();
+    for (flatbuffers::uoffset_t i = 0; i < nEvents; ++i) {
+      const uint64_t detId = detData[i];
+      auto *spectrum =
+          periodWs.getSpectrumUnsafe(m_specToIdx[detId + m_specToIdxOffset]);
+      // nanoseconds to microseconds
+      spectrum->addEventQuickly(
+          TofEvent(static_cast<double>(tofData[i]) * 1e-3, pulseTime));
+    }
+    m_localEventCount += nEvents;
+  } else {
     std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
 
     /* Store the buffered pulse */
     m_receivedPulseBuffer.push_back(pulse);
     const auto pulseIndex = m_receivedPulseBuffer.size() - 1;
 
-    /* Ensure storage for newly received events */
+    /* Store the buffered events. Resizing, rather than reserving the exact
+     * size, keeps the growth of the buffer geometric. */
     const auto oldBufferSize(m_receivedEventBuffer.size());
-    m_receivedEventBuffer.reserve(oldBufferSize + nEvents);
-
-    /* Store the buffered events */
-    std::transform(detData.begin(), detData.end(), tofData.begin(),
-                   std::back_inserter(m_receivedEventBuffer),
-                   [&](uint64_t detId, uint64_t tof) -> BufferedEvent {
-                     const auto workspaceIndex =
-                         m_specToIdx[detId + m_specToIdxOffset];
-                     return {workspaceIndex, tof, pulseIndex};
-                   });
+    m_receivedEventBuffer.resize(oldBufferSize + nEvents);
+    auto *events = m_receivedEventBuffer.data() + oldBufferSize;
+    const auto nEventsInt = static_cast<int64_t>(nEvents);
+    PARALLEL_FOR_IF(nEvents >= MIN_EVENTS_FOR_PARALLEL_DECODE)
+    for (int64_t i = 0; i < nEventsInt; ++i) {
+      const auto j = static_cast<flatbuffers::uoffset_t>(i);
+      const uint64_t detId = detData[j];
+      events[i] = {m_specToIdx[detId + m_specToIdxOffset], tofData[j],
+                   pulseIndex};
+    }
   }
 
   const auto endTime = std::chrono::system_clock::now();
@@ -432,13 +475,6 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
 
   std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
 
-  sortIntermediateEventBuffer(m_receivedEventBuffer, m_receivedPulseBuffer);
-
-  /* Compute groups for parallel insertion */
-  const auto numberOfGroups = PARALLEL_GET_MAX_THREADS;
-  const auto groupBoundaries =
-      computeGroupBoundaries(m_receivedEventBuffer, numberOfGroups);
-
   /* Insert events into EventWorkspace(s) */
   {
     std::lock_guard<std::mutex> workspaceLock(m_mutex);
@@ -447,11 +483,18 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
       ws->invalidateCommonBinsFlag();
     }
 
+    /* Each thread inserts the events of its own workspace indices, so no
+     * spectrum is written by two threads */
+    const auto numberOfGroups = PARALLEL_GET_MAX_THREADS;
+    m_eventGroups.resize(static_cast<size_t>(numberOfGroups));
+    groupEventsByWorkspaceIndex(m_receivedEventBuffer,
+                                m_localEvents.front()->getNumberHistograms(),
+                                m_eventGroups);
+
     PARALLEL_FOR_NO_WSP_CHECK()
     for (auto group = 0; group < numberOfGroups; ++group) {
-      for (auto idx = groupBoundaries[group]; idx < groupBoundaries[group + 1];
-           ++idx) {
-        const auto &event = m_receivedEventBuffer[idx];
+      auto &events = m_eventGroups[group];
+      for (const auto &event : events) {
         const auto &pulse = m_receivedPulseBuffer[event.pulseIndex];
 
         auto *spectrum =
@@ -461,7 +504,9 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
         spectrum->addEventQuickly(
             TofEvent(static_cast<double>(event.tof) * 1e-3, pulse.pulseTime));
       }
+      events.clear();
     }
+    m_localEventCount += m_receivedEventBuffer.size();
   }
 
   /* Clear buffers */
@@ -476,6 +521,35 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
   numPopulateWorkspaceCalls += 1;
 } // namespace LiveData
 
+/**
+ * Check if the local buffers hold as many events as allowed between
+ * extractions
+ * @return True if no more events should be added to the buffers
+ */
+bool KafkaEventStreamDecoder::localBuffersFull() const {
+  const std::size_t maxEvents = m_maxLocalEvents;
+  return maxEvents > 0 && m_localEventCount >= maxEvents;
+}
+
+/**
+ * Discard the events received since the last extraction, keeping the logs
+ * and the structure of the buffer workspaces
+ */
+void KafkaEventStreamDecoder::dropLocalEvents() {
+  std::lock_guard<std::mutex> workspaceLock(m_mutex);
+  g_log.warning() << "Dropping the " << m_localEventCount
+                  << " events received since the last update as the data are "
+                     "not being processed quickly enough. Consider raising "
+                     "MaxBufferedEvents.\n";
+  for (auto &ws : m_localEvents) {
+    const auto nspectra = ws->getNumberHistograms();
+    for (size_t i = 0; i < nspectra; ++i) {
+      ws->getSpectrum(i).clear(false);
+    }
+  }
+  m_localEventCount = 0;
+}
+
 /**
  * Get sample environment log data from the flatbuffer and append it to the
  * workspace
@@ -620,59 +694,95 @@ void KafkaEventStreamDecoder::initLocalCaches(
       // A clone should be cheap here as there are no events yet
       m_localEvents[i] = eventBuffer->clone();
     }
+    m_localEventCount = 0;
   }
 
   // New caches so LoadLiveData's output workspace needs to be replaced
   m_dataReset = true;
 }
 
-std::vector<size_t> computeGroupBoundaries(
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
-        &eventBuffer,
-    const size_t numberOfGroups) {
-  std::vector<size_t> groupBoundaries(numberOfGroups + 1);
-
-  /* Fill the buffer with the end of the event buffer index */
-  std::fill(groupBoundaries.begin(), groupBoundaries.end(), eventBuffer.size());
-
-  /* First group always starts at beginning of buffer */
-  groupBoundaries[0] = 0;
-
-  const auto eventsPerGroup =
-      std::max<size_t>(1, eventBuffer.size() / numberOfGroups);
-
-  /* Iterate over groups */
-  for (size_t group = 1; group < numberOfGroups; ++group) {
-    /* Calculate a reasonable end boundary for the group */
-    groupBoundaries[group] = std::min(
-        groupBoundaries[group - 1] + eventsPerGroup - 1, eventBuffer.size());
-
-    /* If we have already gotten through all events then exit early, leaving
-     * some threads without events. */
-    if (groupBoundaries[group] == eventBuffer.size()) {
-      break;
+/**
+ * Distribute buffered events between groups that can be inserted into the
+ * workspaces in parallel. Each group holds all the events of a contiguous
+ * range of workspace indices, with the ranges chosen to balance the number of
+ * events in the groups. Events are scattered, in the order they were
+ * received, in two passes over the buffer rather than sorted.
+ *
+ * @param eventBuffer : The events to distribute
+ * @param numberOfSpectra : The number of workspace indices
+ * @param groups : The groups to append the events to, one per thread
+ */
+void groupEventsByWorkspaceIndex(
+    const std::vector<KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
+    const size_t numberOfSpectra,
+    std::vector<std::vector<KafkaEventStreamDecoder::BufferedEvent>> &groups) {
+  const size_t numberOfGroups = groups.size();
+  if (numberOfGroups == 0 || numberOfSpectra == 0 || eventBuffer.empty()) {
+    return;
+  }
+  const size_t numberOfRanges =
+      std::min(numberOfSpectra, RANGES_PER_GROUP * numberOfGroups);
+  const auto rangeOf = [&](const size_t wsIdx) {
+    return std::min(wsIdx, numberOfSpectra - 1) * numberOfRanges /
+           numberOfSpectra;
+  };
+  // Each thread scans its own chunk of the buffer
+  const size_t numberOfChunks = numberOfGroups;
+  const auto chunkStart = [&](const size_t chunk) {
+    return chunk * eventBuffer.size() / numberOfChunks;
+  };
+  const auto nChunks = static_cast<int>(numberOfChunks);
+
+  /* Count the events in each range of workspace indices */
+  std::vector<size_t> counts(numberOfChunks * numberOfRanges, 0);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int chunk = 0; chunk < nChunks; ++chunk) {
+    const auto iChunk = static_cast<size_t>(chunk);
+    auto *chunkCounts = &counts[iChunk * numberOfRanges];
+    for (size_t i = chunkStart(iChunk); i < chunkStart(iChunk + 1); ++i) {
+      ++chunkCounts[rangeOf(eventBuffer[i].wsIdx)];
     }
+  }
 
-    /* Advance the end boundary of the group until all events for a given
-     * workspace index fall within a single group */
-    while (groupBoundaries[group] + 1 < eventBuffer.size() &&
-           (eventBuffer[groupBoundaries[group]].wsIdx ==
-            eventBuffer[groupBoundaries[group] + 1].wsIdx)) {
-      ++groupBoundaries[group];
+  /* Assign the ranges to groups by the number of events before them */
+  std::vector<size_t> groupOfRange(numberOfRanges);
+  size_t eventsBefore = 0;
+  for (size_t range = 0; range < numberOfRanges; ++range) {
+    groupOfRange[range] = std::min(
+        numberOfGroups - 1, eventsBefore * numberOfGroups / eventBuffer.size());
+    for (size_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+      eventsBefore += counts[chunk * numberOfRanges + range];
     }
+  }
 
-    /* Increment group end boundary (such that group is defined by [lower,
-     * upper) boundaries) */
-    ++groupBoundaries[group];
-
-    /* If we have already gotten through all events then exit early, leaving
-     * some threads without events. */
-    if (groupBoundaries[group] == eventBuffer.size()) {
-      break;
+  /* Find where each chunk writes its events in each group */
+  std::vector<size_t> offsets(numberOfChunks * numberOfGroups, 0);
+  for (size_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+    for (size_t range = 0; range < numberOfRanges; ++range) {
+      offsets[chunk * numberOfGroups + groupOfRange[range]] +=
+          counts[chunk * numberOfRanges + range];
+    }
+  }
+  for (size_t group = 0; group < numberOfGroups; ++group) {
+    size_t size = groups[group].size();
+    for (size_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+      const auto count = offsets[chunk * numberOfGroups + group];
+      offsets[chunk * numberOfGroups + group] = size;
+      size += count;
     }
+    groups[group].resize(size);
   }
 
-  return groupBoundaries;
+  /* Scatter the events */
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int chunk = 0; chunk < nChunks; ++chunk) {
+    const auto iChunk = static_cast<size_t>(chunk);
+    auto *chunkOffsets = &offsets[iChunk * numberOfGroups];
+    for (size_t i = chunkStart(iChunk); i < chunkStart(iChunk + 1); ++i) {
+      const auto group = groupOfRange[rangeOf(eventBuffer[i].wsIdx)];
+      groups[group][chunkOffsets[group]++] = eventBuffer[i];
+    }
+  }
 }
 
 } // namespace LiveData
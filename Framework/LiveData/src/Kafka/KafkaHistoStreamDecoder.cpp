@@ -14,6 +14,7 @@
 #include "MantidHistogramData/BinEdges.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/OptionalBool.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/UnitFactory.h"
@@ -29,6 +30,8 @@ GNU_DIAG_ON("conversion")
 
 #include <json/json.h>
 
+#include <algorithm>
+
 using namespace HistoSchema;
 
 namespace {
@@ -108,26 +111,35 @@ API::Workspace_sptr KafkaHistoStreamDecoder::extractDataImpl() {
 
   // Compiler warnings if one tries to use xbins->begin()/end()
   auto *bindata = xbins->data();
-  HistogramData::BinEdges binedges(&bindata[0], &bindata[xbins->size()]);
-
-  API::MatrixWorkspace_sptr ws{DataObjects::create<DataObjects::Workspace2D>(
-      *m_workspace, nspectra, binedges)};
-
-  ws->setIndexInfo(m_workspace->indexInfo());
+  const auto *binsEnd = bindata + xbins->size();
+
+  // Keep the histograms of the last extraction unless their shape changed
+  if (!m_histograms || m_histograms->getNumberHistograms() != nspectra ||
+      m_histograms->x(0).size() != xbins->size() ||
+      !std::equal(bindata, binsEnd, m_histograms->x(0).cbegin())) {
+    HistogramData::BinEdges binedges(bindata, binsEnd);
+    m_histograms =
+        DataObjects::create<DataObjects::Workspace2D>(*m_workspace, nspectra,
+                                                      binedges);
+    m_histograms->setIndexInfo(m_workspace->indexInfo());
+  }
   auto data = histoMsg->data_as_ArrayDouble()->value();
 
   // Set the units
-  ws->getAxis(0)->setUnit(metadimx->unit()->c_str());
-  ws->setYUnit(metadimy->unit()->c_str());
-
-  std::vector<double> counts;
-  for (size_t i = 0; i < nspectra; ++i) {
+  m_histograms->getAxis(0)->setUnit(metadimx->unit()->c_str());
+  m_histograms->setYUnit(metadimy->unit()->c_str());
+
+  // The counts are copied once, straight from the message. Replacing rather
+  // than modifying them leaves earlier extractions untouched.
+  const auto nspectraInt = static_cast<int64_t>(nspectra);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*m_histograms))
+  for (int64_t i = 0; i < nspectraInt; ++i) {
     const double *start = data->data() + (i * nbins);
-    counts.assign(start, start + nbins);
-    ws->setCounts(i, counts);
+    m_histograms->setCounts(static_cast<size_t>(i), start, start + nbins);
   }
 
-  return ws;
+  // A copy that shares the bin edges, counts and metadata
+  return m_histograms->clone();
 }
 
 /**
@@ -285,6 +297,7 @@ void KafkaHistoStreamDecoder::initLocalCaches(
   m_dataReset = true;
 
   m_workspace = histoBuffer;
+  m_histograms.reset();
 }
 
 void KafkaHistoStreamDecoder::sampleDataFromMessage(
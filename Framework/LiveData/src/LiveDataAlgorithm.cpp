@@ -141,6 +141,16 @@ void LiveDataAlgorithm::initProps() {
       std::make_unique<FileProperty>("PostProcessingScriptFilename", "",
                                      FileProperty::OptionalLoad, "py"),
       " Python script that will be run to process the accumulated data.");
+  declareProperty(
+      "PostProcessChunks", false,
+      "Only post-process each new chunk and add the result to the output "
+      "workspace, rather than post-processing the whole accumulation "
+      "workspace on every update. The cost of an update then no longer grows "
+      "with the length of the run.\n"
+      "Only valid when the post-processing commutes with Plus, e.g. "
+      "ConvertUnits, Rebin or SumSpectra, and the AccumulationMethod is Add; "
+      "the whole accumulation workspace is still post-processed when it is "
+      "replaced.");
 
   std::vector<std::string> runOptions{"Restart", "Stop", "Rename"};
   declareProperty("RunTransitionBehavior", "Restart",
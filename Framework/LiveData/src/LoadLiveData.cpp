@@ -94,12 +94,14 @@ void LoadLiveData::init() { this->initProps(); }
  *
  * @param inputWS :: workspace being processed
  * @param PostProcess :: flag, TRUE if doing the post-processing
+ * @param PostProcessChunk :: flag, TRUE if post-processing a single chunk
+ *rather than the accumulation workspace
  * @return the processed workspace. Will point to inputWS if no processing is to
  *do
  */
 Mantid::API::Workspace_sptr
 LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
-                            bool PostProcess) {
+                            bool PostProcess, bool PostProcessChunk) {
   if (!inputWS)
     throw std::runtime_error(
         "LoadLiveData::runProcessing() called for an empty input workspace.");
@@ -123,8 +125,9 @@ LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
     // Transform the chunk in-place
     std::string outputName = inputName;
 
-    // Except, no need for anonymous names with the post-processing
-    if (PostProcess) {
+    // Except, no need for anonymous names with the post-processing of the
+    // accumulation workspace
+    if (PostProcess && !PostProcessChunk) {
       inputName = this->getPropertyValue("AccumulationWorkspace");
       outputName = this->getPropertyValue("OutputWorkspace");
     }
@@ -175,7 +178,7 @@ LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
           " Algorithm's OutputWorkspace property is not a WorkspaceProperty!");
     Workspace_sptr temp = wsProp->getWorkspace();
 
-    if (!PostProcess) {
+    if (!PostProcess || PostProcessChunk) {
       if (!temp) {
         // a group workspace cannot be returned by wsProp
         temp = AnalysisDataService::Instance().retrieve(inputName);
@@ -225,6 +228,26 @@ void LoadLiveData::runPostProcessing() {
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Perform the PostProcessing steps on a single chunk and add the result to
+ * the output workspace, for post-processing that commutes with Plus.
+ * Updates the m_outputWS member.
+ *
+ * @param chunkWS :: processed live data chunk workspace
+ */
+void LoadLiveData::postProcessChunk(Mantid::API::Workspace_sptr chunkWS) {
+  Workspace_sptr postProcessed;
+  try {
+    postProcessed = runProcessing(chunkWS, true, true);
+  } catch (...) {
+    g_log.error("While post processing chunk:");
+    throw;
+  }
+  WriteLock _lock1(*m_outputWS);
+  ReadLock _lock2(*postProcessed);
+  addWorkspaces(m_outputWS, postProcessed);
+}
+
 //----------------------------------------------------------------------------------------------
 /** Accumulate the data by adding (summing) to the output workspace.
  * Calls the Plus algorithm
@@ -236,12 +259,22 @@ void LoadLiveData::addChunk(Mantid::API::Workspace_sptr chunkWS) {
   // Acquire locks on the workspaces we use
   WriteLock _lock1(*m_accumWS);
   ReadLock _lock2(*chunkWS);
+  addWorkspaces(m_accumWS, chunkWS);
+}
 
+//----------------------------------------------------------------------------------------------
+/** Add a chunk to an accumulated workspace of the same kind.
+ *
+ * @param accumWS :: accumulated workspace, replaced for MD workspaces
+ * @param chunkWS :: workspace to add to it
+ */
+void LoadLiveData::addWorkspaces(Workspace_sptr &accumWS,
+                                 const Workspace_sptr &chunkWS) {
   // ISIS multi-period data come in workspace groups
   if (WorkspaceGroup_sptr gws =
           boost::dynamic_pointer_cast<WorkspaceGroup>(chunkWS)) {
     WorkspaceGroup_sptr accum_gws =
-        boost::dynamic_pointer_cast<WorkspaceGroup>(m_accumWS);
+        boost::dynamic_pointer_cast<WorkspaceGroup>(accumWS);
     if (!accum_gws) {
       throw std::runtime_error("Two workspace groups are expected.");
     }
@@ -258,10 +291,10 @@ void LoadLiveData::addChunk(Mantid::API::Workspace_sptr chunkWS) {
   } else if (MatrixWorkspace_sptr mws =
                  boost::dynamic_pointer_cast<MatrixWorkspace>(chunkWS)) {
     // If workspace is a Matrix workspace just add the chunk
-    addMatrixWSChunk(m_accumWS, chunkWS);
+    addMatrixWSChunk(accumWS, chunkWS);
   } else {
     // Assume MD Workspace
-    addMDWSChunk(m_accumWS, chunkWS);
+    addMDWSChunk(accumWS, chunkWS);
   }
 }
 
@@ -591,7 +624,16 @@ void LoadLiveData::exec() {
 
   if (this->hasPostProcessing()) {
     // ----------- Run post-processing -------------
-    this->runPostProcessing();
+    const bool postProcessChunks = this->getProperty("PostProcessChunks");
+    if (postProcessChunks && accum == "Add" && m_outputWS) {
+      // Only the new chunk needs post-processing, the earlier ones are
+      // already in the output
+      this->postProcessChunk(processed);
+      if (preserveEvents)
+        this->updateDefaultBinBoundaries(m_outputWS.get());
+    } else {
+      this->runPostProcessing();
+    }
     // Set both output workspaces
     this->setProperty("AccumulationWorkspace", m_accumWS);
     this->setProperty("OutputWorkspace", m_outputWS);
@@ -17,6 +17,8 @@
 
 #include <Poco/Thread.h>
 
+#include <algorithm>
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using Mantid::Types::Core::DateAndTime;
@@ -46,6 +48,10 @@ void MonitorLiveData::init() {
   declareProperty(std::make_unique<PropertyWithValue<double>>(
                       "UpdateEvery", 60.0, Direction::Input),
                   "Frequency of updates, in seconds. Default 60.");
+  declareProperty("AdaptiveUpdate", false,
+                  "Lengthen the time between updates to twice the time taken "
+                  "to process the last one, if that is longer than "
+                  "UpdateEvery, so that processing cannot fall behind.");
 
   this->initProps();
 }
@@ -114,6 +120,8 @@ void MonitorLiveData::exec() {
   double UpdateEvery = getProperty("UpdateEvery");
   if (UpdateEvery <= 0)
     throw std::runtime_error("UpdateEvery must be > 0");
+  const bool adaptiveUpdate = getProperty("AdaptiveUpdate");
+  double updateInterval = UpdateEvery;
 
   // Get the listener (and start listening) as early as possible
   ILiveListener_sptr listener = this->getLiveListener();
@@ -157,7 +165,7 @@ void MonitorLiveData::exec() {
 
     DateAndTime now = DateAndTime::getCurrentTime();
     double seconds = DateAndTime::secondsFromDuration(now - lastTime);
-    if (seconds > UpdateEvery) {
+    if (seconds > updateInterval) {
       lastTime = now;
       g_log.notice() << "Loading live data chunk " << m_chunkNumber << " at "
                      << now.toFormattedString("%H:%M:%S") << '\n';
@@ -246,15 +254,23 @@ void MonitorLiveData::exec() {
 
       m_chunkNumber++;
       progress(0.0, "Live Data " + Strings::toString(m_chunkNumber));
-    }
 
-    // This is the time to process a single chunk. Is it too long?
-    seconds = DateAndTime::secondsFromDuration(now - lastTime);
-    if (seconds > UpdateEvery)
-      g_log.warning() << "Cannot process live data as quickly as requested: "
-                         "requested every "
-                      << UpdateEvery << " seconds but it takes " << seconds
-                      << " seconds!\n";
+      // This is the time to process a single chunk. Is it too long?
+      seconds =
+          DateAndTime::secondsFromDuration(DateAndTime::getCurrentTime() - now);
+      if (adaptiveUpdate) {
+        const double nextInterval = std::max(UpdateEvery, 2. * seconds);
+        if (nextInterval != updateInterval)
+          g_log.notice() << "Updating every " << nextInterval
+                         << " seconds as the last update took " << seconds
+                         << " seconds to process.\n";
+        updateInterval = nextInterval;
+      } else if (seconds > UpdateEvery)
+        g_log.warning() << "Cannot process live data as quickly as requested: "
+                           "requested every "
+                        << UpdateEvery << " seconds but it takes " << seconds
+                        << " seconds!\n";
+    }
   } // loop until aborted
 
   // Set the outputs (only applicable when RunTransitionBehavior is "Stop")
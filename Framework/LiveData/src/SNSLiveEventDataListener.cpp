@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include <ctime>
 #include <exception>
+#include <limits>
 #include <sstream> // for ostringstream
 #include <string>
 
@@ -397,8 +398,43 @@ bool SNSLiveEventDataListener::rxPacket(const ADARA::BankedEventPkt &pkt) {
     return false;
   }
 
-  // Append the events
+  // Look up the workspace indices of the events before locking the mutex,
+  // so that extractData() is only held up while the events are appended
   g_log.debug() << "----- Pulse ID: " << pkt.pulseId() << " -----\n";
+  m_packetEvents.clear();
+
+  // Iterate through each event
+  const ADARA::Event *event = pkt.firstEvent();
+  unsigned lastBankID = pkt.curBankId();
+  // A counter that we use for logging purposes
+  unsigned eventsPerBank = 0;
+  while (event != nullptr) {
+    eventsPerBank++;
+    totalEvents++;
+    if (lastBankID < 0xFFFFFFFE) // Bank ID -1 & -2 are special cases and are
+                                 // not valid pixels
+    {
+      // bufferEvent needs tof to be in units of microseconds, but it comes
+      // from the ADARA stream in units of 100ns.
+      if (pkt.getSourceCORFlag()) {
+        bufferEvent(event->pixel, event->tof / 10.0);
+      } else {
+        bufferEvent(event->pixel,
+                    (event->tof + pkt.getSourceTOFOffset()) / 10.0);
+      }
+    }
+
+    event = pkt.nextEvent();
+    if (pkt.curBankId() != lastBankID) {
+      g_log.debug() << "BankID " << lastBankID << " had " << eventsPerBank
+                    << " events\n";
+
+      lastBankID = pkt.curBankId();
+      eventsPerBank = 0;
+    }
+  }
+
+  // Append the events
   // Scope braces
   {
     std::lock_guard<std::mutex> scopedLock(m_mutex);
@@ -412,36 +448,12 @@ bool SNSLiveEventDataListener::rxPacket(const ADARA::BankedEventPkt &pkt) {
         .getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)
         ->addValue(eventTime, pkt.pulseCharge() * 10);
 
-    // Iterate through each event
-    const ADARA::Event *event = pkt.firstEvent();
-    unsigned lastBankID = pkt.curBankId();
-    // A counter that we use for logging purposes
-    unsigned eventsPerBank = 0;
-    while (event != nullptr) {
-      eventsPerBank++;
-      totalEvents++;
-      if (lastBankID < 0xFFFFFFFE) // Bank ID -1 & -2 are special cases and are
-                                   // not valid pixels
-      {
-        // appendEvent needs tof to be in units of microseconds, but it comes
-        // from the ADARA stream in units of 100ns.
-        if (pkt.getSourceCORFlag()) {
-          appendEvent(event->pixel, event->tof / 10.0, eventTime);
-        } else {
-          appendEvent(event->pixel,
-                      (event->tof + pkt.getSourceTOFOffset()) / 10.0,
-                      eventTime);
-        }
-      }
-
-      event = pkt.nextEvent();
-      if (pkt.curBankId() != lastBankID) {
-        g_log.debug() << "BankID " << lastBankID << " had " << eventsPerBank
-                      << " events\n";
-
-        lastBankID = pkt.curBankId();
-        eventsPerBank = 0;
-      }
+    // The workspace indices are known to be valid, so the spectra are
+    // accessed without the range checks of getSpectrum()
+    m_eventBuffer->invalidateCommonBinsFlag();
+    for (const auto &packetEvent : m_packetEvents) {
+      m_eventBuffer->getSpectrumUnsafe(packetEvent.workspaceIndex)
+          ->addEventQuickly(Types::Event::TofEvent(packetEvent.tof, eventTime));
     }
   } // mutex automatically unlocks here
 
@@ -1344,8 +1356,8 @@ void SNSLiveEventDataListener::initWorkspacePart2() {
   m_eventBuffer->getAxis(0)->unit() = UnitFactory::Instance().create("TOF");
   m_eventBuffer->setYUnit("Counts");
 
-  m_indexMap = m_eventBuffer->getDetectorIDToWorkspaceIndexMap(
-      true /* bool throwIfMultipleDets */);
+  m_indexMap = m_eventBuffer->getDetectorIDToWorkspaceIndexVector(
+      m_indexMapOffset, true /* bool throwIfMultipleDets */);
 
   // We always want to have at least one value for the the scan index time
   // series.  We may have already gotten a scan start packet by the time we
@@ -1404,20 +1416,17 @@ bool SNSLiveEventDataListener::haveRequiredLogs() {
   return allFound;
 }
 
-/// Adds an event to the workspace
-void SNSLiveEventDataListener::appendEvent(
-    const uint32_t pixelId, const double tof,
-    const Mantid::Types::Core::DateAndTime pulseTime)
-// NOTE: This function does NOT lock the mutex!  Make sure you do that
-// before calling this function!
-{
-  // It'd be nice to use operator[], but we might end up inserting a value....
-  // Have to use find() instead.
-  const auto it = m_indexMap.find(pixelId);
-  if (it != m_indexMap.end()) {
-    const std::size_t workspaceIndex = it->second;
-    Types::Event::TofEvent event(tof, pulseTime);
-    m_eventBuffer->getSpectrum(workspaceIndex).addEventQuickly(event);
+/// Looks up the workspace index of an event and holds the event until the
+/// events of the packet are appended to the workspace
+void SNSLiveEventDataListener::bufferEvent(const uint32_t pixelId,
+                                           const double tof) {
+  const auto index = static_cast<int64_t>(pixelId) + m_indexMapOffset;
+  const size_t workspaceIndex =
+      (index >= 0 && index < static_cast<int64_t>(m_indexMap.size()))
+          ? m_indexMap[static_cast<size_t>(index)]
+          : std::numeric_limits<size_t>::max();
+  if (workspaceIndex != std::numeric_limits<size_t>::max()) {
+    m_packetEvents.push_back({workspaceIndex, tof});
   } else {
     g_log.warning() << "Invalid pixel ID: " << pixelId << " (TofF: " << tof
                     << " microseconds)\n";
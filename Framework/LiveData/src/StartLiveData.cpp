@@ -68,6 +68,10 @@ void StartLiveData::init() {
       "Frequency of updates, in seconds. Default 60.\n"
       "If you specify 0, MonitorLiveData will not launch and you will get only "
       "one chunk.");
+  declareProperty("AdaptiveUpdate", false,
+                  "Lengthen the time between updates to twice the time taken "
+                  "to process the last one, if that is longer than "
+                  "UpdateEvery, so that processing cannot fall behind.");
 
   // Initialize the properties common to LiveDataAlgorithm.
   initProps();
@@ -19,9 +19,13 @@
 #include "MantidLiveData/Kafka/KafkaEventStreamDecoder.h"
 
 #include <Poco/Path.h>
+#include <algorithm>
 #include <condition_variable>
 #include <thread>
 
+using Mantid::LiveData::KafkaEventStreamDecoder;
+using BufferedEvent = KafkaEventStreamDecoder::BufferedEvent;
+
 class KafkaEventStreamDecoderTest : public CxxTest::TestSuite {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -99,6 +103,88 @@ public:
     TS_ASSERT_EQUALS(11.0, eventWksp->getTofMax());
   }
 
+  void test_Single_Period_Event_Stream_Through_Intermediate_Buffer() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::API::Workspace_sptr;
+    using Mantid::DataObjects::EventWorkspace;
+
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(3))
+        .WillOnce(Return(new FakeISISEventSubscriber(1)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)))
+        .WillOnce(Return(new FakeISISSpDetStreamSubscriber));
+    // Buffer the events of up to 100 messages before they are flushed
+    auto decoder = createTestDecoder(mockBroker, 100);
+    startCapturing(*decoder, 1);
+    TS_ASSERT_THROWS_NOTHING(decoder->stopCapture());
+
+    // Stopping the capture flushes the buffer
+    Workspace_sptr workspace;
+    TS_ASSERT_THROWS_NOTHING(workspace = decoder->extractData());
+    auto eventWksp = boost::dynamic_pointer_cast<EventWorkspace>(workspace);
+    TS_ASSERT(eventWksp);
+    checkWorkspaceMetadata(*eventWksp);
+    checkWorkspaceEventData(*eventWksp);
+  }
+
+  void test_Full_Buffers_Block_The_Stream_Until_Extracted() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::API::Workspace_sptr;
+    using Mantid::DataObjects::EventWorkspace;
+    using Mantid::LiveData::KafkaEventStreamDecoder;
+
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(3))
+        .WillOnce(Return(new FakeISISEventSubscriber(1)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)))
+        .WillOnce(Return(new FakeISISSpDetStreamSubscriber));
+    auto decoder = createTestDecoder(mockBroker);
+    // Room for the events of a single message
+    decoder->setBufferLimit(
+        6, KafkaEventStreamDecoder::BufferOverflowPolicy::Block);
+    startCapturing(*decoder, 5);
+    TS_ASSERT_THROWS_NOTHING(decoder->stopCapture());
+
+    Workspace_sptr workspace;
+    TS_ASSERT_THROWS_NOTHING(workspace = decoder->extractData());
+    auto eventWksp = boost::dynamic_pointer_cast<EventWorkspace>(workspace);
+    TS_ASSERT(eventWksp);
+    TS_ASSERT_EQUALS(eventWksp->getNumberEvents(), 6);
+  }
+
+  void test_Full_Buffers_Drop_Oldest_Events() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::API::Workspace_sptr;
+    using Mantid::DataObjects::EventWorkspace;
+    using Mantid::LiveData::KafkaEventStreamDecoder;
+
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(3))
+        .WillOnce(Return(new FakeISISEventSubscriber(1)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)))
+        .WillOnce(Return(new FakeISISSpDetStreamSubscriber));
+    auto decoder = createTestDecoder(mockBroker);
+    // Room for the events of two messages
+    decoder->setBufferLimit(
+        12, KafkaEventStreamDecoder::BufferOverflowPolicy::DropOldest);
+    startCapturing(*decoder, 5);
+    TS_ASSERT_THROWS_NOTHING(decoder->stopCapture());
+
+    Workspace_sptr workspace;
+    TS_ASSERT_THROWS_NOTHING(workspace = decoder->extractData());
+    auto eventWksp = boost::dynamic_pointer_cast<EventWorkspace>(workspace);
+    TS_ASSERT(eventWksp);
+    checkWorkspaceMetadata(*eventWksp);
+    checkWorkspaceEventData(*eventWksp);
+    TS_ASSERT_LESS_THAN_EQUALS(eventWksp->getNumberEvents(), 12);
+  }
+
   void test_Multiple_Period_Event_Stream() {
     using namespace ::testing;
     using namespace KafkaTesting;
@@ -365,109 +451,77 @@ public:
                       eventWksp->getNumberEvents());
   }
 
-  void test_Compute_Bounds_Multiple_Threads() {
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
-        events = {
-            {0, 0, 0}, {0, 0, 0}, {1, 0, 0}, {1, 0, 0}, {2, 0, 0}, {2, 0, 0},
-            {3, 0, 0}, {3, 0, 0}, {4, 0, 0}, {4, 0, 0}, {5, 0, 0}, {5, 0, 0},
-            {6, 0, 0}, {6, 0, 0}, {7, 0, 0}, {7, 0, 0},
-        };
-
-    const auto groupBounds = computeGroupBoundaries(events, 8);
-    TS_ASSERT_EQUALS(9, groupBounds.size());
-
-    TS_ASSERT_EQUALS(0, groupBounds[0]);
-    TS_ASSERT_EQUALS(2, groupBounds[1]);
-    TS_ASSERT_EQUALS(4, groupBounds[2]);
-    TS_ASSERT_EQUALS(6, groupBounds[3]);
-    TS_ASSERT_EQUALS(8, groupBounds[4]);
-    TS_ASSERT_EQUALS(10, groupBounds[5]);
-    TS_ASSERT_EQUALS(12, groupBounds[6]);
-    TS_ASSERT_EQUALS(14, groupBounds[7]);
-    TS_ASSERT_EQUALS(events.size(), groupBounds[8]);
+  void test_Group_Events_Multiple_Threads() {
+    const std::vector<BufferedEvent> events = {
+        {0, 0, 0}, {7, 1, 0}, {1, 2, 0}, {6, 3, 0}, {2, 4, 0}, {5, 5, 0},
+        {3, 6, 0}, {4, 7, 0}, {4, 8, 1}, {3, 9, 1}, {5, 10, 1}, {2, 11, 1},
+        {6, 12, 1}, {1, 13, 1}, {7, 14, 1}, {0, 15, 1},
+    };
+
+    std::vector<std::vector<BufferedEvent>> groups(8);
+    groupEventsByWorkspaceIndex(events, 8, groups);
+
+    for (size_t group = 0; group < groups.size(); ++group) {
+      TS_ASSERT_EQUALS(2, groups[group].size());
+      for (const auto &event : groups[group]) {
+        TS_ASSERT_EQUALS(group, event.wsIdx);
+      }
+      // in the order they were received
+      TS_ASSERT_LESS_THAN(groups[group][0].tof, groups[group][1].tof);
+    }
+  }
+
+  void test_Group_Events_Multiple_Threads_Low_Events() {
+    const std::vector<BufferedEvent> events = {
+        {0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}, {3, 0, 0}, {4, 0, 0},
+    };
+
+    std::vector<std::vector<BufferedEvent>> groups(8);
+    groupEventsByWorkspaceIndex(events, 5, groups);
+
+    checkGroups(events, groups);
   }
 
-  void test_Compute_Bounds_Multiple_Threads_Low_Events() {
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
-        events = {
-            {0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}, {3, 0, 0}, {4, 0, 0},
-        };
-
-    const auto groupBounds = computeGroupBoundaries(events, 8);
-    TS_ASSERT_EQUALS(9, groupBounds.size());
-
-    const auto upper = events.size();
-
-    TS_ASSERT_EQUALS(0, groupBounds[0]);
-    TS_ASSERT_EQUALS(1, groupBounds[1]);
-    TS_ASSERT_EQUALS(2, groupBounds[2]);
-    TS_ASSERT_EQUALS(3, groupBounds[3]);
-    TS_ASSERT_EQUALS(5, groupBounds[4]);
-    TS_ASSERT_EQUALS(upper, groupBounds[5]);
-    TS_ASSERT_EQUALS(upper, groupBounds[6]);
-    TS_ASSERT_EQUALS(upper, groupBounds[7]);
-    TS_ASSERT_EQUALS(upper, groupBounds[8]);
+  void test_Group_Events_Multiple_Threads_Very_Inbalanced() {
+    std::vector<BufferedEvent> events(14, {0, 0, 0});
+    events.push_back({1, 0, 0});
+    events.push_back({2, 0, 0});
+    events.push_back({3, 0, 0});
+    events.push_back({3, 0, 0});
+    events.push_back({4, 0, 0});
+
+    std::vector<std::vector<BufferedEvent>> groups(8);
+    groupEventsByWorkspaceIndex(events, 5, groups);
+
+    checkGroups(events, groups);
+    // The busy spectrum gets a group to itself
+    TS_ASSERT_EQUALS(14, groups[0].size());
   }
 
-  void test_Compute_Bounds_Multiple_Threads_Very_Inbalanced() {
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
-        events = {/* 0 */
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-
-                  /* 14 */
-                  {1, 0, 0},
-
-                  /* 15 */
-                  {2, 0, 0},
-
-                  /* 16 */
-                  {3, 0, 0},
-                  {3, 0, 0},
-
-                  /* 18 */
-                  {4, 0, 0}};
-
-    const auto groupBounds = computeGroupBoundaries(events, 8);
-    TS_ASSERT_EQUALS(9, groupBounds.size());
-
-    const auto upper = events.size();
-
-    /* Generated groups contain: 0  1,2  3  4 */
-    TS_ASSERT_EQUALS(0, groupBounds[0]);
-    TS_ASSERT_EQUALS(14, groupBounds[1]);
-    TS_ASSERT_EQUALS(16, groupBounds[2]);
-    TS_ASSERT_EQUALS(18, groupBounds[3]);
-    TS_ASSERT_EQUALS(upper, groupBounds[4]);
-    TS_ASSERT_EQUALS(upper, groupBounds[5]);
-    TS_ASSERT_EQUALS(upper, groupBounds[6]);
-    TS_ASSERT_EQUALS(upper, groupBounds[7]);
-    TS_ASSERT_EQUALS(upper, groupBounds[8]);
+  void test_Group_Events_Balances_Many_Spectra() {
+    std::vector<BufferedEvent> events;
+    for (size_t i = 0; i < 10000; ++i) {
+      events.push_back({(i * 7919) % 1000, i, 0});
+    }
+
+    std::vector<std::vector<BufferedEvent>> groups(4);
+    groupEventsByWorkspaceIndex(events, 1000, groups);
+
+    checkGroups(events, groups);
+    for (const auto &group : groups) {
+      TS_ASSERT_DELTA(2500, group.size(), 200);
+    }
   }
 
-  void test_Compute_Bounds_Single_Thread() {
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
-        events = {
-            {0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}, {3, 0, 0}, {4, 0, 0},
-        };
+  void test_Group_Events_Single_Thread() {
+    const std::vector<BufferedEvent> events = {
+        {0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}, {3, 0, 0}, {4, 0, 0},
+    };
 
-    const auto groupBounds = computeGroupBoundaries(events, 1);
-    TS_ASSERT_EQUALS(2, groupBounds.size());
+    std::vector<std::vector<BufferedEvent>> groups(1);
+    groupEventsByWorkspaceIndex(events, 5, groups);
 
-    TS_ASSERT_EQUALS(0, groupBounds[0]);
-    TS_ASSERT_EQUALS(events.size(), groupBounds[1]);
+    TS_ASSERT_EQUALS(events.size(), groups[0].size());
   }
 
   //----------------------------------------------------------------------------
@@ -509,6 +563,28 @@ public:
   }
 
 private:
+  // Every event must be in a group, and the groups must hold separate ranges
+  // of workspace indices in increasing order
+  void checkGroups(const std::vector<BufferedEvent> &events,
+                   const std::vector<std::vector<BufferedEvent>> &groups) {
+    size_t total(0), previousMax(0);
+    bool first(true);
+    for (const auto &group : groups) {
+      if (group.empty())
+        continue;
+      total += group.size();
+      const auto range = std::minmax_element(
+          group.begin(), group.end(),
+          [](const BufferedEvent &lhs, const BufferedEvent &rhs) {
+            return lhs.wsIdx < rhs.wsIdx;
+          });
+      TS_ASSERT(first || range.first->wsIdx > previousMax);
+      previousMax = range.second->wsIdx;
+      first = false;
+    }
+    TS_ASSERT_EQUALS(events.size(), total);
+  }
+
   // Start decoding and wait until we have gathered enough data to test
   void startCapturing(Mantid::LiveData::KafkaEventStreamDecoder &decoder,
                       uint8_t maxIterations) {
@@ -549,10 +625,11 @@ private:
   }
 
   std::unique_ptr<Mantid::LiveData::KafkaEventStreamDecoder>
-  createTestDecoder(std::shared_ptr<Mantid::LiveData::IKafkaBroker> broker) {
+  createTestDecoder(std::shared_ptr<Mantid::LiveData::IKafkaBroker> broker,
+                    const size_t bufferThreshold = 0) {
     using namespace Mantid::LiveData;
     return std::make_unique<KafkaEventStreamDecoder>(broker, "", "", "", "", "",
-                                                     0);
+                                                     bufferThreshold);
   }
 
   void
@@ -94,6 +94,39 @@ public:
     TS_ASSERT(Mock::VerifyAndClear(mockBroker.get()));
   }
 
+  void test_Extractions_Share_Their_Data() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::DataObjects::Workspace2D;
+
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(3))
+        .WillOnce(Return(new FakeHistoSubscriber()))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)))
+        .WillOnce(Return(new FakeISISSpDetStreamSubscriber));
+    auto decoder = createTestDecoder(mockBroker);
+    startCapturing(*decoder, 1);
+
+    auto first =
+        boost::dynamic_pointer_cast<Workspace2D>(decoder->extractData());
+    auto second =
+        boost::dynamic_pointer_cast<Workspace2D>(decoder->extractData());
+    TS_ASSERT_THROWS_NOTHING(decoder->stopCapture());
+    TS_ASSERT(first);
+    TS_ASSERT(second);
+    TSM_ASSERT("Each extraction should be a separate workspace",
+               first != second);
+    // The bin edges are unchanged so they are shared, while the counts of
+    // the first extraction are replaced rather than overwritten
+    TS_ASSERT_EQUALS(&first->x(0), &second->x(0));
+    TS_ASSERT_DIFFERS(&first->y(0), &second->y(0));
+    checkWorkspaceMetadata(*first);
+    checkWorkspaceHistoData(*first);
+    checkWorkspaceHistoData(*second);
+    TS_ASSERT(Mock::VerifyAndClear(mockBroker.get()));
+  }
+
 private:
   std::unique_ptr<Mantid::LiveData::KafkaHistoStreamDecoder>
   createTestDecoder(std::shared_ptr<Mantid::LiveData::IKafkaBroker> broker) {
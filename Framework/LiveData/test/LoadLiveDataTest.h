@@ -19,6 +19,7 @@
 #include "MantidTestHelpers/FacilityHelper.h"
 #include "TestGroupDataListener.h"
 #include <cxxtest/TestSuite.h>
+#include <algorithm>
 #include <numeric>
 
 using namespace Mantid;
@@ -59,7 +60,7 @@ public:
          std::string PostProcessingAlgorithm = "",
          std::string PostProcessingProperties = "", bool PreserveEvents = true,
          ILiveListener_sptr listener = ILiveListener_sptr(),
-         bool makeThrow = false) {
+         bool makeThrow = false, bool PostProcessChunks = false) {
     FacilityHelper::ScopedFacilities loadTESTFacility(
         "unit_testing/UnitTestFacilities.xml", "TEST");
 
@@ -79,6 +80,8 @@ public:
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("PostProcessingProperties",
                                                   PostProcessingProperties));
     TS_ASSERT_THROWS_NOTHING(alg.setProperty("PreserveEvents", PreserveEvents));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setProperty("PostProcessChunks", PostProcessChunks));
     if (!PostProcessingAlgorithm.empty())
       TS_ASSERT_THROWS_NOTHING(
           alg.setPropertyValue("AccumulationWorkspace", "fake_accum"));
@@ -305,6 +308,39 @@ public:
     TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
   }
 
+  //--------------------------------------------------------------------------------------------
+  /** Post-process only the new chunks and add them to the output */
+  void test_Add_and_PostProcessChunks() {
+    EventWorkspace_sptr ws1 = doExec<EventWorkspace>(
+        "Add", "", "", "Rebin", "Params=40e3, 1e3, 60e3", true,
+        ILiveListener_sptr(), false, true);
+    TS_ASSERT_EQUALS(ws1->getNumberEvents(), 200);
+    TS_ASSERT_EQUALS(ws1->blocksize(), 20);
+
+    EventWorkspace_sptr ws2 = doExec<EventWorkspace>(
+        "Add", "", "", "Rebin", "Params=40e3, 1e3, 60e3", true,
+        ILiveListener_sptr(), false, true);
+    TSM_ASSERT("The chunk was added to the output workspace", ws1 == ws2);
+    EventWorkspace_sptr ws_accum =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            "fake_accum");
+    TS_ASSERT_EQUALS(ws_accum->getNumberEvents(), 400);
+    TS_ASSERT_EQUALS(ws_accum->blocksize(), 1);
+
+    // The same as post-processing the accumulation workspace
+    TS_ASSERT_EQUALS(ws2->getNumberEvents(), 400);
+    TS_ASSERT_EQUALS(ws2->blocksize(), 20);
+    TS_ASSERT_DELTA(ws2->x(0)[0], 40e3, 1e-4);
+    const auto tofs = ws_accum->getSpectrum(0).getTofs();
+    const auto inRange = std::count_if(tofs.begin(), tofs.end(), [](double t) {
+      return t >= 40e3 && t <= 60e3;
+    });
+    const auto &y = ws2->y(0);
+    TS_ASSERT_DELTA(std::accumulate(y.begin(), y.end(), 0.),
+                    static_cast<double>(inRange), 1e-10);
+    TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
+  }
+
   //--------------------------------------------------------------------------------------------
   /** Do some processing that converts to a different type of workspace */
   void test_ProcessToMDWorkspace_and_Add() {
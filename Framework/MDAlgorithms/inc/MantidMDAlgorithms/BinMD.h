@@ -20,6 +20,8 @@
 #include "MantidKernel/VMD.h"
 #include "MantidMDAlgorithms/SlicingAlgorithm.h"
 
+#include <vector>
+
 namespace Mantid {
 namespace Geometry {
 // Forward declaration
@@ -72,6 +74,13 @@ private:
   template <typename MDE, size_t nd>
   void binByIterating(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  /// Is a box entirely within a single bin of the chunk
+  bool isInSingleBin(const API::IMDNode &box, const size_t *const chunkMin,
+                     const size_t *const chunkMax, size_t &linearIndex) const;
+
+  /// Add the cached signal of a box to a bin
+  void addBoxToBin(const API::IMDNode &box, const size_t linearIndex);
+
   /// Method to bin a single MDBox
   template <typename MDE, size_t nd>
   void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin,
@@ -90,6 +99,9 @@ private:
   signal_t *errors;
   signal_t *numEvents;
   bool m_accumulate{false};
+  /// Rows of the matrix of the transform, without its last row. Empty if the
+  /// transform is not a CoordTransformAffine.
+  std::vector<coord_t> m_affineMatrix;
 };
 
 } // namespace MDAlgorithms
@@ -11,6 +11,7 @@
 #include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidKernel/Matrix.h"
 #include "MantidKernel/System.h"
+#include "MantidKernel/V3D.h"
 namespace Mantid {
 namespace MDAlgorithms {
 
@@ -46,12 +47,13 @@ private:
   size_t m_hIdx, m_kIdx, m_lIdx, m_eIdx;
   /// (2*PiRUBW)^-1
   Mantid::Kernel::DblMatrix m_rubw;
+  /// m_rubw applied to the incident beam momentum
+  Mantid::Kernel::V3D m_qin;
 
   /// Normalization workspace (this is the coverage workspace)
   Mantid::DataObjects::MDHistoWorkspace_sptr m_normWS;
 
-  std::vector<Kernel::VMD> calculateIntersections(const double theta,
-                                                  const double phi);
+  std::vector<Kernel::VMD> calculateIntersections(const Kernel::V3D &qout);
   void cacheDimensionXValues();
 };
 
@@ -0,0 +1,59 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_MDALGORITHMS_EVALUATEMDHISTOEXPRESSION_H_
+#define MANTID_MDALGORITHMS_EVALUATEMDHISTOEXPRESSION_H_
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidKernel/System.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+/** EvaluateMDHistoExpression : evaluate an arithmetic expression of
+  MDHistoWorkspaces, such as (data - background) / norm * 2, in a single pass
+  over their bins. The errors and numbers of events are propagated as by
+  PlusMD, MinusMD, MultiplyMD and DivideMD.
+ */
+class DLLExport EvaluateMDHistoExpression : public API::Algorithm {
+public:
+  const std::string name() const override {
+    return "EvaluateMDHistoExpression";
+  }
+  int version() const override { return 1; }
+  const std::vector<std::string> seeAlso() const override {
+    return {"PlusMD", "MinusMD", "MultiplyMD", "DivideMD"};
+  }
+  const std::string category() const override {
+    return "MDAlgorithms\\MDArithmetic";
+  }
+  const std::string summary() const override {
+    return "Evaluate an arithmetic expression of MDHistoWorkspaces in a "
+           "single pass over their bins.";
+  }
+
+  using Operation = API::WorkspaceExpression::Operation;
+  using Instruction = API::WorkspaceExpression::Instruction;
+
+  static std::vector<Instruction>
+  compile(const std::string &expression,
+          const std::vector<std::string> &workspaceNames);
+
+private:
+  void init() override;
+  std::map<std::string, std::string> validateInputs() override;
+  void exec() override;
+};
+
+} // namespace MDAlgorithms
+} // namespace Mantid
+
+#endif /* MANTID_MDALGORITHMS_EVALUATEMDHISTOEXPRESSION_H_ */
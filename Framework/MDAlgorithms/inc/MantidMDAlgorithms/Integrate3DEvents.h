@@ -14,6 +14,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <array>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
@@ -36,6 +37,33 @@ struct IntegrationParameters {
   bool specifySize;
 };
 
+/// Sums over the events near a peak, centered at (0,0,0), from which the
+/// covariance matrix and the standard deviations of the events are found
+/// without keeping the events
+struct EventMoments {
+  /// The number of events near the peak
+  size_t numEvents = 0;
+  /// Sums of q_i * q_j over the events used for the covariance matrix
+  std::array<double, 9> covarianceSums{};
+  /// The number of events used for the standard deviations
+  size_t stdDevEvents = 0;
+  /// Sums of q_i over the events used for the standard deviations
+  std::array<double, 3> stdDevSums{};
+  /// Sums of q_i * q_j over the events used for the standard deviations
+  std::array<double, 9> stdDevSquareSums{};
+};
+
+/// The weights of the events counted in the ellipsoids of a peak
+struct EllipsoidCounts {
+  /// The weight in the peak ellipsoid
+  double peak = 0;
+  /// The weight in the background shell
+  double background = 0;
+  /// The weights in the background shell, kept for the one percent
+  /// background correction
+  std::vector<double> backgroundWeights;
+};
+
 /**
  @class Integrate3DEvents
 
@@ -55,6 +83,7 @@ using EventListMap =
     std::unordered_map<int64_t,
                        std::vector<std::pair<double, Mantid::Kernel::V3D>>>;
 using PeakQMap = std::unordered_map<int64_t, Mantid::Kernel::V3D>;
+using EventMomentsMap = std::unordered_map<int64_t, EventMoments>;
 
 class DLLExport Integrate3DEvents {
 public:
@@ -77,6 +106,39 @@ public:
   addEvents(std::vector<std::pair<double, Mantid::Kernel::V3D>> const &event_qs,
             bool hkl_integ);
 
+  /// Add the moments of event Q's near peaks to sums, without keeping them
+  void addEventMoments(
+      std::vector<std::pair<double, Mantid::Kernel::V3D>> const &event_qs,
+      bool hkl_integ, EventMomentsMap &moments) const;
+
+  /// Add sums of the moments of events near peaks
+  void mergeEventMoments(const EventMomentsMap &moments);
+
+  /// Set up the ellipsoids of a modulated peak from the moments of its events
+  size_t addModEllipsoids(std::vector<Kernel::V3D> E1Vec,
+                          Mantid::Kernel::V3D const &peak_q,
+                          Mantid::Kernel::V3D const &hkl,
+                          Mantid::Kernel::V3D const &mnp, bool specify_size,
+                          double peak_radius, double back_inner_radius,
+                          double back_outer_radius);
+
+  /// Forget the ellipsoids set up and the events counted in them
+  void clearEllipsoids();
+
+  /// Count event Q's in the ellipsoids that have been set up
+  void countEventsInEllipsoids(
+      std::vector<std::pair<double, Mantid::Kernel::V3D>> const &event_qs,
+      bool hkl_integ, std::vector<EllipsoidCounts> &counts) const;
+
+  /// Add counts of events in the ellipsoids that have been set up
+  void mergeEllipsoidCounts(const std::vector<EllipsoidCounts> &counts);
+
+  /// Find the net integrated intensity of a peak from the events counted in
+  /// its ellipsoids
+  boost::shared_ptr<const Mantid::Geometry::PeakShape>
+  integrateEllipsoids(size_t index, std::vector<double> &axes_radii,
+                      double &inti, double &sigi) const;
+
   /// Find the net integrated intensity of a peak, using ellipsoidal volumes
   boost::shared_ptr<const Mantid::Geometry::PeakShape> ellipseIntegrateEvents(
       std::vector<Kernel::V3D> E1Vec, Mantid::Kernel::V3D const &peak_q,
@@ -113,6 +175,21 @@ public:
                                     const Mantid::Kernel::V3D &center);
 
 private:
+  /// The ellipsoids of a peak, and how the background is scaled to them
+  struct Ellipsoids {
+    /// The shape of the peak, null if it could not be integrated
+    Mantid::DataObjects::PeakShapeEllipsoid_const_sptr shape;
+    std::vector<Mantid::Kernel::V3D> directions;
+    std::vector<double> axesRadii;
+    std::vector<double> backgroundInnerRadii;
+    std::vector<double> backgroundOuterRadii;
+    /// The ratio of the peak volume to the background volume
+    double ratio = 0;
+    /// Whether the events are to be counted, false if the peak is on the
+    /// edge of the detectors
+    bool integrate = false;
+  };
+
   /// Get a list of events for a given Q
   const std::vector<std::pair<double, Mantid::Kernel::V3D>> *
   getEvents(const Mantid::Kernel::V3D &peak_q);
@@ -137,11 +214,19 @@ private:
       std::vector<double> const &sizes, std::vector<double> const &sizesIn,
       const bool useOnePercentBackgroundCorrection);
 
+  /// Sum the background weights, without the top 1% if requested
+  static double sumBackground(std::vector<double> &weights,
+                              const bool useOnePercentBackgroundCorrection);
+
   /// Calculate the 3x3 covariance matrix of a list of Q-vectors at 0,0,0
   static void makeCovarianceMatrix(
       std::vector<std::pair<double, Mantid::Kernel::V3D>> const &events,
       Kernel::DblMatrix &matrix, double radius);
 
+  /// Calculate the 3x3 covariance matrix from the moments of Q-vectors
+  static void makeCovarianceMatrix(EventMoments const &moments,
+                                   Kernel::DblMatrix &matrix);
+
   /// Calculate the eigen vectors of a 3x3 real symmetric matrix
   static void getEigenVectors(Kernel::DblMatrix const &cov_matrix,
                               std::vector<Mantid::Kernel::V3D> &eigen_vectors);
@@ -151,21 +236,23 @@ private:
   stdDev(std::vector<std::pair<double, Mantid::Kernel::V3D>> const &events,
          Mantid::Kernel::V3D const &direction, double radius);
 
+  /// Calculate the standard deviation in a direction from moments of events
+  static double stdDev(EventMoments const &moments,
+                       Mantid::Kernel::V3D const &direction);
+
   /// Form a map key as 10^12*h + 10^6*k + l from the integers h, k, l
   static int64_t getHklKey(int h, int k, int l);
 
   static int64_t getHklMnpKey(int h, int k, int l, int m, int n, int p);
 
   /// Form a map key for the specified q_vector.
-  int64_t getHklKey(Mantid::Kernel::V3D const &q_vector);
-  int64_t getHklMnpKey(Mantid::Kernel::V3D const &q_vector);
-  int64_t getHklKey2(Mantid::Kernel::V3D const &hkl);
-  int64_t getHklMnpKey2(Mantid::Kernel::V3D const &hkl);
+  int64_t getHklKey(Mantid::Kernel::V3D const &q_vector) const;
+  int64_t getHklMnpKey(Mantid::Kernel::V3D const &q_vector) const;
+  int64_t getHklKey2(Mantid::Kernel::V3D const &hkl) const;
+  int64_t getHklMnpKey2(Mantid::Kernel::V3D const &hkl) const;
 
-  /// Add an event to the vector of events for the closest h,k,l
-  void addEvent(std::pair<double, Mantid::Kernel::V3D> event_Q, bool hkl_integ);
-  void addModEvent(std::pair<double, Mantid::Kernel::V3D> event_Q,
-                   bool hkl_integ);
+  /// Find the peak near an event and center the event on it
+  int64_t shiftToPeak(Mantid::Kernel::V3D &event_q, bool hkl_integ) const;
 
   /// Find the net integrated intensity of a list of Q's using ellipsoids
   boost::shared_ptr<const Mantid::DataObjects::PeakShapeEllipsoid>
@@ -177,8 +264,16 @@ private:
       double back_inner_radius, double back_outer_radius,
       std::vector<double> &axes_radii, double &inti, double &sigi);
 
+  /// Find the ellipsoids of a peak from the standard deviations of its events
+  Ellipsoids makeEllipsoids(std::vector<Kernel::V3D> const &E1Vec,
+                            Kernel::V3D const &peak_q,
+                            std::vector<Mantid::Kernel::V3D> const &directions,
+                            std::vector<double> const &sigmas,
+                            bool specify_size, double peak_radius,
+                            double back_inner_radius, double back_outer_radius);
+
   /// Compute if a particular Q falls on the edge of a detector
-  double detectorQ(std::vector<Kernel::V3D> E1Vec,
+  double detectorQ(const std::vector<Kernel::V3D> &E1Vec,
                    const Mantid::Kernel::V3D QLabFrame,
                    const std::vector<double> &r);
 
@@ -198,6 +293,15 @@ private:
   const bool crossterm;
   const bool m_useOnePercentBackgroundCorrection =
       true; // if one perecent culling of the background should be performed.
+
+  /// The moments of the events near each peak, when they are not kept
+  EventMomentsMap m_event_moments;
+  /// The ellipsoids set up to count events in
+  std::vector<Ellipsoids> m_ellipsoids;
+  /// The events counted in each of the ellipsoids
+  std::vector<EllipsoidCounts> m_ellipsoid_counts;
+  /// The indices of the ellipsoids for each peak key
+  std::unordered_multimap<int64_t, size_t> m_ellipsoid_keys;
 };
 
 } // namespace MDAlgorithms
@@ -17,6 +17,8 @@
 #include "MantidMDAlgorithms/MDWSDescription.h"
 #include "MantidMDAlgorithms/UnitsConversionHelper.h"
 
+#include <functional>
+
 namespace Mantid {
 namespace Geometry {
 class DetectorInfo;
@@ -49,6 +51,15 @@ private:
   void qListFromHistoWS(Integrate3DEvents &integrator, API::Progress &prog,
                         DataObjects::Workspace2D_sptr &wksp,
                         Kernel::DblMatrix const &UBinv, bool hkl_integ);
+  void streamEventQs(
+      API::Progress &prog, DataObjects::EventWorkspace &wksp,
+      Kernel::DblMatrix const &UBinv, bool hkl_integ,
+      const std::function<void(
+          const std::vector<std::pair<double, Kernel::V3D>> &, int)> &add);
+  void countEventsInEllipsoids(Integrate3DEvents &integrator,
+                               API::Progress &prog,
+                               DataObjects::EventWorkspace &wksp,
+                               Kernel::DblMatrix const &UBinv, bool hkl_integ);
 
   /// Calculate if this Q is on a detector
   void calculateE1(const Geometry::DetectorInfo &detectorInfo);
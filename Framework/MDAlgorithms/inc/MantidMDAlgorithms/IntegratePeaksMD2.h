@@ -14,6 +14,7 @@
 #include "MantidDataObjects/PeaksWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidKernel/System.h"
+#include "MantidKernel/V3DArrays.h"
 
 namespace Mantid {
 namespace Geometry {
@@ -66,7 +67,7 @@ private:
                         std::string property, std::string values);
 
   /// save for all detector pixels
-  std::vector<Kernel::V3D> E1Vec;
+  Kernel::V3DArrays E1Vec;
 
   /// Check if peaks overlap
   void checkOverlap(int i, Mantid::DataObjects::PeaksWorkspace_sptr peakWS,
@@ -68,8 +68,8 @@ private:
   void readPixelDataIntoWorkspace();
   void splitAllBoxes();
   void warnIfMemoryInsufficient(int64_t npixtot);
-  size_t addEventFromBuffer(const float *pixel);
-  void toOutputFrame(coord_t *centers);
+  size_t addEventFromBuffer(const float *pixel) const;
+  void toOutputFrame(coord_t *centers) const;
   void finalize();
 
   std::unique_ptr<std::ifstream> m_file;
@@ -55,7 +55,7 @@ public:
    * factory) and stores internal pointer to this workspace for further usage */
   API::IMDEventWorkspace_sptr createEmptyMDWS(const MDWSDescription &WSD);
   /// add the data to the internal workspace. The workspace has to exist and be
-  /// initiated
+  /// initiated. Not thread safe: the boxes are not locked.
   void addMDData(std::vector<float> &sigErr, std::vector<uint16_t> &runIndex,
                  std::vector<uint32_t> &detId, std::vector<coord_t> &Coord,
                  size_t dataSize) const;
@@ -47,13 +47,14 @@ private:
   getValuesFromOtherDimensions(bool &skipNormalization,
                                uint16_t expInfoIndex = 0) const;
   void cacheDimensionXValues();
-  void calculateNormalization(const std::vector<coord_t> &otherValues,
-                              Geometry::SymmetryOperation so,
-                              uint16_t expInfoIndex, size_t soIndex);
+  void calculateNormalization(
+      const std::vector<coord_t> &otherValues,
+      const std::vector<Geometry::SymmetryOperation> &symmetryOps,
+      uint16_t expInfoIndex);
   void calculateIntersections(std::vector<std::array<double, 4>> &intersections,
                               const double theta, const double phi,
-                              Kernel::DblMatrix transform, double lowvalue,
-                              double highvalue);
+                              const Kernel::DblMatrix &transform,
+                              double lowvalue, double highvalue);
   void calcIntegralsForIntersections(const std::vector<double> &xValues,
                                      const API::MatrixWorkspace &integrFlux,
                                      size_t sp, std::vector<double> &yValues);
@@ -80,8 +81,6 @@ private:
   size_t m_hIdx, m_kIdx, m_lIdx, m_eIdx;
   /// number of experimentInfo objects
   size_t m_numExptInfos;
-  /// number of symmetry operations
-  size_t m_numSymmOps;
   /// Cached value of incident energy dor direct geometry
   double m_Ei;
   /// Flag indicating if the input workspace is from diffraction
@@ -8,8 +8,11 @@
 #define MANTID_MDALGORITHMS_MDNORMDIRECTSC_H_
 
 #include "MantidAPI/Algorithm.h"
+#include "MantidAPI/SpectraDetectorTypes.h"
 #include "MantidMDAlgorithms/SlicingAlgorithm.h"
 
+#include <atomic>
+
 namespace Mantid {
 namespace DataObjects {
 class EventWorkspace;
@@ -48,7 +51,8 @@ private:
   void cacheDimensionXValues();
   void calculateNormalization(const std::vector<coord_t> &otherValues,
                               const Kernel::Matrix<coord_t> &affineTrans,
-                              uint16_t expInfoIndex);
+                              uint16_t expInfoIndex,
+                              std::vector<std::atomic<signal_t>> &signalArray);
 
   void calculateIntersections(std::vector<std::array<double, 4>> &intersections,
                               const double theta, const double phi);
@@ -75,8 +79,9 @@ private:
   Kernel::V3D m_beamDir;
   /// ki-kf for Inelastic convention; kf-ki for Crystallography convention
   std::string convention;
-  /// internal flag to accumulate to an existing workspace
-  bool m_accumulate{false};
+  /// detector ID to workspace index map of the solid angle workspace, shared
+  /// by all experiment infos
+  detid2index_map m_solidAngDetToIdx;
   /// number of experiment infos
   uint16_t m_numExptInfos;
 };
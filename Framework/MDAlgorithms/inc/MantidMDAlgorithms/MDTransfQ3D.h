@@ -88,6 +88,8 @@ protected:
   double m_AbsMin;
 
 private:
+  /// the limits of the matrix dimensions as coord_t, used in elastic mode
+  std::vector<coord_t> m_DimMinCoord, m_DimMaxCoord;
   /// how to transform workspace data in elastic case
   inline bool calcMatrixCoord3DElastic(const double &k0,
                                        std::vector<coord_t> &Coord,
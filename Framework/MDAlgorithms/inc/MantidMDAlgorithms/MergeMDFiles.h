@@ -60,7 +60,8 @@ private:
 
   void finalizeOutput(const std::string &outputFile);
 
-  uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox);
+  void readEventsOfBox(const API::IMDNode &targetBox,
+                       std::vector<coord_t> &table);
 
   // the class which flatten the box structure and deal with it
   DataObjects::MDBoxFlatTree m_BoxStruct;
@@ -102,6 +103,11 @@ protected:
 
   /// Progress reporter
   std::unique_ptr<Mantid::API::Progress> m_progress = nullptr;
+
+  /// Size in bytes of the write buffer of a file backed output
+  uint64_t m_writeBufferBytes;
+  /// Number of events of the boxes merged at one time
+  uint64_t m_maxEventsInMemory;
 };
 
 } // namespace MDAlgorithms
@@ -23,6 +23,8 @@
 #include "MantidKernel/Utils.h"
 #include <boost/algorithm/string.hpp>
 
+#include <unordered_map>
+
 namespace Mantid {
 namespace MDAlgorithms {
 
@@ -91,94 +93,102 @@ void BinMD::init() {
 }
 
 //----------------------------------------------------------------------------------------------
-/** Bin the contents of a MDBox
+/** Find whether a box, or a grid box with all its children, lies entirely
+ * within a single output bin of the chunk. The transform is linear, so this is
+ * the case if all the vertexes of the box are in the same bin.
  *
- * @param box :: pointer to the MDBox to bin
+ * @param box :: the box to check
  * @param chunkMin :: the minimum index in each dimension to consider "valid"
  *(inclusive)
  * @param chunkMax :: the maximum index in each dimension to consider "valid"
  *(exclusive)
+ * @param linearIndex :: set to the linear index of the bin, if there is one
+ * @return true if the box is within a single bin
  */
-template <typename MDE, size_t nd>
-inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
-                            const size_t *const chunkMax) {
-  // An array to hold the rotated/transformed coordinates
-  auto outCenter = new coord_t[m_outD];
-
-  // Evaluate whether the entire box is in the same bin
-  if (box->getNPoints() > (1 << nd) * 2) {
-    // There is a check that the number of events is enough for it to make sense
-    // to do all this processing.
-    size_t numVertexes = 0;
-    auto vertexes = box->getVertexesArray(numVertexes);
-
-    // All vertexes have to be within THE SAME BIN = have the same linear index.
-    size_t lastLinearIndex = 0;
-    bool badOne = false;
-
-    for (size_t i = 0; i < numVertexes; i++) {
-      // Cache the center of the event (again for speed)
-      const coord_t *inCenter = vertexes.get() + i * nd;
-
-      // Now transform to the output dimensions
-      m_transform->apply(inCenter, outCenter);
-      // std::cout << "Input coord " << VMD(nd,inCenter) << " transformed to "
-      // <<  VMD(nd,outCenter) << '\n';
-
-      // To build up the linear index
-      size_t linearIndex = 0;
-      // To mark VERTEXES outside range
-      badOne = false;
-
-      /// Loop through the dimensions on which we bin
-      for (size_t bd = 0; bd < m_outD; bd++) {
-        // What is the bin index in that dimension
-        coord_t x = outCenter[bd];
-        auto ix = size_t(x);
-        // Within range (for this chunk)?
-        if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
-          // Build up the linear index
-          linearIndex += indexMultiplier[bd] * ix;
-        } else {
-          // Outside the range
-          badOne = true;
-          break;
-        }
-      } // (for each dim in MDHisto)
+bool BinMD::isInSingleBin(const API::IMDNode &box, const size_t *const chunkMin,
+                          const size_t *const chunkMax,
+                          size_t &linearIndex) const {
+  const size_t nd = box.getNumDims();
+  std::vector<coord_t> outCenter(m_outD);
+  size_t numVertexes = 0;
+  auto vertexes = box.getVertexesArray(numVertexes);
+
+  // All vertexes have to be within THE SAME BIN = have the same linear index.
+  for (size_t i = 0; i < numVertexes; i++) {
+    // Now transform to the output dimensions
+    m_transform->apply(vertexes.get() + i * nd, outCenter.data());
 
-      // Is the vertex at the same place as the last one?
-      if (!badOne) {
-        if ((i > 0) && (linearIndex != lastLinearIndex)) {
-          // Change of index
-          badOne = true;
-          break;
-        }
-        lastLinearIndex = linearIndex;
+    // To build up the linear index
+    size_t vertexIndex = 0;
+    /// Loop through the dimensions on which we bin
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      // What is the bin index in that dimension
+      coord_t x = outCenter[bd];
+      auto ix = size_t(x);
+      // Within range (for this chunk)?
+      if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
+        // Build up the linear index
+        vertexIndex += indexMultiplier[bd] * ix;
+      } else {
+        // The vertex is outside the range
+        return false;
       }
+    } // (for each dim in MDHisto)
 
-      // Was the vertex completely outside the range?
-      if (badOne)
-        break;
-    } // (for each vertex)
+    // Is the vertex at the same place as the last one?
+    if ((i > 0) && (vertexIndex != linearIndex))
+      return false;
+    linearIndex = vertexIndex;
+  } // (for each vertex)
+  return numVertexes > 0;
+}
 
-    if (!badOne) {
-      // Yes, the entire box is within a single bin
-      //        std::cout << "Box at " << box->getExtentsStr() << " is within a
-      //        single bin.\n";
-      // Add the CACHED signal from the entire box
-      signals[lastLinearIndex] += box->getSignal();
-      errors[lastLinearIndex] += box->getErrorSquared();
-      // TODO: If DataObjects get a weight, this would need to get the summed
-      // weight.
-      numEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
+//----------------------------------------------------------------------------------------------
+/** Add the CACHED signal of an entire box, or grid box, to a bin
+ *
+ * @param box :: the box
+ * @param linearIndex :: the linear index of the bin
+ */
+void BinMD::addBoxToBin(const API::IMDNode &box, const size_t linearIndex) {
+  signals[linearIndex] += box.getSignal();
+  errors[linearIndex] += box.getErrorSquared();
+  // TODO: If DataObjects get a weight, this would need to get the summed
+  // weight.
+  numEvents[linearIndex] += static_cast<signal_t>(box.getNPoints());
+}
 
-      // And don't bother looking at each event. This may save lots of time
-      // loading from disk.
-      delete[] outCenter;
-      return;
-    }
+//----------------------------------------------------------------------------------------------
+/** Bin the contents of a MDBox
+ *
+ * @param box :: pointer to the MDBox to bin
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ */
+template <typename MDE, size_t nd>
+inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
+                            const size_t *const chunkMax) {
+  // Evaluate whether the entire box is in the same bin. There is a check that
+  // the number of events is enough for it to make sense to do all this
+  // processing.
+  size_t linearIndex = 0;
+  if (box->getNPoints() > (1 << nd) * 2 &&
+      isInSingleBin(*box, chunkMin, chunkMax, linearIndex)) {
+    // Yes, the entire box is within a single bin. Add the CACHED signal from
+    // the entire box and don't bother looking at each event. This may save
+    // lots of time loading from disk.
+    addBoxToBin(*box, linearIndex);
+    return;
   }
 
+  // An array to hold the rotated/transformed coordinates
+  std::vector<coord_t> outCenter(m_outD);
+  // The rows of the matrix of the transform, if it is affine. The product is
+  // done in the same order as in CoordTransformAffine::apply.
+  const coord_t *const affine =
+      m_affineMatrix.empty() ? nullptr : m_affineMatrix.data();
+
   // If you get here, you could not determine that the entire box was in the
   // same bin.
   // So you need to iterate through events.
@@ -188,10 +198,20 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
     const coord_t *inCenter = it->getCenter();
 
     // Now transform to the output dimensions
-    m_transform->apply(inCenter, outCenter);
+    if (affine) {
+      for (size_t bd = 0; bd < m_outD; bd++) {
+        const coord_t *row = affine + bd * (nd + 1);
+        coord_t x = 0;
+        for (size_t d = 0; d < nd; d++)
+          x += row[d] * inCenter[d];
+        outCenter[bd] = x + row[nd];
+      }
+    } else {
+      m_transform->apply(inCenter, outCenter.data());
+    }
 
     // To build up the linear index
-    size_t linearIndex = 0;
+    linearIndex = 0;
     // To mark events outside range
     bool badOne = false;
 
@@ -222,8 +242,6 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
   }
   // Done with the events list
   box->releaseEvents();
-
-  delete[] outCenter;
 }
 
 //----------------------------------------------------------------------------------------------
@@ -249,6 +267,17 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     else
       indexMultiplier[d] = 1;
   }
+  // Binning events through the matrix of an affine transform avoids a virtual
+  // call per event
+  m_affineMatrix.clear();
+  if (const auto affine = dynamic_cast<CoordTransformAffine *>(m_transform)) {
+    const auto &matrix = affine->getMatrix();
+    if (matrix.numRows() == m_outD + 1 && matrix.numCols() == nd + 1) {
+      for (size_t bd = 0; bd < m_outD; bd++)
+        for (size_t d = 0; d <= nd; d++)
+          m_affineMatrix.push_back(matrix[bd][d]);
+    }
+  }
   signals = outWS->getSignalArray();
   errors = outWS->getErrorSquaredArray();
   numEvents = outWS->getNumEventsArray();
@@ -316,8 +345,10 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
 
       // Use getBoxes() to get an array with a pointer to each box
       std::vector<API::IMDNode *> boxes;
-      // Leaf-only; no depth limit; with the implicit function passed to it.
-      ws->getBox()->getBoxes(boxes, 1000, true, function);
+      // All the boxes, not only the leaves, so that grid boxes entirely within
+      // a bin are binned at once; no depth limit; with the implicit function
+      // passed to it.
+      ws->getBox()->getBoxes(boxes, 1000, false, function);
 
       // Sort boxes by file position IF file backed. This reduces seeking time,
       // hopefully.
@@ -334,12 +365,41 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         }
       }
 
+      // Grid boxes within a single bin are binned at once, and their
+      // descendants skipped. The descendants are found by their ancestry, not
+      // by their position in the list, as sorting file-backed boxes by ID
+      // separates them from their parents.
+      std::unordered_map<const API::IMDNode *, size_t> binnedGridBoxes;
+      for (const auto gridBox : boxes) {
+        size_t linearIndex = 0;
+        if (!dynamic_cast<MDBox<MDE, nd> *>(gridBox) &&
+            gridBox->getNPoints() > (1 << nd) * 2 &&
+            isInSingleBin(*gridBox, chunkMin.data(), chunkMax.data(),
+                          linearIndex) &&
+            !gridBox->getIsMasked())
+          binnedGridBoxes.emplace(gridBox, linearIndex);
+      }
+      const auto hasBinnedAncestor = [&binnedGridBoxes](const IMDNode *node) {
+        for (auto parent = node->getParent(); parent;
+             parent = parent->getParent()) {
+          if (binnedGridBoxes.count(parent) > 0)
+            return true;
+        }
+        return false;
+      };
+
       // Go through every box for this chunk.
-      for (auto &boxe : boxes) {
-        auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
-        // Perform the binning in this separate method.
-        if (box && !box->getIsMasked())
-          this->binMDBox(box, chunkMin.data(), chunkMax.data());
+      for (const auto node : boxes) {
+        if (binnedGridBoxes.empty() || !hasBinnedAncestor(node)) {
+          const auto binned = binnedGridBoxes.find(node);
+          if (binned != binnedGridBoxes.end()) {
+            addBoxToBin(*node, binned->second);
+          } else if (auto *box = dynamic_cast<MDBox<MDE, nd> *>(node)) {
+            // Perform the binning in this separate method.
+            if (!box->getIsMasked())
+              this->binMDBox(box, chunkMin.data(), chunkMax.data());
+          }
+        }
 
         // Progress reporting
         if (prog)
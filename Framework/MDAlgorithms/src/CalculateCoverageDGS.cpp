@@ -20,6 +20,7 @@
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/Strings.h"
+#include "MantidKernel/V3DArrays.h"
 #include "MantidKernel/VectorHelper.h"
 
 #include <boost/lexical_cast.hpp>
@@ -319,6 +320,11 @@ void CalculateCoverageDGS::exec() {
   m_lmin = static_cast<coord_t>(-Qmax * ol.c());
   m_lmax = static_cast<coord_t>(Qmax * ol.c());
   m_rubw.Invert();
+  // ki-kf for Inelastic convention; kf-ki for Crystallography convention
+  if (convention == "Crystallography") {
+    m_rubw *= -1.;
+  }
+  m_qin = m_rubw * V3D(0., 0., m_ki);
   // adjust Q steps/dimensions
   if (q1min == EMPTY_DBL()) {
     q1min = m_hmin;
@@ -420,14 +426,25 @@ void CalculateCoverageDGS::exec() {
 
   cacheDimensionXValues();
 
+  // unit vectors along the scattered beam for every detector, in the
+  // coordinates of the output dimensions
   const auto ndets = static_cast<int64_t>(tt.size());
+  V3DArrays qout;
+  qout.reserve(tt.size());
+  for (size_t i = 0; i < tt.size(); ++i) {
+    qout.push_back(V3D(sin(tt[i]) * cos(phi[i]), sin(tt[i]) * sin(phi[i]),
+                       cos(tt[i])));
+  }
+  qout.multiply(m_rubw);
 
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS))
   for (int64_t i = 0; i < ndets; i++) {
     PARALLEL_START_INTERUPT_REGION
-    auto intersections = calculateIntersections(tt[i], phi[i]);
+    auto intersections = calculateIntersections(qout[i]);
     if (intersections.empty())
       continue;
+    std::vector<size_t> coveredIndices;
+    coveredIndices.reserve(intersections.size());
     auto intersectionsBegin = intersections.begin();
     for (auto it = intersectionsBegin + 1; it != intersections.end(); ++it) {
       const auto &curIntSec = *it;
@@ -436,21 +453,28 @@ void CalculateCoverageDGS::exec() {
       double delta = curIntSec[3] - prevIntSec[3];
       if (delta < 1e-10)
         continue; // Assume zero contribution if difference is small
-      // Average between two intersections for final position
-      std::vector<coord_t> pos(4);
-      std::transform(curIntSec.getBareArray(), curIntSec.getBareArray() + 4,
-                     prevIntSec.getBareArray(), pos.begin(),
-                     [](const double lhs, const double rhs) {
-                       return static_cast<coord_t>(0.5 * (lhs + rhs));
-                     });
+      // Average between two intersections for final position, placed
+      // straight into the order of the output dimensions
+      coord_t posNew[4];
+      posNew[m_hIdx] =
+          static_cast<coord_t>(0.5 * (curIntSec[0] + prevIntSec[0]));
+      posNew[m_kIdx] =
+          static_cast<coord_t>(0.5 * (curIntSec[1] + prevIntSec[1]));
+      posNew[m_lIdx] =
+          static_cast<coord_t>(0.5 * (curIntSec[2] + prevIntSec[2]));
       // transform kf to energy transfer
-      pos[3] = static_cast<coord_t>(m_Ei - pos[3] * pos[3] / energyToK);
+      const double kf = 0.5 * (curIntSec[3] + prevIntSec[3]);
+      posNew[m_eIdx] = static_cast<coord_t>(m_Ei - kf * kf / energyToK);
 
-      std::vector<coord_t> posNew = affineMat * pos;
-      size_t linIndex = m_normWS->getLinearIndexAtCoord(posNew.data());
+      size_t linIndex = m_normWS->getLinearIndexAtCoord(posNew);
       if (linIndex == size_t(-1))
         continue;
-      PARALLEL_CRITICAL(updateMD) { m_normWS->setSignalAt(linIndex, 1.); }
+      coveredIndices.push_back(linIndex);
+    }
+    PARALLEL_CRITICAL(updateMD) {
+      for (const auto linIndex : coveredIndices) {
+        m_normWS->setSignalAt(linIndex, 1.);
+      }
     }
     PARALLEL_END_INTERUPT_REGION
   }
@@ -461,21 +485,13 @@ void CalculateCoverageDGS::exec() {
  *Calculate the points of intersection for the given detector with cuboid
  * surrounding the
  *detector position in HKL
- *@param theta Polar angle withd detector
- *@param phi Azimuthal angle with detector
+ *@param qout Unit vector along the scattered beam for the detector,
+ * transformed by m_rubw
  *@return A list of intersections in HKL+kf space
  */
 std::vector<Kernel::VMD>
-CalculateCoverageDGS::calculateIntersections(const double theta,
-                                             const double phi) {
-  V3D qout(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta)),
-      qin(0., 0., m_ki);
-  qout = m_rubw * qout;
-  qin = m_rubw * qin;
-  if (convention == "Crystallography") {
-    qout *= -1;
-    qin *= -1;
-  }
+CalculateCoverageDGS::calculateIntersections(const V3D &qout) {
+  const V3D &qin = m_qin;
   double hStart = qin.X() - qout.X() * m_kfmin,
          hEnd = qin.X() - qout.X() * m_kfmax;
   double kStart = qin.Y() - qout.Y() * m_kfmin,
@@ -7,8 +7,11 @@
 
 #include "MantidMDAlgorithms/ConvToMDEventsWS.h"
 
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidMDAlgorithms/UnitsConversionHelper.h"
 
+#include <algorithm>
+
 namespace Mantid {
 namespace MDAlgorithms {
 /**function converts particular list of events of type T into MD workspace and
@@ -53,12 +56,18 @@ size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
   getEventsFrom(el, events_ptr);
   const typename std::vector<T> &events = *events_ptr;
 
+  // Convert the units of all the events at once
+  std::vector<double> vals(numEvents);
+  std::transform(events.cbegin(), events.cend(), vals.begin(),
+                 [](const T &event) { return event.tof(); });
+  localUnitConv.convertUnits(vals);
+
   // Iterators to start/end
-  for (auto it = events.cbegin(); it != events.cend(); it++) {
-    double val = localUnitConv.convertUnits(it->tof());
+  auto val = vals.cbegin();
+  for (auto it = events.cbegin(); it != events.cend(); it++, val++) {
     double signal = it->weight();
     double errorSq = it->errorSquared();
-    if (!m_QConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
+    if (!m_QConverter->calcMatrixCoord(*val, locCoord, signal, errorSq))
       continue; // skip ND outside the range
 
     sig_err.push_back(static_cast<float>(signal));
@@ -146,7 +155,7 @@ void ConvToMDEventsWS::appendEventsFromInputWS(
   size_t lastNumBoxes = bc->getTotalNumMDBoxes();
   size_t nEventsInWS = m_OutWSWrapper->pWorkspace()->getNPoints();
   //--->>> Thread control stuff
-  Kernel::ThreadSchedulerFIFO *ts(nullptr);
+  Kernel::ThreadSchedulerWorkStealing *ts(nullptr);
 
   int nThreads(m_NumThreads);
   if (nThreads < 0)
@@ -157,7 +166,8 @@ void ConvToMDEventsWS::appendEventsFromInputWS(
     runMultithreaded = true;
     // Create the thread pool that will run all of these. It will be deleted by
     // the threadpool
-    ts = new Kernel::ThreadSchedulerFIFO();
+    // The box splitting tasks push their own subtasks: queue them per worker
+    ts = new Kernel::ThreadSchedulerWorkStealing(nThreads);
     // it will initiate thread pool with number threads or machine's cores (0 in
     // tp constructor)
     pProgress->resetNumSteps(m_NSpectra, 0, 1);
@@ -6,9 +6,12 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/ConvertToMDMinMaxLocal.h"
 
+#include <algorithm>
 #include <cfloat>
+#include <memory>
 
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include "MantidMDAlgorithms/ConvToMDSelector.h"
 #include "MantidMDAlgorithms/MDWSTransform.h"
@@ -128,7 +131,6 @@ void ConvertToMDMinMaxLocal::findMinMaxValues(MDWSDescription &WSDescription,
                                               std::vector<double> &MaxValues) {
 
   MDAlgorithms::UnitsConversionHelper unitsConverter;
-  double signal(1), errorSq(1);
   //
   size_t nDims = MinValues.size();
   MinValues.assign(nDims, DBL_MAX);
@@ -146,43 +148,75 @@ void ConvertToMDMinMaxLocal::findMinMaxValues(MDWSDescription &WSDescription,
   auto detIDMap =
       WSDescription.m_PreprDetTable->getColVector<size_t>("detIDMap");
 
-  // vector to place transformed coordinates;
-  std::vector<coord_t> locCoord(nDims);
+  // The unit conversion and the transformation keep the state of the current
+  // spectrum, so each thread works with its own copies, and finds the ranges
+  // of its own spectra.
+  const auto nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  std::vector<UnitsConversionHelper> unitsConverters(nThreads, unitsConverter);
+  std::vector<std::unique_ptr<MDTransfInterface>> qTransfs;
+  // vectors to place transformed coordinates;
+  std::vector<std::vector<coord_t>> locCoords(nThreads,
+                                              std::vector<coord_t>(nDims));
+  for (size_t i = 0; i < nThreads; ++i) {
+    qTransfs.emplace_back(pQtransf->clone());
+    qTransfs[i]->calcGenericVariables(locCoords[i], nDims);
+  }
+  std::vector<std::vector<double>> threadMinValues(
+      nThreads, std::vector<double>(nDims, DBL_MAX));
+  std::vector<std::vector<double>> threadMaxValues(
+      nThreads, std::vector<double>(nDims, -DBL_MAX));
 
-  pQtransf->calcGenericVariables(locCoord, nDims);
-  // PRAGMA_OMP(parallel for reduction(||:rangeChanged))
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inWS))
   for (long i = 0; i < nHist; i++) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+    auto &localConverter = unitsConverters[thread];
+    auto &localQtransf = *qTransfs[thread];
+    auto &locCoord = locCoords[thread];
+    auto &localMin = threadMinValues[thread];
+    auto &localMax = threadMaxValues[thread];
+
     // get valid spectrum number
     size_t iSpctr = detIDMap[i];
 
     // update unit conversion according to current spectra
-    unitsConverter.updateConversion(iSpctr);
+    localConverter.updateConversion(iSpctr);
     // update coordinate transformation according to the spectra
-    pQtransf->calcYDepCoordinates(locCoord, iSpctr);
+    localQtransf.calcYDepCoordinates(locCoord, iSpctr);
 
     // get the range of the input data in the spectra
     auto source_range = inWS->getSpectrum(iSpctr).getXDataRange();
 
     // extract part of this range which has well defined unit conversion
-    source_range = unitsConverter.getConversionRange(source_range.first,
+    source_range = localConverter.getConversionRange(source_range.first,
                                                      source_range.second);
 
-    double x1 = unitsConverter.convertUnits(source_range.first);
-    double x2 = unitsConverter.convertUnits(source_range.second);
+    double x1 = localConverter.convertUnits(source_range.first);
+    double x2 = localConverter.convertUnits(source_range.second);
 
-    std::vector<double> range = pQtransf->getExtremumPoints(x1, x2, iSpctr);
+    std::vector<double> range = localQtransf.getExtremumPoints(x1, x2, iSpctr);
     // transform coordinates
+    double signal(1), errorSq(1);
     for (double &k : range) {
 
-      pQtransf->calcMatrixCoord(k, locCoord, signal, errorSq);
+      localQtransf.calcMatrixCoord(k, locCoord, signal, errorSq);
       // identify min-max ranges for current spectrum
       for (size_t j = 0; j < nDims; j++) {
-        if (locCoord[j] < MinValues[j])
-          MinValues[j] = locCoord[j];
-        if (locCoord[j] > MaxValues[j])
-          MaxValues[j] = locCoord[j];
+        if (locCoord[j] < localMin[j])
+          localMin[j] = locCoord[j];
+        if (locCoord[j] > localMax[j])
+          localMax[j] = locCoord[j];
       }
     }
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  for (size_t i = 0; i < nThreads; ++i) {
+    for (size_t j = 0; j < nDims; j++) {
+      MinValues[j] = std::min(MinValues[j], threadMinValues[i][j]);
+      MaxValues[j] = std::max(MaxValues[j], threadMaxValues[i][j]);
+    }
   }
 }
 } // namespace MDAlgorithms
@@ -0,0 +1,259 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidMDAlgorithms/EvaluateMDHistoExpression.h"
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/ExperimentInfo.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace Mantid::Kernel;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+// Register the algorithm into the AlgorithmFactory
+DECLARE_ALGORITHM(EvaluateMDHistoExpression)
+
+namespace {
+/// Number of bins evaluated together by one thread
+const size_t BLOCK_SIZE = 1024;
+
+using Operation = EvaluateMDHistoExpression::Operation;
+
+/// Values, squared errors and numbers of events of a block of bins
+struct Values {
+  std::vector<signal_t> signal;
+  std::vector<signal_t> errorSquared;
+  std::vector<signal_t> numEvents;
+  /// True for a constant, which does not bring events to an operation
+  bool constant;
+};
+} // namespace
+
+//----------------------------------------------------------------------------------------------
+/** Compile an expression into the instructions of a stack machine
+ * @param expression :: arithmetic expression of the workspaces and numbers
+ * @param workspaceNames :: names that may be used in the expression
+ * @return the instructions, in reverse Polish order
+ * @throws std::invalid_argument if the expression is not valid
+ */
+std::vector<EvaluateMDHistoExpression::Instruction>
+EvaluateMDHistoExpression::compile(
+    const std::string &expression,
+    const std::vector<std::string> &workspaceNames) {
+  return WorkspaceExpression::compile(expression, workspaceNames);
+}
+
+//----------------------------------------------------------------------------------------------
+/** Initialize the algorithm's properties.
+ */
+void EvaluateMDHistoExpression::init() {
+  declareProperty(
+      std::make_unique<ArrayProperty<std::string>>(
+          "InputWorkspaces",
+          boost::make_shared<MandatoryValidator<std::vector<std::string>>>()),
+      "The names of the MDHistoWorkspaces used in the Expression, as a "
+      "comma-separated list. They must all have the same number of bins.");
+  declareProperty("Expression", "",
+                  boost::make_shared<MandatoryValidator<std::string>>(),
+                  "Arithmetic expression of the InputWorkspaces and numbers, "
+                  "with the operators +, -, * and / and parentheses, e.g. "
+                  "(data - background) / norm * 2.");
+  declareProperty(std::make_unique<WorkspaceProperty<IMDHistoWorkspace>>(
+                      "OutputWorkspace", "", Direction::Output),
+                  "Name of the output MDHistoWorkspace. It has the geometry "
+                  "of the first of the InputWorkspaces.");
+}
+
+//----------------------------------------------------------------------------------------------
+/** Check that the inputs are MDHistoWorkspaces of the same size and that the
+ * expression is valid.
+ */
+std::map<std::string, std::string>
+EvaluateMDHistoExpression::validateInputs() {
+  std::map<std::string, std::string> errors;
+  const std::vector<std::string> names = getProperty("InputWorkspaces");
+  MDHistoWorkspace_sptr first;
+  for (const auto &name : names) {
+    if (!AnalysisDataService::Instance().doesExist(name)) {
+      errors["InputWorkspaces"] = name + " does not exist.";
+      return errors;
+    }
+    auto ws =
+        AnalysisDataService::Instance().retrieveWS<MDHistoWorkspace>(name);
+    if (!ws) {
+      errors["InputWorkspaces"] = name + " is not an MDHistoWorkspace.";
+      return errors;
+    }
+    if (!first) {
+      first = ws;
+      continue;
+    }
+    try {
+      first->checkWorkspaceSize(*ws, "EvaluateMDHistoExpression");
+    } catch (std::invalid_argument &e) {
+      errors["InputWorkspaces"] = name + ": " + e.what();
+      return errors;
+    }
+  }
+  try {
+    compile(getPropertyValue("Expression"), names);
+  } catch (std::invalid_argument &e) {
+    errors["Expression"] = e.what();
+  }
+  return errors;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Execute the algorithm. The bins are evaluated in blocks, each running the
+ * whole expression, rather than creating a temporary workspace per operation.
+ */
+void EvaluateMDHistoExpression::exec() {
+  const std::vector<std::string> names = getProperty("InputWorkspaces");
+  const auto program = compile(getPropertyValue("Expression"), names);
+
+  std::vector<MDHistoWorkspace_sptr> inputs;
+  for (const auto &name : names)
+    inputs.push_back(
+        AnalysisDataService::Instance().retrieveWS<MDHistoWorkspace>(name));
+
+  // Each block reads all its inputs before writing the output, so that an
+  // input can be overwritten in place
+  MDHistoWorkspace_sptr out;
+  const auto outName = getPropertyValue("OutputWorkspace");
+  const auto inPlace = std::find(names.begin(), names.end(), outName);
+  if (inPlace != names.end())
+    out = inputs[static_cast<size_t>(std::distance(names.begin(), inPlace))];
+  else
+    out = inputs.front()->clone();
+
+  const size_t numPoints = out->getNPoints();
+  const size_t numBlocks = (numPoints + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  const size_t depth = WorkspaceExpression::stackDepth(program);
+  signal_t *outSignals = out->getSignalArray();
+  signal_t *outErrors = out->getErrorSquaredArray();
+  signal_t *outEvents = out->getNumEventsArray();
+
+  PRAGMA_OMP( parallel for schedule(dynamic) if (numBlocks > 1))
+  for (int64_t block = 0; block < static_cast<int64_t>(numBlocks); ++block) {
+    PARALLEL_START_INTERUPT_REGION
+    const size_t begin = static_cast<size_t>(block) * BLOCK_SIZE;
+    const size_t size = std::min(BLOCK_SIZE, numPoints - begin);
+    std::vector<Values> stack(depth);
+    for (auto &values : stack) {
+      values.signal.resize(size);
+      values.errorSquared.resize(size);
+      values.numEvents.resize(size);
+    }
+    size_t top = 0;
+    for (const auto &instruction : program) {
+      if (instruction.operation == Operation::Workspace) {
+        const auto &ws = *inputs[instruction.index];
+        auto &result = stack[top++];
+        std::copy_n(ws.getSignalArray() + begin, size, result.signal.begin());
+        std::copy_n(ws.getErrorSquaredArray() + begin, size,
+                    result.errorSquared.begin());
+        std::copy_n(ws.getNumEventsArray() + begin, size,
+                    result.numEvents.begin());
+        result.constant = false;
+        continue;
+      }
+      if (instruction.operation == Operation::Constant) {
+        auto &result = stack[top++];
+        std::fill(result.signal.begin(), result.signal.end(),
+                  instruction.value);
+        std::fill(result.errorSquared.begin(), result.errorSquared.end(), 0.);
+        std::fill(result.numEvents.begin(), result.numEvents.end(), 0.);
+        result.constant = true;
+        continue;
+      }
+      if (instruction.operation == Operation::Negate) {
+        auto &result = stack[top - 1];
+        for (size_t i = 0; i < size; ++i)
+          result.signal[i] = -result.signal[i];
+        continue;
+      }
+
+      // Binary operations replace the two values on top by their result
+      auto &a = stack[top - 2];
+      const auto &b = stack[top - 1];
+      --top;
+      switch (instruction.operation) {
+      case Operation::Add:
+      case Operation::Subtract: {
+        const signal_t sign =
+            (instruction.operation == Operation::Add) ? 1. : -1.;
+        for (size_t i = 0; i < size; ++i) {
+          a.signal[i] += sign * b.signal[i];
+          a.errorSquared[i] += b.errorSquared[i];
+          a.numEvents[i] += b.numEvents[i];
+        }
+        break;
+      }
+      case Operation::Multiply:
+        for (size_t i = 0; i < size; ++i) {
+          const signal_t f = a.signal[i] * b.signal[i];
+          a.errorSquared[i] = a.errorSquared[i] * b.signal[i] * b.signal[i] +
+                              b.errorSquared[i] * a.signal[i] * a.signal[i];
+          a.signal[i] = f;
+        }
+        break;
+      case Operation::Divide:
+        for (size_t i = 0; i < size; ++i) {
+          const signal_t b2 = b.signal[i] * b.signal[i];
+          const signal_t f = a.signal[i] / b.signal[i];
+          a.errorSquared[i] =
+              a.errorSquared[i] / b2 + b.errorSquared[i] * f * f / b2;
+          a.signal[i] = f;
+        }
+        break;
+      default:
+        break;
+      }
+      // As with MultiplyMD and DivideMD, the events are those of the
+      // workspace on the left, or on the right when multiplying a constant
+      if ((instruction.operation == Operation::Multiply ||
+           instruction.operation == Operation::Divide) &&
+          a.constant)
+        a.numEvents = b.numEvents;
+      a.constant = a.constant && b.constant;
+    }
+
+    const auto &result = stack.front();
+    std::copy(result.signal.begin(), result.signal.end(), outSignals + begin);
+    std::copy(result.errorSquared.begin(), result.errorSquared.end(),
+              outErrors + begin);
+    std::copy(result.numEvents.begin(), result.numEvents.end(),
+              outEvents + begin);
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // As in BinaryOperationMD, flag the workspace so that BinMD does not rebin
+  // it from its original workspace
+  out->clearMDMasking();
+  if (out->getNumExperimentInfo() == 0)
+    out->addExperimentInfo(ExperimentInfo_sptr(new ExperimentInfo()));
+  out->getExperimentInfo(0)->mutableRun().addProperty(
+      new PropertyWithValue<std::string>("mdhisto_was_modified", "1"), true);
+
+  setProperty("OutputWorkspace",
+              boost::static_pointer_cast<IMDHistoWorkspace>(out));
+}
+
+} // namespace MDAlgorithms
+} // namespace Mantid
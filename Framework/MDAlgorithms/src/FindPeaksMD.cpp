@@ -17,7 +17,11 @@
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/VMD.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 using namespace Mantid::Kernel;
@@ -107,6 +111,125 @@ void addDetectors(DataObjects::Peak &peak, MDBoxBase<MDE, nd> &box) {
   // Compile time deduction of the correct function call
   addDetectors(peak, box, IsFullEvent<MDE, nd>());
 }
+
+/// A candidate peak box, <density, index of the box>
+using DensityAndIndex = std::pair<double, size_t>;
+
+/**
+ * Make a heap of candidate boxes, which gives the densest first, and of
+ * boxes of equal density the one with the highest index first. Only the
+ * candidates that are taken from it are sorted, so finding the densest
+ * boxes is linear in the number of candidates rather than n log n.
+ * @param candidates :: The candidate boxes, which are reordered into a heap
+ */
+void makeDensityHeap(std::vector<DensityAndIndex> &candidates) {
+  std::make_heap(candidates.begin(), candidates.end());
+}
+
+/**
+ * Take the densest candidate from a heap made by makeDensityHeap
+ * @param candidates :: The heap of candidate boxes, which is popped
+ * @return the densest candidate
+ */
+DensityAndIndex popDensest(std::vector<DensityAndIndex> &candidates) {
+  std::pop_heap(candidates.begin(), candidates.end());
+  const auto densest = candidates.back();
+  candidates.pop_back();
+  return densest;
+}
+
+/**
+ * The centers of the boxes picked as peaks, hashed by their position in the
+ * first three dimensions on a grid of cells as wide as the peak distance
+ * threshold. Any center closer than the threshold to a new box is in one of
+ * the 27 cells around that box, so the new box is only compared with the
+ * centers in those cells instead of with all the peaks found.
+ */
+class PickedCenters {
+public:
+  PickedCenters(const size_t nd, const coord_t radiusSquared)
+      : m_nd(nd), m_radiusSquared(radiusSquared),
+        // a little wider than the threshold, so that rounding cannot put
+        // centers within it more than one cell apart
+        m_cellSize(std::sqrt(static_cast<double>(radiusSquared)) * 1.001) {}
+
+  /// @return true if the center is closer than the threshold to a picked one
+  template <typename T> bool isNearPicked(const T *center) const {
+    Cell cell;
+    if (!(m_radiusSquared > 0) || !cellOf(center, cell))
+      return false;
+    Cell neighbour;
+    for (int64_t i = -1; i <= 1; ++i) {
+      neighbour[0] = cell[0] + i;
+      for (int64_t j = -1; j <= 1; ++j) {
+        neighbour[1] = cell[1] + j;
+        for (int64_t k = -1; k <= 1; ++k) {
+          neighbour[2] = cell[2] + k;
+          const auto picked = m_cells.find(neighbour);
+          if (picked == m_cells.end())
+            continue;
+          for (const size_t index : picked->second) {
+            const coord_t *otherCenter = &m_centers[index * m_nd];
+            // Distance between this box and a box we already put in.
+            coord_t distSquared = 0.0;
+            for (size_t d = 0; d < m_nd; d++) {
+              coord_t dist = otherCenter[d] - static_cast<coord_t>(center[d]);
+              distSquared += (dist * dist);
+            }
+            if (distSquared < m_radiusSquared)
+              return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  /// Add the center of a box picked as a peak
+  template <typename T> void add(const T *center) {
+    Cell cell;
+    if (!(m_radiusSquared > 0) || !cellOf(center, cell))
+      return;
+    const size_t index = m_centers.size() / m_nd;
+    for (size_t d = 0; d < m_nd; d++)
+      m_centers.push_back(static_cast<coord_t>(center[d]));
+    m_cells[cell].push_back(index);
+  }
+
+private:
+  using Cell = std::array<int64_t, 3>;
+  struct CellHash {
+    size_t operator()(const Cell &cell) const {
+      size_t hash = 0;
+      for (const auto index : cell)
+        hash = hash * 1000003 ^ std::hash<int64_t>()(index);
+      return hash;
+    }
+  };
+
+  /// Find the cell of a center, false if it is not finite, as such a center
+  /// is never closer than the threshold to another
+  template <typename T> bool cellOf(const T *center, Cell &cell) const {
+    constexpr double limit = 4e18;
+    for (size_t d = 0; d < 3; d++) {
+      const double position =
+          std::floor(static_cast<double>(center[d]) / m_cellSize);
+      if (!std::isfinite(position))
+        return false;
+      cell[d] =
+          static_cast<int64_t>(std::max(-limit, std::min(position, limit)));
+    }
+    return true;
+  }
+
+  const size_t m_nd;
+  const coord_t m_radiusSquared;
+  const double m_cellSize;
+  /// The centers picked, nd coordinates each
+  std::vector<coord_t> m_centers;
+  /// The indices of the centers picked in each cell
+  std::unordered_map<Cell, std::vector<size_t>, CellHash> m_cells;
+};
 } // namespace
 
 // Register the algorithm into the AlgorithmFactory
@@ -404,27 +527,23 @@ void FindPeaksMD::findPeaks(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     progress(0.10, "Getting Boxes");
     ws->getBox()->getBoxes(boxes, 1000, true);
 
-    // This pair is the <density, ptr to the box>
-    using dens_box = std::pair<double, API::IMDNode *>;
-
-    // Map that will sort the boxes by increasing density. The key = density;
-    // value = box *.
-    typename std::multimap<double, API::IMDNode *> sortedBoxes;
+    // The boxes dense enough to be peaks, as <density, index in boxes>,
+    // ordered in a heap by decreasing density.
+    std::vector<DensityAndIndex> sortedBoxes;
 
     // --------------- Sort and Filter by Density -----------------------------
     progress(0.20, "Sorting Boxes by Density");
-    auto it1 = boxes.begin();
-    auto it1_end = boxes.end();
-    for (; it1 != it1_end; it1++) {
-      auto box = *it1;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      auto box = boxes[i];
       double value = m_useNumberOfEventsNormalization
                          ? box->getSignalByNEvents()
                          : box->getSignalNormalized();
       value *= m_densityScaleFactor;
       // Skip any boxes with too small a signal value.
       if (value > threshold)
-        sortedBoxes.insert(dens_box(value, box));
+        sortedBoxes.emplace_back(value, i);
     }
+    makeDensityHeap(sortedBoxes);
 
     // --------------- Find Peak Boxes -----------------------------
     // List of chosen possible peak boxes.
@@ -436,13 +555,13 @@ void FindPeaksMD::findPeaks(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     bool isMDEvent(ws->id().find("MDEventWorkspace") != std::string::npos);
 
     int64_t numBoxesFound = 0;
-    // Now we go (backwards) through the map
-    // e.g. from highest density down to lowest density.
-    typename std::multimap<double, boxPtr>::reverse_iterator it2;
-    auto it2_end = sortedBoxes.rend();
-    for (it2 = sortedBoxes.rbegin(); it2 != it2_end; ++it2) {
-      signal_t density = it2->first;
-      boxPtr box = it2->second;
+    PickedCenters pickedCenters(nd, peakRadiusSquared);
+    // Now we go through the heap, from highest density down to lowest
+    // density, until enough peaks are found.
+    while (!sortedBoxes.empty()) {
+      const auto densest = popDensest(sortedBoxes);
+      signal_t density = densest.first;
+      boxPtr box = boxes[densest.second];
 #ifndef MDBOX_TRACK_CENTROID
       coord_t boxCenter[nd];
       box->calculateCentroid(boxCenter);
@@ -450,30 +569,8 @@ void FindPeaksMD::findPeaks(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       const coord_t *boxCenter = box->getCentroid();
 #endif
 
-      // Compare to all boxes already picked.
-      bool badBox = false;
-      for (auto &peakBoxe : peakBoxes) {
-
-#ifndef MDBOX_TRACK_CENTROID
-        coord_t otherCenter[nd];
-        (*it3)->calculateCentroid(otherCenter);
-#else
-        const coord_t *otherCenter = peakBoxe->getCentroid();
-#endif
-
-        // Distance between this box and a box we already put in.
-        coord_t distSquared = 0.0;
-        for (size_t d = 0; d < nd; d++) {
-          coord_t dist = otherCenter[d] - boxCenter[d];
-          distSquared += (dist * dist);
-        }
-
-        // Reject this box if it is too close to another previously found box.
-        if (distSquared < peakRadiusSquared) {
-          badBox = true;
-          break;
-        }
-      }
+      // Reject this box if it is too close to another previously found box.
+      const bool badBox = pickedCenters.isNearPicked(boxCenter);
 
       // The box was not rejected for another reason.
       if (!badBox) {
@@ -484,6 +581,7 @@ void FindPeaksMD::findPeaks(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         }
 
         peakBoxes.push_back(box);
+        pickedCenters.add(boxCenter);
         g_log.debug() << "Found box at ";
         for (size_t d = 0; d < nd; d++)
           g_log.debug() << (d > 0 ? "," : "") << boxCenter[d];
@@ -587,12 +685,9 @@ void FindPeaksMD::findPeaksHisto(
     // Copy the instrument, sample, run to the peaks workspace.
     peakWS->copyExperimentInfoFrom(ei.get());
 
-    // This pair is the <density, box index>
-    using dens_box = std::pair<double, size_t>;
-
-    // Map that will sort the boxes by increasing density. The key = density;
-    // value = box index.
-    std::multimap<double, size_t> sortedBoxes;
+    // The boxes dense enough to be peaks, as <density, box index>, ordered
+    // in a heap by decreasing density.
+    std::vector<DensityAndIndex> sortedBoxes;
 
     size_t numBoxes = ws->getNPoints();
 
@@ -620,8 +715,9 @@ void FindPeaksMD::findPeaksHisto(
       double density = ws->getSignalNormalizedAt(i) * m_densityScaleFactor;
       // Skip any boxes with too small a signal density.
       if (density > thresholdDensity)
-        sortedBoxes.insert(dens_box(density, i));
+        sortedBoxes.emplace_back(density, i);
     }
+    makeDensityHeap(sortedBoxes);
 
     // --------------- Find Peak Boxes -----------------------------
     // List of chosen possible peak boxes.
@@ -630,34 +726,19 @@ void FindPeaksMD::findPeaksHisto(
     prog = std::make_unique<Progress>(this, 0.30, 0.95, m_maxPeaks);
 
     int64_t numBoxesFound = 0;
-    // Now we go (backwards) through the map
-    // e.g. from highest density down to lowest density.
-    std::multimap<double, size_t>::reverse_iterator it2;
-    auto it2_end = sortedBoxes.rend();
-    for (it2 = sortedBoxes.rbegin(); it2 != it2_end; ++it2) {
-      signal_t density = it2->first;
-      size_t index = it2->second;
+    PickedCenters pickedCenters(nd, peakRadiusSquared);
+    // Now we go through the heap, from highest density down to lowest
+    // density, until enough peaks are found.
+    while (!sortedBoxes.empty()) {
+      const auto densest = popDensest(sortedBoxes);
+      signal_t density = densest.first;
+      size_t index = densest.second;
       // Get the center of the box
       VMD boxCenter = ws->getCenter(index);
 
-      // Compare to all boxes already picked.
-      bool badBox = false;
-      for (auto &peakBoxe : peakBoxes) {
-        VMD otherCenter = ws->getCenter(peakBoxe);
-
-        // Distance between this box and a box we already put in.
-        coord_t distSquared = 0.0;
-        for (size_t d = 0; d < nd; d++) {
-          coord_t dist = otherCenter[d] - boxCenter[d];
-          distSquared += (dist * dist);
-        }
-
-        // Reject this box if it is too close to another previously found box.
-        if (distSquared < peakRadiusSquared) {
-          badBox = true;
-          break;
-        }
-      }
+      // Reject this box if it is too close to another previously found box.
+      const bool badBox =
+          pickedCenters.isNearPicked(boxCenter.getBareArray());
 
       // The box was not rejected for another reason.
       if (!badBox) {
@@ -668,6 +749,7 @@ void FindPeaksMD::findPeaksHisto(
         }
 
         peakBoxes.push_back(index);
+        pickedCenters.add(boxCenter.getBareArray());
         g_log.debug() << "Found box at index " << index;
         g_log.debug() << "; Density = " << density << '\n';
         // Report progres for each box found.
@@ -121,12 +121,246 @@ Integrate3DEvents::Integrate3DEvents(
  */
 void Integrate3DEvents::addEvents(
     std::vector<std::pair<double, V3D>> const &event_qs, bool hkl_integ) {
-  if (!maxOrder)
-    for (const auto &event_q : event_qs)
-      addEvent(event_q, hkl_integ);
-  else
-    for (const auto &event_q : event_qs)
-      addModEvent(event_q, hkl_integ);
+  for (auto event_q : event_qs) {
+    const int64_t hkl_key = shiftToPeak(event_q.second, hkl_integ);
+    if (hkl_key != 0)
+      m_event_lists[hkl_key].push_back(event_q);
+  }
+}
+
+/**
+ * Add the moments of the specified event Q's to the sums for the peaks they
+ * are near, as addEvents() would add them to the lists of events, but
+ * without keeping the events. The covariance matrix and the standard
+ * deviations of the events near a peak are found from these sums by
+ * addModEllipsoids(), so that the events can be streamed through in two
+ * passes instead of held in memory. This does not change this object, so
+ * several threads can add to their own sums at once.
+ *
+ * @param event_qs   List of event Q vectors
+ * @param hkl_integ  If true the Q vectors are in h,k,l
+ * @param moments    The sums for each peak, which are added to
+ */
+void Integrate3DEvents::addEventMoments(
+    std::vector<std::pair<double, V3D>> const &event_qs, bool hkl_integ,
+    EventMomentsMap &moments) const {
+  for (const auto &event_q : event_qs) {
+    V3D event = event_q.second;
+    const int64_t hkl_key = shiftToPeak(event, hkl_integ);
+    if (hkl_key == 0)
+      continue;
+    auto &sums = moments[hkl_key];
+    ++sums.numEvents;
+    // the same radii as ellipseIntegrateModEvents uses
+    const double norm = event.norm();
+    if (norm <= (hkl_key % 1000 == 0 ? m_radius : s_radius)) {
+      for (size_t row = 0; row < 3; row++)
+        for (size_t col = 0; col < 3; col++)
+          sums.covarianceSums[3 * row + col] += event[row] * event[col];
+    }
+    if (norm <= m_radius) {
+      ++sums.stdDevEvents;
+      for (size_t row = 0; row < 3; row++) {
+        sums.stdDevSums[row] += event[row];
+        for (size_t col = 0; col < 3; col++)
+          sums.stdDevSquareSums[3 * row + col] += event[row] * event[col];
+      }
+    }
+  }
+}
+
+/**
+ * Add sums of the moments of events near peaks, found by addEventMoments(),
+ * to the sums kept by this object.
+ *
+ * @param moments  The sums for each peak
+ */
+void Integrate3DEvents::mergeEventMoments(const EventMomentsMap &moments) {
+  for (const auto &peakMoments : moments) {
+    const auto &from = peakMoments.second;
+    auto &to = m_event_moments[peakMoments.first];
+    to.numEvents += from.numEvents;
+    to.stdDevEvents += from.stdDevEvents;
+    for (size_t i = 0; i < 3; i++)
+      to.stdDevSums[i] += from.stdDevSums[i];
+    for (size_t i = 0; i < 9; i++) {
+      to.covarianceSums[i] += from.covarianceSums[i];
+      to.stdDevSquareSums[i] += from.stdDevSquareSums[i];
+    }
+  }
+}
+
+/**
+ * Set up the ellipsoids of a modulated peak from the moments of the events
+ * near it, as ellipseIntegrateModEvents would find them from the events.
+ * The events are then counted in the ellipsoids by countEventsInEllipsoids()
+ * and the peak is integrated by integrateEllipsoids().
+ *
+ * @param E1Vec               Vector of values for calculating edge of detectors
+ * @param peak_q              The Q-vector for the peak center.
+ * @param hkl                 The h,k,l of the peak
+ * @param mnp                 The satellite m,n,p of the peak
+ * @param specify_size        If true use the following sizes, else use three
+ *                            standard deviations of the events
+ * @param peak_radius         Size of half the major axis of the ellipsoidal
+ *                            peak region.
+ * @param back_inner_radius   Size of half the major axis of the INNER
+ *                            ellipsoidal boundary of the background region
+ * @param back_outer_radius   Size of half the major axis of the OUTER
+ *                            ellipsoidal boundary of the background region
+ * @return the index of the ellipsoids, to integrate the peak with
+ */
+size_t Integrate3DEvents::addModEllipsoids(
+    std::vector<Kernel::V3D> E1Vec, V3D const &peak_q, V3D const &hkl,
+    V3D const &mnp, bool specify_size, double peak_radius,
+    double back_inner_radius, double back_outer_radius) {
+  const size_t index = m_ellipsoids.size();
+  m_ellipsoids.emplace_back();
+  m_ellipsoid_counts.emplace_back();
+
+  int64_t hkl_key = getHklMnpKey(
+      boost::math::iround<double>(hkl[0]), boost::math::iround<double>(hkl[1]),
+      boost::math::iround<double>(hkl[2]), boost::math::iround<double>(mnp[0]),
+      boost::math::iround<double>(mnp[1]), boost::math::iround<double>(mnp[2]));
+  if (hkl_key == 0)
+    return index;
+
+  auto pos = m_event_moments.find(hkl_key);
+  if (m_event_moments.end() == pos || pos->second.numEvents < 3)
+    return index;
+
+  DblMatrix cov_matrix(3, 3);
+  makeCovarianceMatrix(pos->second, cov_matrix);
+
+  std::vector<V3D> eigen_vectors;
+  getEigenVectors(cov_matrix, eigen_vectors);
+
+  std::vector<double> sigmas(3);
+  for (int i = 0; i < 3; i++)
+    sigmas[i] = stdDev(pos->second, eigen_vectors[i]);
+
+  bool invalid_peak =
+      std::any_of(sigmas.cbegin(), sigmas.cend(), [](const double sigma) {
+        return std::isnan(sigma) || sigma <= 0;
+      });
+  if (invalid_peak)
+    return index;
+
+  m_ellipsoids[index] =
+      makeEllipsoids(E1Vec, peak_q, eigen_vectors, sigmas, specify_size,
+                     peak_radius, back_inner_radius, back_outer_radius);
+  if (m_ellipsoids[index].integrate)
+    m_ellipsoid_keys.emplace(hkl_key, index);
+  return index;
+}
+
+/**
+ * Forget the ellipsoids set up by addModEllipsoids() and the events counted
+ * in them, to set up ellipsoids of other sizes. The moments of the events
+ * are kept.
+ */
+void Integrate3DEvents::clearEllipsoids() {
+  m_ellipsoids.clear();
+  m_ellipsoid_counts.clear();
+  m_ellipsoid_keys.clear();
+}
+
+/**
+ * Count the specified event Q's in the ellipsoids set up by
+ * addModEllipsoids(), without keeping the events. This does not change this
+ * object, so several threads can add to their own counts at once.
+ *
+ * @param event_qs   List of event Q vectors
+ * @param hkl_integ  If true the Q vectors are in h,k,l
+ * @param counts     The counts in each of the ellipsoids, which are added to
+ */
+void Integrate3DEvents::countEventsInEllipsoids(
+    std::vector<std::pair<double, V3D>> const &event_qs, bool hkl_integ,
+    std::vector<EllipsoidCounts> &counts) const {
+  counts.resize(m_ellipsoids.size());
+  for (const auto &event_q : event_qs) {
+    V3D event = event_q.second;
+    const int64_t hkl_key = shiftToPeak(event, hkl_integ);
+    if (hkl_key == 0)
+      continue;
+    const auto range = m_ellipsoid_keys.equal_range(hkl_key);
+    for (auto it = range.first; it != range.second; ++it) {
+      const auto &ellipsoids = m_ellipsoids[it->second];
+      double sum = 0, sumIn = 0, sumOut = 0;
+      for (size_t k = 0; k < 3; k++) {
+        const double proj = event.scalar_prod(ellipsoids.directions[k]);
+        double comp = proj / ellipsoids.axesRadii[k];
+        sum += comp * comp;
+        comp = proj / ellipsoids.backgroundInnerRadii[k];
+        sumIn += comp * comp;
+        comp = proj / ellipsoids.backgroundOuterRadii[k];
+        sumOut += comp * comp;
+      }
+      auto &count = counts[it->second];
+      if (sum <= 1)
+        count.peak += event_q.first;
+      if (sumOut <= 1 && sumIn >= 1) {
+        if (m_useOnePercentBackgroundCorrection)
+          count.backgroundWeights.push_back(event_q.first);
+        else
+          count.background += event_q.first;
+      }
+    }
+  }
+}
+
+/**
+ * Add counts of events in the ellipsoids, found by countEventsInEllipsoids(),
+ * to the counts kept by this object.
+ *
+ * @param counts  The counts in each of the ellipsoids
+ */
+void Integrate3DEvents::mergeEllipsoidCounts(
+    const std::vector<EllipsoidCounts> &counts) {
+  for (size_t i = 0; i < counts.size() && i < m_ellipsoid_counts.size(); ++i) {
+    auto &to = m_ellipsoid_counts[i];
+    to.peak += counts[i].peak;
+    to.background += counts[i].background;
+    to.backgroundWeights.insert(to.backgroundWeights.end(),
+                                counts[i].backgroundWeights.begin(),
+                                counts[i].backgroundWeights.end());
+  }
+}
+
+/**
+ * Find the net integrated intensity of a peak from the events counted in the
+ * ellipsoids set up for it by addModEllipsoids().
+ *
+ * @param index       The index of the ellipsoids of the peak
+ * @param axes_radii  The radii used for integration in the directions of the
+ *                    three principal axes.
+ * @param inti        Returns the net integrated intensity
+ * @param sigi        Returns an estimate of the standard deviation of the net
+ *                    integrated intensity
+ * @return the shape of the peak
+ */
+Mantid::Geometry::PeakShape_const_sptr
+Integrate3DEvents::integrateEllipsoids(size_t index,
+                                       std::vector<double> &axes_radii,
+                                       double &inti, double &sigi) const {
+  inti = 0.0; // default values, in case something
+  sigi = 0.0; // is wrong with the peak.
+  const auto &ellipsoids = m_ellipsoids.at(index);
+  if (!ellipsoids.shape)
+    return boost::make_shared<NoShape>();
+
+  axes_radii = ellipsoids.axesRadii;
+  if (ellipsoids.integrate) {
+    const auto &count = m_ellipsoid_counts[index];
+    double backgrd = count.background;
+    if (m_useOnePercentBackgroundCorrection) {
+      auto weights = count.backgroundWeights;
+      backgrd = sumBackground(weights, true);
+    }
+    inti = count.peak - ellipsoids.ratio * backgrd;
+    sigi = sqrt(count.peak + ellipsoids.ratio * ellipsoids.ratio * backgrd);
+  }
+  return ellipsoids.shape;
 }
 
 std::pair<boost::shared_ptr<const Geometry::PeakShape>,
@@ -589,7 +823,6 @@ double Integrate3DEvents::numInEllipsoidBkg(
     std::vector<V3D> const &directions, std::vector<double> const &sizes,
     std::vector<double> const &sizesIn,
     const bool useOnePercentBackgroundCorrection) {
-  double count = 0;
   std::vector<double> eventVec;
   for (const auto &event : events) {
     double sum = 0;
@@ -604,15 +837,30 @@ double Integrate3DEvents::numInEllipsoidBkg(
       eventVec.push_back(event.first);
   }
 
-  auto endIndex = eventVec.size();
+  return sumBackground(eventVec, useOnePercentBackgroundCorrection);
+}
+
+/**
+ * Sum the weights of the events in a background region.
+ *
+ * @param  weights  The weights of the events, which may be reordered
+ * @param  useOnePercentBackgroundCorrection  flag if the top 1% of the
+ *                  weights should be left out of the sum.
+ * @return the sum of the weights.
+ */
+double Integrate3DEvents::sumBackground(
+    std::vector<double> &weights,
+    const bool useOnePercentBackgroundCorrection) {
+  auto endIndex = weights.size();
   if (useOnePercentBackgroundCorrection) {
     // Remove top 1% of background
-    std::sort(eventVec.begin(), eventVec.end());
+    std::sort(weights.begin(), weights.end());
     endIndex = static_cast<size_t>(0.99 * static_cast<double>(endIndex));
   }
 
+  double count = 0;
   for (size_t k = 0; k < endIndex; ++k) {
-    count += eventVec[k];
+    count += weights[k];
   }
 
   return count;
@@ -665,6 +913,27 @@ void Integrate3DEvents::makeCovarianceMatrix(
   }
 }
 
+/**
+ *  Calculate the 3x3 covariance matrix of the events near a peak from the
+ *  moments of the events, as makeCovarianceMatrix would from the events.
+ *
+ *  @param moments   Sums over the events near a peak
+ *  @param matrix    A 3x3 matrix that will be filled out with
+ *                   the covariance matrix for the events.
+ */
+void Integrate3DEvents::makeCovarianceMatrix(EventMoments const &moments,
+                                             DblMatrix &matrix) {
+  for (size_t row = 0; row < 3; row++) {
+    for (size_t col = 0; col < 3; col++) {
+      const double sum = moments.covarianceSums[3 * row + col];
+      if (moments.numEvents > 1)
+        matrix[row][col] = sum / static_cast<double>(moments.numEvents - 1);
+      else
+        matrix[row][col] = sum;
+    }
+  }
+}
+
 /**
  *  Calculate the eigen vectors of a 3x3 real symmetric matrix using the GSL.
  *
@@ -740,6 +1009,37 @@ Integrate3DEvents::stdDev(std::vector<std::pair<double, V3D>> const &events,
   return stdev;
 }
 
+/**
+ *  Calculate the standard deviation of the events near a peak in the
+ *  direction of the specified vector from the moments of the events, as
+ *  stdDev would from the events.
+ *
+ *  @param  moments     Sums over the events near a peak
+ *  @param  direction   Unit vector giving the direction vector on which
+ *                      the 3D events will be projected.
+ */
+double Integrate3DEvents::stdDev(EventMoments const &moments,
+                                 V3D const &direction) {
+  double sum = 0;
+  double sum_sq = 0;
+  double stdev = 0;
+  const auto count = static_cast<double>(moments.stdDevEvents);
+
+  for (size_t row = 0; row < 3; row++) {
+    sum += moments.stdDevSums[row] * direction[row];
+    for (size_t col = 0; col < 3; col++)
+      sum_sq += moments.stdDevSquareSums[3 * row + col] * direction[row] *
+                direction[col];
+  }
+
+  if (count > 1) {
+    double ave = sum / count;
+    stdev = sqrt((sum_sq / count - ave * ave) * count / (count - 1.0));
+  }
+
+  return stdev;
+}
+
 /**
  *  Form a map key as 10^12*h + 10^6*k + l from the integers h,k,l.
  *
@@ -783,7 +1083,7 @@ int64_t Integrate3DEvents::getHklMnpKey(int h, int k, int l, int m, int n,
  *
  *  @param hkl  The q_vector to be mapped to h,k,l
  */
-int64_t Integrate3DEvents::getHklKey2(V3D const &hkl) {
+int64_t Integrate3DEvents::getHklKey2(V3D const &hkl) const {
   int h = boost::math::iround<double>(hkl[0]);
   int k = boost::math::iround<double>(hkl[1]);
   int l = boost::math::iround<double>(hkl[2]);
@@ -796,7 +1096,7 @@ int64_t Integrate3DEvents::getHklKey2(V3D const &hkl) {
  *
  *  @param hkl  The q_vector to be mapped to h,k,l
  */
-int64_t Integrate3DEvents::getHklMnpKey2(V3D const &hkl) {
+int64_t Integrate3DEvents::getHklMnpKey2(V3D const &hkl) const {
   V3D modvec1 = V3D(m_ModHKL[0][0], m_ModHKL[1][0], m_ModHKL[2][0]);
   V3D modvec2 = V3D(m_ModHKL[0][1], m_ModHKL[1][1], m_ModHKL[2][1]);
   V3D modvec3 = V3D(m_ModHKL[0][2], m_ModHKL[1][2], m_ModHKL[2][2]);
@@ -887,7 +1187,7 @@ int64_t Integrate3DEvents::getHklMnpKey2(V3D const &hkl) {
  *
  *  @param q_vector  The q_vector to be mapped to h,k,l
  */
-int64_t Integrate3DEvents::getHklKey(V3D const &q_vector) {
+int64_t Integrate3DEvents::getHklKey(V3D const &q_vector) const {
   V3D hkl = m_UBinv * q_vector;
   int h = boost::math::iround<double>(hkl[0]);
   int k = boost::math::iround<double>(hkl[1]);
@@ -903,7 +1203,7 @@ int64_t Integrate3DEvents::getHklKey(V3D const &q_vector) {
  *
  *  @param q_vector  The q_vector to be mapped to h,k,l
  */
-int64_t Integrate3DEvents::getHklMnpKey(V3D const &q_vector) {
+int64_t Integrate3DEvents::getHklMnpKey(V3D const &q_vector) const {
   V3D hkl = m_UBinv * q_vector;
 
   V3D modvec1 = V3D(m_ModHKL[0][0], m_ModHKL[1][0], m_ModHKL[2][0]);
@@ -991,86 +1291,36 @@ int64_t Integrate3DEvents::getHklMnpKey(V3D const &q_vector) {
 }
 
 /**
- * Add an event to the appropriate vector of events for the closest h,k,l,
- * if it is within the required radius of the corresponding peak in the
- * PeakQMap.
- *
- * NOTE: The event passed in may be modified by this method.  In particular,
- * if it corresponds to one of the specified peak_qs, the corresponding peak q
- * will be subtracted from the event and the event will be added to that
- * peak's vector in the event_lists map.
+ * Find the peak with the closest h,k,l to an event, and center the event on
+ * that peak if it is within the required radius of the peak in the PeakQMap.
  *
- * @param event_Q      The Q-vector for the event that may be added to the
- *                     event_lists map, if it is close enough to some peak
- * @param hkl_integ
+ * @param event_q      The Q-vector for the event, which is shifted by the Q
+ *                     of the peak if it is close enough to the peak
+ * @param hkl_integ    If true the Q-vector is in h,k,l
+ * @return the key of the peak, or 0 if the event is not close enough to any
  */
-void Integrate3DEvents::addEvent(std::pair<double, V3D> event_Q,
-                                 bool hkl_integ) {
+int64_t Integrate3DEvents::shiftToPeak(V3D &event_q, bool hkl_integ) const {
   int64_t hkl_key;
-  if (hkl_integ)
-    hkl_key = getHklKey2(event_Q.second);
+  if (!maxOrder)
+    hkl_key = hkl_integ ? getHklKey2(event_q) : getHklKey(event_q);
   else
-    hkl_key = getHklKey(event_Q.second);
+    hkl_key = hkl_integ ? getHklMnpKey2(event_q) : getHklMnpKey(event_q);
 
   if (hkl_key == 0) // don't keep events associated with 0,0,0
-    return;
+    return 0;
 
   auto peak_it = m_peak_qs.find(hkl_key);
-  if (peak_it != m_peak_qs.end()) {
-    if (!peak_it->second.nullVector()) {
-      if (hkl_integ)
-        event_Q.second = event_Q.second - m_UBinv * peak_it->second;
-      else
-        event_Q.second = event_Q.second - peak_it->second;
-      if (event_Q.second.norm() < m_radius) {
-        m_event_lists[hkl_key].push_back(event_Q);
-      }
-    }
-  }
-}
-
-/**
- * Add an event to the appropriate vector of events for the closest h,k,l,
- * if it is within the required radius of the corresponding peak in the
- * PeakQMap.
- *
- * NOTE: The event passed in may be modified by this method.  In particular,
- * if it corresponds to one of the specified peak_qs, the corresponding peak q
- * will be subtracted from the event and the event will be added to that
- * peak's vector in the event_lists map.
- *
- * @param event_Q      The Q-vector for the event that may be added to the
- *                     event_lists map, if it is close enough to some peak
- * @param hkl_integ
- */
-void Integrate3DEvents::addModEvent(std::pair<double, V3D> event_Q,
-                                    bool hkl_integ) {
-  int64_t hklmnp_key;
+  if (peak_it == m_peak_qs.end() || peak_it->second.nullVector())
+    return 0;
 
   if (hkl_integ)
-    hklmnp_key = getHklMnpKey2(event_Q.second);
+    event_q = event_q - m_UBinv * peak_it->second;
   else
-    hklmnp_key = getHklMnpKey(event_Q.second);
-
-  if (hklmnp_key == 0) // don't keep events associated with 0,0,0
-    return;
+    event_q = event_q - peak_it->second;
 
-  auto peak_it = m_peak_qs.find(hklmnp_key);
-  if (peak_it != m_peak_qs.end()) {
-    if (!peak_it->second.nullVector()) {
-      if (hkl_integ)
-        event_Q.second = event_Q.second - m_UBinv * peak_it->second;
-      else
-        event_Q.second = event_Q.second - peak_it->second;
-
-      if (hklmnp_key % 10000 == 0) {
-        if (event_Q.second.norm() < m_radius)
-          m_event_lists[hklmnp_key].push_back(event_Q);
-      } else if (event_Q.second.norm() < s_radius) {
-        m_event_lists[hklmnp_key].push_back(event_Q);
-      }
-    }
-  }
+  // satellite peaks have a radius of their own
+  const double radius = hkl_key % 10000 == 0 ? m_radius : s_radius;
+  return event_q.norm() < radius ? hkl_key : 0;
 }
 
 /**
@@ -1117,6 +1367,54 @@ PeakShapeEllipsoid_const_sptr Integrate3DEvents::ellipseIntegrateEvents(
     std::vector<double> const &sigmas, bool specify_size, double peak_radius,
     double back_inner_radius, double back_outer_radius,
     std::vector<double> &axes_radii, double &inti, double &sigi) {
+  const auto ellipsoids =
+      makeEllipsoids(E1Vec, peak_q, directions, sigmas, specify_size,
+                     peak_radius, back_inner_radius, back_outer_radius);
+  axes_radii = ellipsoids.axesRadii;
+  // Do not use peak if edge of detector is inside integration radius
+  if (!ellipsoids.integrate)
+    return ellipsoids.shape;
+
+  double backgrd = numInEllipsoidBkg(
+      ev_list, directions, ellipsoids.backgroundOuterRadii,
+      ellipsoids.backgroundInnerRadii, m_useOnePercentBackgroundCorrection);
+
+  double peak_w_back = numInEllipsoid(ev_list, directions, axes_radii);
+
+  double ratio = ellipsoids.ratio;
+
+  inti = peak_w_back - ratio * backgrd;
+  sigi = sqrt(peak_w_back + ratio * ratio * backgrd);
+
+  return ellipsoids.shape;
+}
+
+/**
+ * Find the ellipsoids of a peak given the principal axes for the events
+ * near it and the standard deviations in the the directions of the
+ * principal axes, as described for ellipseIntegrateEvents.
+ *
+ * @param E1Vec             Vector of values for calculating edge of detectors
+ * @param peak_q            The Q-vector for the peak center.
+ * @param directions          The three principal axes of the list of events
+ * @param sigmas              The standard deviations of the events in the
+ *                            directions of the three principal axes.
+ * @param specify_size        If true use the following sizes, else use three
+ *                            standard deviations of the events
+ * @param peak_radius         Size of half the major axis of the ellipsoidal
+ *                            peak region.
+ * @param back_inner_radius   Size of half the major axis of the INNER
+ *                            ellipsoidal boundary of the background region
+ * @param back_outer_radius   Size of half the major axis of the OUTER
+ *                            ellipsoidal boundary of the background region
+ * @return the ellipsoids, not to be integrated if the peak is on the edge
+ * of the detectors
+ */
+Integrate3DEvents::Ellipsoids Integrate3DEvents::makeEllipsoids(
+    std::vector<Kernel::V3D> const &E1Vec, V3D const &peak_q,
+    std::vector<Mantid::Kernel::V3D> const &directions,
+    std::vector<double> const &sigmas, bool specify_size, double peak_radius,
+    double back_inner_radius, double back_outer_radius) {
   // r1, r2 and r3 will give the sizes of the major axis of
   // the peak ellipsoid, and of the inner and outer surface
   // of the background ellipsoidal shell, respectively.
@@ -1153,32 +1451,32 @@ PeakShapeEllipsoid_const_sptr Integrate3DEvents::ellipseIntegrateEvents(
     }
   }
 
-  axes_radii.clear();
-  std::vector<double> abcBackgroundOuterRadii;
-  std::vector<double> abcBackgroundInnerRadii;
-  std::vector<double> abcRadii;
+  Ellipsoids ellipsoids;
+  ellipsoids.directions = directions;
   for (int i = 0; i < 3; i++) {
-    abcBackgroundOuterRadii.push_back(r3 * sigmas[i]);
-    abcBackgroundInnerRadii.push_back(r2 * sigmas[i]);
-    abcRadii.push_back(r1 * sigmas[i]);
-    axes_radii.push_back(r1 * sigmas[i]);
+    ellipsoids.backgroundOuterRadii.push_back(r3 * sigmas[i]);
+    ellipsoids.backgroundInnerRadii.push_back(r2 * sigmas[i]);
+    ellipsoids.axesRadii.push_back(r1 * sigmas[i]);
   }
+  ellipsoids.shape = boost::make_shared<const PeakShapeEllipsoid>(
+      directions, ellipsoids.axesRadii, ellipsoids.backgroundInnerRadii,
+      ellipsoids.backgroundOuterRadii, Mantid::Kernel::QLab,
+      "IntegrateEllipsoids");
 
   if (!E1Vec.empty()) {
-    double h3 = 1.0 - detectorQ(E1Vec, peak_q, abcBackgroundOuterRadii);
+    double h3 = 1.0 - detectorQ(E1Vec, peak_q, ellipsoids.backgroundOuterRadii);
     // scaled from area of circle minus segment when r normalized to 1
     double m3 = std::sqrt(1.0 - (std::acos(1.0 - h3) -
                                  (1.0 - h3) * std::sqrt(2.0 * h3 - h3 * h3)) /
                                     M_PI);
-    double h1 = 1.0 - detectorQ(E1Vec, peak_q, axes_radii);
+    double h1 = 1.0 - detectorQ(E1Vec, peak_q, ellipsoids.axesRadii);
     // Do not use peak if edge of detector is inside integration radius
     if (h1 > 0.0)
-      return boost::make_shared<const PeakShapeEllipsoid>(
-          directions, abcRadii, abcBackgroundInnerRadii,
-          abcBackgroundOuterRadii, Mantid::Kernel::QLab, "IntegrateEllipsoids");
+      return ellipsoids;
     r3 *= m3;
     if (r2 != r1) {
-      double h2 = 1.0 - detectorQ(E1Vec, peak_q, abcBackgroundInnerRadii);
+      double h2 =
+          1.0 - detectorQ(E1Vec, peak_q, ellipsoids.backgroundInnerRadii);
       // scaled from area of circle minus segment when r normalized to 1
       double m2 = std::sqrt(1.0 - (std::acos(1.0 - h2) -
                                    (1.0 - h2) * std::sqrt(2.0 * h2 - h2 * h2)) /
@@ -1187,21 +1485,9 @@ PeakShapeEllipsoid_const_sptr Integrate3DEvents::ellipseIntegrateEvents(
     }
   }
 
-  double backgrd = numInEllipsoidBkg(
-      ev_list, directions, abcBackgroundOuterRadii, abcBackgroundInnerRadii,
-      m_useOnePercentBackgroundCorrection);
-
-  double peak_w_back = numInEllipsoid(ev_list, directions, axes_radii);
-
-  double ratio = pow(r1, 3) / (pow(r3, 3) - pow(r2, 3));
-
-  inti = peak_w_back - ratio * backgrd;
-  sigi = sqrt(peak_w_back + ratio * ratio * backgrd);
-
-  // Make the shape and return it.
-  return boost::make_shared<const PeakShapeEllipsoid>(
-      directions, abcRadii, abcBackgroundInnerRadii, abcBackgroundOuterRadii,
-      Mantid::Kernel::QLab, "IntegrateEllipsoids");
+  ellipsoids.ratio = pow(r1, 3) / (pow(r3, 3) - pow(r2, 3));
+  ellipsoids.integrate = true;
+  return ellipsoids;
 }
 /** Calculate if this Q is on a detector
  * The distance from C to OE is given by dv=C-E*(C.scalar_prod(E))
@@ -1214,15 +1500,16 @@ PeakShapeEllipsoid_const_sptr Integrate3DEvents::ellipseIntegrateEvents(
  * @param QLabFrame: The Peak center.
  * @param r: Peak radius.
  */
-double Integrate3DEvents::detectorQ(std::vector<Kernel::V3D> E1Vec,
+double Integrate3DEvents::detectorQ(const std::vector<Kernel::V3D> &E1Vec,
                                     const Mantid::Kernel::V3D QLabFrame,
                                     const std::vector<double> &r) {
   double quot = 1.0;
-  for (auto &E1 : E1Vec) {
+  const double minRadius = *(std::min_element(r.begin(), r.end()));
+  for (const auto &E1 : E1Vec) {
     V3D distv =
         QLabFrame - E1 * (QLabFrame.scalar_prod(
                              E1)); // distance to the trajectory as a vector
-    double quot0 = distv.norm() / *(std::min_element(r.begin(), r.end()));
+    double quot0 = distv.norm() / minRadius;
     if (quot0 < quot) {
       quot = quot0;
     }
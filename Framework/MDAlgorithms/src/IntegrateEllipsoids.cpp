@@ -50,6 +50,9 @@ const std::string Q3D("Q3D");
 /// Q-vector is always three dimensional.
 const std::size_t DIMS(3);
 
+/// Number of spectra converted at a time by a thread when streaming events.
+const int STREAM_CHUNK_SIZE(64);
+
 /**
  * @brief qListFromEventWS creates qlist from events
  * @param integrator : itegrator object on which qlists are accumulated
@@ -196,6 +199,96 @@ void IntegrateEllipsoids::qListFromHistoWS(Integrate3DEvents &integrator,
   PARALLEL_CHECK_INTERUPT_REGION
 }
 
+/**
+ * @brief streamEventQs converts the events to Q one spectrum at a time,
+ * without keeping them or changing the workspace, and passes each spectrum's
+ * Q's on. The spectra are processed in parallel chunks.
+ * @param prog : progress object
+ * @param wksp : input EventWorkspace
+ * @param UBinv : inverse of UB matrix
+ * @param hkl_integ ; boolean for integrating in HKL space
+ * @param add : takes the Q's of a spectrum and the number of the thread
+ */
+void IntegrateEllipsoids::streamEventQs(
+    Progress &prog, EventWorkspace &wksp, DblMatrix const &UBinv,
+    bool hkl_integ,
+    const std::function<void(const std::vector<std::pair<double, V3D>> &,
+                             int)> &add) {
+  const auto numSpectra = static_cast<int>(wksp.getNumberHistograms());
+  const int numChunks =
+      (numSpectra + STREAM_CHUNK_SIZE - 1) / STREAM_CHUNK_SIZE;
+  PARALLEL_FOR_IF(Kernel::threadSafe(wksp))
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    PARALLEL_START_INTERUPT_REGION
+
+    UnitsConversionHelper unitConverter;
+    unitConverter.initialize(m_targWSDescr, "Momentum");
+    MDTransfQ3D qConverter;
+    qConverter.initialize(m_targWSDescr);
+
+    EventList compressed;
+    std::vector<std::pair<double, V3D>> qList;
+    const int end = std::min(numSpectra, (chunk + 1) * STREAM_CHUNK_SIZE);
+    for (int i = chunk * STREAM_CHUNK_SIZE; i < end; ++i) {
+      EventList &events = wksp.getSpectrum(i);
+      if (events.empty()) {
+        prog.report();
+        continue;
+      }
+      // compress to a list of our own, as in qListFromEventWS
+      events.compressEvents(1e-5, &compressed);
+
+      std::vector<Mantid::coord_t> locCoord(DIMS, 0.);
+      unitConverter.updateConversion(i);
+      qConverter.calcYDepCoordinates(locCoord, i);
+
+      double signal(1.);  // ignorable garbage
+      double errorSq(1.); // ignorable garbage
+      qList.clear();
+      for (const auto &raw_event : compressed.getWeightedEventsNoTime()) {
+        double val = unitConverter.convertUnits(raw_event.tof());
+        qConverter.calcMatrixCoord(val, locCoord, signal, errorSq);
+        V3D qVec(locCoord[0], locCoord[1], locCoord[2]);
+        if (hkl_integ)
+          qVec = UBinv * qVec;
+        qList.emplace_back(raw_event.m_weight, qVec);
+      }
+      add(qList, PARALLEL_THREAD_NUMBER);
+      prog.report();
+    }
+
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+}
+
+/**
+ * @brief countEventsInEllipsoids counts the events in the ellipsoids that
+ * have been set up on the integrator, streaming through them again
+ * @param integrator : integrator object with the ellipsoids of the peaks
+ * @param prog : progress object
+ * @param wksp : input EventWorkspace
+ * @param UBinv : inverse of UB matrix
+ * @param hkl_integ ; boolean for integrating in HKL space
+ */
+void IntegrateEllipsoids::countEventsInEllipsoids(Integrate3DEvents &integrator,
+                                                  Progress &prog,
+                                                  EventWorkspace &wksp,
+                                                  DblMatrix const &UBinv,
+                                                  bool hkl_integ) {
+  std::vector<std::vector<EllipsoidCounts>> counts(
+      std::max(PARALLEL_GET_MAX_THREADS, 1));
+  streamEventQs(prog, wksp, UBinv, hkl_integ,
+                [&integrator, &counts, hkl_integ](
+                    const std::vector<std::pair<double, V3D>> &qList,
+                    int thread) {
+                  integrator.countEventsInEllipsoids(qList, hkl_integ,
+                                                     counts[thread]);
+                });
+  for (const auto &threadCounts : counts)
+    integrator.mergeEllipsoidCounts(threadCounts);
+}
+
 /** NOTE: This has been adapted from the SaveIsawQvector algorithm.
  */
 
@@ -312,6 +405,13 @@ void IntegrateEllipsoids::init() {
   declareProperty("SatelliteBackgroundOuterSize", .09, mustBePositive,
                   "Half-length of major axis for outer ellipsoidal surface of "
                   "satellite background region");
+
+  declareProperty(
+      "StreamEvents", false,
+      "If true and the input is an EventWorkspace, the events are converted "
+      "to Q and streamed through twice, first to find the ellipsoids of the "
+      "peaks and then to count the events in them, instead of being kept in "
+      "memory. This needs much less memory for large workspaces.");
 }
 
 //---------------------------------------------------------------------
@@ -358,6 +458,8 @@ void IntegrateEllipsoids::exec() {
   double adaptiveQBackgroundMultiplier = 0.0;
   bool useOnePercentBackgroundCorrection =
       getProperty("UseOnePercentBackgroundCorrection");
+  bool streamEvents = getProperty("StreamEvents");
+  streamEvents = streamEvents && eventWS;
   if (adaptiveQBackground)
     adaptiveQBackgroundMultiplier = adaptiveQMultiplier;
   if (!integrateEdge) {
@@ -464,11 +566,26 @@ void IntegrateEllipsoids::exec() {
   // set up a descripter of where we are going
   this->initTargetWSDescr(wksp);
 
-  // set up the progress bar
+  // set up the progress bar, streaming the events once to find the
+  // ellipsoids and once or twice to count the events in them
   const size_t numSpectra = wksp->getNumberHistograms();
-  Progress prog(this, 0.5, 1.0, numSpectra);
-
-  if (eventWS) {
+  size_t numPasses = 1;
+  if (streamEvents)
+    numPasses = cutoffIsigI == EMPTY_DBL() ? 2 : 3;
+  Progress prog(this, 0.5, 1.0, numPasses * numSpectra);
+
+  if (streamEvents) {
+    std::vector<EventMomentsMap> moments(std::max(PARALLEL_GET_MAX_THREADS, 1));
+    streamEventQs(prog, *eventWS, UBinv, hkl_integ,
+                  [&integrator, &moments, hkl_integ](
+                      const std::vector<std::pair<double, V3D>> &qList,
+                      int thread) {
+                    integrator.addEventMoments(qList, hkl_integ,
+                                               moments[thread]);
+                  });
+    for (const auto &threadMoments : moments)
+      integrator.mergeEventMoments(threadMoments);
+  } else if (eventWS) {
     // process as EventWorkspace
     qListFromEventWS(integrator, prog, eventWS, UBinv, hkl_integ);
   } else {
@@ -481,6 +598,8 @@ void IntegrateEllipsoids::exec() {
   std::vector<double> principalaxis1, principalaxis2, principalaxis3;
   std::vector<double> sateprincipalaxis1, sateprincipalaxis2,
       sateprincipalaxis3;
+  // find the sizes of the ellipsoids of the peaks to integrate
+  std::vector<bool> integratePeak(n_peaks, false);
   for (size_t i = 0; i < n_peaks; i++) {
     const V3D hkl(peaks[i].getIntHKL());
     const V3D mnp(peaks[i].getIntMNP());
@@ -522,34 +641,57 @@ void IntegrateEllipsoids::exec() {
       PeakRadiusVector[i] = adaptiveRadius;
       BackgroundInnerRadiusVector[i] = adaptiveBack_inner_radius;
       BackgroundOuterRadiusVector[i] = adaptiveBack_outer_radius;
-
-      std::vector<double> axes_radii;
-      Mantid::Geometry::PeakShape_const_sptr shape =
-          integrator.ellipseIntegrateModEvents(
-              E1Vec, peak_q, hkl, mnp, specify_size, adaptiveRadius,
-              adaptiveBack_inner_radius, adaptiveBack_outer_radius, axes_radii,
-              inti, sigi);
-      peaks[i].setIntensity(inti);
-      peaks[i].setSigmaIntensity(sigi);
-      peaks[i].setPeakShape(shape);
-      if (axes_radii.size() == 3) {
-        if (inti / sigi > cutoffIsigI || cutoffIsigI == EMPTY_DBL()) {
-          if (mnp == V3D(0, 0, 0)) {
-            principalaxis1.push_back(axes_radii[0]);
-            principalaxis2.push_back(axes_radii[1]);
-            principalaxis3.push_back(axes_radii[2]);
-          } else {
-            sateprincipalaxis1.push_back(axes_radii[0]);
-            sateprincipalaxis2.push_back(axes_radii[1]);
-            sateprincipalaxis3.push_back(axes_radii[2]);
-          }
-        }
-      }
+      integratePeak[i] = true;
     } else {
       peaks[i].setIntensity(0.0);
       peaks[i].setSigmaIntensity(0.0);
     }
   }
+
+  // when streaming, set up all the ellipsoids and count the events in them
+  std::vector<size_t> ellipsoids(n_peaks);
+  if (streamEvents) {
+    for (size_t i = 0; i < n_peaks; i++) {
+      if (integratePeak[i])
+        ellipsoids[i] = integrator.addModEllipsoids(
+            E1Vec, peaks[i].getQLabFrame(), peaks[i].getIntHKL(),
+            peaks[i].getIntMNP(), specify_size, PeakRadiusVector[i],
+            BackgroundInnerRadiusVector[i], BackgroundOuterRadiusVector[i]);
+    }
+    countEventsInEllipsoids(integrator, prog, *eventWS, UBinv, hkl_integ);
+  }
+
+  for (size_t i = 0; i < n_peaks; i++) {
+    if (!integratePeak[i])
+      continue;
+    const V3D mnp(peaks[i].getIntMNP());
+    std::vector<double> axes_radii;
+    Mantid::Geometry::PeakShape_const_sptr shape;
+    if (streamEvents)
+      shape = integrator.integrateEllipsoids(ellipsoids[i], axes_radii, inti,
+                                             sigi);
+    else
+      shape = integrator.ellipseIntegrateModEvents(
+          E1Vec, peaks[i].getQLabFrame(), peaks[i].getIntHKL(), mnp,
+          specify_size, PeakRadiusVector[i], BackgroundInnerRadiusVector[i],
+          BackgroundOuterRadiusVector[i], axes_radii, inti, sigi);
+    peaks[i].setIntensity(inti);
+    peaks[i].setSigmaIntensity(sigi);
+    peaks[i].setPeakShape(shape);
+    if (axes_radii.size() == 3) {
+      if (inti / sigi > cutoffIsigI || cutoffIsigI == EMPTY_DBL()) {
+        if (mnp == V3D(0, 0, 0)) {
+          principalaxis1.push_back(axes_radii[0]);
+          principalaxis2.push_back(axes_radii[1]);
+          principalaxis3.push_back(axes_radii[2]);
+        } else {
+          sateprincipalaxis1.push_back(axes_radii[0]);
+          sateprincipalaxis2.push_back(axes_radii[1]);
+          sateprincipalaxis3.push_back(axes_radii[2]);
+        }
+      }
+    }
+  }
   if (principalaxis1.size() > 1) {
     Statistics stats1 = getStatistics(principalaxis1);
     g_log.notice() << "principalaxis1: "
@@ -621,6 +763,19 @@ void IntegrateEllipsoids::exec() {
       back_outer_radius = peak_radius * 1.25992105; // A factor of 2 ^ (1/3)
       // will make the background
       // shell volume equal to the peak region volume.
+      if (streamEvents) {
+        integrator.clearEllipsoids();
+        for (size_t i = 0; i < n_peaks; i++) {
+          V3D hkl(peaks[i].getIntHKL());
+          V3D mnp(peaks[i].getIntMNP());
+          if (Geometry::IndexingUtils::ValidIndex(hkl, 1.0) ||
+              Geometry::IndexingUtils::ValidIndex(mnp, 1.0))
+            ellipsoids[i] = integrator.addModEllipsoids(
+                E1Vec, peaks[i].getQLabFrame(), hkl, mnp, specify_size,
+                peak_radius, back_inner_radius, back_outer_radius);
+        }
+        countEventsInEllipsoids(integrator, prog, *eventWS, UBinv, hkl_integ);
+      }
       for (size_t i = 0; i < n_peaks; i++) {
         V3D hkl(peaks[i].getIntHKL());
         V3D mnp(peaks[i].getIntMNP());
@@ -628,9 +783,13 @@ void IntegrateEllipsoids::exec() {
             Geometry::IndexingUtils::ValidIndex(mnp, 1.0)) {
           const V3D peak_q = peaks[i].getQLabFrame();
           std::vector<double> axes_radii;
-          integrator.ellipseIntegrateModEvents(
-              E1Vec, peak_q, hkl, mnp, specify_size, peak_radius,
-              back_inner_radius, back_outer_radius, axes_radii, inti, sigi);
+          if (streamEvents)
+            integrator.integrateEllipsoids(ellipsoids[i], axes_radii, inti,
+                                           sigi);
+          else
+            integrator.ellipseIntegrateModEvents(
+                E1Vec, peak_q, hkl, mnp, specify_size, peak_radius,
+                back_inner_radius, back_outer_radius, axes_radii, inti, sigi);
           peaks[i].setIntensity(inti);
           peaks[i].setSigmaIntensity(sigi);
           if (axes_radii.size() == 3) {
@@ -8,14 +8,10 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/MultiThreaded.h"
 
-#include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/IMDHistoWorkspace.h"
-#include "MantidAPI/IMDIterator.h"
 #include "MantidAPI/Progress.h"
 
 #include "MantidDataObjects/MDHistoWorkspace.h"
-#include "MantidDataObjects/MDHistoWorkspaceIterator.h"
-#include "MantidGeometry/MDGeometry/MDBoxImplicitFunction.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
 
 #include <algorithm>
@@ -177,6 +173,81 @@ void setMinMaxBins(Mantid::coord_t &pMin, Mantid::coord_t &pMax,
   numberOfBins =
       std::lround((pMax - pMin) / width); // round up to a whole number of bins.
 }
+
+/// The input bins overlapping one output bin along a dimension, with the
+/// fraction of each input bin that lies inside the output bin.
+using BinOverlaps = std::vector<std::pair<size_t, double>>;
+
+/**
+ * Find the overlaps of the bins of an output dimension with the bins of the
+ * corresponding input dimension.
+ * @param inDim : the input dimension
+ * @param outDim : the output dimension
+ * @return the overlaps of each output bin
+ */
+std::vector<BinOverlaps> findOverlaps(const IMDDimension &inDim,
+                                      const IMDDimension &outDim) {
+  const size_t nIn = inDim.getNBins();
+  const size_t nOut = outDim.getNBins();
+  std::vector<BinOverlaps> overlaps(nOut);
+  for (size_t o = 0; o < nOut; ++o) {
+    const Mantid::coord_t outMin = outDim.getX(o);
+    const Mantid::coord_t outMax = outDim.getX(o + 1);
+    // Start one bin early in case of rounding, the weights sort it out.
+    const auto first = static_cast<size_t>(std::max(
+        0., std::floor((outMin - inDim.getMinimum()) / inDim.getBinWidth()) -
+                1.));
+    for (size_t j = first; j < nIn; ++j) {
+      const Mantid::coord_t min = inDim.getX(j);
+      const Mantid::coord_t max = inDim.getX(j + 1);
+      if (min > outMax)
+        break;
+      if (max < outMin)
+        continue;
+      const Mantid::coord_t overlap =
+          std::min(outMax, max) - std::max(outMin, min);
+      const Mantid::coord_t fraction = overlap / (max - min);
+      if (fraction > 0)
+        overlaps[o].emplace_back(j, fraction);
+    }
+  }
+  return overlaps;
+}
+
+/**
+ * Integrate the bins of a dimension of an array of bins.
+ * @param in : the bins, dimension 0 changing fastest
+ * @param shape : the number of bins in each dimension of in
+ * @param dim : the dimension to integrate
+ * @param overlaps : the overlaps of each output bin with the bins of dim
+ * @return the bins with dim integrated into overlaps.size() bins
+ */
+std::vector<double>
+integrateDimension(const std::vector<double> &in,
+                   const std::vector<size_t> &shape, const size_t dim,
+                   const std::vector<BinOverlaps> &overlaps) {
+  size_t inner = 1;
+  for (size_t d = 0; d < dim; ++d)
+    inner *= shape[d];
+  const size_t nIn = shape[dim];
+  const size_t nOut = overlaps.size();
+  const size_t outer = in.size() / (inner * nIn);
+
+  std::vector<double> out(outer * nOut * inner, 0.);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t k = 0; k < static_cast<int64_t>(outer * nOut); ++k) {
+    const size_t o = static_cast<size_t>(k) % nOut;
+    const size_t outerIndex = static_cast<size_t>(k) / nOut;
+    auto outBins = out.begin() + static_cast<size_t>(k) * inner;
+    for (const auto &overlap : overlaps[o]) {
+      auto inBins = in.cbegin() + (outerIndex * nIn + overlap.first) * inner;
+      const double weight = overlap.second;
+      for (size_t i = 0; i < inner; ++i)
+        outBins[i] += weight * inBins[i];
+    }
+  }
+  return out;
+}
 } // namespace
 
 /**
@@ -221,29 +292,6 @@ MDHistoWorkspace_sptr createShapedOutput(IMDHistoWorkspace const *const inWS,
   return boost::make_shared<MDHistoWorkspace>(dimensions);
 }
 
-/**
- * Perform a weighted sum at the iterator position. This function does not
- * increment the iterator. Masked bins do not contribute.
- * @param iterator : Iterator to use in sum
- * @param box : Box implicit function defining valid region.
- * @param sumSignal : Accumlation in/out ref.
- * @param sumSQErrors : Accumulation error in/out ref. Squared value.
- * @param sumNEvents : Accumulation n_event in/out ref.
- */
-void performWeightedSum(MDHistoWorkspaceIterator const *const iterator,
-                        MDBoxImplicitFunction &box, double &sumSignal,
-                        double &sumSQErrors, double &sumNEvents) {
-  if (!iterator->getIsMasked()) {
-    const double weight = box.fraction(iterator->getBoxExtents());
-    if (weight != 0) {
-      sumSignal += weight * iterator->getSignal();
-      const double error = iterator->getError();
-      sumSQErrors += weight * (error * error);
-      sumNEvents += weight * double(iterator->getNumEventsFraction());
-    }
-  }
-}
-
 namespace Mantid {
 namespace MDAlgorithms {
 
@@ -331,107 +379,55 @@ void IntegrateMDHistoWorkspace::exec() {
      */
     MDHistoWorkspace_sptr outWS = createShapedOutput(inWS.get(), pbins, g_log);
 
-    Progress progress(this, 0.0, 1.0, size_t(outWS->getNPoints()));
-
-    // Store in each dimension
-    std::vector<Mantid::coord_t> binWidthsOut(nDims);
-    std::vector<int> widthVector(nDims); // used for nearest neighbour search
-    for (size_t i = 0; i < nDims; ++i) {
-      binWidthsOut[i] = outWS->getDimension(i)->getBinWidth();
-
-      // Maximum width vector for region in output workspace corresponding to
-      // region in input workspace.
-
-      /* ceil(wout/win) = n_pixels in input corresponding to 1 pixel in output.
-         The width vector is the total width. So we always need to double it to
-         take account of the whole region.
-         For example, 8/4 = 2, but thats only 1 pixel on each side of the
-         center, we need 2 * that to give the correct answer of 4.
-      */
-      widthVector[i] =
-          2 * static_cast<int>(std::ceil(binWidthsOut[i] /
-                                         inWS->getDimension(i)->getBinWidth()));
-
-      if (widthVector[i] % 2 == 0) {
-        widthVector[i] += 1; // make it odd if not already.
-      }
+    auto inHistoWS = boost::dynamic_pointer_cast<MDHistoWorkspace>(inWS);
+    if (!inHistoWS) {
+      throw std::runtime_error(
+          "Could not convert IMDHistoWorkspace to a MDHistoWorkspace");
     }
 
-    // Outer loop over the output workspace iterator poistions.
-    const int nThreads = Mantid::API::FrameworkManager::Instance()
-                             .getNumOMPThreads(); // NThreads to Request
-
-    auto outIterators = outWS->createIterators(nThreads, nullptr);
-
-    PARALLEL_FOR_NO_WSP_CHECK()
-    for (int i = 0; i < int(outIterators.size()); ++i) { // NOLINT
-      PARALLEL_START_INTERUPT_REGION
-      auto outIterator =
-          dynamic_cast<MDHistoWorkspaceIterator *>(outIterators[i].get());
-      if (!outIterator) {
-        throw std::logic_error(
-            "Failed to cast iterator to MDHistoWorkspaceIterator");
+    /* The output bins tile the input bins, and the fraction of an input bin
+       inside an output bin is the product of its fractions along each
+       dimension. So the dimensions are integrated one after the other, each
+       input bin contributing to at most a couple of output bins per pass.
+       Masked bins do not contribute.
+     */
+    const size_t nPoints = inWS->getNPoints();
+    std::vector<std::vector<double>> data(3);
+    const signal_t *signals = inWS->getSignalArray();
+    const signal_t *errorsSQ = inWS->getErrorSquaredArray();
+    const signal_t *nEvents = inWS->getNumEventsArray();
+    data[0].assign(signals, signals + nPoints);
+    data[1].assign(errorsSQ, errorsSQ + nPoints);
+    data[2].assign(nEvents, nEvents + nPoints);
+    for (size_t i = 0; i < nPoints; ++i) {
+      if (inHistoWS->getIsMaskedAt(i)) {
+        for (auto &values : data)
+          values[i] = 0.;
       }
+    }
 
-      do {
-
-        Mantid::Kernel::VMD outIteratorCenter = outIterator->getCenter();
-
-        // Calculate the extents for this out iterator position.
-        std::vector<Mantid::coord_t> mins(nDims);
-        std::vector<Mantid::coord_t> maxs(nDims);
-        for (size_t j = 0; j < nDims; ++j) {
-          const coord_t delta = binWidthsOut[j] / 2;
-          mins[j] = outIteratorCenter[j] - delta;
-          maxs[j] = outIteratorCenter[j] + delta;
-        }
-        MDBoxImplicitFunction box(mins, maxs);
-
-        double sumSignal = 0;
-        double sumSQErrors = 0;
-        double sumNEvents = 0;
-
-        // Create a thread-local input iterator.
-
-        auto iterator = inWS->createIterator();
-        auto inIterator =
-            dynamic_cast<MDHistoWorkspaceIterator *>(iterator.get());
-        if (!inIterator) {
-          throw std::runtime_error(
-              "Could not convert IMDIterator to a MDHistoWorkspaceIterator");
-        }
-
-        /*
-        We jump to the iterator position which is closest in the model
-        coordinates
-        to the centre of our output iterator. This allows us to consider a much
-        smaller region of space as part of our inner loop
-        rather than iterating over the full set of boxes of the input workspace.
-        */
-        inIterator->jumpToNearest(outIteratorCenter);
-        performWeightedSum(inIterator, box, sumSignal, sumSQErrors,
-                           sumNEvents); // Use the present position. neighbours
-                                        // below exclude the current position.
-        // Look at all of the neighbours of our position. We previously
-        // calculated what the width vector would need to be.
-        auto neighbourIndexes =
-            inIterator->findNeighbourIndexesByWidth(widthVector);
-        for (auto neighbourIndex : neighbourIndexes) {
-          inIterator->jumpTo(neighbourIndex); // Go to that neighbour
-          performWeightedSum(inIterator, box, sumSignal, sumSQErrors,
-                             sumNEvents);
-        }
-
-        const size_t iteratorIndex = outIterator->getLinearIndex();
-        outWS->setSignalAt(iteratorIndex, sumSignal);
-        outWS->setErrorSquaredAt(iteratorIndex, sumSQErrors);
-        outWS->setNumEventsAt(iteratorIndex, sumNEvents);
-
-        progress.report();
-      } while (outIterator->next());
-      PARALLEL_END_INTERUPT_REGION
+    Progress progress(this, 0.0, 1.0, nDims);
+    std::vector<size_t> shape(nDims);
+    for (size_t d = 0; d < nDims; ++d)
+      shape[d] = inWS->getDimension(d)->getNBins();
+    for (size_t d = 0; d < nDims; ++d) {
+      const auto inDim = inWS->getDimension(d);
+      const auto outDim = outWS->getDimension(d);
+      if (inDim->getNBins() != outDim->getNBins() ||
+          inDim->getMinimum() != outDim->getMinimum() ||
+          inDim->getMaximum() != outDim->getMaximum()) {
+        const auto overlaps = findOverlaps(*inDim, *outDim);
+        for (auto &values : data)
+          values = integrateDimension(values, shape, d, overlaps);
+        shape[d] = outDim->getNBins();
+      }
+      progress.report();
     }
-    PARALLEL_CHECK_INTERUPT_REGION
+
+    std::copy(data[0].cbegin(), data[0].cend(), outWS->getSignalArray());
+    std::copy(data[1].cbegin(), data[1].cend(),
+              outWS->getErrorSquaredArray());
+    std::copy(data[2].cbegin(), data[2].cend(), outWS->getNumEventsArray());
     outWS->setDisplayNormalization(inWS->displayNormalizationHisto());
     this->setProperty("OutputWorkspace", outWS);
   }
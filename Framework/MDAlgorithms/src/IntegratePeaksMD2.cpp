@@ -27,13 +27,17 @@
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidHistogramData/LinearGenerator.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/Utils.h"
 #include "MantidMDAlgorithms/GSLFunctions.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <fstream>
 #include <gsl/gsl_integration.h>
+#include <numeric>
 
 namespace Mantid {
 namespace MDAlgorithms {
@@ -48,6 +52,61 @@ using namespace Mantid::DataObjects;
 using namespace Mantid::DataObjects;
 using namespace Mantid::Geometry;
 
+namespace {
+/// Number of nearby spheres integrated together by one thread
+const size_t SPHERES_PER_GROUP = 32;
+
+/**
+ * Integrate spheres in the boxes of a workspace. The spheres are sorted by
+ * the cell of a regular grid their center is in, then integrated in groups
+ * of nearby spheres, in parallel.
+ * @param box :: top box of the workspace
+ * @param spheres :: the spheres to integrate, of three dimensions
+ * @param cellSize :: size of the cells of the grid
+ * @param useOnePercentBackgroundCorrection :: if one percent correction
+ * should be applied to background.
+ * @param parallel :: if the groups may be integrated at the same time
+ */
+void integrateSpheres(const IMDNode &box,
+                      std::vector<IMDNode::SphereIntegral> &spheres,
+                      const double cellSize,
+                      const bool useOnePercentBackgroundCorrection,
+                      const bool parallel) {
+  std::vector<std::array<int64_t, 3>> cells;
+  cells.reserve(spheres.size());
+  for (const auto &sphere : spheres) {
+    std::array<int64_t, 3> cell;
+    for (size_t d = 0; d < 3; ++d)
+      cell[2 - d] = cellSize > 0.
+                        ? static_cast<int64_t>(
+                              std::floor(sphere.center[d] / cellSize))
+                        : 0;
+    cells.push_back(cell);
+  }
+  std::vector<size_t> order(spheres.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&cells](const size_t a, const size_t b) {
+                     return cells[a] < cells[b];
+                   });
+
+  const auto numGroups = static_cast<int64_t>(
+      (order.size() + SPHERES_PER_GROUP - 1) / SPHERES_PER_GROUP);
+  PRAGMA_OMP(parallel for schedule(dynamic) if (parallel))
+  for (int64_t group = 0; group < numGroups; ++group) {
+    const auto first = order.begin() + group * SPHERES_PER_GROUP;
+    const auto last =
+        order.begin() +
+        std::min(order.size(), static_cast<size_t>(group + 1) *
+                                   SPHERES_PER_GROUP);
+    std::vector<size_t> indices(first, last);
+    // Visit the boxes in the order of the spheres, as integrateSphere does
+    std::sort(indices.begin(), indices.end());
+    box.integrateSpheres(spheres, indices, useOnePercentBackgroundCorrection);
+  }
+}
+} // namespace
+
 /** Initialize the algorithm's properties.
  */
 void IntegratePeaksMD2::init() {
@@ -286,6 +345,73 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       (std::pow(BackgroundOuterRadius, 3) - std::pow(BackgroundOuterRadius, 3));
   // volume of PeakRadius sphere
   double volumeRadius = 4.0 / 3.0 * M_PI * std::pow(PeakRadius, 3);
+
+  // Get the peak center as a position in the dimensions of the workspace
+  auto peakPosition = [CoordinatesToUse](const IPeak &p) {
+    V3D pos;
+    if (CoordinatesToUse == Mantid::Kernel::QLab) //"Q (lab frame)"
+      pos = p.getQLabFrame();
+    else if (CoordinatesToUse == Mantid::Kernel::QSample) //"Q (sample frame)"
+      pos = p.getQSampleFrame();
+    else if (CoordinatesToUse == Mantid::Kernel::HKL) //"HKL"
+      pos = p.getHKL();
+    return pos;
+  };
+  // modulus of Q, when the radii depend on it
+  auto lengthOfQ = [adaptiveQMultiplier](const coord_t *center) {
+    coord_t lenQpeak = 0.0;
+    if (adaptiveQMultiplier != 0.0) {
+      for (size_t d = 0; d < nd; d++) {
+        lenQpeak += center[d] * center[d];
+      }
+      lenQpeak = std::sqrt(lenQpeak);
+    }
+    return lenQpeak;
+  };
+  bool dimensionsUsed[nd];
+  for (size_t d = 0; d < nd; ++d)
+    dimensionsUsed[d] = true; // Use all dimensions
+
+  // Integrate the spheres of all the peaks at once, so that nearby peaks
+  // share the traversal of the boxes they touch. The background shell of a
+  // peak follows its sphere.
+  const double maxRadius = std::max(BackgroundOuterRadius, PeakRadius);
+  std::vector<double> edges;
+  std::vector<IMDNode::SphereIntegral> spheres;
+  std::vector<std::unique_ptr<CoordTransformDistance>> sphereTransforms;
+  std::vector<size_t> peakSpheres(peakWS->getNumberPeaks(), 0);
+  for (int i = 0; i < peakWS->getNumberPeaks(); ++i) {
+    const IPeak &p = peakWS->getPeak(i);
+    edges.push_back(detectorQ(p.getQLabFrame(), maxRadius));
+    if (cylinderBool || (edges.back() < maxRadius && !integrateEdge))
+      continue;
+    const V3D pos = peakPosition(p);
+    coord_t center[nd];
+    for (size_t d = 0; d < nd; ++d)
+      center[d] = static_cast<coord_t>(pos[d]);
+    const coord_t lenQpeak = lengthOfQ(center);
+    const double adaptiveRadius = adaptiveQMultiplier * lenQpeak + PeakRadius;
+    if (adaptiveRadius <= 0.0)
+      continue;
+    sphereTransforms.emplace_back(
+        std::make_unique<CoordTransformDistance>(nd, center, dimensionsUsed));
+    auto transform = sphereTransforms.back().get();
+    peakSpheres[i] = spheres.size();
+    spheres.push_back({transform, transform->getCenter(),
+                       static_cast<coord_t>(adaptiveRadius * adaptiveRadius),
+                       0.0, 0.0, 0.0});
+    if (BackgroundOuterRadius > PeakRadius) {
+      const double outer =
+          adaptiveQBackgroundMultiplier * lenQpeak + BackgroundOuterRadius;
+      const double inner =
+          adaptiveQBackgroundMultiplier * lenQpeak + BackgroundInnerRadius;
+      spheres.push_back({transform, transform->getCenter(),
+                         static_cast<coord_t>(outer * outer),
+                         static_cast<coord_t>(inner * inner), 0.0, 0.0});
+    }
+  }
+  integrateSpheres(*ws->getBox(), spheres, 2.0 * maxRadius,
+                   useOnePercentBackgroundCorrection, !ws->isFileBacked());
   //
   // If the following OMP pragma is included, this algorithm seg faults
   // sporadically when processing multiple TOPAZ runs in a script, on
@@ -308,19 +434,12 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     IPeak &p = peakWS->getPeak(i);
 
     // Get the peak center as a position in the dimensions of the workspace
-    V3D pos;
-    if (CoordinatesToUse == Mantid::Kernel::QLab) //"Q (lab frame)"
-      pos = p.getQLabFrame();
-    else if (CoordinatesToUse == Mantid::Kernel::QSample) //"Q (sample frame)"
-      pos = p.getQSampleFrame();
-    else if (CoordinatesToUse == Mantid::Kernel::HKL) //"HKL"
-      pos = p.getHKL();
+    const V3D pos = peakPosition(p);
 
     // Do not integrate if sphere is off edge of detector
 
-    double edge = detectorQ(p.getQLabFrame(),
-                            std::max(BackgroundOuterRadius, PeakRadius));
-    if (edge < std::max(BackgroundOuterRadius, PeakRadius)) {
+    const double edge = edges[i];
+    if (edge < maxRadius) {
       g_log.warning() << "Warning: sphere/cylinder for integration is off edge "
                          "of detector for peak "
                       << i << "; radius of edge =  " << edge << '\n';
@@ -333,11 +452,8 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       }
     }
 
-    // Build the sphere transformation
-    bool dimensionsUsed[nd];
     coord_t center[nd];
     for (size_t d = 0; d < nd; ++d) {
-      dimensionsUsed[d] = true; // Use all dimensions
       center[d] = static_cast<coord_t>(pos[d]);
     }
     signal_t signal = 0;
@@ -347,14 +463,7 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     double background_total = 0.0;
     if (!cylinderBool) {
       // modulus of Q
-      coord_t lenQpeak = 0.0;
-      if (adaptiveQMultiplier != 0.0) {
-        lenQpeak = 0.0;
-        for (size_t d = 0; d < nd; d++) {
-          lenQpeak += center[d] * center[d];
-        }
-        lenQpeak = std::sqrt(lenQpeak);
-      }
+      const coord_t lenQpeak = lengthOfQ(center);
       double adaptiveRadius = adaptiveQMultiplier * lenQpeak + PeakRadius;
       if (adaptiveRadius <= 0.0) {
         g_log.error() << "Error: Radius for integration sphere of peak " << i
@@ -372,7 +481,6 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
           adaptiveQBackgroundMultiplier * lenQpeak + BackgroundInnerRadius;
       BackgroundOuterRadiusVector[i] =
           adaptiveQBackgroundMultiplier * lenQpeak + BackgroundOuterRadius;
-      CoordTransformDistance sphere(nd, center, dimensionsUsed);
 
       if (auto *shapeablePeak = dynamic_cast<Peak *>(&p)) {
 
@@ -383,28 +491,16 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         shapeablePeak->setPeakShape(sphereShape);
       }
 
-      // Perform the integration into whatever box is contained within.
-      ws->getBox()->integrateSphere(
-          sphere, static_cast<coord_t>(adaptiveRadius * adaptiveRadius), signal,
-          errorSquared, 0.0 /* innerRadiusSquared */,
-          useOnePercentBackgroundCorrection);
+      // The sphere was integrated with those of the other peaks
+      signal = spheres[peakSpheres[i]].signal;
+      errorSquared = spheres[peakSpheres[i]].errorSquared;
 
       // Integrate around the background radius
 
       if (BackgroundOuterRadius > PeakRadius) {
-        // Get the total signal inside "BackgroundOuterRadius"
-        ws->getBox()->integrateSphere(
-            sphere,
-            static_cast<coord_t>((adaptiveQBackgroundMultiplier * lenQpeak +
-                                  BackgroundOuterRadius) *
-                                 (adaptiveQBackgroundMultiplier * lenQpeak +
-                                  BackgroundOuterRadius)),
-            bgSignal, bgErrorSquared,
-            static_cast<coord_t>((adaptiveQBackgroundMultiplier * lenQpeak +
-                                  BackgroundInnerRadius) *
-                                 (adaptiveQBackgroundMultiplier * lenQpeak +
-                                  BackgroundInnerRadius)),
-            useOnePercentBackgroundCorrection);
+        // Get the total signal in the background shell
+        bgSignal = spheres[peakSpheres[i] + 1].signal;
+        bgErrorSquared = spheres[peakSpheres[i] + 1].errorSquared;
 
         // Relative volume of peak vs the BackgroundOuterRadius sphere
         const double radiusRatio = (PeakRadius / BackgroundOuterRadius);
@@ -708,13 +804,13 @@ void IntegratePeaksMD2::calculateE1(
  * @param r: Peak radius.
  */
 double IntegratePeaksMD2::detectorQ(Mantid::Kernel::V3D QLabFrame, double r) {
+  // distances to all the trajectories in one vectorised pass
+  std::vector<double> distances;
+  E1Vec.distancesToLines(QLabFrame, distances);
   double edge = r;
-  for (auto &E1 : E1Vec) {
-    V3D distv = QLabFrame - E1 * (QLabFrame.scalar_prod(E1)); // distance to the
-                                                              // trajectory as a
-                                                              // vector
-    if (distv.norm() < r) {
-      edge = distv.norm();
+  for (const double distance : distances) {
+    if (distance < r) {
+      edge = distance;
     }
   }
   return edge;
@@ -20,6 +20,7 @@
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/Matrix.h"
 #include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/V3D.h"
@@ -644,10 +645,17 @@ void LoadSQW2::readPixelDataIntoWorkspace() {
       chunkSize = NPIX_CHUNK;
     }
     m_reader->read(pixBuffer, FIELDS_PER_PIXEL * chunkSize);
+    // The boxes are not split while a chunk is added and adding an event to
+    // an MDBox is thread safe, so the pixels of a chunk are added in parallel
+    size_t chunkPixelsAdded(0);
+    const float *pixels = pixBuffer.data();
+    PRAGMA_OMP(parallel for reduction(+ : chunkPixelsAdded))
     for (int64_t i = 0; i < chunkSize; ++i) {
-      pixelsAdded += addEventFromBuffer(pixBuffer.data() + i * 9);
-      status.report("Reading pixel data to workspace");
+      chunkPixelsAdded += addEventFromBuffer(pixels + i * FIELDS_PER_PIXEL);
     }
+    pixelsAdded += chunkPixelsAdded;
+    status.reportIncrement(static_cast<size_t>(chunkSize),
+                           "Reading pixel data to workspace");
     pixelsLeftToRead -= chunkSize;
     ++chunksRead;
     if ((chunksRead % NCHUNKS_SPLIT) == 0) {
@@ -710,7 +718,7 @@ void LoadSQW2::warnIfMemoryInsufficient(int64_t npixtot) {
  * from the data file
  * @return 1 if the event was added, 0 otherwise
  */
-size_t LoadSQW2::addEventFromBuffer(const float *pixel) {
+size_t LoadSQW2::addEventFromBuffer(const float *pixel) const {
   using DataObjects::MDEvent;
   // Is the pixel field valid? Older versions of Horace produced files with
   // an invalid field and we can't use this. It should be between 1 && nfiles
@@ -737,7 +745,7 @@ size_t LoadSQW2::addEventFromBuffer(const float *pixel) {
  * @param centers Coordinates assumed to be in the crystal cartesian frame.
  * The array should be atleast 3 in size
  */
-void LoadSQW2::toOutputFrame(coord_t *centers) {
+void LoadSQW2::toOutputFrame(coord_t *centers) const {
   if (m_outputFrame == "Q_sample")
     return;
   V3D qout = m_uToRLU * V3D(centers[0], centers[1], centers[2]);
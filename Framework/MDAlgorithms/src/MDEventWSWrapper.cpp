@@ -84,6 +84,9 @@ detector id-s
 coordinates of nd-dimensional events
 *
 *@param dataSize -- the length of the vector of MD events
+*
+* The events are added in one go, grouped by box, without locking the boxes:
+* only one thread may add data to the workspace at a time.
 */
 template <size_t nd>
 void MDEventWSWrapper::addMDDataND(float *sigErr, uint16_t *runIndex,
@@ -94,11 +97,13 @@ void MDEventWSWrapper::addMDDataND(float *sigErr, uint16_t *runIndex,
       DataObjects::MDEventWorkspace<DataObjects::MDEvent<nd>, nd> *>(
       m_Workspace.get());
   if (pWs) {
+    std::vector<DataObjects::MDEvent<nd>> events;
+    events.reserve(dataSize);
     for (size_t i = 0; i < dataSize; i++) {
-      pWs->addEvent(DataObjects::MDEvent<nd>(
-          *(sigErr + 2 * i), *(sigErr + 2 * i + 1), *(runIndex + i),
-          *(detId + i), (Coord + i * nd)));
+      events.emplace_back(*(sigErr + 2 * i), *(sigErr + 2 * i + 1),
+                          *(runIndex + i), *(detId + i), (Coord + i * nd));
     }
+    pWs->getBox()->addEventsUnsafe(events);
   } else {
     auto *const pLWs = dynamic_cast<
         DataObjects::MDEventWorkspace<DataObjects::MDLeanEvent<nd>, nd> *>(
@@ -109,10 +114,13 @@ void MDEventWSWrapper::addMDDataND(float *sigErr, uint16_t *runIndex,
                                "does not correspond to type of events you try "
                                "to add to it");
 
+    std::vector<DataObjects::MDLeanEvent<nd>> events;
+    events.reserve(dataSize);
     for (size_t i = 0; i < dataSize; i++) {
-      pLWs->addEvent(DataObjects::MDLeanEvent<nd>(
-          *(sigErr + 2 * i), *(sigErr + 2 * i + 1), (Coord + i * nd)));
+      events.emplace_back(*(sigErr + 2 * i), *(sigErr + 2 * i + 1),
+                          (Coord + i * nd));
     }
+    pLWs->getBox()->addEventsUnsafe(events);
   }
 }
 
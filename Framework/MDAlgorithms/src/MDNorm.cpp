@@ -441,7 +441,6 @@ void MDNorm::exec() {
   for (auto so : symmetryOps) {
     g_log.debug() << so.identifier() << "\n";
   }
-  m_numSymmOps = symmetryOps.size();
 
   m_isRLU = getProperty("RLU");
   // get the workspaces
@@ -489,12 +488,7 @@ void MDNorm::exec() {
     cacheDimensionXValues();
 
     if (!skipNormalization) {
-      size_t symmOpsIndex = 0;
-      for (const auto &so : symmetryOps) {
-        calculateNormalization(otherValues, so, expInfoIndex, symmOpsIndex);
-        symmOpsIndex++;
-      }
-
+      calculateNormalization(otherValues, symmetryOps, expInfoIndex);
     } else {
       g_log.warning("Binning limits are outside the limits of the MDWorkspace. "
                     "Not applying normalization.");
@@ -1136,15 +1130,15 @@ void MDNorm::cacheDimensionXValues() {
 
 /**
  * Computed the normalization for the input workspace. Results are stored in
- * m_normWS
+ * m_normWS. The detectors are visited once for all the symmetry operations.
  * @param otherValues - values for dimensions other than Q or DeltaE
- * @param so - symmetry operation
+ * @param symmetryOps - symmetry operations
  * @param expInfoIndex - current experiment info index
- * @param soIndex - the index of symmetry operation (for progress purposes)
  */
-void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues,
-                                    Geometry::SymmetryOperation so,
-                                    uint16_t expInfoIndex, size_t soIndex) {
+void MDNorm::calculateNormalization(
+    const std::vector<coord_t> &otherValues,
+    const std::vector<Geometry::SymmetryOperation> &symmetryOps,
+    uint16_t expInfoIndex) {
   const auto &currentExptInfo = *(m_inputWS->getExperimentInfo(expInfoIndex));
   std::vector<double> lowValues, highValues;
   auto *lowValuesLog = dynamic_cast<VectorDoubleProperty *>(
@@ -1155,16 +1149,21 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues,
   highValues = (*highValuesLog)();
 
   DblMatrix R = currentExptInfo.run().getGoniometerMatrix();
-  DblMatrix soMatrix(3, 3);
-  auto v = so.transformHKL(V3D(1, 0, 0));
-  soMatrix.setColumn(0, v);
-  v = so.transformHKL(V3D(0, 1, 0));
-  soMatrix.setColumn(1, v);
-  v = so.transformHKL(V3D(0, 0, 1));
-  soMatrix.setColumn(2, v);
-  soMatrix.Invert();
-  DblMatrix Qtransform = R * m_UB * soMatrix * m_W;
-  Qtransform.Invert();
+  std::vector<DblMatrix> Qtransforms;
+  Qtransforms.reserve(symmetryOps.size());
+  for (const auto &so : symmetryOps) {
+    DblMatrix soMatrix(3, 3);
+    auto v = so.transformHKL(V3D(1, 0, 0));
+    soMatrix.setColumn(0, v);
+    v = so.transformHKL(V3D(0, 1, 0));
+    soMatrix.setColumn(1, v);
+    v = so.transformHKL(V3D(0, 0, 1));
+    soMatrix.setColumn(2, v);
+    soMatrix.Invert();
+    DblMatrix Qtransform = R * m_UB * soMatrix * m_W;
+    Qtransform.Invert();
+    Qtransforms.push_back(Qtransform);
+  }
   const double protonCharge = currentExptInfo.run().getProtonCharge();
   const auto &spectrumInfo = currentExptInfo.spectrumInfo();
 
@@ -1190,8 +1189,8 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues,
   std::vector<double> xValues, yValues;
   std::vector<coord_t> pos, posNew;
 
-  double progStep = 0.7 / static_cast<double>(m_numExptInfos * m_numSymmOps);
-  auto progIndex = static_cast<double>(soIndex + expInfoIndex * m_numSymmOps);
+  double progStep = 0.7 / static_cast<double>(m_numExptInfos);
+  auto progIndex = static_cast<double>(expInfoIndex);
   auto prog =
       std::make_unique<API::Progress>(this, 0.3 + progStep * progIndex,
                                       0.3 + progStep * (1. + progIndex), ndets);
@@ -1226,80 +1225,87 @@ for (int64_t i = 0; i < ndets; i++) {
     }
   }
 
-  // Intersections
-  this->calculateIntersections(intersections, theta, phi, Qtransform,
-                               lowValues[i], highValues[i]);
-  if (intersections.empty())
-    continue;
-  // Get solid angle for this contribution
+  // Solid angle for this contribution, looked up once there are intersections
   double solid = protonCharge;
-  if (haveSA) {
-    solid =
-        solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
-  }
-  if (m_diffraction) {
-    // -- calculate integrals for the intersection --
-    // momentum values at intersections
-    auto intersectionsBegin = intersections.begin();
-    // copy momenta to xValues
-    xValues.resize(intersections.size());
-    yValues.resize(intersections.size());
-    auto x = xValues.begin();
-    for (auto it = intersectionsBegin; it != intersections.end(); ++it, ++x) {
-      *x = (*it)[3];
-    }
-    // calculate integrals at momenta from xValues by interpolating between
-    // points in spectrum sp
-    // of workspace integrFlux. The result is stored in yValues
-    calcIntegralsForIntersections(xValues, *integrFlux, wsIdx, yValues);
-  }
+  bool haveSolid = !haveSA;
 
   // Compute final position in HKL
   // pre-allocate for efficiency and copy non-hkl dim values into place
   pos.resize(vmdDims + otherValues.size());
   std::copy(otherValues.begin(), otherValues.end(), pos.begin() + vmdDims);
 
-  auto intersectionsBegin = intersections.begin();
-  for (auto it = intersectionsBegin + 1; it != intersections.end(); ++it) {
-    const auto &curIntSec = *it;
-    const auto &prevIntSec = *(it - 1);
-    // the full vector isn't used so compute only what is necessary
-    double delta, eps;
-    if (m_diffraction) {
-      delta = curIntSec[3] - prevIntSec[3];
-      eps = 1e-7;
-    } else {
-      delta = (curIntSec[3] * curIntSec[3] - prevIntSec[3] * prevIntSec[3]) /
-              energyToK;
-      eps = 1e-10;
+  // All the symmetry operations in the same sweep over the detectors
+  for (const auto &Qtransform : Qtransforms) {
+    // Intersections
+    this->calculateIntersections(intersections, theta, phi, Qtransform,
+                                 lowValues[i], highValues[i]);
+    if (intersections.empty())
+      continue;
+    if (!haveSolid) {
+      solid = solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] *
+              protonCharge;
+      haveSolid = true;
     }
-    if (delta < eps)
-      continue; // Assume zero contribution if difference is small
-    // Average between two intersections for final position
-    std::transform(curIntSec.data(), curIntSec.data() + vmdDims,
-                   prevIntSec.data(), pos.begin(),
-                   [](const double rhs, const double lhs) {
-                     return static_cast<coord_t>(0.5 * (rhs + lhs));
-                   });
-    signal_t signal;
     if (m_diffraction) {
-      // index of the current intersection
-      auto k = static_cast<size_t>(std::distance(intersectionsBegin, it));
-      // signal = integral between two consecutive intersections
-      signal = (yValues[k] - yValues[k - 1]) * solid;
-    } else {
-      // transform kf to energy transfer
-      pos[3] = static_cast<coord_t>(m_Ei - pos[3] * pos[3] / energyToK);
-      // signal = energy distance between two consecutive intersections *solid
-      // angle *PC
-      signal = solid * delta;
+      // -- calculate integrals for the intersection --
+      // momentum values at intersections
+      auto intersectionsBegin = intersections.begin();
+      // copy momenta to xValues
+      xValues.resize(intersections.size());
+      yValues.resize(intersections.size());
+      auto x = xValues.begin();
+      for (auto it = intersectionsBegin; it != intersections.end(); ++it, ++x) {
+        *x = (*it)[3];
+      }
+      // calculate integrals at momenta from xValues by interpolating between
+      // points in spectrum sp
+      // of workspace integrFlux. The result is stored in yValues
+      calcIntegralsForIntersections(xValues, *integrFlux, wsIdx, yValues);
+    }
+
+    auto intersectionsBegin = intersections.begin();
+    for (auto it = intersectionsBegin + 1; it != intersections.end(); ++it) {
+      const auto &curIntSec = *it;
+      const auto &prevIntSec = *(it - 1);
+      // the full vector isn't used so compute only what is necessary
+      double delta, eps;
+      if (m_diffraction) {
+        delta = curIntSec[3] - prevIntSec[3];
+        eps = 1e-7;
+      } else {
+        delta =
+            (curIntSec[3] * curIntSec[3] - prevIntSec[3] * prevIntSec[3]) /
+            energyToK;
+        eps = 1e-10;
+      }
+      if (delta < eps)
+        continue; // Assume zero contribution if difference is small
+      // Average between two intersections for final position
+      std::transform(curIntSec.data(), curIntSec.data() + vmdDims,
+                     prevIntSec.data(), pos.begin(),
+                     [](const double rhs, const double lhs) {
+                       return static_cast<coord_t>(0.5 * (rhs + lhs));
+                     });
+      signal_t signal;
+      if (m_diffraction) {
+        // index of the current intersection
+        auto k = static_cast<size_t>(std::distance(intersectionsBegin, it));
+        // signal = integral between two consecutive intersections
+        signal = (yValues[k] - yValues[k - 1]) * solid;
+      } else {
+        // transform kf to energy transfer
+        pos[3] = static_cast<coord_t>(m_Ei - pos[3] * pos[3] / energyToK);
+        // signal = energy distance between two consecutive intersections
+        // *solid angle *PC
+        signal = solid * delta;
+      }
+      m_transformation.multiplyPoint(pos, posNew);
+      size_t linIndex = m_normWS->getLinearIndexAtCoord(posNew.data());
+      if (linIndex == size_t(-1))
+        continue;
+      Mantid::Kernel::AtomicOp(signalArray[linIndex], signal,
+                               std::plus<signal_t>());
     }
-    m_transformation.multiplyPoint(pos, posNew);
-    size_t linIndex = m_normWS->getLinearIndexAtCoord(posNew.data());
-    if (linIndex == size_t(-1))
-      continue;
-    Mantid::Kernel::AtomicOp(signalArray[linIndex], signal,
-                             std::plus<signal_t>());
   }
 
   prog->report();
@@ -1331,7 +1337,7 @@ m_accumulate = true;
  */
 void MDNorm::calculateIntersections(
     std::vector<std::array<double, 4>> &intersections, const double theta,
-    const double phi, Kernel::DblMatrix transform, double lowvalue,
+    const double phi, const Kernel::DblMatrix &transform, double lowvalue,
     double highvalue) {
   V3D qout(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta)),
       qin(0., 0., 1);
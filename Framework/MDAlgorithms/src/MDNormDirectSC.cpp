@@ -149,6 +149,8 @@ void MDNormDirectSC::exec() {
   setProperty("OutputNormalizationWorkspace", m_normWS);
 
   m_numExptInfos = outputWS->getNumExperimentInfo();
+  // the normalization of all experiment infos is accumulated here
+  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
   // loop over all experiment infos
   for (uint16_t expInfoIndex = 0; expInfoIndex < m_numExptInfos;
        expInfoIndex++) {
@@ -162,14 +164,18 @@ void MDNormDirectSC::exec() {
     cacheDimensionXValues();
 
     if (!skipNormalization) {
-      calculateNormalization(otherValues, affineTrans, expInfoIndex);
+      calculateNormalization(otherValues, affineTrans, expInfoIndex,
+                             signalArray);
     } else {
       g_log.warning("Binning limits are outside the limits of the MDWorkspace. "
                     "Not applying normalization.");
     }
-    // if more than one experiment info, keep accumulating
-    m_accumulate = true;
   }
+  // add to the normalization, which may be a TemporaryNormalizationWorkspace
+  std::transform(
+      signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(),
+      m_normWS->getSignalArray(),
+      [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
 
   // Set the display normalization based on the input workspace
   outputWS->setDisplayNormalization(m_inputWS->displayNormalizationHisto());
@@ -208,6 +214,13 @@ void MDNormDirectSC::cacheInputs() {
   m_samplePos = sample->getPos();
   m_beamDir = normalize(m_samplePos - source->getPos());
 
+  // the detector mapping is the same for all experiment infos
+  API::MatrixWorkspace_const_sptr solidAngleWS =
+      getProperty("SolidAngleWorkspace");
+  if (solidAngleWS != nullptr) {
+    m_solidAngDetToIdx = solidAngleWS->getDetectorIDToWorkspaceIndexMap();
+  }
+
   double originaldEmin = exptInfoZero.run().getBinBoundaries().front();
   double originaldEmax = exptInfoZero.run().getBinBoundaries().back();
   if (exptInfoZero.run().hasProperty("Ei")) {
@@ -297,8 +310,6 @@ void MDNormDirectSC::createNormalizationWS(const MDHistoWorkspace &dataWS) {
   if (!m_normWS) {
     m_normWS = dataWS.clone();
     m_normWS->setTo(0., 0., 0.);
-  } else {
-    m_accumulate = true;
   }
 }
 
@@ -456,10 +467,13 @@ void MDNormDirectSC::cacheDimensionXValues() {
  * @param otherValues non HKLE dimensions
  * @param affineTrans affine matrix
  * @param expInfoIndex current experiment info index
+ * @param signalArray the normalization, to which this experiment info's
+ * contribution is added
  */
 void MDNormDirectSC::calculateNormalization(
     const std::vector<coord_t> &otherValues,
-    const Kernel::Matrix<coord_t> &affineTrans, uint16_t expInfoIndex) {
+    const Kernel::Matrix<coord_t> &affineTrans, uint16_t expInfoIndex,
+    std::vector<std::atomic<signal_t>> &signalArray) {
   constexpr double energyToK = 8.0 * M_PI * M_PI *
                                PhysicalConstants::NeutronMass *
                                PhysicalConstants::meV * 1e-20 /
@@ -482,19 +496,12 @@ void MDNormDirectSC::calculateNormalization(
 
   const auto &spectrumInfo = currentExptInfo.spectrumInfo();
 
-  // Mapping
   const auto ndets = static_cast<int64_t>(spectrumInfo.size());
-  bool haveSA = false;
   API::MatrixWorkspace_const_sptr solidAngleWS =
       getProperty("SolidAngleWorkspace");
-  detid2index_map solidAngDetToIdx;
-  if (solidAngleWS != nullptr) {
-    haveSA = true;
-    solidAngDetToIdx = solidAngleWS->getDetectorIDToWorkspaceIndexMap();
-  }
+  const bool haveSA = solidAngleWS != nullptr;
 
   const size_t vmdDims = 4;
-  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
   std::vector<std::array<double, 4>> intersections;
   std::vector<coord_t> pos, posNew;
   double progStep = 0.7 / m_numExptInfos;
@@ -524,8 +531,8 @@ for (int64_t i = 0; i < ndets; i++) {
   // Get solid angle for this contribution
   double solid = protonCharge;
   if (haveSA) {
-    solid =
-        solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
+    solid = solidAngleWS->y(m_solidAngDetToIdx.find(detID)->second)[0] *
+            protonCharge;
   }
   // Compute final position in HKL
   // pre-allocate for efficiency and copy non-hkl dim values into place
@@ -568,15 +575,6 @@ for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_END_INTERUPT_REGION
 }
 PARALLEL_CHECK_INTERUPT_REGION
-if (m_accumulate) {
-  std::transform(
-      signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(),
-      m_normWS->getSignalArray(),
-      [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-} else {
-  std::copy(signalArray.cbegin(), signalArray.cend(),
-            m_normWS->getSignalArray());
-}
 }
 
 /**
@@ -151,6 +151,8 @@ void MDNormSCD::exec() {
   setProperty("OutputNormalizationWorkspace", m_normWS);
 
   m_numExptInfos = outputWS->getNumExperimentInfo();
+  // the normalization of all experiment infos is accumulated here
+  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
   // loop over all experiment infos
   for (uint16_t expInfoIndex = 0; expInfoIndex < m_numExptInfos;
        expInfoIndex++) {
@@ -164,13 +166,18 @@ void MDNormSCD::exec() {
     cacheDimensionXValues();
 
     if (!skipNormalization) {
-      calculateNormalization(otherValues, affineTrans, expInfoIndex);
+      calculateNormalization(otherValues, affineTrans, expInfoIndex,
+                             signalArray);
     } else {
       g_log.warning("Binning limits are outside the limits of the MDWorkspace. "
                     "Not applying normalization.");
     }
-    m_accumulate = true;
   }
+  // add to the normalization, which may be a TemporaryNormalizationWorkspace
+  std::transform(
+      signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(),
+      m_normWS->getSignalArray(),
+      [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
 }
 
 /**
@@ -203,6 +210,13 @@ void MDNormSCD::cacheInputs() {
   }
   m_samplePos = sample->getPos();
   m_beamDir = normalize(m_samplePos - source->getPos());
+
+  // the detector mappings are the same for all experiment infos
+  API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
+  m_fluxDetToIdx = integrFlux->getDetectorIDToWorkspaceIndexMap();
+  API::MatrixWorkspace_const_sptr solidAngleWS =
+      getProperty("SolidAngleWorkspace");
+  m_solidAngDetToIdx = solidAngleWS->getDetectorIDToWorkspaceIndexMap();
 }
 
 /**
@@ -271,8 +285,6 @@ void MDNormSCD::createNormalizationWS(const MDHistoWorkspace &dataWS) {
   if (!m_normWS) {
     m_normWS = dataWS.clone();
     m_normWS->setTo(0., 0., 0.);
-  } else {
-    m_accumulate = true;
   }
 }
 
@@ -407,10 +419,13 @@ void MDNormSCD::cacheDimensionXValues() {
  * @param otherValues
  * @param affineTrans
  * @param expInfoIndex current experiment info index
+ * @param signalArray the normalization, to which this experiment info's
+ * contribution is added
  */
 void MDNormSCD::calculateNormalization(
     const std::vector<coord_t> &otherValues,
-    const Kernel::Matrix<coord_t> &affineTrans, uint16_t expInfoIndex) {
+    const Kernel::Matrix<coord_t> &affineTrans, uint16_t expInfoIndex,
+    std::vector<std::atomic<signal_t>> &signalArray) {
   API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
   integrFlux->getXMinMax(m_kiMin, m_kiMax);
   API::MatrixWorkspace_const_sptr solidAngleWS =
@@ -434,15 +449,9 @@ void MDNormSCD::calculateNormalization(
 
   const auto &spectrumInfo = currentExptInfo.spectrumInfo();
 
-  // Mappings
   const auto ndets = static_cast<int64_t>(spectrumInfo.size());
-  const detid2index_map fluxDetToIdx =
-      integrFlux->getDetectorIDToWorkspaceIndexMap();
-  const detid2index_map solidAngDetToIdx =
-      solidAngleWS->getDetectorIDToWorkspaceIndexMap();
 
   const size_t vmdDims = 4;
-  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
   std::vector<std::array<double, 4>> intersections;
   std::vector<double> xValues, yValues;
   std::vector<coord_t> pos, posNew;
@@ -471,10 +480,10 @@ for (int64_t i = 0; i < ndets; i++) {
     continue;
 
   // get the flux spetrum number
-  size_t wsIdx = fluxDetToIdx.find(detID)->second;
+  size_t wsIdx = m_fluxDetToIdx.find(detID)->second;
   // Get solid angle for this contribution
-  double solid =
-      solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
+  double solid = solidAngleWS->y(m_solidAngDetToIdx.find(detID)->second)[0] *
+                 protonCharge;
 
   // -- calculate integrals for the intersection --
   // momentum values at intersections
@@ -528,15 +537,6 @@ for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_END_INTERUPT_REGION
 }
 PARALLEL_CHECK_INTERUPT_REGION
-if (m_accumulate) {
-  std::transform(
-      signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(),
-      m_normWS->getSignalArray(),
-      [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-} else {
-  std::copy(signalArray.cbegin(), signalArray.cend(),
-            m_normWS->getSignalArray());
-}
 }
 
 /**
@@ -8,6 +8,9 @@
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/RegistrationHelper.h"
 
+#include <algorithm>
+#include <functional>
+
 namespace Mantid {
 namespace MDAlgorithms {
 // register the class, whith conversion factory under Q3D name
@@ -83,16 +86,11 @@ bool MDTransfQ3D::calcMatrixCoord3DInelastic(
     k_tr = sqrt((m_Ei + E_tr) / PhysicalConstants::E_mev_toNeutronWavenumberSq);
   }
 
+  // the sign of the Q convention is folded into m_RotMat by initialize
   double qx = -m_ex * k_tr;
   double qy = -m_ey * k_tr;
   double qz = m_Ki - m_ez * k_tr;
 
-  if (convention == "Crystallography") {
-    qx = -qx;
-    qy = -qy;
-    qz = -qz;
-  }
-
   Coord[0] = static_cast<coord_t>(m_RotMat[0] * qx + m_RotMat[1] * qy +
                                   m_RotMat[2] * qz);
 
@@ -135,23 +133,13 @@ bool MDTransfQ3D::calcMatrixCoord3DElastic(const double &k0,
                                            double &signal,
                                            double &errSq) const {
 
+  // the sign of the Q convention is folded into m_RotMat by initialize
   double qx = -m_ex * k0;
   double qy = -m_ey * k0;
   double qz = (1 - m_ez) * k0;
-  if (convention == "Crystallography") {
-    qx = -qx;
-    qy = -qy;
-    qz = -qz;
-  }
 
-  // Dimension limits have to be converted to coord_t, otherwise floating point
-  // error will cause valid events to be discarded.
-  std::vector<coord_t> dim_min;
-  dim_min.reserve(m_DimMin.size());
-  std::copy(m_DimMin.cbegin(), m_DimMin.cend(), std::back_inserter(dim_min));
-  std::vector<coord_t> dim_max;
-  dim_max.reserve(m_DimMax.size());
-  std::copy(m_DimMax.cbegin(), m_DimMax.cend(), std::back_inserter(dim_max));
+  const coord_t *dim_min = m_DimMinCoord.data();
+  const coord_t *dim_max = m_DimMaxCoord.data();
 
   Coord[0] = static_cast<coord_t>(m_RotMat[0] * qx + m_RotMat[1] * qy +
                                   m_RotMat[2] * qz);
@@ -236,6 +224,12 @@ void MDTransfQ3D::initialize(const MDWSDescription &ConvParams) {
   // modes:
   // get transformation matrix (needed for CrystalAsPoder mode)
   m_RotMat = ConvParams.getTransfMatrix();
+  // Q is kf-ki rather than ki-kf in the Crystallography convention. Changing
+  // the sign of the matrix once saves doing it for every event.
+  if (convention == "Crystallography") {
+    std::transform(m_RotMat.begin(), m_RotMat.end(), m_RotMat.begin(),
+                   std::negate<double>());
+  }
 
   if (!ConvParams.m_PreprDetTable)
     throw(std::runtime_error("The detectors have not been preprocessed but "
@@ -247,6 +241,10 @@ void MDTransfQ3D::initialize(const MDWSDescription &ConvParams) {
 
   // get min and max values defined by the algorithm.
   ConvParams.getMinMax(m_DimMin, m_DimMax);
+  // Dimension limits have to be converted to coord_t for the elastic case,
+  // otherwise floating point error will cause valid events to be discarded.
+  m_DimMinCoord.assign(m_DimMin.cbegin(), m_DimMin.cend());
+  m_DimMaxCoord.assign(m_DimMax.cbegin(), m_DimMax.cend());
   // get additional coordinates which are
   m_AddDimCoordinates = ConvParams.getAddCoord();
 
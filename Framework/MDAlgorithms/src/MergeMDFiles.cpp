@@ -11,6 +11,7 @@
 #include "MantidDataObjects/MDBoxBase.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/VectorHelper.h"
@@ -34,7 +35,8 @@ DECLARE_ALGORITHM(MergeMDFiles)
 MergeMDFiles::MergeMDFiles()
     : m_nDims(0), m_MDEventType(), m_fileBasedTargetWS(false), m_Filenames(),
       m_EventLoader(), m_OutIWS(), m_totalEvents(0), m_totalLoaded(0),
-      m_fileMutex(), m_statsMutex() {}
+      m_fileMutex(), m_statsMutex(), m_writeBufferBytes(400000000),
+      m_maxEventsInMemory(10000000) {}
 
 //----------------------------------------------------------------------------------------------
 /** Destructor
@@ -153,39 +155,33 @@ void MergeMDFiles::loadBoxData() {
                  << " files.\n";
 }
 
-/** Task that loads all of the events from corresponded boxes of all files
- * that is being merged into a particular box in the output workspace.
+/** Read the events of the corresponding boxes of all the files that are
+ * merged into a box of the output workspace.
+ * @param targetBox :: the box of the output workspace
+ * @param table :: set to the events of all the files, one row per event as
+ * in the files
  */
-
-uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
-  /// get rid of the events and averages which are in the memory erroneously
-  /// (from cloning)
-  TargetBox->clear();
-
+void MergeMDFiles::readEventsOfBox(const API::IMDNode &targetBox,
+                                   std::vector<coord_t> &table) {
+  const size_t ID = targetBox.getID();
   uint64_t nBoxEvents(0);
-  std::vector<size_t> numFileEvents(m_EventLoader.size());
-
-  for (size_t iw = 0; iw < this->m_EventLoader.size(); iw++) {
-    size_t ID = TargetBox->getID();
-    numFileEvents[iw] = static_cast<size_t>(
-        m_fileComponentsStructure[iw].getEventIndex()[2 * ID + 1]);
-    nBoxEvents += numFileEvents[iw];
-  }
-
-  // At this point memory required is known, so it is reserved all in one go
-  TargetBox->reserveMemoryForLoad(nBoxEvents);
-
-  for (size_t iw = 0; iw < this->m_EventLoader.size(); iw++) {
-    size_t ID = TargetBox->getID();
-    uint64_t fileLocation =
-        m_fileComponentsStructure[iw].getEventIndex()[2 * ID + 0];
-    if (numFileEvents[iw] == 0)
+  for (auto &fileStructure : m_fileComponentsStructure)
+    nBoxEvents += fileStructure.getEventIndex()[2 * ID + 1];
+  table.clear();
+  if (nBoxEvents == 0)
+    return;
+
+  std::vector<coord_t> block;
+  for (size_t iw = 0; iw < m_EventLoader.size(); iw++) {
+    auto &eventIndex = m_fileComponentsStructure[iw].getEventIndex();
+    const auto numFileEvents = static_cast<size_t>(eventIndex[2 * ID + 1]);
+    if (numFileEvents == 0)
       continue;
-    TargetBox->loadAndAddFrom(m_EventLoader[iw], fileLocation,
-                              numFileEvents[iw]);
+    m_EventLoader[iw]->loadBlock(block, eventIndex[2 * ID], numFileEvents);
+    if (table.empty())
+      table.reserve(block.size() / numFileEvents * nBoxEvents);
+    table.insert(table.end(), block.begin(), block.end());
   }
-
-  return nBoxEvents;
 }
 
 //----------------------------------------------------------------------------------------------
@@ -202,8 +198,8 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
   m_OutIWS = ws;
   m_MDEventType = ws->getEventTypeName();
 
-  // Run the tasks in parallel? TODO: enable
-  // bool Parallel = this->getProperty("Parallel");
+  // Convert the boxes to events in parallel?
+  const bool parallel = this->getProperty("Parallel");
 
   // Fix the box controller settings in the output workspace so that it splits
   // normally
@@ -221,7 +217,8 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
     bc->setFileBacked(saver, outputFile);
     // Complete the file-back-end creation.
     g_log.notice() << "Setting cache to 400 MB write.\n";
-    bc->getFileIO()->setWriteBufferSize(400000000 / m_OutIWS->sizeofEvent());
+    bc->getFileIO()->setWriteBufferSize(m_writeBufferBytes /
+                                        m_OutIWS->sizeofEvent());
   }
 
   /*   else
@@ -243,12 +240,8 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
   // For tracking progress
   // uint64_t m_totalEventsInTasks = 0;
 
-  // Prepare thread pool
   CPUTimer overallTime;
 
-  auto ts = new ThreadSchedulerFIFO();
-  ThreadPool tp(ts);
-
   Kernel::DiskBuffer *DiskBuf(nullptr);
   if (m_fileBasedTargetWS) {
     DiskBuf = bc->getFileIO();
@@ -256,49 +249,65 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
 
   this->m_totalLoaded = 0;
   std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
+  const std::vector<uint64_t> &targetEventIndexes = m_BoxStruct.getEventIndex();
+
+  // HDF5 is not thread safe across files, so the input files are read and
+  // the output file is written on this thread only. The boxes are merged in
+  // chunks of about m_maxEventsInMemory events: the events of a chunk are
+  // read from all the files, converted into the boxes in parallel, and then,
+  // if the output is file backed, saved and cleared from memory.
+  size_t chunkBegin = 0;
+  while (chunkBegin < numBoxes) {
+    size_t chunkEnd = chunkBegin;
+    uint64_t chunkEvents = 0;
+    while (chunkEnd < numBoxes &&
+           (chunkEnd == chunkBegin || chunkEvents < m_maxEventsInMemory)) {
+      if (boxes[chunkEnd]->isBox())
+        chunkEvents += targetEventIndexes[2 * boxes[chunkEnd]->getID() + 1];
+      ++chunkEnd;
+    }
 
-  for (size_t ib = 0; ib < numBoxes; ib++) {
-    auto box = boxes[ib];
-    if (!box->isBox())
-      continue;
-    // load all contributed events into current box;
-    this->loadEventsFromSubBoxes(boxes[ib]);
+    std::vector<std::vector<coord_t>> tables(chunkEnd - chunkBegin);
+    for (size_t ib = chunkBegin; ib < chunkEnd; ++ib) {
+      if (boxes[ib]->isBox())
+        readEventsOfBox(*boxes[ib], tables[ib - chunkBegin]);
+    }
+
+    PRAGMA_OMP(parallel for schedule(dynamic) if (parallel))
+    for (int64_t ib = static_cast<int64_t>(chunkBegin);
+         ib < static_cast<int64_t>(chunkEnd); ib++) {
+      PARALLEL_START_INTERUPT_REGION
+      auto box = boxes[ib];
+      if (box->isBox()) {
+        // get rid of the events and averages left from cloning
+        box->clear();
+        auto &table = tables[ib - chunkBegin];
+        if (!table.empty())
+          box->setEventsData(table);
+        std::vector<coord_t>().swap(table);
+      }
+      m_progress->report("Loading and merging box data");
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
 
+    // data positions have been already pre-calculated
     if (DiskBuf) {
-      if (box->getDataInMemorySize() >
-          0) { // data position has been already pre-calculated
-        box->getISaveable()->save();
-        box->clearDataFromMemory();
-        // Kernel::ISaveable *Saver = box->getISaveable();
-        // DiskBuf->toWrite(Saver);
+      for (size_t ib = chunkBegin; ib < chunkEnd; ++ib) {
+        auto box = boxes[ib];
+        if (box->isBox() && box->getDataInMemorySize() > 0) {
+          box->getISaveable()->save();
+          box->clearDataFromMemory();
+        }
       }
     }
-    // else
-    //{   size_t ID = box->getID();
-    //    uint64_t filePosition = targetEventIndexes[2*ID];
-    //    box->saveAt(saver.get(), filePosition);
-    //}
-    //
-    // if (!Parallel)
-    //{
-    //  // Run the task serially only
-    //  task->run();
-    //  delete task;
-    //}
-    // else
-    //{
-    //  // Enqueue to run in parallel (at the joinAll() call below).
-    //  ts->push(task);
-    //}
-
-    m_progress->reportIncrement(ib, "Loading and merging box data");
+    interruption_point();
+    chunkBegin = chunkEnd;
   }
   if (DiskBuf) {
     DiskBuf->flushCache();
     bc->getFileIO()->flushData();
   }
-  //// Run any final tasks
-  // tp.joinAll();
   g_log.information() << overallTime << " to do all the adding.\n";
 
   // Close any open file handle
@@ -82,6 +82,13 @@ void SaveMD::init() {
   setPropertySettings("MakeFileBacked",
                       std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
                                                             IS_EQUAL_TO, "0"));
+  declareProperty("Compress", false,
+                  "For an MDEventWorkspace saved to a new file, not made "
+                  "file-backed:\n"
+                  "Compress the events in the file. The file is smaller but "
+                  "slower to write.");
+  setPropertySettings("Compress", std::make_unique<EnabledWhenProperty>(
+                                      "MakeFileBacked", IS_EQUAL_TO, "0"));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -165,8 +172,12 @@ void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     // the boxes file positions are unknown and we need to calculate it.
     BoxFlatStruct.initFlatStructure(ws, filename);
     // create saver class
-    auto Saver = boost::shared_ptr<API::IBoxControllerIO>(
-        new DataObjects::BoxControllerNeXusIO(bc.get()));
+    auto nexusIO = new DataObjects::BoxControllerNeXusIO(bc.get());
+    // A file back end is written box by box, compressed data would be
+    // compressed again at every write
+    const bool compress = getProperty("Compress");
+    nexusIO->setCompression(compress && !makeFileBackend);
+    auto Saver = boost::shared_ptr<API::IBoxControllerIO>(nexusIO);
     Saver->setDataType(sizeof(coord_t), MDE::getTypeName());
     if (makeFileBackend) {
       // store saver with box controller
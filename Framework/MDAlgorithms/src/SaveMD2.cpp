@@ -70,6 +70,13 @@ void SaveMD2::init() {
   setPropertySettings("MakeFileBacked",
                       std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
                                                             IS_EQUAL_TO, "0"));
+  declareProperty("Compress", false,
+                  "For an MDEventWorkspace saved to a new file, not made "
+                  "file-backed:\n"
+                  "Compress the events in the file. The file is smaller but "
+                  "slower to write.");
+  setPropertySettings("Compress", std::make_unique<EnabledWhenProperty>(
+                                      "MakeFileBacked", IS_EQUAL_TO, "0"));
   declareProperty(
       "SaveHistory", true,
       "Option to not save the Mantid history in the file. Only for MDHisto");
@@ -236,6 +243,7 @@ void SaveMD2::exec() {
                                 getProperty("UpdateFileBackEnd"));
     saveMDv1->setProperty<bool>("MakeFileBacked",
                                 getProperty("MakeFileBacked"));
+    saveMDv1->setProperty<bool>("Compress", getProperty("Compress"));
     saveMDv1->execute();
   } else if (histoWS) {
     this->doSaveHisto(histoWS);
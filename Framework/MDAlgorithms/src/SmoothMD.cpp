@@ -5,11 +5,9 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/SmoothMD.h"
-#include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/IMDHistoWorkspace.h"
-#include "MantidAPI/IMDIterator.h"
 #include "MantidAPI/Progress.h"
-#include "MantidDataObjects/MDHistoWorkspaceIterator.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidKernel/ArrayBoundedValidator.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/CompositeValidator.h"
@@ -21,6 +19,8 @@
 #include <boost/function.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/tuple/tuple.hpp>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <numeric>
@@ -167,9 +167,103 @@ const std::string SmoothMD::summary() const {
   return "Smooth an MDHistoWorkspace according to a weight function";
 }
 
+namespace {
+/// Number of neighbouring lines smoothed together by one thread
+const size_t LINES_PER_BLOCK = 64;
+
+/// What to do with each bin of the workspace
+enum class BinStatus : uint8_t { Smooth, Masked, Unmeasured };
+
+/**
+ * Find which bins are smoothed. Masked bins keep their values, bins
+ * where nothing was measured, according to the weighting workspace, are set
+ * to NaN.
+ * @param toSmooth : Workspace to smooth
+ * @param weightingWS : Weighting workspace (optional)
+ * @return the status of each bin
+ */
+std::vector<BinStatus>
+binStatuses(const IMDHistoWorkspace &toSmooth,
+            const OptionalIMDHistoWorkspace_const_sptr &weightingWS) {
+  const auto nPoints = static_cast<size_t>(toSmooth.getNPoints());
+  std::vector<BinStatus> statuses(nPoints, BinStatus::Smooth);
+  const auto histo = dynamic_cast<const MDHistoWorkspace *>(&toSmooth);
+  const signal_t *weights =
+      weightingWS ? (*weightingWS)->getSignalArray() : nullptr;
+  for (size_t i = 0; i < nPoints; ++i) {
+    if (histo && histo->getIsMaskedAt(i))
+      statuses[i] = BinStatus::Masked;
+    else if (weights && weights[i] == 0)
+      statuses[i] = BinStatus::Unmeasured;
+  }
+  return statuses;
+}
+
+/// @return the number of bins along each dimension of a workspace
+std::vector<size_t> binsPerDimension(const IMDHistoWorkspace &ws) {
+  std::vector<size_t> nBins;
+  for (size_t d = 0; d < ws.getNumDims(); ++d)
+    nBins.push_back(ws.getDimension(d)->getNBins());
+  return nBins;
+}
+
+/**
+ * Call a function on every line of bins along one dimension, in parallel.
+ * The lines are grouped in blocks of neighbouring lines, which are
+ * interleaved in memory, so that the innermost loops of the function run over
+ * contiguous bins. The bin at position p of line l of a block is at
+ * first + p * stride + l.
+ * @param nBins : number of bins along each dimension
+ * @param dimension : dimension of the lines
+ * @param lineBlock : function called with (first, numLines, stride, length)
+ */
+template <typename LineBlockFunction>
+void forEachLineBlock(const std::vector<size_t> &nBins, const size_t dimension,
+                      const LineBlockFunction &lineBlock) {
+  size_t stride = 1;
+  for (size_t d = 0; d < dimension; ++d)
+    stride *= nBins[d];
+  const size_t length = nBins[dimension];
+  size_t numOuter = 1;
+  for (size_t d = dimension + 1; d < nBins.size(); ++d)
+    numOuter *= nBins[d];
+  const size_t blocksPerOuter =
+      (stride + LINES_PER_BLOCK - 1) / LINES_PER_BLOCK;
+  const auto numBlocks = static_cast<int64_t>(numOuter * blocksPerOuter);
+
+  PRAGMA_OMP(parallel for schedule(dynamic))
+  for (int64_t block = 0; block < numBlocks; ++block) {
+    const size_t outer = static_cast<size_t>(block) / blocksPerOuter;
+    const size_t firstLine =
+        (static_cast<size_t>(block) % blocksPerOuter) * LINES_PER_BLOCK;
+    const size_t numLines = std::min(LINES_PER_BLOCK, stride - firstLine);
+    lineBlock(outer * stride * length + firstLine, numLines, stride, length);
+  }
+}
+
+/**
+ * Copy a block of lines out of a workspace array
+ * @param data : the array
+ * @param first, numLines, stride, length : the block, see forEachLineBlock
+ * @return the values, position by position
+ */
+std::vector<signal_t> copyLines(const signal_t *data, const size_t first,
+                                const size_t numLines, const size_t stride,
+                                const size_t length) {
+  std::vector<signal_t> lines(numLines * length);
+  for (size_t p = 0; p < length; ++p)
+    std::copy_n(data + first + p * stride, numLines,
+                lines.begin() + p * numLines);
+  return lines;
+}
+} // namespace
+
 /**
  * Hat function smoothing. All weights even. Hat function boundaries beyond
  * width.
+ * The sum over the hat is separable: it is computed as a sum over the width
+ * in each dimension in turn, so that the cost grows with the sum rather than
+ * the product of the widths.
  * @param toSmooth : Workspace to smooth
  * @param widthVector : Width vector
  * @param weightingWS : Weighting workspace (optional)
@@ -181,87 +275,102 @@ SmoothMD::hatSmooth(IMDHistoWorkspace_const_sptr toSmooth,
                     OptionalIMDHistoWorkspace_const_sptr weightingWS) {
 
   const bool useWeights = weightingWS.is_initialized();
-  uint64_t nPoints = toSmooth->getNPoints();
-  Progress progress(this, 0.0, 1.0, size_t(double(nPoints) * 1.1));
+  const auto nPoints = static_cast<size_t>(toSmooth->getNPoints());
+  const auto nBins = binsPerDimension(*toSmooth);
+  Progress progress(this, 0.0, 1.0, nBins.size() + 2);
   // Create the output workspace.
   IMDHistoWorkspace_sptr outWS(toSmooth->clone());
-  progress.reportIncrement(
-      size_t(double(nPoints) * 0.1)); // Report ~10% progress
-
-  const int nThreads = Mantid::API::FrameworkManager::Instance()
-                           .getNumOMPThreads(); // NThreads to Request
-
-  auto iterators = toSmooth->createIterators(nThreads, nullptr);
-
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int it = 0; it < int(iterators.size()); ++it) { // NOLINT
-
-    PARALLEL_START_INTERUPT_REGION
-    auto iterator =
-        dynamic_cast<MDHistoWorkspaceIterator *>(iterators[it].get());
-
-    if (!iterator) {
-      throw std::logic_error(
-          "Failed to cast IMDIterator to MDHistoWorkspaceIterator");
+  const auto statuses = binStatuses(*toSmooth, weightingWS);
+  progress.report();
+
+  const signal_t *inSignals = toSmooth->getSignalArray();
+  const signal_t *inErrors = toSmooth->getErrorSquaredArray();
+  const signal_t *weights =
+      useWeights ? (*weightingWS)->getSignalArray() : nullptr;
+
+  // Sum the signals, the squared errors and, with weights, the number of
+  // measured bins in place. Bins where nothing was measured do not
+  // contribute to their neighbours.
+  signal_t *sumSignals = outWS->getSignalArray();
+  signal_t *sumErrors = outWS->getErrorSquaredArray();
+  std::vector<signal_t> counts;
+  if (useWeights) {
+    counts.resize(nPoints);
+    for (size_t i = 0; i < nPoints; ++i) {
+      const bool measured = weights[i] != 0;
+      sumSignals[i] = measured ? inSignals[i] : 0.;
+      sumErrors[i] = measured ? inErrors[i] : 0.;
+      counts[i] = measured ? 1. : 0.;
     }
+  }
 
-    do {
-      // Gets all vertex-touching neighbours
-      size_t iteratorIndex = iterator->getLinearIndex();
-
-      if (useWeights) {
-
-        // Check that we could measure here.
-        if ((*weightingWS)->getSignalAt(iteratorIndex) == 0) {
-
-          outWS->setSignalAt(iteratorIndex,
-                             std::numeric_limits<double>::quiet_NaN());
-          outWS->setErrorSquaredAt(iteratorIndex,
-                                   std::numeric_limits<double>::quiet_NaN());
-
-          continue; // Skip we couldn't measure here.
-        }
-      }
-
-      // Explicitly cast the doubles to int
-      // We've already checked in the validator that the doubles we have are odd
-      // integer values and well below max int
-      std::vector<int> widthVectorInt;
-      widthVectorInt.reserve(widthVector.size());
-      std::copy(widthVector.cbegin(), widthVector.cend(),
-                std::back_inserter(widthVectorInt));
-
-      std::vector<size_t> neighbourIndexes =
-          iterator->findNeighbourIndexesByWidth(widthVectorInt);
-
-      size_t nNeighbours = neighbourIndexes.size();
-      double sumSignal = iterator->getSignal();
-      double sumSqError = iterator->getError();
-      for (auto neighbourIndex : neighbourIndexes) {
-        if (useWeights) {
-          if ((*weightingWS)->getSignalAt(neighbourIndex) == 0) {
-            // Nothing measured here. We cannot use that neighbouring point.
-            nNeighbours -= 1;
-            continue;
+  std::vector<size_t> halfWidths;
+  for (size_t d = 0; d < nBins.size(); ++d) {
+    // We've already checked in the validator that the widths are odd
+    // integer values and well below max int
+    halfWidths.push_back(static_cast<size_t>(widthVector[d]) / 2);
+    const size_t halfWidth = halfWidths.back();
+    std::vector<signal_t *> arrays{sumSignals, sumErrors};
+    if (useWeights)
+      arrays.push_back(counts.data());
+
+    forEachLineBlock(nBins, d, [&](const size_t first, const size_t numLines,
+                                   const size_t stride, const size_t length) {
+      for (auto array : arrays) {
+        const auto lines = copyLines(array, first, numLines, stride, length);
+        for (size_t p = 0; p < length; ++p) {
+          const size_t lo = p > halfWidth ? p - halfWidth : 0;
+          const size_t hi = std::min(length - 1, p + halfWidth);
+          signal_t *out = array + first + p * stride;
+          std::fill_n(out, numLines, 0.);
+          for (size_t q = lo; q <= hi; ++q) {
+            const signal_t *in = lines.data() + q * numLines;
+            for (size_t l = 0; l < numLines; ++l)
+              out[l] += in[l];
           }
         }
-        sumSignal += toSmooth->getSignalAt(neighbourIndex);
-        double error = toSmooth->getErrorAt(neighbourIndex);
-        sumSqError += (error * error);
       }
+    });
+    progress.report();
+  }
 
-      // Calculate the mean
-      outWS->setSignalAt(iteratorIndex, sumSignal / double(nNeighbours + 1));
-      // Calculate the sample variance
-      outWS->setErrorSquaredAt(iteratorIndex,
-                               sumSqError / double(nNeighbours + 1));
-
-      progress.report();
-
-    } while (iterator->next());
-    PARALLEL_END_INTERUPT_REGION
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(nPoints); ++i) { // NOLINT
+    const auto index = static_cast<size_t>(i);
+    if (statuses[index] == BinStatus::Masked) {
+      sumSignals[index] = inSignals[index];
+      sumErrors[index] = inErrors[index];
+      continue;
+    }
+    if (statuses[index] == BinStatus::Unmeasured) {
+      sumSignals[index] = std::numeric_limits<double>::quiet_NaN();
+      sumErrors[index] = std::numeric_limits<double>::quiet_NaN();
+      continue;
+    }
+    double count;
+    if (useWeights) {
+      count = counts[index];
+    } else {
+      // Number of bins of the hat within the workspace
+      count = 1.;
+      size_t remainder = index;
+      for (size_t d = 0; d < nBins.size(); ++d) {
+        const size_t p = remainder % nBins[d];
+        remainder /= nBins[d];
+        const size_t lo = p > halfWidths[d] ? p - halfWidths[d] : 0;
+        const size_t hi = std::min(nBins[d] - 1, p + halfWidths[d]);
+        count *= static_cast<double>(hi - lo + 1);
+      }
+    }
+    // Calculate the mean
+    sumSignals[index] /= count;
+    // Calculate the sample variance. As before, the bin itself contributes
+    // its error rather than its squared error.
+    sumErrors[index] =
+        (sumErrors[index] - inErrors[index] + std::sqrt(inErrors[index])) /
+        count;
   }
-  PARALLEL_CHECK_INTERUPT_REGION
+  progress.report();
 
   return outWS;
 }
@@ -282,106 +391,78 @@ SmoothMD::gaussianSmooth(IMDHistoWorkspace_const_sptr toSmooth,
                          const WidthVector &widthVector,
                          OptionalIMDHistoWorkspace_const_sptr weightingWS) {
 
-  const bool useWeights = weightingWS.is_initialized();
-  uint64_t nPoints = toSmooth->getNPoints();
-  Progress progress(this, 0.0, 1.0, size_t(double(nPoints) * 1.1));
-  // Create the output workspace
+  const auto nBins = binsPerDimension(*toSmooth);
+  Progress progress(this, 0.0, 1.0, nBins.size() + 1);
+  // Create the output workspace, which is smoothed in place
   IMDHistoWorkspace_sptr outWS(toSmooth->clone().release());
-  // Create a temporary workspace
-  IMDHistoWorkspace_sptr tempWS(toSmooth->clone().release());
-  // Report ~10% progress
-  progress.reportIncrement(size_t(double(nPoints) * 0.1));
-
-  // Create a kernel for each dimension and
-  std::vector<KernelVector> gaussian_kernels;
-  gaussian_kernels.reserve(widthVector.size());
-  for (const auto width : widthVector) {
-    gaussian_kernels.emplace_back(gaussianKernel(width));
-  }
+  const auto statuses = binStatuses(*toSmooth, weightingWS);
+  progress.report();
 
-  const int nThreads = Mantid::API::FrameworkManager::Instance()
-                           .getNumOMPThreads(); // NThreads to Request
+  signal_t *signals = outWS->getSignalArray();
+  signal_t *errors = outWS->getErrorSquaredArray();
 
-  auto write_ws = tempWS;
-  for (size_t dimension_number = 0; dimension_number < widthVector.size();
+  for (size_t dimension_number = 0; dimension_number < nBins.size();
        ++dimension_number) {
-
-    auto iterators = toSmooth->createIterators(nThreads, nullptr);
-
-    // Alternately write to each workspace
-    IMDHistoWorkspace_sptr read_ws;
-    if (dimension_number % 2 == 0) {
-      read_ws = outWS;
-      write_ws = tempWS;
-    } else {
-      read_ws = tempWS;
-      write_ws = outWS;
-    }
-
-    PARALLEL_FOR_NO_WSP_CHECK()
-    for (int it = 0; it < int(iterators.size()); ++it) { // NOLINT
-
-      PARALLEL_START_INTERUPT_REGION
-      auto iterator =
-          dynamic_cast<MDHistoWorkspaceIterator *>(iterators[it].get());
-      if (!iterator) {
-        throw std::logic_error(
-            "Failed to cast IMDIterator to MDHistoWorkspaceIterator");
-      }
-
-      do {
-
-        // Gets linear index at current position
-        size_t iteratorIndex = iterator->getLinearIndex();
-
-        if (useWeights) {
-
-          // Check that we could measure here.
-          if ((*weightingWS)->getSignalAt(iteratorIndex) == 0) {
-
-            write_ws->setSignalAt(iteratorIndex,
-                                  std::numeric_limits<double>::quiet_NaN());
-            write_ws->setErrorSquaredAt(
-                iteratorIndex, std::numeric_limits<double>::quiet_NaN());
-
-            continue; // Skip we couldn't measure here.
-          }
+    const auto kernel = gaussianKernel(widthVector[dimension_number]);
+    const size_t halfWidth = kernel.size() / 2;
+
+    forEachLineBlock(nBins, dimension_number, [&](const size_t first,
+                                                  const size_t numLines,
+                                                  const size_t stride,
+                                                  const size_t length) {
+      const auto lineSignals =
+          copyLines(signals, first, numLines, stride, length);
+      const auto lineErrors =
+          copyLines(errors, first, numLines, stride, length);
+      std::vector<signal_t> sumSignal(numLines);
+      std::vector<signal_t> sumSquareError(numLines);
+      for (size_t p = 0; p < length; ++p) {
+        // Renormalise the kernel where it overlaps the edges of the workspace
+        const size_t lo = p > halfWidth ? p - halfWidth : 0;
+        const size_t hi = std::min(length - 1, p + halfWidth);
+        double scale = 1.;
+        if (hi - lo + 1 < kernel.size()) {
+          double sum = 0.;
+          for (size_t q = lo; q <= hi; ++q)
+            sum += kernel[q + halfWidth - p];
+          scale = 1. / sum;
         }
 
-        std::pair<std::vector<size_t>, std::vector<bool>> indexesAndValidity =
-            iterator->findNeighbourIndexesByWidth1D(
-                static_cast<int>(gaussian_kernels[dimension_number].size()),
-                static_cast<int>(dimension_number));
-        std::vector<size_t> neighbourIndexes = std::get<0>(indexesAndValidity);
-        std::vector<bool> indexValidity = std::get<1>(indexesAndValidity);
-        auto normalised_kernel = renormaliseKernel(
-            gaussian_kernels[dimension_number], indexValidity);
-
         // Convolve signal with kernel
-        double sumSignal = 0;
-        double sumSquareError = 0;
-        double error = 0;
-        for (size_t i = 0; i < neighbourIndexes.size(); ++i) {
-          if (indexValidity[i]) {
-            sumSignal += read_ws->getSignalAt(neighbourIndexes[i]) *
-                         normalised_kernel[i];
-            error =
-                read_ws->getErrorAt(neighbourIndexes[i]) * normalised_kernel[i];
-            sumSquareError += error * error;
+        std::fill(sumSignal.begin(), sumSignal.end(), 0.);
+        std::fill(sumSquareError.begin(), sumSquareError.end(), 0.);
+        for (size_t q = lo; q <= hi; ++q) {
+          const double weight = kernel[q + halfWidth - p] * scale;
+          const double weightSquared = weight * weight;
+          const signal_t *inSignal = lineSignals.data() + q * numLines;
+          const signal_t *inError = lineErrors.data() + q * numLines;
+          for (size_t l = 0; l < numLines; ++l) {
+            sumSignal[l] += inSignal[l] * weight;
+            sumSquareError[l] += inError[l] * weightSquared;
           }
-
-          write_ws->setSignalAt(iteratorIndex, sumSignal);
-          write_ws->setErrorSquaredAt(iteratorIndex, sumSquareError);
         }
-        progress.report();
 
-      } while (iterator->next());
-      PARALLEL_END_INTERUPT_REGION
-    }
-    PARALLEL_CHECK_INTERUPT_REGION
+        const size_t offset = first + p * stride;
+        for (size_t l = 0; l < numLines; ++l) {
+          switch (statuses[offset + l]) {
+          case BinStatus::Smooth:
+            signals[offset + l] = sumSignal[l];
+            errors[offset + l] = sumSquareError[l];
+            break;
+          case BinStatus::Unmeasured:
+            signals[offset + l] = std::numeric_limits<double>::quiet_NaN();
+            errors[offset + l] = std::numeric_limits<double>::quiet_NaN();
+            break;
+          case BinStatus::Masked:
+            break;
+          }
+        }
+      }
+    });
+    progress.report();
   }
 
-  return write_ws;
+  return outWS;
 }
 
 //----------------------------------------------------------------------------------------------
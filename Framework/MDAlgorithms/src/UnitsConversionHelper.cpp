@@ -338,6 +338,36 @@ double UnitsConversionHelper::convertUnits(double val) const {
         "updateConversion: unknown type of conversion requested");
   }
 }
+/** do actual unit conversion from input to output data on a whole array,
+which avoids the virtual calls per value made by convertUnits(double)
+@param   vals -- the input values, converted in place into the units requested
+*/
+void UnitsConversionHelper::convertUnits(std::vector<double> &vals) const {
+  double *first = vals.data();
+  double *last = first + vals.size();
+  switch (m_UnitCnvrsn) {
+  case (CnvrtToMD::ConvertNo): {
+    return;
+  }
+  case (CnvrtToMD::ConvertFast): {
+    for (auto val = first; val != last; ++val)
+      *val = m_Factor * std::pow(*val, m_Power);
+    return;
+  }
+  case (CnvrtToMD::ConvertFromTOF): {
+    m_TargetUnit->fromTOFRange(first, last);
+    return;
+  }
+  case (CnvrtToMD::ConvertByTOF): {
+    m_SourceWSUnit->toTOFRange(first, last);
+    m_TargetUnit->fromTOFRange(first, last);
+    return;
+  }
+  default:
+    throw std::runtime_error(
+        "updateConversion: unknown type of conversion requested");
+  }
+}
 // copy constructor;
 UnitsConversionHelper::UnitsConversionHelper(
     const UnitsConversionHelper &another) {
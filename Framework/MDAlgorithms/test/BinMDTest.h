@@ -298,6 +298,105 @@ public:
                  true /*IterateEvents*/, 20 /*numEventsPerBox*/, VMD(0, 0, 1));
   }
 
+  /** Bin a workspace, with recursively split boxes, into bins large enough
+   * to hold entire grid boxes. The grid boxes within a single bin are binned
+   * at once, the others event by event. The result is compared with the
+   * events counted one by one.
+   */
+  void do_test_gridBoxesCompletelyContained(const bool axisAligned,
+                                            const bool fileBacked = false) {
+    auto in_ws = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0, 0);
+    in_ws->getBoxController()->setSplitThreshold(50);
+    AnalysisDataService::Instance().addOrReplace("BinMDTest_ws", in_ws);
+    FrameworkManager::Instance().exec("FakeMDEventData", 4, "InputWorkspace",
+                                      "BinMDTest_ws", "UniformParams",
+                                      "20000");
+    TS_ASSERT_EQUALS(in_ws->getNPoints(), 20000);
+
+    // Count the events in each 5.75 wide bin, from -1, in X and Y
+    std::vector<double> expected(4, 0.0);
+    std::vector<IMDNode *> boxes;
+    in_ws->getBox()->getBoxes(boxes, 1000, true);
+    for (auto node : boxes) {
+      auto box = dynamic_cast<MDBox<MDLeanEvent<3>, 3> *>(node);
+      TS_ASSERT(box);
+      if (!box)
+        continue;
+      for (const auto &event : box->getConstEvents()) {
+        const auto ix = static_cast<size_t>((event.getCenter(0) + 1.) / 5.75);
+        const auto iy = static_cast<size_t>((event.getCenter(1) + 1.) / 5.75);
+        expected[ix + 2 * iy] += event.getSignal();
+      }
+      box->releaseEvents();
+    }
+
+    // A file-backed workspace has its boxes sorted by ID, which separates
+    // the children of a grid box from it.
+    std::string inputName("BinMDTest_ws");
+    std::string filename;
+    if (fileBacked) {
+      filename = saveWorkspace(in_ws);
+      inputName = loadFileBackWorkspace(filename);
+    }
+
+    BinMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("InputWorkspace", inputName));
+    if (axisAligned) {
+      TS_ASSERT_THROWS_NOTHING(
+          alg.setPropertyValue("AlignedDim0", "Axis0,-1.0,10.5,2"));
+      TS_ASSERT_THROWS_NOTHING(
+          alg.setPropertyValue("AlignedDim1", "Axis1,-1.0,10.5,2"));
+    } else {
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("AxisAligned", false));
+      TS_ASSERT_THROWS_NOTHING(
+          alg.setPropertyValue("BasisVector0", "OutX,m,1,0,0"));
+      TS_ASSERT_THROWS_NOTHING(
+          alg.setPropertyValue("BasisVector1", "OutY,m,0,1,0"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Translation", "0,0,0"));
+      TS_ASSERT_THROWS_NOTHING(
+          alg.setProperty("OutputExtents", "-1,10.5, -1,10.5"));
+      TS_ASSERT_THROWS_NOTHING(
+          alg.setProperty("OutputBins", std::vector<int>{2, 2}));
+    }
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("OutputWorkspace", "BinMDTest_histo"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute();)
+    TS_ASSERT(alg.isExecuted());
+
+    MDHistoWorkspace_sptr out;
+    TS_ASSERT_THROWS_NOTHING(
+        out = boost::dynamic_pointer_cast<MDHistoWorkspace>(
+            AnalysisDataService::Instance().retrieve("BinMDTest_histo"));)
+    TS_ASSERT(out);
+    if (!out)
+      return;
+    TS_ASSERT_EQUALS(out->getNPoints(), 4);
+    for (size_t i = 0; i < 4; i++) {
+      TS_ASSERT_DELTA(out->getSignalAt(i), expected[i], 1e-5);
+      TS_ASSERT_DELTA(out->getNumEventsAt(i), expected[i], 1e-5);
+    }
+    AnalysisDataService::Instance().remove("BinMDTest_ws");
+    AnalysisDataService::Instance().remove("BinMDTest_histo");
+    if (fileBacked) {
+      AnalysisDataService::Instance().remove(inputName);
+      if (Poco::File(filename).exists())
+        Poco::File(filename).remove();
+    }
+  }
+
+  void test_exec_2D_gridBoxesCompletelyContained() {
+    do_test_gridBoxesCompletelyContained(true);
+  }
+
+  void test_exec_2D_gridBoxesCompletelyContained_fileBacked() {
+    do_test_gridBoxesCompletelyContained(true, true);
+  }
+
+  void test_exec_2D_gridBoxesCompletelyContained_withTransform() {
+    do_test_gridBoxesCompletelyContained(false);
+  }
+
   bool etta(int x, int base) {
     int ii = x - base / 2;
     if (ii < 0)
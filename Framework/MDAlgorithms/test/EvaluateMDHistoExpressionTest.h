@@ -0,0 +1,177 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_MDALGORITHMS_EVALUATEMDHISTOEXPRESSIONTEST_H_
+#define MANTID_MDALGORITHMS_EVALUATEMDHISTOEXPRESSIONTEST_H_
+
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/Run.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidMDAlgorithms/EvaluateMDHistoExpression.h"
+#include "MantidTestHelpers/MDEventsTestHelper.h"
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using namespace Mantid::MDAlgorithms;
+
+using Mantid::signal_t;
+
+class EvaluateMDHistoExpressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EvaluateMDHistoExpressionTest *createSuite() {
+    return new EvaluateMDHistoExpressionTest();
+  }
+  static void destroySuite(EvaluateMDHistoExpressionTest *suite) {
+    delete suite;
+  }
+
+  EvaluateMDHistoExpressionTest() {
+    FrameworkManager::Instance();
+    // Different values in every bin, with 2500 bins to use several blocks
+    auto &ads = AnalysisDataService::Instance();
+    for (const std::string name : {"data", "background", "norm"}) {
+      auto ws = MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 2, 50);
+      const double offset = static_cast<double>(name.size());
+      for (size_t i = 0; i < ws->getNPoints(); ++i) {
+        ws->setSignalAt(i, offset + static_cast<double>(i % 7));
+        ws->setErrorSquaredAt(i, 0.5 * offset + static_cast<double>(i % 3));
+        ws->setNumEventsAt(i, offset);
+      }
+      ads.addOrReplace(name, ws);
+    }
+  }
+
+  ~EvaluateMDHistoExpressionTest() override {
+    AnalysisDataService::Instance().clear();
+  }
+
+  void test_Init() {
+    EvaluateMDHistoExpression alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_compile_follows_precedence() {
+    using Operation = EvaluateMDHistoExpression::Operation;
+    const auto program = EvaluateMDHistoExpression::compile(
+        "-a + b * (c - 2.5e-1) / a", {"a", "b", "c"});
+    const std::vector<Operation> expected{
+        Operation::Workspace, Operation::Negate,   Operation::Workspace,
+        Operation::Workspace, Operation::Constant, Operation::Subtract,
+        Operation::Multiply,  Operation::Workspace, Operation::Divide,
+        Operation::Add};
+    TS_ASSERT_EQUALS(program.size(), expected.size());
+    for (size_t i = 0; i < std::min(program.size(), expected.size()); ++i)
+      TS_ASSERT(program[i].operation == expected[i]);
+    TS_ASSERT_EQUALS(program[3].index, 2);
+    TS_ASSERT_DELTA(program[4].value, 0.25, 1e-12);
+  }
+
+  void test_compile_rejects_invalid_expressions() {
+    const std::vector<std::string> names{"a", "b"};
+    for (const std::string expression :
+         {"", "a +", "(a + b", "a b", "a + c", "a % b", "2 * )"})
+      TS_ASSERT_THROWS(EvaluateMDHistoExpression::compile(expression, names),
+                       const std::invalid_argument &);
+  }
+
+  void test_matches_the_binary_operations() {
+    const auto expression = "(data - background) / norm * 2 + data";
+    auto result = run(expression, "result");
+    TS_ASSERT(result);
+    if (!result)
+      return;
+
+    // The same expression, one operation at a time
+    auto &ads = AnalysisDataService::Instance();
+    auto expected = ads.retrieveWS<MDHistoWorkspace>("data")->clone();
+    expected->subtract(*ads.retrieveWS<MDHistoWorkspace>("background"));
+    expected->divide(*ads.retrieveWS<MDHistoWorkspace>("norm"));
+    expected->multiply(2., 0.);
+    expected->add(*ads.retrieveWS<MDHistoWorkspace>("data"));
+
+    for (size_t i = 0; i < expected->getNPoints(); ++i) {
+      TS_ASSERT_DELTA(result->getSignalAt(i), expected->getSignalAt(i), 1e-10);
+      TS_ASSERT_DELTA(result->getErrorAt(i), expected->getErrorAt(i), 1e-10);
+      TS_ASSERT_DELTA(result->getNumEventsAt(i), expected->getNumEventsAt(i),
+                      1e-10);
+    }
+    TS_ASSERT_EQUALS(result->getExperimentInfo(0)->run().getPropertyValueAsType<
+                         std::string>("mdhisto_was_modified"),
+                     "1");
+    // The inputs are left untouched
+    TS_ASSERT_DELTA(ads.retrieveWS<MDHistoWorkspace>("data")->getSignalAt(8),
+                    5., 1e-12);
+  }
+
+  void test_negation_and_constant_on_the_left() {
+    auto result = run("2 * -data", "result");
+    TS_ASSERT(result);
+    if (!result)
+      return;
+    auto data =
+        AnalysisDataService::Instance().retrieveWS<MDHistoWorkspace>("data");
+    for (size_t i = 0; i < data->getNPoints(); i += 97) {
+      TS_ASSERT_DELTA(result->getSignalAt(i), -2. * data->getSignalAt(i),
+                      1e-12);
+      TS_ASSERT_DELTA(result->getErrorAt(i), 2. * data->getErrorAt(i), 1e-12);
+      TS_ASSERT_DELTA(result->getNumEventsAt(i), data->getNumEventsAt(i),
+                      1e-12);
+    }
+  }
+
+  void test_in_place() {
+    auto &ads = AnalysisDataService::Instance();
+    auto norm = ads.retrieveWS<MDHistoWorkspace>("norm")->clone();
+    ads.addOrReplace("inplace", MDHistoWorkspace_sptr(std::move(norm)));
+    auto before = ads.retrieveWS<MDHistoWorkspace>("inplace");
+    const double signal = before->getSignalAt(10);
+
+    auto result = run("inplace * inplace", "inplace",
+                      {"data", "background", "norm", "inplace"});
+    TS_ASSERT_EQUALS(result, before);
+    TS_ASSERT_DELTA(result->getSignalAt(10), signal * signal, 1e-12);
+    ads.remove("inplace");
+  }
+
+  void test_inputs_must_have_the_same_size() {
+    auto &ads = AnalysisDataService::Instance();
+    ads.addOrReplace("small",
+                     MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 2, 5));
+    EvaluateMDHistoExpression alg;
+    alg.setRethrows(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspaces",
+                    std::vector<std::string>{"data", "small"});
+    alg.setPropertyValue("Expression", "data + small");
+    alg.setPropertyValue("OutputWorkspace", "result");
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &);
+    ads.remove("small");
+  }
+
+private:
+  MDHistoWorkspace_sptr run(const std::string &expression,
+                            const std::string &outName,
+                            const std::vector<std::string> &names = {
+                                "data", "background", "norm"}) {
+    EvaluateMDHistoExpression alg;
+    alg.setRethrows(true);
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("InputWorkspaces", names));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Expression", expression));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", outName));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+    return AnalysisDataService::Instance().retrieveWS<MDHistoWorkspace>(
+        outName);
+  }
+};
+
+#endif /* MANTID_MDALGORITHMS_EVALUATEMDHISTOEXPRESSIONTEST_H_ */
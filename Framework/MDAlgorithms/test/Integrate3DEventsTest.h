@@ -251,6 +251,83 @@ public:
     }
   }
 
+  void test_streamed_moments_give_same_integration_as_events() {
+    V3D peak_1(10, 0, 0);
+    V3D peak_2(0, 5, 0);
+    std::vector<std::pair<double, V3D>> peak_q_list{{1., peak_1},
+                                                    {1., peak_2}};
+    DblMatrix UBinv(3, 3, false); // Q to h,k,l
+    UBinv.setRow(0, V3D(.1, 0, 0));
+    UBinv.setRow(1, V3D(0, .2, 0));
+    UBinv.setRow(2, V3D(0, 0, .25));
+    std::vector<V3D> hkl_list{UBinv * peak_1, UBinv * peak_2};
+    std::vector<V3D> mnp_list{V3D(0, 0, 0), V3D(0, 0, 0)};
+    DblMatrix ModHKL(3, 3, false);
+
+    // peaks on a background of events with varying weights
+    std::vector<std::pair<double, V3D>> event_Qs;
+    generatePeak(event_Qs, peak_1, 0.05, 2000, 1);
+    generatePeak(event_Qs, peak_2, 0.03, 500, 2);
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<> offset(-0.4, 0.4);
+    std::uniform_real_distribution<> weight(0.5, 2.);
+    for (int i = 0; i < 4000; ++i) {
+      const V3D center = i % 2 == 0 ? peak_1 : peak_2;
+      const V3D q = center + V3D(offset(gen), offset(gen), offset(gen));
+      event_Qs.emplace_back(weight(gen), q);
+    }
+    const auto middle = event_Qs.begin() + event_Qs.size() / 2;
+    const std::vector<std::pair<double, V3D>> firstHalf(event_Qs.begin(),
+                                                        middle);
+    const std::vector<std::pair<double, V3D>> secondHalf(middle,
+                                                         event_Qs.end());
+
+    Integrate3DEvents inMemory(peak_q_list, hkl_list, mnp_list, UBinv, ModHKL,
+                               0.35, 0.1, 0, false);
+    inMemory.addEvents(event_Qs, false);
+
+    // stream the events through in two chunks, as two threads would
+    Integrate3DEvents streamed(peak_q_list, hkl_list, mnp_list, UBinv, ModHKL,
+                               0.35, 0.1, 0, false);
+    EventMomentsMap moments1, moments2;
+    streamed.addEventMoments(firstHalf, false, moments1);
+    streamed.addEventMoments(secondHalf, false, moments2);
+    streamed.mergeEventMoments(moments1);
+    streamed.mergeEventMoments(moments2);
+
+    const std::vector<V3D> E1Vec;
+    for (const bool specify_size : {true, false}) {
+      std::vector<size_t> ellipsoids;
+      for (size_t i = 0; i < peak_q_list.size(); i++)
+        ellipsoids.push_back(streamed.addModEllipsoids(
+            E1Vec, peak_q_list[i].second, hkl_list[i], mnp_list[i],
+            specify_size, 0.15, 0.15, 0.2));
+      std::vector<EllipsoidCounts> counts1, counts2;
+      streamed.countEventsInEllipsoids(firstHalf, false, counts1);
+      streamed.countEventsInEllipsoids(secondHalf, false, counts2);
+      streamed.mergeEllipsoidCounts(counts1);
+      streamed.mergeEllipsoidCounts(counts2);
+
+      for (size_t i = 0; i < peak_q_list.size(); i++) {
+        std::vector<double> axes, streamedAxes;
+        double inti, sigi, streamedInti, streamedSigi;
+        inMemory.ellipseIntegrateModEvents(
+            E1Vec, peak_q_list[i].second, hkl_list[i], mnp_list[i],
+            specify_size, 0.15, 0.15, 0.2, axes, inti, sigi);
+        auto shape = streamed.integrateEllipsoids(
+            ellipsoids[i], streamedAxes, streamedInti, streamedSigi);
+        TS_ASSERT(boost::dynamic_pointer_cast<const PeakShapeEllipsoid>(shape))
+        TS_ASSERT(inti > 0)
+        TS_ASSERT_DELTA(streamedInti, inti, 1e-6 * inti);
+        TS_ASSERT_DELTA(streamedSigi, sigi, 1e-6 * sigi);
+        TS_ASSERT_EQUALS(streamedAxes.size(), 3);
+        for (size_t j = 0; j < axes.size() && j < streamedAxes.size(); ++j)
+          TS_ASSERT_DELTA(streamedAxes[j], axes[j], 1e-9);
+      }
+      streamed.clearEllipsoids();
+    }
+  }
+
   void test_integrateWeakPeakInPerfectCase() {
     /* Check that we can integrate a weak peak using a strong peak in the
      * perfect case when there is absolutely no background
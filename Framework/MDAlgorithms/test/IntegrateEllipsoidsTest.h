@@ -237,6 +237,27 @@ public:
     TS_ASSERT_DELTA(peak6.getIntensity(), 11., 1e-6);
   }
 
+  void test_execution_streamed_events() {
+
+    IntegrateEllipsoids alg;
+    alg.setChild(true);
+    alg.setRethrows(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", m_eventWS);
+    alg.setProperty("PeaksWorkspace", m_peaksWS);
+    alg.setProperty("StreamEvents", true);
+    alg.setPropertyValue("OutputWorkspace", "dummy");
+    alg.execute();
+    PeaksWorkspace_sptr integratedPeaksWS = alg.getProperty("OutputWorkspace");
+
+    do_test_n_peaks(integratedPeaksWS, 3 /*check first 3 peaks*/);
+
+    const double expected[] = {1., 3., 1., 14., 0., 11.};
+    for (int i = 0; i < 6; ++i)
+      TS_ASSERT_DELTA(integratedPeaksWS->getPeak(i).getIntensity(),
+                      expected[i], 1e-6);
+  }
+
   void test_execution_histograms() {
 
     IntegrateEllipsoids alg;
@@ -449,6 +449,39 @@ public:
                      outWS->getErrorAt(0), 1e-4);
   }
 
+  void test_2d_partial_integration_of_one_dimension_keeps_the_other() {
+
+    /*
+      Input signal is x + 10 * y at bin (x, y), 10 by 10 bins of width 1.
+      Integrating x from 0.5 to 2.5 gives, for each y,
+      0.5 * (10y) + (1 + 10y) + 0.5 * (2 + 10y) = 2 + 20y
+    */
+    using namespace Mantid::DataObjects;
+    MDHistoWorkspace_sptr ws = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        1.0 /*signal*/, 2 /*nd*/, 10 /*nbins*/, 10 /*max*/, 1.0 /*error sq*/);
+    for (size_t i = 0; i < ws->getNPoints(); ++i)
+      ws->setSignalAt(i, static_cast<double>(i));
+
+    IntegrateMDHistoWorkspace alg;
+    alg.setChild(true);
+    alg.setRethrows(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", ws);
+    std::vector<double> p1BinVec = {0.5, 2.5};
+    alg.setProperty("P1Bin", p1BinVec);
+    alg.setPropertyValue("OutputWorkspace", "dummy");
+    alg.execute();
+    IMDHistoWorkspace_sptr outWS = alg.getProperty("OutputWorkspace");
+
+    TS_ASSERT_EQUALS(1, outWS->getDimension(0)->getNBins());
+    TS_ASSERT_EQUALS(10, outWS->getDimension(1)->getNBins());
+    for (size_t y = 0; y < 10; ++y) {
+      TS_ASSERT_DELTA(2. + 20. * static_cast<double>(y),
+                      outWS->getSignalAt(y), 1e-4);
+      TS_ASSERT_DELTA(2., outWS->getErrorAt(y) * outWS->getErrorAt(y), 1e-4);
+    }
+  }
+
   void test_update_n_events_for_normalization() {
 
     /*
@@ -8,12 +8,15 @@
 #define MANTID_MDALGORITHMS_MDTRANSFQ3D_H_
 
 #include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/DeltaEMode.h"
 #include "MantidMDAlgorithms/MDTransfQ3D.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 
 #include <cxxtest/TestSuite.h>
 
+#include <cmath>
+
 using namespace Mantid::Kernel;
 using namespace Mantid::MDAlgorithms;
 
@@ -169,6 +172,31 @@ public:
                      0, errorSq, 2.e-8);
   }
 
+  void testCrystallographyConventionChangesTheSignOfQ() {
+    MDWSDescription WSDescr(4);
+    std::vector<std::string> dimPropNames(1, "T");
+    WSDescr.buildFromMatrixWS(ws2D, "Q3D",
+                              DeltaEMode::asString(DeltaEMode::Elastic),
+                              dimPropNames);
+    WSDescr.m_PreprDetTable =
+        WorkspaceCreationHelper::buildPreprocessedDetectorsWorkspace(ws2D);
+
+    auto &config = ConfigService::Instance();
+    const std::string oldConvention = config.getString("Q.convention");
+    config.setString("Q.convention", "Inelastic");
+    const auto inelastic = calcQ3DCoordinates(WSDescr);
+    config.setString("Q.convention", "Crystallography");
+    const auto crystallography = calcQ3DCoordinates(WSDescr);
+    config.setString("Q.convention", oldConvention);
+
+    TS_ASSERT_DIFFERS(std::abs(inelastic[0]) + std::abs(inelastic[1]) +
+                          std::abs(inelastic[2]),
+                      0.);
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_DELTA(crystallography[i], -inelastic[i], 1.e-6);
+    }
+  }
+
   MDTransfQ3DTest() {
 
     ws2D = WorkspaceCreationHelper::
@@ -179,6 +207,18 @@ public:
     ws2D->mutableRun().addProperty("Ei", 13., "meV", true);
     ws2D->mutableRun().addProperty("T", 70., "K", true);
   }
+
+private:
+  std::vector<coord_t> calcQ3DCoordinates(const MDWSDescription &WSDescr) {
+    MDTransfQ3D Q3DTransf;
+    Q3DTransf.initialize(WSDescr);
+    std::vector<coord_t> coord(4);
+    double signal(1), errorSq(1);
+    TS_ASSERT(Q3DTransf.calcGenericVariables(coord, 4));
+    TS_ASSERT(Q3DTransf.calcYDepCoordinates(coord, 1));
+    TS_ASSERT(Q3DTransf.calcMatrixCoord(10, coord, signal, errorSq));
+    return coord;
+  }
 };
 
 #endif
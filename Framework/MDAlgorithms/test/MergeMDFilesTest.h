@@ -21,6 +21,18 @@ using namespace Mantid::API;
 using namespace Mantid::DataObjects;
 using namespace Mantid::MDAlgorithms;
 
+namespace {
+/// Merges with small buffers, so that the output file is written between
+/// the reads of the input files
+class SmallBufferMergeMDFiles : public MergeMDFiles {
+public:
+  SmallBufferMergeMDFiles() {
+    m_writeBufferBytes = 2000;
+    m_maxEventsInMemory = 100;
+  }
+};
+} // namespace
+
 class MergeMDFilesTest : public CxxTest::TestSuite {
 public:
   void test_Init() {
@@ -33,7 +45,19 @@ public:
 
   void test_exec_fileBacked() { do_test_exec("MergeMDFilesTest_OutputWS.nxs"); }
 
-  void do_test_exec(std::string OutputFilename) {
+  void test_exec_parallel() { do_test_exec("", true); }
+
+  void test_exec_fileBacked_parallel() {
+    do_test_exec("MergeMDFilesTest_OutputWS.nxs", true);
+  }
+
+  void test_exec_fileBacked_parallel_writing_while_reading() {
+    SmallBufferMergeMDFiles alg;
+    do_test_exec("MergeMDFilesTest_OutputWS.nxs", true, &alg);
+  }
+
+  void do_test_exec(std::string OutputFilename, bool parallel = false,
+                    MergeMDFiles *mergeAlg = nullptr) {
     if (OutputFilename != "") {
       if (Poco::File(OutputFilename).exists())
         Poco::File(OutputFilename).remove();
@@ -61,7 +85,8 @@ public:
     // Name of the output workspace.
     std::string outWSName("MergeMDFilesTest_OutputWS");
 
-    MergeMDFiles alg;
+    MergeMDFiles defaultAlg;
+    MergeMDFiles &alg = mergeAlg ? *mergeAlg : defaultAlg;
     TS_ASSERT_THROWS_NOTHING(alg.initialize())
     TS_ASSERT(alg.isInitialized())
     TS_ASSERT_THROWS_NOTHING(alg.setProperty("Filenames", filenames));
@@ -69,6 +94,7 @@ public:
         alg.setPropertyValue("OutputFilename", OutputFilename));
     TS_ASSERT_THROWS_NOTHING(
         alg.setPropertyValue("OutputWorkspace", outWSName));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("Parallel", parallel));
 
     // clean up possible rubbish from previous runs
     std::string fullName = alg.getPropertyValue("OutputFilename");
@@ -100,6 +126,14 @@ public:
     for (size_t i = 0; i < box->getNumChildren(); i++)
       TS_ASSERT_LESS_THAN(1, box->getChild(i)->getNPoints());
 
+    // Each box holds the events of the same box of all the inputs
+    for (size_t i = 0; i < box->getNumChildren(); i++) {
+      uint64_t inputPoints = 0;
+      for (const auto &inWorkspace : inWorkspaces)
+        inputPoints += inWorkspace->getBox()->getChild(i)->getNPoints();
+      TS_ASSERT_EQUALS(box->getChild(i)->getNPoints(), inputPoints);
+    }
+
     if (!OutputFilename.empty()) {
       TS_ASSERT(ws->isFileBacked());
       TS_ASSERT(Poco::File(actualOutputFilename).exists());
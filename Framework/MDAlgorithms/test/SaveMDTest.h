@@ -51,6 +51,46 @@ public:
     do_test_exec(23, "SaveMDTest_other_file_name_test.nxs", true, false, true);
   }
 
+  void test_exec_compressed() {
+    MDEventWorkspace1Lean::sptr ws =
+        MDEventsTestHelper::makeMDEW<1>(10, 0.0, 10.0, 1000);
+    ws->splitBox();
+    ws->refreshCache();
+    AnalysisDataService::Instance().addOrReplace("SaveMDTest_ws", ws);
+
+    std::vector<uint64_t> fileSizes;
+    for (const bool compress : {false, true}) {
+      SaveMD alg;
+      TS_ASSERT_THROWS_NOTHING(alg.initialize())
+      TS_ASSERT_THROWS_NOTHING(
+          alg.setPropertyValue("InputWorkspace", "SaveMDTest_ws"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue(
+          "Filename", compress ? "SaveMDTest_compressed.nxs"
+                               : "SaveMDTest_uncompressed.nxs"));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("Compress", compress));
+      const std::string filename = alg.getPropertyValue("Filename");
+      if (Poco::File(filename).exists())
+        Poco::File(filename).remove();
+      alg.execute();
+      TS_ASSERT(alg.isExecuted());
+
+      auto load = AlgorithmManager::Instance().createUnmanaged("LoadMD");
+      load->initialize();
+      load->setChild(true);
+      load->setPropertyValue("Filename", filename);
+      load->setPropertyValue("OutputWorkspace", "_unused");
+      load->execute();
+      TS_ASSERT(load->isExecuted());
+      IMDEventWorkspace_sptr loaded = load->getProperty("OutputWorkspace");
+      TS_ASSERT_EQUALS(loaded->getNPoints(), 10000);
+
+      fileSizes.push_back(Poco::File(filename).getSize());
+      Poco::File(filename).remove();
+    }
+    TS_ASSERT_LESS_THAN(fileSizes[1], fileSizes[0]);
+    AnalysisDataService::Instance().remove("SaveMDTest_ws");
+  }
+
   void do_test_exec(size_t numPerBox, std::string filename,
                     bool MakeFileBacked = false, bool UpdateFileBackEnd = false,
                     bool OtherFileName = false) {
@@ -379,6 +379,89 @@ public:
                std::isnan(out->getSignalAt(9)));
   }
 
+  void test_smooth_hat_function_matches_neighbour_sums() {
+    // 3D, with different widths and an incomplete normalization workspace
+    const size_t nBins = 6;
+    auto toSmooth =
+        MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 3, nBins);
+    auto normWs = MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 3, nBins);
+    for (size_t i = 0; i < toSmooth->getNPoints(); ++i) {
+      toSmooth->setSignalAt(i, static_cast<double>((i * 7) % 11));
+      toSmooth->setErrorSquaredAt(i, static_cast<double>(1 + i % 5));
+      if (i % 13 == 0)
+        normWs->setSignalAt(i, 0.);
+    }
+
+    SmoothMD alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("WidthVector", WidthVector{3, 5, 1});
+    alg.setProperty("InputWorkspace", toSmooth);
+    alg.setProperty("InputNormalizationWorkspace", normWs);
+    alg.setPropertyValue("OutputWorkspace", "dummy");
+    alg.execute();
+    IMDHistoWorkspace_sptr out = alg.getProperty("OutputWorkspace");
+
+    const int halfWidths[3] = {1, 2, 0};
+    const int n = static_cast<int>(nBins);
+    for (int z = 0; z < n; ++z)
+      for (int y = 0; y < n; ++y)
+        for (int x = 0; x < n; ++x) {
+          const size_t index = x + n * (y + n * z);
+          if (normWs->getSignalAt(index) == 0) {
+            TS_ASSERT(std::isnan(out->getSignalAt(index)));
+            continue;
+          }
+          // The bin itself contributes its error, its neighbours their
+          // squared errors
+          double sumSignal = 0, sumError = 0, count = 0;
+          for (int k = z - halfWidths[2]; k <= z + halfWidths[2]; ++k)
+            for (int j = y - halfWidths[1]; j <= y + halfWidths[1]; ++j)
+              for (int i = x - halfWidths[0]; i <= x + halfWidths[0]; ++i) {
+                if (i < 0 || j < 0 || k < 0 || i >= n || j >= n || k >= n)
+                  continue;
+                const size_t neighbour = i + n * (j + n * k);
+                if (normWs->getSignalAt(neighbour) == 0)
+                  continue;
+                sumSignal += toSmooth->getSignalAt(neighbour);
+                sumError += neighbour == index
+                                ? toSmooth->getErrorAt(neighbour)
+                                : toSmooth->getErrorAt(neighbour) *
+                                      toSmooth->getErrorAt(neighbour);
+                count += 1;
+              }
+          TS_ASSERT_DELTA(out->getSignalAt(index), sumSignal / count, 1e-10);
+          TS_ASSERT_DELTA(out->getErrorAt(index),
+                          std::sqrt(sumError / count), 1e-10);
+        }
+  }
+
+  void test_masked_bins_are_not_smoothed() {
+    for (const std::string function : {"Hat", "Gaussian"}) {
+      auto toSmooth =
+          MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 1, 5);
+      for (size_t i = 0; i < 5; ++i)
+        toSmooth->setSignalAt(i, static_cast<double>(i + 1));
+      toSmooth->setMDMaskAt(2, true);
+
+      SmoothMD alg;
+      alg.setChild(true);
+      alg.initialize();
+      alg.setProperty("WidthVector", WidthVector(1, function == "Hat" ? 3 : 1));
+      alg.setProperty("InputWorkspace", toSmooth);
+      alg.setProperty("Function", function);
+      alg.setPropertyValue("OutputWorkspace", "dummy");
+      alg.execute();
+      IMDHistoWorkspace_sptr out = alg.getProperty("OutputWorkspace");
+
+      TSM_ASSERT_EQUALS(function, out->getSignalAt(2), 3.);
+      TSM_ASSERT_EQUALS(function, out->getErrorAt(2), 1.);
+      // The masked bin is still a neighbour of the others
+      TSM_ASSERT_DELTA(function, out->getSignalAt(1), 2., 1e-10);
+      TSM_ASSERT_DELTA(function, out->getSignalAt(3), 4., 1e-10);
+    }
+  }
+
   void test_gaussian_kernel_sigma_1() {
     // FWHM of 2.355 equivalent to sigma=1
     const std::vector<double> kernel =
@@ -208,6 +208,32 @@ public:
     TS_ASSERT_DELTA(3, Conv.convertUnits(range.second), 1.e-6);
   }
 
+  void testConvertArrayMatchesSingleValues() {
+    UnitsConversionHelper Conv;
+    MDWSDescription WSD;
+
+    // ws description currently needs min/max to be set properly
+    std::vector<double> min(2, -10), max(2, 10);
+    WSD.setMinMax(min, max);
+
+    WSD.buildFromMatrixWS(ws2D, "|Q|", "Direct");
+    WSD.m_PreprDetTable = detLoc;
+
+    TS_ASSERT_THROWS_NOTHING(Conv.initialize(WSD, "TOF"));
+    TS_ASSERT_THROWS_NOTHING(Conv.updateConversion(0));
+
+    const auto &X = ws2D->readX(0);
+    std::vector<double> vals(X.begin(), X.end());
+    vals.push_back(-DBL_MAX);
+    vals.push_back(1.e+10);
+    auto converted = vals;
+    Conv.convertUnits(converted);
+    for (size_t i = 0; i < vals.size(); i++) {
+      const double expected = Conv.convertUnits(vals[i]);
+      TS_ASSERT_DELTA(expected, converted[i], 1.e-12 * std::fabs(expected));
+    }
+  }
+
   void testConvertViaTOFElastic() {
 
     // Modify input workspace to be elastic workspace
@@ -0,0 +1,51 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_MUON_MUONRAWPAIRINGASYMMETRY_H_
+#define MANTID_MUON_MUONRAWPAIRINGASYMMETRY_H_
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/WorkspaceGroup.h"
+
+namespace Mantid {
+namespace Muon {
+
+/** MuonRawPairingAsymmetry : Calculates the asymmetry of a pair of detector
+  groups directly from the raw period workspaces of a run.
+
+  The dead time correction, the grouping of the detectors and the summing and
+  subtracting of the periods are done in a single pass over the counts, giving
+  the same result as MuonPreProcess followed by MuonPairingAsymmetry without
+  the intermediate workspaces.
+ */
+class DLLExport MuonRawPairingAsymmetry : public API::Algorithm {
+public:
+  const std::string name() const override { return "MuonRawPairingAsymmetry"; }
+  int version() const override { return (1); }
+  const std::string category() const override { return "Muon\\DataHandling"; }
+  const std::string summary() const override {
+    return "Calculate the dead time corrected pairing asymmetry between two "
+           "detector groups from raw Muon data in one pass.";
+  }
+  const std::vector<std::string> seeAlso() const override {
+    return {"MuonPreProcess", "MuonPairingAsymmetry", "ApplyDeadTimeCorr",
+            "AsymmetryCalc"};
+  }
+
+private:
+  void init() override;
+  void exec() override;
+  bool checkGroups() override;
+  std::map<std::string, std::string> validateInputs() override;
+
+  void setPairAsymmetrySampleLogs(API::MatrixWorkspace_sptr workspace);
+};
+
+} // namespace Muon
+} // namespace Mantid
+
+#endif /* MANTID_MUON_MUONRAWPAIRINGASYMMETRY_H_ */
@@ -65,7 +65,13 @@ private:
   void init() override;
   void exec() override;
   // Load run, apply dead time corrections and detector grouping
-  API::Workspace_sptr doLoad(size_t runNumber);
+  API::Workspace_sptr doLoad(size_t runNumber, bool &reused);
+  // Get a grouped run from the cache if it matches the current settings
+  API::Workspace_sptr retrieveGroupedRun(size_t runNumber,
+                                         const std::string &cacheKey) const;
+  // Store a grouped run in the cache
+  void storeGroupedRun(size_t runNumber, const std::string &cacheKey,
+                       API::Workspace_sptr groupedWs) const;
   // Analyse loaded run
   void doAnalysis(API::Workspace_sptr loadedWs, size_t index);
   // Parse run names
@@ -111,6 +117,8 @@ private:
   std::string m_dtcType;
   /// File to read corrections from
   std::string m_dtcFile;
+  /// Corrections read from m_dtcFile, shared by all runs
+  API::Workspace_sptr m_dtcFromFile;
   /// Store forward spectra
   std::vector<int> m_forward_list;
   /// Store backward spectra
@@ -154,6 +162,8 @@ private:
   std::string m_allProperties;
   // Name of the hidden ws
   std::string m_currResName;
+  // Prefix of the hidden workspaces caching grouped runs
+  std::string m_groupedPrefix;
   /// Cached start time for first run
   int64_t m_firstStart_ns;
 };
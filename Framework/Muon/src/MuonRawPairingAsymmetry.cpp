@@ -0,0 +1,435 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidMuon/MuonRawPairingAsymmetry.h"
+#include "MantidAPI/HistoWorkspace.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/Progress.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/TableRow.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidMuon/MuonAlgorithmHelper.h"
+
+#include <boost/format.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Mantid::API;
+using namespace Mantid::Kernel;
+
+namespace {
+
+/// The dead time corrected counts of the two groups in a period
+struct GroupCounts {
+  std::vector<double> forward;
+  std::vector<double> backward;
+};
+
+// Convert a Workspace_sptr (which may be single period, MatrixWorkspace, or
+// multi period WorkspaceGroup) to a WorkspaceGroup_sptr
+WorkspaceGroup_sptr workspaceToWorkspaceGroup(Workspace_sptr workspace) {
+  if (auto group = boost::dynamic_pointer_cast<WorkspaceGroup>(workspace)) {
+    return group;
+  }
+  auto group = boost::make_shared<WorkspaceGroup>();
+  group->addWorkspace(boost::dynamic_pointer_cast<MatrixWorkspace>(workspace));
+  return group;
+}
+
+MatrixWorkspace_sptr getPeriod(const WorkspaceGroup &group, const int period) {
+  return boost::dynamic_pointer_cast<MatrixWorkspace>(
+      group.getItem(period - 1));
+}
+
+bool checkPeriodsInWorkspaceGroup(const std::vector<int> &periods,
+                                  const int numberOfPeriods) {
+  return std::all_of(periods.cbegin(), periods.cend(),
+                     [numberOfPeriods](const int period) {
+                       return period > 0 && period <= numberOfPeriods;
+                     });
+}
+
+/**
+ * Find the workspace indices of a group of detectors.
+ * @param ws :: [input] a period workspace
+ * @param detectorIDs :: [input] the detector IDs of the group
+ * @returns the workspace indices of the detectors
+ */
+std::vector<size_t> groupIndices(const MatrixWorkspace &ws,
+                                 const std::vector<int> &detectorIDs) {
+  auto wsIndices = ws.getIndicesFromDetectorIDs(detectorIDs);
+  if (wsIndices.size() != detectorIDs.size())
+    throw std::invalid_argument(
+        str(boost::format("The number of detectors requested does not equal "
+                          "the number of detectors provided %1% != %2%") %
+            wsIndices.size() % detectorIDs.size()));
+  return wsIndices;
+}
+
+/**
+ * Look up the dead time of each spectrum.
+ * @param ws :: [input] a period workspace
+ * @param deadTimeTable :: [input] spectrum numbers and their dead times
+ * @returns the dead times by workspace index, zero for missing spectra
+ */
+std::vector<double> deadTimesByIndex(const MatrixWorkspace &ws,
+                                     ITableWorkspace_sptr deadTimeTable) {
+  std::vector<double> deadTimes(ws.getNumberHistograms(), 0.);
+  for (size_t i = 0; i < deadTimeTable->rowCount(); ++i) {
+    TableRow row = deadTimeTable->getRow(i);
+    const auto index = ws.getIndexFromSpectrumNumber(row.Int(0));
+    deadTimes[index] = row.Double(1);
+  }
+  return deadTimes;
+}
+
+/**
+ * Calculate the factor converting dead times to count fractions in a period,
+ * as in ApplyDeadTimeCorr.
+ * @param ws :: [input] a period workspace
+ * @returns 1 / (time bin width * number of good frames)
+ */
+double deadTimeScale(const MatrixWorkspace &ws) {
+  if (!ws.run().hasProperty("goodfrm"))
+    throw std::invalid_argument("To calculate Muon deadtime requires that "
+                                "goodfrm (number of good frames) is stored "
+                                "in InputWorkspace Run object");
+  const auto numGoodFrames =
+      boost::lexical_cast<double>(ws.run().getProperty("goodfrm")->value());
+  if (numGoodFrames == 0)
+    throw std::runtime_error("Number of good frames in the workspace is zero");
+  // Presumed to be the same for all data
+  const double timeBinWidth = ws.x(0)[1] - ws.x(0)[0];
+  if (timeBinWidth == 0)
+    throw std::invalid_argument("Can't divide by 0");
+  return 1. / (timeBinWidth * numGoodFrames);
+}
+
+/**
+ * Sum the dead time corrected counts of a group of detectors.
+ * @param ws :: [input] a period workspace
+ * @param indices :: [input] the workspace indices of the group
+ * @param deadTimes :: [input] dead times by workspace index, empty if the
+ * correction is not applied
+ * @param scale :: [input] the dead time scale of the period
+ * @returns the summed counts of the group
+ */
+std::vector<double> sumGroup(const MatrixWorkspace &ws,
+                             const std::vector<size_t> &indices,
+                             const std::vector<double> &deadTimes,
+                             const double scale) {
+  std::vector<double> sums(ws.y(indices.front()).size(), 0.);
+  for (const auto index : indices) {
+    const auto &y = ws.y(index);
+    if (deadTimes.empty()) {
+      for (size_t j = 0; j < sums.size(); ++j)
+        sums[j] += y[j];
+      continue;
+    }
+    const double fraction = deadTimes[index] * scale;
+    for (size_t j = 0; j < sums.size(); ++j) {
+      const double correction = 1 - y[j] * fraction;
+      if (correction == 0)
+        throw std::invalid_argument("Can't divide by 0");
+      sums[j] += y[j] / correction;
+    }
+  }
+  return sums;
+}
+
+/**
+ * Add the counts of the given periods, in period order.
+ * @param counts :: [input] the group counts of each period
+ * @param periods :: [input] the periods to sum, counting from 1
+ * @returns the summed group counts
+ */
+GroupCounts sumPeriods(const std::vector<GroupCounts> &counts,
+                       const std::vector<int> &periods) {
+  GroupCounts sums = counts[periods.front() - 1];
+  for (auto period = periods.cbegin() + 1; period != periods.cend();
+       ++period) {
+    const auto &periodCounts = counts[*period - 1];
+    for (size_t j = 0; j < sums.forward.size(); ++j) {
+      sums.forward[j] += periodCounts.forward[j];
+      sums.backward[j] += periodCounts.backward[j];
+    }
+  }
+  return sums;
+}
+
+/**
+ * Calculate the asymmetry (F - a*B) / (F + a*B) and its error as in
+ * AsymmetryCalc.
+ * @param counts :: [input] the forward and backward counts
+ * @param alpha :: [input] the balance parameter
+ * @param asymmetry :: [output] the asymmetry
+ * @param errors :: [output] the errors of the asymmetry
+ */
+void pairAsymmetry(const GroupCounts &counts, const double alpha,
+                   std::vector<double> &asymmetry,
+                   std::vector<double> &errors) {
+  asymmetry.resize(counts.forward.size());
+  errors.resize(counts.forward.size());
+  for (size_t j = 0; j < counts.forward.size(); ++j) {
+    const double forward = counts.forward[j];
+    const double backward = counts.backward[j];
+    const double numerator = forward - alpha * backward;
+    const double denominator = forward + alpha * backward;
+    if (denominator != 0.0) {
+      asymmetry[j] = numerator / denominator;
+      const double q1 = forward + alpha * alpha * backward;
+      const double q2 = 1 + numerator * numerator / (denominator * denominator);
+      errors[j] = sqrt(q1 * q2) / denominator;
+    } else {
+      asymmetry[j] = 0.;
+      errors[j] = 1.0;
+    }
+  }
+}
+
+} // namespace
+
+namespace Mantid {
+namespace Muon {
+
+// Register the algorithm into the AlgorithmFactory
+DECLARE_ALGORITHM(MuonRawPairingAsymmetry)
+
+void MuonRawPairingAsymmetry::init() {
+  std::string emptyString("");
+  std::vector<int> defaultGrouping1 = {1};
+  std::vector<int> defaultGrouping2 = {2};
+
+  declareProperty(
+      std::make_unique<WorkspaceProperty<Workspace>>(
+          "InputWorkspace", emptyString, Direction::Input,
+          PropertyMode::Mandatory),
+      "The raw data of a run, a single workspace or a group of periods.");
+
+  declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "OutputWorkspace", emptyString, Direction::Output),
+                  "The workspace which will hold the results of the asymmetry "
+                  "calculation.");
+
+  declareProperty("PairName", emptyString,
+                  "The name of the pair. Must "
+                  "contain at least one alphanumeric "
+                  "character.",
+                  Direction::Input);
+
+  declareProperty(
+      "Alpha", 1.0, boost::make_shared<MandatoryValidator<double>>(),
+      "Alpha parameter used in the asymmetry calculation.", Direction::Input);
+
+  declareProperty(std::make_unique<ArrayProperty<int>>(
+                      "Group1", std::move(defaultGrouping1),
+                      IValidator_sptr(new NullValidator), Direction::Input),
+                  "The grouping of detectors, comma separated list of detector "
+                  "IDs or hyphenated ranges of IDs.");
+  declareProperty(std::make_unique<ArrayProperty<int>>(
+                      "Group2", std::move(defaultGrouping2),
+                      IValidator_sptr(new NullValidator), Direction::Input),
+                  "The grouping of detectors, comma separated list of detector "
+                  "IDs or hyphenated ranges of IDs.");
+
+  declareProperty(std::make_unique<ArrayProperty<int>>("SummedPeriods", "1"),
+                  "A list of periods to sum in multiperiod data.");
+  declareProperty(std::make_unique<ArrayProperty<int>>("SubtractedPeriods",
+                                                       Direction::Input),
+                  "A list of periods to subtract in multiperiod data.");
+
+  declareProperty(
+      std::make_unique<WorkspaceProperty<ITableWorkspace>>(
+          "DeadTimeTable", emptyString, Direction::Input,
+          PropertyMode::Optional),
+      "TableWorkspace with dead time information, used to apply dead time "
+      "correction.");
+
+  const std::string groupingGrp("Grouping Information");
+  setPropertyGroup("Group1", groupingGrp);
+  setPropertyGroup("Group2", groupingGrp);
+
+  const std::string periodGrp("Multi-period Data");
+  setPropertyGroup("SummedPeriods", periodGrp);
+  setPropertyGroup("SubtractedPeriods", periodGrp);
+}
+
+std::map<std::string, std::string> MuonRawPairingAsymmetry::validateInputs() {
+  std::map<std::string, std::string> errors;
+
+  const std::string pairName = this->getProperty("PairName");
+  if (pairName.empty()) {
+    errors["PairName"] = "Pair name must be specified.";
+  }
+  if (!std::all_of(std::begin(pairName), std::end(pairName),
+                   MuonAlgorithmHelper::isAlphanumericOrUnderscore)) {
+    errors["PairName"] =
+        "The pair name must contain alphnumeric characters and _ only.";
+  }
+
+  const double alpha = this->getProperty("Alpha");
+  if (alpha < 0.0) {
+    errors["Alpha"] = "Alpha must be non-negative.";
+  }
+
+  const std::vector<int> group1 = this->getProperty("Group1");
+  const std::vector<int> group2 = this->getProperty("Group2");
+  if (group1.empty()) {
+    errors["Group1"] =
+        "A valid grouping must be supplied (e.g. \"1,2,3,4,5\").";
+  }
+  if (group2.empty()) {
+    errors["Group2"] =
+        "A valid grouping must be supplied (e.g. \"1,2,3,4,5\").";
+  }
+  if (group1 == group2) {
+    errors["Group1"] = "The two groups must be different.";
+  }
+
+  Workspace_sptr inputWS = this->getProperty("InputWorkspace");
+  const auto periods = workspaceToWorkspaceGroup(inputWS);
+  const auto numberOfPeriods = periods->getNumberOfEntries();
+  if (numberOfPeriods == 0) {
+    errors["InputWorkspace"] = "Input WorkspaceGroup is empty.";
+    return errors;
+  }
+  const auto first = getPeriod(*periods, 1);
+  for (int period = 1; period <= numberOfPeriods; ++period) {
+    const auto ws = getPeriod(*periods, period);
+    if (!ws) {
+      errors["InputWorkspace"] = "All periods must be MatrixWorkspaces.";
+      return errors;
+    }
+    if (ws->getNumberHistograms() != first->getNumberHistograms()) {
+      errors["InputWorkspace"] =
+          "Numbers of spectra should be identical across all workspaces in "
+          "the workspace group.";
+    }
+  }
+
+  const std::vector<int> summedPeriods = getProperty("SummedPeriods");
+  const std::vector<int> subtractedPeriods = getProperty("SubtractedPeriods");
+  if (summedPeriods.empty()) {
+    errors["SummedPeriods"] = "At least one period must be specified";
+  }
+  if (!checkPeriodsInWorkspaceGroup(summedPeriods, numberOfPeriods)) {
+    errors["SummedPeriods"] = "Requested periods must be between 1 and the "
+                              "number of periods in the data.";
+  }
+  if (!checkPeriodsInWorkspaceGroup(subtractedPeriods, numberOfPeriods)) {
+    errors["SubtractedPeriods"] = "Requested periods must be between 1 and "
+                                  "the number of periods in the data.";
+  }
+
+  ITableWorkspace_sptr deadTimeTable = getProperty("DeadTimeTable");
+  if (deadTimeTable &&
+      deadTimeTable->rowCount() > first->getNumberHistograms()) {
+    errors["DeadTimeTable"] = "DeadTimeTable must have as many rows as "
+                              "there are spectra in InputWorkspace.";
+  }
+
+  return errors;
+}
+
+// Allow WorkspaceGroup property to function correctly.
+bool MuonRawPairingAsymmetry::checkGroups() { return false; }
+
+void MuonRawPairingAsymmetry::exec() {
+  Workspace_sptr inputWS = getProperty("InputWorkspace");
+  const auto periods = workspaceToWorkspaceGroup(inputWS);
+  const std::vector<int> summedPeriods = getProperty("SummedPeriods");
+  const std::vector<int> subtractedPeriods = getProperty("SubtractedPeriods");
+  const double alpha = getProperty("Alpha");
+
+  // The detector lookups and dead times are shared by all the periods
+  const auto first = getPeriod(*periods, 1);
+  const std::vector<int> group1 = getProperty("Group1");
+  const std::vector<int> group2 = getProperty("Group2");
+  const auto forwardIndices = groupIndices(*first, group1);
+  const auto backwardIndices = groupIndices(*first, group2);
+  ITableWorkspace_sptr deadTimeTable = getProperty("DeadTimeTable");
+  std::vector<double> deadTimes;
+  if (deadTimeTable) {
+    deadTimes = deadTimesByIndex(*first, deadTimeTable);
+  }
+
+  // Correct and group the counts of each period used
+  const auto numberOfPeriods = periods->getNumberOfEntries();
+  std::vector<char> used(numberOfPeriods, false);
+  for (const auto period : summedPeriods)
+    used[period - 1] = true;
+  for (const auto period : subtractedPeriods)
+    used[period - 1] = true;
+  bool threadSafe = true;
+  for (int period = 1; period <= numberOfPeriods; ++period) {
+    threadSafe = threadSafe && getPeriod(*periods, period)->threadSafe();
+  }
+  std::vector<GroupCounts> counts(numberOfPeriods);
+  Progress progress(this, 0.0, 1.0, numberOfPeriods);
+  PARALLEL_FOR_IF(threadSafe)
+  for (int period = 1; period <= numberOfPeriods; ++period) {
+    PARALLEL_START_INTERUPT_REGION
+    if (used[period - 1]) {
+      const auto ws = getPeriod(*periods, period);
+      const double scale = deadTimes.empty() ? 0. : deadTimeScale(*ws);
+      auto &periodCounts = counts[period - 1];
+      periodCounts.forward = sumGroup(*ws, forwardIndices, deadTimes, scale);
+      periodCounts.backward = sumGroup(*ws, backwardIndices, deadTimes, scale);
+    }
+    progress.report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  auto outputWS = DataObjects::create<HistoWorkspace>(
+      *first, 1, first->points(forwardIndices.front()));
+  outputWS->getSpectrum(0).setDetectorID(static_cast<detid_t>(1));
+  outputWS->setYUnit("Asymmetry");
+  std::vector<double> asymmetry;
+  std::vector<double> errors;
+  pairAsymmetry(sumPeriods(counts, summedPeriods), alpha, asymmetry, errors);
+  if (!subtractedPeriods.empty()) {
+    std::vector<double> subtractedAsymmetry;
+    std::vector<double> subtractedErrors;
+    pairAsymmetry(sumPeriods(counts, subtractedPeriods), alpha,
+                  subtractedAsymmetry, subtractedErrors);
+    for (size_t j = 0; j < asymmetry.size(); ++j) {
+      asymmetry[j] -= subtractedAsymmetry[j];
+      errors[j] = std::sqrt(errors[j] * errors[j] +
+                            subtractedErrors[j] * subtractedErrors[j]);
+    }
+  }
+  outputWS->mutableY(0) = asymmetry;
+  outputWS->mutableE(0) = errors;
+
+  MatrixWorkspace_sptr outWS = std::move(outputWS);
+  setPairAsymmetrySampleLogs(outWS);
+  setProperty("OutputWorkspace", outWS);
+}
+
+void MuonRawPairingAsymmetry::setPairAsymmetrySampleLogs(
+    MatrixWorkspace_sptr workspace) {
+  MuonAlgorithmHelper::addSampleLog(workspace, "analysis_pairName",
+                                    getPropertyValue("PairName"));
+  MuonAlgorithmHelper::addSampleLog(workspace, "analysis_alpha",
+                                    getPropertyValue("Alpha"));
+  MuonAlgorithmHelper::addSampleLog(workspace, "analysis_group1",
+                                    getPropertyValue("Group1"));
+  MuonAlgorithmHelper::addSampleLog(workspace, "analysis_group2",
+                                    getPropertyValue("Group2"));
+  MuonAlgorithmHelper::addSampleLog(workspace, "analysis_periods_summed",
+                                    getPropertyValue("SummedPeriods"));
+  MuonAlgorithmHelper::addSampleLog(workspace, "analysis_periods_subtracted",
+                                    getPropertyValue("SubtractedPeriods"));
+}
+
+} // namespace Muon
+} // namespace Mantid
@@ -24,6 +24,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidMuon/PlotAsymmetryByLogValue.h"
@@ -83,12 +84,12 @@ DECLARE_ALGORITHM(PlotAsymmetryByLogValue)
 
 PlotAsymmetryByLogValue::PlotAsymmetryByLogValue()
     : Algorithm(), m_filenameBase(), m_filenameExt(), m_filenameZeros(),
-      m_dtcType(), m_dtcFile(), m_forward_list(), m_backward_list(),
-      m_int(true), m_red(-1), m_green(-1), m_minTime(-1.0), m_maxTime(-1.0),
-      m_logName(), m_logFunc(), m_logValue(), m_redY(), m_redE(), m_greenY(),
-      m_greenE(), m_sumY(), m_sumE(), m_diffY(), m_diffE(),
-      m_allProperties("default"), m_currResName("__PABLV_results"),
-      m_firstStart_ns(0) {}
+      m_dtcType(), m_dtcFile(), m_dtcFromFile(), m_forward_list(),
+      m_backward_list(), m_int(true), m_red(-1), m_green(-1), m_minTime(-1.0),
+      m_maxTime(-1.0), m_logName(), m_logFunc(), m_logValue(), m_redY(),
+      m_redE(), m_greenY(), m_greenE(), m_sumY(), m_sumE(), m_diffY(),
+      m_diffE(), m_allProperties("default"), m_currResName("__PABLV_results"),
+      m_groupedPrefix("__PABLV_grouped_"), m_firstStart_ns(0) {}
 
 /** Initialisation method. Declares properties to be used in algorithm.
  *
@@ -168,25 +169,48 @@ void PlotAsymmetryByLogValue::exec() {
 
   Progress progress(this, 0, 1, ie - is + 1);
 
-  // Loop through runs
+  // Check which runs were already analysed
+  std::vector<size_t> newRuns;
   for (size_t i = is; i <= ie; i++) {
-
-    // Check if run i was already loaded
-    std::ostringstream logMessage;
     if (m_logValue.count(i)) {
-      logMessage << "Found run " << i;
+      progress.report("Found run " + std::to_string(i));
     } else {
-      // Load run, apply dead time corrections and detector grouping
-      Workspace_sptr loadedWs = doLoad(i);
+      newRuns.emplace_back(i);
+    }
+  }
 
-      if (loadedWs) {
-        // Analyse loadedWs
-        doAnalysis(loadedWs, i);
-      }
-      logMessage << "Loaded run " << i;
+  // The same corrections are applied to every run
+  m_dtcFromFile.reset();
+  if (m_dtcType == "FromSpecifiedFile" && !newRuns.empty()) {
+    m_dtcFromFile = loadCorrectionsFromFile(m_dtcFile);
+  }
+
+  auto processRun = [this, &progress](const size_t i) {
+    // Load run, apply dead time corrections and detector grouping
+    bool reused = false;
+    Workspace_sptr loadedWs = doLoad(i, reused);
+
+    if (loadedWs) {
+      // Analyse loadedWs
+      doAnalysis(loadedWs, i);
     }
-    progress.report(logMessage.str());
+    progress.report((reused ? "Reused grouped run " : "Loaded run ") +
+                    std::to_string(i));
+  };
+
+  // The first run sets the reference start time, the others are independent
+  // and processed in parallel
+  if (!newRuns.empty()) {
+    processRun(newRuns.front());
+  }
+  const auto nNewRuns = static_cast<int64_t>(newRuns.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 1; i < nNewRuns; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    processRun(newRuns[i]);
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
 
   // Create the 2D workspace for the output
   int nplots = !m_greenY.empty() ? 4 : 1;
@@ -310,11 +334,14 @@ void PlotAsymmetryByLogValue::checkProperties(size_t &is, size_t &ie) {
 }
 
 /**  Loads one run and applies dead-time corrections and detector grouping if
- * required
+ * required. Grouped runs are cached in the ADS and reused as long as the
+ * file, the dead-time corrections and the grouping do not change.
  *   @param runNumber :: [input] Run number specifying run to load
+ *   @param reused :: [output] Whether the grouped run was found in the cache
  *   @return :: Loaded workspace
  */
-Workspace_sptr PlotAsymmetryByLogValue::doLoad(size_t runNumber) {
+Workspace_sptr PlotAsymmetryByLogValue::doLoad(size_t runNumber,
+                                               bool &reused) {
 
   // Get complete run name
   std::ostringstream fn, fnn;
@@ -327,12 +354,23 @@ Workspace_sptr PlotAsymmetryByLogValue::doLoad(size_t runNumber) {
     return Workspace_sptr();
   }
 
-  // Load run
+  // Only the settings applied here invalidate a grouped run
+  std::ostringstream cacheKey;
+  cacheKey << fn.str() << "," << m_dtcType << "," << m_dtcFile << ","
+           << getPropertyValue("ForwardSpectra") << ","
+           << getPropertyValue("BackwardSpectra");
+  if (auto groupedWs = retrieveGroupedRun(runNumber, cacheKey.str())) {
+    reused = true;
+    return groupedWs;
+  }
+
+  // Load run. The NeXus library is not thread safe so only one run is read
+  // at a time.
   IAlgorithm_sptr load = createChildAlgorithm("LoadMuonNexus");
   load->setPropertyValue("Filename", fn.str());
   load->setPropertyValue("DetectorGroupingTable", "detGroupTable");
   load->setPropertyValue("DeadTimeTable", "deadTimeTable");
-  load->execute();
+  PARALLEL_CRITICAL(PlotAsymmetryByLogValue_load) { load->execute(); }
   Workspace_sptr loadedWs = load->getProperty("OutputWorkspace");
 
   // Check if dead-time corrections have to be applied
@@ -341,8 +379,8 @@ Workspace_sptr PlotAsymmetryByLogValue::doLoad(size_t runNumber) {
     Workspace_sptr deadTimes;
 
     if (m_dtcType == "FromSpecifiedFile") {
-      // Load corrections from file
-      deadTimes = loadCorrectionsFromFile(m_dtcFile);
+      // Corrections loaded from file
+      deadTimes = m_dtcFromFile;
     } else {
       // Load corrections from run
       deadTimes = load->getProperty("DeadTimeTable");
@@ -368,9 +406,65 @@ Workspace_sptr PlotAsymmetryByLogValue::doLoad(size_t runNumber) {
   // Apply grouping
   groupDetectors(loadedWs, grouping);
 
+  storeGroupedRun(runNumber, cacheKey.str(), loadedWs);
   return loadedWs;
 }
 
+/**  Get a grouped run from the cache
+ *   @param runNumber :: [input] Run number of the grouped run
+ *   @param cacheKey :: [input] File and settings the run was grouped with
+ *   @return :: The grouped run or nullptr if it is not cached or was grouped
+ *   with different settings
+ */
+Workspace_sptr
+PlotAsymmetryByLogValue::retrieveGroupedRun(size_t runNumber,
+                                            const std::string &cacheKey) const {
+  const auto name = m_groupedPrefix + std::to_string(runNumber);
+  auto &ads = AnalysisDataService::Instance();
+  if (!ads.doesExist(name)) {
+    return Workspace_sptr();
+  }
+  Workspace_sptr groupedWs = ads.retrieve(name);
+  // Every period carries the key, so checking the first one is enough
+  MatrixWorkspace_sptr firstWs =
+      boost::dynamic_pointer_cast<MatrixWorkspace>(groupedWs);
+  if (auto group = boost::dynamic_pointer_cast<WorkspaceGroup>(groupedWs)) {
+    if (group->size() > 0)
+      firstWs = boost::dynamic_pointer_cast<MatrixWorkspace>(group->getItem(0));
+  }
+  if (!firstWs || !firstWs->run().hasProperty(m_groupedPrefix) ||
+      firstWs->run().getProperty(m_groupedPrefix)->value() != cacheKey) {
+    return Workspace_sptr();
+  }
+  return groupedWs;
+}
+
+/**  Store a grouped run in the cache. The cache is kept in the ADS so that
+ * it outlives the algorithm, like the results in m_currResName.
+ *   @param runNumber :: [input] Run number of the grouped run
+ *   @param cacheKey :: [input] File and settings the run was grouped with
+ *   @param groupedWs :: [input] The grouped run
+ */
+void PlotAsymmetryByLogValue::storeGroupedRun(size_t runNumber,
+                                              const std::string &cacheKey,
+                                              Workspace_sptr groupedWs) const {
+  std::vector<MatrixWorkspace_sptr> periods;
+  if (auto group = boost::dynamic_pointer_cast<WorkspaceGroup>(groupedWs)) {
+    for (size_t i = 0; i < group->size(); ++i)
+      periods.emplace_back(
+          boost::dynamic_pointer_cast<MatrixWorkspace>(group->getItem(i)));
+  } else {
+    periods.emplace_back(
+        boost::dynamic_pointer_cast<MatrixWorkspace>(groupedWs));
+  }
+  for (auto &ws : periods) {
+    if (ws)
+      ws->mutableRun().addProperty(m_groupedPrefix, cacheKey, true);
+  }
+  AnalysisDataService::Instance().addOrReplace(
+      m_groupedPrefix + std::to_string(runNumber), groupedWs);
+}
+
 /**  Load dead-time corrections from specified file
  *   @param deadTimeFile :: [input] File to read corrections from
  *   @return :: Deadtime corrections loaded from file
@@ -642,9 +736,13 @@ void PlotAsymmetryByLogValue::doAnalysis(Workspace_sptr loadedWs,
 
     double Y, E;
     calcIntAsymmetry(ws_red, Y, E);
-    m_logValue[index] = getLogValue(*ws_red);
-    m_redY[index] = Y;
-    m_redE[index] = E;
+    const double logValue = getLogValue(*ws_red);
+    // Runs may be analysed in parallel
+    PARALLEL_CRITICAL(PlotAsymmetryByLogValue_results) {
+      m_logValue[index] = logValue;
+      m_redY[index] = Y;
+      m_redE[index] = E;
+    }
 
   } else {
     // It is a group
@@ -660,9 +758,6 @@ void PlotAsymmetryByLogValue::doAnalysis(Workspace_sptr loadedWs,
     double YR, ER;
     calcIntAsymmetry(ws_red, YR, ER);
     double logValue = getLogValue(*ws_red);
-    m_logValue[index] = logValue;
-    m_redY[index] = YR;
-    m_redE[index] = ER;
 
     if (m_green != EMPTY_INT()) {
       // Process green period if supplied by user
@@ -675,19 +770,30 @@ void PlotAsymmetryByLogValue::doAnalysis(Workspace_sptr loadedWs,
       }
       double YG, EG;
       calcIntAsymmetry(ws_green, YG, EG);
-      // Red data
-      m_redY[index] = YR;
-      m_redE[index] = ER;
-      // Green data
-      m_greenY[index] = YG;
-      m_greenE[index] = EG;
-      // Sum
-      m_sumY[index] = YR + YG;
-      m_sumE[index] = sqrt(ER * ER + EG * EG);
       // Diff
-      calcIntAsymmetry(ws_red, ws_green, YR, ER);
-      m_diffY[index] = YR;
-      m_diffE[index] = ER;
+      double YD, ED;
+      calcIntAsymmetry(ws_red, ws_green, YD, ED);
+      PARALLEL_CRITICAL(PlotAsymmetryByLogValue_results) {
+        m_logValue[index] = logValue;
+        // Red data
+        m_redY[index] = YR;
+        m_redE[index] = ER;
+        // Green data
+        m_greenY[index] = YG;
+        m_greenE[index] = EG;
+        // Sum
+        m_sumY[index] = YR + YG;
+        m_sumE[index] = sqrt(ER * ER + EG * EG);
+        // Diff
+        m_diffY[index] = YD;
+        m_diffE[index] = ED;
+      }
+    } else {
+      PARALLEL_CRITICAL(PlotAsymmetryByLogValue_results) {
+        m_logValue[index] = logValue;
+        m_redY[index] = YR;
+        m_redE[index] = ER;
+      }
     }
   } // else loadedGroup
 }
@@ -828,8 +934,10 @@ double PlotAsymmetryByLogValue::getLogValue(MatrixWorkspace &ws) {
   }
 
   // If this is the first run, cache the start time
-  if (m_firstStart_ns == 0) {
-    m_firstStart_ns = start.totalNanoseconds();
+  PARALLEL_CRITICAL(PlotAsymmetryByLogValue_firstStart) {
+    if (m_firstStart_ns == 0) {
+      m_firstStart_ns = start.totalNanoseconds();
+    }
   }
 
   // If the log asked for is the start or end time, we already have these.
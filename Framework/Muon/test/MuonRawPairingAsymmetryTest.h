@@ -0,0 +1,169 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_MUON_MUONRAWPAIRINGASYMMETRYTEST_H_
+#define MANTID_MUON_MUONRAWPAIRINGASYMMETRYTEST_H_
+
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidMuon/MuonPairingAsymmetry.h"
+#include "MantidMuon/MuonPreProcess.h"
+#include "MantidMuon/MuonRawPairingAsymmetry.h"
+#include "MantidTestHelpers/MuonWorkspaceCreationHelper.h"
+
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::Muon;
+using namespace MuonWorkspaceCreationHelper;
+
+namespace {
+
+const std::vector<int> GROUP1 = {1, 2};
+const std::vector<int> GROUP2 = {3, 4};
+
+void setUpAlgorithm(IAlgorithm &alg, Workspace_sptr ws) {
+  alg.initialize();
+  alg.setChild(true);
+  alg.setRethrows(true);
+  alg.setProperty("InputWorkspace", ws);
+  alg.setProperty("PairName", "pair1");
+  alg.setProperty("Group1", GROUP1);
+  alg.setProperty("Group2", GROUP2);
+  alg.setProperty("OutputWorkspace", "__notUsed");
+}
+
+// The asymmetry calculated by the separate pre-processing and pairing steps
+MatrixWorkspace_sptr referenceAsymmetry(WorkspaceGroup_sptr ws,
+                                        const std::vector<int> &summed,
+                                        const std::vector<int> &subtracted,
+                                        ITableWorkspace_sptr deadTimes) {
+  MuonPreProcess preProcess;
+  preProcess.initialize();
+  preProcess.setChild(true);
+  preProcess.setProperty("InputWorkspace", ws);
+  if (deadTimes)
+    preProcess.setProperty("DeadTimeTable", deadTimes);
+  preProcess.setProperty("OutputWorkspace", "__notUsed");
+  preProcess.execute();
+  WorkspaceGroup_sptr corrected = preProcess.getProperty("OutputWorkspace");
+
+  MuonPairingAsymmetry pairing;
+  pairing.initialize();
+  pairing.setChild(true);
+  pairing.setProperty("SpecifyGroupsManually", true);
+  pairing.setProperty("InputWorkspace", corrected);
+  pairing.setProperty("PairName", "pair1");
+  pairing.setProperty("Group1", GROUP1);
+  pairing.setProperty("Group2", GROUP2);
+  pairing.setProperty("SummedPeriods", summed);
+  pairing.setProperty("SubtractedPeriods", subtracted);
+  pairing.setProperty("OutputWorkspace", "__notUsed");
+  pairing.execute();
+  return pairing.getProperty("OutputWorkspace");
+}
+
+void assertSameAsymmetry(const MatrixWorkspace &ws,
+                         const MatrixWorkspace &reference) {
+  TS_ASSERT_EQUALS(ws.getNumberHistograms(), 1);
+  TS_ASSERT_EQUALS(ws.x(0).rawData(), reference.x(0).rawData());
+  for (size_t j = 0; j < reference.y(0).size(); ++j) {
+    TS_ASSERT_DELTA(ws.y(0)[j], reference.y(0)[j], 1e-12);
+    TS_ASSERT_DELTA(ws.e(0)[j], reference.e(0)[j], 1e-12);
+  }
+}
+
+} // namespace
+
+class MuonRawPairingAsymmetryTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MuonRawPairingAsymmetryTest *createSuite() {
+    return new MuonRawPairingAsymmetryTest();
+  }
+  static void destroySuite(MuonRawPairingAsymmetryTest *suite) {
+    delete suite;
+  }
+
+  MuonRawPairingAsymmetryTest() { FrameworkManager::Instance(); }
+
+  void tearDown() override { AnalysisDataService::Instance().clear(); }
+
+  void test_algorithm_initializes() {
+    MuonRawPairingAsymmetry alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize());
+    TS_ASSERT(alg.isInitialized());
+  }
+
+  void test_that_single_period_data_combines_detectors_correctly() {
+    auto ws = createMultiPeriodAsymmetryData(1, 4, 10, "pairWS");
+    MuonRawPairingAsymmetry alg;
+    setUpAlgorithm(alg, ws->getItem(0));
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr wsOut = alg.getProperty("OutputWorkspace");
+
+    TS_ASSERT_DELTA(wsOut->x(0)[0], 0.050, 0.001);
+    TS_ASSERT_DELTA(wsOut->x(0)[9], 0.950, 0.001);
+
+    TS_ASSERT_DELTA(wsOut->y(0)[0], -0.3889, 0.001);
+    TS_ASSERT_DELTA(wsOut->y(0)[4], 0.000, 0.001);
+    TS_ASSERT_DELTA(wsOut->y(0)[9], -0.8211, 0.001);
+
+    TS_ASSERT_DELTA(wsOut->e(0)[0], 0.04641, 0.0001);
+    TS_ASSERT_DELTA(wsOut->e(0)[4], 1.00000, 0.0001);
+    TS_ASSERT_DELTA(wsOut->e(0)[9], 0.19818, 0.0001);
+  }
+
+  void test_that_summed_and_subtracted_periods_match_pairing_asymmetry() {
+    auto ws = createMultiPeriodAsymmetryData(3, 4, 10, "pairWS");
+    const std::vector<int> summed = {1, 2};
+    const std::vector<int> subtracted = {3};
+    MuonRawPairingAsymmetry alg;
+    setUpAlgorithm(alg, ws);
+    alg.setProperty("SummedPeriods", summed);
+    alg.setProperty("SubtractedPeriods", subtracted);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr wsOut = alg.getProperty("OutputWorkspace");
+
+    const auto reference = referenceAsymmetry(ws, summed, subtracted, nullptr);
+    assertSameAsymmetry(*wsOut, *reference);
+  }
+
+  void test_that_dead_time_correction_matches_pre_processing() {
+    auto ws = createMultiPeriodWorkspaceGroup(2, 4, 10, "pairWS");
+    std::vector<double> deadTimes = {0.001, 0.002, 0.003, 0.004};
+    auto deadTimeTable = createDeadTimeTable(4, deadTimes);
+    const std::vector<int> summed = {1, 2};
+    MuonRawPairingAsymmetry alg;
+    setUpAlgorithm(alg, ws);
+    alg.setProperty("SummedPeriods", summed);
+    alg.setProperty("DeadTimeTable", deadTimeTable);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr wsOut = alg.getProperty("OutputWorkspace");
+
+    const auto reference = referenceAsymmetry(ws, summed, {}, deadTimeTable);
+    assertSameAsymmetry(*wsOut, *reference);
+  }
+
+  void test_that_missing_detector_throws() {
+    auto ws = createMultiPeriodAsymmetryData(1, 4, 10, "pairWS");
+    MuonRawPairingAsymmetry alg;
+    setUpAlgorithm(alg, ws);
+    alg.setProperty("Group2", std::vector<int>{3, 5});
+    TS_ASSERT_THROWS(alg.execute(), const std::invalid_argument &);
+  }
+
+  void test_that_periods_out_of_range_are_rejected() {
+    auto ws = createMultiPeriodAsymmetryData(2, 4, 10, "pairWS");
+    MuonRawPairingAsymmetry alg;
+    setUpAlgorithm(alg, ws);
+    alg.setProperty("SubtractedPeriods", std::vector<int>{3});
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &);
+  }
+};
+
+#endif /* MANTID_MUON_MUONRAWPAIRINGASYMMETRYTEST_H_ */
@@ -75,7 +75,7 @@ class ProgressWatcher {
 public:
   /// Constructor
   ProgressWatcher()
-      : m_loadedCount(0), m_foundCount(0),
+      : m_loadedCount(0), m_foundCount(0), m_reusedCount(0),
         m_observer(*this, &ProgressWatcher::handleProgress) {}
   /// Add a notification to the count
   void handleProgress(
@@ -86,12 +86,16 @@ public:
       ++m_foundCount;
     } else if (0 == message.compare(0, 6, "Loaded")) {
       ++m_loadedCount;
+    } else if (0 == message.compare(0, 6, "Reused")) {
+      ++m_reusedCount;
     }
   }
   /// Return the number of "found" progress reports seen so far
   size_t getFoundCount() { return m_foundCount; }
   /// Return the number of "loaded" progress reports seen so far
   size_t getLoadedCount() { return m_loadedCount; }
+  /// Return the number of "reused" progress reports seen so far
+  size_t getReusedCount() { return m_reusedCount; }
   /// Getter for the observer
   Poco::NObserver<ProgressWatcher, Mantid::API::Algorithm::ProgressNotification>
   getObserver() {
@@ -103,6 +107,8 @@ private:
   size_t m_loadedCount;
   /// Count of "file found" progress reports seen so far
   size_t m_foundCount;
+  /// Count of "grouped run reused" progress reports seen so far
+  size_t m_reusedCount;
   /// Observer
   Poco::NObserver<ProgressWatcher, Mantid::API::Algorithm::ProgressNotification>
       m_observer;
@@ -584,6 +590,42 @@ public:
     TS_ASSERT_EQUALS(watcher.getFoundCount(), 2);  // reused 2
   }
 
+  void test_grouped_runs_are_reused_when_analysis_changes() {
+    PlotAsymmetryByLogValue alg;
+    alg.initialize();
+
+    ProgressWatcher watcher;
+    alg.addObserver(watcher.getObserver());
+
+    alg.setPropertyValue("FirstRun", firstRun);
+    alg.setPropertyValue("LastRun", lastRun);
+    alg.setPropertyValue("OutputWorkspace", "PlotAsymmetryByLogValueTest_WS");
+    alg.setPropertyValue("LogValue", "run_number");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT_EQUALS(watcher.getLoadedCount(), 2);
+    TS_ASSERT(AnalysisDataService::Instance().doesExist(
+        "__PABLV_grouped_15189"));
+
+    // The time limits only change the analysis of the grouped runs
+    alg.setPropertyValue("TimeMin", "0.5");
+    alg.setPropertyValue("TimeMax", "0.6");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT_EQUALS(watcher.getLoadedCount(), 2);
+    TS_ASSERT_EQUALS(watcher.getReusedCount(), 2);
+    MatrixWorkspace_sptr outWs =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+            "PlotAsymmetryByLogValueTest_WS");
+    TS_ASSERT_DELTA(outWs->y(0)[0], 0.14700, 0.00001);
+    TS_ASSERT_DELTA(outWs->y(0)[1], 0.13042, 0.00001);
+
+    // A new grouping needs the runs to be loaded again
+    alg.setPropertyValue("ForwardSpectra", "1-16");
+    alg.setPropertyValue("BackwardSpectra", "17-32");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT_EQUALS(watcher.getLoadedCount(), 4);
+    TS_ASSERT_EQUALS(watcher.getReusedCount(), 2);
+  }
+
 private:
   std::string firstRun, lastRun;
 };
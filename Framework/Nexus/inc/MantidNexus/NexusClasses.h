@@ -18,7 +18,10 @@
 
 #include <boost/shared_array.hpp>
 #include <boost/shared_ptr.hpp>
+#include <algorithm>
 #include <map>
+#include <type_traits>
+#include <vector>
 //----------------------------------------------------------------------
 // Forward declaration
 //----------------------------------------------------------------------
@@ -289,7 +292,7 @@ public:
       {
         n = dim0() * dim1() * dim2() * dim3();
         alloc(n);
-        getData(m_data.get());
+        readData(nullptr, nullptr);
         return;
       } else if (j < 0) {
         if (i >= dim0())
@@ -344,7 +347,7 @@ public:
       if (i < 0) {
         n = dim0() * dim1() * dim2();
         alloc(n);
-        getData(m_data.get());
+        readData(nullptr, nullptr);
         return;
       } else if (j < 0) {
         if (i >= dim0())
@@ -384,7 +387,7 @@ public:
       if (i < 0) {
         n = dim0() * dim1();
         alloc(n);
-        getData(m_data.get());
+        readData(nullptr, nullptr);
         return;
       } else if (j < 0) {
         if (i >= dim0())
@@ -410,7 +413,7 @@ public:
       if (i < 0) {
         n = dim0();
         alloc(n);
-        getData(m_data.get());
+        readData(nullptr, nullptr);
         return;
       } else {
         if (i >= dim0())
@@ -421,10 +424,30 @@ public:
       }
     }
     alloc(n);
-    getSlab(m_data.get(), start, m_size);
+    readData(start, m_size);
   }
 
 private:
+  /** Read all the data, or a slab of it, into the buffer. Single precision
+   * data are widened when read into a double precision dataset.
+   *  @param start :: The indices of the start of the slab, or null to read
+   * all the data
+   *  @param size :: The sizes of the slab along each dimension
+   */
+  void readData(int start[], int size[]) {
+    if (std::is_same<T, double>::value && type() == NX_FLOAT32) {
+      std::vector<float> buffer(m_n);
+      if (start)
+        getSlab(buffer.data(), start, size);
+      else
+        getData(buffer.data());
+      std::copy(buffer.cbegin(), buffer.cend(), m_data.get());
+    } else if (start) {
+      getSlab(m_data.get(), start, size);
+    } else {
+      getData(m_data.get());
+    }
+  }
   /** Allocates memory for the data buffer
    *  @param n :: The number of elements to allocate.
    */
@@ -67,7 +67,8 @@ public:
   int writeNexusProcessedData2D(
       const API::MatrixWorkspace_const_sptr &localworkspace,
       const bool &uniformSpectra, const std::vector<int> &spec,
-      const char *group_name, bool write2Ddata) const;
+      const char *group_name, bool write2Ddata,
+      bool singlePrecision = false) const;
 
   /// write table workspace
   int writeNexusTableWorkspace(
@@ -82,6 +83,19 @@ public:
       std::vector<int64_t> &indices, double *tofs, float *weights,
       float *errorSquareds, int64_t *pulsetimes, bool compress) const;
 
+  /// Create the empty combined event data sets, to be filled in blocks
+  int makeNexusProcessedDataEventCombined(
+      const DataObjects::EventWorkspace_const_sptr &ws,
+      const std::vector<int64_t> &indices, bool writeTOF, bool writePulsetime,
+      bool writeWeight, bool writeError, bool compress) const;
+
+  /// Write a block of events into the combined event data sets
+  int writeNexusProcessedDataEventBlock(int64_t start, int64_t size,
+                                        const double *tofs,
+                                        const float *weights,
+                                        const float *errorSquareds,
+                                        const int64_t *pulsetimes) const;
+
   int writeEventList(const DataObjects::EventList &el,
                      std::string group_name) const;
 
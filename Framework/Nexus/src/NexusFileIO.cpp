@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 // NexusFileIO
 // @author Ronald Fowler
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -40,6 +41,8 @@ using namespace DataObjects;
 namespace {
 /// static logger
 Logger g_log("NexusFileIO");
+/// maximum number of events in one HDF5 chunk of the combined event data
+constexpr int64_t EVENT_CHUNK_SIZE = 1 << 20;
 } // namespace
 
 /// Empty default constructor
@@ -299,7 +302,7 @@ bool NexusFileIO::writeNxNote(const std::string &noteName,
 int NexusFileIO::writeNexusProcessedData2D(
     const API::MatrixWorkspace_const_sptr &localworkspace,
     const bool &uniformSpectra, const std::vector<int> &spec,
-    const char *group_name, bool write2Ddata) const {
+    const char *group_name, bool write2Ddata, bool singlePrecision) const {
   NXstatus status;
 
   // write data entry
@@ -347,15 +350,30 @@ int NexusFileIO::writeNexusProcessedData2D(
   int start[2] = {0, 0};
   int asize[2] = {1, dims_array[1]};
 
+  // Signal and errors are narrowed into this buffer for single precision
+  const int valueType = singlePrecision ? NX_FLOAT32 : NX_FLOAT64;
+  std::vector<float> singleValues(singlePrecision ? nSpectBins : 0);
+  auto putValues = [&](const std::vector<double> &values) {
+    if (singlePrecision) {
+      std::transform(values.cbegin(), values.cend(), singleValues.begin(),
+                     [](const double value) {
+                       return static_cast<float>(value);
+                     });
+      NXputslab(fileID, singleValues.data(), start, asize);
+    } else {
+      NXputslab(fileID, values.data(), start, asize);
+    }
+  };
+
   // -------------- Actually write the 2D data ----------------------------
   if (write2Ddata) {
     std::string name = "values";
-    NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
+    NXcompmakedata(fileID, name.c_str(), valueType, 2, dims_array,
                    m_nexuscompression, asize);
     NXopendata(fileID, name.c_str());
     for (size_t i = 0; i < nSpect; i++) {
       int s = spec[i];
-      NXputslab(fileID, localworkspace->y(s).rawData().data(), start, asize);
+      putValues(localworkspace->y(s).rawData());
       start[0]++;
     }
     if (m_progress != nullptr)
@@ -376,13 +394,13 @@ int NexusFileIO::writeNexusProcessedData2D(
 
     // error
     name = "errors";
-    NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
+    NXcompmakedata(fileID, name.c_str(), valueType, 2, dims_array,
                    m_nexuscompression, asize);
     NXopendata(fileID, name.c_str());
     start[0] = 0;
     for (size_t i = 0; i < nSpect; i++) {
       int s = spec[i];
-      NXputslab(fileID, localworkspace->e(s).rawData().data(), start, asize);
+      putValues(localworkspace->e(s).rawData());
       start[0]++;
     }
 
@@ -781,6 +799,108 @@ int NexusFileIO::writeNexusProcessedDataEventCombined(
   return ((status == NX_ERROR) ? 3 : 0);
 }
 
+//-------------------------------------------------------------------------------------
+/** Create the combined event data sets of an event workspace without writing
+ * the events. They are written afterwards, in blocks, with
+ * writeNexusProcessedDataEventBlock. When compressed, the data sets are split
+ * into HDF5 chunks of at most EVENT_CHUNK_SIZE events.
+ *
+ * @param ws :: an EventWorkspace
+ * @param indices :: array of event list indexes, ending with the total number
+ * of events
+ * @param writeTOF :: if true, create the "tof" data set
+ * @param writePulsetime :: if true, create the "pulsetime" data set
+ * @param writeWeight :: if true, create the "weight" data set
+ * @param writeError :: if true, create the "error_squared" data set
+ * @param compress :: if true, compress the entries
+ */
+int NexusFileIO::makeNexusProcessedDataEventCombined(
+    const DataObjects::EventWorkspace_const_sptr &ws,
+    const std::vector<int64_t> &indices, bool writeTOF, bool writePulsetime,
+    bool writeWeight, bool writeError, bool compress) const {
+  NXopengroup(fileID, "event_workspace", "NXdata");
+
+  // The array of indices for each event list #
+  int dims_array[1] = {static_cast<int>(indices.size())};
+  if (!indices.empty()) {
+    if (compress)
+      NXcompmakedata(fileID, "indices", NX_INT64, 1, dims_array,
+                     m_nexuscompression, dims_array);
+    else
+      NXmakedata(fileID, "indices", NX_INT64, 1, dims_array);
+    NXopendata(fileID, "indices");
+    NXputdata(fileID, const_cast<int64_t *>(indices.data()));
+    std::string yUnits = ws->YUnit();
+    std::string yUnitLabel = ws->YUnitLabel();
+    NXputattr(fileID, "units", yUnits.c_str(), static_cast<int>(yUnits.size()),
+              NX_CHAR);
+    NXputattr(fileID, "unit_label", yUnitLabel.c_str(),
+              static_cast<int>(yUnitLabel.size()), NX_CHAR);
+    NXclosedata(fileID);
+  }
+
+  int64_t dims64[1] = {indices.empty() ? 0 : indices.back()};
+  int64_t chunk64[1] = {
+      std::max(int64_t{1}, std::min(dims64[0], EVENT_CHUNK_SIZE))};
+  const auto makeData = [&](const char *name, int datatype) {
+    if (compress)
+      NXcompmakedata64(fileID, name, datatype, 1, dims64, m_nexuscompression,
+                       chunk64);
+    else
+      NXmakedata64(fileID, name, datatype, 1, dims64);
+  };
+  if (writeTOF)
+    makeData("tof", NX_FLOAT64);
+  if (writePulsetime)
+    makeData("pulsetime", NX_INT64);
+  if (writeWeight)
+    makeData("weight", NX_FLOAT32);
+  if (writeError)
+    makeData("error_squared", NX_FLOAT32);
+
+  NXstatus status = NXclosegroup(fileID);
+  return ((status == NX_ERROR) ? 3 : 0);
+}
+
+//-------------------------------------------------------------------------------------
+/** Write a contiguous block of events into the combined event data sets
+ * created by makeNexusProcessedDataEventCombined.
+ *
+ * @param start :: index of the first event of the block in the data sets
+ * @param size :: number of events in the block
+ * @param tofs :: TOFs of the events, or nullptr if not written
+ * @param weights :: weights of the events, or nullptr if not written
+ * @param errorSquareds :: squared errors of the events, or nullptr if not
+ * written
+ * @param pulsetimes :: pulse times of the events, or nullptr if not written
+ */
+int NexusFileIO::writeNexusProcessedDataEventBlock(
+    int64_t start, int64_t size, const double *tofs, const float *weights,
+    const float *errorSquareds, const int64_t *pulsetimes) const {
+  if (size <= 0)
+    return 0;
+  NXopengroup(fileID, "event_workspace", "NXdata");
+
+  int64_t start64[1] = {start};
+  int64_t size64[1] = {size};
+  const auto putSlab = [&](const char *name, const void *data) {
+    NXopendata(fileID, name);
+    NXputslab64(fileID, data, start64, size64);
+    NXclosedata(fileID);
+  };
+  if (tofs)
+    putSlab("tof", tofs);
+  if (pulsetimes)
+    putSlab("pulsetime", pulsetimes);
+  if (weights)
+    putSlab("weight", weights);
+  if (errorSquareds)
+    putSlab("error_squared", errorSquareds);
+
+  NXstatus status = NXclosegroup(fileID);
+  return ((status == NX_ERROR) ? 3 : 0);
+}
+
 //-------------------------------------------------------------------------------------
 /** Write out all of the event lists in the given workspace
  * @param ws :: an EventWorkspace */
@@ -12,6 +12,7 @@
 #include "MantidGeometry/Rendering/ShapeInfo.h"
 #include "MantidKernel/ChecksumHelper.h"
 #include "MantidKernel/EigenConversionHelpers.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidNexusGeometry/AbstractLogger.h"
 #include "MantidNexusGeometry/H5ForwardCompatibility.h"
 #include "MantidNexusGeometry/Hdf5Version.h"
@@ -24,12 +25,16 @@
 #include <Eigen/Geometry>
 #include <H5Cpp.h>
 #include <boost/algorithm/string.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/optional.hpp>
 #include <boost/regex.hpp>
+#include <cmath>
+#include <exception>
 #include <numeric>
 #include <sstream>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 
 namespace Mantid {
 namespace NexusGeometry {
@@ -46,6 +51,50 @@ struct Face {
   Eigen::Vector3d v4;
 };
 
+/// Scale of the grid the vertices of mesh shapes are rounded to when
+/// comparing shapes, so that shapes equal to within 1e-10 are shared
+constexpr double SHAPE_VERTEX_SCALE = 1e10;
+
+/**
+ * The content of the mesh shape of a detector, for detectors of the same
+ * shape to share it. The first face index is not part of it, as it does not
+ * change the triangles the mesh is made of.
+ */
+struct MeshShapeKey {
+  MeshShapeKey() = default;
+  MeshShapeKey(const std::vector<uint32_t> &faceIndices,
+               const std::vector<uint32_t> &windingOrder,
+               const std::vector<Eigen::Vector3d> &vertices)
+      : faces(faceIndices.empty() ? faceIndices.end()
+                                  : faceIndices.begin() + 1,
+              faceIndices.end()),
+        winding(windingOrder) {
+    roundedVertices.reserve(3 * vertices.size());
+    for (const auto &vertex : vertices)
+      for (int i = 0; i < 3; ++i)
+        roundedVertices.emplace_back(
+            std::llround(vertex[i] * SHAPE_VERTEX_SCALE));
+  }
+  bool operator==(const MeshShapeKey &other) const {
+    return faces == other.faces && winding == other.winding &&
+           roundedVertices == other.roundedVertices;
+  }
+  std::vector<uint32_t> faces;
+  std::vector<uint32_t> winding;
+  std::vector<long long> roundedVertices;
+};
+
+struct MeshShapeKeyHash {
+  size_t operator()(const MeshShapeKey &key) const {
+    size_t seed = 0;
+    boost::hash_range(seed, key.faces.begin(), key.faces.end());
+    boost::hash_range(seed, key.winding.begin(), key.winding.end());
+    boost::hash_range(seed, key.roundedVertices.begin(),
+                      key.roundedVertices.end());
+    return seed;
+  }
+};
+
 bool isDegrees(const H5std_string &units) {
   using boost::regex;
   // Nexus format inexact on acceptable rotation unit definitions
@@ -531,9 +580,15 @@ private:
     if (vPoints.size() % 3 != 0)
       throw std::runtime_error("vertices not divisble by 3. Bad input.");
 
-    for (size_t i = 0; i < cylinderIndexToDetId.size(); i += 2) {
-      auto cylinderIndex = cylinderIndexToDetId[i];
-      auto detId = cylinderIndexToDetId[i + 1];
+    // The shapes are created in parallel, and the detectors added in order
+    const auto nCylinders = static_cast<int64_t>(detectorIds.size());
+    std::vector<Eigen::Vector3d> positions(detectorIds.size());
+    std::vector<boost::shared_ptr<const Geometry::IObject>> shapes(
+        detectorIds.size());
+    std::exception_ptr error;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t c = 0; c < nCylinders; ++c) {
+      auto cylinderIndex = cylinderIndexToDetId[2 * c];
 
       Eigen::Matrix<double, 3, 3> vSorted;
       for (uint8_t j = 0; j < 3; ++j) {
@@ -544,12 +599,25 @@ private:
       }
       const auto centre = vSorted.col(0);
       const auto other = vSorted.col(2);
+      positions[c] = (centre + other) / 2;
+      try {
+        shapes[c] = NexusShapeFactory::createCylinder(vSorted);
+      } catch (...) {
+        PARALLEL_CRITICAL(NexusGeometryParser_cylinderError)
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+    if (error)
+      std::rethrow_exception(error);
 
+    for (size_t c = 0; c < detectorIds.size(); ++c) {
+      auto cylinderIndex = cylinderIndexToDetId[2 * c];
+      auto detId = cylinderIndexToDetId[2 * c + 1];
       // Note that tube optimisation is not used here. That should be applied as
       // future optimisation.
       builder.addDetectorToLastBank(name + "_" + std::to_string(cylinderIndex),
-                                    detId, (centre + other) / 2,
-                                    NexusShapeFactory::createCylinder(vSorted));
+                                    detId, positions[c], shapes[c]);
     }
   }
 
@@ -633,10 +701,14 @@ private:
                        faceIndices, detFaceVerts, detFaceIndices,
                        detWindingOrder, detIds);
 
-    for (size_t i = 0; i < numDets; ++i) {
+    // Translate the shapes to their centre and find which detectors share a
+    // shape, in parallel
+    const auto nDets = static_cast<int64_t>(numDets);
+    std::vector<Eigen::Vector3d> centres(numDets);
+    std::vector<MeshShapeKey> keys(numDets);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < nDets; ++i) {
       auto &detVerts = detFaceVerts[i];
-      const auto &faceIndices = detFaceIndices[i];
-      const auto &detWinding = detWindingOrder[i];
       // Calculate polygon centre
       Eigen::Vector3d centre =
           std::accumulate(detVerts.begin() + 1, detVerts.end(),
@@ -646,11 +718,46 @@ private:
       // translate shape to origin for shape coordinates.
       std::for_each(detVerts.begin(), detVerts.end(),
                     [&centre](Eigen::Vector3d &val) { val -= centre; });
+      centres[i] = centre;
+      keys[i] = MeshShapeKey(detFaceIndices[i], detWindingOrder[i], detVerts);
+    }
+
+    // Index of the shape of each detector, and the first detector of each
+    // shape
+    std::vector<size_t> shapeIndices(numDets);
+    std::vector<size_t> firstDetectors;
+    std::unordered_map<MeshShapeKey, size_t, MeshShapeKeyHash> shapeIndexOfKey;
+    for (size_t i = 0; i < numDets; ++i) {
+      const auto found =
+          shapeIndexOfKey.emplace(std::move(keys[i]), firstDetectors.size());
+      if (found.second)
+        firstDetectors.emplace_back(i);
+      shapeIndices[i] = found.first->second;
+    }
+    keys.clear();
+
+    // Create each distinct shape once, in parallel
+    std::vector<boost::shared_ptr<const Geometry::IObject>> shapes(
+        firstDetectors.size());
+    std::exception_ptr error;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t s = 0; s < static_cast<int64_t>(shapes.size()); ++s) {
+      const size_t i = firstDetectors[s];
+      try {
+        shapes[s] = NexusShapeFactory::createFromOFFMesh(
+            detFaceIndices[i], detWindingOrder[i], detFaceVerts[i]);
+      } catch (...) {
+        PARALLEL_CRITICAL(NexusGeometryParser_shapeError)
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+    if (error)
+      std::rethrow_exception(error);
 
-      auto shape = NexusShapeFactory::createFromOFFMesh(faceIndices, detWinding,
-                                                        detVerts);
+    for (size_t i = 0; i < numDets; ++i) {
       builder.addDetectorToLastBank(name + "_" + std::to_string(i), detIds[i],
-                                    centre, std::move(shape));
+                                    centres[i], shapes[shapeIndices[i]]);
     }
   }
 
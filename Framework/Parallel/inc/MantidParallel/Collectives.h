@@ -15,6 +15,9 @@
 #include <boost/mpi/collectives.hpp>
 #endif
 
+#include <algorithm>
+#include <memory>
+
 namespace Mantid {
 namespace Parallel {
 
@@ -24,6 +27,16 @@ namespace Parallel {
 
   @author Simon Heybrock
   @date 2017
+
+  The reductions reduce, all_reduce and reduce_scatter take arrays as a
+  pointer and a number of values, e.g., the data of HistogramData arrays or
+  of flattened event lists. The non-blocking variants ireduce, iall_reduce
+  and ireduce_scatter are built on point-to-point communication in all
+  builds, since boost::mpi has no non-blocking collectives. The values of all
+  ranks are combined in rank order, and the input values must not change
+  until the returned Request has been waited for. While a non-blocking
+  reduction is pending no other messages with tag 0 may be exchanged on the
+  communicator, including those of other reductions.
 */
 
 namespace detail {
@@ -73,6 +86,153 @@ void all_to_all(const Communicator &comm, const std::vector<T> &in_values,
     comm.send(rank, tag, in_values[rank]);
   wait_all(requests.begin(), requests.end());
 }
+
+/// Post receives of n values from every other rank into blocks, which holds
+/// the values of each rank one after the other in rank order
+template <typename T>
+void receive_blocks(const Communicator &comm, int tag, std::vector<T> &blocks,
+                    int n, std::vector<Request> &requests) {
+  for (int rank = 0; rank < comm.size(); ++rank)
+    if (rank != comm.rank())
+      requests.emplace_back(comm.irecv(
+          rank, tag, blocks.data() + static_cast<size_t>(rank) * n, n));
+}
+
+/// Combine the blocks of n values of all ranks in rank order
+template <typename T, typename Op>
+void combine_blocks(const std::vector<T> &blocks, int n, T *out_values,
+                    Op op) {
+  std::copy(blocks.begin(), blocks.begin() + n, out_values);
+  for (auto block = blocks.begin() + n; block != blocks.end(); block += n)
+    std::transform(out_values, out_values + n, block, out_values, op);
+}
+
+/// The blocks of all ranks, with the values of this rank filled in
+template <typename T>
+std::shared_ptr<std::vector<T>> make_blocks(const Communicator &comm,
+                                            const T *in_values, int n) {
+  auto blocks =
+      std::make_shared<std::vector<T>>(static_cast<size_t>(comm.size()) * n);
+  std::copy(in_values, in_values + n,
+            blocks->begin() + static_cast<size_t>(comm.rank()) * n);
+  return blocks;
+}
+} // namespace detail
+
+/**
+ * Start combining n values of all ranks with op on the root rank.
+ * @param comm :: The communicator of the ranks
+ * @param in_values :: The n values of this rank
+ * @param n :: The number of values, the same on all ranks
+ * @param out_values :: Set to the n combined values on the root rank, unused
+ * on the other ranks
+ * @param op :: Binary function combining two values
+ * @param root :: The rank receiving the result
+ * @return the request, out_values is set once it has been waited for
+ */
+template <typename T, typename Op>
+Request ireduce(const Communicator &comm, const T *in_values, int n,
+                T *out_values, Op op, int root) {
+  int tag{0};
+  if (comm.rank() != root)
+    return comm.isend(root, tag, in_values, n);
+  auto blocks = detail::make_blocks(comm, in_values, n);
+  std::vector<Request> requests;
+  detail::receive_blocks(comm, tag, *blocks, n, requests);
+  return Request(std::move(requests), [blocks, n, out_values, op]() {
+    detail::combine_blocks(*blocks, n, out_values, op);
+  });
+}
+
+/**
+ * Start combining n values of all ranks with op on all ranks. The values are
+ * combined on rank 0 and sent back to the other ranks.
+ * @param comm :: The communicator of the ranks
+ * @param in_values :: The n values of this rank
+ * @param n :: The number of values, the same on all ranks
+ * @param out_values :: Set to the n combined values
+ * @param op :: Binary function combining two values
+ * @return the request, out_values is set once it has been waited for
+ */
+template <typename T, typename Op>
+Request iall_reduce(const Communicator &comm, const T *in_values, int n,
+                    T *out_values, Op op) {
+  int tag{0};
+  int root{0};
+  std::vector<Request> requests;
+  if (comm.rank() != root) {
+    requests.emplace_back(comm.isend(root, tag, in_values, n));
+    requests.emplace_back(comm.irecv(root, tag, out_values, n));
+    return Request(std::move(requests), []() {});
+  }
+  auto blocks = detail::make_blocks(comm, in_values, n);
+  detail::receive_blocks(comm, tag, *blocks, n, requests);
+  return Request(std::move(requests), [comm, tag, blocks, n, out_values, op]() {
+    detail::combine_blocks(*blocks, n, out_values, op);
+    for (int rank = 0; rank < comm.size(); ++rank)
+      if (rank != comm.rank())
+        comm.send(rank, tag, out_values, n);
+  });
+}
+
+/**
+ * Start combining the values of all ranks with op, leaving each rank with a
+ * part of the result as MPI_Reduce_scatter does.
+ * @param comm :: The communicator of the ranks
+ * @param in_values :: The values of this rank, the sum of counts values
+ * @param counts :: The number of values of the result on each rank, the same
+ * on all ranks
+ * @param out_values :: Set to counts[comm.rank()] combined values, the part
+ * of the result of this rank
+ * @param op :: Binary function combining two values
+ * @return the request, out_values is set once it has been waited for
+ */
+template <typename T, typename Op>
+Request ireduce_scatter(const Communicator &comm, const T *in_values,
+                        const std::vector<int> &counts, T *out_values,
+                        Op op) {
+  int tag{0};
+  std::vector<Request> requests;
+  const T *own_values{nullptr};
+  for (int rank = 0; rank < comm.size(); ++rank) {
+    if (rank == comm.rank())
+      own_values = in_values;
+    else
+      requests.emplace_back(comm.isend(rank, tag, in_values, counts[rank]));
+    in_values += counts[rank];
+  }
+  const int n = counts[comm.rank()];
+  auto blocks = detail::make_blocks(comm, own_values, n);
+  detail::receive_blocks(comm, tag, *blocks, n, requests);
+  return Request(std::move(requests), [blocks, n, out_values, op]() {
+    detail::combine_blocks(*blocks, n, out_values, op);
+  });
+}
+
+namespace detail {
+template <typename T, typename Op>
+void reduce(const Communicator &comm, const T *in_values, int n,
+            T *out_values, Op op, int root) {
+  ireduce(comm, in_values, n, out_values, op, root).wait();
+}
+
+template <typename T, typename Op>
+void reduce(const Communicator &comm, const T &in_value, T &out_value, Op op,
+            int root) {
+  reduce(comm, &in_value, 1, &out_value, op, root);
+}
+
+template <typename T, typename Op>
+void all_reduce(const Communicator &comm, const T *in_values, int n,
+                T *out_values, Op op) {
+  iall_reduce(comm, in_values, n, out_values, op).wait();
+}
+
+template <typename T, typename Op>
+void all_reduce(const Communicator &comm, const T &in_value, T &out_value,
+                Op op) {
+  all_reduce(comm, &in_value, 1, &out_value, op);
+}
 } // namespace detail
 
 template <typename... T> void gather(const Communicator &comm, T &&... args) {
@@ -101,6 +261,33 @@ void all_to_all(const Communicator &comm, T &&... args) {
   detail::all_to_all(comm, std::forward<T>(args)...);
 }
 
+/// Combine the values of all ranks on the root rank, see ireduce
+template <typename... T> void reduce(const Communicator &comm, T &&... args) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend())
+    return boost::mpi::reduce(comm, std::forward<T>(args)...);
+#endif
+  detail::reduce(comm, std::forward<T>(args)...);
+}
+
+/// Combine the values of all ranks on all ranks, see iall_reduce
+template <typename... T>
+void all_reduce(const Communicator &comm, T &&... args) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend())
+    return boost::mpi::all_reduce(comm, std::forward<T>(args)...);
+#endif
+  detail::all_reduce(comm, std::forward<T>(args)...);
+}
+
+/// Combine the values of all ranks and scatter the result, see
+/// ireduce_scatter
+template <typename T, typename Op>
+void reduce_scatter(const Communicator &comm, const T *in_values,
+                    const std::vector<int> &counts, T *out_values, Op op) {
+  ireduce_scatter(comm, in_values, counts, out_values, op).wait();
+}
+
 } // namespace Parallel
 } // namespace Mantid
 
@@ -12,6 +12,8 @@
 #include "MantidParallel/IO/PulseTimeGenerator.h"
 #include "MantidTypes/Core/DateAndTime.h"
 
+#include <memory>
+
 namespace Mantid {
 namespace Parallel {
 namespace IO {
@@ -19,8 +21,8 @@ namespace IO {
 /** Partition the event_time_offset and event_id entries and combine them with
   pulse time information obtained from PulseTimeGenerator. Partitioning is to
   obtain a separate vector of events for each rank in an MPI run of Mantid,
-  i.e., each event_id is assigned to a specific MPI rank. Currently a
-  round-robin partitioning scheme is hard-coded.
+  i.e., each event_id is assigned to a specific MPI rank. Unless a
+  SpectrumLayout is given the spectra are partitioned round-robin.
 
   @author Simon Heybrock
   @date 2017
@@ -33,11 +35,20 @@ template <class TimeOffsetType> struct Event {
 };
 } // namespace detail
 
+/// The partition and the index within the partition of each global spectrum
+/// index, for partitionings other than round-robin
+struct SpectrumLayout {
+  std::vector<int> partitions;
+  std::vector<int32_t> indices;
+};
+
 template <class TimeOffsetType> class AbstractEventDataPartitioner {
 public:
   using Event = detail::Event<TimeOffsetType>;
-  AbstractEventDataPartitioner(const int numWorkers)
-      : m_numWorkers(numWorkers) {}
+  AbstractEventDataPartitioner(
+      const int numWorkers,
+      std::shared_ptr<const SpectrumLayout> layout = nullptr)
+      : m_numWorkers(numWorkers), m_layout(std::move(layout)) {}
   virtual ~AbstractEventDataPartitioner() = default;
 
   /** Partition given data.
@@ -57,6 +68,7 @@ public:
 
 protected:
   const int m_numWorkers;
+  const std::shared_ptr<const SpectrumLayout> m_layout;
 };
 
 template <class IndexType, class TimeZeroType, class TimeOffsetType>
@@ -65,8 +77,10 @@ class EventDataPartitioner
 public:
   using Event = detail::Event<TimeOffsetType>;
   EventDataPartitioner(const int numWorkers,
-                       PulseTimeGenerator<IndexType, TimeZeroType> &&gen)
-      : AbstractEventDataPartitioner<TimeOffsetType>(numWorkers),
+                       PulseTimeGenerator<IndexType, TimeZeroType> &&gen,
+                       std::shared_ptr<const SpectrumLayout> layout = nullptr)
+      : AbstractEventDataPartitioner<TimeOffsetType>(numWorkers,
+                                                     std::move(layout)),
         m_pulseTimes(std::move(gen)) {}
 
   void partition(std::vector<std::vector<Event>> &partitioned,
@@ -95,8 +109,18 @@ void EventDataPartitioner<IndexType, TimeZeroType, TimeOffsetType>::partition(
   partitioned.resize(workers);
 
   m_pulseTimes.seek(range.eventOffset);
+  if (const auto &layout =
+          AbstractEventDataPartitioner<TimeOffsetType>::m_layout) {
+    for (size_t event = 0; event < range.eventCount; ++event) {
+      const auto spectrum = static_cast<size_t>(globalSpectrumIndex[event]);
+      partitioned[layout->partitions[spectrum]].emplace_back(
+          detail::Event<TimeOffsetType>{layout->indices[spectrum],
+                                        eventTimeOffset[event],
+                                        m_pulseTimes.next()});
+    }
+    return;
+  }
   for (size_t event = 0; event < range.eventCount; ++event) {
-    // Currently this supports only a hard-coded round-robin partitioning.
     int partition = globalSpectrumIndex[event] % workers;
     auto index = globalSpectrumIndex[event] / workers;
     partitioned[partition].emplace_back(detail::Event<TimeOffsetType>{
@@ -38,7 +38,8 @@ MANTID_PARALLEL_DLL void
 load(const Communicator &communicator, const std::string &filename,
      const std::string &groupName, const std::vector<std::string> &bankNames,
      const std::vector<int32_t> &bankOffsets,
-     std::vector<std::vector<Types::Event::TofEvent> *> eventLists);
+     std::vector<std::vector<Types::Event::TofEvent> *> eventLists,
+     const std::vector<int> &spectrumPartitions = {});
 
 MANTID_PARALLEL_DLL void
 load(const std::string &filename, const std::string &groupName,
@@ -32,6 +32,10 @@ H5::DataType readDataType(const H5::Group &group,
                           const std::vector<std::string> &bankNames,
                           const std::string &name);
 
+/// Layout of the spectra given the partition of each global spectrum index.
+std::shared_ptr<const SpectrumLayout>
+makeSpectrumLayout(const std::vector<int> &spectrumPartitions);
+
 template <class T> class ThreadWaiter {
 public:
   ThreadWaiter(T &thread) : m_thread(thread) {}
@@ -80,7 +84,8 @@ template <class TimeOffsetType>
 void load(const Communicator &comm, const H5::Group &group,
           const std::vector<std::string> &bankNames,
           const std::vector<int32_t> &bankOffsets,
-          std::vector<std::vector<Types::Event::TofEvent> *> eventLists) {
+          std::vector<std::vector<Types::Event::TofEvent> *> eventLists,
+          std::shared_ptr<const SpectrumLayout> layout) {
   // In tests loading from a single SSD this chunk size seems close to the
   // optimum. May need to be adjusted in the future (potentially dynamically)
   // when loading from parallel file systems and running on a cluster.
@@ -91,7 +96,8 @@ void load(const Communicator &comm, const H5::Group &group,
   // required when accessing the parallel file system.
   const Chunker chunker(comm.size(), comm.rank(),
                         readBankSizes(group, bankNames), chunkSize);
-  NXEventDataLoader<TimeOffsetType> loader(comm.size(), group, bankNames);
+  NXEventDataLoader<TimeOffsetType> loader(comm.size(), group, bankNames,
+                                           std::move(layout));
   EventParser<TimeOffsetType> consumer(comm, chunker.makeWorkerGroups(),
                                        bankOffsets, eventLists);
   load<TimeOffsetType>(chunker, loader, consumer);
@@ -32,7 +32,8 @@ template <class TimeOffsetType>
 class NXEventDataLoader : public NXEventDataSource<TimeOffsetType> {
 public:
   NXEventDataLoader(const int numWorkers, const H5::Group &group,
-                    std::vector<std::string> bankNames);
+                    std::vector<std::string> bankNames,
+                    std::shared_ptr<const SpectrumLayout> layout = nullptr);
 
   std::unique_ptr<AbstractEventDataPartitioner<TimeOffsetType>>
   setBankIndex(const size_t bank) override;
@@ -45,6 +46,7 @@ public:
 
 private:
   const int m_numWorkers;
+  const std::shared_ptr<const SpectrumLayout> m_layout;
   const H5::Group m_root;
   H5::Group m_group;
   const std::vector<std::string> m_bankNames;
@@ -99,7 +101,8 @@ std::string MANTID_PARALLEL_DLL readAttribute(const H5::DataSet &dataSet,
 
 template <class TimeOffsetType, class IndexType, class TimeZeroType>
 std::unique_ptr<AbstractEventDataPartitioner<TimeOffsetType>>
-makeEventDataPartitioner(const H5::Group &group, const int numWorkers) {
+makeEventDataPartitioner(const H5::Group &group, const int numWorkers,
+                         std::shared_ptr<const SpectrumLayout> layout) {
   const auto timeZero = group.openDataSet("event_time_zero");
   int64_t time_zero_offset{0};
   if (timeZero.attrExists("offset")) {
@@ -111,7 +114,8 @@ makeEventDataPartitioner(const H5::Group &group, const int numWorkers) {
       numWorkers, PulseTimeGenerator<IndexType, TimeZeroType>{
                       read<IndexType>(group, "event_index"),
                       read<TimeZeroType>(group, "event_time_zero"),
-                      readAttribute(timeZero, "units"), time_zero_offset});
+                      readAttribute(timeZero, "units"), time_zero_offset},
+      std::move(layout));
 }
 
 template <class R, class... T1, class... T2>
@@ -171,8 +175,9 @@ makeEventDataPartitioner(const H5::DataType &type, T2 &&... args) {
 template <class TimeOffsetType>
 NXEventDataLoader<TimeOffsetType>::NXEventDataLoader(
     const int numWorkers, const H5::Group &group,
-    std::vector<std::string> bankNames)
-    : m_numWorkers(numWorkers), m_root(group),
+    std::vector<std::string> bankNames,
+    std::shared_ptr<const SpectrumLayout> layout)
+    : m_numWorkers(numWorkers), m_layout(std::move(layout)), m_root(group),
       m_bankNames(std::move(bankNames)) {}
 
 /// Set the bank index and return a EventDataPartitioner for that bank.
@@ -185,7 +190,7 @@ NXEventDataLoader<TimeOffsetType>::setBankIndex(const size_t bank) {
   return detail::makeEventDataPartitioner<TimeOffsetType>(
       m_group.openDataSet("event_index").getDataType(),
       m_group.openDataSet("event_time_zero").getDataType(), m_group,
-      m_numWorkers);
+      m_numWorkers, m_layout);
 }
 
 /// Read subset given by start and count from event_id and write it into buffer.
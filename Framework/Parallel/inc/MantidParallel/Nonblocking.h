@@ -14,6 +14,8 @@
 #include <boost/mpi/nonblocking.hpp>
 #endif
 
+#include <algorithm>
+
 namespace Mantid {
 namespace Parallel {
 
@@ -32,7 +34,8 @@ void wait_all(ForwardIterator begin, ForwardIterator end) {
     boost::mpi::request &operator*() { return ForwardIterator::operator*(); }
     boost::mpi::request *operator->() { return &operator*(); }
   };
-  if (begin == end || !begin->hasBackend())
+  if (std::none_of(begin, end,
+                   [](const Request &request) { return request.hasBackend(); }))
     return boost::mpi::wait_all(RequestIteratorWrapper(begin),
                                 RequestIteratorWrapper(end));
 #endif
@@ -12,7 +12,9 @@
 #ifdef MPI_EXPERIMENTAL
 #include <boost/mpi/request.hpp>
 #endif
+#include <functional>
 #include <thread>
+#include <vector>
 
 namespace Mantid {
 namespace Parallel {
@@ -32,10 +34,15 @@ public:
 #ifdef MPI_EXPERIMENTAL
   Request(const boost::mpi::request &request);
 #endif
+  Request(std::vector<Request> &&requests, std::function<void()> complete);
 
   void wait();
 
-  bool hasBackend() const { return m_threadingBackend; }
+  /// True unless this wraps a plain boost::mpi::request, i.e., for the
+  /// threading backend and for requests made up of other requests.
+  bool hasBackend() const {
+    return m_threadingBackend || static_cast<bool>(m_complete);
+  }
 
 #ifdef MPI_EXPERIMENTAL
   operator boost::mpi::request &() { return m_request; }
@@ -48,6 +55,8 @@ private:
 #endif
   std::thread m_thread;
   const bool m_threadingBackend{false};
+  std::vector<Request> m_requests;
+  std::function<void()> m_complete;
   // For accessing constructor based on callable.
   friend class detail::ThreadingBackend;
 };
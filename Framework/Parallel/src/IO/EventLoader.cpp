@@ -44,16 +44,22 @@ makeAnyEventIdToBankMap(const std::string &filename,
   return idToBank;
 }
 
-/// Load events from given banks into event lists using MPI.
+/** Load events from given banks into event lists using MPI.
+ *
+ * If spectrumPartitions is given it holds the rank of each global spectrum
+ * index, otherwise the spectra are partitioned round-robin.
+ */
 void load(const Communicator &comm, const std::string &filename,
           const std::string &groupName,
           const std::vector<std::string> &bankNames,
           const std::vector<int32_t> &bankOffsets,
-          std::vector<std::vector<Types::Event::TofEvent> *> eventLists) {
+          std::vector<std::vector<Types::Event::TofEvent> *> eventLists,
+          const std::vector<int> &spectrumPartitions) {
   H5::H5File file(filename, H5F_ACC_RDONLY);
   H5::Group group = file.openGroup(groupName);
   load(readDataType(group, bankNames, "event_time_offset"), comm, group,
-       bankNames, bankOffsets, std::move(eventLists));
+       bankNames, bankOffsets, std::move(eventLists),
+       makeSpectrumLayout(spectrumPartitions));
 }
 
 /// Load events from given banks into event lists.
@@ -28,6 +28,26 @@ H5::DataType readDataType(const H5::Group &group,
   return group.openDataSet(bankNames.front() + "/" + name).getDataType();
 }
 
+/** Spectra of a partition are stored in order of their global index, so the
+ * index of a spectrum within its partition is the count of spectra of the
+ * partition before it. Returns nullptr for an empty spectrumPartitions,
+ * i.e., round-robin partitioning. */
+std::shared_ptr<const SpectrumLayout>
+makeSpectrumLayout(const std::vector<int> &spectrumPartitions) {
+  if (spectrumPartitions.empty())
+    return nullptr;
+  auto layout = std::make_shared<SpectrumLayout>();
+  layout->partitions = spectrumPartitions;
+  layout->indices.reserve(spectrumPartitions.size());
+  std::vector<int32_t> counts;
+  for (const auto partition : spectrumPartitions) {
+    if (static_cast<size_t>(partition) >= counts.size())
+      counts.resize(partition + 1, 0);
+    layout->indices.push_back(counts[partition]++);
+  }
+  return layout;
+}
+
 } // namespace EventLoader
 } // namespace IO
 } // namespace Parallel
@@ -17,7 +17,24 @@ namespace Parallel {
 Request::Request(const boost::mpi::request &request) : m_request(request) {}
 #endif
 
+/**
+ * A request that is complete once all of the given requests are. wait()
+ * then calls the given function, e.g., to combine the received data.
+ */
+Request::Request(std::vector<Request> &&requests,
+                 std::function<void()> complete)
+    : m_requests(std::move(requests)), m_complete(std::move(complete)) {}
+
 void Request::wait() {
+  if (m_complete) {
+    for (auto &request : m_requests)
+      request.wait();
+    m_requests.clear();
+    auto complete = std::move(m_complete);
+    m_complete = nullptr;
+    complete();
+    return;
+  }
   // Not returning a status since it would usually not get initialized. See
   // http://mpi-forum.org/docs/mpi-1.1/mpi-11-html/node35.html#Node35.
   if (m_threadingBackend)
@@ -67,6 +67,109 @@ void run_all_to_all(const Communicator &comm) {
     TS_ASSERT_EQUALS(result[i], 1000 * i + comm.rank());
   }
 }
+
+/// Values 0, 1, ... offset by 1000 times the rank
+std::vector<double> rank_values(const Communicator &comm, size_t n) {
+  std::vector<double> values(n);
+  for (size_t i = 0; i < n; ++i)
+    values[i] = static_cast<double>(1000 * comm.rank() + i);
+  return values;
+}
+
+/// The sum of the rank_values of all ranks
+double rank_sum(const Communicator &comm, size_t i) {
+  const int size = comm.size();
+  return static_cast<double>(1000 * size * (size - 1) / 2 + size * i);
+}
+
+void run_reduce(const Communicator &comm) {
+  int root = std::min(comm.size() - 1, 2);
+  const auto values = rank_values(comm, 5);
+  std::vector<double> result(5, -1.0);
+  TS_ASSERT_THROWS_NOTHING(Parallel::reduce(comm, values.data(), 5,
+                                            result.data(), std::plus<double>(),
+                                            root));
+  for (size_t i = 0; i < result.size(); ++i) {
+    if (comm.rank() == root) {
+      TS_ASSERT_EQUALS(result[i], rank_sum(comm, i));
+    } else {
+      TS_ASSERT_EQUALS(result[i], -1.0);
+    }
+  }
+}
+
+void run_reduce_single_value(const Communicator &comm) {
+  int value = comm.rank() + 1;
+  int result{0};
+  TS_ASSERT_THROWS_NOTHING(Parallel::reduce(
+      comm, value, result, [](int a, int b) { return std::max(a, b); }, 0));
+  if (comm.rank() == 0) {
+    TS_ASSERT_EQUALS(result, comm.size());
+  }
+}
+
+void run_all_reduce(const Communicator &comm) {
+  const auto values = rank_values(comm, 5);
+  std::vector<double> result(5);
+  TS_ASSERT_THROWS_NOTHING(Parallel::all_reduce(
+      comm, values.data(), 5, result.data(), std::plus<double>()));
+  for (size_t i = 0; i < result.size(); ++i)
+    TS_ASSERT_EQUALS(result[i], rank_sum(comm, i));
+}
+
+void run_all_reduce_single_value(const Communicator &comm) {
+  int value = comm.rank() + 1;
+  int result{0};
+  TS_ASSERT_THROWS_NOTHING(Parallel::all_reduce(
+      comm, value, result, [](int a, int b) { return std::min(a, b); }));
+  TS_ASSERT_EQUALS(result, 1);
+}
+
+void run_reduce_scatter(const Communicator &comm) {
+  // Rank r receives r + 1 values of the result
+  std::vector<int> counts;
+  for (int rank = 0; rank < comm.size(); ++rank)
+    counts.emplace_back(rank + 1);
+  const auto total = static_cast<size_t>(comm.size() * (comm.size() + 1) / 2);
+  const auto values = rank_values(comm, total);
+  std::vector<double> result(counts[comm.rank()]);
+  TS_ASSERT_THROWS_NOTHING(Parallel::reduce_scatter(
+      comm, values.data(), counts, result.data(), std::plus<double>()));
+  const auto offset =
+      static_cast<size_t>(comm.rank() * (comm.rank() + 1) / 2);
+  for (size_t i = 0; i < result.size(); ++i)
+    TS_ASSERT_EQUALS(result[i], rank_sum(comm, offset + i));
+}
+
+void run_nonblocking_reductions(const Communicator &comm) {
+  const auto values = rank_values(comm, 100);
+  std::vector<double> reduced(100);
+  std::vector<double> all_reduced(100);
+  auto reduce = Parallel::ireduce(comm, values.data(), 100, reduced.data(),
+                                  std::plus<double>(), 0);
+  TS_ASSERT_THROWS_NOTHING(reduce.wait());
+  auto all_reduce = Parallel::iall_reduce(
+      comm, values.data(), 100, all_reduced.data(), std::plus<double>());
+  TS_ASSERT_THROWS_NOTHING(all_reduce.wait());
+  for (size_t i = 0; i < 100; ++i) {
+    if (comm.rank() == 0) {
+      TS_ASSERT_EQUALS(reduced[i], rank_sum(comm, i));
+    }
+    TS_ASSERT_EQUALS(all_reduced[i], rank_sum(comm, i));
+  }
+}
+
+void run_ireduce_scatter_with_wait_all(const Communicator &comm) {
+  const std::vector<int> counts(comm.size(), 3);
+  const auto values = rank_values(comm, 3 * comm.size());
+  std::vector<double> result(3);
+  std::vector<Request> requests;
+  requests.emplace_back(Parallel::ireduce_scatter(
+      comm, values.data(), counts, result.data(), std::plus<double>()));
+  TS_ASSERT_THROWS_NOTHING(wait_all(requests.begin(), requests.end()));
+  for (size_t i = 0; i < result.size(); ++i)
+    TS_ASSERT_EQUALS(result[i], rank_sum(comm, 3 * comm.rank() + i));
+}
 } // namespace
 
 class CollectivesTest : public CxxTest::TestSuite {
@@ -85,6 +188,30 @@ public:
   void test_all_gather() { ParallelTestHelpers::runParallel(run_all_gather); }
 
   void test_all_to_all() { ParallelTestHelpers::runParallel(run_all_to_all); }
+
+  void test_reduce() { ParallelTestHelpers::runParallel(run_reduce); }
+
+  void test_reduce_single_value() {
+    ParallelTestHelpers::runParallel(run_reduce_single_value);
+  }
+
+  void test_all_reduce() { ParallelTestHelpers::runParallel(run_all_reduce); }
+
+  void test_all_reduce_single_value() {
+    ParallelTestHelpers::runParallel(run_all_reduce_single_value);
+  }
+
+  void test_reduce_scatter() {
+    ParallelTestHelpers::runParallel(run_reduce_scatter);
+  }
+
+  void test_nonblocking_reductions() {
+    ParallelTestHelpers::runParallel(run_nonblocking_reductions);
+  }
+
+  void test_ireduce_scatter_with_wait_all() {
+    ParallelTestHelpers::runParallel(run_ireduce_scatter_with_wait_all);
+  }
 };
 
 #endif /* MANTID_PARALLEL_COLLECTIVESTEST_H_ */
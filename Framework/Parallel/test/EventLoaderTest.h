@@ -193,6 +193,14 @@ public:
         "Unsupported H5::DataType for event_time_offset in NXevent_data");
   }
 
+  void test_makeSpectrumLayout() {
+    TS_ASSERT(!EventLoader::makeSpectrumLayout({}));
+    const auto layout = EventLoader::makeSpectrumLayout({0, 0, 1, 2, 1, 0});
+    TS_ASSERT_EQUALS(layout->partitions, (std::vector<int>{0, 0, 1, 2, 1, 0}));
+    TS_ASSERT_EQUALS(layout->indices,
+                     (std::vector<int32_t>{0, 1, 0, 0, 1, 2}));
+  }
+
   void test_load() {
     for (const size_t chunkSize : {37, 123, 1111}) {
       for (const auto threads : {1, 2, 3, 5, 7, 13}) {
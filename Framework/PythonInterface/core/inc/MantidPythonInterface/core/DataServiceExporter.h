@@ -8,6 +8,7 @@
 #define MANTID_PYTHONINTERFACE_DATASERVICEEXPORTER_H_
 
 #include "MantidKernel/Exception.h"
+#include "MantidPythonInterface/core/ReleaseGlobalInterpreterLock.h"
 #include "MantidPythonInterface/core/WeakPtr.h"
 
 #include <boost/python/class.hpp>
@@ -145,6 +146,8 @@ template <typename SvcType, typename SvcPtrType> struct DataServiceExporter {
 
     SvcPtrType item;
     try {
+      // A workspace spilled to disk by the ADS is read back on retrieval
+      ReleaseGlobalInterpreterLock releaseGIL;
       item = self.retrieve(name);
     } catch (Exception::NotFoundError &) {
       // Translate into a Python KeyError
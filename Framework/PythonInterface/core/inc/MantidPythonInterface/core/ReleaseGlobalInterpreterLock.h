@@ -9,6 +9,7 @@
 
 #include "MantidPythonInterface/core/DllConfig.h"
 #include <boost/python/detail/wrap_python.hpp>
+#include <utility>
 
 namespace Mantid {
 namespace PythonInterface {
@@ -31,6 +32,44 @@ private:
   PyThreadState *m_saved;
 };
 
+/**
+ * Wraps a member function in a static function, suitable for
+ * boost::python::def, that calls it without holding the GIL. Only use it for
+ * functions that do not touch Python objects, e.g.
+ * @code
+ * .def("integrate", RELEASE_GIL(&IEventList::integrate))
+ * @endcode
+ * Overloaded functions need their type spelled out:
+ * @code
+ * .def("addTof", &CallReleasingGIL<void (IEventList::*)(const double),
+ *                                  &IEventList::addTof>::call)
+ * @endcode
+ */
+template <typename MemberFn, MemberFn Fn> struct CallReleasingGIL;
+
+template <typename Result, typename Class, typename... Args,
+          Result (Class::*Fn)(Args...)>
+struct CallReleasingGIL<Result (Class::*)(Args...), Fn> {
+  static Result call(Class &self, Args... args) {
+    ReleaseGlobalInterpreterLock releaseGIL;
+    return (self.*Fn)(std::forward<Args>(args)...);
+  }
+};
+
+template <typename Result, typename Class, typename... Args,
+          Result (Class::*Fn)(Args...) const>
+struct CallReleasingGIL<Result (Class::*)(Args...) const, Fn> {
+  static Result call(const Class &self, Args... args) {
+    ReleaseGlobalInterpreterLock releaseGIL;
+    return (self.*Fn)(std::forward<Args>(args)...);
+  }
+};
+
+/// Shorthand for CallReleasingGIL of a member function that is not overloaded
+#define RELEASE_GIL(memberFn)                                                  \
+  &Mantid::PythonInterface::CallReleasingGIL<decltype(memberFn),               \
+                                             memberFn>::call
+
 } // namespace PythonInterface
 } // namespace Mantid
 
@@ -10,6 +10,7 @@
 #include "MantidPythonInterface/api/CloneMatrixWorkspace.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidKernel/MultiThreaded.h"
+#include "MantidPythonInterface/core/ReleaseGlobalInterpreterLock.h"
 
 #include <boost/python/extract.hpp>
 
@@ -73,10 +74,14 @@ PyArrayObject *cloneArray(MatrixWorkspace &workspace, DataField field,
   auto *dest = reinterpret_cast<double *>(
       PyArray_DATA(nparray)); // HEAD of the contiguous numpy data array
 
-  PARALLEL_FOR_IF(threadSafe(workspace))
-  for (npy_intp i = 0; i < numHist; ++i) {
-    const MantidVec &src = (workspace.*(dataAccesor))(start + i);
-    std::copy(src.begin(), src.end(), std::next(dest, i * stride));
+  // The array is allocated, the copy does not need the GIL
+  {
+    ReleaseGlobalInterpreterLock releaseGIL;
+    PARALLEL_FOR_IF(threadSafe(workspace))
+    for (npy_intp i = 0; i < numHist; ++i) {
+      const MantidVec &src = (workspace.*(dataAccesor))(start + i);
+      std::copy(src.begin(), src.end(), std::next(dest, i * stride));
+    }
   }
   return nparray;
 }
@@ -8,6 +8,7 @@
 #include "MantidPythonInterface/core/Converters/NDArrayToVector.h"
 #include "MantidPythonInterface/core/GetPointer.h"
 #include "MantidPythonInterface/core/Policies/VectorToNumpy.h"
+#include "MantidPythonInterface/core/ReleaseGlobalInterpreterLock.h"
 #include <boost/python/class.hpp>
 #include <boost/python/enum.hpp>
 #include <boost/python/register_ptr_to_python.hpp>
@@ -26,8 +27,16 @@ GET_POINTER_SPECIALIZATION(IEventList)
 
 namespace {
 void maskCondition(IEventList &self, const NDArray &data) {
-  self.maskCondition(Converters::NDArrayToVector<bool>(data)());
+  const auto mask = Converters::NDArrayToVector<bool>(data)();
+  ReleaseGlobalInterpreterLock releaseGIL;
+  self.maskCondition(mask);
 }
+
+// Types of the overloaded methods called without the GIL. Like the others
+// wrapped with RELEASE_GIL they visit every event of the list.
+using ConvertTof = void (IEventList::*)(const double, const double);
+using GetValues = std::vector<double> (IEventList::*)() const;
+using ScaleWeights = void (IEventList::*)(const double, const double);
 } // namespace
 /// return_value_policy for copied numpy array
 using return_clone_numpy = return_value_policy<Policies::VectorToNumpy>;
@@ -45,71 +54,73 @@ void export_IEventList() {
       "IEventList", no_init)
       .def("getEventType", &IEventList::getEventType, args("self"),
            "Return the type of events stored.")
-      .def("switchTo", &IEventList::switchTo, args("self", "newType"),
+      .def("switchTo", RELEASE_GIL(&IEventList::switchTo),
+           args("self", "newType"),
            "Switch the event type to the one specified")
       .def("clear", &IEventList::clear, args("self", "removeDetIDs"),
            "Clears the event list")
-      .def("isSortedByTof", &IEventList::isSortedByTof, args("self"),
+      .def("isSortedByTof", RELEASE_GIL(&IEventList::isSortedByTof),
+           args("self"),
            "Returns true if the list is sorted in TOF")
       .def("getNumberEvents", &IEventList::getNumberEvents, args("self"),
            "Returns the number of events within the list")
       .def("getMemorySize", &IEventList::getMemorySize, args("self"),
            "Returns the memory size in bytes")
-      .def("integrate", &IEventList::integrate,
+      .def("integrate", RELEASE_GIL(&IEventList::integrate),
            args("self", "minX", "maxX", "entireRange"),
            "Integrate the events between a range of X values, or all events.")
       .def("convertTof",
-           (void (IEventList::*)(const double, const double)) &
-               IEventList::convertTof,
+           &CallReleasingGIL<ConvertTof, &IEventList::convertTof>::call,
            args("self", "factor", "offset"),
            "Convert the time of flight by tof'=tof*factor+offset")
-      .def("scaleTof", &IEventList::scaleTof, args("self", "factor"),
+      .def("scaleTof", RELEASE_GIL(&IEventList::scaleTof),
+           args("self", "factor"),
            "Convert the tof units by scaling by a multiplier.")
-      .def("addTof", &IEventList::addTof, args("self", "offset"),
+      .def("addTof", RELEASE_GIL(&IEventList::addTof), args("self", "offset"),
            "Add an offset to the TOF of each event in the list.")
-      .def("addPulsetime", &IEventList::addPulsetime, args("self", "seconds"),
+      .def("addPulsetime", RELEASE_GIL(&IEventList::addPulsetime),
+           args("self", "seconds"),
            "Add an offset to the pulsetime (wall-clock time) of each event in "
            "the list.")
-      .def("maskTof", &IEventList::maskTof, args("self", "tofMin", "tofMax"),
+      .def("maskTof", RELEASE_GIL(&IEventList::maskTof),
+           args("self", "tofMin", "tofMax"),
            "Mask out events that have a tof between tofMin and tofMax "
            "(inclusively)")
       .def("maskCondition", &maskCondition, args("self", "mask"),
            "Mask out events by the condition vector")
       .def("getTofs",
-           (std::vector<double>(IEventList::*)(void) const) &
-               IEventList::getTofs,
+           &CallReleasingGIL<GetValues, &IEventList::getTofs>::call,
            args("self"), return_clone_numpy(),
            "Get a vector of the TOFs of the events")
       .def("getWeights",
-           (std::vector<double>(IEventList::*)(void) const) &
-               IEventList::getWeights,
+           &CallReleasingGIL<GetValues, &IEventList::getWeights>::call,
            args("self"), return_clone_numpy(),
            "Get a vector of the weights of the events")
       .def("getWeightErrors",
-           (std::vector<double>(IEventList::*)(void) const) &
-               IEventList::getWeightErrors,
+           &CallReleasingGIL<GetValues, &IEventList::getWeightErrors>::call,
            args("self"), return_clone_numpy(),
            "Get a vector of the weights of the events")
-      .def("getPulseTimes", &IEventList::getPulseTimes, args("self"),
+      .def("getPulseTimes", RELEASE_GIL(&IEventList::getPulseTimes),
+           args("self"),
            "Get a vector of the pulse times of the events")
-      .def("getPulseTimeMax", &IEventList::getPulseTimeMax, args("self"),
+      .def("getPulseTimeMax", RELEASE_GIL(&IEventList::getPulseTimeMax),
+           args("self"),
            "The maximum pulse time for the list of the events.")
-      .def("getPulseTimeMin", &IEventList::getPulseTimeMin, args("self"),
+      .def("getPulseTimeMin", RELEASE_GIL(&IEventList::getPulseTimeMin),
+           args("self"),
            "The minimum pulse time for the list of the events.")
-      .def("getTofMin", &IEventList::getTofMin, args("self"),
+      .def("getTofMin", RELEASE_GIL(&IEventList::getTofMin), args("self"),
            "The minimum tof value for the list of the events.")
-      .def("getTofMax", &IEventList::getTofMax, args("self"),
+      .def("getTofMax", RELEASE_GIL(&IEventList::getTofMax), args("self"),
            "The maximum tof value for the list of the events.")
       .def("multiply",
-           (void (IEventList::*)(const double, const double)) &
-               IEventList::multiply,
+           &CallReleasingGIL<ScaleWeights, &IEventList::multiply>::call,
            args("self", "value", "error"),
            "Multiply the weights in this event "
            "list by a scalar variable with an "
            "error; though the error can be 0.0")
       .def("divide",
-           (void (IEventList::*)(const double, const double)) &
-               IEventList::divide,
+           &CallReleasingGIL<ScaleWeights, &IEventList::divide>::call,
            args("self", "value", "error"),
            "Divide the weights in this event "
            "list by a scalar with an "
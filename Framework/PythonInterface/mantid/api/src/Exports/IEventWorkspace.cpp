@@ -7,6 +7,7 @@
 #include "MantidAPI/IEventWorkspace.h"
 #include "MantidAPI/IEventList.h"
 #include "MantidPythonInterface/core/GetPointer.h"
+#include "MantidPythonInterface/core/ReleaseGlobalInterpreterLock.h"
 #include "MantidPythonInterface/kernel/Registry/RegisterWorkspacePtrToPython.h"
 
 #include <boost/python/class.hpp>
@@ -37,18 +38,21 @@ IEventList &deprecatedGetEventList(IEventWorkspace &self, const size_t index) {
 void export_IEventWorkspace() {
   class_<IEventWorkspace, bases<Mantid::API::MatrixWorkspace>,
          boost::noncopyable>("IEventWorkspace", no_init)
-      .def("getNumberEvents", &IEventWorkspace::getNumberEvents, args("self"),
+      .def("getNumberEvents", RELEASE_GIL(&IEventWorkspace::getNumberEvents),
+           args("self"),
            "Returns the number of events in the :class:`~mantid.api.Workspace`")
-      .def("getTofMin", &IEventWorkspace::getTofMin, args("self"),
+      .def("getTofMin", RELEASE_GIL(&IEventWorkspace::getTofMin), args("self"),
            "Returns the minimum TOF value (in microseconds) held by the "
            ":class:`~mantid.api.Workspace`")
-      .def("getTofMax", &IEventWorkspace::getTofMax, args("self"),
+      .def("getTofMax", RELEASE_GIL(&IEventWorkspace::getTofMax), args("self"),
            "Returns the maximum TOF value (in microseconds) held by the "
            ":class:`~mantid.api.Workspace`")
-      .def("getPulseTimeMin", &IEventWorkspace::getPulseTimeMin, args("self"),
+      .def("getPulseTimeMin", RELEASE_GIL(&IEventWorkspace::getPulseTimeMin),
+           args("self"),
            "Returns the minimum pulse time held by the "
            ":class:`~mantid.api.Workspace`")
-      .def("getPulseTimeMax", &IEventWorkspace::getPulseTimeMax, args("self"),
+      .def("getPulseTimeMax", RELEASE_GIL(&IEventWorkspace::getPulseTimeMax),
+           args("self"),
            "Returns the maximum pulse time held by the "
            ":class:`~mantid.api.Workspace`")
       .def("getEventList", &deprecatedGetEventList,
@@ -56,7 +60,7 @@ void export_IEventWorkspace() {
            "Return the :class:`~mantid.api.IEventList` managing the events at "
            "the given :class:`~mantid.api.Workspace` "
            "index")
-      .def("clearMRU", &IEventWorkspace::clearMRU, args("self"),
+      .def("clearMRU", RELEASE_GIL(&IEventWorkspace::clearMRU), args("self"),
            "Clear the most-recently-used lists");
 
   RegisterWorkspacePtrToPython<IEventWorkspace>();
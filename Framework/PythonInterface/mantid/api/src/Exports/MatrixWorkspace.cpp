@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/Axis.h"
+#include "MantidAPI/IEventWorkspace.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/WorkspaceOpOverloads.h"
 #include "MantidGeometry/IDetector.h"
@@ -18,6 +19,7 @@
 #include "MantidPythonInterface/core/GetPointer.h"
 #include "MantidPythonInterface/core/Policies/RemoveConst.h"
 #include "MantidPythonInterface/core/Policies/VectorToNumpy.h"
+#include "MantidPythonInterface/core/ReleaseGlobalInterpreterLock.h"
 #include "MantidPythonInterface/kernel/Registry/RegisterWorkspacePtrToPython.h"
 
 #include <boost/python/class.hpp>
@@ -33,6 +35,7 @@
 
 using namespace Mantid::API;
 using namespace Mantid::Geometry;
+using namespace Mantid::HistogramData;
 using namespace Mantid::Kernel;
 using namespace Mantid::PythonInterface;
 using namespace Mantid::PythonInterface::Converters;
@@ -226,6 +229,56 @@ std::vector<size_t> maskedBinsIndices(MatrixWorkspace &self, const int i) {
   return self.maskedBinsIndices(i);
 }
 
+/// Destroys the copy of the data held by the capsule of a view
+template <typename T> void releaseSharedData(PyObject *capsule) {
+  delete static_cast<cow_ptr<T> *>(PyCapsule_GetPointer(capsule, nullptr));
+}
+
+/**
+ * Create a read-only numpy view of the X, Y or E values of a spectrum without
+ * copying them. The view holds a reference to the data, which therefore
+ * outlive the workspace if needed, and a later write to the spectrum detaches
+ * the workspace from the data of the view. Histogramming events on demand
+ * can take a while, so the GIL is released for event workspaces. Workspace2D
+ * data are returned at once as releasing the GIL would cost more than the
+ * call.
+ * @param self :: A reference to the calling object
+ * @param index :: The workspace index of the spectrum
+ * @return A new read-only numpy array
+ */
+template <typename T, cow_ptr<T> (MatrixWorkspace::*Shared)(const size_t)
+                          const>
+PyObject *readOnlyView(MatrixWorkspace &self, const size_t index) {
+  auto data = [&self, index]() {
+    if (dynamic_cast<IEventWorkspace *>(&self)) {
+      ReleaseGlobalInterpreterLock releaseGIL;
+      return (self.*Shared)(index);
+    }
+    return (self.*Shared)(index);
+  }();
+  Py_intptr_t dims[1] = {static_cast<Py_intptr_t>(data->size())};
+  auto *array = reinterpret_cast<PyArrayObject *>(PyArray_SimpleNewFromData(
+      1, dims, NPY_DOUBLE, const_cast<double *>(data->rawData().data())));
+  PyArray_CLEARFLAGS(array, NPY_ARRAY_WRITEABLE);
+  PyArray_SetBaseObject(array, PyCapsule_New(new cow_ptr<T>(std::move(data)),
+                                             nullptr, releaseSharedData<T>));
+  return reinterpret_cast<PyObject *>(array);
+}
+
+/**
+ * Compare two workspaces with CompareWorkspaces without holding the GIL
+ * @param self :: A reference to the calling object
+ * @param other :: The workspace to compare to
+ * @param tolerance :: The tolerance of the comparison
+ * @return True if the workspaces are equal
+ */
+bool equalsReleasingGIL(const MatrixWorkspace_sptr &self,
+                        const MatrixWorkspace_sptr &other,
+                        const double tolerance) {
+  ReleaseGlobalInterpreterLock releaseGIL;
+  return Mantid::API::equals(self, other, tolerance);
+}
+
 /**
  * Raw Pointer wrapper of replaceAxis to allow it to work with python
  * @param self
@@ -259,9 +312,13 @@ object getSignalAtCoord(MatrixWorkspace &self, const NDArray &npCoords,
       NDArrayToVector<Mantid::coord_t>(npCoords)();
 
   // Fill output array
-  for (int i = 0; i < length; ++i) {
-    std::array<Mantid::coord_t, 2> coord = {{coords[2 * i], coords[2 * i + 1]}};
-    signalValues[i] = self.getSignalAtCoord(coord.data(), normalization);
+  {
+    ReleaseGlobalInterpreterLock releaseGIL;
+    for (int i = 0; i < length; ++i) {
+      std::array<Mantid::coord_t, 2> coord = {
+          {coords[2 * i], coords[2 * i + 1]}};
+      signalValues[i] = self.getSignalAtCoord(coord.data(), normalization);
+    }
   }
   PyObject *npSignalArray = Impl::wrapWithNDArray(
       signalValues, 1, &length, NumpyWrapMode::ReadOnly, OwnershipMode::Python);
@@ -377,17 +434,17 @@ void export_MatrixWorkspace() {
 
       //--------------------------------------- Read spectrum data
       //-------------------------
-      .def("readX", &MatrixWorkspace::readX,
-           (arg("self"), arg("workspaceIndex")), return_readonly_numpy(),
+      .def("readX", &readOnlyView<HistogramX, &MatrixWorkspace::sharedX>,
+           (arg("self"), arg("workspaceIndex")),
            "Creates a read-only numpy wrapper "
            "around the original X data at the "
            "given index")
-      .def("readY", &MatrixWorkspace::readY, return_readonly_numpy(),
+      .def("readY", &readOnlyView<HistogramY, &MatrixWorkspace::sharedY>,
            args("self", "workspaceIndex"),
            "Creates a read-only numpy wrapper "
            "around the original Y data at the "
            "given index")
-      .def("readE", &MatrixWorkspace::readE, return_readonly_numpy(),
+      .def("readE", &readOnlyView<HistogramE, &MatrixWorkspace::sharedE>,
            args("self", "workspaceIndex"),
            "Creates a read-only numpy wrapper "
            "around the original E data at the "
@@ -462,7 +519,7 @@ void export_MatrixWorkspace() {
            "Return signal for array of coordinates")
       //-------------------------------------- Operators
       //-----------------------------------
-      .def("equals", &Mantid::API::equals, args("self", "other", "tolerance"),
+      .def("equals", &equalsReleasingGIL, args("self", "other", "tolerance"),
            "Performs a comparison operation on two workspaces, using the "
            "CompareWorkspaces algorithm")
       //---------   monitor workspace --------------------------------------
@@ -477,9 +534,9 @@ void export_MatrixWorkspace() {
            "monitor workspace later.")
       .def("clearMonitorWorkspace", &clearMonitorWorkspace, args("self"),
            "Forget about monitor workspace, attached to the current workspace")
-      .def("isCommonBins", &MatrixWorkspace::isCommonBins,
+      .def("isCommonBins", RELEASE_GIL(&MatrixWorkspace::isCommonBins),
            "Returns true if the workspace has common X bins.")
-      .def("isCommonLogBins", &MatrixWorkspace::isCommonLogBins,
+      .def("isCommonLogBins", RELEASE_GIL(&MatrixWorkspace::isCommonLogBins),
            "Returns true if the workspace has common X bins with log spacing.");
 
   RegisterWorkspacePtrToPython<MatrixWorkspace>();
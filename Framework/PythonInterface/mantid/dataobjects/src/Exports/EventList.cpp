@@ -6,12 +6,22 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventList.h"
 #include "MantidPythonInterface/core/GetPointer.h"
+#include "MantidPythonInterface/core/ReleaseGlobalInterpreterLock.h"
 #include <boost/python/class.hpp>
 #include <boost/python/register_ptr_to_python.hpp>
 #include <boost/python/return_arg.hpp>
 
+#include <algorithm>
+#include <type_traits>
+
+#define PY_ARRAY_UNIQUE_SYMBOL DATAOBJECTS_ARRAY_API
+#define NO_IMPORT_ARRAY
+#include <numpy/arrayobject.h>
+
 using namespace boost::python;
 using namespace Mantid::DataObjects;
+using Mantid::PythonInterface::CallReleasingGIL;
+using Mantid::Types::Event::TofEvent;
 
 GET_POINTER_SPECIALIZATION(EventList)
 
@@ -20,6 +30,103 @@ void addEventToEventList(EventList &self, double tof,
                          Mantid::Types::Core::DateAndTime pulsetime) {
   self.addEventQuickly(Mantid::Types::Event::TofEvent(tof, pulsetime));
 }
+
+/// Type of the operators combining event lists, called without the GIL
+using CombineEventLists = EventList &(EventList::*)(const EventList &);
+
+// The TOF is the first member of each event type, so a pointer to an event
+// is a pointer to its TOF. The packed layouts leave no room before it.
+static_assert(std::is_standard_layout<TofEvent>::value,
+              "TofEvent must start with its TOF");
+static_assert(sizeof(WeightedEventNoTime) ==
+                  sizeof(double) + 2 * sizeof(float),
+              "WeightedEventNoTime must start with its TOF");
+
+/// @return A pointer to the TOF of the first of the events
+template <typename EventType>
+const double *firstTof(const std::vector<EventType> &events) {
+  return reinterpret_cast<const double *>(events.data());
+}
+
+template <>
+const double *firstTof(const std::vector<WeightedEvent> &events) {
+  return reinterpret_cast<const double *>(
+      static_cast<const TofEvent *>(events.data()));
+}
+
+/**
+ * Create a read-only numpy view of one field of the events of a list, which
+ * are stored together with their other fields, without copying them. The view
+ * keeps the list, and so the workspace, alive but changes to the events of
+ * the list invalidate it.
+ * @param self :: The Python object of the list
+ * @param first :: A pointer to the field of the first event
+ * @param size :: The number of events
+ * @param stride :: The size of an event
+ * @return A new read-only numpy array
+ */
+template <typename T>
+PyObject *viewOfEvents(const object &self, const T *first, const size_t size,
+                       const size_t stride) {
+  const int typenum = std::is_same<T, float>::value ? NPY_FLOAT : NPY_DOUBLE;
+  Py_intptr_t dims[1] = {static_cast<Py_intptr_t>(size)};
+  if (size == 0)
+    return PyArray_SimpleNew(1, dims, typenum);
+  Py_intptr_t strides[1] = {static_cast<Py_intptr_t>(stride)};
+  auto *array = reinterpret_cast<PyArrayObject *>(
+      PyArray_New(&PyArray_Type, 1, dims, typenum, strides,
+                  const_cast<T *>(first), 0, NPY_ARRAY_ALIGNED, nullptr));
+  Py_INCREF(self.ptr());
+  PyArray_SetBaseObject(array, self.ptr());
+  return reinterpret_cast<PyObject *>(array);
+}
+
+/// Create a read-only numpy view of the TOFs of the events of a list
+PyObject *readTofs(const object &self) {
+  const EventList &eventList = extract<const EventList &>(self)();
+  const size_t size = eventList.getNumberEvents();
+  switch (eventList.getEventType()) {
+  case Mantid::API::WEIGHTED:
+    return viewOfEvents(self, firstTof(eventList.getWeightedEvents()), size,
+                        sizeof(WeightedEvent));
+  case Mantid::API::WEIGHTED_NOTIME:
+    return viewOfEvents(self, firstTof(eventList.getWeightedEventsNoTime()),
+                        size, sizeof(WeightedEventNoTime));
+  default:
+    return viewOfEvents(self, firstTof(eventList.getEvents()), size,
+                        sizeof(TofEvent));
+  }
+}
+
+/**
+ * Create a read-only numpy view of the weights of the events of a list.
+ * Unweighted events have no weights to view, so a new array of ones is
+ * returned for them.
+ */
+PyObject *readWeights(const object &self) {
+  const EventList &eventList = extract<const EventList &>(self)();
+  const size_t size = eventList.getNumberEvents();
+  switch (eventList.getEventType()) {
+  case Mantid::API::WEIGHTED: {
+    const auto &events = eventList.getWeightedEvents();
+    return viewOfEvents(self, size > 0 ? &events.front().m_weight : nullptr,
+                        size, sizeof(WeightedEvent));
+  }
+  case Mantid::API::WEIGHTED_NOTIME: {
+    const auto &events = eventList.getWeightedEventsNoTime();
+    return viewOfEvents(self, size > 0 ? &events.front().m_weight : nullptr,
+                        size, sizeof(WeightedEventNoTime));
+  }
+  default: {
+    Py_intptr_t dims[1] = {static_cast<Py_intptr_t>(size)};
+    auto *array = PyArray_SimpleNew(1, dims, NPY_FLOAT);
+    auto *weights = static_cast<float *>(
+        PyArray_DATA(reinterpret_cast<PyArrayObject *>(array)));
+    std::fill(weights, weights + size, 1.f);
+    return array;
+  }
+  }
+}
 } // namespace
 
 void export_EventList() {
@@ -31,11 +138,17 @@ void export_EventList() {
            args("self", "tof", "pulsetime"),
            "Create TofEvent and add to EventList.")
       .def("__iadd__",
-           (EventList & (EventList::*)(const EventList &)) &
-               EventList::operator+=,
+           &CallReleasingGIL<CombineEventLists, &EventList::operator+=>::call,
            return_self<>(), (arg("self"), arg("other")))
       .def("__isub__",
-           (EventList & (EventList::*)(const EventList &)) &
-               EventList::operator-=,
-           return_self<>(), (arg("self"), arg("other")));
+           &CallReleasingGIL<CombineEventLists, &EventList::operator-=>::call,
+           return_self<>(), (arg("self"), arg("other")))
+      .def("readTofs", &readTofs, arg("self"),
+           "Creates a read-only numpy array of the TOFs of the events "
+           "without copying them. It is invalidated by changes to the "
+           "events.")
+      .def("readWeights", &readWeights, arg("self"),
+           "Creates a read-only numpy array of the weights of the events "
+           "without copying them. It is invalidated by changes to the "
+           "events.");
 }
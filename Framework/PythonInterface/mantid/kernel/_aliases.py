@@ -11,7 +11,8 @@
 from __future__ import (absolute_import, division,
                         print_function)
 
-from mantid.kernel import (ConfigServiceImpl, Logger, PropertyManagerDataServiceImpl, UnitFactoryImpl, UsageServiceImpl)
+from mantid.kernel import (ConfigServiceImpl, Logger, PropertyManagerDataServiceImpl, RuntimeCountersImpl,
+                           UnitFactoryImpl, UsageServiceImpl)
 
 
 def lazy_instance_access(cls):
@@ -63,6 +64,7 @@ UsageService = lazy_instance_access(UsageServiceImpl)
 ConfigService = lazy_instance_access(ConfigServiceImpl)
 PropertyManagerDataService = lazy_instance_access(PropertyManagerDataServiceImpl)
 UnitFactory = lazy_instance_access(UnitFactoryImpl)
+RuntimeCounters = lazy_instance_access(RuntimeCountersImpl)
 
 config = ConfigService
 pmds = PropertyManagerDataService
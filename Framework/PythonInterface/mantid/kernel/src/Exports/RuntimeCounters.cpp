@@ -0,0 +1,56 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/RuntimeCounters.h"
+#include "MantidPythonInterface/core/GetPointer.h"
+#include <boost/python/class.hpp>
+#include <boost/python/dict.hpp>
+#include <boost/python/reference_existing_object.hpp>
+
+using Mantid::Kernel::RuntimeCounters;
+using Mantid::Kernel::RuntimeCountersImpl;
+using namespace boost::python;
+
+GET_POINTER_SPECIALIZATION(RuntimeCountersImpl)
+
+namespace {
+/// @return a reference to the RuntimeCounters object
+RuntimeCountersImpl &instance() { return RuntimeCounters::Instance(); }
+
+/// @return a dict of the values of all counters by name
+dict values(RuntimeCountersImpl &self) {
+  dict result;
+  for (const auto &item : self.values())
+    result[item.first] = item.second;
+  return result;
+}
+
+/// Add to a counter
+void add(RuntimeCountersImpl &self, const std::string &name,
+         const uint64_t amount) {
+  self.add(name, amount);
+}
+} // namespace
+
+void export_RuntimeCounters() {
+
+  class_<RuntimeCountersImpl, boost::noncopyable>("RuntimeCountersImpl",
+                                                  no_init)
+      .def("value", &RuntimeCountersImpl::value, (arg("self"), arg("name")),
+           "Returns the value of a counter, 0 if it does not exist.")
+      .def("values", &values, arg("self"),
+           "Returns a dict of the values of all counters by name.")
+      .def("add", &add, (arg("self"), arg("name"), arg("amount") = 1),
+           "Adds to a counter, creating it if necessary.")
+      .def("reset", &RuntimeCountersImpl::reset, arg("self"),
+           "Sets all counters back to zero.")
+      .def("prometheus", &RuntimeCountersImpl::prometheus, arg("self"),
+           "Returns all counters in the Prometheus text format.")
+      .def("Instance", instance,
+           return_value_policy<reference_existing_object>(),
+           "Returns a reference to the RuntimeCounters")
+      .staticmethod("Instance");
+}
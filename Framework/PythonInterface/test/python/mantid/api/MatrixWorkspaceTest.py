@@ -9,6 +9,7 @@ from __future__ import (absolute_import, print_function)
 import unittest
 import sys
 import math
+import threading
 from testhelpers import create_algorithm, run_algorithm, can_be_instantiated, WorkspaceCreationHelper
 from mantid.api import (MatrixWorkspace, MatrixWorkspaceProperty, WorkspaceProperty, Workspace,
                         ExperimentInfo, AnalysisDataService, WorkspaceFactory)
@@ -138,6 +139,15 @@ class MatrixWorkspaceTest(unittest.TestCase):
         for attr in [x, y, e, dx]:
             do_numpy_test(attr)
 
+    def test_read_views_keep_their_data_when_the_workspace_changes(self):
+        ws = CreateSampleWorkspace(NumBanks=1, BankPixelWidth=1, StoreInADS=False)
+        y = ws.readY(0)
+        expected = y.copy()
+        ws.dataY(0)[:] = -1.0
+        np.testing.assert_array_equal(y, expected)
+        del ws
+        np.testing.assert_array_equal(y, expected)
+
     def test_setting_spectra_from_array_of_incorrect_length_raises_error(self):
         nvectors = 2
         xlength = 11
@@ -223,6 +233,24 @@ class MatrixWorkspaceTest(unittest.TestCase):
         self.assertTrue(len(dx), 0)
         self._do_numpy_comparison(self._test_ws, x, y, e)
 
+    def test_data_can_be_extracted_from_several_threads(self):
+        ws = CreateSampleWorkspace(WorkspaceType='Event', NumBanks=1, BankPixelWidth=4,
+                                   StoreInADS=False)
+        expected = ws.extractY()
+        results = [None] * 4
+
+        def extract(index):
+            results[index] = (ws.extractY(), ws.readY(index).copy())
+
+        threads = [threading.Thread(target=extract, args=(i,)) for i in range(len(results))]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        for index, (y, y_index) in enumerate(results):
+            np.testing.assert_array_equal(y, expected)
+            np.testing.assert_array_equal(y_index, expected[index])
+
     def _do_numpy_comparison(self, workspace, x_np, y_np, e_np, index=None):
         if index is None:
             nhist = workspace.getNumberHistograms()
@@ -8,6 +8,7 @@
 from __future__ import (absolute_import, division, print_function)
 
 import unittest
+import numpy as np
 
 from mantid.kernel import DateAndTime
 from mantid.api import EventType
@@ -35,6 +36,25 @@ class EventListTest(unittest.TestCase):
         self.assertEqual(el.getPulseTimes()[0], DateAndTime(42))
 
 
+    def test_readTofs_views_the_events(self):
+        el = self.createRandomEventList(5)
+        tofs = el.readTofs()
+        self.assertFalse(tofs.flags.writeable)
+        np.testing.assert_array_equal(tofs, el.getTofs())
+        el.switchTo(EventType.WEIGHTED)
+        np.testing.assert_array_equal(el.readTofs(), el.getTofs())
+        el.switchTo(EventType.WEIGHTED_NOTIME)
+        np.testing.assert_array_equal(el.readTofs(), el.getTofs())
+
+    def test_readWeights_views_the_weights(self):
+        el = self.createRandomEventList(5)
+        np.testing.assert_array_equal(el.readWeights(), np.ones(5))
+        el.switchTo(EventType.WEIGHTED)
+        el.multiply(2.0, 0.0)
+        weights = el.readWeights()
+        self.assertFalse(weights.flags.writeable)
+        np.testing.assert_array_equal(weights, el.getWeights())
+
     def test_event_list_iadd(self):
         left = self.createRandomEventList(10)
         rght = self.createRandomEventList(20)
@@ -0,0 +1,34 @@
+# Mantid Repository : https://github.com/mantidproject/mantid
+#
+# Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+#     NScD Oak Ridge National Laboratory, European Spallation Source
+#     & Institut Laue - Langevin
+# SPDX - License - Identifier: GPL - 3.0 +
+from __future__ import (absolute_import, division, print_function, unicode_literals)
+
+import unittest
+
+from mantid.kernel import (RuntimeCounters, RuntimeCountersImpl)
+
+
+class RuntimeCountersTest(unittest.TestCase):
+
+    def setUp(self):
+        RuntimeCounters.reset()
+
+    def test_singleton_returns_instance_of_RuntimeCounters(self):
+        self.assertTrue(isinstance(RuntimeCounters, RuntimeCountersImpl))
+
+    def test_add_and_value(self):
+        RuntimeCounters.add("python_test_counter")
+        RuntimeCounters.add("python_test_counter", 4)
+        self.assertEqual(RuntimeCounters.value("python_test_counter"), 5)
+        self.assertEqual(RuntimeCounters.values()["python_test_counter"], 5)
+
+    def test_prometheus(self):
+        RuntimeCounters.add("python_test_counter", 2)
+        self.assertTrue("mantid_python_test_counter 2\n" in RuntimeCounters.prometheus())
+
+
+if __name__ == '__main__':
+    unittest.main()
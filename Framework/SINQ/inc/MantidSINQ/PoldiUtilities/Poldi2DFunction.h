@@ -46,6 +46,9 @@ public:
   void iterationFinished() override;
 
 private:
+  std::vector<std::pair<API::IFunction_sptr, size_t>>
+  getMemberFunctions() const;
+
   size_t m_iteration;
 };
 
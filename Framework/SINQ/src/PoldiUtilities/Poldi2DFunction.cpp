@@ -5,12 +5,40 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidSINQ/PoldiUtilities/Poldi2DFunction.h"
+#include "MantidKernel/MultiThreaded.h"
+
 #include <cmath>
+#include <exception>
 
 namespace Mantid {
 namespace Poldi {
 using namespace API;
 
+namespace {
+/**
+ * Runs evaluate(i) for each i in [0, n) in parallel. Exceptions can not leave
+ * the parallel loop, so the first one is rethrown once all threads are done.
+ */
+template <typename Evaluate>
+void evaluateInParallel(size_t n, Evaluate evaluate) {
+  std::exception_ptr exception;
+  const auto count = static_cast<int>(n);
+  PARALLEL_FOR_IF(count > 1)
+  for (int i = 0; i < count; ++i) {
+    try {
+      evaluate(static_cast<size_t>(i));
+    } catch (...) {
+      PARALLEL_CRITICAL(Poldi2DFunction_exception) {
+        if (!exception)
+          exception = std::current_exception();
+      }
+    }
+  }
+  if (exception)
+    std::rethrow_exception(exception);
+}
+} // namespace
+
 Poldi2DFunction::Poldi2DFunction()
     : IFunction1DSpectrum(), CompositeFunction(), m_iteration(0) {}
 
@@ -28,7 +56,20 @@ Poldi2DFunction::Poldi2DFunction()
  */
 void Poldi2DFunction::function(const FunctionDomain &domain,
                                FunctionValues &values) const {
-  CompositeFunction::function(domain, values);
+  const auto members = getMemberFunctions();
+
+  // Each peak is calculated into its own values, which are summed in a fixed
+  // order afterwards so that the result does not depend on the threads.
+  std::vector<FunctionValues> memberValues(members.size(),
+                                           FunctionValues(domain));
+  evaluateInParallel(members.size(), [&](size_t i) {
+    members[i].first->function(domain, memberValues[i]);
+  });
+
+  values.zeroCalculated();
+  for (const auto &memberValue : memberValues) {
+    values += memberValue;
+  }
 
   if (m_iteration > 0) {
     for (size_t i = 0; i < values.size(); ++i) {
@@ -38,15 +79,25 @@ void Poldi2DFunction::function(const FunctionDomain &domain,
 }
 
 /**
- * Calculates function derivatives. Simply calls
- *CompositeFunction::functionDeriv
+ * Calculates function derivatives. Unless numerical derivatives are requested,
+ * the member functions are handled in parallel. Each of them only writes the
+ * columns of its own parameters, so they do not interfere.
  *
  * @param domain :: Function domain which is passed on to the member functions.
  * @param jacobian :: Jacobian.
  */
 void Poldi2DFunction::functionDeriv(const FunctionDomain &domain,
                                     Jacobian &jacobian) {
-  CompositeFunction::functionDeriv(domain, jacobian);
+  if (getAttribute("NumDeriv").asBool()) {
+    CompositeFunction::functionDeriv(domain, jacobian);
+    return;
+  }
+
+  const auto members = getMemberFunctions();
+  evaluateInParallel(members.size(), [&](size_t i) {
+    PartialJacobian partialJacobian(&jacobian, members[i].second);
+    members[i].first->functionDeriv(domain, partialJacobian);
+  });
 }
 
 /**
@@ -90,5 +141,31 @@ void Poldi2DFunction::poldiFunction1D(const std::vector<int> &indices,
 
 void Poldi2DFunction::iterationFinished() { ++m_iteration; }
 
+/**
+ * Returns the functions that make up this function together with the offsets
+ * of their parameters. Nested Poldi2DFunctions (one per peak collection) are
+ * replaced by their members, so that all peaks can be evaluated concurrently.
+ *
+ * @return Pairs of member function and parameter offset.
+ */
+std::vector<std::pair<IFunction_sptr, size_t>>
+Poldi2DFunction::getMemberFunctions() const {
+  std::vector<std::pair<IFunction_sptr, size_t>> members;
+  for (size_t i = 0; i < nFunctions(); ++i) {
+    IFunction_sptr currentFunction = getFunction(i);
+    auto nested = boost::dynamic_pointer_cast<Poldi2DFunction>(currentFunction);
+
+    if (nested && !nested->getAttribute("NumDeriv").asBool()) {
+      for (const auto &member : nested->getMemberFunctions()) {
+        members.emplace_back(member.first, member.second + paramOffset(i));
+      }
+    } else {
+      members.emplace_back(currentFunction, paramOffset(i));
+    }
+  }
+
+  return members;
+}
+
 } // namespace Poldi
 } // namespace Mantid
@@ -312,15 +312,15 @@ PoldiAutoCorrelationCore::getRawCorrelatedIntensity(double dValue,
        * These pairs are put into a vector for later analysis. The size of this
        * vector
        * is equal to the number of chopper slits.
+       *
+       * The contributions are summed as they are calculated, this is called
+       * for every point of the d-grid, so no temporary is allocated here.
        */
-      std::vector<UncertainValue> cmess(m_detector->elementCount());
-      std::transform(m_indices.begin(), m_indices.end(), cmess.begin(),
-                     boost::bind(&PoldiAutoCorrelationCore::getCMessAndCSigma,
-                                 this, dValue, slitOffset, _1));
-
-      UncertainValue sum =
-          std::accumulate(cmess.begin(), cmess.end(), UncertainValue(0.0, 0.0),
-                          &UncertainValue::plainAddition);
+      UncertainValue sum(0.0, 0.0);
+      for (int index : m_indices) {
+        sum = UncertainValue::plainAddition(
+            sum, getCMessAndCSigma(dValue, slitOffset, index));
+      }
 
       current.push_back(sum);
     }
@@ -678,15 +678,19 @@ double PoldiAutoCorrelationCore::getTofFromIndex(int index) const {
  */
 double PoldiAutoCorrelationCore::getSumOfCounts(
     int timeBinCount, const std::vector<int> &detectorElements) const {
-  double sum = 0.0;
+  const auto elementCount = static_cast<int>(detectorElements.size());
+  std::vector<double> elementSums(detectorElements.size(), 0.0);
 
-  for (int t = 0; t < timeBinCount; ++t) {
-    for (auto detectorElement : detectorElements) {
-      sum += getCounts(detectorElement, t);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < elementCount; ++i) {
+    double elementSum = 0.0;
+    for (int t = 0; t < timeBinCount; ++t) {
+      elementSum += getCounts(detectorElements[i], t);
     }
+    elementSums[i] = elementSum;
   }
 
-  return sum;
+  return std::accumulate(elementSums.cbegin(), elementSums.cend(), 0.0);
 }
 
 } // namespace Poldi
@@ -29,43 +29,63 @@ public:
   SpectrumDefinition() = default;
   explicit SpectrumDefinition(const size_t detectorIndex,
                               const size_t timeIndex = 0)
-      : m_data{{detectorIndex, timeIndex}} {}
+      : m_single{detectorIndex, timeIndex}, m_hasSingle(true) {}
 
   /// Returns the size of the SpectrumDefinition, i.e., the number of detectors
   /// (or rather detector positions) that the spectrum comprises.
-  size_t size() const { return m_data.size(); }
+  size_t size() const {
+    return m_data.empty() ? static_cast<size_t>(m_hasSingle) : m_data.size();
+  }
 
   /// Returns a const reference to the pair of detector index and time index at
   /// the given `index` in the spectrum definition.
   const std::pair<size_t, size_t> &operator[](const size_t index) const {
-    return m_data[index];
+    return begin()[index];
   }
 
   /// Adds a pair of detector index and time index to the spectrum definition.
   /// The time index defaults to zero when not specified.
   void add(const size_t detectorIndex, const size_t timeIndex = 0) {
     auto index = std::make_pair(detectorIndex, timeIndex);
+    if (m_data.empty()) {
+      if (!m_hasSingle) {
+        m_single = index;
+        m_hasSingle = true;
+        return;
+      }
+      if (m_single == index)
+        return;
+      m_data.push_back(m_single);
+    }
     auto it = std::lower_bound(m_data.begin(), m_data.end(), index);
     if ((it == m_data.end()) || (*it != index))
       m_data.emplace(it, index);
   }
 
   bool operator==(const SpectrumDefinition &other) const {
-    return m_data == other.m_data;
+    return size() == other.size() &&
+           std::equal(cbegin(), cend(), other.cbegin());
+  }
+
+  /// Returns an iterator to the first element of the index pairs.
+  const std::pair<size_t, size_t> *begin() const {
+    return m_data.empty() ? &m_single : m_data.data();
   }
+  /// Returns an iterator past the last element of the index pairs.
+  const std::pair<size_t, size_t> *end() const { return begin() + size(); }
+  /// Returns an iterator to the first element of the index pairs.
+  const std::pair<size_t, size_t> *cbegin() const { return begin(); }
+  /// Returns an iterator past the last element of the index pairs.
+  const std::pair<size_t, size_t> *cend() const { return end(); }
 
 private:
+  /// The index pair of a spectrum with a single detector, which is the common
+  /// case, held without allocating. Unused once m_data holds the pairs.
+  std::pair<size_t, size_t> m_single{0, 0};
+  /// Whether m_single is set
+  bool m_hasSingle{false};
+  /// The sorted index pairs once there is more than one
   std::vector<std::pair<size_t, size_t>> m_data;
-
-public:
-  /// Returns an iterator to the first element of the vector of index pairs.
-  auto begin() const -> decltype(m_data.begin()) { return m_data.begin(); }
-  /// Returns an iterator to the last element of the vector of index pairs.
-  auto end() const -> decltype(m_data.end()) { return m_data.end(); }
-  /// Returns an iterator to the first element of the vector of index pairs.
-  auto cbegin() const -> decltype(m_data.cbegin()) { return m_data.cbegin(); }
-  /// Returns an iterator to the last element of the vector of index pairs.
-  auto cend() const -> decltype(m_data.cend()) { return m_data.cend(); }
 };
 
 } // namespace Mantid
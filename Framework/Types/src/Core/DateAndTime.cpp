@@ -48,6 +48,133 @@ std::tm *gmtime_r_portable(const std::time_t *clock, struct std::tm *result) {
   return gmtime_r(clock, result);
 #endif
 }
+
+/// Days from 1970-01-01 to 1990-01-01, the GPS epoch
+const int64_t EPOCH_DAYS_FROM_1970 = 7305;
+
+/** Read exactly n decimal digits of a string.
+ * @param str :: the string
+ * @param pos :: position of the first digit, moved past the last on success
+ * @param n :: the number of digits
+ * @param value :: [Output] the value of the digits
+ * @return true if there were n digits at pos
+ */
+bool readDigits(const std::string &str, size_t &pos, const size_t n,
+                int &value) {
+  if (pos + n > str.size())
+    return false;
+  value = 0;
+  for (size_t i = pos; i < pos + n; ++i) {
+    const char c = str[i];
+    if (c < '0' || c > '9')
+      return false;
+    value = 10 * value + (c - '0');
+  }
+  pos += n;
+  return true;
+}
+
+/// Returns the number of days from 1970-01-01 to a date of the proleptic
+/// Gregorian calendar (H. Hinnant's days_from_civil)
+int64_t daysFromCivil(int year, const int month, const int day) {
+  year -= month <= 2;
+  const int era = year / 400;
+  const int yearOfEra = year - era * 400;
+  const int monthOfYear = month + (month > 2 ? -3 : 9);
+  const int dayOfYear = (153 * monthOfYear + 2) / 5 + day - 1;
+  const int dayOfEra =
+      yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return static_cast<int64_t>(era) * 146097 + dayOfEra - 719468;
+}
+
+/// Returns the number of days in a month of a year
+int daysInMonth(const int year, const int month) {
+  static const int days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  return (month == 2 && leap) ? 29 : days[month - 1];
+}
+
+/** Parse the common extended ISO8601 form
+ * "yyyy-mm-dd[T ]hh:mm[:ss[.fffffffff]][Z|+hh[:mm]|-hh[:mm]]", where a time
+ * zone may only follow a 'T', without allocating.
+ *
+ * Strings in any other form, with out of range fields or with years far
+ * enough from 1990 that the nanoseconds could overflow are rejected, so the
+ * caller can leave them to the general parser. The result is the same as
+ * that parser's for all accepted strings.
+ *
+ * @param str :: the string to parse
+ * @param nanoseconds :: [Output] nanoseconds since the GPS epoch
+ * @return true if the string was parsed
+ */
+bool parseExtendedISO8601(const std::string &str, int64_t &nanoseconds) {
+  size_t pos = 0;
+  int year, month, day, hour, minute, second = 0;
+  if (!readDigits(str, pos, 4, year) || pos >= str.size() ||
+      str[pos++] != '-' || !readDigits(str, pos, 2, month) ||
+      pos >= str.size() || str[pos++] != '-' ||
+      !readDigits(str, pos, 2, day) || pos >= str.size())
+    return false;
+  const char separator = str[pos++];
+  if ((separator != 'T' && separator != ' ') ||
+      !readDigits(str, pos, 2, hour) || pos >= str.size() ||
+      str[pos++] != ':' || !readDigits(str, pos, 2, minute))
+    return false;
+  if (pos < str.size() && str[pos] == ':') {
+    ++pos;
+    if (!readDigits(str, pos, 2, second))
+      return false;
+  }
+  int64_t fraction = 0;
+  if (pos < str.size() && str[pos] == '.') {
+    ++pos;
+    size_t digits = 0;
+    while (pos < str.size() && str[pos] >= '0' && str[pos] <= '9') {
+      // More than nanosecond precision is left to the general parser
+      if (++digits > 9)
+        return false;
+      fraction = 10 * fraction + (str[pos++] - '0');
+    }
+    if (digits == 0)
+      return false;
+    for (; digits < 9; ++digits)
+      fraction *= 10;
+  }
+  int64_t offsetMinutes = 0;
+  if (pos < str.size()) {
+    if (separator != 'T')
+      return false;
+    const char zone = str[pos++];
+    if (zone == 'Z') {
+      if (pos != str.size())
+        return false;
+    } else if (zone == '+' || zone == '-') {
+      int offsetHours, offsetMins = 0;
+      if (!readDigits(str, pos, 2, offsetHours))
+        return false;
+      if (pos < str.size()) {
+        if (str[pos++] != ':' || !readDigits(str, pos, 2, offsetMins) ||
+            pos != str.size())
+          return false;
+      }
+      offsetMinutes = 60 * offsetHours + offsetMins;
+      if (zone == '-')
+        offsetMinutes = -offsetMinutes;
+    } else {
+      return false;
+    }
+  }
+  if (year < 1800 || year > 2199 || month < 1 || month > 12 || day < 1 ||
+      day > daysInMonth(year, month) || hour > 23 || minute > 59 ||
+      second > 59)
+    return false;
+
+  const int64_t days = daysFromCivil(year, month, day) - EPOCH_DAYS_FROM_1970;
+  const int64_t seconds =
+      ((days * 24 + hour) * 60 + minute - offsetMinutes) * 60 + second;
+  nanoseconds = seconds * NANO_PER_SEC + fraction;
+  return true;
+}
 } // namespace
 
 //-----------------------------------------------------------------------------------------------
@@ -343,6 +470,15 @@ const DateAndTime &DateAndTime::defaultTime() {
  *               "yyyy-mm-ddThh:mm:ss[Z+-]tz:tz" or "yyy-MMM-dd hh:mm:ss.ssss"
  */
 void DateAndTime::setFromISO8601(const std::string &str) {
+  // Most strings are in the extended format, which is parsed directly. Times
+  // beyond the limits are left to the general parser, which clamps them.
+  int64_t nanoseconds;
+  if (parseExtendedISO8601(str, nanoseconds) &&
+      nanoseconds <= MAX_NANOSECONDS && nanoseconds >= MIN_NANOSECONDS) {
+    _nanoseconds = nanoseconds;
+    return;
+  }
+
   if (!DateAndTimeHelpers::stringIsISO8601(str) &&
       !DateAndTimeHelpers::stringIsPosix(str)) {
     throw std::invalid_argument("Error interpreting string '" + str +
@@ -387,6 +387,32 @@ public:
         1e-4);
   }
 
+  void test_ISO8601_extended_format_fields() {
+    TS_ASSERT_EQUALS(DateAndTime("1990-01-01T00:00").totalNanoseconds(), 0);
+    TS_ASSERT_EQUALS(DateAndTime("2000-02-29T23:59:59.999999999"),
+                     DateAndTime("2000-03-01T00:00:00") - int64_t(1));
+    TS_ASSERT_EQUALS(DateAndTime("1970-01-01T00:00:00").totalNanoseconds(),
+                     -631152000000000000LL);
+    // Digits beyond nanoseconds are truncated
+    TS_ASSERT_EQUALS(DateAndTime("2010-03-24T14:12:51.1234567891"),
+                     DateAndTime("2010-03-24T14:12:51.123456789"));
+    TS_ASSERT_THROWS(DateAndTime("2010-02-29T00:00:00"),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS(DateAndTime("2010-13-01T00:00:00"),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS(DateAndTime("2010-03-24T14:12:51."),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS(DateAndTime("2010-01-01 10:00:00Z"),
+                     const std::invalid_argument &);
+  }
+
+  void test_ISO8601_beyond_limits_is_clamped() {
+    TS_ASSERT_EQUALS(DateAndTime("2164-10-17T02:11:43.320Z"),
+                     DateAndTime::maximum());
+    TS_ASSERT_EQUALS(DateAndTime("1808-11-12T01:33:33+10"),
+                     DateAndTime::minimum());
+  }
+
   void testDurations() {
     time_duration onesec = time_duration(0, 0, 1, 0);
     TS_ASSERT_EQUALS(DateAndTime::secondsFromDuration(onesec), 1.0);
@@ -106,6 +106,40 @@ public:
     TS_ASSERT_EQUALS(*(def.begin()), (std::pair<size_t, size_t>(1, 0)));
     TS_ASSERT_EQUALS(*(def.cbegin()), (std::pair<size_t, size_t>(1, 0)));
   }
+
+  void test_iterators_after_growing() {
+    SpectrumDefinition def(3);
+    def.add(1);
+    def.add(2);
+    TS_ASSERT_EQUALS(def.begin() + 3, def.end());
+    const std::vector<std::pair<size_t, size_t>> expected{
+        {1, 0}, {2, 0}, {3, 0}};
+    TS_ASSERT(std::equal(def.begin(), def.end(), expected.begin()));
+  }
+
+  void test_equality() {
+    SpectrumDefinition single(1);
+    SpectrumDefinition added;
+    added.add(1);
+    TS_ASSERT(single == added);
+    TS_ASSERT(!(single == SpectrumDefinition()));
+    TS_ASSERT(!(single == SpectrumDefinition(1, 1)));
+    added.add(2);
+    TS_ASSERT(!(single == added));
+    single.add(2);
+    TS_ASSERT(single == added);
+  }
+
+  void test_copy() {
+    SpectrumDefinition def(1);
+    auto copy(def);
+    TS_ASSERT(copy == def);
+    TS_ASSERT_DIFFERS(copy.begin(), def.begin());
+    def.add(2);
+    copy = def;
+    TS_ASSERT_EQUALS(copy.size(), 2);
+    TS_ASSERT_EQUALS(copy[1], (std::pair<size_t, size_t>(2, 0)));
+  }
 };
 
 #endif /* MANTID_TYPES_SPECTRUMDEFINITIONTEST_H_ */
@@ -14,6 +14,8 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
+#include <future>
+
 namespace Mantid {
 namespace WorkflowAlgorithms {
 
@@ -226,19 +228,30 @@ void LoadEventAndCompress::exec() {
 
   Progress progress(this, 0.0, 1.0, 2);
 
+  // The next chunk is loaded in the background while the current one is
+  // filtered, compressed and added to the result, so reading the file
+  // overlaps with processing. At most two chunks are held at once.
+  const size_t numRows = m_chunkingTable->rowCount();
+  std::future<MatrixWorkspace_sptr> nextChunk;
+  const auto loadInBackground = [this, numRows, &nextChunk](const size_t i) {
+    if (i < numRows)
+      nextChunk = std::async(std::launch::async,
+                             [this, i] { return loadChunk(i); });
+  };
+
   // first run is free
   progress.report("Loading Chunk");
   MatrixWorkspace_sptr resultWS = loadChunk(0);
+  loadInBackground(1);
   progress.report("Process Chunk");
   resultWS = processChunk(resultWS);
 
   // load the other chunks
-  const size_t numRows = m_chunkingTable->rowCount();
-
   progress.resetNumSteps(numRows, 0, 1);
 
   for (size_t i = 1; i < numRows; ++i) {
-    MatrixWorkspace_sptr temp = loadChunk(i);
+    MatrixWorkspace_sptr temp = nextChunk.get();
+    loadInBackground(i + 1);
     temp = processChunk(temp);
 
     // remove logs
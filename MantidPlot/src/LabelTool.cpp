@@ -441,7 +441,7 @@ QSet<QString> LabelTool::logValues() {
   using Mantid::Kernel::TimeSeriesProperty;
 
   QSet<QString> logProperties;
-  const auto &ads = AnalysisDataService::Instance();
+  auto &ads = AnalysisDataService::Instance();
   foreach (QString workspaceName, workspaceNames()) {
     auto matrixWs =
         ads.retrieveWS<MatrixWorkspace>(workspaceName.toStdString());
@@ -621,7 +621,7 @@ void ProjectRecovery::saveOpenWindows(const std::string &projectDestFile,
  * @throw If saving fails in the script
  */
 void ProjectRecovery::saveWsHistories(const Poco::Path &historyDestFolder) {
-  const auto &ads = Mantid::API::AnalysisDataService::Instance();
+  auto &ads = Mantid::API::AnalysisDataService::Instance();
 
   // Hold a copy to the shared pointers so they do not get deleted under us
   auto wsHandles = ads.getObjects(Mantid::Kernel::DataServiceHidden::Include);
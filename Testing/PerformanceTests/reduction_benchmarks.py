@@ -0,0 +1,278 @@
+#!/usr/bin/env python
+# Mantid Repository : https://github.com/mantidproject/mantid
+#
+# Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+#     NScD Oak Ridge National Laboratory, European Spallation Source
+#     & Institut Laue - Langevin
+# SPDX - License - Identifier: GPL - 3.0 +
+""" Times whole reductions on synthetic event data of a chosen size.
+
+An event workspace with the requested number of pixels, events and log
+entries is created with CreateSampleWorkspace and saved with
+SaveNexusProcessed. Each reduction then loads the file and runs its stages
+in turn, once for each requested number of threads. Every run happens in a
+fresh process, so that its peak memory is not hidden by an earlier one.
+
+For each stage the wall and CPU times, the events processed per second and
+the peak resident set size are reported, and can be written to a JSON file
+for comparison between machines or commits.
+
+Example, on 1 and 8 threads:
+
+    reduction_benchmarks.py --pixels 100000 --events 100000000 --threads 1 8
+"""
+from __future__ import (absolute_import, division, print_function)
+
+import argparse
+import json
+import os
+import resource
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+REDUCTIONS = ['powder', 'sans', 'scd', 'direct']
+
+
+#====================================================================================
+class MemoryTracer(object):
+    """ Samples the resident set size of this process in a background thread,
+    to find the peak reached during each stage. """
+
+    def __init__(self, interval=0.01):
+        self._interval = interval
+        self._peak = 0
+        self._stop = threading.Event()
+        self._page_size = os.sysconf('SC_PAGE_SIZE') if hasattr(os, 'sysconf') else 4096
+        self._thread = threading.Thread(target=self._sample)
+        self._thread.daemon = True
+        self._thread.start()
+
+    def current(self):
+        """ Returns the resident set size in bytes """
+        try:
+            with open('/proc/self/statm') as statm:
+                return int(statm.read().split()[1]) * self._page_size
+        except (IOError, OSError):
+            # Not Linux: the high-water mark is the best we have
+            maxrss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+            return maxrss if sys.platform == 'darwin' else maxrss * 1024
+
+    def _sample(self):
+        while not self._stop.is_set():
+            self._peak = max(self._peak, self.current())
+            time.sleep(self._interval)
+
+    def reset(self):
+        """ Starts a new peak from the present size """
+        self._peak = self.current()
+
+    def peak(self):
+        return max(self._peak, self.current())
+
+    def stop(self):
+        self._stop.set()
+        self._thread.join()
+
+
+#====================================================================================
+def generate(args, filename):
+    """ Create the synthetic event data and save it """
+    from mantid import simpleapi as api
+    from mantid.kernel import DateAndTime, FloatTimeSeriesProperty
+
+    bank_pixel_width = max(1, int(round((args.pixels / args.banks) ** 0.5)))
+    pixels = args.banks * bank_pixel_width ** 2
+    events_per_pixel = max(1, args.events // pixels)
+    print('Generating {} pixels with {} events each in {}'.format(
+        pixels, events_per_pixel, filename))
+
+    ws = api.CreateSampleWorkspace(WorkspaceType='Event', Function='Powder Diffraction',
+                                   NumBanks=args.banks, BankPixelWidth=bank_pixel_width,
+                                   NumEvents=events_per_pixel, XMin=1000., XMax=20000.,
+                                   BinWidth=100., StoreInADS=False)
+
+    # Logs with one entry per pulse-like interval over an hour long run
+    start = DateAndTime('2019-01-01T00:00:00').totalNanoseconds()
+    step = int(3600e9 / max(1, args.log_entries))
+    run = ws.mutableRun()
+    for index in range(args.logs):
+        log = FloatTimeSeriesProperty('benchmark_log_{}'.format(index))
+        for entry in range(args.log_entries):
+            log.addValue(DateAndTime(start + entry * step), float(entry % 100))
+        run.addProperty(log.name, log, True)
+
+    api.SaveNexusProcessed(InputWorkspace=ws, Filename=filename)
+
+
+#====================================================================================
+def powder_stages(api):
+    return [
+        ('ConvertUnits', lambda ws: api.ConvertUnits(ws, Target='dSpacing', OutputWorkspace=ws)),
+        ('CreateGroupingWorkspace',
+         lambda ws: api.CreateGroupingWorkspace(InputWorkspace=ws, GroupDetectorsBy='bank',
+                                                OutputWorkspace='benchmark_grouping')),
+        ('DiffractionFocussing',
+         lambda ws: api.DiffractionFocussing(ws, GroupingWorkspace='benchmark_grouping',
+                                             OutputWorkspace=ws)),
+        ('Rebin', lambda ws: api.Rebin(ws, Params='0.2,-0.001,5', PreserveEvents=False,
+                                       OutputWorkspace=ws)),
+    ]
+
+
+def sans_stages(api):
+    return [
+        ('ConvertUnits', lambda ws: api.ConvertUnits(ws, Target='Wavelength', OutputWorkspace=ws)),
+        ('Rebin', lambda ws: api.Rebin(ws, Params='0.5,0.05,10', PreserveEvents=False,
+                                       OutputWorkspace=ws)),
+        ('Q1D', lambda ws: api.Q1D(ws, OutputBinning='0.001,-0.02,0.5', OutputWorkspace=ws)),
+    ]
+
+
+def scd_stages(api):
+    return [
+        ('ConvertToMD',
+         lambda ws: api.ConvertToMD(ws, QDimensions='Q3D', dEAnalysisMode='Elastic',
+                                    Q3DFrames='Q_lab', OutputWorkspace='benchmark_md')),
+        ('FindPeaksMD',
+         lambda ws: api.FindPeaksMD('benchmark_md', MaxPeaks=100,
+                                    OutputWorkspace='benchmark_peaks')),
+        ('IntegratePeaksMD',
+         lambda ws: api.IntegratePeaksMD('benchmark_md', PeakRadius=0.1,
+                                         PeaksWorkspace='benchmark_peaks',
+                                         OutputWorkspace='benchmark_peaks')),
+    ]
+
+
+def direct_stages(api):
+    ei = 50.
+    return [
+        ('ConvertUnits',
+         lambda ws: api.ConvertUnits(ws, Target='DeltaE', EMode='Direct', EFixed=ei,
+                                     OutputWorkspace=ws)),
+        ('Rebin', lambda ws: api.Rebin(ws, Params='-20,0.5,45', PreserveEvents=False,
+                                       OutputWorkspace=ws)),
+        ('SofQW', lambda ws: api.SofQW(ws, QAxisBinning='0,0.05,10', EMode='Direct',
+                                       EFixed=ei, OutputWorkspace=ws)),
+    ]
+
+
+STAGES = {'powder': powder_stages, 'sans': sans_stages, 'scd': scd_stages,
+          'direct': direct_stages}
+
+
+#====================================================================================
+def run_reduction(reduction, filename, threads):
+    """ Run one reduction in this process. Returns a list of stage results. """
+    from mantid import simpleapi as api
+    from mantid.api import AnalysisDataService, FrameworkManager
+
+    FrameworkManager.Instance().setNumOMPThreads(threads)
+    tracer = MemoryTracer()
+    results = []
+
+    def timed(stage, action):
+        tracer.reset()
+        wall, cpu = time.time(), sum(os.times()[:2])
+        action()
+        wall, cpu = time.time() - wall, sum(os.times()[:2]) - cpu
+        results.append({'reduction': reduction, 'threads': threads, 'stage': stage,
+                        'seconds': wall, 'cpu_seconds': cpu, 'events': events[0],
+                        'events_per_second': events[0] / wall if wall > 0 else 0.,
+                        'peak_rss_mb': tracer.peak() / 1024. ** 2})
+
+    events = [0]
+    name = 'benchmark_data'
+
+    def load():
+        api.Load(Filename=filename, OutputWorkspace=name)
+        events[0] = AnalysisDataService[name].getNumberEvents()
+
+    timed('Load', load)
+    for stage, action in STAGES[reduction](api):
+        timed(stage, lambda: action(name))
+    tracer.stop()
+    return results
+
+
+#====================================================================================
+def run_in_subprocess(reduction, filename, threads):
+    """ Run one reduction in a new process and return its results """
+    handle, result_file = tempfile.mkstemp(suffix='.json')
+    os.close(handle)
+    try:
+        subprocess.check_call([sys.executable, os.path.abspath(__file__), '--worker', reduction,
+                               '--file', filename, '--threads', str(threads),
+                               '--output', result_file])
+        with open(result_file) as results:
+            return json.load(results)
+    finally:
+        os.remove(result_file)
+
+
+def print_table(results):
+    header = '{:<8} {:>7} {:<24} {:>9} {:>9} {:>14} {:>11}'
+    print(header.format('reduction', 'threads', 'stage', 'wall [s]', 'cpu [s]',
+                        'events/s', 'peak RSS MB'))
+    for r in results:
+        print('{:<8} {:>7} {:<24} {:>9.2f} {:>9.2f} {:>14.4g} {:>11.0f}'.format(
+            r['reduction'], r['threads'], r['stage'], r['seconds'], r['cpu_seconds'],
+            r['events_per_second'], r['peak_rss_mb']))
+
+
+def run(args):
+    """ Execute the program """
+    if args.worker:
+        results = run_reduction(args.worker, args.file, args.threads[0])
+        with open(args.output, 'w') as output:
+            json.dump(results, output)
+        return
+
+    filename = args.file
+    if filename is None or not os.path.exists(filename):
+        if filename is None:
+            filename = os.path.join(tempfile.gettempdir(), 'reduction_benchmark_p{}_e{}.nxs'.format(
+                args.pixels, args.events))
+        generate(args, filename)
+
+    results = []
+    for threads in args.threads:
+        for reduction in args.reductions:
+            print('Running {} on {} threads'.format(reduction, threads))
+            results.extend(run_in_subprocess(reduction, filename, threads))
+
+    print_table(results)
+    if args.output:
+        with open(args.output, 'w') as output:
+            json.dump({'pixels': args.pixels, 'events': args.events,
+                       'logs': args.logs, 'log_entries': args.log_entries,
+                       'results': results}, output, indent=2)
+        print('Results written to {}'.format(args.output))
+
+
+#====================================================================================
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Times reductions on synthetic event data, '
+                                     'reporting the throughput and peak memory of each stage.')
+    parser.add_argument('--pixels', type=int, default=10000,
+                        help='Number of pixels of the synthetic instrument. Default 10000.')
+    parser.add_argument('--banks', type=int, default=4,
+                        help='Number of square banks the pixels are split into. Default 4.')
+    parser.add_argument('--events', type=int, default=10000000,
+                        help='Total number of events. Default 10000000.')
+    parser.add_argument('--logs', type=int, default=2,
+                        help='Number of time series logs. Default 2.')
+    parser.add_argument('--log-entries', type=int, default=36000,
+                        help='Number of entries in each log. Default 36000.')
+    parser.add_argument('--threads', type=int, nargs='+', default=[1],
+                        help='Numbers of threads to run the reductions on. Default 1.')
+    parser.add_argument('--reductions', nargs='+', choices=REDUCTIONS, default=REDUCTIONS,
+                        help='Reductions to run. Default all.')
+    parser.add_argument('--file',
+                        help='Synthetic data file. Created if it does not exist, '
+                        'otherwise reused as it is.')
+    parser.add_argument('--output', help='JSON file to write the results to.')
+    parser.add_argument('--worker', choices=REDUCTIONS, help=argparse.SUPPRESS)
+    run(parser.parse_args())
@@ -0,0 +1,54 @@
+# Download and build Google Benchmark for the framework benchmarks
+# BENCHMARK_LIBRARIES the libraries to link the benchmarks against
+# BENCHMARK_INCLUDE_DIR where to find benchmark/benchmark.h
+
+# Make benchmark_version available everywhere
+set (benchmark_version "1.5.0" CACHE INTERNAL "")
+
+option(USE_SYSTEM_BENCHMARK "Use the system installed Google Benchmark - v${benchmark_version}?" OFF)
+
+if(USE_SYSTEM_BENCHMARK)
+  message(STATUS "Using system Google Benchmark")
+  find_package(benchmark ${benchmark_version} REQUIRED)
+  set( BENCHMARK_LIBRARIES benchmark::benchmark )
+else()
+  message(STATUS "Using Google Benchmark in ExternalProject")
+
+  # Only the library is needed
+  set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+  # Download and unpack benchmark at configure time
+  configure_file(${CMAKE_SOURCE_DIR}/buildconfig/CMake/GoogleBenchmark.in
+                 ${CMAKE_BINARY_DIR}/googlebenchmark-download/CMakeLists.txt @ONLY)
+  execute_process(COMMAND ${CMAKE_COMMAND} -G "${CMAKE_GENERATOR}" -DCMAKE_SYSTEM_VERSION=${CMAKE_SYSTEM_VERSION} .
+                  RESULT_VARIABLE result
+                  WORKING_DIRECTORY ${CMAKE_BINARY_DIR}/googlebenchmark-download )
+  if(result)
+    message(FATAL_ERROR "CMake step for googlebenchmark failed: ${result}")
+  endif()
+  execute_process(COMMAND ${CMAKE_COMMAND} --build .
+                  RESULT_VARIABLE result
+                  WORKING_DIRECTORY ${CMAKE_BINARY_DIR}/googlebenchmark-download )
+  if(result)
+    message(FATAL_ERROR "Build step for googlebenchmark failed: ${result}")
+  endif()
+
+  # Add benchmark directly to our build. This defines the benchmark target.
+  add_subdirectory(${CMAKE_BINARY_DIR}/googlebenchmark-src
+                   ${CMAKE_BINARY_DIR}/googlebenchmark-build)
+
+  # Hide targets from "all" and put them in the Benchmarks folder in MSVS
+  foreach( target_var benchmark benchmark_main )
+    set_target_properties( ${target_var}
+                           PROPERTIES EXCLUDE_FROM_ALL TRUE
+                           FOLDER "Benchmarks/benchmark" )
+  endforeach()
+
+  set( BENCHMARK_LIBRARIES benchmark )
+  find_path ( BENCHMARK_INCLUDE_DIR benchmark/benchmark.h
+              PATHS ${CMAKE_BINARY_DIR}/googlebenchmark-src/include
+              NO_DEFAULT_PATH )
+  mark_as_advanced ( BENCHMARK_INCLUDE_DIR )
+endif()
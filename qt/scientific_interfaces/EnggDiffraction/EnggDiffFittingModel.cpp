@@ -204,7 +204,7 @@ void EnggDiffFittingModel::createFittedPeaksWS(const RunLabel &runLabel) {
 
   alignDetectors(FITTED_PEAKS_WS_NAME, FITTED_PEAKS_WS_NAME);
 
-  const auto &ADS = Mantid::API::AnalysisDataService::Instance();
+  auto &ADS = Mantid::API::AnalysisDataService::Instance();
 
   const auto fittedPeaksWS =
       ADS.retrieveWS<Mantid::API::MatrixWorkspace>(FITTED_PEAKS_WS_NAME);
@@ -367,7 +367,7 @@ void EnggDiffFittingModel::convertFromDistribution(
 
 void EnggDiffFittingModel::alignDetectors(const std::string &inputWSName,
                                           const std::string &outputWSName) {
-  const auto &ADS = Mantid::API::AnalysisDataService::Instance();
+  auto &ADS = Mantid::API::AnalysisDataService::Instance();
   const auto inputWS =
       ADS.retrieveWS<Mantid::API::MatrixWorkspace>(inputWSName);
   alignDetectors(inputWS, outputWSName);
@@ -59,7 +59,7 @@ MantidEVWorker::~MantidEVWorker() {}
  *          doesn't exist.
  */
 std::string MantidEVWorker::workspaceType(const std::string &ws_name) {
-  const auto &ADS = AnalysisDataService::Instance();
+  auto &ADS = AnalysisDataService::Instance();
 
   if (!ADS.doesExist(ws_name))
     return std::string("");
@@ -198,7 +198,7 @@ bool MantidEVWorker::loadAndConvertToMD(
           return false;
       } else if (axisCORELLI.compare(
                      "Select Goniometer Axis for CORELLI only") != 0) {
-        const auto &ADS = AnalysisDataService::Instance();
+        auto &ADS = AnalysisDataService::Instance();
         Mantid::API::MatrixWorkspace_sptr ev_ws =
             ADS.retrieveWS<MatrixWorkspace>(ev_ws_name);
         double phi = ev_ws->run().getLogAsSingleValue(
@@ -273,7 +273,7 @@ bool MantidEVWorker::convertToHKL(const std::string &ev_ws_name,
                                   const double minQ, const double maxQ) {
   try {
     IAlgorithm_sptr alg;
-    const auto &ADS = AnalysisDataService::Instance();
+    auto &ADS = AnalysisDataService::Instance();
     Mantid::API::MatrixWorkspace_sptr ev_ws =
         ADS.retrieveWS<MatrixWorkspace>(ev_ws_name);
     double Q = maxQ;
@@ -384,7 +384,7 @@ bool MantidEVWorker::findPeaks(const std::string &ev_ws_name,
     alg->setProperty("MaxPeaks", (int64_t)num_to_find);
     alg->setProperty("DensityThresholdFactor", min_intensity);
     alg->setProperty("OutputWorkspace", peaks_ws_name);
-    const auto &ADS = AnalysisDataService::Instance();
+    auto &ADS = AnalysisDataService::Instance();
 
     if (alg->execute()) {
       double monitor_count = 0;
@@ -1125,7 +1125,7 @@ bool MantidEVWorker::showUB(const std::string &peaks_ws_name) {
     return false;
   }
 
-  const auto &ADS = AnalysisDataService::Instance();
+  auto &ADS = AnalysisDataService::Instance();
   IPeaksWorkspace_sptr peaks_ws =
       ADS.retrieveWS<IPeaksWorkspace>(peaks_ws_name);
 
@@ -1206,7 +1206,7 @@ bool MantidEVWorker::getUB(const std::string &peaks_ws_name, bool lab_coords,
     return false;
   }
 
-  const auto &ADS = AnalysisDataService::Instance();
+  auto &ADS = AnalysisDataService::Instance();
   IPeaksWorkspace_sptr peaks_ws =
       ADS.retrieveWS<IPeaksWorkspace>(peaks_ws_name);
 
@@ -83,7 +83,7 @@ std::string AsciiSaver::assembleSavePath(std::string const &saveDirectory,
 
 Mantid::API::Workspace_sptr
 AsciiSaver::workspace(std::string const &workspaceName) const {
-  auto const &ads = Mantid::API::AnalysisDataService::Instance();
+  auto &ads = Mantid::API::AnalysisDataService::Instance();
 
   if (!ads.doesExist(workspaceName))
     return nullptr;
@@ -595,7 +595,7 @@ bool IndirectTab::getResolutionRangeFromWs(
 QPair<double, double>
 IndirectTab::getXRangeFromWorkspace(std::string const &workspaceName,
                                     double precision) const {
-  auto const &ads = AnalysisDataService::Instance();
+  auto &ads = AnalysisDataService::Instance();
   if (ads.doesExist(workspaceName))
     return getXRangeFromWorkspace(
         ads.retrieveWS<MatrixWorkspace>(workspaceName), precision);
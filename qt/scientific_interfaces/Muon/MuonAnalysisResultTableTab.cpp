@@ -291,7 +291,7 @@ std::pair<QStringList, QStringList> MuonAnalysisResultTableTab::getFitLabels() {
 QStringList
 MuonAnalysisResultTableTab::getMultipleFitWorkspaces(const QString &label,
                                                      bool sequential) {
-  const AnalysisDataServiceImpl &ads = AnalysisDataService::Instance();
+  AnalysisDataServiceImpl &ads = AnalysisDataService::Instance();
 
   const std::string groupName = [&label, &sequential]() {
     if (sequential) {